@@ -104,10 +104,12 @@ struct GP_ANONYMOUS_STRUCT(__LINE__) \
 typedef void  (*gp_arr_map_callback_t)(/* T* out_element, const T* in_element */);
 typedef void* (*gp_arr_fold_callback_t)(/* Any* accumulator, const T* element */);
 typedef bool  (*gp_arr_filter_callback_t)(/* const T* element */);
+typedef int   (*gp_arr_sort_callback_t)(/* const T* element1, const T* element2 */);
 #else
 typedef void* gp_arr_map_callback_t;
 typedef void* gp_arr_fold_callback_t;
 typedef void* gp_arr_filter_callback_t;
+typedef void* gp_arr_sort_callback_t;
 #endif
 
 /** Getters.
@@ -556,6 +558,34 @@ size_t gp_arr_filter(
     size_t                   optional_src_length,
     gp_arr_filter_callback_t f);
 
+/** Sort elements.
+ * Sorts @p arr in place in ascending order according to @p compare, which
+ * takes pointers to two elements and returns negative, zero, or positive like
+ * comparators passed to qsort(). The sort is not stable. Uses introsort with
+ * insertion sort for short ranges and heapsort as fallback, so worst case is
+ * O(n log n). Already sorted or reverse sorted ranges are detected and sorted
+ * in linear time.
+ */
+GP_NONNULL_ARGS()
+void gp_arr_sort(
+    size_t                 element_size,
+    GPArrayAny             arr,
+    gp_arr_sort_callback_t compare);
+
+/** Sort elements using multiple threads.
+ * Splits @p arr to @p thread_count runs, sorts each run in it's own thread
+ * with gp_arr_sort(), and merges the sorted runs in parallel. Allocates a
+ * temporary buffer the size of @p arr from the global heap. Falls back to
+ * single threaded gp_arr_sort() for short arrays and if @p thread_count <= 1.
+ * Unlike gp_arr_sort(), @p compare must be thread safe.
+ */
+GP_NONNULL_ARGS()
+void gp_arr_sort_parallel(
+    size_t                 element_size,
+    GPArrayAny             arr,
+    gp_arr_sort_callback_t compare,
+    size_t                 thread_count);
+
 
 // ----------------------------------------------------------------------------
 // Type Safe Macro Shadowing
@@ -806,6 +836,37 @@ size_t gp_arr_filter(
         GP_FPTR_TO_VOIDPTR(bool_FUNC_const_T_ptr_ELEMENT)) \
 )
 
+/** Sort elements.
+ * Sorts @p arr in place in ascending order according to @p compare, which
+ * takes pointers to two elements and returns negative, zero, or positive like
+ * comparators passed to qsort(). The sort is not stable.
+ */
+#define gp_arr_sort(                                       \
+    size_t_ELEMENT_SIZE,                                   \
+    GPArrayT,                                              \
+    int_FUNC_const_T_ptr_ELEMENT1_const_T_ptr_ELEMENT2)    \
+( \
+    0 ? (void)(int_FUNC_const_T_ptr_ELEMENT1_const_T_ptr_ELEMENT2)(GPArrayT, GPArrayT) : (void)0, \
+    gp_arr_sort(GP_CHECK_SIZE(size_t_ELEMENT_SIZE, *(GPArrayT)), \
+        GPArrayT, GP_FPTR_TO_VOIDPTR(int_FUNC_const_T_ptr_ELEMENT1_const_T_ptr_ELEMENT2)) \
+)
+
+/** Sort elements using multiple threads.
+ * Like gp_arr_sort(), but sorts and merges runs of @p arr in @p thread_count
+ * threads. @p compare must be thread safe.
+ */
+#define gp_arr_sort_parallel(                              \
+    size_t_ELEMENT_SIZE,                                   \
+    GPArrayT,                                              \
+    int_FUNC_const_T_ptr_ELEMENT1_const_T_ptr_ELEMENT2,    \
+    size_t_THREAD_COUNT)                                   \
+( \
+    0 ? (void)(int_FUNC_const_T_ptr_ELEMENT1_const_T_ptr_ELEMENT2)(GPArrayT, GPArrayT) : (void)0, \
+    gp_arr_sort_parallel(GP_CHECK_SIZE(size_t_ELEMENT_SIZE, *(GPArrayT)), \
+        GPArrayT, GP_FPTR_TO_VOIDPTR(int_FUNC_const_T_ptr_ELEMENT1_const_T_ptr_ELEMENT2), \
+        size_t_THREAD_COUNT) \
+)
+
 
 // ----------------------------------------------------------------------------
 //
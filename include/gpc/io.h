@@ -49,6 +49,23 @@ extern "C" {
 #define/* size_t */gp_file_println(FILE_ptr, ...) \
     GP_FILE_PRINTLN(FILE_ptr, __VA_ARGS__)
 
+// Like gp_print() family, but arguments are converted like in
+// gp_str_print_values(), no format strings. Output is written with a single
+// call to fwrite() unless it's long. Requires C11 or C++.
+#if GP_HAS_C11_GENERIC || __cplusplus
+#define/* size_t */gp_print_values(...) \
+    GP_FILE_PRINT_VALUES(stdout, __VA_ARGS__)
+
+#define/* size_t */gp_println_values(...) \
+    GP_FILE_PRINTLN_VALUES(stdout, __VA_ARGS__)
+
+#define/* size_t */gp_file_print_values(FILE_ptr, ...) \
+    GP_FILE_PRINT_VALUES(FILE_ptr, __VA_ARGS__)
+
+#define/* size_t */gp_file_println_values(FILE_ptr, ...) \
+    GP_FILE_PRINTLN_VALUES(FILE_ptr, __VA_ARGS__)
+#endif
+
 // ----------------------------------------------------------------------------
 
 /** Opens file.
@@ -121,6 +138,16 @@ bool gp_file_read_strip(
     FILE*       in,
     const char* optional_utf8_char_set);
 
+/** Write string builder contents to file.
+ * Writes all segments with writev() where available without building the
+ * string first. The stream is flushed before writing.
+ * @return number of bytes written.
+ */
+GP_NONNULL_ARGS()
+size_t gp_file_write_str_builder(
+    FILE*               out,
+    const GPStrBuilder* builder);
+
 // Portability wrappers for stat. Check the man-pages.
 
 #if _WIN32
@@ -165,8 +192,34 @@ size_t gp_internal_file_println(
     const GPInternalReflectionData* objs,
     ...);
 
+size_t gp_internal_file_print_formatted(
+    FILE* file,
+    size_t arg_count,
+    const GPInternalFormatted* objs);
+
+size_t gp_internal_file_println_formatted(
+    FILE* file,
+    size_t arg_count,
+    const GPInternalFormatted* objs);
+
 #if !__cplusplus
 
+#if GP_HAS_C11_GENERIC
+#define GP_FILE_PRINT_VALUES(OUT, ...) \
+    gp_internal_file_print_formatted( \
+        OUT, \
+        GP_COUNT_ARGS(__VA_ARGS__), \
+        (GPInternalFormatted[]) \
+            { GP_PROCESS_ALL_ARGS(GP_FORMATTED, GP_COMMA, __VA_ARGS__) })
+
+#define GP_FILE_PRINTLN_VALUES(OUT, ...) \
+    gp_internal_file_println_formatted( \
+        OUT, \
+        GP_COUNT_ARGS(__VA_ARGS__), \
+        (GPInternalFormatted[]) \
+            { GP_PROCESS_ALL_ARGS(GP_FORMATTED, GP_COMMA, __VA_ARGS__) })
+#endif
+
 #define GP_FILE_PRINT(OUT, ...) \
     gp_internal_file_print( \
         OUT, \
@@ -196,6 +249,9 @@ size_t gp_internal_file_println(
         GP_PROCESS_ALL_ARGS(GP_EVAL, GP_STREAM_INSERT_SPACE, __VA_ARGS__) << "\n" \
     ).str().c_str(), OUT)
 
+#define GP_FILE_PRINT_VALUES(OUT, ...)   GP_FILE_PRINT(OUT, __VA_ARGS__)
+#define GP_FILE_PRINTLN_VALUES(OUT, ...) GP_FILE_PRINTLN(OUT, __VA_ARGS__)
+
 #endif // __cplusplus
 
 #endif // GP_IO_INCLUDED
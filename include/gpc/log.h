@@ -0,0 +1,299 @@
+// MIT License
+// Copyright (c) 2023 Lauri Lorenzo Fiestas
+// https://github.com/PrinssiFiestas/libGPC/blob/main/LICENSE.md
+
+/**@file log.h
+ * Binary logging with deferred formatting.
+ */
+
+#ifndef GP_LOG_INCLUDED
+#define GP_LOG_INCLUDED 1
+
+#include <gpc/string.h>
+#include <gpc/thread.h>
+#include <stdio.h>
+#include <stdint.h>
+
+#if GP_HAS_ATOMICS && !__cplusplus
+#include <stdatomic.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ----------------------------------------------------------------------------
+//
+//          API REFERENCE
+//
+// ----------------------------------------------------------------------------
+
+// gp_log() does not format anything. It copies an id of the format string and
+// raw bytes of the arguments to a ring buffer owned by the calling thread,
+// which costs about as much as storing the arguments to memory. Ring buffers
+// are written to a binary log file by gp_log_flush(), which is also called
+// when a ring buffer gets full. The binary log is formatted later with
+// gp_log_decode() or the gplogdecode tool.
+//
+// The first argument must be a string literal, which is used like a format
+// string in gp_print(). Length modifiers are ignored, the types of the
+// arguments are used instead, so gp_log("%x", (short)-1) logs "ffff".
+// Arguments that are not consumed by the format string are appended separated
+// by spaces like in gp_println(). Every record is terminated with a newline.
+// Requires C11.
+/*
+    gp_log_open(log_file, 0);
+    gp_log("Connected to %s in %.2f ms.", host, ms, "retries:", retries);
+    gp_log_close();
+    ...
+    gp_log_decode(stdout, log_file);
+ */
+
+#if GP_HAS_C11_GENERIC && !__cplusplus
+#define/* void */gp_log(/* const char* format_literal, */...) \
+    GP_LOG(__VA_ARGS__)
+#endif
+
+#define GP_LOG_DEFAULT_BUFFER_CAPACITY (1 << 16)
+
+/** Start logging to @p binary_out.
+ * @p buffer_capacity is the size of the ring buffer of each thread rounded up
+ * to a power of 2, or 0 for GP_LOG_DEFAULT_BUFFER_CAPACITY. Records that do
+ * not fit in an empty ring buffer are dropped. If logging was already open, it
+ * gets closed first.
+ * @return false if writing the file header failed.
+ */
+bool gp_log_open(FILE* binary_out, size_t buffer_capacity) GP_NONNULL_ARGS();
+
+/** Write buffered records of all threads to the log file.
+ * Records of a single thread stay in order, but records of different threads
+ * are only ordered by flushes.
+ * @return number of bytes written.
+ */
+size_t gp_log_flush(void);
+
+/** Flush and stop logging.
+ * The log file is not closed. Other threads should not be logging while this
+ * is called.
+ */
+void gp_log_close(void);
+
+/** Format binary log as text.
+ * The log must be decoded on a platform that has the same sizes of types and
+ * endianness as the one that wrote it.
+ * @return false if @p binary_in is not a log file or is truncated.
+ */
+bool gp_log_decode(FILE* text_out, FILE* binary_in) GP_NONNULL_ARGS();
+
+// ----------------------------------------------------------------------------
+//
+//          END OF API REFERENCE
+//
+//          Code below is for internal usage and may change without notice.
+//
+// ----------------------------------------------------------------------------
+
+#if !__cplusplus
+
+#if GP_HAS_ATOMICS
+#define GP_INTERNAL_LOG_LOAD(PTR, ORDER)     atomic_load_explicit(PTR, memory_order_##ORDER)
+#define GP_INTERNAL_LOG_STORE(PTR, X, ORDER) atomic_store_explicit(PTR, X, memory_order_##ORDER)
+#else
+#define GP_INTERNAL_LOG_LOAD(PTR, ORDER)     (*(PTR))
+#define GP_INTERNAL_LOG_STORE(PTR, X, ORDER) (*(PTR) = (X))
+#endif
+
+#define GP_INTERNAL_LOG_CLOSED UINT32_MAX
+
+// Static data of a single gp_log() call site. The format string and types are
+// written to the log file once per session when the call site is first used.
+typedef struct gp_internal_log_format
+{
+    const char*              format;
+    const gp_type_t*         types;
+    uint32_t                 arg_count;
+    uint32_t                 id;
+    GP_MAYBE_ATOMIC uint32_t session; // id is valid if matches current session
+} GPInternalLogFormat;
+
+// Single producer single consumer ring buffer. head and tail are not wrapped,
+// they only get masked when indexing data.
+typedef struct gp_internal_log_buffer
+{
+    GP_MAYBE_ATOMIC size_t         head;       // written by owner thread
+    size_t                         tail_cache; // owner threads view of tail
+    size_t                         mask;       // capacity - 1
+    uint32_t                       session;    // written by owner thread
+    char                           padding[64]; // keep tail away from head
+    GP_MAYBE_ATOMIC size_t         tail;       // written by gp_log_flush()
+    struct gp_internal_log_buffer* next;
+    unsigned char                  data[];
+} GPInternalLogBuffer;
+
+typedef struct gp_internal_log_writer
+{
+    GPInternalLogBuffer* buffer; // NULL if record is dropped
+    size_t               position;
+} GPInternalLogWriter;
+
+extern GP_MAYBE_ATOMIC uint32_t gp_internal_log_session;
+#ifndef GP_NO_THREAD_LOCALS
+extern GP_MAYBE_THREAD_LOCAL GPInternalLogBuffer* gp_internal_log_thread_buffer;
+#endif
+
+GPInternalLogWriter gp_internal_log_begin_slow(GPInternalLogFormat*);
+bool gp_internal_log_reserve(GPInternalLogWriter*, size_t size);
+
+GP_GNU_ATTRIB(always_inline)
+static inline void gp_internal_log_put(
+    GPInternalLogWriter* writer, const void* data, const size_t size)
+{
+    GPInternalLogBuffer* buffer = writer->buffer;
+    if (GP_UNLIKELY(buffer == NULL))
+        return;
+    if (GP_UNLIKELY(writer->position + size - buffer->tail_cache > buffer->mask + 1)
+        && ! gp_internal_log_reserve(writer, size))
+        return;
+
+    const size_t i = writer->position & buffer->mask;
+    if (GP_LIKELY(i + size <= buffer->mask + 1))
+        memcpy(buffer->data + i, data, size);
+    else {
+        const size_t first = buffer->mask + 1 - i;
+        memcpy(buffer->data + i, data, first);
+        memcpy(buffer->data, (const unsigned char*)data + first, size - first);
+    }
+    writer->position += size;
+}
+
+GP_GNU_ATTRIB(always_inline)
+static inline GPInternalLogWriter gp_internal_log_begin(GPInternalLogFormat* format)
+{
+    #ifndef GP_NO_THREAD_LOCALS
+    GPInternalLogBuffer* buffer = gp_internal_log_thread_buffer;
+    const uint32_t session = GP_INTERNAL_LOG_LOAD(&gp_internal_log_session, relaxed);
+    if (GP_LIKELY(buffer != NULL && buffer->session == session &&
+        GP_INTERNAL_LOG_LOAD(&format->session, acquire) == session))
+    {
+        GPInternalLogWriter writer = {
+            buffer, GP_INTERNAL_LOG_LOAD(&buffer->head, relaxed)
+        };
+        gp_internal_log_put(&writer, &format->id, sizeof format->id);
+        return writer;
+    }
+    #endif
+    return gp_internal_log_begin_slow(format);
+}
+
+GP_GNU_ATTRIB(always_inline)
+static inline void gp_internal_log_end(GPInternalLogWriter* writer)
+{
+    if (GP_LIKELY(writer->buffer != NULL))
+        GP_INTERNAL_LOG_STORE(&writer->buffer->head, writer->position, release);
+}
+
+// Strings are stored as 32-bit length followed by the characters.
+static inline void gp_internal_log_put_bytes(
+    GPInternalLogWriter* writer, const void* data, const size_t length)
+{
+    const uint32_t length32 = length < UINT32_MAX ? length : UINT32_MAX;
+    gp_internal_log_put(writer, &length32, sizeof length32);
+    gp_internal_log_put(writer, data, length32);
+}
+
+#define GP_INTERNAL_LOG_DEFINE_PUT(NAME, T) \
+    static inline void gp_internal_log_put_##NAME(GPInternalLogWriter* writer, const T x) \
+    { \
+        gp_internal_log_put(writer, &x, sizeof x); \
+    }
+
+GP_INTERNAL_LOG_DEFINE_PUT(bool,               bool)
+GP_INTERNAL_LOG_DEFINE_PUT(char,               char)
+GP_INTERNAL_LOG_DEFINE_PUT(signed_char,        signed char)
+GP_INTERNAL_LOG_DEFINE_PUT(unsigned_char,      unsigned char)
+GP_INTERNAL_LOG_DEFINE_PUT(short,              short)
+GP_INTERNAL_LOG_DEFINE_PUT(unsigned_short,     unsigned short)
+GP_INTERNAL_LOG_DEFINE_PUT(int,                int)
+GP_INTERNAL_LOG_DEFINE_PUT(unsigned,           unsigned)
+GP_INTERNAL_LOG_DEFINE_PUT(long,               long)
+GP_INTERNAL_LOG_DEFINE_PUT(unsigned_long,      unsigned long)
+GP_INTERNAL_LOG_DEFINE_PUT(long_long,          long long)
+GP_INTERNAL_LOG_DEFINE_PUT(unsigned_long_long, unsigned long long)
+GP_INTERNAL_LOG_DEFINE_PUT(int128,             GPInt128)
+GP_INTERNAL_LOG_DEFINE_PUT(uint128,            GPUInt128)
+GP_INTERNAL_LOG_DEFINE_PUT(float,              float)
+GP_INTERNAL_LOG_DEFINE_PUT(double,             double)
+#if GP_HAS_LONG_DOUBLE
+GP_INTERNAL_LOG_DEFINE_PUT(long_double,        long double)
+#endif
+GP_INTERNAL_LOG_DEFINE_PUT(ptr,                void*)
+#undef GP_INTERNAL_LOG_DEFINE_PUT
+
+static inline void gp_internal_log_put_cstr(GPInternalLogWriter* writer, const char* s)
+{
+    if (s == NULL)
+        s = "(null)";
+    gp_internal_log_put_bytes(writer, s, strlen(s));
+}
+
+static inline void gp_internal_log_put_str(GPInternalLogWriter* writer, const GPString s)
+{
+    gp_internal_log_put_bytes(writer, s, gp_str_length(s));
+}
+
+static inline void gp_internal_log_put_const_ptr(GPInternalLogWriter* writer, const void* p)
+{
+    gp_internal_log_put_ptr(writer, (void*)p);
+}
+
+#if GP_HAS_C11_GENERIC
+
+#define GP_INTERNAL_LOG_PUT(X) _Generic(X,                                  \
+    bool:                  gp_internal_log_put_bool,                        \
+    short:                 gp_internal_log_put_short,                       \
+    int:                   gp_internal_log_put_int,                         \
+    long:                  gp_internal_log_put_long,                        \
+    long long:             gp_internal_log_put_long_long,                   \
+    GP_INT128_SELECTION(gp_internal_log_put_int128,)                        \
+    unsigned short:        gp_internal_log_put_unsigned_short,              \
+    unsigned int:          gp_internal_log_put_unsigned,                    \
+    unsigned long:         gp_internal_log_put_unsigned_long,               \
+    unsigned long long:    gp_internal_log_put_unsigned_long_long,          \
+    GP_UINT128_SELECTION(gp_internal_log_put_uint128,)                      \
+    float:                 gp_internal_log_put_float,                       \
+    double:                gp_internal_log_put_double,                      \
+    GP_LONG_DOUBLE_SELECTION(gp_internal_log_put_long_double,)              \
+    GP_CHAR_SELECTION(gp_internal_log_put_char,)                            \
+    unsigned char:         gp_internal_log_put_unsigned_char,               \
+    signed char:           gp_internal_log_put_signed_char,                 \
+    char*:                 gp_internal_log_put_cstr,                        \
+    const char*:           gp_internal_log_put_cstr,                        \
+    struct gp_char*:       gp_internal_log_put_str,                         \
+    default:               gp_internal_log_put_const_ptr)(&gp_internal_log_writer, X)
+
+// The first argument is the format string, which is stored as the id of the
+// call site, so the type of it is skipped and the argument itself is only cast
+// to void when putting the arguments.
+#define GP_LOG(...) do \
+{ \
+    static const gp_type_t gp_internal_log_types[] = { \
+        GP_PROCESS_ALL_ARGS(GP_TYPE, GP_COMMA, __VA_ARGS__) }; \
+    static GPInternalLogFormat gp_internal_log_format = { \
+        GP_1ST_ARG(__VA_ARGS__), \
+        gp_internal_log_types + 1, \
+        GP_COUNT_ARGS(__VA_ARGS__) - 1, \
+        0, 0 }; \
+    GPInternalLogWriter gp_internal_log_writer = \
+        gp_internal_log_begin(&gp_internal_log_format); \
+    ((void)GP_PROCESS_ALL_BUT_1ST(GP_INTERNAL_LOG_PUT, GP_COMMA, __VA_ARGS__)); \
+    gp_internal_log_end(&gp_internal_log_writer); \
+} while (0)
+
+#endif // GP_HAS_C11_GENERIC
+#endif // !__cplusplus
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // GP_LOG_INCLUDED
@@ -0,0 +1,165 @@
+// MIT License
+// Copyright (c) 2023 Lauri Lorenzo Fiestas
+// https://github.com/PrinssiFiestas/libGPC/blob/main/LICENSE.md
+
+/**@file rope.h
+ * Rope data type for large edit heavy strings
+ */
+
+#ifndef GP_ROPE_INCLUDED
+#define GP_ROPE_INCLUDED 1
+
+#include "string.h"
+#include "memory.h"
+#include "attributes.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+// ----------------------------------------------------------------------------
+//
+//          API REFERENCE
+//
+// ----------------------------------------------------------------------------
+
+
+/** Rope.
+ * A balanced tree of string chunks. Unlike GPString, inserting, erasing, and
+ * slicing do not move the tail of the string, so edits take O(log n) time
+ * regardless of the position of the edit. Indices are byte indices like in
+ * GPString, @ref gp_rope_codepoint_index() can be used to find byte indices of
+ * codepoints.
+ */
+typedef struct gp_rope* GPRope;
+
+/** Rope iterator.*/
+typedef struct gp_rope_iterator
+{
+    const char* chunk; /**< Contiguous part of the rope. Not null-terminated. */
+    size_t      chunk_length;
+
+    const struct gp_rope* _rope;     /**< @private */
+    size_t                _position; /**< @private */
+} GPRopeIterator;
+
+// Feel free to define your own value for this. Inserting creates chunks of at
+// most this many bytes. Larger chunks make iteration faster and editing slower.
+#ifndef GP_ROPE_CHUNK_SIZE
+#define GP_ROPE_CHUNK_SIZE 1024
+#endif
+
+/** Create rope.*/
+GP_NONNULL_ARGS(1) GP_NONNULL_RETURN GP_NODISCARD
+GPRope gp_rope_new(
+    GPAllocator* allocator,
+    const void*  optional_init,
+    size_t       init_length);
+
+/** Deallocate rope and all of it's chunks.*/
+void gp_rope_delete(GPRope optional);
+
+/** Length in bytes.*/
+GP_NONNULL_ARGS() GP_NODISCARD
+size_t gp_rope_length(GPRope);
+
+/** Length in codepoints.
+ * Counts bytes that are not UTF-8 continuation bytes in O(1) time.
+ */
+GP_NONNULL_ARGS() GP_NODISCARD
+size_t gp_rope_codepoint_count(GPRope);
+
+/** Find codepoint.
+ * @return byte index of the codepoint at @p codepoint_index in O(log n) time
+ * or the rope length if @p codepoint_index is the codepoint count.
+ */
+GP_NONNULL_ARGS() GP_NODISCARD
+size_t gp_rope_codepoint_index(
+    GPRope,
+    size_t codepoint_index);
+
+/** Get byte.*/
+GP_NONNULL_ARGS() GP_NODISCARD
+uint8_t gp_rope_at(
+    GPRope,
+    size_t index);
+
+/** Add characters to specified position.*/
+GP_NONNULL_ARGS()
+void gp_rope_insert(
+    GPRope,
+    size_t      position,
+    const void* src,
+    size_t      src_length);
+
+/** Add characters to the end.*/
+GP_NONNULL_ARGS()
+static inline void gp_rope_append(
+    GPRope      rope,
+    const void* src,
+    size_t      src_length)
+{
+    gp_rope_insert(rope, gp_rope_length(rope), src, src_length);
+}
+
+/** Remove characters.
+ * Removes @p count bytes starting from @p position.
+ */
+GP_NONNULL_ARGS()
+void gp_rope_erase(
+    GPRope,
+    size_t position,
+    size_t count);
+
+/** Remove characters outside range.
+ * Keeps characters from @p start to @p end excluding @p end.
+ */
+GP_NONNULL_ARGS()
+void gp_rope_slice(
+    GPRope,
+    size_t start,
+    size_t end);
+
+/** Copy rope to string.
+ * @return number of bytes truncated if @p out is truncating.
+ */
+GP_NONNULL_ARGS()
+size_t gp_rope_flatten(
+    GPString* out,
+    GPRope    rope);
+
+/** Create iterator.
+ * Iteration starts from byte index @p start. Chunks must not be modified and
+ * are only valid until the rope is modified.
+ */
+GP_NONNULL_ARGS() GP_NODISCARD
+GPRopeIterator gp_rope_iterator(
+    GPRope,
+    size_t start);
+
+/** Advance iterator.
+ * @return true if a chunk was stored in @p it, false if there are no more
+ * chunks.
+ */
+GP_NONNULL_ARGS()
+bool gp_rope_next(GPRopeIterator* it);
+
+
+// ----------------------------------------------------------------------------
+//
+//          END OF API REFERENCE
+//
+//          Code below is for internal usage and may change without notice.
+//
+// ----------------------------------------------------------------------------
+
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // GP_ROPE_INCLUDED
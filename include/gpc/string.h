@@ -11,6 +11,7 @@
 
 #include "bytes.h"
 #include "array.h"
+#include <printf/conversions.h>
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -292,6 +293,35 @@ size_t gp_str_replace(
     const void* replacement,
     size_t      replacement_length);
 
+/** Replace all substrings.
+ * Finds all non-overlapping occurrences of @p needle from left to right first,
+ * reserves the exact resulting length once, and replaces them in a single pass.
+ * @return number of bytes truncated if @p haystack is truncating.
+ */
+GP_NONNULL_ARGS(1, 2, 4)
+size_t gp_str_replace_all(
+    GPString*   haystack,
+    const void* needle,
+    size_t      needle_length,
+    const void* replacement,
+    size_t      replacement_length,
+    size_t*     optional_replacement_count);
+
+/** Replace multiple different substrings in a single pass.
+ * Replaces occurrences of @p needles[i] with @p replacements[i] for each i less
+ * than @p count, which is useful for template substitution. Replacements are
+ * not searched for needles. If multiple needles match at the same position, the
+ * first one is chosen.
+ * @return number of bytes truncated if @p haystack is truncating.
+ */
+GP_NONNULL_ARGS(1, 3, 4)
+size_t gp_str_replace_many(
+    GPString*         haystack,
+    size_t            count,
+    const char*const* needles,
+    const char*const* replacements,
+    size_t*           optional_replacement_count);
+
 #define GP_WHITESPACE  " \t\n\v\f\r" \
     "\u00A0\u1680\u2000\u2001\u2002\u2003\u2004\u2005\u2006" \
     "\u2007\u2008\u2009\u200A\u2028\u2029\u202F\u205F\u3000\xC2\x85"
@@ -387,6 +417,93 @@ size_t gp_str_file(
     const char* file_path,
     const char* operation);
 
+// ----------------------------------------------------------------------------
+// String encoding
+
+// Encoders copy @p optional_src encoded to @p dest and decoders copy it decoded
+// to @p dest. If @p optional_src is NULL, @p *dest will be used as input
+// instead. Output is sized exactly beforehand, so @p dest is allocated at most
+// once. Decoders stop at the first invalid character leaving the data decoded
+// so far to @p dest and store its position to
+// @p optional_out_invalid_position, which is GP_NOT_FOUND if input is valid.
+// The position is the length of input if input ends unexpectedly. All return
+// the number of truncated bytes. Encoded output can also be formatted without
+// temporaries using %y, %v, and %q, see printf/printf.h.
+
+#define GP_HEX_UPPERCASE     0x1
+#define GP_BASE64_URL        0x1 // URL and filename safe alphabet "-_"
+#define GP_BASE64_NO_PADDING 0x2
+#define GP_ESCAPE_JSON       'j'
+#define GP_ESCAPE_C          'c'
+
+/** Encode bytes as hexadecimal.
+ * @p flags: GP_HEX_UPPERCASE for upper case digits.
+ */
+GP_NONNULL_ARGS(1)
+size_t gp_str_hex_encode(
+    GPString*              dest,
+    const void*GP_RESTRICT optional_src,
+    size_t                 optional_src_length,
+    int                    flags);
+
+/** Decode hexadecimal to bytes.
+ * Both lower and upper case digits are accepted.
+ */
+GP_NONNULL_ARGS(1)
+size_t gp_str_hex_decode(
+    GPString*              dest,
+    const void*GP_RESTRICT optional_src,
+    size_t                 optional_src_length,
+    size_t*                optional_out_invalid_position);
+
+/** Encode bytes as Base64 as defined in RFC 4648.
+ * @p flags: GP_BASE64_URL for URL and filename safe alphabet,
+ * GP_BASE64_NO_PADDING to omit trailing '='. Combine flags with |.
+ */
+GP_NONNULL_ARGS(1)
+size_t gp_str_base64_encode(
+    GPString*              dest,
+    const void*GP_RESTRICT optional_src,
+    size_t                 optional_src_length,
+    int                    flags);
+
+/** Decode Base64 to bytes.
+ * @p flags: GP_BASE64_URL for URL and filename safe alphabet. Padding is
+ * optional, but if present, it must be correct. Whitespace is not accepted.
+ */
+GP_NONNULL_ARGS(1)
+size_t gp_str_base64_decode(
+    GPString*              dest,
+    const void*GP_RESTRICT optional_src,
+    size_t                 optional_src_length,
+    int                    flags,
+    size_t*                optional_out_invalid_position);
+
+/** Escape string to be put in quotes.
+ * @p mode: GP_ESCAPE_JSON escapes '"', '\\', and control characters as in
+ * JSON, GP_ESCAPE_C escapes '"', '\\', control characters, and DEL as in C
+ * using octal escapes for characters without a shorthand. Bytes above ASCII
+ * are copied as is.
+ */
+GP_NONNULL_ARGS(1)
+size_t gp_str_escape(
+    GPString*              dest,
+    const void*GP_RESTRICT optional_src,
+    size_t                 optional_src_length,
+    int                    mode);
+
+/** Unescape string escaped with gp_str_escape() or by hand.
+ * Accepts all escape sequences of JSON or C depending on @p mode. Unicode
+ * escapes are encoded as UTF-8 and JSON surrogate pairs are combined.
+ */
+GP_NONNULL_ARGS(1)
+size_t gp_str_unescape(
+    GPString*              dest,
+    const void*GP_RESTRICT optional_src,
+    size_t                 optional_src_length,
+    int                    mode,
+    size_t*                optional_out_invalid_position);
+
 // ----------------------------------------------------------------------------
 // String formatting
 
@@ -408,6 +525,27 @@ size_t gp_str_file(
 #define/* size_t */gp_str_println(str_ptr_out, ...) \
     GP_STR_PRINTLN(str_ptr_out, __VA_ARGS__)
 
+// gp_str_print_values() family of macros selects the conversion for each
+// argument at compile time based on its type and calls it at the call site
+// instead of passing arguments through va_list, so conversions can be inlined.
+// Output is exactly pre-sized, so the string is allocated at most once. Format
+// strings are not supported, all strings including string literals are copied
+// as is. Requires C11 or C++, in C++ these are the same as gp_str_print(), which
+// selects conversions at compile time already.
+/*
+    gp_str_print_values(&my_str, "x: ", 1, ", y: ", 2.5); // copies "x: 1, y: 2.5"
+ */
+
+#if GP_HAS_C11_GENERIC || __cplusplus
+/** Copy converted arguments allocating as needed.*/
+#define/* size_t */gp_str_print_values(str_ptr_out, ...) \
+    GP_STR_PRINT_VALUES(str_ptr_out, __VA_ARGS__)
+
+/** Like gp_str_print_values() but add spaces between args and add newline.*/
+#define/* size_t */gp_str_println_values(str_ptr_out, ...) \
+    GP_STR_PRINTLN_VALUES(str_ptr_out, __VA_ARGS__)
+#endif
+
 // ----------------------------------------------------------------------------
 // String examination
 
@@ -498,6 +636,196 @@ bool gp_str_is_valid(
     GPString str,
     size_t*  optional_invalid_position);
 
+// ----------------------------------------------------------------------------
+// String builder
+
+/** @private */
+typedef struct gp_str_segment
+{
+    const char* data;
+    size_t      length;
+} GPStrSegment;
+
+/** String builder.
+ * Collects strings and formatted numbers to a list of segments and keeps track
+ * of the total length, so the result can be written with a single allocation
+ * and a single copy pass instead of reserving on every append. Strings are not
+ * copied, so they must outlive the builder unless appended with
+ * @ref gp_str_builder_append_copy().
+ */
+typedef struct gp_str_builder
+{
+    size_t length; /**< Total length of the built string. */
+
+    GPAllocator*          _allocator;        /**< @private */
+    GPArray(GPStrSegment) _segments;         /**< @private */
+    char*                 _storage;          /**< @private */
+    size_t                _storage_length;   /**< @private */
+    size_t                _storage_capacity; /**< @private */
+} GPStrBuilder;
+
+/** Create string builder.
+ * @p allocator is used for the segment list, copied strings, and formatted
+ * numbers. The scratch arena is a good choice for short lived builders.
+ */
+GP_NONNULL_ARGS() GP_NODISCARD
+GPStrBuilder gp_str_builder(GPAllocator* allocator);
+
+/** Deallocate memory used by the builder.*/
+GP_NONNULL_ARGS()
+void gp_str_builder_delete(GPStrBuilder*);
+
+/** Add string to the end without copying.*/
+GP_NONNULL_ARGS()
+void gp_str_builder_append(
+    GPStrBuilder*,
+    const void* str,
+    size_t      str_length);
+
+/** Add copy of string to the end.*/
+GP_NONNULL_ARGS()
+void gp_str_builder_append_copy(
+    GPStrBuilder*,
+    const void* str,
+    size_t      str_length);
+
+/** Add formatted unsigned integer to the end.*/
+GP_NONNULL_ARGS()
+void gp_str_builder_uint(GPStrBuilder*, unsigned long long);
+
+/** Add formatted signed integer to the end.*/
+GP_NONNULL_ARGS()
+void gp_str_builder_int(GPStrBuilder*, long long);
+
+/** Add formatted floating point number to the end.
+ * Formats like "%g".
+ */
+GP_NONNULL_ARGS()
+void gp_str_builder_double(GPStrBuilder*, double);
+
+/** Copy built string to destination.
+ * Reserves the exact length once and copies all segments. Segments may refer
+ * to @p dest, in which case they are copied to a temporary buffer first.
+ * @return number of bytes truncated if @p dest is truncating.
+ */
+GP_NONNULL_ARGS()
+size_t gp_str_builder_write(
+    GPString*           dest,
+    const GPStrBuilder* builder);
+
+/** Copy built string to buffer.
+ * Writes at most @p capacity bytes. The result is not null-terminated.
+ * @return length of the built string.
+ */
+GP_NONNULL_ARGS()
+size_t gp_str_builder_write_buffer(
+    void*               buffer,
+    size_t              capacity,
+    const GPStrBuilder* builder);
+
+// ----------------------------------------------------------------------------
+// Short strings
+
+/** Maximum length of GPShortString.*/
+#define GP_SHORT_STRING_MAX_LENGTH 15
+
+/** Short string.
+ * Compact value type for strings shorter than 16 bytes without allocations or
+ * GPStringHeader. The last byte of data stores the number of unused bytes,
+ * which is 0 for strings of maximum length, so data is always null-terminated.
+ * Unused bytes are zeroed, so short strings can be compared as 16 byte blocks
+ * and used directly as GPMap keys by passing the address and
+ * sizeof(GPShortString).
+ * Pass data and @ref gp_short_str_length() to compare with gp_str_equal().
+ */
+typedef struct gp_short_string
+{
+    char data[GP_SHORT_STRING_MAX_LENGTH + 1];
+} GPShortString;
+
+/** Create short string.
+ * @p length must not exceed GP_SHORT_STRING_MAX_LENGTH.
+ */
+GP_NONNULL_ARGS() GP_NODISCARD
+static inline GPShortString gp_short_str(
+    const void* str,
+    size_t      length)
+{
+    gp_db_assert(length <= GP_SHORT_STRING_MAX_LENGTH, "String too long.");
+    GPShortString short_str;
+    memset(&short_str, 0, sizeof short_str);
+    memcpy(short_str.data, str, length);
+    short_str.data[GP_SHORT_STRING_MAX_LENGTH] = (char)(GP_SHORT_STRING_MAX_LENGTH - length);
+    return short_str;
+}
+
+GP_NODISCARD
+static inline size_t gp_short_str_length(GPShortString short_str)
+{
+    return GP_SHORT_STRING_MAX_LENGTH - (uint8_t)short_str.data[GP_SHORT_STRING_MAX_LENGTH];
+}
+
+/** Compare short strings in O(1) time.*/
+GP_NODISCARD
+static inline bool gp_short_str_equal(GPShortString s1, GPShortString s2)
+{
+    return memcmp(&s1, &s2, sizeof s1) == 0;
+}
+
+// ----------------------------------------------------------------------------
+// String interning
+
+/** Interning table.
+ * Deduplicates strings to an arena owned by the table. Each distinct string
+ * gets a 32-bit id, which stays valid until the table is deleted, so equality
+ * of interned strings is just comparison of ids or string pointers.
+ */
+typedef struct gp_intern_table* GPInternTable;
+
+/** Create interning table.*/
+GP_NONNULL_ARGS_AND_RETURN GP_NODISCARD
+GPInternTable gp_intern_table_new(GPAllocator*);
+
+/** Deallocate interning table and all of it's strings.*/
+void gp_intern_table_delete(GPInternTable optional);
+
+/** Intern string.
+ * Copies @p str to the table if not already there.
+ * @return id of the interned string.
+ */
+GP_NONNULL_ARGS()
+uint32_t gp_intern(
+    GPInternTable,
+    const void* str,
+    size_t      length);
+
+/** Find interned string without interning.
+ * @return id of the interned string or UINT32_MAX if not found.
+ */
+GP_NONNULL_ARGS() GP_NODISCARD
+uint32_t gp_intern_find(
+    GPInternTable,
+    const void* str,
+    size_t      length);
+
+/** Get interned string.
+ * The returned string has a stable address and works with all non-mutating
+ * string functions. Interned strings must not be modified.
+ */
+GP_NONNULL_ARGS_AND_RETURN GP_NODISCARD
+GPString gp_interned_str(
+    GPInternTable,
+    uint32_t id);
+
+/** Get cached hash of interned string.
+ * The hash is computed with gp_bytes_hash(), so it can be passed to GPMap
+ * functions instead of the string to avoid rehashing.
+ */
+GP_NONNULL_ARGS() GP_NODISCARD
+uint64_t gp_interned_hash(
+    GPInternTable,
+    uint32_t id);
+
 // More string functions in unicode.h
 
 
@@ -522,6 +850,114 @@ size_t gp_internal_str_println(
     const GPInternalReflectionData* objs,
     ...);
 
+// Argument of gp_str_print_values() family converted at the call site. Numbers
+// are written to buffer, strings are referred to by data.
+typedef struct gp_internal_formatted
+{
+    const char* data; // NULL if converted to buffer
+    size_t      length;
+    char        buffer[40]; // fits GPInt128 with sign
+} GPInternalFormatted;
+
+size_t gp_internal_str_print_formatted(
+    GPString* out,
+    size_t arg_count,
+    const GPInternalFormatted* objs);
+
+size_t gp_internal_str_println_formatted(
+    GPString* out,
+    size_t arg_count,
+    const GPInternalFormatted* objs);
+
+static inline GPInternalFormatted gp_internal_format_char(const char c)
+{
+    GPInternalFormatted formatted = { NULL, 1, {c} };
+    return formatted;
+}
+
+static inline GPInternalFormatted gp_internal_format_bool(const bool b)
+{
+    GPInternalFormatted formatted = { b ? "true" : "false", b ? 4u : 5u, {0} };
+    return formatted;
+}
+
+static inline GPInternalFormatted gp_internal_format_signed(const long long x)
+{
+    GPInternalFormatted formatted = { NULL, 0, {0} };
+    formatted.length = pf_itoa(sizeof formatted.buffer, formatted.buffer, x);
+    return formatted;
+}
+
+static inline GPInternalFormatted gp_internal_format_unsigned(const unsigned long long x)
+{
+    GPInternalFormatted formatted = { NULL, 0, {0} };
+    formatted.length = pf_utoa(sizeof formatted.buffer, formatted.buffer, x);
+    return formatted;
+}
+
+static inline GPInternalFormatted gp_internal_format_int128(const GPInt128 x)
+{
+    GPInternalFormatted formatted = { NULL, 0, {0} };
+    formatted.length = pf_i128toa(sizeof formatted.buffer, formatted.buffer, x);
+    return formatted;
+}
+
+static inline GPInternalFormatted gp_internal_format_uint128(const GPUInt128 x)
+{
+    GPInternalFormatted formatted = { NULL, 0, {0} };
+    formatted.length = pf_u128toa(sizeof formatted.buffer, formatted.buffer, x);
+    return formatted;
+}
+
+// Floating point types are formatted in shortest round trip form like gp_print().
+
+static inline GPInternalFormatted gp_internal_format_float(const float x)
+{
+    GPInternalFormatted formatted = { NULL, 0, {0} };
+    formatted.length = pf_hrtoa(sizeof formatted.buffer, formatted.buffer, x);
+    return formatted;
+}
+
+static inline GPInternalFormatted gp_internal_format_double(const double x)
+{
+    GPInternalFormatted formatted = { NULL, 0, {0} };
+    formatted.length = pf_rtoa(sizeof formatted.buffer, formatted.buffer, x);
+    return formatted;
+}
+
+#if GP_HAS_LONG_DOUBLE
+static inline GPInternalFormatted gp_internal_format_long_double(const long double x)
+{
+    GPInternalFormatted formatted = { NULL, 0, {0} };
+    formatted.length = pf_Lrtoa(sizeof formatted.buffer, formatted.buffer, x);
+    return formatted;
+}
+#endif
+
+static inline GPInternalFormatted gp_internal_format_cstr(const char* s)
+{
+    GPInternalFormatted formatted = { s, strlen(s), {0} };
+    return formatted;
+}
+
+static inline GPInternalFormatted gp_internal_format_str(const GPString s)
+{
+    GPInternalFormatted formatted = { (const char*)s, gp_str_length(s), {0} };
+    return formatted;
+}
+
+static inline GPInternalFormatted gp_internal_format_ptr(const void* p)
+{
+    if (p == NULL) {
+        GPInternalFormatted formatted = { "(nil)", sizeof"(nil)"-sizeof"", {0} };
+        return formatted;
+    }
+    GPInternalFormatted formatted = { NULL, 2, {'0', 'x'} };
+    formatted.length += pf_xtoa(
+        sizeof formatted.buffer - 2, formatted.buffer + 2, (uintptr_t)p);
+    return formatted;
+}
+
 #ifndef __cplusplus
 
 #define GP_STR_PRINT(OUT, ...) \
@@ -540,6 +976,45 @@ size_t gp_internal_str_println(
             { {0}, GP_PROCESS_ALL_ARGS(GP_PRINTABLE, GP_COMMA, __VA_ARGS__) } + 1, \
         __VA_ARGS__)
 
+#if GP_HAS_C11_GENERIC
+#define GP_FORMATTED(X) _Generic(X,                                   \
+    bool:                  gp_internal_format_bool,                   \
+    short:                 gp_internal_format_signed,                 \
+    int:                   gp_internal_format_signed,                 \
+    long:                  gp_internal_format_signed,                 \
+    long long:             gp_internal_format_signed,                 \
+    GP_INT128_SELECTION(gp_internal_format_int128,)                   \
+    unsigned short:        gp_internal_format_unsigned,               \
+    unsigned int:          gp_internal_format_unsigned,               \
+    unsigned long:         gp_internal_format_unsigned,               \
+    unsigned long long:    gp_internal_format_unsigned,               \
+    GP_UINT128_SELECTION(gp_internal_format_uint128,)                 \
+    float:                 gp_internal_format_float,                  \
+    double:                gp_internal_format_double,                 \
+    GP_LONG_DOUBLE_SELECTION(gp_internal_format_long_double,)         \
+    GP_CHAR_SELECTION(gp_internal_format_char,)                       \
+    unsigned char:         gp_internal_format_char,                   \
+    signed char:           gp_internal_format_char,                   \
+    char*:                 gp_internal_format_cstr,                   \
+    const char*:           gp_internal_format_cstr,                   \
+    struct gp_char*:       gp_internal_format_str,                    \
+    default:               gp_internal_format_ptr)(X)
+
+#define GP_STR_PRINT_VALUES(OUT, ...) \
+    gp_internal_str_print_formatted( \
+        OUT, \
+        GP_COUNT_ARGS(__VA_ARGS__), \
+        (GPInternalFormatted[]) \
+            { GP_PROCESS_ALL_ARGS(GP_FORMATTED, GP_COMMA, __VA_ARGS__) })
+
+#define GP_STR_PRINTLN_VALUES(OUT, ...) \
+    gp_internal_str_println_formatted( \
+        OUT, \
+        GP_COUNT_ARGS(__VA_ARGS__), \
+        (GPInternalFormatted[]) \
+            { GP_PROCESS_ALL_ARGS(GP_FORMATTED, GP_COMMA, __VA_ARGS__) })
+#endif // GP_HAS_C11_GENERIC
+
 // Portably issue warning. Also gives better error message than strcpy().
 #define GP_STR_CHECK_INIT_SIZE(DATA_BUF, ...) \
     (char*){0} = (char[sizeof DATA_BUF]){""__VA_ARGS__}
@@ -577,6 +1052,10 @@ static inline size_t gp_internal_str_copy_cppstr(GPString* out, const size_t n,
         GP_PROCESS_ALL_ARGS(GP_EVAL, GP_STREAM_INSERT_SPACE, __VA_ARGS__) << "\n" \
     ).str())
 
+// Stream insertion already dispatches on types at compile time.
+#define GP_STR_PRINT_VALUES(OUT, ...)   GP_STR_PRINT(OUT, __VA_ARGS__)
+#define GP_STR_PRINTLN_VALUES(OUT, ...) GP_STR_PRINTLN(OUT, __VA_ARGS__)
+
 #endif // __cplusplus
 
 #endif // GP_STRING_INCLUDED
@@ -11,6 +11,7 @@
 
 #include <gpc/string.h>
 #include <gpc/array.h>
+#include <stdio.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,26 @@ extern "C" {
 GP_NONNULL_ARGS()
 const char* gp_set_utf8_global_locale(int category, const char* locale_code);
 
+/** Resolved locale.
+ * Handle to a locale created by gp_locale_handle(). Handles stay valid for the
+ * lifetime of the program and can be shared between threads. NULL handle means
+ * global locale.
+ */
+typedef const struct gp_locale_info* GPLocaleHandle;
+
+/** Resolve locale once.
+ * Creates or fetches a UTF-8 locale for @p locale_code, which should be in form
+ * "xx_YY", or "xxx_YY", or an empty string for default locale. Passing the
+ * returned handle to the _l variants of language sensitive functions avoids
+ * looking up the locale by code on every call. Repeated calls with the same
+ * code in the same thread are served from a per-thread cache. If the locale is
+ * not available in the system, collation uses global locale, but case mappings
+ * still respect the language of @p locale_code.
+ * @return handle to locale or NULL if @p optional_locale_code is NULL.
+ */
+GP_NODISCARD
+GPLocaleHandle gp_locale_handle(const char* optional_locale_code);
+
 /** Codepoint size in bytes.
  * Only reads one byte at the specified index. No bounds checks performed, which
  * is why this function is not suitable for iterating over codepoints in string.
@@ -203,9 +224,79 @@ static inline bool gp_utf32_is_valid(
     return true;
 }
 
+// ----------------------------------------------------------------------------
+// Codepoint indexing
+
+/** Codepoint index.
+ * Sparse index of byte indices of every n:th codepoint of a string or a view,
+ * which turns finding codepoints into a lookup and a short scan. The index
+ * refers to the indexed memory, which must not be modified or freed while the
+ * index is in use. Create a new index after modifying a string. Codepoints are
+ * counted like in @ref gp_str_codepoint_count(). For strings that are edited
+ * constantly, consider GPRope instead.
+ */
+typedef struct gp_utf8_index* GPUtf8Index;
+
+/** Create codepoint index.
+ * Stores byte index of every @p stride:th codepoint. Lookups scan at most
+ * @p stride codepoints, memory use is a size_t per @p stride codepoints.
+ * @p stride 0 uses a default of 64.
+ */
+GP_NONNULL_ARGS() GP_NONNULL_RETURN GP_NODISCARD
+GPUtf8Index gp_utf8_index_new(
+    GPAllocator* allocator,
+    const void*  utf8,
+    size_t       utf8_length,
+    size_t       stride);
+
+/** Deallocate codepoint index.*/
+void gp_utf8_index_delete(GPUtf8Index optional);
+
+/** Length in codepoints.*/
+GP_NONNULL_ARGS() GP_NODISCARD
+size_t gp_utf8_index_codepoint_count(GPUtf8Index);
+
+/** Find codepoint.
+ * @return byte index of the codepoint at @p codepoint_index or the length of
+ * indexed string if @p codepoint_index is the codepoint count.
+ */
+GP_NONNULL_ARGS() GP_NODISCARD
+size_t gp_utf8_index_byte_index(
+    GPUtf8Index,
+    size_t codepoint_index);
+
+/** Find codepoint containing byte.
+ * @return index of the codepoint that contains the byte at @p byte_index or the
+ * codepoint count if @p byte_index is the length of indexed string.
+ */
+GP_NONNULL_ARGS() GP_NODISCARD
+size_t gp_utf8_index_codepoint_index(
+    GPUtf8Index,
+    size_t byte_index);
+
 // ----------------------------------------------------------------------------
 // Full string encoding conversions
 
+// Conversions validate and transcode in a single pass over valid input using
+// SIMD where available. Invalid sequences are preserved like in
+// gp_utf8_decode() and gp_utf8_encode() so they survive a round trip.
+
+/** Exact number of UTF-32 codepoints in valid UTF-8.*/
+GP_NONNULL_ARGS() GP_NODISCARD
+size_t gp_utf32_length_from_utf8(const void* utf8, size_t utf8_length);
+
+/** Exact number of UTF-16 code units in valid UTF-8.*/
+GP_NONNULL_ARGS() GP_NODISCARD
+size_t gp_utf16_length_from_utf8(const void* utf8, size_t utf8_length);
+
+/** Exact number of UTF-8 bytes encoding valid UTF-32.*/
+GP_NONNULL_ARGS() GP_NODISCARD
+size_t gp_utf8_length_from_utf32(const uint32_t* utf32, size_t utf32_length);
+
+/** Exact number of UTF-8 bytes encoding valid UTF-16.*/
+GP_NONNULL_ARGS() GP_NODISCARD
+size_t gp_utf8_length_from_utf16(const uint16_t* utf16, size_t utf16_length);
+
 GP_NONNULL_ARGS()
 size_t gp_utf32_from_utf8(
     GPArray(uint32_t)* out_utf32,
@@ -248,6 +339,102 @@ size_t gp_utf8_from_wcs(
     const wchar_t*  unicode_wide_string,
     size_t          unicode_wide_string_length);
 
+/** Exact number of wide characters in valid UTF-8.*/
+GP_NONNULL_ARGS() GP_NODISCARD
+size_t gp_wcs_length_from_utf8(const void* utf8, size_t utf8_length);
+
+/** Exact number of UTF-8 bytes encoding valid wide string.*/
+GP_NONNULL_ARGS() GP_NODISCARD
+size_t gp_utf8_length_from_wcs(const wchar_t* wcs, size_t wcs_length);
+
+/** Convert UTF-8 to wide string in preallocated memory.
+ * Like @ref gp_wcs_from_utf8(), but writes to a raw buffer without any bounds
+ * checks. @p out must have room for @ref gp_wcs_length_from_utf8() + 1 wide
+ * characters if @p utf8 is valid. Invalid UTF-8 may take up to
+ * @p utf8_length + 1 wide characters, or 2 * @p utf8_length + 1 where wchar_t
+ * is 16 bits.
+ * @return length of the null-terminated wide string written to @p out.
+ */
+GP_NONNULL_ARGS()
+size_t gp_wcs_from_utf8_unsafe(
+    wchar_t*    out,
+    const void* utf8,
+    size_t      utf8_length);
+
+/** Convert wide string to UTF-8 in preallocated memory.
+ * Like @ref gp_utf8_from_wcs(), but writes to a raw buffer without any bounds
+ * checks. @p out must have room for @ref gp_utf8_length_from_wcs() bytes if
+ * @p wcs is valid, or 4 * @p wcs_length bytes otherwise. Output is not
+ * null-terminated.
+ * @return number of bytes written to @p out.
+ */
+GP_NONNULL_ARGS()
+size_t gp_utf8_from_wcs_unsafe(
+    void*          out,
+    const wchar_t* wcs,
+    size_t         wcs_length);
+
+// ----------------------------------------------------------------------------
+// Normalization
+
+typedef enum gp_normal_form
+{
+    GP_NFC,  // canonical decomposition followed by canonical composition
+    GP_NFD,  // canonical decomposition
+    GP_NFKC, // compatibility decomposition followed by canonical composition
+    GP_NFKD, // compatibility decomposition
+} GPNormalForm;
+
+typedef enum gp_normalization_check
+{
+    GP_NORMALIZED_NO,
+    GP_NORMALIZED_YES,
+    GP_NORMALIZED_MAYBE,
+} GPNormalizationCheck;
+
+/** Quick check if text is normalized.
+ * Runs in linear time without allocating. Bytes that can only start normalized
+ * codepoints are skipped in bulk, so common text is checked at memory speed.
+ * Invalid UTF-8 sequences are considered normalized. @return
+ * GP_NORMALIZED_MAYBE if @p utf8 can only be determined to be normalized by
+ * normalizing it, which is only possible with composing forms.
+ */
+GP_NONNULL_ARGS() GP_NODISCARD
+GPNormalizationCheck gp_utf8_normalization_quick_check(
+    const void*  utf8,
+    size_t       utf8_length,
+    GPNormalForm form);
+
+/** Check if text is normalized.
+ * Like gp_utf8_normalization_quick_check(), but resolves GP_NORMALIZED_MAYBE
+ * by normalizing in scratch arena.
+ */
+GP_NONNULL_ARGS() GP_NODISCARD
+bool gp_utf8_is_normalized(
+    const void*  utf8,
+    size_t       utf8_length,
+    GPNormalForm form);
+
+/** Normalize text.
+ * Stores normalized @p utf8 to @p out. Only the part of @p utf8 starting from
+ * the last starter before the first codepoint that fails the quick check is
+ * actually processed, the rest is copied. Invalid UTF-8 sequences are
+ * preserved. @return number of bytes truncated if @p out is truncating.
+ */
+GP_NONNULL_ARGS()
+size_t gp_utf8_normalize(
+    GPString*    out,
+    const void*  utf8,
+    size_t       utf8_length,
+    GPNormalForm form);
+
+/** Normalize string in place.
+ * Does nothing if @p str passes the quick check, so already normalized strings
+ * are not copied.
+ */
+GP_NONNULL_ARGS()
+void gp_str_normalize(GPString* str, GPNormalForm form);
+
 // ----------------------------------------------------------------------------
 // Strings
 
@@ -259,6 +446,14 @@ void gp_str_to_upper_full(
     GPString*,
     const char* optional_locale_code);
 
+/** Full language sensitive Unicode case mapping using locale handle.
+ * Uses global locale if @p locale is NULL.
+ */
+GP_NONNULL_ARGS(1)
+void gp_str_to_upper_full_l(
+    GPString*,
+    GPLocaleHandle optional_locale);
+
 /** Full language sensitive Unicode case mapping.
  * Uses global locale if @p locale_code is NULL.
  */
@@ -267,6 +462,14 @@ void gp_str_to_lower_full(
     GPString*,
     const char* optional_locale_code);
 
+/** Full language sensitive Unicode case mapping using locale handle.
+ * Uses global locale if @p locale is NULL.
+ */
+GP_NONNULL_ARGS(1)
+void gp_str_to_lower_full_l(
+    GPString*,
+    GPLocaleHandle optional_locale);
+
 /** Capitalizes first character.
  * Capitalizes according to full language sensitive Unicode titlecase mapping.
  * Uses global locale if @p locale_code is NULL.
@@ -276,6 +479,14 @@ void gp_str_capitalize(
     GPString*,
     const char* optional_locale_code);
 
+/** Capitalizes first character using locale handle.
+ * Uses global locale if @p locale is NULL.
+ */
+GP_NONNULL_ARGS(1)
+void gp_str_capitalize_l(
+    GPString*,
+    GPLocaleHandle optional_locale);
+
 #define GP_CASE_FOLD 'f'
 #define GP_COLLATE   'c'
 #define GP_REVERSE   'r'
@@ -295,6 +506,44 @@ int gp_str_compare(
     int            flags,
     const char*    optional_locale_code);
 
+/** Advanced string comparison using locale handle.
+ * Like gp_str_compare(), but uses global locale if @p locale is NULL.
+ */
+GP_NONNULL_ARGS(1, 2) GP_NODISCARD
+int gp_str_compare_l(
+    const GPString s1,
+    const void*    s2,
+    size_t         s2_length,
+    int            flags,
+    GPLocaleHandle optional_locale);
+
+/** Create sort key.
+ * Stores a key to @p out such that comparing keys of two strings with memcmp()
+ * and then by length gives the same order as gp_str_compare() with the same
+ * @p flags and locale. GP_REVERSE is ignored. Transforming is expensive, but it
+ * is only done once per string, which makes comparing keys much faster than
+ * comparing strings when they are compared multiple times like in sorting.
+ * @return number of bytes truncated if @p out is truncating.
+ */
+GP_NONNULL_ARGS(1, 2)
+size_t gp_str_sort_key(
+    GPString*   out,
+    const void* str,
+    size_t      str_length,
+    int         flags,
+    const char* optional_locale_code);
+
+/** Create sort key using locale handle.
+ * Like gp_str_sort_key(), but uses global locale if @p locale is NULL.
+ */
+GP_NONNULL_ARGS(1, 2)
+size_t gp_str_sort_key_l(
+    GPString*      out,
+    const void*    str,
+    size_t         str_length,
+    int            flags,
+    GPLocaleHandle optional_locale);
+
 /** Create array of substrings.*/
 GP_NONNULL_ARGS() GP_NODISCARD
 GPArray(GPString) gp_str_split(
@@ -310,6 +559,237 @@ void gp_str_join(
     GPArray(GPString) srcs,
     const char*       separator);
 
+// ----------------------------------------------------------------------------
+// Split Iterator
+
+/** Treat separator as a single, possibly multi-byte, delimiter string.*/
+#define GP_SPLIT_STRING 's'
+
+/** Lazy tokenizer.
+ * Yields one token at a time from a buffer or a stream without allocating.
+ * Create with @ref gp_str_split_iterator() or @ref gp_file_split_iterator()
+ * and advance with @ref gp_str_split_next().
+ */
+typedef struct gp_str_split_iterator
+{
+    /** Current token.
+     * Not null-terminated. Points to the input string or to the stream
+     * buffer. Stream tokens are only valid until the next call to
+     * @ref gp_str_split_next().
+     */
+    const char* token;
+    size_t      token_length;
+
+    /** Token did not fit in the stream buffer.
+     * The rest of the token will be yielded by subsequent calls, the last of
+     * which is not partial. Partial tokens split by a string separator may end
+     * in the middle of a codepoint.
+     */
+    bool        partial;
+
+    /** @private */
+    char*       data;
+    size_t      start;
+    size_t      length;
+    size_t      capacity;
+    FILE*       stream;
+    const char* separator;
+    size_t      separator_length;
+    size_t      max_splits;
+    size_t      splits;
+    uint64_t    ascii_set[2];
+    bool        separator_is_string;
+    bool        eof;
+    bool        finished;
+} GPStrSplitIterator;
+
+/** Create split iterator over a buffer.
+ * By default, @p separator is a UTF-8 character set like in
+ * @ref gp_str_split() and consecutive separators are skipped, so empty tokens
+ * are never yielded. If @p flags is GP_SPLIT_STRING, @p separator is matched as
+ * a whole and empty tokens between adjacent separators are yielded. After
+ * @p max_splits splits, the rest of the input is yielded as the last token.
+ * Pass 0 to @p max_splits for unlimited splits. @p str and @p separator must
+ * outlive the iterator.
+ */
+GP_NONNULL_ARGS() GP_NODISCARD
+GPStrSplitIterator gp_str_split_iterator(
+    const void* str,
+    size_t      str_length,
+    const char* separator,
+    int         flags,
+    size_t      max_splits);
+
+/** Create split iterator over a stream.
+ * Like @ref gp_str_split_iterator(), but reads @p stream in chunks to
+ * @p buffer so arbitrarily large inputs can be processed in constant memory.
+ * Tokens longer than the buffer are yielded in parts, see
+ * GPStrSplitIterator.partial. @p buffer_capacity must be at least 4 and larger
+ * than the separator length.
+ */
+GP_NONNULL_ARGS() GP_NODISCARD
+GPStrSplitIterator gp_file_split_iterator(
+    FILE*       stream,
+    void*       buffer,
+    size_t      buffer_capacity,
+    const char* separator,
+    int         flags,
+    size_t      max_splits);
+
+/** Advance split iterator.
+ * @return true if a token was stored in @p it, false if there are no more
+ * tokens.
+ */
+GP_NONNULL_ARGS()
+bool gp_str_split_next(GPStrSplitIterator* it);
+
+/** Text segment iterator.
+ * Iterates over extended grapheme clusters or words as defined by UAX #29, or
+ * over line break opportunities as defined by UAX #14, using default rules
+ * without tailoring. Create one with @ref gp_grapheme_iterator(),
+ * @ref gp_word_iterator(), or @ref gp_line_break_iterator() and advance it with
+ * @ref gp_segment_next(). Iterators do not allocate. Invalid UTF-8 sequences
+ * are treated like unassigned codepoints.
+ */
+typedef struct gp_segment_iterator
+{
+    /** Current segment.
+     * Not null-terminated. Points to the input string.
+     */
+    const char* segment;
+    size_t      segment_length;
+
+    /** Line break after segment is mandatory.
+     * Only set by line break iterators if the segment ends with a hard line
+     * break or the end of input. Otherwise the line may be broken after the
+     * segment, but doesn't have to be.
+     */
+    bool        mandatory;
+
+    /** @private */
+    const char* str;
+    size_t      length;
+    size_t      position;
+    int         type;
+} GPSegmentIterator;
+
+/** Create grapheme cluster iterator.
+ * Segments are user perceived characters like "e\u0301" or emoji sequences.
+ * @p str must outlive the iterator.
+ */
+GP_NONNULL_ARGS() GP_NODISCARD
+GPSegmentIterator gp_grapheme_iterator(const void* str, size_t str_length);
+
+/** Create word iterator.
+ * Segments are words, numbers, and everything between them, so concatenating
+ * all segments gives the input string back. For example, "It's 3.14!" is split
+ * to "It's", " ", "3.14", and "!". @p str must outlive the iterator.
+ */
+GP_NONNULL_ARGS() GP_NODISCARD
+GPSegmentIterator gp_word_iterator(const void* str, size_t str_length);
+
+/** Create line break iterator.
+ * Segments end where lines can be broken. Trailing spaces are included in the
+ * segment before the break. @p str must outlive the iterator.
+ */
+GP_NONNULL_ARGS() GP_NODISCARD
+GPSegmentIterator gp_line_break_iterator(const void* str, size_t str_length);
+
+/** Advance segment iterator.
+ * @return true if a segment was stored in @p it, false if there are no more
+ * segments.
+ */
+GP_NONNULL_ARGS()
+bool gp_segment_next(GPSegmentIterator* it);
+
+/** Full case folding iterator.
+ * Folds one codepoint at a time according to Unicode full case folding, so
+ * strings can be compared and hashed case insensitively without allocating
+ * folded copies. Turkish and Azeri locales fold I to dotless i and İ to i.
+ * Create one with @ref gp_fold_iterator() and advance it with
+ * @ref gp_fold_next(). Invalid UTF-8 sequences are passed through like in
+ * gp_utf8_decode().
+ */
+typedef struct gp_fold_iterator
+{
+    uint32_t codepoint; /**< Current folded codepoint. */
+
+    /** @private */
+    const uint8_t* str;
+    size_t         length;
+    size_t         position;
+    uint32_t       pending[2];
+    uint8_t        pending_length;
+    bool           turkish;
+} GPFoldIterator;
+
+/** Create full case folding iterator.
+ * Uses global locale if @p locale is NULL. @p str must outlive the iterator.
+ */
+GP_NONNULL_ARGS(1) GP_NODISCARD
+GPFoldIterator gp_fold_iterator(
+    const void*    str,
+    size_t         str_length,
+    GPLocaleHandle optional_locale);
+
+/** Advance full case folding iterator.
+ * @return true if a folded codepoint was stored in @p it, false if there are
+ * no more codepoints.
+ */
+GP_NONNULL_ARGS()
+bool gp_fold_next(GPFoldIterator* it);
+
+/** Case insensitive comparison.
+ * Compares fully case folded codepoints lexicographically, which gives the
+ * same order as gp_str_compare() with GP_CASE_FOLD. Does not allocate and stops
+ * at the first difference. Uses global locale if @p locale is NULL.
+ * @return negative if @p s1 is less than @p s2, positive if greater, and 0 if
+ * equal.
+ */
+GP_NONNULL_ARGS(1, 3) GP_NODISCARD
+int gp_utf8_compare_fold(
+    const void*    s1,
+    size_t         s1_length,
+    const void*    s2,
+    size_t         s2_length,
+    GPLocaleHandle optional_locale);
+
+/** Case insensitive equality.
+ * Like gp_str_equal_case(), but uses full case folding, so "Straße" equals
+ * "STRASSE". Uses global locale if @p locale is NULL.
+ */
+GP_NONNULL_ARGS(1, 3) GP_NODISCARD
+bool gp_utf8_equal_fold(
+    const void*    s1,
+    size_t         s1_length,
+    const void*    s2,
+    size_t         s2_length,
+    GPLocaleHandle optional_locale);
+
+/** Case insensitive prefix test.
+ * @return true if fully case folded @p str starts with fully case folded
+ * @p prefix. Uses global locale if @p locale is NULL.
+ */
+GP_NONNULL_ARGS(1, 3) GP_NODISCARD
+bool gp_utf8_starts_with_fold(
+    const void*    str,
+    size_t         str_length,
+    const void*    prefix,
+    size_t         prefix_length,
+    GPLocaleHandle optional_locale);
+
+/** Case insensitive hash.
+ * Same as gp_bytes_hash() of fully case folded @p str, so strings that are
+ * equal according to gp_utf8_equal_fold() have equal hashes. Pass it with a
+ * NULL key to GPMap functions to use case insensitive keys. Uses global locale
+ * if @p locale is NULL.
+ */
+GP_NONNULL_ARGS(1) GP_NODISCARD
+uint64_t gp_utf8_hash_fold(
+    const void*    str,
+    size_t         str_length,
+    GPLocaleHandle optional_locale);
+
 /** Advanced string sorting.
  * Flags: 'f' or GP_CASE_FOLD for full language sensitive but case insensitive
  * sorting. 'c' or GP_COLLATE for collation. 'r' or GP_REVERSE to reverse the
@@ -323,6 +803,15 @@ void gp_str_sort(
     int                flags,
     const char*        optional_locale_code);
 
+/** Advanced string sorting using locale handle.
+ * Like gp_str_sort(), but uses global locale if @p locale is NULL.
+ */
+GP_NONNULL_ARGS(1)
+void gp_str_sort_l(
+    GPArray(GPString)* strs,
+    int                flags,
+    GPLocaleHandle     optional_locale);
+
 
 // ----------------------------------------------------------------------------
 //
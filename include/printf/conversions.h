@@ -31,6 +31,43 @@ size_t pf_x128toa(size_t n, char* buf, GPUInt128 x);
 size_t pf_X128toa(size_t n, char* buf, GPUInt128 x);
 size_t pf_i128toa(size_t n, char* buf, GPInt128  x);
 
+// Shortest representation that converts back to the same value, e.g. 0.1
+// instead of 0.10000000000000001 that "%.17g" would give. Formatted like %g
+// without trailing zeros: exponential notation is used if decimal exponent is
+// less than -4 or not less than the maximum number of significant digits, which
+// is 9 for float, 17 for double, and 21 for x87 extended precision long double.
+// Returns number of characters written excluding null-terminator. Does not
+// write more than n characters.
+size_t pf_hrtoa(size_t n, char* buf, float x);
+size_t pf_rtoa(size_t n, char* buf, double x);
+#if GP_HAS_LONG_DOUBLE
+size_t pf_Lrtoa(size_t n, char* buf, long double x);
+#endif
+
+// Convert arr_length integers separated by delimiter, e.g. a row of CSV. Use
+// gp_arr_length() as arr_length to convert GPArray(int64_t) or
+// GPArray(uint64_t). Returns number of characters written excluding
+// null-terminator. Does not write more than n characters.
+size_t pf_itoa_array(
+    size_t n, char* buf, const int64_t* arr, size_t arr_length, const char* delimiter);
+size_t pf_utoa_array(
+    size_t n, char* buf, const uint64_t* arr, size_t arr_length, const char* delimiter);
+
+// Parse decimal number from the first n characters of str to *out. Leading
+// whitespace is not skipped and the number doesn't need to end at n. Unlike
+// strtod() and strtoll(), these are not affected by locale. Floats also accept
+// "inf", "infinity", and "nan" ignoring case, but not hexadecimal. Returns
+// number of characters consumed, or 0 if str does not start with a number, in
+// which case *out is not modified. If the number does not fit, *out is clamped
+// to minimum or maximum value, or rounded to infinity or zero for floats, and
+// *optional_out_of_range is set to true if not NULL. Parsed floats are always
+// correctly rounded.
+size_t pf_atod(size_t n, const char* str, double* out, bool* optional_out_of_range);
+size_t pf_atoi(size_t n, const char* str, long long* out, bool* optional_out_of_range);
+size_t pf_atou(size_t n, const char* str, unsigned long long* out, bool* optional_out_of_range);
+size_t pf_atoi128(size_t n, const char* str, GPInt128* out, bool* optional_out_of_range);
+size_t pf_atou128(size_t n, const char* str, GPUInt128* out, bool* optional_out_of_range);
+
 // fmt determines conversion format. Fields that control the conversion:
 // .conversion_format = any of 'f', 'F', 'e', 'E', 'g', or 'G'. REQUIRED
 // .precision = { .option = PF_NONE or PF_SOME, .precision = precision } OPTIONAL
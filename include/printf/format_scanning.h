@@ -50,7 +50,7 @@ typedef struct PFFormatSpecifier
     } flag;
 
     unsigned char length_modifier;   // any of "hljztLwBWDQO" or 2*'h' or 2*'l' or any of "BWDQO"+'f'
-    unsigned char conversion_format; // any of GP_FORMAT_SPECIFIERS. 'n' not supported.
+    unsigned char conversion_format; // any of GP_FORMAT_SPECIFIERS. 'n' not supported. '{' for %{name}.
 } PFFormatSpecifier;
 
 // Portability wrapper.
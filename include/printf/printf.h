@@ -28,6 +28,21 @@
 // ([u]int_fastN_t), where N is 8, 16, 32, or 128, are also supported and
 // recommended over non-standard BWDQO.
 //
+// r conversion specifier for shortest representation that converts back to the
+// same value, formatted like %g but with as many significant digits as needed,
+// e.g. 0.1 instead of 0.10000000000000001 given by %.17g. Precision is ignored.
+// Use with L for long double and h for float, which gives shorter output when
+// the argument was float before promotion to double. The compiler may issue a
+// warning for %r as well.
+//
+// y and Y conversion specifiers for lower and upper case hexadecimal, v for
+// Base64, and q for escaped strings encode bytes pointed by the argument
+// without temporaries. Precision is the number of bytes to encode, which may
+// contain nulls, the argument is a null-terminated string if precision is not
+// given. # flag selects URL and filename safe Base64 without padding for v and
+// C escapes instead of JSON escapes for q. See String encoding in
+// gpc/string.h for details. These are not recognized by compilers either.
+//
 // At the time of writing, C23 wN and wfN length specifiers are not widely
 // supported by compilers. Also casting GPString to wchar_t* can be misleading
 // to the reader, and BWDQO are not recognized by compilers at all. To disable
@@ -41,6 +56,12 @@
 // - "%Qx":    uint64_t hex
 // - "%w128u": GPUInt128
 // - "%w16x":  uint16_t hex
+// - "%r":     double shortest round trip
+// - "%hr":    float shortest round trip
+// - "%.*y":   hex of int length bytes, then pointer to bytes
+// - "%#v":    URL safe Base64 of null-terminated string
+// - "%q":     JSON escaped null-terminated string
+// - "%{uuid}": user defined conversion, see pf_register_conversion()
 //
 // TODO C23 %b binary conversion specifier
 
@@ -80,6 +101,14 @@ GP_NONNULL_ARGS() GP_CHECK_FORMAT_STRING(2, 3)
 size_t pf_fprintf(
     FILE*GP_RESTRICT stream, const char*GP_RESTRICT fmt, ...);
 
+GP_NONNULL_ARGS(2)
+size_t pf_vdprintf(
+    int fd, const char*GP_RESTRICT fmt, va_list args);
+
+GP_NONNULL_ARGS(2) GP_CHECK_FORMAT_STRING(2, 3)
+size_t pf_dprintf(
+    int fd, const char*GP_RESTRICT fmt, ...);
+
 GP_NONNULL_ARGS() GP_CHECK_FORMAT_STRING(2, 3)
 size_t pf_sprintf(char*GP_RESTRICT buf, const char*GP_RESTRICT fmt, ...);
 
@@ -99,6 +128,86 @@ size_t pf_vsnprintf_consuming(
     const char*GP_RESTRICT format,
     struct pf_va_list* args);
 
+// Output of pf_vfprintf(), pf_vdprintf(), and pf_vsinkprintf() is formatted in
+// a single pass to a fixed size buffer, which is passed to write() whenever it
+// fills up and once at the end, so output of any length can be written without
+// formatting twice or allocating. write() may be called with data that is not
+// null-terminated, and multiple times per call to pf_vsinkprintf().
+
+typedef struct pf_sink
+{
+    void (*write)(void* context, const char* data, size_t length);
+    void* context;
+} PFSink;
+
+GP_NONNULL_ARGS(2)
+size_t pf_vsinkprintf(
+    PFSink sink, const char*GP_RESTRICT fmt, va_list args);
+
+GP_NONNULL_ARGS(2) GP_CHECK_FORMAT_STRING(2, 3)
+size_t pf_sinkprintf(
+    PFSink sink, const char*GP_RESTRICT fmt, ...);
+
+// Like pf_vfprintf(), but guaranteed to consume args like
+// pf_vsnprintf_consuming().
+GP_NONNULL_ARGS(1, 2, 3)
+size_t pf_vfprintf_consuming(
+    FILE*GP_RESTRICT stream,
+    const char*GP_RESTRICT fmt,
+    struct pf_va_list* args);
+
+// Precompiled format strings skip scanning the format string, which is useful
+// when the same format string is used repeatedly. pf_compile() splits the
+// format string to literals and parsed format specifiers once and caches the
+// result by address, so subsequent calls with the same format string are cheap
+// lookups. Compiled formats refer to the original format string, which must
+// not be modified or freed, string literals are ideal. Compiled formats are
+// never freed, so format strings should not be generated at runtime.
+
+typedef struct pf_format PFFormat;
+
+GP_NONNULL_ARGS() GP_NONNULL_RETURN GP_NODISCARD
+const PFFormat* pf_compile(const char* format);
+
+GP_NONNULL_ARGS(3)
+size_t pf_vsnprintf_compiled(
+    char*GP_RESTRICT buf, size_t n, const PFFormat*GP_RESTRICT fmt, va_list args);
+
+GP_NONNULL_ARGS(3)
+size_t pf_snprintf_compiled(
+    char*GP_RESTRICT buf, size_t n, const PFFormat*GP_RESTRICT fmt, ...);
+
+// User defined conversions are registered by name and used as %{name}, e.g.
+// "%{uuid}", so domain types can be formatted without temporary strings.
+// Flags, field width, and precision are parsed as usual and passed to the
+// conversion in fmt, field width is also applied to the output. The conversion
+// must consume exactly one argument from args and write to out like
+// pf_snprintf(): at most capacity bytes including the null-terminator, out may
+// be NULL if capacity is 0, and return the length of the full output. out
+// points directly to the output of the calling printf function. If the output
+// does not fit, the conversion may be called again with the same argument.
+// Built-in conversions do not look up registered ones, so they are not slowed
+// down. Formats compiled with pf_compile() look up registered conversions only
+// once. Using unregistered names is asserted in debug builds, release builds
+// consume the argument and write the conversion specifier as is. "%{" without
+// the closing '}' is not a conversion, the rest of the format string is written
+// as is.
+
+typedef size_t (*PFConversion)(
+    char* out, size_t capacity, PFFormatSpecifier fmt, pf_va_list* args);
+
+#define PF_MAX_CONVERSIONS     32
+#define PF_MAX_CONVERSION_NAME 31
+
+/** Register conversion for %{name}.
+ * Names consist of ASCII letters, digits, and underscores. Registering a name
+ * again replaces the conversion.
+ * @return false if @p name is invalid or longer than PF_MAX_CONVERSION_NAME
+ * or if PF_MAX_CONVERSIONS conversions are registered already.
+ */
+GP_NONNULL_ARGS()
+bool pf_register_conversion(const char* name, PFConversion conversion);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
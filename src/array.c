@@ -7,6 +7,7 @@
 
 #include <gpc/array.h>
 #include <gpc/utils.h>
+#include <gpc/thread.h>
 #include <string.h>
 #include <assert.h>
 
@@ -14,6 +15,8 @@
 #undef gp_arr_reallocate
 #undef gp_arr_filter
 #undef gp_arr_push // gp_arr_filter() needs this
+#undef gp_arr_sort
+#undef gp_arr_sort_parallel
 #endif
 
 void gp_arr_reallocate(
@@ -86,3 +89,258 @@ size_t gp_arr_filter(
     }
     return trunced;
 }
+
+// ----------------------------------------------------------------------------
+// Sorting
+
+typedef int(*GPSortCompare)(const void*, const void*);
+
+static void gp_s_sort_swap(size_t size, uint8_t*GP_RESTRICT a, uint8_t*GP_RESTRICT b)
+{
+    uint8_t tmp[64];
+    for (size_t i = 0; i < size; i += sizeof tmp) {
+        const size_t n = gp_min(sizeof tmp, size - i);
+        memcpy(tmp,   a + i, n);
+        memcpy(a + i, b + i, n);
+        memcpy(b + i, tmp,   n);
+    }
+}
+
+static void gp_s_insertion_sort(size_t size, uint8_t* base, size_t length, GPSortCompare compare)
+{
+    for (size_t i = 1; i < length; ++i)
+        for (size_t j = i; j > 0 && compare(base + (j-1)*size, base + j*size) > 0; --j)
+            gp_s_sort_swap(size, base + (j-1)*size, base + j*size);
+}
+
+// Gives up and returns false if sorting requires many moves.
+static bool gp_s_partial_insertion_sort(
+    size_t size, uint8_t* base, size_t length, GPSortCompare compare)
+{
+    size_t moves = 0;
+    for (size_t i = 1; i < length; ++i) {
+        for (size_t j = i; j > 0 && compare(base + (j-1)*size, base + j*size) > 0; --j)
+            gp_s_sort_swap(size, base + (j-1)*size, base + j*size), ++moves;
+        if (moves > 8)
+            return false;
+    }
+    return true;
+}
+
+static void gp_s_sift_down(
+    size_t size, uint8_t* base, size_t root, size_t length, GPSortCompare compare)
+{
+    for (size_t child; (child = 2*root + 1) < length; root = child) {
+        if (child + 1 < length && compare(base + child*size, base + (child + 1)*size) < 0)
+            ++child;
+        if (compare(base + root*size, base + child*size) >= 0)
+            return;
+        gp_s_sort_swap(size, base + root*size, base + child*size);
+    }
+}
+
+static void gp_s_heap_sort(size_t size, uint8_t* base, size_t length, GPSortCompare compare)
+{
+    for (size_t i = length/2; i-- > 0;)
+        gp_s_sift_down(size, base, i, length, compare);
+    for (size_t i = length - 1; i > 0; --i) {
+        gp_s_sort_swap(size, base, base + i*size);
+        gp_s_sift_down(size, base, 0, i, compare);
+    }
+}
+
+static void gp_s_sort3(size_t size, uint8_t* a, uint8_t* b, uint8_t* c, GPSortCompare compare)
+{
+    if (compare(a, b) > 0) gp_s_sort_swap(size, a, b);
+    if (compare(b, c) > 0) gp_s_sort_swap(size, b, c);
+    if (compare(a, b) > 0) gp_s_sort_swap(size, a, b);
+}
+
+static void gp_s_introsort(
+    size_t size, uint8_t* base, size_t length, GPSortCompare compare, size_t depth_limit)
+{
+    while (length > 16)
+    {
+        if (depth_limit-- == 0) {
+            gp_s_heap_sort(size, base, length, compare);
+            return;
+        }
+        // Median of three as pivot moved to first. Last element is not less
+        // than pivot, which stops the left scan, pivot stops the right scan.
+        uint8_t* mid = base + length/2*size;
+        gp_s_sort3(size, base, mid, base + (length - 1)*size, compare);
+        gp_s_sort_swap(size, base, mid);
+
+        // Hoare partition. Stopping at equal elements keeps partitions balanced
+        // when there are many duplicates.
+        size_t i = 1;
+        size_t j = length - 1;
+        bool swapped = false;
+        while (true) {
+            while (compare(base + i*size, base) < 0)
+                ++i;
+            while (compare(base, base + j*size) < 0)
+                --j;
+            if (i >= j)
+                break;
+            gp_s_sort_swap(size, base + i*size, base + j*size);
+            swapped = true;
+            ++i; --j;
+        }
+        if (j != 0)
+            gp_s_sort_swap(size, base, base + j*size);
+
+        uint8_t*     right        = base + (j + 1)*size;
+        const size_t right_length = length - j - 1;
+        if ( ! swapped && // likely already sorted
+            gp_s_partial_insertion_sort(size, base, j, compare) &&
+            gp_s_partial_insertion_sort(size, right, right_length, compare))
+            return;
+
+        // Recurse to smaller partition to limit stack usage.
+        if (j < right_length) {
+            gp_s_introsort(size, base, j, compare, depth_limit);
+            base   = right;
+            length = right_length;
+        } else {
+            gp_s_introsort(size, right, right_length, compare, depth_limit);
+            length = j;
+        }
+    }
+    gp_s_insertion_sort(size, base, length, compare);
+}
+
+static void gp_s_sort(size_t size, void* base, size_t length, GPSortCompare compare)
+{
+    size_t depth_limit = 0;
+    for (size_t n = length; n > 1; n /= 2)
+        depth_limit += 2;
+    gp_s_introsort(size, base, length, compare, depth_limit);
+}
+
+void gp_arr_sort(
+    size_t                 element_size,
+    GPArrayAny             arr,
+    gp_arr_sort_callback_t compare)
+{
+    GPSortCompare func;
+    memcpy(&func, &compare, sizeof func);
+    gp_s_sort(element_size, arr, gp_arr_length(arr), func);
+}
+
+typedef struct gp_sort_task
+{
+    size_t         size;
+    GPSortCompare  compare;
+    const uint8_t* src;
+    uint8_t*       dest;
+    size_t         start;
+    size_t         middle;
+    size_t         end;
+} GPSortTask;
+
+static int gp_s_sort_task(void* _task)
+{
+    GPSortTask* task = _task;
+    gp_s_sort(task->size, task->dest + task->start*task->size, task->end - task->start, task->compare);
+    return 0;
+}
+
+// Stable merge of src[start, middle) and src[middle, end) to dest[start, end).
+static int gp_s_merge_task(void* _task)
+{
+    const GPSortTask* task = _task;
+    const size_t size = task->size;
+    size_t i = task->start;
+    size_t j = task->middle;
+    size_t k = task->start;
+    while (i < task->middle && j < task->end) {
+        if (task->compare(task->src + j*size, task->src + i*size) < 0)
+            memcpy(task->dest + k++*size, task->src + j++*size, size);
+        else
+            memcpy(task->dest + k++*size, task->src + i++*size, size);
+    }
+    memcpy(task->dest + k*size, task->src + i*size, (task->middle - i)*size);
+    k += task->middle - i;
+    memcpy(task->dest + k*size, task->src + j*size, (task->end - j)*size);
+    return 0;
+}
+
+static bool gp_s_thread_create(GPThread* thread, int(*f)(void*), void* arg)
+{
+    #if GP_USE_C11_THREADS
+    return gp_thread_create(thread, f, arg) == thrd_success;
+    #else
+    return gp_thread_create(thread, f, arg) == 0;
+    #endif
+}
+
+// Runs task[0] in calling thread. Tasks are independent, so tasks that could
+// not get a thread are also run in calling thread.
+static void gp_s_run_sort_tasks(GPSortTask* tasks, size_t tasks_length, int(*f)(void*))
+{
+    GPThread threads[64];
+    bool     created[64];
+    for (size_t i = 1; i < tasks_length; ++i)
+        created[i] = gp_s_thread_create(&threads[i], f, &tasks[i]);
+    f(&tasks[0]);
+    for (size_t i = 1; i < tasks_length; ++i) {
+        if (created[i])
+            gp_thread_join(threads[i], NULL);
+        else
+            f(&tasks[i]);
+    }
+}
+
+void gp_arr_sort_parallel(
+    size_t                 element_size,
+    GPArrayAny             arr,
+    gp_arr_sort_callback_t compare,
+    size_t                 thread_count)
+{
+    GPSortCompare func;
+    memcpy(&func, &compare, sizeof func);
+    const size_t length = gp_arr_length(arr);
+    thread_count = gp_min(thread_count, (size_t)64);
+    if (thread_count <= 1 || length < 1024 * thread_count) {
+        gp_s_sort(element_size, arr, length, func);
+        return;
+    }
+
+    size_t bounds[64 + 1];
+    for (size_t i = 0; i <= thread_count; ++i)
+        bounds[i] = length * i / thread_count;
+
+    GPSortTask tasks[64];
+    for (size_t i = 0; i < thread_count; ++i)
+        tasks[i] = (GPSortTask){
+            element_size, func, NULL, arr, bounds[i], bounds[i], bounds[i + 1] };
+    gp_s_run_sort_tasks(tasks, thread_count, gp_s_sort_task);
+
+    // Merge pairs of runs ping ponging between arr and buffer.
+    uint8_t* buffer = gp_mem_alloc(gp_global_heap, length * element_size);
+    uint8_t* src  = arr;
+    uint8_t* dest = buffer;
+    for (size_t runs = thread_count; runs > 1; runs = (runs + 1)/2)
+    {
+        size_t tasks_length = 0;
+        for (size_t i = 0; i < runs; i += 2) {
+            if (i + 1 < runs) {
+                tasks[tasks_length++] = (GPSortTask){
+                    element_size, func, src, dest, bounds[i], bounds[i + 1], bounds[i + 2] };
+            } else // odd run out, merge with nothing to keep it in dest
+                tasks[tasks_length++] = (GPSortTask){
+                    element_size, func, src, dest, bounds[i], bounds[i + 1], bounds[i + 1] };
+        }
+        gp_s_run_sort_tasks(tasks, tasks_length, gp_s_merge_task);
+
+        for (size_t i = 0; i <= tasks_length; ++i)
+            bounds[i] = bounds[gp_min(2*i, runs)];
+        uint8_t* tmp = src;
+        src  = dest;
+        dest = tmp;
+    }
+    if (src != arr)
+        memcpy(arr, src, length * element_size);
+    gp_mem_dealloc(gp_global_heap, buffer);
+}
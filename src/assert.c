@@ -362,7 +362,7 @@ void gp_internal_fail(
                     pf_fprintf(stderr, GP_BRIGHT_RED);
                 else if (strchr("dibBouxX", *fmt_spec)) // integer
                     pf_fprintf(stderr, GP_BRIGHT_BLUE);
-                else if (strchr("fFeEgG", *fmt_spec)) // floating point
+                else if (strchr("fFeEgGr", *fmt_spec)) // floating point
                     pf_fprintf(stderr, GP_BRIGHT_MAGENTA);
                 else if (*fmt_spec == 'p') // pointer
                     pf_fprintf(stderr, GP_BLUE);
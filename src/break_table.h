@@ -0,0 +1,1190 @@
+// MIT License
+// Copyright (c) 2023 Lauri Lorenzo Fiestas
+// https://github.com/PrinssiFiestas/libGPC/blob/main/LICENSE.md
+
+// Generated by tools/breaktablegen.c from UCD 16.0.0. Do not edit!
+// Total size of stages: 20120 bytes.
+
+#ifndef GP_BREAK_TABLE_H
+#define GP_BREAK_TABLE_H
+
+#include <stdint.h>
+
+#define GP_BREAK_TABLE_LIMIT  0xE1000
+#define GP_BREAK_STAGE1_SHIFT 5
+#define GP_BREAK_STAGE1_MASK  0x1F
+#define GP_BREAK_STAGE2_SHIFT 4
+#define GP_BREAK_STAGE2_MASK  0xF
+
+#define GP_BREAK_EXTENDED_PICTOGRAPHIC 0x01
+#define GP_BREAK_EAST_ASIAN_WIDE       0x02
+#define GP_BREAK_UNASSIGNED            0x04
+#define GP_BREAK_INCB_CONSONANT        0x08
+#define GP_BREAK_INCB_EXTEND           0x10
+#define GP_BREAK_INCB_LINKER           0x20
+#define GP_BREAK_QUOTE_INITIAL         0x40
+#define GP_BREAK_QUOTE_FINAL           0x80
+
+enum
+{
+    GP_GB_OTHER,
+    GP_GB_CR,
+    GP_GB_LF,
+    GP_GB_CONTROL,
+    GP_GB_EXTEND,
+    GP_GB_ZWJ,
+    GP_GB_REGIONAL_INDICATOR,
+    GP_GB_PREPEND,
+    GP_GB_SPACING_MARK,
+    GP_GB_L,
+    GP_GB_V,
+    GP_GB_T,
+    GP_GB_LV,
+    GP_GB_LVT,
+};
+
+enum
+{
+    GP_WB_OTHER,
+    GP_WB_CR,
+    GP_WB_LF,
+    GP_WB_NEWLINE,
+    GP_WB_EXTEND,
+    GP_WB_ZWJ,
+    GP_WB_REGIONAL_INDICATOR,
+    GP_WB_FORMAT,
+    GP_WB_KATAKANA,
+    GP_WB_HEBREW_LETTER,
+    GP_WB_ALETTER,
+    GP_WB_SINGLE_QUOTE,
+    GP_WB_DOUBLE_QUOTE,
+    GP_WB_MID_NUM_LET,
+    GP_WB_MID_LETTER,
+    GP_WB_MID_NUM,
+    GP_WB_NUMERIC,
+    GP_WB_EXTEND_NUM_LET,
+    GP_WB_WSEG_SPACE,
+};
+
+enum
+{
+    GP_LB_AL,
+    GP_LB_BK,
+    GP_LB_CR,
+    GP_LB_LF,
+    GP_LB_CM,
+    GP_LB_NL,
+    GP_LB_WJ,
+    GP_LB_ZW,
+    GP_LB_GL,
+    GP_LB_SP,
+    GP_LB_ZWJ,
+    GP_LB_B2,
+    GP_LB_BA,
+    GP_LB_BB,
+    GP_LB_HY,
+    GP_LB_CB,
+    GP_LB_CL,
+    GP_LB_CP,
+    GP_LB_EX,
+    GP_LB_IN,
+    GP_LB_NS,
+    GP_LB_OP,
+    GP_LB_QU,
+    GP_LB_IS,
+    GP_LB_NU,
+    GP_LB_PO,
+    GP_LB_PR,
+    GP_LB_SY,
+    GP_LB_EB,
+    GP_LB_EM,
+    GP_LB_H2,
+    GP_LB_H3,
+    GP_LB_HL,
+    GP_LB_ID,
+    GP_LB_JL,
+    GP_LB_JV,
+    GP_LB_JT,
+    GP_LB_RI,
+    GP_LB_AK,
+    GP_LB_AP,
+    GP_LB_AS,
+    GP_LB_VF,
+    GP_LB_VI,
+};
+
+static const uint8_t gp_break_stage0[1800] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 27, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 34, 35, 36,
+    37, 38, 39, 40, 34, 35, 36, 37, 38, 39, 40, 41, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 43, 44, 45, 46,
+    47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62,
+    63, 64, 65, 42, 42, 42, 42, 66, 63, 67, 68, 63, 63, 63, 63, 63,
+    63, 69, 70, 71, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    72, 42, 42, 42, 63, 73, 74, 75, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 76, 26, 77, 78, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 79, 80, 81, 42, 42, 42, 42, 82, 42,
+    42, 42, 42, 42, 42, 42, 83, 84, 85, 86, 87, 88, 42, 89, 42, 90,
+    91, 92, 93, 94, 95, 42, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 106,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 106,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    107, 108, 108, 108, 108, 108, 108, 108,
+};
+
+static const uint16_t gp_break_stage1[3488] = {
+    0, 1, 2, 3, 4, 5, 4, 6, 7, 1, 8, 9, 10, 11, 10, 11,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 12, 13, 10, 10,
+    14, 14, 14, 14, 15, 16, 17, 18, 19, 10, 20, 10, 10, 10, 10, 21,
+    10, 10, 10, 10, 10, 10, 10, 10, 22, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 4, 10, 23, 10, 10, 24, 25, 14, 26, 27, 28, 29, 30,
+    31, 32, 10, 10, 33, 14, 34, 35, 10, 10, 10, 10, 10, 36, 37, 38,
+    39, 40, 10, 14, 41, 10, 10, 10, 10, 10, 42, 43, 44, 10, 33, 45,
+    10, 46, 47, 48, 10, 49, 50, 10, 51, 52, 10, 10, 53, 14, 54, 14,
+    55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70,
+    71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 65, 81, 82, 83, 69, 84,
+    85, 64, 65, 86, 87, 88, 69, 89, 90, 91, 92, 93, 94, 95, 77, 96,
+    97, 98, 65, 99, 100, 101, 69, 102, 103, 104, 73, 105, 106, 107, 69, 108,
+    109, 98, 57, 110, 111, 112, 69, 113, 114, 115, 10, 116, 117, 118, 77, 119,
+    48, 48, 48, 120, 121, 122, 48, 48, 48, 48, 48, 123, 124, 125, 48, 48,
+    126, 127, 125, 128, 129, 10, 130, 131, 132, 133, 14, 134, 135, 136, 48, 48,
+    48, 48, 137, 138, 122, 139, 140, 141, 142, 143, 10, 10, 144, 10, 10, 145,
+    146, 146, 146, 146, 146, 146, 147, 147, 147, 147, 148, 149, 149, 149, 149, 149,
+    10, 10, 10, 10, 150, 151, 10, 10, 150, 10, 10, 152, 153, 11, 10, 10,
+    10, 153, 10, 10, 10, 154, 155, 48, 10, 48, 10, 10, 10, 10, 10, 156,
+    157, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 158, 10, 159, 160, 10, 10, 10, 10, 161, 162,
+    10, 163, 10, 164, 10, 165, 166, 167, 48, 48, 48, 168, 169, 170, 125, 48,
+    171, 125, 10, 10, 10, 10, 10, 162, 172, 10, 173, 10, 10, 10, 10, 174,
+    10, 175, 176, 177, 178, 48, 48, 48, 48, 48, 48, 48, 48, 179, 48, 48,
+    10, 180, 48, 48, 48, 181, 182, 183, 125, 125, 48, 14, 184, 48, 48, 48,
+    185, 186, 186, 187, 188, 189, 190, 191, 192, 10, 193, 44, 194, 194, 195, 196,
+    10, 10, 197, 198, 199, 44, 10, 200, 50, 10, 10, 201, 48, 202, 203, 204,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 205, 14, 14, 206,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 156, 10, 10, 156, 207, 10, 208, 10, 10, 10, 209, 210, 211, 130, 212,
+    213, 214, 215, 216, 217, 218, 219, 220, 221, 130, 222, 223, 224, 14, 14, 225,
+    226, 227, 228, 229, 230, 48, 10, 10, 162, 231, 232, 48, 48, 48, 48, 48,
+    48, 233, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 234, 48,
+    235, 236, 237, 48, 48, 48, 48, 48, 238, 48, 48, 48, 239, 48, 240, 241,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 242, 243, 10, 244, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 245, 246, 247, 48, 48, 248,
+    249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264,
+    265, 266, 267, 268, 269, 270, 271, 272, 48, 273, 274, 275, 276, 48, 277, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 278, 48, 48, 48, 48, 279, 280, 48, 48, 48, 235, 48, 281,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    282, 283, 48, 48, 48, 284, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 285, 286,
+    10, 10, 144, 10, 10, 10, 287, 288, 10, 289, 290, 290, 290, 290, 14, 14,
+    291, 292, 293, 294, 295, 296, 48, 48, 297, 298, 297, 297, 297, 297, 297, 299,
+    297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 300, 48, 297,
+    301, 302, 303, 304, 305, 297, 306, 297, 307, 308, 309, 310, 311, 310, 312, 313,
+    314, 315, 315, 316, 315, 315, 315, 315, 317, 297, 315, 315, 297, 297, 318, 319,
+    297, 320, 297, 297, 321, 297, 297, 297, 297, 322, 297, 297, 297, 310, 310, 323,
+    310, 310, 310, 310, 310, 324, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297,
+    297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297,
+    297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297,
+    297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297,
+    297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 325, 325, 325, 325,
+    315, 326, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315,
+    315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315,
+    315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315,
+    315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315,
+    315, 315, 315, 315, 315, 315, 315, 315, 327, 297, 297, 297, 328, 10, 10, 200,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    329, 10, 330, 48, 10, 10, 331, 332, 10, 333, 10, 10, 10, 10, 10, 334,
+    335, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 208, 336, 48, 337,
+    338, 10, 339, 340, 10, 10, 10, 341, 342, 10, 10, 343, 344, 125, 14, 345,
+    44, 10, 346, 10, 347, 348, 146, 349, 350, 186, 186, 351, 352, 353, 354, 125,
+    194, 194, 355, 356, 357, 358, 48, 359, 48, 48, 48, 360, 361, 48, 362, 363,
+    364, 365, 290, 10, 10, 10, 244, 10, 10, 10, 10, 10, 10, 10, 366, 125,
+    367, 368, 369, 370, 369, 371, 369, 367, 368, 369, 370, 369, 371, 369, 367, 368,
+    369, 370, 369, 371, 369, 367, 368, 369, 370, 369, 371, 369, 367, 368, 369, 370,
+    369, 371, 369, 367, 368, 369, 370, 369, 371, 369, 367, 368, 369, 370, 369, 371,
+    369, 367, 368, 369, 370, 369, 371, 369, 367, 368, 369, 370, 369, 371, 369, 367,
+    368, 369, 370, 369, 371, 369, 367, 368, 369, 370, 369, 371, 369, 367, 368, 369,
+    370, 369, 371, 369, 367, 368, 369, 370, 369, 371, 369, 367, 368, 369, 370, 369,
+    371, 369, 367, 368, 369, 370, 369, 371, 369, 367, 368, 369, 370, 369, 371, 369,
+    367, 368, 369, 370, 369, 371, 369, 367, 368, 369, 370, 369, 371, 369, 367, 368,
+    369, 370, 369, 371, 369, 367, 368, 369, 370, 369, 371, 369, 367, 368, 369, 370,
+    369, 371, 369, 367, 368, 369, 370, 369, 371, 369, 367, 368, 369, 370, 369, 371,
+    369, 367, 368, 369, 370, 369, 371, 369, 367, 368, 369, 370, 369, 371, 369, 367,
+    368, 369, 370, 369, 371, 369, 367, 368, 369, 370, 369, 371, 369, 367, 368, 369,
+    370, 369, 371, 369, 367, 368, 369, 370, 369, 371, 369, 367, 368, 369, 370, 369,
+    371, 369, 367, 368, 369, 370, 369, 371, 369, 367, 368, 369, 370, 369, 371, 369,
+    367, 368, 369, 370, 369, 371, 369, 367, 368, 369, 370, 369, 371, 369, 367, 368,
+    369, 370, 369, 371, 369, 367, 368, 369, 370, 369, 372, 147, 373, 149, 149, 374,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297,
+    297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297,
+    289, 375, 376, 377, 378, 10, 10, 10, 10, 10, 10, 379, 48, 380, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 381, 48, 10, 10, 10, 10, 337, 10, 10, 382, 48, 48, 383,
+    14, 384, 385, 386, 387, 388, 389, 390, 10, 10, 10, 10, 10, 10, 10, 391,
+    392, 393, 394, 395, 394, 396, 397, 398, 310, 399, 315, 317, 400, 401, 402, 403,
+    404, 10, 11, 405, 208, 208, 48, 48, 10, 10, 10, 10, 10, 10, 10, 50,
+    406, 48, 48, 48, 10, 10, 10, 407, 48, 48, 48, 48, 48, 48, 48, 408,
+    48, 48, 48, 48, 48, 48, 48, 48, 10, 130, 10, 10, 10, 83, 225, 48,
+    10, 10, 409, 10, 50, 10, 10, 410, 10, 411, 10, 10, 412, 413, 48, 48,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 208, 125, 10, 10, 412, 10, 414,
+    10, 10, 382, 10, 10, 10, 415, 145, 145, 416, 20, 417, 10, 10, 10, 415,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 289, 10, 174, 382, 48, 21, 10, 10, 418, 48, 48, 48, 48,
+    419, 10, 10, 420, 10, 421, 10, 289, 10, 175, 48, 48, 48, 48, 10, 422,
+    10, 423, 10, 244, 48, 48, 48, 48, 10, 10, 10, 424, 48, 48, 48, 48,
+    425, 426, 10, 427, 48, 428, 10, 130, 10, 130, 48, 48, 129, 10, 429, 430,
+    10, 10, 10, 431, 10, 174, 10, 432, 10, 379, 48, 48, 48, 48, 48, 48,
+    10, 10, 10, 10, 162, 48, 48, 48, 10, 10, 10, 432, 10, 10, 10, 432,
+    10, 10, 433, 125, 44, 10, 434, 10, 174, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 10, 10, 435, 379, 436, 48, 48, 437,
+    10, 130, 438, 10, 42, 225, 48, 10, 439, 48, 48, 10, 407, 48, 10, 289,
+    440, 186, 186, 441, 442, 443, 444, 445, 192, 10, 10, 446, 447, 10, 162, 125,
+    448, 10, 449, 450, 451, 10, 10, 452, 192, 10, 10, 453, 454, 455, 48, 48,
+    10, 20, 456, 457, 458, 48, 48, 48, 459, 460, 461, 10, 10, 331, 462, 125,
+    463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 186, 473, 474, 475, 476, 48,
+    10, 10, 10, 477, 478, 479, 379, 48, 10, 10, 10, 480, 481, 125, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 10, 10, 331, 482, 483, 484, 48, 48,
+    10, 10, 10, 485, 486, 125, 487, 48, 10, 10, 488, 489, 125, 490, 491, 48,
+    48, 492, 493, 494, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    10, 10, 456, 495, 48, 48, 48, 48, 48, 48, 10, 10, 10, 10, 125, 496,
+    497, 498, 186, 499, 500, 501, 48, 48, 48, 48, 502, 10, 10, 503, 504, 48,
+    505, 10, 10, 506, 507, 508, 10, 10, 509, 510, 511, 10, 10, 10, 10, 162,
+    512, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 10, 10, 83, 125,
+    73, 10, 513, 514, 515, 125, 48, 516, 10, 517, 518, 519, 48, 48, 48, 48,
+    520, 10, 10, 521, 522, 125, 523, 10, 524, 525, 125, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 194, 526,
+    527, 528, 186, 529, 530, 531, 48, 48, 48, 48, 48, 83, 48, 532, 533, 534,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 244, 48, 48, 48, 48, 48, 48,
+    10, 10, 10, 10, 10, 10, 175, 535, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 415, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 10, 10, 10, 10, 10, 10, 83,
+    10, 10, 10, 10, 10, 536, 10, 10, 537, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 538, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 539, 540, 541, 542, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 50,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 543, 10, 10, 10,
+    10, 10, 10, 10, 289, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    194, 544, 545, 501, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    10, 10, 10, 162, 10, 175, 546, 10, 10, 10, 10, 175, 125, 10, 208, 547,
+    10, 10, 10, 548, 549, 125, 380, 550, 10, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 10, 10, 551, 125, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 10, 10, 10, 10, 48, 552, 48, 48, 48, 48, 48, 48,
+    10, 10, 10, 10, 553, 554, 555, 555, 556, 448, 48, 48, 48, 48, 557, 558,
+    297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297,
+    297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 321,
+    297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297,
+    325, 325, 325, 325, 325, 325, 325, 325, 325, 325, 325, 325, 325, 325, 325, 325,
+    325, 325, 325, 325, 325, 325, 325, 325, 325, 325, 325, 325, 325, 559, 48, 560,
+    561, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 562,
+    563, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297,
+    297, 297, 564, 565, 48, 566, 567, 297, 297, 297, 297, 297, 297, 297, 297, 297,
+    297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 568,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    10, 10, 10, 10, 10, 10, 50, 130, 162, 569, 570, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 125,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    14, 14, 571, 14, 572, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 573, 574, 575, 48, 576, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 577, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    325, 325, 325, 325, 325, 578, 325, 578, 48, 48, 48, 48, 48, 48, 48, 48,
+    10, 10, 10, 10, 10, 390, 10, 10, 10, 166, 579, 580, 581, 10, 10, 10,
+    582, 583, 10, 584, 585, 104, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 586, 10, 104, 145, 10, 145,
+    10, 390, 10, 390, 175, 10, 175, 10, 73, 10, 73, 10, 587, 490, 490, 490,
+    14, 14, 14, 588, 14, 14, 589, 354, 590, 591, 25, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    10, 175, 592, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    593, 594, 595, 10, 10, 10, 208, 48, 596, 48, 48, 48, 48, 48, 48, 48,
+    10, 10, 130, 597, 598, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 10, 599, 48, 10, 10, 600, 601,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 10, 600, 125,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 10, 333, 602,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 603, 175,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 407, 572, 48, 48,
+    10, 10, 10, 10, 604, 605, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 606, 533, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    581, 10, 607, 608, 609, 610, 611, 612, 613, 414, 614, 414, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    615, 616, 617, 616, 616, 616, 616, 616, 616, 618, 619, 620, 621, 620, 616, 622,
+    623, 48, 239, 10, 244, 10, 624, 625, 626, 627, 628, 629, 629, 629, 630, 631,
+    632, 633, 634, 635, 636, 637, 638, 629, 629, 629, 629, 629, 629, 629, 629, 629,
+    639, 639, 640, 641, 639, 639, 639, 642, 643, 644, 639, 645, 646, 647, 639, 648,
+    639, 639, 639, 649, 650, 651, 652, 653, 654, 655, 656, 657, 639, 639, 639, 658,
+    659, 660, 661, 662, 663, 639, 664, 665, 616, 666, 615, 616, 616, 667, 616, 668,
+    639, 639, 639, 639, 669, 48, 48, 670, 639, 639, 671, 672, 673, 674, 675, 676,
+    48, 48, 48, 48, 48, 48, 48, 677, 48, 48, 48, 48, 48, 678, 679, 680,
+    681, 48, 48, 48, 682, 683, 48, 48, 682, 48, 684, 685, 686, 687, 687, 687,
+    688, 689, 690, 691, 692, 639, 639, 693, 639, 639, 639, 694, 695, 696, 639, 639,
+    251, 251, 251, 251, 251, 697, 698, 699, 700, 639, 639, 639, 701, 702, 703, 704,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 125,
+    629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629,
+    629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629,
+    629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629,
+    629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 705,
+    297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297,
+    297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 706,
+    707, 708, 14, 14, 14, 14, 14, 14, 708, 708, 708, 708, 708, 708, 708, 708,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 708,
+    708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708,
+    708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708,
+};
+
+static const uint8_t gp_break_stage2[11344] = {
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 4, 4, 5, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    6, 7, 8, 0, 9, 10, 0, 11, 12, 13, 0, 9, 14, 15, 16, 17,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 14, 0, 0, 0, 7,
+    0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 12, 9, 13, 0, 21,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 12, 22, 23, 0, 1,
+    1, 1, 1, 1, 1, 24, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    25, 12, 10, 9, 9, 9, 0, 0, 0, 26, 20, 27, 0, 28, 26, 0,
+    10, 9, 0, 0, 29, 20, 0, 30, 0, 0, 20, 31, 0, 0, 0, 12,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 0, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 32, 20, 20, 20, 32, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0, 0, 20, 32,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 34,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 34, 34, 34, 34,
+    34, 34, 34, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    20, 20, 20, 20, 20, 0, 20, 20, 0, 0, 20, 20, 20, 20, 14, 20,
+    0, 0, 0, 0, 0, 0, 20, 30, 20, 20, 20, 0, 20, 0, 20, 20,
+    20, 20, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 0, 33, 33, 33, 33, 33, 33, 33, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 0, 0, 20, 20, 20, 20, 0, 20, 30,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 14, 35, 0, 0, 0, 0, 9,
+    0, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 22, 33,
+    0, 33, 33, 0, 33, 33, 7, 33, 0, 0, 0, 0, 0, 0, 0, 0,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 0, 0, 0, 0, 36,
+    36, 36, 36, 20, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 0, 0, 0, 10, 10, 10, 14, 14, 0, 0,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 7, 38, 7, 7, 7,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 33, 33, 33, 33, 33,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 10, 18, 39, 0, 20, 20,
+    33, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 7, 20, 33, 33, 33, 33, 33, 33, 33, 37, 0, 33,
+    33, 33, 33, 33, 33, 20, 20, 33, 33, 0, 33, 33, 33, 33, 20, 20,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 0, 0, 20,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40,
+    20, 33, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 0, 0, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 20, 20,
+    33, 33, 33, 33, 20, 20, 0, 0, 14, 7, 20, 0, 0, 33, 9, 9,
+    20, 20, 20, 20, 20, 20, 33, 33, 33, 33, 20, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 20, 33, 33, 33, 20, 33, 33, 33, 33, 33, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 33, 33, 33, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 20, 0, 20, 20, 20, 20, 20, 20, 0,
+    37, 37, 0, 0, 0, 0, 0, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 33, 33, 33, 33, 33, 33,
+    33, 33, 37, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 41, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 33, 41, 33, 20, 41, 41,
+    41, 33, 33, 33, 33, 33, 33, 33, 33, 41, 41, 41, 41, 43, 41, 41,
+    20, 33, 33, 33, 33, 33, 33, 33, 42, 42, 42, 42, 42, 42, 42, 42,
+    20, 20, 33, 33, 22, 22, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    0, 20, 20, 20, 20, 20, 20, 20, 42, 42, 42, 42, 42, 42, 42, 42,
+    20, 33, 41, 41, 0, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 20,
+    20, 0, 0, 20, 20, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 0, 42, 42, 42, 42, 42, 42,
+    42, 0, 42, 0, 0, 0, 42, 42, 42, 42, 0, 0, 33, 20, 33, 41,
+    41, 33, 33, 33, 33, 0, 0, 41, 41, 0, 0, 41, 41, 43, 20, 0,
+    0, 0, 0, 0, 0, 0, 0, 33, 0, 0, 0, 0, 42, 42, 0, 42,
+    20, 20, 33, 33, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    42, 42, 10, 10, 0, 0, 0, 0, 0, 10, 0, 9, 20, 0, 33, 0,
+    0, 33, 33, 41, 0, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 20,
+    20, 0, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 20, 20, 20, 20, 20, 20,
+    20, 0, 20, 20, 0, 20, 20, 0, 20, 20, 0, 0, 33, 0, 41, 41,
+    41, 33, 33, 0, 0, 0, 0, 33, 33, 0, 0, 33, 33, 33, 0, 0,
+    0, 33, 0, 0, 0, 0, 0, 0, 0, 20, 20, 20, 20, 0, 20, 0,
+    0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    33, 33, 20, 20, 20, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 33, 33, 41, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 20,
+    20, 20, 0, 20, 20, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 0, 42, 42, 0, 42, 42, 42, 42, 42, 0, 0, 33, 20, 41, 41,
+    41, 33, 33, 33, 33, 33, 0, 33, 33, 41, 0, 41, 41, 43, 0, 0,
+    20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 9, 0, 0, 0, 0, 0, 0, 0, 42, 33, 33, 33, 33, 33, 33,
+    0, 33, 41, 41, 0, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 20,
+    42, 0, 42, 42, 0, 42, 42, 42, 42, 42, 0, 0, 33, 20, 33, 33,
+    41, 33, 33, 33, 33, 0, 0, 41, 41, 0, 0, 41, 41, 43, 0, 0,
+    0, 0, 0, 0, 0, 33, 33, 33, 0, 0, 0, 0, 42, 42, 0, 42,
+    0, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 33, 20, 0, 20, 20, 20, 20, 20, 20, 0, 0, 0, 20, 20,
+    20, 0, 20, 20, 20, 20, 0, 0, 0, 20, 20, 0, 20, 0, 20, 20,
+    0, 0, 0, 20, 20, 0, 0, 0, 20, 20, 20, 0, 0, 0, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 33, 41,
+    33, 41, 41, 0, 0, 0, 41, 41, 41, 0, 41, 41, 41, 33, 0, 0,
+    20, 0, 0, 0, 0, 0, 0, 33, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0,
+    33, 41, 41, 41, 33, 20, 20, 20, 20, 20, 20, 20, 20, 0, 20, 20,
+    20, 0, 20, 20, 20, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 0, 0, 33, 20, 33, 33,
+    33, 41, 41, 41, 41, 0, 33, 33, 33, 0, 33, 33, 33, 43, 0, 0,
+    0, 0, 0, 0, 0, 33, 33, 0, 42, 42, 42, 0, 0, 20, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 33, 41, 41, 29, 20, 20, 20, 20, 20, 20, 20, 20, 0, 20, 20,
+    20, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 0, 20, 20, 20, 20, 20, 0, 0, 33, 20, 41, 33,
+    33, 41, 33, 41, 41, 0, 33, 33, 33, 0, 33, 33, 33, 33, 0, 0,
+    0, 0, 0, 0, 0, 33, 33, 0, 0, 0, 0, 0, 0, 20, 20, 0,
+    0, 20, 20, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    33, 33, 41, 41, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 20, 20,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 33, 33, 20, 33, 41,
+    41, 33, 33, 33, 33, 0, 41, 41, 41, 0, 41, 41, 41, 43, 40, 0,
+    0, 0, 0, 0, 20, 20, 20, 33, 0, 0, 0, 0, 0, 0, 0, 20,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 20, 20, 20, 20, 20, 20,
+    0, 33, 41, 41, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 20, 20, 20, 20, 20, 20,
+    20, 20, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 20, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 33, 0, 0, 0, 0, 33,
+    41, 41, 33, 33, 33, 0, 33, 0, 41, 41, 41, 41, 41, 41, 41, 33,
+    0, 0, 41, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 33, 0, 44, 33, 33, 33, 33, 33, 33, 33, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 33, 33, 33, 33, 33, 33, 33, 33, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 22, 22, 0, 0, 0, 0,
+    0, 33, 0, 44, 33, 33, 33, 33, 33, 33, 33, 33, 33, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 33, 33, 33, 33, 33, 33, 33, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+    20, 29, 29, 29, 29, 0, 29, 29, 25, 29, 29, 22, 25, 7, 7, 7,
+    7, 7, 25, 0, 7, 0, 0, 0, 33, 33, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 22, 33, 0, 33, 0, 33, 12, 23, 12, 23, 41, 41,
+    20, 20, 20, 20, 20, 20, 20, 20, 0, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 0,
+    0, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 45,
+    33, 33, 33, 33, 33, 22, 33, 33, 20, 20, 20, 20, 20, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 33, 0, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 0, 22, 22,
+    0, 0, 0, 0, 0, 0, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29, 29, 22, 29, 0, 0, 0, 0, 0, 25, 25, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 46, 33, 33, 33,
+    33, 41, 33, 33, 33, 33, 33, 33, 46, 33, 33, 41, 41, 33, 33, 0,
+    0, 0, 0, 0, 0, 0, 41, 41, 33, 33, 0, 0, 0, 0, 33, 33,
+    33, 0, 46, 46, 46, 0, 0, 46, 46, 46, 46, 46, 46, 46, 0, 0,
+    0, 33, 33, 33, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 33, 46, 41, 33, 33, 46, 46, 46, 46, 46, 46, 33, 0, 46,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 46, 46, 46, 33, 0, 0,
+    20, 20, 20, 20, 20, 20, 0, 20, 0, 0, 0, 0, 0, 20, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 20, 20, 20, 20,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 20, 20, 20, 20, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 0, 20, 0, 20, 20, 20, 20, 0, 0,
+    20, 0, 20, 20, 20, 20, 0, 0, 20, 20, 20, 20, 20, 20, 20, 0,
+    20, 0, 20, 20, 20, 20, 0, 0, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 33, 33, 33,
+    0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 0, 0, 20, 20, 20, 20, 20, 20, 0, 0,
+    22, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 20,
+    50, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 12, 23, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 22, 22, 22, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 33, 33, 33, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20,
+    20, 20, 33, 33, 33, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 33, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 20, 20,
+    20, 0, 33, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 33, 33, 41, 33, 33, 33, 33, 33, 33, 33, 41, 41,
+    41, 41, 41, 41, 41, 41, 33, 41, 41, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 22, 22, 51, 0, 22, 0, 22, 9, 0, 33, 0, 0,
+    0, 0, 7, 7, 22, 22, 29, 0, 7, 7, 0, 33, 33, 33, 52, 33,
+    20, 20, 20, 20, 20, 33, 33, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 33, 20, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0,
+    33, 33, 33, 41, 41, 41, 41, 33, 33, 41, 41, 41, 0, 0, 0, 0,
+    41, 41, 33, 41, 41, 41, 41, 41, 41, 33, 33, 33, 0, 0, 0, 0,
+    0, 0, 0, 0, 7, 7, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 33, 33, 41, 41, 33, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 41, 33, 41, 33, 33, 33, 33, 33, 33, 33, 0,
+    33, 46, 33, 46, 46, 33, 33, 33, 33, 33, 33, 33, 33, 41, 41, 41,
+    41, 41, 41, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 0, 0, 33,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 0,
+    33, 33, 33, 33, 41, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 41, 41,
+    41, 41, 33, 33, 54, 53, 53, 53, 53, 53, 53, 53, 53, 0, 22, 22,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 22, 22, 56, 22, 22, 22,
+    22, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 56, 56, 56, 56, 56, 56, 56, 56, 56, 22, 22, 22,
+    33, 33, 41, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 41, 33, 33, 33, 33, 41, 41, 33, 33, 33, 33, 33, 33, 20, 20,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 33, 41, 33, 33, 41, 41, 41, 33, 41, 33,
+    33, 33, 58, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 41, 41, 41, 41, 41, 41, 41, 41, 33, 33, 33, 33,
+    33, 33, 33, 33, 41, 41, 33, 33, 0, 0, 0, 22, 22, 22, 22, 22,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 22, 22,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 20, 20, 20,
+    33, 33, 33, 0, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 41, 33, 33, 33, 33, 33, 33, 33, 20, 20, 20, 20, 33, 20, 20,
+    20, 20, 20, 20, 33, 20, 20, 41, 33, 33, 20, 0, 0, 0, 0, 0,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 34, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 34, 33, 33, 33,
+    20, 20, 20, 20, 20, 20, 20, 20, 0, 20, 0, 20, 0, 20, 0, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0,
+    20, 20, 20, 20, 20, 0, 20, 20, 20, 20, 20, 20, 20, 0, 20, 0,
+    0, 0, 20, 20, 20, 0, 20, 20, 20, 20, 20, 20, 20, 0, 0, 0,
+    20, 20, 20, 20, 0, 0, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0,
+    0, 0, 20, 20, 20, 0, 20, 20, 20, 20, 20, 20, 20, 29, 0, 0,
+    50, 50, 50, 50, 50, 50, 50, 25, 50, 50, 50, 59, 60, 61, 38, 38,
+    22, 25, 22, 22, 62, 0, 0, 0, 63, 64, 12, 27, 27, 31, 12, 27,
+    0, 0, 0, 0, 65, 66, 66, 67, 4, 4, 38, 38, 38, 38, 38, 68,
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 27, 31, 0, 69, 51, 0, 21,
+    21, 0, 0, 0, 14, 12, 23, 51, 51, 69, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 21, 0, 22, 10, 22, 22, 22, 22, 0, 22, 22, 50,
+    70, 71, 71, 71, 71, 72, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 23, 20,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 23, 0,
+    9, 9, 9, 9, 9, 9, 9, 10, 9, 73, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 10, 9, 9, 9, 9, 10, 9, 9, 10, 9,
+    10, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 20, 10, 0, 0, 0, 20, 0, 10, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 0, 20, 9, 0, 0, 20, 20, 20, 20, 20, 0, 0,
+    0, 0, 26, 0, 20, 0, 20, 0, 20, 0, 20, 20, 20, 20, 0, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 74, 0, 0, 20, 20, 20, 20,
+    0, 0, 0, 0, 0, 20, 20, 20, 20, 20, 0, 0, 0, 0, 20, 0,
+    0, 0, 0, 0, 26, 26, 26, 26, 26, 26, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 26, 0, 0, 0, 0, 0,
+    0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66,
+    0, 0, 0, 0, 0, 0, 0, 0, 12, 23, 12, 23, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 26, 76, 77, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 78, 78, 78, 78, 26, 26, 26,
+    75, 79, 79, 75, 0, 0, 0, 0, 26, 26, 26, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 74, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 26, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 26, 78, 78, 0,
+    79, 79, 79, 79, 26, 26, 0, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 0, 75, 75, 26, 26, 79, 26, 79, 79, 79, 80, 79, 79,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    78, 78, 78, 78, 78, 78, 78, 78, 26, 79, 79, 79, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 78, 78, 78, 78, 78, 78, 78, 78,
+    78, 78, 78, 78, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 79, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 75,
+    26, 26, 26, 26, 26, 26, 0, 0, 0, 0, 81, 81, 81, 81, 81, 81,
+    26, 26, 26, 78, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 78, 26, 26, 26, 26, 26, 26, 26, 26, 78, 78, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 75, 75, 79,
+    79, 79, 79, 79, 75, 75, 79, 79, 79, 26, 26, 26, 26, 79, 78, 79,
+    79, 79, 26, 79, 75, 26, 26, 26, 79, 79, 26, 26, 79, 26, 26, 79,
+    79, 79, 26, 26, 26, 26, 26, 26, 26, 26, 75, 26, 26, 26, 26, 26,
+    26, 79, 75, 75, 79, 75, 26, 79, 79, 80, 75, 26, 26, 75, 79, 79,
+    79, 79, 79, 79, 79, 78, 0, 0, 79, 79, 82, 82, 80, 80, 26, 26,
+    26, 26, 26, 0, 26, 0, 26, 0, 0, 0, 0, 0, 0, 26, 0, 0,
+    0, 26, 0, 0, 0, 0, 0, 0, 78, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 26, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 26, 0, 0, 26, 0, 0, 0, 0, 78, 0, 78, 0,
+    0, 0, 0, 78, 78, 78, 0, 78, 0, 0, 0, 83, 83, 83, 83, 83,
+    83, 0, 7, 84, 79, 26, 26, 26, 12, 23, 12, 23, 12, 23, 12, 23,
+    12, 23, 12, 23, 12, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 78, 78, 78, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    78, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 78,
+    0, 0, 0, 0, 0, 12, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 12, 23, 12, 23, 12, 23, 12, 23, 12, 23,
+    0, 0, 0, 0, 26, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 12, 23, 12, 23, 12, 23, 12, 23, 12, 23, 12, 23, 12,
+    23, 12, 23, 12, 23, 12, 23, 12, 23, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 23, 0, 0,
+    0, 0, 0, 0, 0, 26, 26, 26, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 78, 78, 0, 0, 0,
+    78, 0, 0, 0, 0, 78, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 0, 0, 0, 0, 0, 0, 20, 20, 20, 20, 33,
+    33, 33, 20, 20, 0, 0, 0, 0, 0, 7, 22, 22, 22, 0, 7, 22,
+    20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0, 0, 0, 20,
+    22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33,
+    20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 0, 20, 20, 20, 20, 20, 20, 20, 0,
+    83, 83, 27, 31, 27, 31, 83, 83, 83, 27, 31, 83, 27, 31, 22, 22,
+    22, 22, 22, 22, 22, 22, 0, 22, 12, 22, 0, 0, 27, 31, 0, 0,
+    27, 31, 12, 23, 12, 23, 12, 23, 12, 23, 22, 22, 22, 22, 7, 20,
+    22, 22, 0, 22, 22, 0, 0, 0, 0, 0, 62, 62, 22, 22, 22, 0,
+    22, 22, 12, 22, 22, 22, 22, 22, 22, 22, 22, 0, 22, 0, 22, 22,
+    0, 0, 0, 7, 7, 12, 13, 12, 13, 12, 13, 12, 13, 22, 0, 0,
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 85, 85, 85, 85, 85,
+    85, 85, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    85, 85, 85, 85, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    86, 77, 77, 85, 85, 87, 85, 85, 76, 77, 76, 77, 76, 77, 76, 77,
+    76, 77, 85, 85, 76, 77, 76, 77, 76, 77, 76, 77, 88, 76, 77, 77,
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 89, 89, 89, 89, 89, 89,
+    75, 90, 90, 90, 90, 91, 85, 85, 85, 85, 85, 87, 87, 75, 85, 56,
+    0, 88, 85, 88, 85, 88, 85, 88, 85, 88, 85, 85, 85, 85, 85, 85,
+    85, 85, 85, 88, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+    85, 85, 85, 88, 85, 88, 85, 88, 85, 85, 85, 85, 85, 85, 88, 85,
+    85, 85, 85, 85, 85, 88, 88, 0, 0, 89, 89, 92, 92, 88, 88, 85,
+    92, 92, 90, 92, 90, 92, 90, 92, 90, 92, 90, 90, 90, 90, 90, 90,
+    90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+    90, 90, 90, 92, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+    90, 90, 90, 92, 90, 92, 90, 92, 90, 90, 90, 90, 90, 90, 92, 90,
+    90, 90, 90, 90, 90, 92, 92, 90, 90, 90, 90, 88, 92, 92, 92, 90,
+    0, 0, 0, 0, 0, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+    93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+    0, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+    93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 0,
+    85, 85, 85, 85, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85,
+    92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92,
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0,
+    85, 85, 85, 85, 85, 85, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0,
+    85, 85, 85, 85, 85, 85, 85, 75, 85, 75, 85, 85, 85, 85, 85, 85,
+    90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 85,
+    90, 90, 90, 90, 90, 90, 90, 90, 85, 85, 85, 85, 85, 85, 85, 85,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    93, 93, 93, 93, 93, 87, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+    93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 0, 0, 0,
+    85, 85, 85, 85, 85, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 22, 7, 22,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 33,
+    33, 33, 33, 0, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 0, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 33, 33,
+    33, 33, 0, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 0, 20, 0, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 0,
+    0, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 33, 20, 20, 20, 33, 20, 20, 20, 20, 33, 20, 20, 20, 20,
+    20, 20, 20, 41, 41, 33, 33, 41, 0, 0, 0, 0, 33, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 29, 29, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+    41, 41, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 33, 33, 0, 0, 0, 0, 0, 0, 0, 0, 22, 22,
+    33, 33, 20, 20, 20, 20, 20, 20, 0, 0, 0, 20, 29, 20, 20, 33,
+    20, 20, 20, 20, 20, 20, 33, 33, 33, 33, 33, 33, 33, 33, 22, 22,
+    20, 20, 20, 20, 20, 20, 20, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 41, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 0, 0, 0,
+    33, 33, 33, 41, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 33, 41, 41, 33, 33, 33, 33, 41, 41, 33, 33, 41, 41,
+    54, 56, 56, 56, 56, 56, 56, 22, 22, 22, 56, 56, 56, 56, 0, 35,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 0, 0, 0, 0, 56, 56,
+    0, 0, 0, 0, 0, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 33, 33, 33, 33, 33, 33, 41,
+    41, 33, 33, 41, 41, 33, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    35, 35, 35, 33, 35, 35, 35, 35, 35, 35, 35, 35, 33, 41, 0, 0,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 0, 0, 56, 22, 22, 22,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 33, 46, 0, 0,
+    33, 0, 33, 33, 33, 0, 0, 33, 33, 0, 0, 0, 0, 0, 33, 33,
+    0, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 41, 33, 33, 41, 41,
+    22, 22, 20, 20, 20, 41, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 20, 20, 20, 20, 20, 20, 0, 0, 20, 20, 20, 20, 20, 20, 0,
+    0, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 41, 41, 33, 41, 41, 33, 41, 41, 22, 41, 33, 0, 0,
+    94, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+    95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 94, 95, 95, 95,
+    95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+    95, 95, 95, 95, 95, 95, 95, 95, 94, 95, 95, 95, 95, 95, 95, 95,
+    95, 95, 95, 95, 94, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+    95, 95, 95, 95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    48, 48, 48, 48, 48, 48, 48, 0, 0, 0, 0, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 0, 0, 0, 0,
+    0, 0, 0, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0, 36, 33, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 0, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 0, 36, 36, 36, 36, 36, 0, 36, 0,
+    36, 36, 0, 36, 36, 0, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    20, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 23, 12,
+    20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 10, 0, 0, 0,
+    77, 77, 77, 96, 88, 97, 97, 76, 77, 98, 0, 0, 0, 0, 0, 0,
+    34, 33, 34, 33, 34, 33, 34, 34, 33, 34, 33, 34, 33, 34, 34, 33,
+    85, 85, 85, 99, 99, 76, 77, 76, 77, 76, 77, 76, 77, 76, 77, 76,
+    77, 76, 77, 76, 77, 85, 85, 76, 77, 85, 85, 85, 85, 99, 99, 99,
+    100, 85, 101, 0, 102, 96, 97, 97, 85, 76, 77, 76, 77, 76, 77, 85,
+    85, 85, 85, 85, 85, 85, 85, 0, 85, 73, 103, 85, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 70,
+    0, 97, 85, 85, 73, 103, 85, 104, 76, 77, 85, 85, 100, 85, 101, 85,
+    105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 96, 102, 85, 85, 85, 97,
+    85, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+    93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 76, 85, 77, 85, 99,
+    93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 76, 85, 77, 85, 76,
+    77, 77, 76, 77, 77, 88, 90, 92, 92, 92, 92, 92, 92, 92, 92, 92,
+    92, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+    90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 106, 106,
+    0, 0, 93, 93, 93, 93, 93, 93, 0, 0, 93, 93, 93, 93, 93, 93,
+    0, 0, 93, 93, 93, 93, 93, 93, 0, 0, 93, 93, 93, 0, 0, 0,
+    103, 73, 85, 85, 85, 73, 73, 0, 81, 81, 81, 81, 81, 81, 81, 0,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 38, 38, 38, 107, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 20, 20, 0, 20,
+    22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 33, 33, 33, 33, 33, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 22,
+    20, 20, 20, 20, 0, 0, 0, 0, 20, 20, 20, 20, 20, 20, 20, 20,
+    22, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0,
+    20, 20, 20, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 0, 20, 20, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 0, 20, 20, 20, 20, 20, 20, 20, 0, 20, 20, 0, 0, 0,
+    20, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 0, 0, 20, 0, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 0, 20, 20, 0, 0, 0, 20, 0, 0, 20,
+    20, 20, 20, 20, 20, 20, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 0, 20, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22,
+    20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0, 0, 20, 20,
+    20, 33, 33, 33, 0, 33, 33, 0, 0, 0, 0, 0, 33, 33, 33, 33,
+    20, 20, 20, 20, 0, 20, 20, 20, 0, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 0, 0, 33, 33, 33, 0, 0, 0, 0, 33,
+    22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 33, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 22, 22, 22, 22, 22, 66, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22,
+    20, 20, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 33, 33, 33, 33, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 0, 0, 0, 33, 33, 33, 33, 33, 22, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 33, 33, 22, 0, 0,
+    0, 0, 20, 20, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 33, 33, 33,
+    0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 33, 33, 33, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    41, 33, 41, 108, 108, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 54, 22, 22, 56, 56, 56, 56, 56, 0, 0,
+    0, 0, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 56, 56, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    33, 53, 53, 33, 33, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34,
+    41, 41, 41, 33, 33, 33, 33, 41, 41, 33, 33, 0, 0, 37, 22, 22,
+    22, 22, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 0, 0,
+    33, 33, 33, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 33, 33, 33, 33, 33, 41, 33, 33, 33,
+    33, 33, 33, 33, 33, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    22, 22, 22, 22, 20, 41, 41, 20, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 33, 0, 29, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 41, 41, 41, 33, 33, 33, 33, 33, 33, 33, 33, 33, 41,
+    33, 20, 40, 40, 20, 22, 22, 0, 22, 33, 33, 33, 33, 0, 41, 33,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 20, 29, 20, 22, 22, 22,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 41, 41, 41, 33,
+    33, 33, 41, 41, 33, 33, 33, 33, 22, 22, 0, 22, 22, 0, 33, 20,
+    20, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 0, 20, 0, 20, 20, 20, 20, 0, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 22, 0, 0, 0, 0, 0, 0,
+    41, 41, 41, 33, 33, 33, 33, 33, 33, 33, 33, 0, 0, 0, 0, 0,
+    33, 33, 41, 41, 0, 53, 53, 53, 53, 53, 53, 53, 53, 0, 0, 53,
+    53, 0, 0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 0, 53, 53, 53, 53, 53, 53,
+    53, 0, 53, 53, 0, 53, 53, 53, 53, 53, 0, 33, 33, 35, 33, 41,
+    33, 41, 41, 41, 41, 0, 0, 41, 41, 0, 0, 41, 41, 54, 0, 0,
+    57, 0, 0, 0, 0, 0, 0, 33, 0, 0, 0, 0, 0, 35, 57, 57,
+    53, 53, 41, 41, 0, 0, 33, 33, 33, 33, 33, 33, 33, 0, 0, 0,
+    33, 33, 33, 33, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 0, 57, 0, 0, 57, 0,
+    57, 57, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 0, 109, 33, 41, 41, 33, 33, 33, 33, 33,
+    33, 0, 33, 0, 0, 33, 0, 33, 33, 33, 41, 0, 41, 41, 33, 33,
+    54, 110, 33, 109, 56, 56, 0, 56, 56, 0, 0, 0, 0, 0, 0, 0,
+    0, 33, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 41, 41, 41, 33, 33, 33, 33, 33, 33, 33, 33,
+    41, 41, 33, 33, 33, 41, 33, 20, 20, 20, 20, 22, 22, 22, 22, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 22, 22, 0, 0, 33, 20,
+    33, 41, 41, 33, 33, 33, 33, 33, 33, 41, 33, 41, 41, 33, 41, 33,
+    33, 41, 33, 33, 20, 20, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0,
+    41, 41, 33, 33, 33, 33, 0, 0, 41, 41, 41, 41, 33, 33, 41, 33,
+    33, 29, 22, 22, 7, 7, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 20, 20, 20, 20, 33, 33, 0, 0,
+    41, 41, 41, 33, 33, 33, 33, 33, 33, 33, 33, 41, 41, 33, 41, 33,
+    33, 22, 22, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 33, 41, 33, 41, 41,
+    33, 33, 33, 33, 33, 33, 33, 33, 20, 0, 0, 0, 0, 0, 0, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 41, 33,
+    46, 46, 33, 33, 33, 33, 41, 33, 33, 33, 33, 33, 0, 0, 0, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 22, 22, 22, 0,
+    33, 33, 33, 33, 33, 33, 33, 33, 41, 33, 33, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20,
+    53, 53, 53, 53, 53, 53, 53, 0, 0, 53, 0, 0, 53, 53, 53, 53,
+    53, 53, 53, 53, 0, 53, 53, 0, 53, 53, 53, 53, 53, 53, 53, 53,
+    33, 41, 41, 41, 41, 41, 0, 41, 41, 0, 0, 33, 33, 33, 54, 110,
+    41, 110, 41, 33, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 20, 20, 20, 20, 20, 20,
+    20, 41, 41, 41, 33, 33, 33, 33, 0, 0, 33, 33, 41, 41, 41, 41,
+    33, 20, 29, 20, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 20, 20, 20, 20, 20,
+    20, 20, 20, 33, 33, 33, 33, 33, 33, 41, 40, 33, 33, 33, 33, 29,
+    0, 22, 22, 22, 22, 29, 0, 33, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 33, 33, 33, 33, 33, 33, 41, 41, 33, 33, 33, 20, 20, 20, 20,
+    20, 20, 20, 20, 40, 40, 40, 40, 40, 40, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 41, 33, 33, 22, 22, 22, 20, 29, 29,
+    29, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 41,
+    33, 33, 33, 33, 33, 33, 33, 0, 33, 33, 33, 33, 33, 33, 41, 33,
+    20, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29, 7, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    0, 0, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 33, 0, 41, 33, 33, 33, 33, 33, 33,
+    33, 41, 33, 33, 41, 33, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 0, 20, 20, 0, 20, 20, 20, 20, 20,
+    20, 33, 33, 33, 33, 33, 33, 0, 0, 0, 33, 0, 33, 33, 0, 33,
+    33, 33, 33, 33, 33, 33, 40, 33, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 0, 20, 20, 0, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 41, 41, 41, 41, 41, 0,
+    33, 33, 0, 41, 41, 33, 41, 33, 20, 0, 0, 0, 0, 0, 0, 0,
+    57, 57, 35, 33, 33, 41, 41, 22, 22, 0, 0, 0, 0, 0, 0, 0,
+    33, 33, 110, 41, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 41, 41, 33, 33, 33, 33, 33, 0, 0, 0, 41, 41,
+    33, 33, 54, 22, 22, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 33, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10,
+    10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22,
+    22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 20, 111, 111, 111, 112, 112, 112, 20, 20,
+    20, 20, 112, 20, 20, 20, 111, 112, 111, 112, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 111, 112, 112, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 111,
+    52, 52, 52, 52, 52, 52, 52, 113, 114, 52, 52, 52, 113, 114, 113, 114,
+    33, 20, 20, 20, 20, 20, 20, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 111, 112,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 41, 41, 41, 33, 33, 33,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 22, 22,
+    33, 33, 33, 33, 33, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    33, 33, 33, 33, 33, 33, 33, 22, 22, 22, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0, 20, 20, 20,
+    20, 20, 20, 115, 20, 20, 20, 115, 115, 115, 115, 20, 20, 0, 22, 22,
+    0, 0, 0, 0, 0, 0, 0, 22, 22, 0, 0, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 33,
+    20, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 0, 0, 0, 0, 0, 0, 0, 33,
+    87, 87, 88, 87, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    89, 89, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    81, 81, 81, 81, 81, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81,
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 0, 0, 0, 0, 0, 0,
+    117, 117, 117, 117, 0, 117, 117, 117, 117, 117, 117, 117, 0, 117, 117, 0,
+    90, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+    90, 90, 90, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 88, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    88, 88, 88, 0, 0, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 92, 92, 92, 92, 0, 0, 0, 0, 0, 0, 0, 0,
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 33, 33, 22,
+    38, 38, 38, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 0, 0,
+    33, 33, 33, 33, 33, 33, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 33, 33, 33, 33, 33, 0, 0, 0, 33, 33, 33,
+    33, 33, 33, 38, 38, 38, 38, 38, 38, 38, 38, 33, 33, 33, 33, 33,
+    33, 33, 33, 0, 0, 33, 33, 33, 33, 33, 33, 33, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 33, 33, 33, 0, 0,
+    0, 0, 33, 33, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    81, 81, 81, 81, 81, 81, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 20, 0, 0, 20, 20, 0, 0, 20, 20, 20, 20, 0, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 20, 0, 20, 20, 20,
+    20, 20, 20, 20, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 0, 20, 20, 20, 20, 0, 0, 20, 20, 20,
+    20, 20, 20, 20, 20, 0, 20, 20, 20, 20, 20, 20, 20, 0, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 20, 20, 20, 20, 0,
+    20, 20, 20, 20, 20, 0, 20, 0, 0, 0, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 0, 0, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 0, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 18, 18,
+    33, 33, 33, 33, 33, 33, 33, 0, 0, 0, 0, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 0, 0, 0,
+    0, 0, 0, 0, 33, 0, 0, 22, 22, 22, 22, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 33, 33, 33, 33,
+    0, 0, 0, 0, 0, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0,
+    33, 33, 33, 33, 33, 33, 33, 0, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 0, 0, 33, 33, 33, 33, 33,
+    33, 33, 0, 33, 33, 0, 33, 33, 33, 33, 33, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33,
+    33, 33, 33, 33, 33, 33, 33, 20, 20, 20, 20, 20, 20, 20, 0, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 20, 0,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 33, 0,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 33, 33, 33, 33,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 9,
+    20, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 0, 20, 20, 20, 20, 0, 20, 20, 0,
+    20, 20, 20, 20, 33, 33, 33, 33, 33, 33, 33, 20, 0, 0, 0, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 12, 12,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0,
+    0, 20, 20, 0, 20, 0, 0, 20, 0, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 0, 20, 20, 20, 20, 0, 20, 0, 20, 0, 0, 0, 0,
+    0, 0, 20, 0, 0, 0, 0, 20, 0, 20, 0, 20, 0, 20, 20, 20,
+    0, 20, 20, 0, 20, 0, 0, 20, 0, 20, 0, 20, 0, 20, 0, 20,
+    0, 20, 20, 0, 20, 0, 0, 20, 20, 20, 20, 0, 20, 20, 20, 20,
+    20, 20, 20, 0, 20, 20, 20, 20, 0, 20, 20, 20, 20, 0, 20, 0,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 20, 20, 20, 20, 20,
+    0, 20, 20, 20, 0, 20, 20, 20, 20, 20, 0, 20, 20, 20, 20, 20,
+    79, 79, 79, 79, 75, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 118, 118, 118, 118,
+    79, 79, 79, 79, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 118,
+    118, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    118, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 75,
+    79, 79, 79, 79, 79, 79, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 26, 26,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 26, 26, 26, 26,
+    74, 74, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 74, 74,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 78, 0,
+    0, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 118, 118,
+    118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118,
+    118, 118, 118, 118, 118, 118, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+    119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+    85, 75, 75, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118,
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 75, 85, 85, 85, 85, 85,
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 75,
+    85, 85, 75, 75, 75, 75, 75, 75, 75, 75, 75, 85, 118, 118, 118, 118,
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 118, 118, 118, 118, 118, 118, 118,
+    75, 75, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118,
+    75, 75, 75, 75, 75, 75, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118,
+    75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+    75, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 75, 75, 75,
+    75, 75, 75, 75, 75, 75, 79, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+    75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 79, 75, 75,
+    75, 75, 75, 75, 75, 82, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+    75, 75, 75, 75, 79, 79, 79, 79, 79, 79, 79, 79, 26, 26, 79, 79,
+    75, 75, 75, 75, 75, 78, 78, 75, 75, 75, 75, 75, 78, 75, 75, 75,
+    75, 75, 82, 82, 82, 75, 75, 82, 75, 75, 82, 80, 80, 79, 79, 75,
+    75, 75, 75, 75, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    75, 79, 79, 79, 75, 79, 79, 79, 75, 75, 75, 120, 120, 120, 120, 120,
+    75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 79,
+    75, 79, 82, 82, 75, 75, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+    75, 75, 75, 75, 75, 75, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 75, 75, 75, 82, 75, 75, 75,
+    75, 82, 82, 82, 75, 82, 82, 82, 75, 75, 75, 75, 75, 75, 75, 82,
+    75, 82, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+    78, 75, 78, 75, 78, 75, 75, 75, 75, 75, 82, 75, 75, 75, 75, 78,
+    75, 78, 78, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+    75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 79, 79, 75,
+    78, 78, 78, 78, 78, 78, 78, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+    75, 75, 75, 75, 75, 75, 75, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+    78, 78, 78, 78, 78, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+    75, 75, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 0, 0,
+    0, 0, 0, 0, 0, 0, 26, 26, 26, 26, 79, 75, 75, 75, 75, 79,
+    75, 75, 75, 75, 75, 75, 75, 75, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 80, 80, 79, 79, 79, 79, 82, 79, 79, 79, 79, 79,
+    80, 79, 79, 79, 79, 82, 82, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 26, 26, 26, 26, 26, 26, 26, 26, 79, 79, 79, 79,
+    79, 79, 79, 79, 26, 26, 26, 26, 26, 26, 79, 75, 75, 75, 75, 75,
+    75, 75, 75, 75, 75, 82, 82, 82, 75, 75, 75, 82, 82, 82, 82, 82,
+    0, 0, 0, 0, 0, 0, 83, 83, 83, 51, 51, 51, 0, 0, 0, 0,
+    75, 75, 75, 82, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+    75, 75, 75, 75, 82, 82, 82, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+    82, 75, 75, 75, 75, 75, 79, 79, 79, 79, 79, 79, 82, 79, 79, 79,
+    75, 75, 75, 79, 79, 75, 75, 75, 118, 118, 118, 118, 75, 75, 75, 75,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 75, 75, 118, 118, 118,
+    79, 79, 79, 79, 75, 75, 75, 75, 75, 75, 75, 75, 75, 118, 118, 118,
+    0, 0, 0, 0, 79, 79, 79, 118, 118, 118, 118, 79, 79, 79, 79, 79,
+    0, 0, 0, 0, 0, 79, 79, 79, 79, 79, 118, 118, 118, 118, 118, 118,
+    75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 118, 118, 118, 118,
+    75, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 121, 121, 121, 121,
+    0, 0, 0, 0, 0, 0, 0, 0, 121, 121, 121, 121, 121, 121, 121, 121,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 121, 121, 121, 121, 121, 121,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 121, 121,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 121, 121, 121, 121,
+    26, 26, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+    121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 82, 75, 75, 82,
+    75, 75, 75, 75, 75, 75, 75, 75, 82, 82, 82, 82, 82, 82, 82, 82,
+    75, 75, 75, 75, 75, 75, 82, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 75, 56, 82, 82, 82, 75,
+    75, 75, 75, 75, 75, 75, 56, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+    75, 75, 75, 75, 75, 75, 75, 82, 75, 75, 75, 75, 75, 75, 75, 75,
+    75, 75, 75, 75, 75, 82, 82, 75, 82, 82, 75, 82, 75, 75, 75, 75,
+    75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 82, 82, 82,
+    75, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 75, 75,
+    26, 26, 26, 26, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 118, 118,
+    75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 118, 118, 118,
+    75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 118, 118, 118, 118, 118, 75,
+    75, 75, 75, 82, 82, 82, 75, 118, 118, 118, 118, 118, 118, 118, 75, 75,
+    75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 118, 118, 75,
+    75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 118, 118, 118, 118, 118, 118,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 118, 118, 118, 118, 118, 118, 118,
+    118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 0, 0,
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 0,
+    72, 38, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+};
+
+// {grapheme_break, word_break, line_break, flags}
+static const uint8_t gp_break_records[122][4] = {
+    {0,0,0,0}, {3,0,4,0}, {3,0,12,0}, {2,2,3,0}, {3,3,1,0}, {1,1,2,0},
+    {0,18,9,0}, {0,0,18,0}, {0,12,22,0}, {0,0,26,0}, {0,0,25,0}, {0,11,22,0},
+    {0,0,21,0}, {0,0,17,0}, {0,15,23,0}, {0,0,14,0}, {0,13,23,0}, {0,0,27,0},
+    {0,16,24,0}, {0,14,23,0}, {0,10,0,0}, {0,17,0,0}, {0,0,12,0}, {0,0,16,0},
+    {3,3,5,0}, {0,0,8,0}, {0,0,0,1}, {0,0,22,64}, {3,7,12,0}, {0,0,13,0},
+    {0,14,0,0}, {0,0,22,128}, {0,10,13,0}, {4,4,4,16}, {4,4,8,16}, {0,10,12,0},
+    {0,9,32,0}, {7,16,24,0}, {3,7,4,0}, {0,15,24,0}, {7,10,0,0}, {8,4,4,0},
+    {0,10,0,8}, {4,4,4,32}, {8,0,0,0}, {8,4,12,0}, {0,4,4,0}, {9,10,34,2},
+    {10,10,35,0}, {11,10,36,0}, {0,18,12,0}, {0,0,20,0}, {3,7,8,0}, {0,10,38,0},
+    {4,4,42,16}, {0,16,40,0}, {0,0,33,0}, {0,10,40,0}, {4,4,41,16}, {3,0,7,0},
+    {4,4,4,0}, {5,5,10,16}, {0,0,11,0}, {0,13,22,64}, {0,13,22,128}, {0,13,19,0},
+    {0,0,19,0}, {0,14,12,0}, {0,17,8,0}, {0,0,20,1}, {3,7,6,0}, {3,7,0,0},
+    {3,0,0,0}, {0,0,26,2}, {0,10,0,1}, {0,0,33,3}, {0,0,21,2}, {0,0,16,2},
+    {0,0,0,3}, {0,0,33,1}, {0,0,28,1}, {0,0,0,2}, {0,0,28,3}, {0,0,22,0},
+    {0,0,18,1}, {0,0,33,2}, {0,18,12,2}, {0,10,20,2}, {0,0,20,2}, {4,4,4,18},
+    {0,8,33,2}, {0,8,4,2}, {0,8,20,2}, {0,10,33,2}, {12,10,30,2}, {13,10,31,2},
+    {0,14,20,2}, {0,0,18,2}, {0,0,19,2}, {0,17,33,2}, {0,15,16,2}, {0,13,16,2},
+    {0,15,20,2}, {0,0,25,2}, {0,13,33,2}, {0,16,33,2}, {4,4,20,18}, {0,0,15,0},
+    {0,10,39,0}, {0,10,33,0}, {7,10,39,0}, {0,10,21,0}, {0,10,16,0}, {3,7,21,0},
+    {3,7,16,0}, {10,10,0,0}, {4,4,8,18}, {0,8,0,2}, {0,0,33,5}, {6,6,37,0},
+    {4,4,29,18}, {0,0,0,5},
+};
+
+#endif // GP_BREAK_TABLE_H
@@ -332,6 +332,126 @@ size_t gp_bytes_replace(
         replacement_length);
 }
 
+size_t gp_internal_bytes_find_all(
+    GPArray(GPInternalMatch)*const    matches,
+    const void*const                  _haystack,
+    const size_t                      haystack_length,
+    const GPInternalReplacement*const replacements,
+    const size_t                      replacements_length)
+{
+    const uint8_t* haystack = _haystack;
+    size_t out_length = haystack_length;
+
+    if (replacements_length == 1) // memmem() is hard to beat
+    {
+        const GPInternalReplacement r = replacements[0];
+        gp_db_assert(r.needle_length > 0, "Empty needle.");
+        for (size_t i = 0;
+            (i = gp_bytes_find_first(haystack, haystack_length, r.needle, r.needle_length, i))
+                != GP_NOT_FOUND;
+            i += r.needle_length)
+        {
+            const GPInternalMatch match = { .position = i, .replacement_index = 0 };
+            gp_arr_push(sizeof match, matches, &match);
+            out_length += r.replacement_length - r.needle_length;
+        }
+        return out_length;
+    }
+
+    bool first_bytes[256] = {0};
+    for (size_t j = 0; j < replacements_length; ++j) {
+        gp_db_assert(replacements[j].needle_length > 0, "Empty needle.");
+        first_bytes[*(const uint8_t*)replacements[j].needle] = true;
+    }
+    for (size_t i = 0; i < haystack_length; )
+    {
+        if ( ! first_bytes[haystack[i]]) {
+            ++i;
+            continue;
+        }
+        size_t j = 0;
+        for (; j < replacements_length; ++j)
+            if (replacements[j].needle_length <= haystack_length - i
+                && memcmp(haystack + i, replacements[j].needle, replacements[j].needle_length) == 0)
+                break;
+        if (j == replacements_length) {
+            ++i;
+            continue;
+        }
+        const GPInternalMatch match = { .position = i, .replacement_index = j };
+        gp_arr_push(sizeof match, matches, &match);
+        out_length += replacements[j].replacement_length - replacements[j].needle_length;
+        i += replacements[j].needle_length;
+    }
+    return out_length;
+}
+
+void gp_internal_bytes_replace_matches(
+    void*const                           _haystack,
+    const size_t                         haystack_length,
+    const size_t                         capacity,
+    const size_t                         out_length,
+    const GPInternalReplacement*const    replacements,
+    const GPArray(GPInternalMatch)       matches)
+{
+    uint8_t* haystack = _haystack;
+    const size_t matches_length = gp_arr_length(matches);
+    bool shrinking = true;
+    bool growing   = true;
+    for (size_t i = 0; i < matches_length; ++i) {
+        const GPInternalReplacement* r = &replacements[matches[i].replacement_index];
+        shrinking &= r->replacement_length <= r->needle_length;
+        growing   &= r->replacement_length >= r->needle_length;
+    }
+
+    if (shrinking) // write position never passes read position
+    {
+        size_t in = 0, out = 0;
+        for (size_t i = 0; i < matches_length; ++i)
+        {
+            const GPInternalReplacement* r = &replacements[matches[i].replacement_index];
+            memmove(haystack + out, haystack + in, matches[i].position - in);
+            out += matches[i].position - in;
+            memcpy(haystack + out, r->replacement, r->replacement_length);
+            out += r->replacement_length;
+            in   = matches[i].position + r->needle_length;
+        }
+        memmove(haystack + out, haystack + in, haystack_length - in);
+    }
+    else if (growing && out_length <= capacity) // same backwards
+    {
+        size_t in = haystack_length, out = out_length;
+        for (size_t i = matches_length - 1; i != (size_t)-1; --i)
+        {
+            const GPInternalReplacement* r = &replacements[matches[i].replacement_index];
+            const size_t tail = in - (matches[i].position + r->needle_length);
+            out -= tail;
+            memmove(haystack + out, haystack + in - tail, tail);
+            out -= r->replacement_length;
+            memcpy(haystack + out, r->replacement, r->replacement_length);
+            in = matches[i].position;
+        }
+    }
+    else // mixed or truncated, build to scratch and copy once
+    {
+        GPArena* scratch = gp_scratch_arena();
+        uint8_t* result = gp_mem_alloc(&scratch->base, out_length);
+        size_t in = 0, out = 0;
+        for (size_t i = 0; i < matches_length; ++i)
+        {
+            const GPInternalReplacement* r = &replacements[matches[i].replacement_index];
+            memcpy(result + out, haystack + in, matches[i].position - in);
+            out += matches[i].position - in;
+            memcpy(result + out, r->replacement, r->replacement_length);
+            out += r->replacement_length;
+            in   = matches[i].position + r->needle_length;
+        }
+        memcpy(result + out, haystack + in, haystack_length - in);
+        memcpy(haystack, result, gp_min(out_length, capacity));
+        gp_arena_rewind(scratch, result);
+    }
+}
+
 size_t gp_bytes_replace_all(
     void*restrict haystack,
     size_t haystack_length,
@@ -341,25 +461,21 @@ size_t gp_bytes_replace_all(
     const size_t replacement_length,
     size_t* optional_replacement_count)
 {
-    size_t start = 0;
-    size_t replacement_count = 0;
-    while ((start = gp_bytes_find_first(haystack, haystack_length, needle, needle_length, start))
-        != GP_NOT_FOUND)
-    {
-        haystack_length = gp_bytes_replace_range(
-            haystack,
-            haystack_length,
-            start,
-            start + needle_length,
-            replacement,
-            replacement_length);
+    const GPInternalReplacement r = {
+        needle, needle_length, replacement, replacement_length };
+    GPArray(GPInternalMatch) matches = gp_arr_new(
+        sizeof matches[0], &gp_scratch_arena()->base, 32);
+    void* scratch_position = gp_arr_allocation(matches);
+
+    const size_t out_length = gp_internal_bytes_find_all(
+        &matches, haystack, haystack_length, &r, 1);
+    gp_internal_bytes_replace_matches(
+        haystack, haystack_length, SIZE_MAX, out_length, &r, matches);
 
-        start += replacement_length;
-        replacement_count++;
-    }
     if (optional_replacement_count != NULL)
-        *optional_replacement_count = replacement_count;
-    return haystack_length;
+        *optional_replacement_count = gp_arr_length(matches);
+    gp_arena_rewind(gp_scratch_arena(), scratch_position);
+    return out_length;
 }
 
 size_t gp_internal_bytes_print(
@@ -55,92 +55,6 @@ bool gp_internal_bytes_is_valid_codepoint(
     return false;
 }
 
-size_t gp_internal_bytes_codepoint_count(
-    const void* _str,
-    const size_t n)
-{
-    size_t count = 0;
-    const unsigned char* str = _str;
-
-    static const uint16_t sizes[] = {
-        1,1,1,1,1,1,1,1, 1,1,1,1,1,1,1,1,
-        1,1,1,1,1,1,1,1, 2,2,2,2,3,3,4,1 };
-
-    for (size_t cplen, i = 0; i < n; ++count, i += cplen) {
-        cplen = sizes[str[i] >> 3];
-        for (size_t j = i + 1; j < gp_min(i + cplen, n); ++j) {
-            if ((str[j] &~ 0x3F) != 0x80) {
-                cplen = j - i;
-                break;
-            }
-        }
-    }
-    return count;
-
-    // Highly optimized code below. It simply counts all starting bytes in
-    // parallel. This means that even most invalid sequences are handled
-    // correctly, except that it doesn't count codepoints that start with
-    // continuation bytes like we expect in many other functions. Now this is
-    // dead code, but we'll leave it here, because surely it is useful
-    // somewhere? Also, wait, the above one is surely very fast too, is this
-    // crazyness really that much faster??? Benchmark and remove this comment! // TODO
-
-    static const unsigned valid_leading_nibble[] = {
-        1,1,1,1, 1,1,1,1, 0,0,0,0, 1,1,1,1
-    };
-    if (n <= 8) // Not worth optimizing. Also GCC miscompiles small string
-    {           // inputs with the optimized code using -O3 in x86_64 Linux.
-        for (size_t i = 0; i < n; ++i)
-            count += valid_leading_nibble[(uint8_t)*(str + i) >> 4];
-        return count;
-    }
-    // else process in parallel
-
-    const size_t align_offset = (uintptr_t)str     & 7;
-    const size_t remaining    = (n - align_offset) & 7;
-    size_t i = 0;
-
-    for (size_t len = gp_min(align_offset, n); i < len; ++i)
-        count += valid_leading_nibble[(uint8_t)*(str + i) >> 4];
-
-    for (; i < n - remaining; i += 8)
-    {
-        // Read 8 bytes to be processed in parallel
-        uint64_t x;
-        memcpy(&x, str + i, sizeof x);
-
-        // Extract bytes that start with 0b10
-        const uint64_t a =   x & 0x8080808080808080llu;
-        const uint64_t b = (~x & 0x4040404040404040llu) << 1;
-
-        // Each byte in c is either 0 or 0b10000000
-        uint64_t c = a & b;
-
-        uint32_t bit_count;
-        #ifdef __clang__ // only Clang seems to benefit from popcount()
-        bit_count = __builtin_popcountll(c);
-        #else
-        //https://graphics.stanford.edu/~seander/bithacks.html#CountBitsSetParallel
-        uint32_t v0 = c & 0xffffffffllu;
-        uint32_t v1 = c >> 32;
-
-        v0 = v0 - (v0 >> 1);
-        v0 = (v0 & 0x33333333) + ((v0 >> 2) & 0x33333333);
-        bit_count = (((v0 + (v0 >> 4)) & 0xF0F0F0F) * 0x1010101) >> 24;
-
-        v1 = v1 - (v1 >> 1);
-        v1 = (v1 & 0x33333333) + ((v1 >> 2) & 0x33333333);
-        bit_count += (((v1 + (v1 >> 4)) & 0xF0F0F0F) * 0x1010101) >> 24;
-        #endif
-
-        count += 8 - bit_count;
-    }
-    for (; i < n; i++)
-        count += valid_leading_nibble[(uint8_t)*(str + i) >> 4];
-
-    return count;
-}
-
 size_t gp_internal_convert_va_arg(
     const size_t limit,
     void*restrict const out,
@@ -204,16 +118,16 @@ size_t gp_internal_convert_va_arg(
         break;
 
     case GP_TYPE_FLOAT:
-        length += pf_gtoa(limit, out, va_arg(args->list, gp_promoted_arg_float_t));
+        length += pf_hrtoa(limit, out, va_arg(args->list, gp_promoted_arg_float_t));
         break;
 
     case GP_TYPE_DOUBLE:
-        length += pf_gtoa(limit, out, va_arg(args->list, gp_promoted_arg_double_t));
+        length += pf_rtoa(limit, out, va_arg(args->list, gp_promoted_arg_double_t));
         break;
 
-    #if GP_HAS_LONG_DOUBLE // pf_Lgtoa() missing, may lose precision, but better than nothing
+    #if GP_HAS_LONG_DOUBLE
     case GP_TYPE_LONG_DOUBLE:
-        length += pf_gtoa(limit, out, va_arg(args->list, long double));
+        length += pf_Lrtoa(limit, out, va_arg(args->list, long double));
         break;
     #else
     case GP_TYPE_LONG_DOUBLE: GP_UNREACHABLE("long double not supported.");
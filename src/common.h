@@ -16,7 +16,7 @@
 #include <limits.h>
 #include <wctype.h>
 
-#define GP_FORMAT_SPECIFIERS "csSdioxXufFeEgGp"
+#define GP_FORMAT_SPECIFIERS "csSdioxXufFeEgGrpyYvq{"
 
 size_t pf_vsnprintf_consuming_no_null_termination(
     char*restrict out_buf,
@@ -24,17 +24,64 @@ size_t pf_vsnprintf_consuming_no_null_termination(
     const char* format,
     pf_va_list* args);
 
+struct pf_format;
+size_t pf_vsnprintf_compiled_consuming_no_null_termination(
+    char*restrict out_buf,
+    const size_t max_size,
+    const struct pf_format* format,
+    pf_va_list* args);
+
 void gp_internal_arena_dealloc(GPAllocator*, void*);
 void gp_internal_carena_dealloc(GPAllocator*, void*);
 
 bool gp_internal_bytes_is_valid_codepoint(const void* str, size_t i);
 
-// Input must be valid UTF-8
+// Invalid sequences are counted like stepping with
+// gp_utf8_decode_codepoint_length() truncated at unexpected non-continuation
+// bytes. Stray continuation bytes are counted as codepoints.
 GP_NONNULL_ARGS()
 size_t gp_internal_bytes_codepoint_count(
     const void* _str,
     const size_t n);
 
+typedef struct gp_internal_replacement
+{
+    const void* needle;
+    size_t      needle_length;
+    const void* replacement;
+    size_t      replacement_length;
+} GPInternalReplacement;
+
+typedef struct gp_internal_match
+{
+    size_t position;
+    size_t replacement_index;
+} GPInternalMatch;
+
+// Find all non-overlapping needles from left to right and push them to
+// matches, which should be allocated in the scratch arena. If multiple needles
+// match at the same position, the first one in replacements is chosen.
+// Returns the length of the haystack after replacing.
+GP_NONNULL_ARGS()
+size_t gp_internal_bytes_find_all(
+    GPArray(GPInternalMatch)*    matches,
+    const void*                  haystack,
+    size_t                       haystack_length,
+    const GPInternalReplacement* replacements,
+    size_t                       replacements_length);
+
+// Replace matches found by gp_internal_bytes_find_all() in a single pass. Does
+// not write past capacity, so the result is truncated if it's length is larger
+// than capacity.
+GP_NONNULL_ARGS()
+void gp_internal_bytes_replace_matches(
+    void*                          haystack,
+    size_t                         haystack_length,
+    size_t                         capacity,
+    size_t                         out_length,
+    const GPInternalReplacement*   replacements,
+    const GPArray(GPInternalMatch) matches);
+
 GP_NONNULL_ARGS()
 static inline size_t gp_internal_count_fmt_specs(const char* fmt)
 {
@@ -45,6 +92,8 @@ static inline size_t gp_internal_count_fmt_specs(const char* fmt)
             ++fmt;
         } else  { // consuming more args
             const char* fmt_spec = strpbrk(fmt, GP_FORMAT_SPECIFIERS);
+            if (fmt_spec == NULL || (*fmt_spec == '{' && strchr(fmt_spec, '}') == NULL))
+                break; // rest of format string is literal
             for (const char* c = fmt; c < fmt_spec; ++c) if (*c == '*')
                 ++i; // consume asterisks as well
             ++i;
@@ -68,6 +117,28 @@ size_t gp_internal_bytes_print_objects(
     size_t*const i,
     GPInternalReflectionData obj);
 
+// Encoding kernels shared by string encoders and printf conversions. out must
+// have room for the exact encoded length, which is also returned. Flags are the
+// same as in the corresponding gp_str_*() encoders.
+
+GP_NONNULL_ARGS()
+size_t gp_internal_hex_encode(
+    char*restrict out, const void*restrict in, size_t in_length, int flags);
+
+size_t gp_internal_base64_encoded_length(size_t in_length, int flags);
+
+GP_NONNULL_ARGS()
+size_t gp_internal_base64_encode(
+    char*restrict out, const void*restrict in, size_t in_length, int flags);
+
+GP_NONNULL_ARGS()
+size_t gp_internal_escaped_length(
+    const void* in, size_t in_length, int mode);
+
+GP_NONNULL_ARGS()
+size_t gp_internal_escape(
+    char*restrict out, const void*restrict in, size_t in_length, int mode);
+
 // It seems like every few years compilers go a bit more crazy with strict
 // aliasing. For instance, GCC 15 considers pointers to `struct A{int i;}` and
 // `struct B{int i;}` to be incompatible. What's even worse is that may_alias
@@ -2,10 +2,11 @@
 // Copyright (c) 2023 Lauri Lorenzo Fiestas
 // https://github.com/PrinssiFiestas/printf/blob/main/LICENSE.md
 
-// Currently integer conversions use naïve algorithm with integer division and
-// modulus. All major compilers optimize the expensivie div/mod out, GCC even
-// does that with -O0. However, this is not always true for GP[U]Int128, which
-// has even more expensive division, so it should be optimized. // TODO
+// Decimal integer conversions count digits first and write them from the end
+// so no reversing is needed. Digits are produced 8 at a time with few
+// multiplications, 128-bit integers are split to 19 digit chunks so only a
+// couple of expensive 128-bit divisions are needed. Other bases use naïve
+// algorithm, which is cheap since the divisions are shifts.
 
 #include <printf/conversions.h>
 #include <stdint.h>
@@ -15,11 +16,15 @@
 #include "digit_table.h"
 #include "d2fixed_full_table.h"
 #include "d2s_intrinsics.h"
+#include "pow10_128_table.h"
 #include "pfstring.h"
+#include <gpc/endian.h>
+#include <gpc/utils.h>
 
 #include <inttypes.h>
 #include <math.h>
 #include <limits.h>
+#include <float.h>
 
 #define PF_DOUBLE_MANTISSA_BITS 52
 #define PF_DOUBLE_EXPONENT_BITS 11
@@ -43,56 +48,112 @@ static void pf_str_reverse_copy(
         out[length] = '\0';
 }
 
-static inline void
-pf_append_n_digits(const uint32_t olength, uint32_t digits, char* const result);
+static const uint64_t pf_pow10[] = {
+    1ull,
+    10ull,
+    100ull,
+    1000ull,
+    10000ull,
+    100000ull,
+    1000000ull,
+    10000000ull,
+    100000000ull,
+    1000000000ull,
+    10000000000ull,
+    100000000000ull,
+    1000000000000ull,
+    10000000000000ull,
+    100000000000000ull,
+    1000000000000000ull,
+    10000000000000000ull,
+    100000000000000000ull,
+    1000000000000000000ull,
+    10000000000000000000ull,
+};
+
+static inline uint32_t pf_decimal_length(const uint64_t x)
+{ // log10(x) ~= log2(x) * 1233/4096, corrected with a single comparison
+    const uint32_t bits = 64 - gp_leading_zeros_u64(x | 1);
+    const uint32_t guess = (bits * 1233) >> 12;
+    return guess + ((x | 1) >= pf_pow10[guess]); // x | 1 makes 0 one digit
+}
 
-size_t pf_utoa(const size_t n, char* out, unsigned long long x)
+// Writes exactly 8 digits of x < 10^8 including leading zeroes. On little
+// endian, all digits are computed in parallel in a single 64-bit register:
+// first x is split to two 4 digit numbers in 32-bit lanes, then both lanes to
+// 2 digit numbers in 16-bit lanes, and finally to digits in bytes. Divisions
+// by 100 and 10 are replaced by multiplications that are exact in range.
+static inline void pf_write_8_digits(char* out, const uint32_t x)
 {
-    if (n >= 10 && x < 1000000000) // use optimized
-    {
-        const uint32_t olength = decimalLength9(x);
-        pf_append_n_digits(olength, x, out);
-        out[olength] = '\0';
-        return olength;
-    }
-
-    char buf[PF_MAX_DIGITS];
-    size_t i = 0;
-    do // write all digits from low to high
-    {
-        buf[i++] = x % 10 + '0';
-        x /= 10;
-    } while(x);
-
-    pf_str_reverse_copy(out, buf, i, n);
-    return i;
+    #if GP_ENDIAN == GP_ENDIAN_LITTLE
+    const uint64_t merged = (x / 10000) | (uint64_t)(x % 10000) << 32;
+    const uint64_t div100 = ((merged * 10486) >> 20) & 0x0000007F0000007Full;
+    const uint64_t hundreds = (merged - 100 * div100) << 16 | div100;
+    const uint64_t div10 = ((hundreds * 103) >> 10) & 0x000F000F000F000Full;
+    const uint64_t digits = (hundreds - 10 * div10) << 8 | div10;
+    const uint64_t ascii = digits | 0x3030303030303030ull;
+    memcpy(out, &ascii, sizeof ascii);
+    #else
+    const uint32_t hi = x / 10000;
+    const uint32_t lo = x % 10000;
+    memcpy(out + 0, DIGIT_TABLE + 2*(hi / 100), 2);
+    memcpy(out + 2, DIGIT_TABLE + 2*(hi % 100), 2);
+    memcpy(out + 4, DIGIT_TABLE + 2*(lo / 100), 2);
+    memcpy(out + 6, DIGIT_TABLE + 2*(lo % 100), 2);
+    #endif
 }
 
-size_t pf_itoa(size_t n, char* out, const long long ix)
+// Writes exactly length digits of x including leading zeroes if any.
+static inline void pf_write_digits(char* out, uint32_t length, uint64_t x)
 {
-    char buf[PF_MAX_DIGITS];
-    unsigned long long x = ix;
+    for (; length >= 8; length -= 8) {
+        const uint64_t q = x / 100000000;
+        pf_write_8_digits(out + length - 8, (uint32_t)(x - 100000000 * q));
+        x = q;
+    }
+    uint32_t y = (uint32_t)x;
+    for (; length >= 2; length -= 2) {
+        memcpy(out + length - 2, DIGIT_TABLE + 2*(y % 100), 2);
+        y /= 100;
+    }
+    if (length != 0)
+        out[0] = (char)('0' + y);
+}
 
-    if (ix < 0)
-    {
-        if (n > 0)
-        {
-            out[0] = '-';
-            n--;
-        }
-        out++;
-        x *= -1;
+// Copies converted digits from buf if they don't fit out.
+static size_t pf_copy_truncated(
+    char* out, const size_t n, const char* buf, const size_t length)
+{
+    if (n > length) {
+        memcpy(out, buf, length);
+        out[length] = '\0';
+    } else if (n != 0) {
+        memcpy(out, buf, n);
     }
+    return length;
+}
 
-    size_t i = 0;
-    do // write all digits from low to high
-    {
-        buf[i++] = x % 10 + '0';
-        x /= 10;
-    } while(x);
+size_t pf_utoa(const size_t n, char* out, const unsigned long long x)
+{
+    const uint32_t length = pf_decimal_length(x);
+    if (n > length) {
+        pf_write_digits(out, length, x);
+        out[length] = '\0';
+        return length;
+    }
+    char buf[PF_MAX_DIGITS];
+    pf_write_digits(buf, length, x);
+    return pf_copy_truncated(out, n, buf, length);
+}
 
-    pf_str_reverse_copy(out, buf, i, n);
-    return i + (ix < 0);
+size_t pf_itoa(size_t n, char* out, const long long ix)
+{
+    if (ix >= 0)
+        return pf_utoa(n, out, ix);
+    if (n == 0)
+        return pf_utoa(0, out, -(unsigned long long)ix) + 1;
+    out[0] = '-';
+    return pf_utoa(n - 1, out + 1, -(unsigned long long)ix) + 1;
 }
 
 size_t pf_otoa(const size_t n, char* out, unsigned long long x)
@@ -141,43 +202,39 @@ size_t pf_Xtoa(const size_t n, char* out, unsigned long long x)
 
 size_t pf_u128toa(const size_t n, char* out, GPUInt128 x)
 {
-    char buf[2*PF_MAX_DIGITS];
-    size_t i = 0;
-    do // write all digits from low to high
-    {
-        buf[i++] = gp_uint128_lo(gp_uint128_mod(x, gp_uint128(0, 10))) + '0';
-        x = gp_uint128_div(x, gp_uint128(0, 10));
-    } while(gp_uint128_not_equal(x, gp_uint128(0, 0)));
+    if (gp_uint128_hi(x) == 0)
+        return pf_utoa(n, out, gp_uint128_lo(x));
+
+    // Split to 19 digit chunks, at most 2 are needed to fit the head in 64 bits
+    const GPUInt128 pow10_19 = gp_uint128(0, pf_pow10[19]);
+    uint64_t chunks[2];
+    size_t chunks_length = 0;
+    do {
+        const GPUInt128 q = gp_uint128_div(x, pow10_19); // remainder fits 64 bits
+        chunks[chunks_length++] = gp_uint128_lo(x) - gp_uint128_lo(q) * pf_pow10[19];
+        x = q;
+    } while (gp_uint128_hi(x) != 0);
 
-    pf_str_reverse_copy(out, buf, i, n);
-    return i;
+    char buf[2*PF_MAX_DIGITS];
+    const uint64_t head = gp_uint128_lo(x);
+    size_t length = pf_decimal_length(head);
+    pf_write_digits(buf, length, head);
+    while (chunks_length > 0) {
+        pf_write_digits(buf + length, 19, chunks[--chunks_length]);
+        length += 19;
+    }
+    return pf_copy_truncated(out, n, buf, length);
 }
 
 size_t pf_i128toa(size_t n, char* out, const GPInt128 ix)
 {
-    char buf[2*PF_MAX_DIGITS];
-    GPUInt128 x = gp_uint128_i128(ix);
-
-    if (gp_int128_hi(ix) < 0)
-    {
-        if (n > 0)
-        {
-            out[0] = '-';
-            n--;
-        }
-        out++;
-        x = gp_uint128_negate(x);
-    }
-
-    size_t i = 0;
-    do // write all digits from low to high
-    {
-        buf[i++] = gp_uint128_lo(gp_uint128_mod(x, gp_uint128(0, 10))) + '0';
-        x = gp_uint128_div(x, gp_uint128(0, 10));
-    } while(gp_uint128_not_equal(x, gp_uint128(0, 0)));
-
-    pf_str_reverse_copy(out, buf, i, n);
-    return i + (gp_int128_hi(ix) < 0);
+    const GPUInt128 x = gp_uint128_i128(ix);
+    if (gp_int128_hi(ix) >= 0)
+        return pf_u128toa(n, out, x);
+    if (n == 0)
+        return pf_u128toa(0, out, gp_uint128_negate(x)) + 1;
+    out[0] = '-';
+    return pf_u128toa(n - 1, out + 1, gp_uint128_negate(x)) + 1;
 }
 
 size_t pf_o128toa(const size_t n, char* out, GPUInt128 x)
@@ -224,6 +281,600 @@ size_t pf_X128toa(const size_t n, char* out, GPUInt128 x)
     return i;
 }
 
+// int64_t elements may be accessed through uint64_t, so signed arrays are
+// converted by writing the sign and passing the magnitude to pf_utoa().
+static size_t pf_toa_array(
+    const size_t n,
+    char* out,
+    const uint64_t* arr,
+    const size_t arr_length,
+    const char* delimiter,
+    const bool is_signed)
+{
+    const size_t delimiter_length = strlen(delimiter);
+    size_t length = 0;
+    for (size_t i = 0; i < arr_length; ++i)
+    {
+        if (i != 0) {
+            if (length + delimiter_length < n)
+                memcpy(out + length, delimiter, delimiter_length);
+            else if (length < n)
+                memcpy(out + length, delimiter, n - length);
+            length += delimiter_length;
+        }
+        uint64_t x = arr[i];
+        if (is_signed && x >> 63) {
+            if (length < n)
+                out[length] = '-';
+            length += 1;
+            x = -x;
+        }
+        length += pf_utoa(n > length ? n - length : 0, out + pf_min(length, n), x);
+    }
+    if (length < n)
+        out[length] = '\0';
+    return length;
+}
+
+size_t pf_itoa_array(
+    const size_t n,
+    char* out,
+    const int64_t* arr,
+    const size_t arr_length,
+    const char* delimiter)
+{
+    return pf_toa_array(n, out, (const uint64_t*)arr, arr_length, delimiter, true);
+}
+
+size_t pf_utoa_array(
+    const size_t n,
+    char* out,
+    const uint64_t* arr,
+    const size_t arr_length,
+    const char* delimiter)
+{
+    return pf_toa_array(n, out, arr, arr_length, delimiter, false);
+}
+
+// ---------------------------------------------------------------------------
+//
+// String to number conversions
+//
+// Floats use Eisel-Lemire, which is exact for all but rare halfway cases and
+// inputs with more than 19 significant digits. Those fall back to big decimal
+// arithmetic ported from Go's strconv, which is slow but always exact.
+//
+// https://arxiv.org/abs/2101.11408
+// https://nigeltao.github.io/blog/2020/eisel-lemire.html
+// https://github.com/golang/go/blob/master/src/strconv/decimal.go
+//
+// ---------------------------------------------------------------------------
+
+static inline bool pf_is_digit(const char c)
+{
+    return (unsigned)c - '0' < 10;
+}
+
+#if GP_ENDIAN == GP_ENDIAN_LITTLE
+static inline bool pf_is_8_digits(const uint64_t v)
+{
+    return ((v & 0xF0F0F0F0F0F0F0F0ull)
+        | (((v + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4))
+        == 0x3333333333333333ull;
+}
+
+// Parse 8 ASCII digits loaded from memory in parallel by combining adjacent
+// digits, then pairs, then quads, with multiplications.
+static inline uint32_t pf_parse_8_digits(uint64_t v)
+{
+    v -= 0x3030303030303030ull;
+    v = v * 10 + (v >> 8);
+    v = ((v & 0x000000FF000000FFull) * 0x000F424000000064ull
+      + ((v >> 16) & 0x000000FF000000FFull) * 0x0000271000000001ull) >> 32;
+    return (uint32_t)v;
+}
+#endif
+
+// Accumulates up to 19 significant digits to *x. Returns number of digits
+// consumed, which may be less than available digits.
+static size_t pf_parse_19_digits(const size_t n, const char* str, uint64_t* x)
+{
+    size_t i = 0;
+    #if GP_ENDIAN == GP_ENDIAN_LITTLE
+    for (uint64_t v; n - i >= 8 && *x < 100000000000; i += 8) {
+        memcpy(&v, str + i, sizeof v);
+        if ( ! pf_is_8_digits(v))
+            break;
+        *x = *x * 100000000 + pf_parse_8_digits(v);
+    }
+    #endif
+    for (; i < n && pf_is_digit(str[i]) && *x < pf_pow10[18]; ++i)
+        *x = *x * 10 + (str[i] - '0');
+    return i;
+}
+
+static size_t pf_parse_u64(
+    const size_t n, const char* str, uint64_t* out, bool* out_of_range)
+{
+    uint64_t x = 0;
+    size_t i = pf_parse_19_digits(n, str, &x);
+    for (; i < n && pf_is_digit(str[i]); ++i) {
+        const unsigned digit = str[i] - '0';
+        if (x > (UINT64_MAX - digit) / 10) {
+            *out_of_range = true;
+            x = UINT64_MAX;
+        } else {
+            x = x * 10 + digit;
+        }
+    }
+    *out = x;
+    return i;
+}
+
+static size_t pf_parse_u128(
+    const size_t n, const char* str, GPUInt128* out, bool* out_of_range)
+{
+    size_t i = 0;
+    while (i < n && str[i] == '0')
+        ++i;
+
+    uint64_t hi = 0;
+    const size_t hi_length = pf_parse_19_digits(n - i, str + i, &hi);
+    i += hi_length;
+    GPUInt128 x = gp_uint128(0, hi);
+
+    if (hi_length == 19 && i < n && pf_is_digit(str[i])) {
+        uint64_t lo = 0;
+        const size_t lo_length = pf_parse_19_digits(pf_min(n - i, 19), str + i, &lo);
+        i += lo_length; // up to 38 digits, always fits
+        x = gp_uint128_add(gp_uint128_mul64(hi, pf_pow10[lo_length]), gp_uint128(0, lo));
+    }
+    const GPUInt128 max_div_10 = gp_uint128(0x1999999999999999, 0x9999999999999999);
+    for (; i < n && pf_is_digit(str[i]); ++i) {
+        const unsigned digit = str[i] - '0';
+        if (gp_uint128_greater_than(x, max_div_10)
+            || (gp_uint128_equal(x, max_div_10) && digit > 5)) {
+            *out_of_range = true;
+            x = gp_uint128(UINT64_MAX, UINT64_MAX);
+        } else {
+            x = gp_uint128_add(
+                gp_uint128_mul(x, gp_uint128(0, 10)), gp_uint128(0, digit));
+        }
+    }
+    *out = x;
+    return i;
+}
+
+size_t pf_atou(
+    const size_t n, const char* str, unsigned long long* out, bool* optional_out_of_range)
+{
+    const size_t sign = n > 0 && str[0] == '+';
+    if (n <= sign || ! pf_is_digit(str[sign]))
+        return 0;
+    bool out_of_range = false;
+    uint64_t x;
+    const size_t length = sign + pf_parse_u64(n - sign, str + sign, &x, &out_of_range);
+    *out = x;
+    if (optional_out_of_range != NULL)
+        *optional_out_of_range = out_of_range;
+    return length;
+}
+
+size_t pf_atoi(
+    const size_t n, const char* str, long long* out, bool* optional_out_of_range)
+{
+    const bool negative = n > 0 && str[0] == '-';
+    const size_t sign = n > 0 && (str[0] == '-' || str[0] == '+');
+    if (n <= sign || ! pf_is_digit(str[sign]))
+        return 0;
+    bool out_of_range = false;
+    uint64_t x;
+    const size_t length = sign + pf_parse_u64(n - sign, str + sign, &x, &out_of_range);
+
+    const uint64_t max = negative ? -(uint64_t)LLONG_MIN : LLONG_MAX;
+    if (x > max) {
+        out_of_range = true;
+        x = max;
+    }
+    *out = negative ? (long long)-x : (long long)x; // wraps for LLONG_MIN as intended
+    if (optional_out_of_range != NULL)
+        *optional_out_of_range = out_of_range;
+    return length;
+}
+
+size_t pf_atou128(
+    const size_t n, const char* str, GPUInt128* out, bool* optional_out_of_range)
+{
+    const size_t sign = n > 0 && str[0] == '+';
+    if (n <= sign || ! pf_is_digit(str[sign]))
+        return 0;
+    bool out_of_range = false;
+    const size_t length = sign + pf_parse_u128(n - sign, str + sign, out, &out_of_range);
+    if (optional_out_of_range != NULL)
+        *optional_out_of_range = out_of_range;
+    return length;
+}
+
+size_t pf_atoi128(
+    const size_t n, const char* str, GPInt128* out, bool* optional_out_of_range)
+{
+    const bool negative = n > 0 && str[0] == '-';
+    const size_t sign = n > 0 && (str[0] == '-' || str[0] == '+');
+    if (n <= sign || ! pf_is_digit(str[sign]))
+        return 0;
+    bool out_of_range = false;
+    GPUInt128 x;
+    const size_t length = sign + pf_parse_u128(n - sign, str + sign, &x, &out_of_range);
+
+    const GPUInt128 max = gp_uint128((uint64_t)INT64_MAX + negative, -(uint64_t)!negative);
+    if (gp_uint128_greater_than(x, max)) {
+        out_of_range = true;
+        x = max;
+    }
+    *out = gp_int128_u128(negative ? gp_uint128_negate(x) : x);
+    if (optional_out_of_range != NULL)
+        *optional_out_of_range = out_of_range;
+    return length;
+}
+
+// Returns false if result is not guaranteed to be exact, in which case the
+// slow path should be used.
+static bool pf_eisel_lemire(uint64_t mantissa, const int64_t exp10, uint64_t* bits)
+{
+    if (exp10 < PF_POW10_128_MIN_EXP10 || PF_POW10_128_MAX_EXP10 < exp10)
+        return false;
+
+    // Normalization
+    const uint32_t clz = gp_leading_zeros_u64(mantissa);
+    mantissa <<= clz;
+    // floor(log2(10^exp10)) + 64 + bias - clz
+    const int64_t log2_10_exp10 = 217706 * exp10 >= 0 ?
+        (217706 * exp10) >> 16 : -((-217706 * exp10 + 65535) >> 16);
+    uint64_t exp2 = (uint64_t)(log2_10_exp10 + 64 + PF_DOUBLE_BIAS) - clz;
+
+    // Multiplication
+    const uint64_t* pow10 = PF_POW10_128[exp10 - PF_POW10_128_MIN_EXP10];
+    uint64_t x_hi;
+    uint64_t x_lo = umul128(mantissa, pow10[1], &x_hi);
+
+    // Wider approximation
+    if ((x_hi & 0x1FF) == 0x1FF && x_lo + mantissa < mantissa)
+    {
+        uint64_t y_hi;
+        const uint64_t y_lo = umul128(mantissa, pow10[0], &y_hi);
+        uint64_t merged_hi = x_hi;
+        const uint64_t merged_lo = x_lo + y_hi;
+        merged_hi += merged_lo < x_lo;
+        if ((merged_hi & 0x1FF) == 0x1FF && merged_lo + 1 == 0 && y_lo + mantissa < mantissa)
+            return false;
+        x_hi = merged_hi;
+        x_lo = merged_lo;
+    }
+
+    // Shifting to 54 bits
+    const uint64_t msb = x_hi >> 63;
+    uint64_t result = x_hi >> (msb + 9);
+    exp2 -= 1 ^ msb;
+
+    // Halfway ambiguity
+    if (x_lo == 0 && (x_hi & 0x1FF) == 0 && (result & 3) == 1)
+        return false;
+
+    // From 54 to 53 bits
+    result += result & 1;
+    result >>= 1;
+    if (result >> 53 > 0) {
+        result >>= 1;
+        exp2 += 1;
+    }
+
+    // Subnormal, zero, or infinity
+    if (exp2 - 1 >= 0x7FF - 1)
+        return false;
+
+    *bits = exp2 << PF_DOUBLE_MANTISSA_BITS | (result & ((1ull << PF_DOUBLE_MANTISSA_BITS) - 1));
+    return true;
+}
+
+#define PF_DECIMAL_MAX_DIGITS 800
+#define PF_DECIMAL_MAX_SHIFT  60 // 9 << 60 fits 64 bits
+
+typedef struct pf_decimal
+{
+    uint8_t digits[PF_DECIMAL_MAX_DIGITS + 20]; // digit values, not characters
+    int32_t length;
+    int64_t decimal_point;
+    bool    truncated; // nonzero digits discarded past length
+} PFDecimal;
+
+static void pf_decimal_trim(PFDecimal* d)
+{
+    while (d->length > 0 && d->digits[d->length - 1] == 0)
+        d->length--;
+    if (d->length == 0)
+        d->decimal_point = 0;
+}
+
+static void pf_decimal_right_shift(PFDecimal* d, const unsigned k)
+{
+    int32_t r = 0; // read index
+    int32_t w = 0; // write index
+
+    // Pick up enough leading digits to cover first shift
+    uint64_t n = 0;
+    for (; n >> k == 0; r++)
+    {
+        if (r >= d->length) {
+            if (n == 0) {
+                d->length = 0;
+                return;
+            }
+            while (n >> k == 0) {
+                n *= 10;
+                r++;
+            }
+            break;
+        }
+        n = n * 10 + d->digits[r];
+    }
+    d->decimal_point -= r - 1;
+
+    const uint64_t mask = (1ull << k) - 1;
+    for (; r < d->length; r++) {
+        d->digits[w++] = n >> k;
+        n = (n & mask) * 10 + d->digits[r];
+    }
+    for (; n > 0; n = (n & mask) * 10) {
+        if (w < PF_DECIMAL_MAX_DIGITS)
+            d->digits[w++] = n >> k;
+        else if (n >> k > 0)
+            d->truncated = true;
+    }
+    d->length = w;
+    pf_decimal_trim(d);
+}
+
+static void pf_decimal_left_shift(PFDecimal* d, const unsigned k)
+{
+    // Write digits to the end of maximum possible length and move them to the
+    // beginning after, new digits can't exceed digits in 2^k.
+    const int32_t new_digits_max = (k * 1233 >> 12) + 1;
+    int32_t r = d->length;
+    int32_t w = d->length + new_digits_max;
+    uint64_t n = 0;
+    while (--r >= 0) {
+        n += (uint64_t)d->digits[r] << k;
+        const uint64_t q = n / 10;
+        d->digits[--w] = n - 10 * q;
+        n = q;
+    }
+    for (; n > 0; n /= 10)
+        d->digits[--w] = n % 10;
+
+    d->decimal_point += new_digits_max - w;
+    d->length += new_digits_max - w;
+    memmove(d->digits, d->digits + w, d->length);
+    for (; d->length > PF_DECIMAL_MAX_DIGITS; d->length--)
+        d->truncated |= d->digits[d->length - 1] != 0;
+    pf_decimal_trim(d);
+}
+
+static void pf_decimal_shift(PFDecimal* d, int k)
+{
+    if (d->length == 0)
+        return;
+    for (; k > PF_DECIMAL_MAX_SHIFT; k -= PF_DECIMAL_MAX_SHIFT)
+        pf_decimal_left_shift(d, PF_DECIMAL_MAX_SHIFT);
+    for (; k < -PF_DECIMAL_MAX_SHIFT; k += PF_DECIMAL_MAX_SHIFT)
+        pf_decimal_right_shift(d, PF_DECIMAL_MAX_SHIFT);
+    if (k > 0)
+        pf_decimal_left_shift(d, k);
+    else if (k < 0)
+        pf_decimal_right_shift(d, -k);
+}
+
+static uint64_t pf_decimal_rounded_integer(const PFDecimal* d)
+{
+    uint64_t n = 0;
+    int32_t i = 0;
+    for (; i < d->decimal_point && i < d->length; i++)
+        n = n * 10 + d->digits[i];
+    for (; i < d->decimal_point; i++)
+        n *= 10;
+
+    const int64_t dp = d->decimal_point;
+    bool round_up = false;
+    if (0 <= dp && dp < d->length) {
+        if (d->digits[dp] == 5 && dp + 1 == d->length) // halfway, round to even
+            round_up = d->truncated || (dp > 0 && d->digits[dp - 1] % 2 == 1);
+        else
+            round_up = d->digits[dp] >= 5;
+    }
+    return n + round_up;
+}
+
+static uint64_t pf_decimal_to_double_bits(PFDecimal* d)
+{
+    static const int powtab[] = { 1, 3, 6, 9, 13, 16, 19, 23, 26 };
+    const int powtab_length = sizeof powtab / sizeof powtab[0];
+    const int bias = -PF_DOUBLE_BIAS;
+    const uint64_t inf = (uint64_t)((1 << PF_DOUBLE_EXPONENT_BITS) - 1) << PF_DOUBLE_MANTISSA_BITS;
+
+    if (d->length == 0 || d->decimal_point < -330)
+        return 0;
+    if (d->decimal_point > 310)
+        return inf;
+
+    // Scale by powers of two until in range [0.5, 1.0)
+    int exp = 0;
+    while (d->decimal_point > 0) {
+        const int n = d->decimal_point >= powtab_length ? 27 : powtab[d->decimal_point];
+        pf_decimal_shift(d, -n);
+        exp += n;
+    }
+    while (d->decimal_point < 0 || (d->decimal_point == 0 && d->digits[0] < 5)) {
+        const int n = -d->decimal_point >= powtab_length ? 27 : powtab[-d->decimal_point];
+        pf_decimal_shift(d, n);
+        exp -= n;
+    }
+
+    // Our range is [0.5, 1) but floating point range is [1, 2)
+    exp--;
+
+    // Minimum representable exponent is bias + 1, denormalize if smaller
+    if (exp < bias + 1) {
+        pf_decimal_shift(d, -(bias + 1 - exp));
+        exp = bias + 1;
+    }
+    if (exp - bias >= (1 << PF_DOUBLE_EXPONENT_BITS) - 1)
+        return inf;
+
+    pf_decimal_shift(d, 1 + PF_DOUBLE_MANTISSA_BITS);
+    uint64_t mantissa = pf_decimal_rounded_integer(d);
+
+    // Rounding might have added a bit
+    if (mantissa == 2ull << PF_DOUBLE_MANTISSA_BITS) {
+        mantissa >>= 1;
+        exp++;
+        if (exp - bias >= (1 << PF_DOUBLE_EXPONENT_BITS) - 1)
+            return inf;
+    }
+    if ((mantissa & (1ull << PF_DOUBLE_MANTISSA_BITS)) == 0) // subnormal
+        exp = bias;
+
+    return (mantissa & ((1ull << PF_DOUBLE_MANTISSA_BITS) - 1))
+        | (uint64_t)(exp - bias) << PF_DOUBLE_MANTISSA_BITS;
+}
+
+// Digits and optional decimal point are validated by caller.
+static uint64_t pf_slow_atod_bits(
+    const char* digits, const size_t length, const int64_t exp10)
+{
+    PFDecimal d = { .length = 0 };
+    bool fraction = false;
+    for (size_t i = 0; i < length; ++i)
+    {
+        if (digits[i] == '.') {
+            fraction = true;
+            continue;
+        }
+        const uint8_t digit = digits[i] - '0';
+        if (digit == 0 && d.length == 0) { // leading zero
+            d.decimal_point -= fraction;
+            continue;
+        }
+        d.decimal_point += ! fraction;
+        if (d.length < PF_DECIMAL_MAX_DIGITS)
+            d.digits[d.length++] = digit;
+        else
+            d.truncated |= digit != 0;
+    }
+    d.decimal_point += exp10;
+    pf_decimal_trim(&d);
+    return pf_decimal_to_double_bits(&d);
+}
+
+static size_t pf_parse_inf_nan(const size_t n, const char* str, double* out)
+{
+    char lower[sizeof "infinity" - sizeof ""];
+    const size_t length = pf_min(n, sizeof lower);
+    for (size_t i = 0; i < length; ++i)
+        lower[i] = str[i] | 0x20;
+
+    if (length >= 3 && memcmp(lower, "nan", 3) == 0) {
+        *out = NAN;
+        return 3;
+    }
+    if (length >= 3 && memcmp(lower, "inf", 3) == 0) {
+        *out = INFINITY;
+        return length == 8 && memcmp(lower, "infinity", 8) == 0 ? 8 : 3;
+    }
+    return 0;
+}
+
+size_t pf_atod(
+    const size_t n, const char* str, double* out, bool* optional_out_of_range)
+{
+    const bool negative = n > 0 && str[0] == '-';
+    size_t i = n > 0 && (str[0] == '-' || str[0] == '+');
+    if (optional_out_of_range != NULL)
+        *optional_out_of_range = false;
+
+    if (i < n && ! pf_is_digit(str[i]) && str[i] != '.') {
+        double special;
+        const size_t length = pf_parse_inf_nan(n - i, str + i, &special);
+        if (length == 0)
+            return 0;
+        *out = negative ? -special : special;
+        return i + length;
+    }
+
+    // Significand. At most 19 significant digits are stored to mantissa, the
+    // rest are only used to adjust the exponent.
+    const char* digits = str + i;
+    uint64_t mantissa = 0;
+    int64_t exp10 = 0;
+    bool truncated = false;
+
+    const size_t integer_start = i;
+    i += pf_parse_19_digits(n - i, str + i, &mantissa);
+    for (; i < n && pf_is_digit(str[i]); ++i, ++exp10)
+        truncated |= str[i] != '0';
+    bool has_digits = i != integer_start;
+
+    if (i < n && str[i] == '.')
+    {
+        const size_t fraction_start = ++i;
+        i += pf_parse_19_digits(n - i, str + i, &mantissa);
+        exp10 -= i - fraction_start;
+        for (; i < n && pf_is_digit(str[i]); ++i)
+            truncated |= str[i] != '0';
+        has_digits |= i != fraction_start;
+    }
+    if ( ! has_digits)
+        return 0;
+
+    const size_t digits_length = str + i - digits;
+
+    // Exponent, not consumed if incomplete
+    int64_t exponent = 0;
+    if (i < n && (str[i] | 0x20) == 'e')
+    {
+        size_t j = i + 1;
+        const bool exp_negative = j < n && str[j] == '-';
+        j += j < n && (str[j] == '-' || str[j] == '+');
+        if (j < n && pf_is_digit(str[j]))
+        {
+            for (; j < n && pf_is_digit(str[j]); ++j)
+                if (exponent < 1000000) // past any double anyway
+                    exponent = exponent * 10 + (str[j] - '0');
+            exponent = exp_negative ? -exponent : exponent;
+            exp10 += exponent;
+            i = j;
+        }
+    }
+
+    uint64_t bits = 0;
+    if (mantissa == 0)
+        bits = 0;
+    else if (truncated) { // exact if rounding is the same for both bounds
+        uint64_t upper;
+        if ( ! pf_eisel_lemire(mantissa, exp10, &bits)
+            || ! pf_eisel_lemire(mantissa + 1, exp10, &upper)
+            || bits != upper)
+            bits = pf_slow_atod_bits(digits, digits_length, exponent);
+    }
+    else if ( ! pf_eisel_lemire(mantissa, exp10, &bits))
+        bits = pf_slow_atod_bits(digits, digits_length, exponent);
+
+    double result;
+    memcpy(&result, &bits, sizeof result);
+    if (optional_out_of_range != NULL)
+        *optional_out_of_range = isinf(result) || (result == 0. && mantissa != 0);
+    *out = negative ? -result : result;
+    return i;
+}
+
 // ---------------------------------------------------------------------------
 
 static size_t
@@ -294,6 +945,527 @@ size_t pf_strfromd(
         return pf_d2exp_buffered_n(buf, n, fmt, f);
 }
 
+// ---------------------------------------------------------------------------
+//
+// Shortest round trip conversions
+//
+// ---------------------------------------------------------------------------
+
+// Writes digits * 10^exp10 like %g, but instead of fixed precision, uses all
+// digits, which are expected to have no trailing zeros. Fixed notation is used
+// when the decimal exponent X satisfies -4 <= X < max_digits, exponential
+// otherwise, so output matches %.{max_digits}g with trailing zeros removed.
+static size_t pf_write_shortest(
+    const size_t n,
+    char* out,
+    const bool negative,
+    const char* digits,
+    const uint32_t length,
+    const int32_t exp10,
+    const int32_t max_digits)
+{
+    char buf[64];
+    size_t i = 0;
+    if (negative)
+        buf[i++] = '-';
+
+    const int32_t x = exp10 + (int32_t)length - 1;
+    if (-4 <= x && x < max_digits)
+    {
+        if (x < 0) {
+            memcpy(buf + i, "0.0000", 1 - x); // "0." and -x - 1 zeroes
+            i += 1 - x;
+            memcpy(buf + i, digits, length);
+            i += length;
+        } else if ((uint32_t)x + 1 >= length) {
+            memcpy(buf + i, digits, length);
+            i += length;
+            memset(buf + i, '0', x + 1 - length);
+            i += x + 1 - length;
+        } else {
+            memcpy(buf + i, digits, x + 1);
+            i += x + 1;
+            buf[i++] = '.';
+            memcpy(buf + i, digits + x + 1, length - x - 1);
+            i += length - x - 1;
+        }
+    }
+    else
+    {
+        buf[i++] = digits[0];
+        if (length > 1) {
+            buf[i++] = '.';
+            memcpy(buf + i, digits + 1, length - 1);
+            i += length - 1;
+        }
+        buf[i++] = 'e';
+        buf[i++] = x < 0 ? '-' : '+';
+        const uint32_t abs_x = x < 0 ? -(uint32_t)x : (uint32_t)x;
+        if (abs_x < 10)
+            buf[i++] = '0';
+        i += pf_utoa(sizeof buf - i, buf + i, abs_x);
+    }
+    return pf_copy_truncated(out, n, buf, i);
+}
+
+static size_t pf_write_shortest_inf_nan(
+    const size_t n, char* out, const bool negative, const bool is_nan)
+{
+    char buf[sizeof"-nan"];
+    size_t i = 0;
+    if (negative)
+        buf[i++] = '-';
+    memcpy(buf + i, is_nan ? "nan" : "inf", sizeof"nan"-sizeof"");
+    return pf_copy_truncated(out, n, buf, i + sizeof"nan"-sizeof"");
+}
+
+size_t pf_rtoa(const size_t n, char* out, const double f)
+{
+    if (isnan(f) || isinf(f))
+        return pf_write_shortest_inf_nan(n, out, signbit(f), isnan(f));
+
+    uint64_t mantissa;
+    int32_t  exponent;
+    d2s_decimal(f, &mantissa, &exponent);
+    for (; mantissa >= 10 && mantissa % 10 == 0; mantissa /= 10)
+        exponent++;
+
+    char digits[20];
+    const uint32_t length = pf_decimal_length(mantissa);
+    pf_write_digits(digits, length, mantissa);
+    return pf_write_shortest(n, out, signbit(f), digits, length, exponent, 17);
+}
+
+size_t pf_hrtoa(const size_t n, char* out, const float f)
+{
+    if (isnan(f) || isinf(f))
+        return pf_write_shortest_inf_nan(n, out, signbit(f), isnan(f));
+
+    uint32_t mantissa;
+    int32_t  exponent;
+    f2s_decimal(f, &mantissa, &exponent);
+    for (; mantissa >= 10 && mantissa % 10 == 0; mantissa /= 10)
+        exponent++;
+
+    char digits[20];
+    const uint32_t length = pf_decimal_length(mantissa);
+    pf_write_digits(digits, length, mantissa);
+    return pf_write_shortest(n, out, signbit(f), digits, length, exponent, 9);
+}
+
+#if GP_HAS_LONG_DOUBLE && LDBL_MANT_DIG != DBL_MANT_DIG
+
+static void pf_decimal_assign(PFDecimal* d, const GPUInt128 x)
+{
+    char buf[40];
+    d->length = pf_u128toa(sizeof buf, buf, x);
+    d->decimal_point = d->length;
+    d->truncated = false;
+    for (int32_t i = 0; i < d->length; i++)
+        d->digits[i] = buf[i] - '0';
+    pf_decimal_trim(d);
+}
+
+static void pf_decimal_round_down(PFDecimal* d, const int32_t length)
+{
+    if (length < 0 || length >= d->length)
+        return;
+    d->length = length;
+    pf_decimal_trim(d);
+}
+
+static void pf_decimal_round_up(PFDecimal* d, const int32_t length)
+{
+    if (length < 0 || length >= d->length)
+        return;
+    for (int32_t i = length - 1; i >= 0; i--) {
+        if (d->digits[i] < 9) {
+            d->digits[i]++;
+            d->length = i + 1;
+            return;
+        }
+    }
+    // All nines
+    d->digits[0] = 1;
+    d->length = 1;
+    d->decimal_point++;
+}
+
+static void pf_decimal_round(PFDecimal* d, const int32_t length)
+{
+    if (length < 0 || length >= d->length)
+        return;
+    bool round_up;
+    if (d->digits[length] == 5 && length + 1 == d->length) // halfway, round to even
+        round_up = d->truncated || (length > 0 && d->digits[length - 1] % 2 == 1);
+    else
+        round_up = d->digits[length] >= 5;
+
+    if (round_up)
+        pf_decimal_round_up(d, length);
+    else
+        pf_decimal_round_down(d, length);
+}
+
+// Round exact d = mantissa * 2^(exp - mantissa_bits) to the shortest decimal
+// that still rounds to the same binary float by comparing to the halfway points
+// between neighbouring floats. Port of roundShortest() from Go strconv.
+static void pf_decimal_round_shortest(
+    PFDecimal* d,
+    const GPUInt128 mantissa,
+    const int32_t exp,
+    const int32_t mantissa_bits,
+    const int32_t min_exp)
+{
+    const GPUInt128 one = gp_uint128(0, 1);
+    if (exp > min_exp && 332*(d->decimal_point - d->length) >= 100*(exp - mantissa_bits))
+        return; // already shortest
+
+    PFDecimal upper;
+    pf_decimal_assign(&upper, gp_uint128_add(gp_uint128_shift_left(mantissa, 1), one));
+    pf_decimal_shift(&upper, exp - mantissa_bits - 1);
+
+    GPUInt128 mantissa_lo;
+    int32_t exp_lo;
+    if (gp_uint128_greater_than(mantissa, gp_uint128_shift_left(one, mantissa_bits)) || exp == min_exp) {
+        mantissa_lo = gp_uint128_sub(mantissa, one);
+        exp_lo = exp;
+    } else { // lower neighbour is closer
+        mantissa_lo = gp_uint128_sub(gp_uint128_shift_left(mantissa, 1), one);
+        exp_lo = exp - 1;
+    }
+    PFDecimal lower;
+    pf_decimal_assign(&lower, gp_uint128_add(gp_uint128_shift_left(mantissa_lo, 1), one));
+    pf_decimal_shift(&lower, exp_lo - mantissa_bits - 1);
+
+    // Halfway points round to even mantissa, so they are valid if it is even.
+    const bool inclusive = gp_uint128_lo(mantissa) % 2 == 0;
+
+    uint8_t upper_delta = 0; // 0: equal to d so far, 1: d ends with 9s and upper 0s, 2: upper is larger
+    for (int64_t ui = 0; ; ui++)
+    {
+        const int64_t mi = ui - upper.decimal_point + d->decimal_point;
+        if (mi >= d->length)
+            break;
+        const int64_t li = ui - upper.decimal_point + lower.decimal_point;
+        const uint8_t l = 0 <= li && li < lower.length ? lower.digits[li] : 0;
+        const uint8_t m = mi >= 0 ? d->digits[mi] : 0;
+        const uint8_t u = ui < upper.length ? upper.digits[ui] : 0;
+
+        // Truncating at this digit rounds down to lower bound or above?
+        const bool ok_down = l != m
+            || (inclusive && li + 1 == lower.length && ! lower.truncated);
+
+        if (upper_delta == 0 && m + 1 < u)
+            upper_delta = 2;
+        else if (upper_delta == 0 && m != u)
+            upper_delta = 1;
+        else if (upper_delta == 1 && (m != 9 || u != 0))
+            upper_delta = 2;
+
+        // Rounding up at this digit stays below upper bound?
+        const bool ok_up = upper_delta > 0
+            && (inclusive || upper_delta > 1 || ui + 1 < upper.length);
+
+        if (ok_down && ok_up) {
+            pf_decimal_round(d, mi + 1);
+            return;
+        } else if (ok_down) {
+            pf_decimal_round_down(d, mi + 1);
+            return;
+        } else if (ok_up) {
+            pf_decimal_round_up(d, mi + 1);
+            return;
+        }
+    }
+}
+
+#if LDBL_MANT_DIG == 64
+// Returns bits [position, position + 64) of 256-bit little endian x.
+static inline uint64_t pf_get_64_bits(const uint64_t x[4], const uint32_t position)
+{
+    const uint32_t i = position / 64;
+    const uint32_t r = position % 64;
+    uint64_t bits = i < 4 ? x[i] >> r : 0;
+    if (r != 0 && i + 1 < 4)
+        bits |= x[i + 1] << (64 - r);
+    return bits;
+}
+
+// x += sign * k * (m_hi:m_lo) for k <= 2
+static inline void pf_add_scaled_128(
+    uint64_t x[4], const uint64_t m_lo, const uint64_t m_hi, const int k)
+{
+    for (int i = 0; i < (k < 0 ? -k : k); i++)
+    {
+        uint64_t limbs[4] = { m_lo, m_hi };
+        if (k < 0) { // two's complement
+            limbs[0] = ~m_lo; limbs[1] = ~m_hi; limbs[2] = limbs[3] = ~0ull;
+            limbs[0]++;
+            bool carry = limbs[0] == 0;
+            for (int j = 1; j < 4 && carry; j++)
+                carry = ++limbs[j] == 0;
+        }
+        bool carry = false;
+        for (int j = 0; j < 4; j++) {
+            const uint64_t sum = x[j] + limbs[j] + carry;
+            carry = sum < x[j] || (carry && sum == x[j]);
+            x[j] = sum;
+        }
+    }
+}
+
+// Truncated 10^q = (m_hi:m_lo) * 2^b with m_hi normalized. Powers out of range
+// of the table are multiplied from table entries. Returns upper bound of error
+// in units of m_lo.
+static uint32_t pf_pow10_128(
+    const int32_t q, uint64_t* m_lo, uint64_t* m_hi, int32_t* b)
+{
+    const int32_t step = q < 0 ? PF_POW10_128_MIN_EXP10 + 8 : PF_POW10_128_MAX_EXP10 - 7;
+    int32_t q_left = q;
+    uint32_t error = 0;
+    *m_lo = 0;
+    *m_hi = 1ull << 63; // 10^0
+    *b = -127;
+    if (0 <= q && q <= 55) // 5^55 < 2^128 so 10^q is exact
+    {
+        const uint64_t* pow10 = PF_POW10_128[q - PF_POW10_128_MIN_EXP10];
+        *m_lo = pow10[0];
+        *m_hi = pow10[1];
+        *b = ((217706 * q) >> 16) - 127;
+        return 0;
+    }
+    while (q_left != 0)
+    {
+        const int32_t factor_q = (q < 0 ? q_left < step : q_left > step) ? step : q_left;
+        q_left -= factor_q;
+        const uint64_t* pow10 = PF_POW10_128[factor_q - PF_POW10_128_MIN_EXP10];
+        const int32_t factor_b = (217706 * factor_q >= 0 ?
+            (217706 * factor_q) >> 16 : -((-217706 * factor_q + 65535) >> 16)) - 127;
+
+        // Top 128 bits of 256-bit product
+        uint64_t p0_hi, p1_hi, p2_hi, p3_hi;
+        umul128(*m_lo, pow10[0], &p0_hi);
+        const uint64_t p1_lo = umul128(*m_lo, pow10[1], &p1_hi);
+        const uint64_t p2_lo = umul128(*m_hi, pow10[0], &p2_hi);
+        const uint64_t p3_lo = umul128(*m_hi, pow10[1], &p3_hi);
+        uint64_t mid = p0_hi + p1_lo;
+        uint64_t carry = mid < p0_hi;
+        mid += p2_lo;
+        carry += mid < p2_lo;
+        uint64_t lo = p1_hi + carry;
+        carry = lo < carry;
+        lo += p2_hi;
+        carry += lo < p2_hi;
+        lo += p3_lo;
+        carry += lo < p3_lo;
+        uint64_t hi = p3_hi + carry;
+
+        *b += factor_b + 128;
+        if (hi >> 63 == 0) { // normalize
+            hi  = hi << 1 | lo >> 63;
+            lo  = lo << 1 | mid >> 63;
+            *b -= 1;
+        }
+        *m_lo = lo;
+        *m_hi = hi;
+        error = error == 0 ? 1 : 2 * error + 2; // relative errors add up
+    }
+    return error;
+}
+
+// Ryū for 64-bit mantissa f = m2 * 2^e2. Instead of exact tables, uses
+// truncated 128-bit powers of ten shared with Eisel-Lemire. Small powers are
+// exact, but others make scaled bounds carry an error, which is around 60 bits
+// below their integer parts. Returns false if the fractional part of any bound
+// is too close to an integer or vr is too close to halfway for the result to be
+// certain, in which case the exact path should be used.
+static bool pf_shortest_64_bit_mantissa(
+    const uint64_t m2,
+    const int32_t e2,
+    const bool mm_shift,
+    GPUInt128* output,
+    int32_t* exp10)
+{
+    // Choose e10 so that m2 * 2^e2 / 10^e10 is in [10 * m2, 100 * m2). The
+    // extra digit is needed for powers of 2, where the interval between bounds
+    // is only 3/4 of ulp and would not necessarily contain an integer.
+    const int32_t e10 = (e2 >= 0 ?
+        (int32_t)(((int64_t)e2 * 78913) >> 18)
+      : -(int32_t)(((int64_t)-e2 * 78913 + (1 << 18) - 1) >> 18)) - 1;
+
+    uint64_t m_lo, m_hi;
+    int32_t b;
+    const uint32_t pow10_error = pf_pow10_128(-e10, &m_lo, &m_hi, &b);
+    const bool exact = pow10_error == 0;
+
+    // Products of (mm, mv, mp) and 10^-e10 where mv = 4 * m2 with exponent
+    // e2 - 2, so 10^-e10 = (m_hi:m_lo) * 2^b
+    uint64_t vr_product[4] = {0};
+    uint64_t hi_0, hi_1;
+    const uint64_t lo_0 = umul128(m2, m_lo, &hi_0);
+    const uint64_t lo_1 = umul128(m2, m_hi, &hi_1);
+    vr_product[0] = lo_0;
+    vr_product[1] = hi_0 + lo_1;
+    vr_product[2] = hi_1 + (vr_product[1] < hi_0);
+    vr_product[3] = vr_product[2] >> 62;
+    vr_product[2] = vr_product[2] << 2 | vr_product[1] >> 62;
+    vr_product[1] = vr_product[1] << 2 | vr_product[0] >> 62;
+    vr_product[0] <<= 2;
+
+    uint64_t vp_product[4];
+    uint64_t vm_product[4];
+    memcpy(vp_product, vr_product, sizeof vp_product);
+    memcpy(vm_product, vr_product, sizeof vm_product);
+    pf_add_scaled_128(vp_product, m_lo, m_hi, 2);
+    pf_add_scaled_128(vm_product, m_lo, m_hi, -1 - mm_shift);
+
+    // Integer parts start at bit sh. Truncated power underestimates products
+    // by less than mp * (pow10_error + 1) < 2^67 * (pow10_error + 1), which is
+    // 2^(131 - sh) * (pow10_error + 1) in units of the 64 bits below binary
+    // point.
+    const uint32_t sh = (uint32_t)(2 - e2 - b);
+    if (sh < 80 || 192 <= sh)
+        return false;
+    const uint64_t error = (sh < 131 ? 2ull << (131 - sh) : 2) * (pow10_error + 1);
+
+    const uint64_t* products[] = { vm_product, vr_product, vp_product };
+    GPUInt128 v[3];
+    uint64_t fractions[3];
+    bool low_bits_are_zero[3]; // bits below fractions
+    for (size_t i = 0; i < 3; i++)
+    {
+        fractions[i] = pf_get_64_bits(products[i], sh - 64);
+        if ( ! exact && (fractions[i] < error || fractions[i] > -error))
+            return false;
+        low_bits_are_zero[i] = true;
+        for (uint32_t j = 0; j < (sh - 64) / 64; j++)
+            low_bits_are_zero[i] &= products[i][j] == 0;
+        if ((sh - 64) % 64 != 0)
+            low_bits_are_zero[i] &= products[i][(sh - 64) / 64] << (64 - (sh - 64) % 64) == 0;
+        v[i] = gp_uint128(
+            pf_get_64_bits(products[i], sh + 64), pf_get_64_bits(products[i], sh));
+    }
+    if ( ! exact && fractions[1] - (1ull << 63) + error < 2 * error) // near halfway
+        return false;
+
+    GPUInt128 vm = v[0];
+    GPUInt128 vr = v[1];
+    GPUInt128 vp = v[2];
+    const bool accept_bounds = m2 % 2 == 0;
+    bool vm_is_trailing_zeros = accept_bounds && fractions[0] == 0 && low_bits_are_zero[0];
+    if ( ! accept_bounds && fractions[2] == 0 && low_bits_are_zero[2])
+        vp = gp_uint128_sub(vp, gp_uint128(0, 1));
+
+    // First removed digit is only needed for rounding, and whether digits
+    // after it are zero only for breaking ties.
+    bool vr_is_trailing_zeros = low_bits_are_zero[1] &&
+        (fractions[1] == 0 || fractions[1] == 1ull << 63);
+    uint8_t last_removed_digit = fractions[1] == 0 ? 0 : fractions[1] >= 1ull << 63 ? 5 : 1;
+
+    // Step 4 of Ryū
+    const GPUInt128 ten = gp_uint128(0, 10);
+    int32_t removed = 0;
+    while (gp_uint128_greater_than(gp_uint128_div(vp, ten), gp_uint128_div(vm, ten)))
+    {
+        const GPUInt128 vm_div_10 = gp_uint128_div(vm, ten);
+        const GPUInt128 vr_div_10 = gp_uint128_div(vr, ten);
+        vm_is_trailing_zeros &= gp_uint128_lo(vm) - 10 * gp_uint128_lo(vm_div_10) == 0;
+        vr_is_trailing_zeros &= last_removed_digit == 0;
+        last_removed_digit = gp_uint128_lo(vr) - 10 * gp_uint128_lo(vr_div_10);
+        vr = vr_div_10;
+        vp = gp_uint128_div(vp, ten);
+        vm = vm_div_10;
+        ++removed;
+    }
+    if (vm_is_trailing_zeros)
+    {
+        while (true)
+        {
+            const GPUInt128 vm_div_10 = gp_uint128_div(vm, ten);
+            if (gp_uint128_lo(vm) - 10 * gp_uint128_lo(vm_div_10) != 0)
+                break;
+            const GPUInt128 vr_div_10 = gp_uint128_div(vr, ten);
+            vr_is_trailing_zeros &= last_removed_digit == 0;
+            last_removed_digit = gp_uint128_lo(vr) - 10 * gp_uint128_lo(vr_div_10);
+            vr = vr_div_10;
+            vp = gp_uint128_div(vp, ten);
+            vm = vm_div_10;
+            ++removed;
+        }
+    }
+    if (vr_is_trailing_zeros && last_removed_digit == 5 && gp_uint128_lo(vr) % 2 == 0)
+        last_removed_digit = 4; // round to even
+    const bool round_up =
+        (gp_uint128_equal(vr, vm) && ( ! accept_bounds || ! vm_is_trailing_zeros))
+        || last_removed_digit >= 5;
+
+    *output = gp_uint128_add(vr, gp_uint128(0, round_up));
+    *exp10 = e10 + removed;
+    return true;
+}
+#endif // LDBL_MANT_DIG == 64
+
+#endif // GP_HAS_LONG_DOUBLE && LDBL_MANT_DIG != DBL_MANT_DIG
+
+#if GP_HAS_LONG_DOUBLE
+size_t pf_Lrtoa(const size_t n, char* out, const long double f)
+{
+    #if LDBL_MANT_DIG == DBL_MANT_DIG
+    return pf_rtoa(n, out, f);
+    #else
+    if (isnan(f) || isinf(f))
+        return pf_write_shortest_inf_nan(n, out, signbit(f), isnan(f));
+    if (f == 0)
+        return pf_write_shortest(n, out, signbit(f), "0", 1, 0, 1);
+
+    // f = mantissa * 2^(exp - mantissa_bits), where mantissa has implicit bit
+    // included and subnormals have minimum exponent.
+    const int32_t mantissa_bits = LDBL_MANT_DIG - 1;
+    const int32_t min_exp = LDBL_MIN_EXP - 1;
+    int e;
+    const long double fraction = frexpl(fabsl(f), &e);
+    const int32_t exp = e - 1 < min_exp ? min_exp : e - 1;
+    const long double scaled = ldexpl(fraction, e + mantissa_bits - exp);
+    #if LDBL_MANT_DIG <= 64
+    const GPUInt128 mantissa = gp_uint128(0, (uint64_t)scaled);
+    #if LDBL_MANT_DIG == 64
+    GPUInt128 output;
+    int32_t exp10;
+    const bool mm_shift = (uint64_t)scaled != 1ull << mantissa_bits || exp == min_exp;
+    if (pf_shortest_64_bit_mantissa(
+        (uint64_t)scaled, exp - mantissa_bits, mm_shift, &output, &exp10))
+    {
+        char digits[48];
+        uint32_t length = pf_u128toa(sizeof digits, digits, output);
+        for (; length > 1 && digits[length - 1] == '0'; length--)
+            exp10++;
+        return pf_write_shortest(n, out, signbit(f), digits, length, exp10, 21);
+    }
+    #endif
+    #else
+    const long double hi = floorl(ldexpl(scaled, -64));
+    const GPUInt128 mantissa = gp_uint128(
+        (uint64_t)hi, (uint64_t)(scaled - ldexpl(hi, 64)));
+    #endif
+
+    // Exact decimal value. Digits past PF_DECIMAL_MAX_DIGITS get truncated for
+    // extreme exponents, but only the leading digits matter for rounding.
+    PFDecimal d;
+    pf_decimal_assign(&d, mantissa);
+    pf_decimal_shift(&d, exp - mantissa_bits);
+    pf_decimal_round_shortest(&d, mantissa, exp, mantissa_bits, min_exp);
+
+    char digits[48];
+    for (int32_t i = 0; i < d.length; i++)
+        digits[i] = '0' + d.digits[i];
+    const int32_t max_digits = 1 + (LDBL_MANT_DIG * 30103 + 99999) / 100000;
+    return pf_write_shortest(
+        n, out, signbit(f), digits, d.length, d.decimal_point - d.length, max_digits);
+    #endif
+}
+#endif // GP_HAS_LONG_DOUBLE
+
 // ---------------------------------------------------------------------------
 //
 // Modified Ryū
@@ -454,3 +454,34 @@ char* d2s(double f) {
   return result;
 }
 #endif
+
+// libGPC addition: shortest representation as mantissa * 10^exponent without
+// formatting. f must be finite, sign is ignored.
+void d2s_decimal(double f, uint64_t* mantissa, int32_t* exponent) {
+  const uint64_t bits = double_to_bits(f);
+  const uint64_t ieeeMantissa = bits & ((1ull << DOUBLE_MANTISSA_BITS) - 1);
+  const uint32_t ieeeExponent = (uint32_t) ((bits >> DOUBLE_MANTISSA_BITS) & ((1u << DOUBLE_EXPONENT_BITS) - 1));
+  assert(ieeeExponent != ((1u << DOUBLE_EXPONENT_BITS) - 1u));
+
+  if (ieeeExponent == 0 && ieeeMantissa == 0) {
+    *mantissa = 0;
+    *exponent = 0;
+    return;
+  }
+  floating_decimal_64 v;
+  if (d2d_small_int(ieeeMantissa, ieeeExponent, &v)) {
+    for (;;) {
+      const uint64_t q = div10(v.mantissa);
+      const uint32_t r = ((uint32_t) v.mantissa) - 10 * ((uint32_t) q);
+      if (r != 0) {
+        break;
+      }
+      v.mantissa = q;
+      ++v.exponent;
+    }
+  } else {
+    v = d2d(ieeeMantissa, ieeeExponent);
+  }
+  *mantissa = v.mantissa;
+  *exponent = v.exponent;
+}
@@ -0,0 +1,897 @@
+// MIT License
+// Copyright (c) 2023 Lauri Lorenzo Fiestas
+// https://github.com/PrinssiFiestas/libGPC/blob/main/LICENSE.md
+
+#include <gpc/string.h>
+#include <gpc/memory.h>
+#include <gpc/unicode.h>
+#include "common.h"
+#include <string.h>
+
+// ----------------------------------------------------------------------------
+// Kernels
+//
+// Encoders write exactly the precomputed length. Decoders stop at the first
+// invalid character and never write past their reading position, so they can
+// decode in place. Full blocks are processed with SSSE3 or AVX2 selected at
+// runtime on x86 and with NEON on AArch64. Scalar code finishes the rest and
+// locates invalid characters.
+
+#if (__GNUC__ || __clang__) && (__x86_64__ || __i386__) && !GP_NO_SIMD
+#define GP_ENCODING_X86 1
+#include <immintrin.h>
+#define GP_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define GP_TARGET_AVX2  __attribute__((target("avx2")))
+#elif __ARM_NEON && __aarch64__ && !GP_NO_SIMD
+#define GP_ENCODING_NEON 1
+#include <arm_neon.h>
+#endif
+
+enum { GP_ENCODING_SIMD_NONE, GP_ENCODING_SIMD_SSSE3, GP_ENCODING_SIMD_AVX2 };
+
+static int gp_s_encoding_simd_level(void)
+{
+    #if GP_ENCODING_X86
+    if (__builtin_cpu_supports("avx2"))
+        return GP_ENCODING_SIMD_AVX2;
+    if (__builtin_cpu_supports("ssse3"))
+        return GP_ENCODING_SIMD_SSSE3;
+    #endif
+    return GP_ENCODING_SIMD_NONE;
+}
+
+static const char gp_s_hex_digits[2][17] = {
+    "0123456789abcdef",
+    "0123456789ABCDEF",
+};
+
+static const char gp_s_base64_alphabets[2][65] = {
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/",
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_",
+};
+
+static int gp_s_hex_value(uint8_t c)
+{
+    if ('0' <= c && c <= '9')
+        return c - '0';
+    c |= 0x20; // to lower
+    if ('a' <= c && c <= 'f')
+        return c - 'a' + 10;
+    return -1;
+}
+
+static int gp_s_base64_value(uint8_t c, const char* alphabet)
+{
+    if ('A' <= c && c <= 'Z')
+        return c - 'A';
+    if ('a' <= c && c <= 'z')
+        return c - 'a' + 26;
+    if ('0' <= c && c <= '9')
+        return c - '0' + 52;
+    if (c == (uint8_t)alphabet[62])
+        return 62;
+    if (c == (uint8_t)alphabet[63])
+        return 63;
+    return -1;
+}
+
+static bool gp_s_needs_escape(uint8_t c, int mode)
+{
+    return c < 0x20 || c == '"' || c == '\\' || (mode == GP_ESCAPE_C && c == 0x7F);
+}
+
+#if GP_ENCODING_X86
+// SIMD kernels process full blocks and return the number of processed input
+// bytes. Decoders and escape scanning stop at the block containing a character
+// that needs scalar processing.
+
+GP_TARGET_SSSE3 static size_t gp_s_hex_encode_ssse3(
+    char* out, const uint8_t* in, size_t n, const char* digits)
+{
+    const __m128i lut  = _mm_loadu_si128((const __m128i*)digits);
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m128i v  = _mm_loadu_si128((const __m128i*)(in + i));
+        const __m128i hi = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(v, 4), mask));
+        const __m128i lo = _mm_shuffle_epi8(lut, _mm_and_si128(v, mask));
+        _mm_storeu_si128((__m128i*)(out + 2*i),      _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128((__m128i*)(out + 2*i + 16), _mm_unpackhi_epi8(hi, lo));
+    }
+    return i;
+}
+
+GP_TARGET_AVX2 static size_t gp_s_hex_encode_avx2(
+    char* out, const uint8_t* in, size_t n, const char* digits)
+{
+    const __m256i lut  = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)digits));
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        const __m256i v  = _mm256_loadu_si256((const __m256i*)(in + i));
+        const __m256i hi = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(v, 4), mask));
+        const __m256i lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(v, mask));
+        const __m256i a  = _mm256_unpacklo_epi8(hi, lo); // bytes 0-7 and 16-23
+        const __m256i b  = _mm256_unpackhi_epi8(hi, lo); // bytes 8-15 and 24-31
+        _mm256_storeu_si256((__m256i*)(out + 2*i),      _mm256_permute2x128_si256(a, b, 0x20));
+        _mm256_storeu_si256((__m256i*)(out + 2*i + 32), _mm256_permute2x128_si256(a, b, 0x31));
+    }
+    return i;
+}
+
+// Converts hex digits to values and accumulates invalid characters to invalid.
+GP_TARGET_SSSE3 static inline __m128i gp_s_hex_values_ssse3(__m128i v, __m128i* invalid)
+{
+    const __m128i digit    = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+    const __m128i alpha    = _mm_sub_epi8(_mm_or_si128(v, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    const __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+    const __m128i is_alpha = _mm_cmpeq_epi8(_mm_min_epu8(alpha, _mm_set1_epi8(5)), alpha);
+    *invalid = _mm_or_si128(*invalid, _mm_cmpeq_epi8(
+        _mm_or_si128(is_digit, is_alpha), _mm_setzero_si128()));
+    return _mm_or_si128(
+        _mm_and_si128(is_digit, digit),
+        _mm_and_si128(is_alpha, _mm_add_epi8(alpha, _mm_set1_epi8(10))));
+}
+
+GP_TARGET_SSSE3 static size_t gp_s_hex_decode_ssse3(uint8_t* out, const uint8_t* in, size_t n)
+{
+    const __m128i weights = _mm_set1_epi16(0x0110); // high nibble first
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m128i invalid = _mm_setzero_si128();
+        __m128i a = gp_s_hex_values_ssse3(_mm_loadu_si128((const __m128i*)(in + i)),      &invalid);
+        __m128i b = gp_s_hex_values_ssse3(_mm_loadu_si128((const __m128i*)(in + i + 16)), &invalid);
+        if (_mm_movemask_epi8(invalid) != 0)
+            break;
+        a = _mm_maddubs_epi16(a, weights);
+        b = _mm_maddubs_epi16(b, weights);
+        _mm_storeu_si128((__m128i*)(out + i/2), _mm_packus_epi16(a, b));
+    }
+    return i;
+}
+
+GP_TARGET_AVX2 static inline __m256i gp_s_hex_values_avx2(__m256i v, __m256i* invalid)
+{
+    const __m256i digit    = _mm256_sub_epi8(v, _mm256_set1_epi8('0'));
+    const __m256i alpha    = _mm256_sub_epi8(_mm256_or_si256(v, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+    const __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+    const __m256i is_alpha = _mm256_cmpeq_epi8(_mm256_min_epu8(alpha, _mm256_set1_epi8(5)), alpha);
+    *invalid = _mm256_or_si256(*invalid, _mm256_cmpeq_epi8(
+        _mm256_or_si256(is_digit, is_alpha), _mm256_setzero_si256()));
+    return _mm256_or_si256(
+        _mm256_and_si256(is_digit, digit),
+        _mm256_and_si256(is_alpha, _mm256_add_epi8(alpha, _mm256_set1_epi8(10))));
+}
+
+GP_TARGET_AVX2 static size_t gp_s_hex_decode_avx2(uint8_t* out, const uint8_t* in, size_t n)
+{
+    const __m256i weights = _mm256_set1_epi16(0x0110);
+    size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        __m256i invalid = _mm256_setzero_si256();
+        __m256i a = gp_s_hex_values_avx2(_mm256_loadu_si256((const __m256i*)(in + i)),      &invalid);
+        __m256i b = gp_s_hex_values_avx2(_mm256_loadu_si256((const __m256i*)(in + i + 32)), &invalid);
+        if (_mm256_movemask_epi8(invalid) != 0)
+            break;
+        a = _mm256_maddubs_epi16(a, weights);
+        b = _mm256_maddubs_epi16(b, weights);
+        // Packing is done per lane, fix the order of quad words.
+        _mm256_storeu_si256((__m256i*)(out + i/2),
+            _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8));
+    }
+    return i;
+}
+
+// Base64 kernels are based on the work of Wojciech Muła and Daniel Lemire:
+// http://0x80.pl/notesen/2016-01-12-sse-base64-encoding.html
+// http://0x80.pl/notesen/2016-01-17-sse-base64-decoding.html
+
+GP_TARGET_SSSE3 static inline __m128i gp_s_base64_encode_block_ssse3(
+    __m128i in, __m128i shift_lut)
+{
+    // Spread 3 bytes to 4 bytes and 6-bit indices to separate bytes.
+    in = _mm_shuffle_epi8(in, _mm_set_epi8(10,11,9,10, 7,8,6,7, 4,5,3,4, 1,2,0,1));
+    const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00));
+    const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003F03F0));
+    const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    const __m128i indices = _mm_or_si128(t1, t3);
+
+    // Map index ranges to offsets from characters.
+    __m128i shift = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    shift = _mm_or_si128(shift, _mm_and_si128(less, _mm_set1_epi8(13)));
+    return _mm_add_epi8(_mm_shuffle_epi8(shift_lut, shift), indices);
+}
+
+GP_TARGET_SSSE3 static size_t gp_s_base64_encode_ssse3(
+    char* out, const uint8_t* in, size_t n, const char* alphabet)
+{
+    const __m128i shift_lut = _mm_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        (char)(alphabet[62] - 62), (char)(alphabet[63] - 63), 'A', 0, 0);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 12) // 12 bytes used out of 16 loaded
+        _mm_storeu_si128((__m128i*)(out + i/3*4), gp_s_base64_encode_block_ssse3(
+            _mm_loadu_si128((const __m128i*)(in + i)), shift_lut));
+    return i;
+}
+
+GP_TARGET_AVX2 static size_t gp_s_base64_encode_avx2(
+    char* out, const uint8_t* in, size_t n, const char* alphabet)
+{
+    const __m256i shift_lut = _mm256_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        (char)(alphabet[62] - 62), (char)(alphabet[63] - 63), 'A', 0, 0,
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        (char)(alphabet[62] - 62), (char)(alphabet[63] - 63), 'A', 0, 0);
+    const __m256i spread = _mm256_setr_epi8(
+        1,0,2,1, 4,3,5,4, 7,6,8,7, 10,9,11,10,
+        1,0,2,1, 4,3,5,4, 7,6,8,7, 10,9,11,10);
+    size_t i = 0;
+    for (; i + 28 <= n; i += 24) // 12 bytes per lane
+    {
+        __m256i v = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(in + i))),
+            _mm_loadu_si128((const __m128i*)(in + i + 12)), 1);
+        v = _mm256_shuffle_epi8(v, spread);
+        const __m256i t0 = _mm256_and_si256(v, _mm256_set1_epi32(0x0FC0FC00));
+        const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+        const __m256i t2 = _mm256_and_si256(v, _mm256_set1_epi32(0x003F03F0));
+        const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+        const __m256i indices = _mm256_or_si256(t1, t3);
+
+        __m256i shift = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        const __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+        shift = _mm256_or_si256(shift, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+        _mm256_storeu_si256((__m256i*)(out + i/3*4),
+            _mm256_add_epi8(_mm256_shuffle_epi8(shift_lut, shift), indices));
+    }
+    return i;
+}
+
+// Decoders store 4 or 8 bytes of garbage past decoded data, which is why
+// blocks stop well before the end of input.
+
+GP_TARGET_SSSE3 static size_t gp_s_base64_decode_ssse3(
+    uint8_t* out, const uint8_t* in, size_t n, bool url)
+{
+    const __m128i lut_lo = _mm_setr_epi8(
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m128i lut_hi = _mm_setr_epi8(
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m128i lut_roll = _mm_setr_epi8(
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i mask_2F = _mm_set1_epi8(0x2F);
+    const __m128i pack = _mm_setr_epi8(
+        2,1,0, 6,5,4, 10,9,8, 14,13,12, -1,-1,-1,-1);
+
+    size_t i = 0;
+    for (; i + 24 <= n; i += 16)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)(in + i));
+        if (url) { // map to standard alphabet, which is invalid for URLs
+            const __m128i standard = _mm_or_si128(
+                _mm_cmpeq_epi8(v, _mm_set1_epi8('+')), _mm_cmpeq_epi8(v, _mm_set1_epi8('/')));
+            if (_mm_movemask_epi8(standard) != 0)
+                break;
+            v = _mm_add_epi8(v, _mm_or_si128(
+                _mm_and_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('-')), _mm_set1_epi8('+' - '-')),
+                _mm_and_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('_')), _mm_set1_epi8('/' - '_'))));
+        }
+        const __m128i hi_nibbles = _mm_and_si128(_mm_srli_epi32(v, 4), mask_2F);
+        const __m128i lo_nibbles = _mm_and_si128(v, mask_2F);
+        const __m128i lo = _mm_shuffle_epi8(lut_lo, lo_nibbles);
+        const __m128i hi = _mm_shuffle_epi8(lut_hi, hi_nibbles);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128())) != 0xFFFF)
+            break;
+
+        const __m128i roll = _mm_shuffle_epi8(lut_roll,
+            _mm_add_epi8(_mm_cmpeq_epi8(v, mask_2F), hi_nibbles));
+        v = _mm_add_epi8(v, roll);
+        v = _mm_maddubs_epi16(v, _mm_set1_epi32(0x01400140));
+        v = _mm_madd_epi16(v, _mm_set1_epi32(0x00011000));
+        _mm_storeu_si128((__m128i*)(out + i/4*3), _mm_shuffle_epi8(v, pack));
+    }
+    return i;
+}
+
+GP_TARGET_AVX2 static size_t gp_s_base64_decode_avx2(
+    uint8_t* out, const uint8_t* in, size_t n, bool url)
+{
+    const __m256i lut_lo = _mm256_setr_epi8(
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m256i lut_hi = _mm256_setr_epi8(
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m256i lut_roll = _mm256_setr_epi8(
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i mask_2F = _mm256_set1_epi8(0x2F);
+    const __m256i pack = _mm256_setr_epi8(
+        2,1,0, 6,5,4, 10,9,8, 14,13,12, -1,-1,-1,-1,
+        2,1,0, 6,5,4, 10,9,8, 14,13,12, -1,-1,-1,-1);
+    const __m256i join = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+
+    size_t i = 0;
+    for (; i + 44 <= n; i += 32)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(in + i));
+        if (url) {
+            const __m256i standard = _mm256_or_si256(
+                _mm256_cmpeq_epi8(v, _mm256_set1_epi8('+')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('/')));
+            if (_mm256_movemask_epi8(standard) != 0)
+                break;
+            v = _mm256_add_epi8(v, _mm256_or_si256(
+                _mm256_and_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('-')), _mm256_set1_epi8('+' - '-')),
+                _mm256_and_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('_')), _mm256_set1_epi8('/' - '_'))));
+        }
+        const __m256i hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(v, 4), mask_2F);
+        const __m256i lo_nibbles = _mm256_and_si256(v, mask_2F);
+        const __m256i lo = _mm256_shuffle_epi8(lut_lo, lo_nibbles);
+        const __m256i hi = _mm256_shuffle_epi8(lut_hi, hi_nibbles);
+        if ( ! _mm256_testz_si256(lo, hi))
+            break;
+
+        const __m256i roll = _mm256_shuffle_epi8(lut_roll,
+            _mm256_add_epi8(_mm256_cmpeq_epi8(v, mask_2F), hi_nibbles));
+        v = _mm256_add_epi8(v, roll);
+        v = _mm256_maddubs_epi16(v, _mm256_set1_epi32(0x01400140));
+        v = _mm256_madd_epi16(v, _mm256_set1_epi32(0x00011000));
+        v = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(v, pack), join);
+        _mm256_storeu_si256((__m256i*)(out + i/4*3), v);
+    }
+    return i;
+}
+
+GP_TARGET_SSSE3 static size_t gp_s_escape_span_ssse3(const uint8_t* s, size_t n, int mode)
+{
+    const __m128i del = _mm_set1_epi8(mode == GP_ESCAPE_C ? 0x7F : '"');
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(s + i));
+        const __m128i control = _mm_cmpeq_epi8(_mm_min_epu8(v, _mm_set1_epi8(0x1F)), v);
+        const __m128i special = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('"')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\\'))),
+            _mm_cmpeq_epi8(v, del));
+        if (_mm_movemask_epi8(_mm_or_si128(control, special)) != 0)
+            break;
+    }
+    return i;
+}
+
+GP_TARGET_AVX2 static size_t gp_s_escape_span_avx2(const uint8_t* s, size_t n, int mode)
+{
+    const __m256i del = _mm256_set1_epi8(mode == GP_ESCAPE_C ? 0x7F : '"');
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        const __m256i v = _mm256_loadu_si256((const __m256i*)(s + i));
+        const __m256i control = _mm256_cmpeq_epi8(_mm256_min_epu8(v, _mm256_set1_epi8(0x1F)), v);
+        const __m256i special = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('"')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\\'))),
+            _mm256_cmpeq_epi8(v, del));
+        if (_mm256_movemask_epi8(_mm256_or_si256(control, special)) != 0)
+            break;
+    }
+    return i;
+}
+#endif // GP_ENCODING_X86
+
+#if GP_ENCODING_NEON
+static size_t gp_s_hex_encode_neon(char* out, const uint8_t* in, size_t n, const char* digits)
+{
+    const uint8x16_t lut = vld1q_u8((const uint8_t*)digits);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const uint8x16_t v = vld1q_u8(in + i);
+        uint8x16x2_t hex;
+        hex.val[0] = vqtbl1q_u8(lut, vshrq_n_u8(v, 4));
+        hex.val[1] = vqtbl1q_u8(lut, vandq_u8(v, vdupq_n_u8(0x0F)));
+        vst2q_u8((uint8_t*)out + 2*i, hex); // interleaves high and low nibbles
+    }
+    return i;
+}
+
+static size_t gp_s_escape_span_neon(const uint8_t* s, size_t n, int mode)
+{
+    const uint8x16_t del = vdupq_n_u8(mode == GP_ESCAPE_C ? 0x7F : '"');
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const uint8x16_t v = vld1q_u8(s + i);
+        const uint8x16_t special = vorrq_u8(
+            vorrq_u8(vcltq_u8(v, vdupq_n_u8(0x20)), vceqq_u8(v, vdupq_n_u8('"'))),
+            vorrq_u8(vceqq_u8(v, vdupq_n_u8('\\')), vceqq_u8(v, del)));
+        if (vmaxvq_u8(special) != 0)
+            break;
+    }
+    return i;
+}
+#endif // GP_ENCODING_NEON
+
+size_t gp_internal_hex_encode(
+    char*restrict out, const void*restrict _in, size_t n, int flags)
+{
+    const uint8_t* in = _in;
+    const char* digits = gp_s_hex_digits[(flags & GP_HEX_UPPERCASE) != 0];
+    size_t i = 0;
+    #if GP_ENCODING_X86
+    const int simd = gp_s_encoding_simd_level();
+    if (simd == GP_ENCODING_SIMD_AVX2)
+        i = gp_s_hex_encode_avx2(out, in, n, digits);
+    else if (simd == GP_ENCODING_SIMD_SSSE3)
+        i = gp_s_hex_encode_ssse3(out, in, n, digits);
+    #elif GP_ENCODING_NEON
+    i = gp_s_hex_encode_neon(out, in, n, digits);
+    #endif
+    for (; i < n; ++i) {
+        out[2*i]     = digits[in[i] >> 4];
+        out[2*i + 1] = digits[in[i] & 0xF];
+    }
+    return 2*n;
+}
+
+static size_t gp_s_hex_decode(
+    uint8_t* out, const uint8_t* in, size_t n, int flags, size_t* invalid)
+{
+    (void)flags;
+    size_t i = 0;
+    #if GP_ENCODING_X86
+    const int simd = gp_s_encoding_simd_level();
+    if (simd == GP_ENCODING_SIMD_AVX2)
+        i = gp_s_hex_decode_avx2(out, in, n);
+    else if (simd == GP_ENCODING_SIMD_SSSE3)
+        i = gp_s_hex_decode_ssse3(out, in, n);
+    #endif
+    *invalid = GP_NOT_FOUND;
+    for (; i + 2 <= n; i += 2) {
+        const int hi = gp_s_hex_value(in[i]);
+        const int lo = gp_s_hex_value(in[i + 1]);
+        if (hi < 0 || lo < 0) {
+            *invalid = i + (hi >= 0);
+            return i/2;
+        }
+        out[i/2] = hi << 4 | lo;
+    }
+    if (i < n) // odd length
+        *invalid = gp_s_hex_value(in[i]) < 0 ? i : n;
+    return i/2;
+}
+
+size_t gp_internal_base64_encoded_length(size_t n, int flags)
+{
+    if (flags & GP_BASE64_NO_PADDING)
+        return n/3*4 + (n%3 != 0) + n%3;
+    return (n + 2)/3*4;
+}
+
+size_t gp_internal_base64_encode(
+    char*restrict out, const void*restrict _in, size_t n, int flags)
+{
+    const uint8_t* in = _in;
+    const char* alphabet = gp_s_base64_alphabets[(flags & GP_BASE64_URL) != 0];
+    size_t i = 0;
+    #if GP_ENCODING_X86
+    const int simd = gp_s_encoding_simd_level();
+    if (simd == GP_ENCODING_SIMD_AVX2)
+        i = gp_s_base64_encode_avx2(out, in, n, alphabet);
+    else if (simd == GP_ENCODING_SIMD_SSSE3)
+        i = gp_s_base64_encode_ssse3(out, in, n, alphabet);
+    #endif
+    size_t j = i/3*4;
+    for (; i + 3 <= n; i += 3, j += 4) {
+        const uint32_t x = (uint32_t)in[i] << 16 | (uint32_t)in[i + 1] << 8 | in[i + 2];
+        out[j]     = alphabet[x >> 18];
+        out[j + 1] = alphabet[x >> 12 & 63];
+        out[j + 2] = alphabet[x >>  6 & 63];
+        out[j + 3] = alphabet[x       & 63];
+    }
+    if (i < n)
+    {
+        const bool two = i + 1 < n;
+        const uint32_t x = (uint32_t)in[i] << 16 | (two ? (uint32_t)in[i + 1] << 8 : 0);
+        out[j++] = alphabet[x >> 18];
+        out[j++] = alphabet[x >> 12 & 63];
+        if (two)
+            out[j++] = alphabet[x >> 6 & 63];
+        if ( ! (flags & GP_BASE64_NO_PADDING)) {
+            if ( ! two)
+                out[j++] = '=';
+            out[j++] = '=';
+        }
+    }
+    return j;
+}
+
+static size_t gp_s_base64_decode(
+    uint8_t* out, const uint8_t* in, size_t n, int flags, size_t* invalid)
+{
+    const char* alphabet = gp_s_base64_alphabets[(flags & GP_BASE64_URL) != 0];
+    size_t i = 0;
+    #if GP_ENCODING_X86
+    const int simd = gp_s_encoding_simd_level();
+    if (simd == GP_ENCODING_SIMD_AVX2)
+        i = gp_s_base64_decode_avx2(out, in, n, flags & GP_BASE64_URL);
+    else if (simd == GP_ENCODING_SIMD_SSSE3)
+        i = gp_s_base64_decode_ssse3(out, in, n, flags & GP_BASE64_URL);
+    #endif
+    size_t j = i/4*3;
+    *invalid = GP_NOT_FOUND;
+
+    size_t length = n; // without padding
+    if (length > i && in[length - 1] == '=')
+        --length;
+    if (length > i && in[length - 1] == '=')
+        --length;
+
+    int v[4];
+    for (; i < length; i += 4)
+    {
+        const size_t remaining = gp_min(length - i, (size_t)4);
+        for (size_t k = 0; k < remaining; ++k) {
+            if ((v[k] = gp_s_base64_value(in[i + k], alphabet)) < 0) {
+                *invalid = i + k;
+                return j;
+            }
+        }
+        if (remaining == 1) { // 6 bits cannot form a byte
+            *invalid = i + 1;
+            return j;
+        }
+        const uint32_t x = (uint32_t)v[0] << 18 | (uint32_t)v[1] << 12
+            | (remaining > 2 ? (uint32_t)v[2] << 6 : 0)
+            | (remaining > 3 ? (uint32_t)v[3]      : 0);
+        out[j++] = x >> 16;
+        if (remaining > 2)
+            out[j++] = x >> 8;
+        if (remaining > 3)
+            out[j++] = x;
+    }
+    if (length != n && n % 4 != 0) // padding does not complete the last quantum
+        *invalid = length;
+    return j;
+}
+
+// Writes escape sequence of c to out, which must have room for 6 bytes.
+static size_t gp_s_escape_char(char* out, uint8_t c, int mode)
+{
+    char shorthand = '\0';
+    switch (c) {
+    case '"':  shorthand = '"';  break;
+    case '\\': shorthand = '\\'; break;
+    case '\b': shorthand = 'b';  break;
+    case '\f': shorthand = 'f';  break;
+    case '\n': shorthand = 'n';  break;
+    case '\r': shorthand = 'r';  break;
+    case '\t': shorthand = 't';  break;
+    case '\a': shorthand = mode == GP_ESCAPE_C ? 'a' : '\0'; break;
+    case '\v': shorthand = mode == GP_ESCAPE_C ? 'v' : '\0'; break;
+    }
+    out[0] = '\\';
+    if (shorthand != '\0') {
+        out[1] = shorthand;
+        return 2;
+    }
+    if (mode == GP_ESCAPE_C) { // octal is limited to 3 digits unlike \x
+        out[1] = '0' + (c >> 6);
+        out[2] = '0' + (c >> 3 & 7);
+        out[3] = '0' + (c & 7);
+        return 4;
+    }
+    memcpy(out + 1, "u00", 3);
+    out[4] = gp_s_hex_digits[0][c >> 4];
+    out[5] = gp_s_hex_digits[0][c & 0xF];
+    return 6;
+}
+
+// Length of prefix that does not need escaping.
+static size_t gp_s_escape_span(const uint8_t* s, size_t n, int mode, int simd)
+{
+    size_t i = 0;
+    #if GP_ENCODING_X86
+    if (simd == GP_ENCODING_SIMD_AVX2)
+        i = gp_s_escape_span_avx2(s, n, mode);
+    else if (simd == GP_ENCODING_SIMD_SSSE3)
+        i = gp_s_escape_span_ssse3(s, n, mode);
+    #elif GP_ENCODING_NEON
+    (void)simd;
+    i = gp_s_escape_span_neon(s, n, mode);
+    #else
+    (void)simd;
+    #endif
+    while (i < n && ! gp_s_needs_escape(s[i], mode))
+        ++i;
+    return i;
+}
+
+size_t gp_internal_escaped_length(const void* _in, size_t n, int mode)
+{
+    const uint8_t* in = _in;
+    const int simd = gp_s_encoding_simd_level();
+    char sequence[6];
+    size_t length = n;
+    for (size_t i = 0; (i += gp_s_escape_span(in + i, n - i, mode, simd)) < n; ++i)
+        length += gp_s_escape_char(sequence, in[i], mode) - 1;
+    return length;
+}
+
+size_t gp_internal_escape(
+    char*restrict out, const void*restrict _in, size_t n, int mode)
+{
+    const uint8_t* in = _in;
+    const int simd = gp_s_encoding_simd_level();
+    size_t j = 0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        const size_t span = gp_s_escape_span(in + i, n - i, mode, simd);
+        memcpy(out + j, in + i, span);
+        i += span;
+        j += span;
+        if (i < n)
+            j += gp_s_escape_char(out + j, in[i], mode);
+    }
+    return j;
+}
+
+static bool gp_s_hex_number(uint32_t* value, const uint8_t* in, size_t n, size_t digits)
+{
+    if (n < digits)
+        return false;
+    *value = 0;
+    for (size_t i = 0; i < digits; ++i) {
+        const int digit = gp_s_hex_value(in[i]);
+        if (digit < 0)
+            return false;
+        *value = *value << 4 | digit;
+    }
+    return true;
+}
+
+// Unescapes sequence starting with backslash. Input is parsed fully before
+// writing, so out may point to in. Returns the length of sequence or 0 if
+// invalid.
+static size_t gp_s_unescape_sequence(
+    uint8_t* out, size_t* written, const uint8_t* in, size_t n, int mode)
+{
+    if (n < 2)
+        return 0;
+
+    const bool c_mode = mode == GP_ESCAPE_C;
+    uint8_t c = '\0';
+    switch (in[1]) {
+    case '"':  c = '"';  break;
+    case '\\': c = '\\'; break;
+    case 'b':  c = '\b'; break;
+    case 'f':  c = '\f'; break;
+    case 'n':  c = '\n'; break;
+    case 'r':  c = '\r'; break;
+    case 't':  c = '\t'; break;
+    case '/':  c = ! c_mode ? '/'  : '\0'; break;
+    case '\'': c =   c_mode ? '\'' : '\0'; break;
+    case '?':  c =   c_mode ? '?'  : '\0'; break;
+    case 'a':  c =   c_mode ? '\a' : '\0'; break;
+    case 'v':  c =   c_mode ? '\v' : '\0'; break;
+    }
+    if (c != '\0') {
+        *out = c;
+        *written = 1;
+        return 2;
+    }
+
+    uint32_t value = 0;
+    size_t length = 2;
+    if (in[1] == 'u' || (c_mode && in[1] == 'U'))
+    {
+        const size_t digits = in[1] == 'u' ? 4 : 8;
+        if ( ! gp_s_hex_number(&value, in + length, n - length, digits))
+            return 0;
+        length += digits;
+
+        uint32_t low;
+        if ( ! c_mode && 0xD800 <= value && value <= 0xDBFF) // surrogate pair
+        {
+            if (n < length + 6 || in[length] != '\\' || in[length + 1] != 'u'
+                || ! gp_s_hex_number(&low, in + length + 2, 4, 4)
+                || low < 0xDC00 || 0xDFFF < low)
+                return 0;
+            value = 0x10000 + ((value - 0xD800) << 10) + (low - 0xDC00);
+            length += 6;
+        }
+        if ((0xD800 <= value && value <= 0xDFFF) || 0x10FFFF < value)
+            return 0;
+        *written = gp_utf8_encode_unsafe(out, value);
+        return length;
+    }
+    else if (c_mode && in[1] == 'x')
+    {
+        for (int digit; length < n && (digit = gp_s_hex_value(in[length])) >= 0; ++length)
+            if ((value = value << 4 | digit) > 0xFF)
+                return 0;
+        if (length == 2)
+            return 0;
+    }
+    else if (c_mode && '0' <= in[1] && in[1] <= '7')
+    {
+        for (length = 1; length < 4 && length < n && '0' <= in[length] && in[length] <= '7'; ++length)
+            value = value << 3 | (in[length] - '0');
+        if (value > 0xFF)
+            return 0;
+    }
+    else
+        return 0;
+
+    *out = value;
+    *written = 1;
+    return length;
+}
+
+static size_t gp_s_unescape(
+    uint8_t* out, const uint8_t* in, size_t n, int mode, size_t* invalid)
+{
+    size_t i = 0;
+    size_t j = 0;
+    *invalid = GP_NOT_FOUND;
+    while (true)
+    {
+        const uint8_t* backslash = memchr(in + i, '\\', n - i);
+        const size_t span = backslash != NULL ? (size_t)(backslash - (in + i)) : n - i;
+        memmove(out + j, in + i, span);
+        i += span;
+        j += span;
+        if (i == n)
+            break;
+
+        size_t written;
+        const size_t length = gp_s_unescape_sequence(out + j, &written, in + i, n - i, mode);
+        if (length == 0) {
+            *invalid = i;
+            break;
+        }
+        i += length;
+        j += written;
+    }
+    return j;
+}
+
+// ----------------------------------------------------------------------------
+// String Encoding
+
+static size_t gp_s_str_encode(
+    GPString*   dest,
+    const void* src,
+    size_t      src_length,
+    size_t      length,
+    size_t    (*encode)(char*restrict, const void*restrict, size_t, int),
+    int         flags)
+{
+    if (src == NULL)
+        src_length = gp_str_length(*dest);
+
+    // Reserve before allocating from the scratch arena, which might contain
+    // dest, so rewinding will not free the reallocated dest.
+    size_t trunced = gp_str_reserve(dest, length);
+    if (src != NULL && trunced == 0) {
+        encode((char*)*dest, src, src_length, flags);
+        gp_str_set(*dest)->length = length;
+        return 0;
+    }
+
+    GPArena* scratch = gp_scratch_arena();
+    char* buffer = gp_mem_alloc(&scratch->base, length + (src == NULL ? src_length : 0));
+    if (src == NULL)
+        src = memcpy(buffer + length, *dest, src_length);
+    encode(buffer, src, src_length, flags);
+    trunced = gp_str_copy(dest, buffer, length);
+    gp_arena_rewind(scratch, buffer);
+    return trunced;
+}
+
+static size_t gp_s_str_decode(
+    GPString*   dest,
+    const void* src,
+    size_t      src_length,
+    size_t      max_length,
+    size_t    (*decode)(uint8_t*, const uint8_t*, size_t, int, size_t*),
+    int         flags,
+    size_t*     optional_out_invalid_position)
+{
+    size_t invalid;
+    size_t trunced = 0;
+    if (src == NULL) // decoders do not write past their reading position
+        gp_str_set(*dest)->length = decode(
+            (uint8_t*)*dest, (uint8_t*)*dest, gp_str_length(*dest), flags, &invalid);
+    else if (gp_str_reserve(dest, max_length) == 0)
+        gp_str_set(*dest)->length = decode(
+            (uint8_t*)*dest, src, src_length, flags, &invalid);
+    else
+    { // decoded data might still fit
+        GPArena* scratch = gp_scratch_arena();
+        uint8_t* buffer = gp_mem_alloc(&scratch->base, max_length);
+        trunced = gp_str_copy(dest, buffer, decode(buffer, src, src_length, flags, &invalid));
+        gp_arena_rewind(scratch, buffer);
+    }
+    if (optional_out_invalid_position != NULL)
+        *optional_out_invalid_position = invalid;
+    return trunced;
+}
+
+size_t gp_str_hex_encode(
+    GPString*           dest,
+    const void*restrict src,
+    size_t              src_length,
+    int                 flags)
+{
+    const size_t length = 2 * (src != NULL ? src_length : gp_str_length(*dest));
+    return gp_s_str_encode(dest, src, src_length, length, gp_internal_hex_encode, flags);
+}
+
+size_t gp_str_hex_decode(
+    GPString*           dest,
+    const void*restrict src,
+    size_t              src_length,
+    size_t*             optional_out_invalid_position)
+{
+    return gp_s_str_decode(
+        dest, src, src_length, src_length/2, gp_s_hex_decode, 0, optional_out_invalid_position);
+}
+
+size_t gp_str_base64_encode(
+    GPString*           dest,
+    const void*restrict src,
+    size_t              src_length,
+    int                 flags)
+{
+    const size_t length = gp_internal_base64_encoded_length(
+        src != NULL ? src_length : gp_str_length(*dest), flags);
+    return gp_s_str_encode(dest, src, src_length, length, gp_internal_base64_encode, flags);
+}
+
+size_t gp_str_base64_decode(
+    GPString*           dest,
+    const void*restrict src,
+    size_t              src_length,
+    int                 flags,
+    size_t*             optional_out_invalid_position)
+{
+    return gp_s_str_decode(
+        dest, src, src_length, src_length/4*3 + 2, gp_s_base64_decode, flags,
+        optional_out_invalid_position);
+}
+
+size_t gp_str_escape(
+    GPString*           dest,
+    const void*restrict src,
+    size_t              src_length,
+    int                 mode)
+{
+    const size_t length = src != NULL ?
+        gp_internal_escaped_length(src, src_length, mode)
+      : gp_internal_escaped_length(*dest, gp_str_length(*dest), mode);
+    size_t trunced = gp_s_str_encode(dest, src, src_length, length, gp_internal_escape, mode);
+    if (trunced)
+        trunced += gp_str_truncate_invalid_tail(dest);
+    return trunced;
+}
+
+size_t gp_str_unescape(
+    GPString*           dest,
+    const void*restrict src,
+    size_t              src_length,
+    int                 mode,
+    size_t*             optional_out_invalid_position)
+{
+    size_t trunced = gp_s_str_decode(
+        dest, src, src_length, src_length, gp_s_unescape, mode, optional_out_invalid_position);
+    if (trunced)
+        trunced += gp_str_truncate_invalid_tail(dest);
+    return trunced;
+}
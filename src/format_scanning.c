@@ -126,7 +126,16 @@ pf_scan_format_string(
             fmt.length_modifier = *modifier;
     }
 
-    fmt.conversion_format = *c++;
+    if (*c == '{') // registered conversion %{name}
+    {
+        const char* end = strchr(c, '}');
+        if (end == NULL) // not a conversion, rest of format string is literal
+            return (PFFormatSpecifier){0};
+        fmt.conversion_format = '{';
+        c = end + 1;
+    }
+    else
+        fmt.conversion_format = *c++;
     fmt.string_length = c - fmt.string;
 
     gp_db_assert(fmt.conversion_format != 'n', "Unsupported format specifier.");
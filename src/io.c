@@ -9,6 +9,11 @@
 #include <printf/conversions.h>
 #include <printf/format_scanning.h>
 #include "common.h"
+#if !_WIN32
+#include <sys/uio.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
 
 FILE* gp_file_open(const char* path, const char* mode)
 {
@@ -144,6 +149,49 @@ bool gp_file_read_strip(
     return true;
 }
 
+size_t gp_file_write_str_builder(FILE* out, const GPStrBuilder* builder)
+{
+    const GPStrSegment* segments = builder->_segments;
+    const size_t segments_length = gp_arr_length(builder->_segments);
+    size_t written = 0;
+
+    #if _WIN32
+    for (size_t i = 0; i < segments_length; ++i)
+        written += fwrite(segments[i].data, sizeof(char), segments[i].length, out);
+    #else
+    fflush(out);
+    const int fd = fileno(out);
+    struct iovec iov[64];
+    for (size_t i = 0; i < segments_length; )
+    {
+        size_t iov_length = 0;
+        for (; iov_length < sizeof iov / sizeof iov[0] && i < segments_length; ++i)
+            if (segments[i].length != 0)
+                iov[iov_length++] = (struct iovec){
+                    .iov_base = (void*)segments[i].data,
+                    .iov_len  = segments[i].length };
+
+        struct iovec* piov = iov;
+        while (iov_length > 0) // handle partial writes
+        {
+            ssize_t result = writev(fd, piov, iov_length);
+            if (result < 0 && errno == EINTR)
+                continue;
+            if (result <= 0)
+                return written;
+            written += result;
+            for (; iov_length > 0 && (size_t)result >= piov->iov_len; ++piov, --iov_length)
+                result -= piov->iov_len;
+            if (iov_length > 0) {
+                piov->iov_base = (char*)piov->iov_base + result;
+                piov->iov_len -= result;
+            }
+        }
+    }
+    #endif
+    return written;
+}
+
 static size_t gp_s_print_va_arg(
     FILE* out,
     pf_va_list*restrict const args,
@@ -215,23 +263,23 @@ static size_t gp_s_print_va_arg(
         break;
 
     case GP_TYPE_FLOAT:
+        length = pf_hrtoa(sizeof buf, buf, va_arg(args->list, gp_promoted_arg_float_t));
+        fwrite(buf, 1, length, out);
+        break;
+
     case GP_TYPE_DOUBLE:
-    case GP_TYPE_LONG_DOUBLE: {
-        PFFormatSpecifier fmt = {0};
-        fmt.conversion_format = 'g';
-        #if GP_HAS_LONG_DOUBLE // again, may lose precision due to missing pf_strfroml()
-        if (fmt.length_modifier == 'L')
-            length = pf_strfromd(buf, sizeof buf, fmt, va_arg(args->list, long double));
-        else
-        #endif
-            length = pf_strfromd(
-                buf,
-                sizeof buf,
-                fmt,
-                va_arg(args->list, gp_promoted_arg_double_t));
+        length = pf_rtoa(sizeof buf, buf, va_arg(args->list, gp_promoted_arg_double_t));
+        fwrite(buf, 1, length, out);
+        break;
 
+    #if GP_HAS_LONG_DOUBLE
+    case GP_TYPE_LONG_DOUBLE:
+        length = pf_Lrtoa(sizeof buf, buf, va_arg(args->list, long double));
         fwrite(buf, 1, length, out);
-        } break;
+        break;
+    #else
+    case GP_TYPE_LONG_DOUBLE: GP_UNREACHABLE("long double not supported.");
+    #endif
 
     case GP_TYPE_CHAR_PTR: { // TODO wide strings!
         const char* cstr = va_arg(args->list, char*);
@@ -265,95 +313,6 @@ static size_t gp_s_print_va_arg(
     return length;
 }
 
-static void gp_s_va_list_dummy_consume(
-    const char* format,
-    pf_va_list* args)
-{
-    while (1)
-    {
-        const PFFormatSpecifier fmt = pf_scan_format_string(format, args);
-        if (fmt.string == NULL)
-            return;
-
-        // Jump over format specifier for next iteration
-        format = fmt.string + fmt.string_length;
-
-        switch (fmt.conversion_format)
-        {
-        case 'c':
-            if (fmt.length_modifier != 'l')
-                (void)va_arg(args->list, gp_promoted_arg_char_t);
-            else
-                (void)va_arg(args->list, gp_promoted_arg_wint_t);
-            break;
-
-        case 'i': case 'd': switch (fmt.length_modifier)
-            {
-            case 2 * 'h': (void)va_arg(args->list, gp_promoted_arg_signed_char_t); break;
-            case 'h':     (void)va_arg(args->list, gp_promoted_arg_short_t      ); break;
-            case  0 :     (void)va_arg(args->list, gp_promoted_arg_int_t        ); break;
-            case 'l':     (void)va_arg(args->list, gp_promoted_arg_long_t       ); break;
-            case 2 * 'l': (void)va_arg(args->list, gp_promoted_arg_long_long_t  ); break;
-            case 'B':     (void)va_arg(args->list, gp_promoted_arg_int8_t       ); break;
-            case 'W':     (void)va_arg(args->list, gp_promoted_arg_int16_t      ); break;
-            case 'D':     (void)va_arg(args->list, gp_promoted_arg_int32_t      ); break;
-            case 'Q':     (void)va_arg(args->list, gp_promoted_arg_int64_t      ); break;
-            case 'O':     (void)va_arg(args->list, GPInt128                     ); break;
-            case 'j':     (void)va_arg(args->list, gp_promoted_arg_ptrdiff_t    ); break;
-            case 'B'+'f': (void)va_arg(args->list, gp_promoted_arg_int_fast8_t  ); break;
-            case 'W'+'f': (void)va_arg(args->list, gp_promoted_arg_int_fast16_t ); break;
-            case 'D'+'f': (void)va_arg(args->list, gp_promoted_arg_int_fast32_t ); break;
-            case 'Q'+'f': (void)va_arg(args->list, gp_promoted_arg_int_fast64_t ); break;
-            #ifdef SSIZE_MAX
-            case 'z':     (void)va_arg(args->list, gp_promoted_arg_ssize_t      ); break;
-            #endif
-            default: GP_UNREACHABLE("");
-            }
-            break;
-
-        case 'o':
-        case 'x': case 'X':
-        case 'u': switch (fmt.length_modifier)
-            {
-            case 2 * 'h': (void)va_arg(args->list, gp_promoted_arg_unsigned_char_t     ); break;
-            case 'h':     (void)va_arg(args->list, gp_promoted_arg_unsigned_short_t    ); break;
-            case  0:      (void)va_arg(args->list, gp_promoted_arg_unsigned_t          ); break;
-            case 'l':     (void)va_arg(args->list, gp_promoted_arg_unsigned_long_t     ); break;
-            case 2 * 'l': (void)va_arg(args->list, gp_promoted_arg_unsigned_long_long_t); break;
-            case 'B':     (void)va_arg(args->list, gp_promoted_arg_uint8_t             ); break;
-            case 'W':     (void)va_arg(args->list, gp_promoted_arg_uint16_t            ); break;
-            case 'D':     (void)va_arg(args->list, gp_promoted_arg_uint32_t            ); break;
-            case 'Q':     (void)va_arg(args->list, gp_promoted_arg_uint64_t            ); break;
-            case 'O':     (void)va_arg(args->list, GPUInt128                           ); break;
-            case 'z':     (void)va_arg(args->list, gp_promoted_arg_size_t              ); break;
-            case 'B'+'f': (void)va_arg(args->list, gp_promoted_arg_uint_fast8_t        ); break;
-            case 'W'+'f': (void)va_arg(args->list, gp_promoted_arg_uint_fast16_t       ); break;
-            case 'D'+'f': (void)va_arg(args->list, gp_promoted_arg_uint_fast32_t       ); break;
-            case 'Q'+'f': (void)va_arg(args->list, gp_promoted_arg_uint_fast64_t       ); break;
-            default: GP_UNREACHABLE("");
-            }
-            break;
-
-        case 's': case 'S':
-        case 'p': (void)va_arg(args->list, void*); break;
-
-        case 'f': case 'F':
-        case 'e': case 'E':
-        case 'g': case 'G':
-            #if GP_HAS_LONG_DOUBLE
-            if (fmt.length_modifier == 'L')
-                (void)va_arg(args->list, long double);
-            else
-            #endif
-                (void)va_arg(args->list, gp_promoted_arg_double_t);
-            break;
-
-        default:
-            GP_UNREACHABLE("");
-        }
-    }
-}
-
 static size_t gp_s_print_objects(
     FILE* out,
     pf_va_list* args,
@@ -366,9 +325,7 @@ static size_t gp_s_print_objects(
         const char* fmt = va_arg(args->list, char*);
         *i += gp_internal_count_fmt_specs(fmt); // skip args printed below
 
-        length += pf_vfprintf(out, fmt, args->list); // remember, no va_arg consumption here,
-        // so they must be consumed manually. // TODO we should implement pf_vfprintf_consuming() instead
-        gp_s_va_list_dummy_consume(fmt, args);
+        length += pf_vfprintf_consuming(out, fmt, args);
     } else
         length += gp_s_print_va_arg(out, args, obj.type);
 
@@ -422,3 +379,52 @@ size_t gp_internal_file_println(
     return length;
 }
 
+
+// Short outputs are gathered to a buffer to call fwrite() only once, which
+// locks the stream each time.
+static size_t gp_s_file_print_formatted(
+    FILE* out,
+    const size_t arg_count,
+    const GPInternalFormatted* objs,
+    const bool add_spaces)
+{
+    char buffer[256];
+    size_t buffer_length = 0;
+    size_t length = 0;
+    for (size_t i = 0; i < arg_count; i++)
+    {
+        const char* data = objs[i].data != NULL ? objs[i].data : objs[i].buffer;
+        const size_t data_length = objs[i].length;
+        if (buffer_length + data_length + add_spaces > sizeof buffer) {
+            fwrite(buffer, 1, buffer_length, out);
+            buffer_length = 0;
+        }
+        if (data_length + add_spaces > sizeof buffer)
+            fwrite(data, 1, data_length, out);
+        else {
+            memcpy(buffer + buffer_length, data, data_length);
+            buffer_length += data_length;
+        }
+        if (add_spaces) // fits, checked above
+            buffer[buffer_length++] = i < arg_count - 1 ? ' ' : '\n';
+        length += data_length + add_spaces;
+    }
+    fwrite(buffer, 1, buffer_length, out);
+    return length;
+}
+
+size_t gp_internal_file_print_formatted(
+    FILE* out,
+    const size_t arg_count,
+    const GPInternalFormatted* objs)
+{
+    return gp_s_file_print_formatted(out, arg_count, objs, false);
+}
+
+size_t gp_internal_file_println_formatted(
+    FILE* out,
+    const size_t arg_count,
+    const GPInternalFormatted* objs)
+{
+    return gp_s_file_print_formatted(out, arg_count, objs, true);
+}
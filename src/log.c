@@ -0,0 +1,642 @@
+// MIT License
+// Copyright (c) 2023 Lauri Lorenzo Fiestas
+// https://github.com/PrinssiFiestas/libGPC/blob/main/LICENSE.md
+
+#include <gpc/log.h>
+#include <gpc/assert.h>
+#include <gpc/array.h>
+#include <gpc/endian.h>
+#include <gpc/memory.h>
+#include <printf/printf.h>
+#include <printf/conversions.h>
+#include "common.h"
+#include <string.h>
+
+// Log file layout:
+//
+// Header: "GPLOG", version, sizeof(void*), sizeof(long), sizeof(long double)
+// or 0 if not supported, and 1 if little endian, 0 otherwise.
+//
+// Records: 32-bit format id followed by the arguments. Integers and floats are
+// stored as is, pointers as sizeof(void*) bytes, strings as 32-bit length
+// followed by the characters. Id 0 is a definition of a format, which is
+// followed by 32-bit id, argument count, and format string length, argument
+// types as bytes, and the format string without null-terminator. A definition
+// is always written before any record using it.
+
+#define GP_S_LOG_VERSION     1
+#define GP_S_LOG_HEADER_SIZE 10
+
+GP_MAYBE_ATOMIC uint32_t gp_internal_log_session = GP_INTERNAL_LOG_CLOSED;
+#ifndef GP_NO_THREAD_LOCALS
+GP_MAYBE_THREAD_LOCAL GPInternalLogBuffer* gp_internal_log_thread_buffer = NULL;
+#endif
+
+static GPMutex              gp_s_log_mutex;
+static GPThreadKey          gp_s_log_buffer_key;
+static GPThreadOnce         gp_s_log_once = GP_THREAD_ONCE_INIT;
+static FILE*                gp_s_log_file;
+static GPInternalLogBuffer* gp_s_log_buffers;
+static size_t               gp_s_log_buffer_capacity;
+static uint32_t             gp_s_log_session_count;
+static uint32_t             gp_s_log_format_count;
+
+static void gp_s_log_header(unsigned char header[GP_S_LOG_HEADER_SIZE])
+{
+    memcpy(header, "GPLOG", strlen("GPLOG"));
+    header[5] = GP_S_LOG_VERSION;
+    header[6] = sizeof(void*);
+    header[7] = sizeof(long);
+    #if GP_HAS_LONG_DOUBLE
+    header[8] = sizeof(long double);
+    #else
+    header[8] = 0;
+    #endif
+    header[9] = gp_is_little_endian();
+}
+
+// Mutex must be locked. Records of previous sessions are discarded, they may
+// have been published after the log was closed and refer to old format ids.
+static size_t gp_s_log_flush_buffer(GPInternalLogBuffer* buffer)
+{
+    const size_t tail   = GP_INTERNAL_LOG_LOAD(&buffer->tail, relaxed);
+    const size_t head   = GP_INTERNAL_LOG_LOAD(&buffer->head, acquire);
+    const size_t length = head - tail;
+    const size_t i      = tail & buffer->mask;
+    const size_t first  = gp_min(length, buffer->mask + 1 - i);
+    const bool   current = buffer->session ==
+        GP_INTERNAL_LOG_LOAD(&gp_internal_log_session, relaxed);
+
+    size_t written = 0;
+    if (gp_s_log_file != NULL && current && length != 0) { // discard if closed
+        written += fwrite(buffer->data + i, 1, first, gp_s_log_file);
+        written += fwrite(buffer->data, 1, length - first, gp_s_log_file);
+    }
+    GP_INTERNAL_LOG_STORE(&buffer->tail, head, release);
+    return written;
+}
+
+// Mutex must be locked.
+static size_t gp_s_log_flush_all(void)
+{
+    size_t written = 0;
+    for (GPInternalLogBuffer* buffer = gp_s_log_buffers; buffer != NULL; buffer = buffer->next)
+        written += gp_s_log_flush_buffer(buffer);
+    return written;
+}
+
+static void gp_s_log_delete_buffer(void*_buffer)
+{
+    GPInternalLogBuffer* buffer = _buffer;
+    gp_mutex_lock(&gp_s_log_mutex);
+    gp_s_log_flush_buffer(buffer);
+    GPInternalLogBuffer** node = &gp_s_log_buffers;
+    while (*node != buffer)
+        node = &(*node)->next;
+    *node = buffer->next;
+    gp_mutex_unlock(&gp_s_log_mutex);
+    gp_mem_dealloc(gp_global_heap, buffer);
+}
+
+static void gp_s_log_init(void)
+{
+    gp_mutex_init(&gp_s_log_mutex);
+    gp_thread_key_create(&gp_s_log_buffer_key, gp_s_log_delete_buffer);
+}
+
+// Buffers are reallocated if capacity changed when log was reopened.
+static GPInternalLogBuffer* gp_s_log_thread_buffer(const uint32_t session)
+{
+    #ifndef GP_NO_THREAD_LOCALS
+    GPInternalLogBuffer* buffer = gp_internal_log_thread_buffer;
+    #else
+    GPInternalLogBuffer* buffer = gp_thread_local_get(gp_s_log_buffer_key);
+    #endif
+    if (buffer != NULL && buffer->session == session)
+        return buffer;
+
+    gp_mutex_lock(&gp_s_log_mutex);
+    const size_t capacity = gp_s_log_buffer_capacity;
+    if (buffer != NULL && buffer->mask + 1 == capacity) {
+        // Unflushed records belong to the old session.
+        const size_t head = GP_INTERNAL_LOG_LOAD(&buffer->head, relaxed);
+        GP_INTERNAL_LOG_STORE(&buffer->tail, head, release);
+        buffer->tail_cache = head;
+        buffer->session    = session;
+        gp_mutex_unlock(&gp_s_log_mutex);
+        return buffer;
+    }
+    gp_mutex_unlock(&gp_s_log_mutex);
+    if (buffer != NULL)
+        gp_s_log_delete_buffer(buffer);
+
+    gp_mutex_lock(&gp_s_log_mutex);
+    buffer = gp_mem_alloc(gp_global_heap, sizeof*buffer + capacity);
+    memset(buffer, 0, sizeof*buffer);
+    buffer->mask    = capacity - 1;
+    buffer->session = session;
+    buffer->next    = gp_s_log_buffers;
+    gp_s_log_buffers = buffer;
+    gp_mutex_unlock(&gp_s_log_mutex);
+
+    gp_thread_local_set(gp_s_log_buffer_key, buffer);
+    #ifndef GP_NO_THREAD_LOCALS
+    gp_internal_log_thread_buffer = buffer;
+    #endif
+    return buffer;
+}
+
+static bool gp_s_log_register(GPInternalLogFormat* format, const uint32_t session)
+{
+    gp_db_assert(gp_internal_count_fmt_specs(format->format) <= format->arg_count,
+        "Not enough arguments for format string.", format->format);
+
+    gp_mutex_lock(&gp_s_log_mutex);
+    const bool open = GP_INTERNAL_LOG_LOAD(&gp_internal_log_session, relaxed) == session;
+    if (open && GP_INTERNAL_LOG_LOAD(&format->session, relaxed) != session)
+    {
+        const uint32_t definition[] = {
+            0, ++gp_s_log_format_count, format->arg_count, strlen(format->format)
+        };
+        uint8_t types[64];
+        for (size_t i = 0; i < format->arg_count; ++i)
+            types[i] = format->types[i];
+
+        fwrite(definition,     sizeof definition, 1,  gp_s_log_file);
+        fwrite(types,          1, format->arg_count,  gp_s_log_file);
+        fwrite(format->format, 1, definition[3],      gp_s_log_file);
+
+        format->id = definition[1];
+        GP_INTERNAL_LOG_STORE(&format->session, session, release);
+    }
+    gp_mutex_unlock(&gp_s_log_mutex);
+    return open;
+}
+
+GPInternalLogWriter gp_internal_log_begin_slow(GPInternalLogFormat* format)
+{
+    GPInternalLogWriter writer = { NULL, 0 };
+    const uint32_t session = GP_INTERNAL_LOG_LOAD(&gp_internal_log_session, acquire);
+    if (session == GP_INTERNAL_LOG_CLOSED)
+        return writer;
+
+    gp_thread_once(&gp_s_log_once, gp_s_log_init);
+    GPInternalLogBuffer* buffer = gp_s_log_thread_buffer(session);
+
+    if (GP_INTERNAL_LOG_LOAD(&format->session, acquire) != session &&
+        ! gp_s_log_register(format, session))
+        return writer;
+
+    writer.buffer   = buffer;
+    writer.position = GP_INTERNAL_LOG_LOAD(&buffer->head, relaxed);
+    gp_internal_log_put(&writer, &format->id, sizeof format->id);
+    return writer;
+}
+
+bool gp_internal_log_reserve(GPInternalLogWriter* writer, const size_t size)
+{
+    GPInternalLogBuffer* buffer = writer->buffer;
+    const size_t capacity = buffer->mask + 1;
+
+    buffer->tail_cache = GP_INTERNAL_LOG_LOAD(&buffer->tail, acquire);
+    if (writer->position + size - buffer->tail_cache <= capacity)
+        return true;
+
+    // Drop record if it would not fit even if everything was flushed.
+    if (writer->position + size - GP_INTERNAL_LOG_LOAD(&buffer->head, relaxed) > capacity) {
+        writer->buffer = NULL;
+        return false;
+    }
+    gp_log_flush();
+    buffer->tail_cache = GP_INTERNAL_LOG_LOAD(&buffer->tail, acquire);
+    return true;
+}
+
+bool gp_log_open(FILE* out, const size_t buffer_capacity)
+{
+    gp_log_close(); // also initializes
+
+    size_t capacity = 1;
+    while (capacity < (buffer_capacity != 0 ? buffer_capacity : GP_LOG_DEFAULT_BUFFER_CAPACITY))
+        capacity <<= 1;
+
+    unsigned char header[GP_S_LOG_HEADER_SIZE];
+    gp_s_log_header(header);
+
+    gp_mutex_lock(&gp_s_log_mutex);
+    const bool success = fwrite(header, sizeof header, 1, out) == 1;
+    if (success)
+    {
+        gp_s_log_file            = out;
+        gp_s_log_buffer_capacity = capacity;
+        gp_s_log_format_count    = 0;
+        if (++gp_s_log_session_count == GP_INTERNAL_LOG_CLOSED)
+            gp_s_log_session_count = 1;
+        GP_INTERNAL_LOG_STORE(&gp_internal_log_session, gp_s_log_session_count, release);
+    }
+    gp_mutex_unlock(&gp_s_log_mutex);
+    return success;
+}
+
+size_t gp_log_flush(void)
+{
+    gp_thread_once(&gp_s_log_once, gp_s_log_init);
+    gp_mutex_lock(&gp_s_log_mutex);
+    const size_t written = gp_s_log_flush_all();
+    gp_mutex_unlock(&gp_s_log_mutex);
+    return written;
+}
+
+void gp_log_close(void)
+{
+    gp_thread_once(&gp_s_log_once, gp_s_log_init);
+    gp_mutex_lock(&gp_s_log_mutex);
+    if (gp_s_log_file != NULL) {
+        gp_s_log_flush_all();
+        fflush(gp_s_log_file);
+        gp_s_log_file = NULL;
+    }
+    GP_INTERNAL_LOG_STORE(&gp_internal_log_session, GP_INTERNAL_LOG_CLOSED, release);
+    gp_mutex_unlock(&gp_s_log_mutex);
+}
+
+// ----------------------------------------------------------------------------
+// Decoding
+
+typedef struct gp_log_decoded_format
+{
+    char*    format;
+    uint8_t* types;
+    uint32_t arg_count;
+} GPLogDecodedFormat;
+
+// Integers are stored as 64-bit or 128-bit integers, floats as double or long
+// double, and strings are read to a separate string.
+typedef union gp_log_value
+{
+    long long          i;
+    unsigned long long u;
+    GPInt128           i128;
+    GPUInt128          u128;
+    double             d;
+    #if GP_HAS_LONG_DOUBLE
+    long double        ld;
+    #endif
+    void*              p;
+} GPLogValue;
+
+static bool gp_s_log_read(FILE* in, void* out, const size_t size)
+{
+    return fread(out, 1, size, in) == size;
+}
+
+static bool gp_s_log_read_value(
+    FILE* in, const gp_type_t type, GPLogValue* value, GPString* str)
+{
+    #define GP_S_READ_AS(T, MEMBER) do { \
+        T x; \
+        if ( ! gp_s_log_read(in, &x, sizeof x)) \
+            return false; \
+        value->MEMBER = x; \
+    } while (0)
+
+    switch (type)
+    {
+    case GP_TYPE_BOOL:               GP_S_READ_AS(bool,               u);    break;
+    case GP_TYPE_CHAR:               GP_S_READ_AS(char,               i);    break;
+    case GP_TYPE_SIGNED_CHAR:        GP_S_READ_AS(signed char,        i);    break;
+    case GP_TYPE_UNSIGNED_CHAR:      GP_S_READ_AS(unsigned char,      u);    break;
+    case GP_TYPE_SHORT:              GP_S_READ_AS(short,              i);    break;
+    case GP_TYPE_UNSIGNED_SHORT:     GP_S_READ_AS(unsigned short,     u);    break;
+    case GP_TYPE_INT:                GP_S_READ_AS(int,                i);    break;
+    case GP_TYPE_UNSIGNED:           GP_S_READ_AS(unsigned,           u);    break;
+    case GP_TYPE_LONG:               GP_S_READ_AS(long,               i);    break;
+    case GP_TYPE_UNSIGNED_LONG:      GP_S_READ_AS(unsigned long,      u);    break;
+    case GP_TYPE_LONG_LONG:          GP_S_READ_AS(long long,          i);    break;
+    case GP_TYPE_UNSIGNED_LONG_LONG: GP_S_READ_AS(unsigned long long, u);    break;
+    case GP_TYPE_INT128:             GP_S_READ_AS(GPInt128,           i128); break;
+    case GP_TYPE_UINT128:            GP_S_READ_AS(GPUInt128,          u128); break;
+    case GP_TYPE_FLOAT:              GP_S_READ_AS(float,              d);    break;
+    case GP_TYPE_DOUBLE:             GP_S_READ_AS(double,             d);    break;
+    #if GP_HAS_LONG_DOUBLE
+    case GP_TYPE_LONG_DOUBLE:        GP_S_READ_AS(long double,        ld);   break;
+    #else
+    case GP_TYPE_LONG_DOUBLE:        return false;
+    #endif
+    case GP_TYPE_PTR:                GP_S_READ_AS(void*,              p);    break;
+
+    uint32_t length;
+    case GP_TYPE_CHAR_PTR:
+    case GP_TYPE_STRING:
+        if ( ! gp_s_log_read(in, &length, sizeof length))
+            return false;
+        gp_str_reserve(str, length);
+        if ( ! gp_s_log_read(in, *str, length))
+            return false;
+        gp_str_set(*str)->length = length;
+        break;
+
+    case GP_NO_TYPE:
+    case GP_TYPE_LENGTH:
+        return false;
+    }
+    return true;
+    #undef GP_S_READ_AS
+}
+
+static long long gp_s_log_value_to_int(const gp_type_t type, const GPLogValue value)
+{
+    if (type == GP_TYPE_INT128 || type == GP_TYPE_UINT128)
+        return (long long)gp_uint128_lo(value.u128);
+    if (gp_type_is_signed(type))
+        return value.i;
+    if (gp_type_is_unsigned(type))
+        return (long long)value.u;
+    return 0;
+}
+
+// Conversions that do not match the type of the argument are written like in
+// gp_print().
+static void gp_s_log_write_default(
+    FILE* out, const gp_type_t type, const GPLogValue value, const GPString str)
+{
+    char buf[64];
+    size_t length = 0;
+    switch (type)
+    {
+    case GP_TYPE_BOOL:
+        fputs(value.u ? "true" : "false", out);
+        break;
+
+    case GP_TYPE_CHAR:
+    case GP_TYPE_SIGNED_CHAR:
+    case GP_TYPE_UNSIGNED_CHAR:
+        fputc((unsigned char)value.u, out);
+        break;
+
+    case GP_TYPE_UNSIGNED_SHORT:
+    case GP_TYPE_UNSIGNED:
+    case GP_TYPE_UNSIGNED_LONG:
+    case GP_TYPE_UNSIGNED_LONG_LONG:
+        length = pf_utoa(sizeof buf, buf, value.u);
+        break;
+
+    case GP_TYPE_SHORT:
+    case GP_TYPE_INT:
+    case GP_TYPE_LONG:
+    case GP_TYPE_LONG_LONG:
+        length = pf_itoa(sizeof buf, buf, value.i);
+        break;
+
+    case GP_TYPE_UINT128:
+        length = pf_u128toa(sizeof buf, buf, value.u128);
+        break;
+
+    case GP_TYPE_INT128:
+        length = pf_i128toa(sizeof buf, buf, value.i128);
+        break;
+
+    case GP_TYPE_FLOAT:
+        length = pf_hrtoa(sizeof buf, buf, (float)value.d);
+        break;
+
+    case GP_TYPE_DOUBLE:
+        length = pf_rtoa(sizeof buf, buf, value.d);
+        break;
+
+    case GP_TYPE_LONG_DOUBLE:
+        #if GP_HAS_LONG_DOUBLE
+        length = pf_Lrtoa(sizeof buf, buf, value.ld);
+        #endif
+        break;
+
+    case GP_TYPE_CHAR_PTR:
+    case GP_TYPE_STRING:
+        fwrite(str, 1, gp_str_length(str), out);
+        break;
+
+    case GP_TYPE_PTR:
+        if (value.p != NULL) {
+            memcpy(buf, "0x", strlen("0x"));
+            length = strlen("0x") + pf_xtoa(sizeof buf - strlen("0x"), buf + strlen("0x"), (uintptr_t)value.p);
+        } else
+            fputs("(nil)", out);
+        break;
+
+    case GP_NO_TYPE:
+    case GP_TYPE_LENGTH:
+        GP_UNREACHABLE("");
+    }
+    fwrite(buf, 1, length, out);
+}
+
+// Rebuild format specifier with resolved asterisks and given length modifier.
+static const char* gp_s_log_specifier(
+    char buf[GP_STATIC 64],
+    const PFFormatSpecifier spec,
+    const char* length_modifier,
+    const char conversion)
+{
+    char* c = buf;
+    *c++ = '%';
+    if (spec.flag.dash)  *c++ = '-';
+    if (spec.flag.plus)  *c++ = '+';
+    if (spec.flag.space) *c++ = ' ';
+    if (spec.flag.hash)  *c++ = '#';
+    if (spec.flag.zero)  *c++ = '0';
+    if (spec.field.width != 0)
+        c += pf_utoa(16, c, spec.field.width);
+    if (spec.precision.option == PF_SOME) {
+        *c++ = '.';
+        c += pf_utoa(16, c, spec.precision.width);
+    }
+    strcpy(c, length_modifier);
+    c += strlen(length_modifier);
+    *c++ = conversion;
+    *c   = '\0';
+    return buf;
+}
+
+static void gp_s_log_write_value(
+    FILE* out,
+    const PFFormatSpecifier spec,
+    const gp_type_t type,
+    const GPLogValue value,
+    GPString str)
+{
+    char fmt[64];
+    const char conversion = spec.conversion_format;
+
+    if (gp_type_is_integral(type) && strchr("diouxXc", conversion) != NULL)
+    {
+        if (conversion == 'c') {
+            pf_fprintf(out, gp_s_log_specifier(fmt, spec, "", 'c'), (int)value.i);
+            return;
+        }
+        static const char* modifiers[] = { "", "w8", "w16", "", "w32", "", "", "", "w64" };
+        const size_t size  = gp_type_size(type);
+        const bool   is_signed_conversion = conversion == 'd' || conversion == 'i';
+        // Unsigned arguments are never printed negative.
+        const char   actual_conversion =
+            is_signed_conversion && gp_type_is_unsigned(type) ? 'u' : conversion;
+
+        if (size == 16 && actual_conversion != 'u' && is_signed_conversion)
+            pf_fprintf(out, gp_s_log_specifier(fmt, spec, "w128", actual_conversion), value.i128);
+        else if (size == 16)
+            pf_fprintf(out, gp_s_log_specifier(fmt, spec, "w128", actual_conversion), value.u128);
+        else if (size == 8 && actual_conversion != 'u' && is_signed_conversion)
+            pf_fprintf(out, gp_s_log_specifier(fmt, spec, modifiers[size], actual_conversion), (int64_t)value.i);
+        else if (size == 8)
+            pf_fprintf(out, gp_s_log_specifier(fmt, spec, modifiers[size], actual_conversion), (uint64_t)value.u);
+        else if (actual_conversion != 'u' && is_signed_conversion)
+            pf_fprintf(out, gp_s_log_specifier(fmt, spec, modifiers[size], actual_conversion), (int)value.i);
+        else
+            pf_fprintf(out, gp_s_log_specifier(fmt, spec, modifiers[size], actual_conversion), (unsigned)value.u);
+    }
+    else if (gp_type_is_float(type) && strchr("fFeEgGr", conversion) != NULL)
+    {
+        #if GP_HAS_LONG_DOUBLE
+        if (type == GP_TYPE_LONG_DOUBLE) {
+            pf_fprintf(out, gp_s_log_specifier(fmt, spec, "L", conversion), value.ld);
+            return;
+        }
+        #endif
+        const char* modifier = type == GP_TYPE_FLOAT && conversion == 'r' ? "h" : "";
+        pf_fprintf(out, gp_s_log_specifier(fmt, spec, modifier, conversion), value.d);
+    }
+    else if (gp_type_is_string(type) && strchr("syYvq", conversion) != NULL)
+    { // encoding conversions read exactly precision bytes, which were logged
+        PFFormatSpecifier clamped = spec;
+        if (conversion != 's' && clamped.precision.width > gp_str_length(str))
+            clamped.precision.width = gp_str_length(str);
+        pf_fprintf(out, gp_s_log_specifier(fmt, clamped, "", conversion), gp_cstr(str));
+    }
+    else if (gp_type_is_string(type) && conversion == 'S')
+        pf_fprintf(out, gp_s_log_specifier(fmt, spec, "", 'S'), str);
+    else if (type == GP_TYPE_PTR && conversion == 'p')
+        pf_fprintf(out, gp_s_log_specifier(fmt, spec, "", 'p'), value.p);
+    else
+        gp_s_log_write_default(out, type, value, str);
+}
+
+static bool gp_s_log_decode_record(
+    FILE* out, FILE* in, const GPLogDecodedFormat* format, GPString* str)
+{
+    const char* fmt = format->format;
+    uint32_t i = 0;
+    GPLogValue value;
+
+    while (true)
+    {
+        PFFormatSpecifier spec = pf_scan_format_string(fmt, NULL);
+        if (spec.string == NULL)
+            break;
+        fwrite(fmt, 1, spec.string - fmt, out);
+        fmt = spec.string + spec.string_length;
+
+        if (spec.conversion_format == '%') {
+            fputc('%', out);
+            continue;
+        }
+        if (spec.field.asterisk)
+        {
+            long long width = 0;
+            if (i < format->arg_count) {
+                if ( ! gp_s_log_read_value(in, format->types[i], &value, str))
+                    return false;
+                width = gp_s_log_value_to_int(format->types[i++], value);
+            }
+            spec.field.asterisk = false;
+            spec.flag.dash     |= width < 0;
+            spec.field.width    = width < 0 ? -width : width;
+        }
+        if (spec.precision.option == PF_ASTERISK)
+        {
+            long long precision = -1;
+            if (i < format->arg_count) {
+                if ( ! gp_s_log_read_value(in, format->types[i], &value, str))
+                    return false;
+                precision = gp_s_log_value_to_int(format->types[i++], value);
+            }
+            spec.precision.option = precision < 0 ? PF_NONE : PF_SOME;
+            spec.precision.width  = precision < 0 ? 0 : precision;
+        }
+        if (i == format->arg_count) { // missing argument, keep specifier as is
+            fwrite(spec.string, 1, spec.string_length, out);
+            continue;
+        }
+        if ( ! gp_s_log_read_value(in, format->types[i], &value, str))
+            return false;
+        gp_s_log_write_value(out, spec, format->types[i++], value, *str);
+    }
+    fputs(fmt, out);
+
+    for (; i < format->arg_count; ++i) {
+        if ( ! gp_s_log_read_value(in, format->types[i], &value, str))
+            return false;
+        fputc(' ', out);
+        gp_s_log_write_default(out, format->types[i], value, *str);
+    }
+    fputc('\n', out);
+    return true;
+}
+
+static bool gp_s_log_read_definition(
+    FILE* in, GPAllocator* allocator, GPArray(GPLogDecodedFormat)* formats)
+{
+    uint32_t definition[3]; // id, argument count, format length
+    if ( ! gp_s_log_read(in, definition, sizeof definition))
+        return false;
+    if (definition[0] != gp_arr_length(*formats) + 1 || definition[1] > 64)
+        return false;
+
+    GPLogDecodedFormat format = {
+        .format    = gp_mem_alloc(allocator, definition[2] + sizeof""),
+        .types     = gp_mem_alloc(allocator, definition[1] + sizeof""),
+        .arg_count = definition[1]
+    };
+    if ( ! gp_s_log_read(in, format.types, format.arg_count))
+        return false;
+    for (size_t i = 0; i < format.arg_count; ++i)
+        if (format.types[i] == GP_NO_TYPE || format.types[i] >= GP_TYPE_LENGTH)
+            return false;
+    if ( ! gp_s_log_read(in, format.format, definition[2]))
+        return false;
+    format.format[definition[2]] = '\0';
+
+    gp_arr_push(sizeof format, formats, &format);
+    return true;
+}
+
+bool gp_log_decode(FILE* out, FILE* in)
+{
+    unsigned char header[GP_S_LOG_HEADER_SIZE];
+    unsigned char expected_header[GP_S_LOG_HEADER_SIZE];
+    gp_s_log_header(expected_header);
+    if ( ! gp_s_log_read(in, header, sizeof header) ||
+        memcmp(header, expected_header, sizeof header) != 0)
+        return false;
+
+    GPArena* arena = gp_arena_new(NULL, 4096);
+    GPArray(GPLogDecodedFormat) formats = gp_arr_new(sizeof formats[0], &arena->base, 16);
+    GPString str = gp_str_new(&arena->base, 64);
+    bool success = true;
+
+    while (success)
+    {
+        uint32_t id;
+        const size_t id_length = fread(&id, 1, sizeof id, in);
+        if (id_length == 0 && feof(in))
+            break;
+        else if (id_length != sizeof id)
+            success = false;
+        else if (id == 0)
+            success = gp_s_log_read_definition(in, &arena->base, &formats);
+        else if (id > gp_arr_length(formats))
+            success = false;
+        else
+            success = gp_s_log_decode_record(out, in, &formats[id - 1], &str);
+    }
+    gp_arena_delete(arena);
+    return success;
+}
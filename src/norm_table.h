@@ -0,0 +1,3118 @@
+// MIT License
+// Copyright (c) 2023 Lauri Lorenzo Fiestas
+// https://github.com/PrinssiFiestas/libGPC/blob/main/LICENSE.md
+
+// Generated by tools/normtablegen.c from UCD 14.0.0. Do not edit!
+// Total size of stages: 22181 bytes, records: 15312 bytes, decompositions: 21893
+// bytes, compositions: 11292 bytes.
+
+#ifndef GP_NORM_TABLE_H
+#define GP_NORM_TABLE_H
+
+#include <stdint.h>
+
+#define GP_NORM_TABLE_LIMIT  0x2FA80
+#define GP_NORM_STAGE1_SHIFT 4
+#define GP_NORM_STAGE1_MASK  0xF
+#define GP_NORM_STAGE2_SHIFT 3
+#define GP_NORM_STAGE2_MASK  0x7
+
+#define GP_NORM_NFD_NO     0x1
+#define GP_NORM_NFC_NO     0x2
+#define GP_NORM_NFC_MAYBE  0x4
+#define GP_NORM_NFKD_NO    0x8
+#define GP_NORM_NFKC_NO    0x10
+#define GP_NORM_NFKC_MAYBE 0x20
+
+// Bytes smaller than these only start codepoints that are normalized.
+#define GP_NORM_NFD_MIN_LEAD_BYTE  0xC3
+#define GP_NORM_NFC_MIN_LEAD_BYTE  0xCC
+#define GP_NORM_NFKD_MIN_LEAD_BYTE 0xC2
+#define GP_NORM_NFKC_MIN_LEAD_BYTE 0xC2
+
+static const uint8_t gp_norm_stage0[1525] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+    31, 32, 33, 34, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 36, 37,
+    0, 38, 39, 0, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+    52, 53, 54, 55, 56, 57, 58, 0, 59, 60, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 61, 62, 0, 0, 63, 64, 65, 66, 0, 67, 68, 69,
+    70, 71, 72, 73, 74, 75, 76, 77, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 78, 79, 80, 81,
+    82, 83, 84, 85, 0, 86, 87, 88, 89, 89, 89, 89, 89, 89, 89, 89,
+    89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+    89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+    89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+    89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+    89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 90,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104,
+    0, 0, 0, 105, 0, 106, 107, 0, 0, 0, 0, 0, 0, 0, 0, 108,
+    0, 0, 0, 0, 109, 110, 0, 0, 0, 0, 111, 0, 0, 112, 113, 114,
+    115, 116, 117, 118, 119, 120, 121, 0, 122, 123, 0, 124, 125, 126, 127, 0,
+    128, 0, 129, 130, 131, 132, 0, 0, 125, 0, 133, 134, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 135, 136, 0, 0, 0, 0, 0, 0, 0, 0, 137,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 138, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 139, 140, 141, 0, 0, 0, 142, 143, 144, 145, 146, 147, 148, 149,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    150, 0, 136, 0, 0, 151, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 152, 153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 154, 155, 0, 0,
+    0, 0, 156, 157, 158, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 159, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    160, 161, 162, 163, 164,
+};
+
+static const uint16_t gp_norm_stage1[2640] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+    13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28,
+    0, 0, 0, 0, 29, 30, 31, 0, 32, 33, 34, 35, 36, 37, 38, 39,
+    40, 41, 42, 43, 44, 45, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 47, 48, 0, 0, 0, 49, 50, 0, 0, 0,
+    51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66,
+    67, 68, 69, 0, 0, 70, 71, 0, 0, 72, 73, 0, 0, 0, 74, 75,
+    76, 77, 0, 78, 0, 0, 0, 79, 0, 0, 80, 81, 0, 0, 82, 0,
+    83, 0, 0, 0, 0, 0, 0, 0, 84, 0, 85, 86, 87, 88, 89, 90,
+    91, 0, 92, 93, 94, 95, 96, 97, 98, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 64, 99, 100, 0, 0, 0, 0, 101, 102, 103, 0, 0, 104, 105,
+    0, 0, 0, 0, 0, 0, 0, 0, 106, 0, 107, 108, 109, 110, 0, 0,
+    0, 0, 111, 0, 0, 0, 112, 113, 114, 115, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 116, 117,
+    0, 0, 118, 119, 120, 121, 0, 0, 0, 0, 0, 122, 0, 0, 0, 0,
+    0, 0, 0, 123, 0, 0, 0, 0, 0, 124, 125, 64, 126, 127, 128, 129,
+    0, 0, 0, 0, 0, 130, 131, 132, 0, 133, 134, 135, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 136, 0, 137, 138, 139, 0, 0, 0, 140,
+    0, 0, 0, 0, 0, 0, 141, 142, 0, 133, 0, 143, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 142, 0, 133, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 136, 0, 144, 145, 146, 0, 0, 0, 0,
+    0, 0, 147, 0, 0, 0, 0, 148, 0, 149, 138, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 142, 0, 150, 151, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 142, 152, 153, 154, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 155, 0, 156, 138, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 0, 158, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 159, 160, 0, 161, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 162, 163, 0, 164, 0, 165, 0, 0, 0, 0,
+    0, 166, 0, 167, 0, 0, 168, 169, 170, 171, 172, 173, 0, 174, 175, 176,
+    177, 0, 178, 179, 180, 181, 0, 182, 183, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 184, 148, 185, 186, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 117, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 187,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 188, 189, 190, 0,
+    0, 0, 0, 0, 0, 189, 189, 189, 191, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 192, 0, 0, 0, 0,
+    0, 0, 193, 0, 0, 0, 194, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 195, 196, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 198, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 199, 200, 0, 0, 0, 0, 0, 0, 0, 0, 201, 0, 192, 202,
+    0, 0, 0, 0, 0, 0, 203, 204, 205, 206, 0, 0, 0, 0, 0, 0,
+    207, 208, 209, 0, 0, 0, 210, 211, 212, 0, 0, 0, 0, 213, 214, 0,
+    0, 0, 0, 0, 0, 215, 0, 0, 0, 0, 0, 0, 216, 0, 215, 0,
+    0, 0, 0, 0, 0, 0, 185, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 217, 218, 219, 220, 221, 222,
+    0, 0, 0, 0, 0, 223, 224, 225, 226, 227, 228, 229, 230, 231, 0, 232,
+    0, 0, 0, 233, 234, 235, 236, 237, 238, 239, 240, 64, 64, 64, 241, 242,
+    243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258,
+    259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274,
+    275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290,
+    291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306,
+    307, 308, 309, 0, 310, 311, 312, 313, 314, 315, 316, 311, 0, 0, 317, 318,
+    319, 320, 321, 322, 0, 323, 0, 0, 0, 0, 324, 325, 326, 327, 328, 0,
+    329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344,
+    0, 345, 0, 346, 0, 347, 0, 0, 0, 348, 0, 0, 0, 0, 0, 0,
+    349, 350, 0, 0, 351, 352, 353, 0, 354, 355, 0, 0, 356, 357, 358, 359,
+    360, 361, 0, 0, 0, 362, 0, 0, 0, 0, 0, 0, 363, 364, 0, 0,
+    0, 0, 0, 0, 0, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 366, 367, 368, 369,
+    370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 0, 0,
+    0, 384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 385, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 386, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 387,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 199, 222, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 389,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 64, 64, 64,
+    0, 0, 0, 390, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 391, 0,
+    392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407,
+    408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 419, 420, 421, 0, 422, 423, 424, 425, 426, 427, 428,
+    0, 0, 429, 430, 0, 431, 432, 433, 434, 435, 436, 437, 0, 0, 438, 439,
+    0, 0, 0, 0, 0, 0, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
+    450, 451, 452, 453, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    454, 455, 456, 457, 458, 459, 460, 461, 462, 0, 463, 464, 465, 466, 467, 468,
+    469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484,
+    485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500,
+    501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 199, 517, 518,
+    0, 0, 0, 519, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 222, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 520, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 521, 522,
+    523, 0, 0, 0, 0, 194, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 194, 0, 0, 0, 64, 64, 222, 0,
+    0, 0, 0, 0, 0, 524, 0, 0, 0, 0, 525, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 526, 0, 201, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 527, 528, 529, 0, 0, 0, 0, 0, 523, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 530, 0, 531, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 133, 0, 0,
+    532, 532, 532, 532, 532, 532, 532, 532, 532, 532, 532, 532, 532, 532, 532, 532,
+    532, 532, 532, 532, 533, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549,
+    550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565,
+    566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581,
+    582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 0, 0, 0, 0,
+    594, 0, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608,
+    609, 610, 611, 612, 613, 614, 615, 0, 0, 0, 616, 617, 618, 619, 620, 621,
+    622, 623, 624, 625, 626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637,
+    638, 639, 640, 641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653,
+    654, 655, 656, 657, 658, 659, 660, 661, 0, 0, 662, 663, 664, 665, 666, 667,
+    668, 669, 670, 671, 672, 673, 674, 675, 676, 0, 0, 0, 0, 0, 677, 678,
+    0, 0, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692,
+    693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708,
+    709, 710, 319, 711, 712, 713, 714, 715, 716, 717, 718, 719, 720, 721, 722, 723,
+    724, 725, 726, 727, 728, 441, 442, 729, 730, 731, 732, 733, 734, 735, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 117,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 200, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 736,
+    737, 738, 739, 740, 741, 742, 743, 744, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 745, 0, 0, 0, 0, 0, 746, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 747, 0, 0, 0,
+    0, 0, 0, 0, 517, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 748, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 749, 750, 200, 0, 0, 0, 0, 0,
+    751, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 523, 0, 0, 0, 0, 0, 201, 389,
+    0, 0, 0, 752, 0, 753, 0, 754, 0, 0, 0, 0, 0, 0, 0, 0,
+    736, 0, 0, 0, 138, 755, 756, 0, 0, 0, 0, 0, 0, 0, 526, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 201, 757, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 758, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 759, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 760, 0, 761, 138, 0, 118, 762, 762, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 763, 0, 0, 140, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 764, 765, 766, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 138, 0, 767, 768, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 389, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 769, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 525, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 770, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 764, 771, 526, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 201, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 194, 0, 389, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 772, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 773, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 389, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 774, 0,
+    0, 0, 0, 0, 0, 0, 775, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 776, 0,
+    0, 0, 0, 777, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 778, 779, 780, 781, 782,
+    783, 784, 0, 0, 0, 785, 0, 786, 787, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 788, 0, 0, 0, 0, 0, 0, 0,
+    789, 790, 791, 792, 793, 794, 795, 796, 797, 798, 799, 800, 801, 789, 790, 791,
+    792, 793, 794, 802, 803, 804, 798, 805, 806, 801, 789, 790, 791, 792, 793, 794,
+    807, 808, 809, 810, 811, 800, 801, 812, 813, 814, 815, 793, 794, 795, 796, 797,
+    798, 811, 800, 801, 789, 790, 791, 792, 793, 794, 795, 796, 797, 798, 811, 800,
+    801, 789, 790, 791, 792, 793, 794, 795, 796, 797, 798, 811, 800, 801, 789, 790,
+    791, 792, 793, 794, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827,
+    828, 829, 830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 843,
+    844, 845, 817, 818, 819, 820, 821, 822, 823, 846, 847, 319, 848, 849, 850, 847,
+    775, 64, 64, 851, 852, 736, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 140, 0, 0, 0, 0, 0, 0, 0, 517, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 853, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 517, 854, 0, 0, 0, 0, 0, 0,
+    855, 856, 857, 858, 859, 860, 861, 862, 863, 864, 865, 866, 859, 867, 861, 868,
+    869, 870, 857, 871, 872, 870, 857, 871, 0, 0, 0, 0, 0, 0, 0, 0,
+    873, 874, 875, 876, 877, 878, 789, 790, 791, 879, 0, 0, 0, 880, 0, 0,
+    0, 0, 881, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    882, 0, 883, 884, 885, 886, 887, 888, 889, 890, 891, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 319, 892,
+    893, 894, 895, 896, 897, 898, 899, 900, 901, 902, 903, 904, 905, 906, 907, 908,
+    909, 910, 911, 912, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924,
+    925, 926, 927, 928, 929, 930, 931, 932, 933, 934, 935, 936, 937, 938, 939, 940,
+    941, 942, 943, 944, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956,
+    957, 958, 959, 960, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t gp_norm_stage2[7688] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 3, 0, 0, 0, 0, 4, 0, 0, 5, 6, 7, 8, 0, 0,
+    9, 10, 11, 0, 12, 13, 14, 0, 15, 16, 17, 18, 19, 20, 0, 21,
+    22, 23, 24, 25, 26, 27, 28, 29, 0, 30, 31, 32, 33, 34, 35, 0,
+    0, 36, 37, 38, 39, 40, 0, 0, 41, 42, 43, 44, 45, 46, 0, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 0, 56, 57, 58, 59, 60, 61, 0,
+    0, 62, 63, 64, 65, 66, 0, 67, 68, 69, 70, 71, 72, 73, 74, 75,
+    76, 77, 78, 79, 80, 81, 82, 83, 0, 0, 84, 85, 86, 87, 88, 89,
+    90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 0, 0,
+    104, 105, 106, 107, 108, 109, 110, 111, 112, 0, 113, 114, 115, 116, 117, 118,
+    0, 119, 120, 121, 122, 123, 124, 125, 126, 0, 0, 127, 128, 129, 130, 131,
+    132, 133, 0, 0, 134, 135, 136, 137, 138, 139, 0, 0, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 0, 0,
+    158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173,
+    174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 184, 185, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197,
+    198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 0, 211, 212,
+    213, 214, 215, 216, 0, 0, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226,
+    227, 228, 229, 230, 231, 232, 0, 0, 233, 234, 235, 236, 237, 238, 239, 240,
+    241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256,
+    257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 0, 0, 269, 270,
+    0, 0, 0, 0, 0, 0, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280,
+    281, 282, 283, 284, 0, 0, 0, 0, 285, 286, 287, 288, 289, 290, 291, 292,
+    293, 0, 0, 0, 0, 0, 0, 0, 294, 295, 296, 297, 298, 299, 0, 0,
+    300, 301, 181, 302, 303, 0, 0, 0, 304, 304, 304, 304, 304, 305, 304, 304,
+    304, 304, 304, 304, 304, 305, 305, 304, 305, 304, 305, 304, 304, 306, 307, 307,
+    307, 307, 306, 308, 307, 307, 307, 307, 307, 309, 309, 310, 310, 310, 310, 311,
+    311, 307, 307, 307, 307, 310, 310, 307, 310, 310, 307, 307, 312, 312, 312, 312,
+    313, 307, 307, 307, 307, 305, 305, 305, 314, 315, 304, 316, 317, 318, 305, 307,
+    307, 307, 305, 305, 305, 307, 307, 0, 305, 305, 305, 307, 307, 307, 307, 305,
+    306, 307, 307, 305, 319, 320, 320, 319, 320, 320, 319, 305, 305, 305, 305, 305,
+    305, 305, 305, 305, 305, 305, 305, 305, 0, 0, 0, 0, 321, 0, 0, 0,
+    0, 0, 322, 0, 0, 0, 323, 0, 0, 0, 0, 0, 7, 324, 325, 326,
+    327, 328, 329, 0, 330, 0, 331, 332, 333, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 334, 335, 336, 337, 338, 339, 340, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 341, 342, 343, 344, 345, 0, 346, 347, 348, 349, 350, 351, 352, 0,
+    353, 354, 355, 0, 356, 357, 0, 0, 0, 358, 0, 0, 0, 0, 0, 0,
+    359, 360, 0, 361, 0, 0, 0, 362, 0, 0, 0, 0, 363, 364, 365, 0,
+    0, 366, 0, 0, 0, 0, 0, 0, 0, 367, 0, 0, 0, 0, 0, 0,
+    368, 369, 0, 370, 0, 0, 0, 371, 0, 0, 0, 0, 372, 373, 374, 0,
+    0, 0, 0, 0, 0, 0, 375, 376, 0, 0, 0, 305, 305, 305, 305, 305,
+    0, 377, 378, 0, 0, 0, 0, 0, 379, 380, 381, 382, 0, 0, 383, 384,
+    0, 0, 385, 386, 387, 388, 389, 390, 0, 0, 391, 392, 393, 394, 395, 396,
+    0, 0, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 0, 0,
+    409, 410, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 411,
+    0, 307, 305, 305, 305, 305, 307, 305, 305, 305, 412, 307, 305, 305, 305, 305,
+    305, 305, 307, 307, 307, 307, 307, 307, 305, 305, 307, 305, 305, 412, 413, 305,
+    414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 423, 424, 425, 426, 0, 427,
+    0, 428, 429, 0, 305, 307, 0, 422, 430, 431, 432, 0, 0, 0, 0, 0,
+    0, 0, 433, 434, 435, 436, 437, 0, 0, 0, 0, 438, 439, 440, 430, 431,
+    432, 441, 442, 304, 304, 310, 307, 305, 305, 305, 305, 305, 307, 305, 305, 307,
+    443, 0, 0, 0, 0, 444, 445, 446, 447, 0, 0, 0, 0, 0, 0, 0,
+    448, 0, 449, 0, 0, 0, 0, 0, 0, 0, 0, 450, 0, 0, 305, 305,
+    305, 305, 305, 305, 305, 0, 0, 305, 305, 305, 305, 307, 305, 0, 0, 305,
+    305, 0, 307, 305, 305, 307, 0, 0, 0, 451, 0, 0, 0, 0, 0, 0,
+    305, 307, 305, 305, 307, 305, 305, 307, 307, 307, 305, 307, 307, 305, 307, 305,
+    305, 305, 307, 305, 307, 305, 307, 305, 307, 305, 305, 0, 0, 0, 0, 0,
+    305, 305, 307, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 307, 0, 0,
+    0, 0, 0, 0, 0, 0, 305, 305, 305, 305, 0, 305, 305, 305, 305, 305,
+    305, 305, 305, 305, 0, 305, 305, 305, 0, 305, 305, 305, 305, 305, 0, 0,
+    0, 307, 307, 307, 0, 0, 0, 0, 305, 307, 307, 307, 305, 305, 305, 305,
+    0, 0, 305, 305, 305, 305, 305, 307, 307, 307, 307, 307, 305, 305, 305, 305,
+    305, 305, 0, 307, 305, 305, 307, 305, 305, 307, 305, 305, 305, 307, 307, 307,
+    438, 439, 440, 305, 305, 305, 307, 305, 305, 307, 307, 305, 305, 305, 305, 305,
+    0, 452, 0, 0, 0, 0, 0, 0, 0, 453, 0, 0, 454, 0, 0, 0,
+    0, 0, 0, 0, 455, 0, 0, 0, 0, 0, 0, 0, 0, 456, 0, 0,
+    0, 305, 307, 305, 305, 0, 0, 0, 457, 458, 459, 460, 461, 462, 463, 464,
+    0, 0, 0, 0, 465, 0, 466, 0, 0, 0, 0, 467, 468, 456, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 466, 0, 0, 0, 0, 469, 470, 0, 471,
+    0, 0, 0, 0, 0, 0, 305, 0, 0, 0, 0, 472, 0, 0, 473, 0,
+    0, 0, 0, 0, 465, 0, 0, 0, 0, 474, 475, 476, 0, 0, 477, 0,
+    478, 0, 0, 479, 480, 456, 0, 0, 0, 0, 0, 0, 0, 0, 466, 466,
+    0, 0, 0, 0, 481, 482, 0, 0, 0, 0, 0, 0, 483, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 466, 0, 0, 0, 484, 485, 486, 456, 0, 0,
+    487, 0, 0, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 488, 489, 0,
+    490, 0, 466, 0, 0, 0, 0, 491, 492, 0, 493, 494, 0, 456, 0, 0,
+    0, 0, 0, 0, 0, 466, 466, 0, 0, 0, 0, 456, 456, 0, 466, 0,
+    0, 0, 495, 496, 497, 456, 0, 0, 0, 0, 498, 0, 0, 0, 0, 466,
+    0, 0, 499, 0, 500, 501, 502, 466, 0, 0, 0, 503, 0, 0, 0, 0,
+    504, 504, 456, 0, 0, 0, 0, 0, 505, 505, 505, 505, 0, 0, 0, 0,
+    0, 0, 0, 506, 0, 0, 0, 0, 507, 507, 456, 0, 0, 0, 0, 0,
+    508, 508, 508, 508, 0, 0, 0, 0, 0, 0, 0, 0, 509, 510, 0, 0,
+    0, 0, 0, 0, 511, 0, 0, 0, 307, 307, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 307, 0, 307, 0, 512, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 513, 0, 0, 0, 0, 0, 0, 0, 0, 0, 514, 0, 0,
+    0, 0, 515, 0, 0, 0, 0, 516, 0, 0, 0, 0, 517, 0, 0, 0,
+    0, 518, 0, 0, 0, 0, 0, 0, 0, 519, 520, 521, 522, 523, 524, 525,
+    526, 527, 520, 520, 520, 520, 0, 0, 520, 528, 305, 305, 456, 0, 305, 305,
+    0, 0, 0, 529, 0, 0, 0, 0, 0, 0, 0, 0, 0, 530, 0, 0,
+    0, 0, 531, 0, 0, 0, 0, 532, 0, 0, 0, 0, 533, 0, 0, 0,
+    0, 534, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 307, 0,
+    0, 0, 0, 0, 0, 0, 535, 0, 0, 0, 0, 0, 0, 0, 0, 465,
+    0, 456, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 536, 0, 0, 0,
+    0, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+    466, 466, 466, 466, 466, 466, 0, 0, 466, 466, 466, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 305, 305, 305, 0, 0, 0, 0, 456, 456, 0, 0,
+    0, 0, 0, 0, 456, 0, 0, 0, 0, 0, 456, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 305, 0, 0, 0, 413, 0, 0, 0, 0, 0, 0,
+    0, 412, 305, 307, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305,
+    307, 0, 0, 0, 0, 0, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0,
+    305, 305, 305, 305, 305, 0, 0, 307, 305, 305, 305, 305, 305, 307, 307, 307,
+    307, 307, 307, 305, 305, 307, 0, 307, 307, 305, 305, 307, 307, 305, 305, 305,
+    305, 305, 307, 305, 305, 305, 305, 0, 0, 0, 0, 0, 0, 0, 537, 0,
+    538, 0, 539, 0, 540, 0, 541, 0, 0, 0, 542, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 465, 466, 0, 0, 0, 0, 0, 543, 0, 544, 0, 0,
+    545, 546, 0, 547, 456, 0, 0, 0, 0, 0, 0, 305, 307, 305, 305, 305,
+    305, 305, 305, 305, 0, 0, 0, 0, 0, 0, 456, 456, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 465, 0, 305, 305, 305, 0, 312, 307, 307, 307,
+    307, 307, 305, 305, 307, 307, 307, 307, 305, 0, 312, 312, 312, 312, 312, 312,
+    312, 0, 0, 0, 0, 307, 0, 0, 0, 0, 0, 0, 305, 0, 0, 0,
+    305, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 548, 549, 550, 0,
+    551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 0, 562, 563, 564, 565,
+    566, 567, 568, 3, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 0, 579,
+    580, 581, 11, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 346, 592, 593,
+    351, 594, 595, 288, 587, 590, 346, 592, 354, 351, 594, 0, 0, 0, 0, 0,
+    596, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 597, 598, 599, 600, 577,
+    601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616,
+    617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629, 630, 631, 347,
+    305, 305, 307, 305, 305, 305, 305, 305, 305, 305, 307, 305, 305, 320, 632, 307,
+    309, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 306, 413,
+    413, 307, 633, 305, 319, 307, 305, 307, 634, 635, 636, 637, 638, 639, 640, 641,
+    642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657,
+    658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673,
+    674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689,
+    690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705,
+    706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719, 720, 721,
+    722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735, 736, 737,
+    738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753,
+    754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769,
+    770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782, 783, 784, 785,
+    786, 787, 788, 789, 0, 0, 0, 0, 790, 791, 792, 793, 794, 795, 796, 797,
+    798, 799, 800, 801, 802, 803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 813,
+    814, 815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829,
+    830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 843, 844, 845,
+    846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858, 859, 860, 861,
+    862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874, 875, 876, 877,
+    878, 879, 0, 0, 0, 0, 0, 0, 880, 881, 882, 883, 884, 885, 886, 887,
+    888, 889, 890, 891, 892, 893, 894, 895, 896, 897, 898, 899, 900, 901, 0, 0,
+    902, 903, 904, 905, 906, 907, 0, 0, 908, 909, 910, 911, 912, 913, 914, 915,
+    916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927, 928, 929, 930, 931,
+    932, 933, 934, 935, 936, 937, 938, 939, 940, 941, 942, 943, 944, 945, 0, 0,
+    946, 947, 948, 949, 950, 951, 0, 0, 952, 953, 954, 955, 956, 957, 958, 959,
+    0, 960, 0, 961, 0, 962, 0, 963, 964, 965, 966, 967, 968, 969, 970, 971,
+    972, 973, 974, 975, 976, 977, 978, 979, 980, 981, 982, 983, 984, 985, 986, 987,
+    988, 989, 990, 991, 992, 993, 0, 0, 994, 995, 996, 997, 998, 999, 1000, 1001,
+    1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017,
+    1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033,
+    1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 0, 1047, 1048,
+    1049, 1050, 1051, 1052, 1053, 1054, 1055, 1054, 1056, 1057, 1058, 1059, 1060, 0, 1061, 1062,
+    1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 0, 0, 1075, 1076,
+    1077, 1078, 1079, 1080, 0, 1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091,
+    1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 0, 0, 1100, 1101, 1102, 0, 1103, 1104,
+    1105, 1106, 1107, 1108, 1109, 1110, 1111, 0, 1112, 1113, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 1114, 0, 0, 0, 0, 0, 1115,
+    0, 0, 0, 0, 1116, 1117, 1118, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 1119, 1120, 0, 1121, 1122, 0, 0, 0, 0, 1123, 0, 1124, 0,
+    0, 0, 0, 0, 0, 0, 0, 1125, 1126, 1127, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1128, 1129, 595, 0, 0, 1130, 1131, 1132, 1133,
+    1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1129, 10, 5, 6, 1130, 1131, 1132, 1133,
+    1134, 1135, 1136, 1137, 1138, 1139, 1140, 0, 3, 574, 11, 302, 575, 285, 579, 301,
+    580, 1141, 585, 181, 586, 0, 0, 0, 1142, 0, 0, 0, 0, 0, 0, 0,
+    305, 305, 312, 312, 305, 305, 305, 305, 312, 312, 312, 305, 305, 0, 0, 0,
+    0, 305, 0, 0, 0, 312, 312, 305, 307, 305, 312, 312, 307, 307, 307, 307,
+    305, 0, 0, 0, 0, 0, 0, 0, 1143, 1144, 1145, 1146, 0, 1147, 1148, 1149,
+    0, 1150, 578, 555, 555, 555, 285, 1151, 556, 556, 559, 301, 0, 561, 1152, 0,
+    0, 564, 1153, 565, 565, 565, 0, 0, 1154, 1155, 1156, 0, 1157, 0, 1158, 0,
+    1157, 0, 1159, 1160, 550, 1145, 0, 574, 552, 1161, 0, 560, 11, 1162, 1163, 1164,
+    1165, 595, 0, 1166, 352, 592, 1167, 1168, 1169, 0, 0, 0, 0, 551, 573, 574,
+    595, 287, 0, 0, 0, 0, 0, 0, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177,
+    1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185, 556, 1186, 1187, 1188, 1189, 1190, 1191, 1192,
+    1193, 1194, 1195, 1196, 559, 1145, 551, 560, 595, 1197, 1198, 1199, 590, 1200, 1201, 1202,
+    1203, 302, 1204, 1205, 301, 598, 573, 580, 0, 1206, 0, 0, 0, 0, 0, 0,
+    0, 0, 1207, 1208, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1209, 0,
+    0, 0, 0, 0, 0, 1210, 1211, 1212, 0, 0, 0, 0, 1213, 0, 0, 0,
+    0, 1214, 0, 0, 1215, 0, 0, 0, 0, 0, 0, 0, 1216, 0, 1217, 0,
+    0, 0, 0, 0, 1218, 1219, 0, 1220, 1221, 0, 0, 0, 0, 0, 0, 0,
+    0, 1222, 0, 0, 1223, 0, 0, 1224, 0, 1225, 0, 0, 0, 0, 0, 0,
+    1226, 0, 1227, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1228, 1229, 1230,
+    1231, 1232, 0, 0, 1233, 1234, 0, 0, 1235, 1236, 0, 0, 0, 0, 0, 0,
+    1237, 1238, 0, 0, 1239, 1240, 0, 0, 1241, 1242, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 0, 0, 0, 0,
+    0, 0, 1251, 1252, 1253, 1254, 0, 0, 0, 1255, 1256, 0, 0, 0, 0, 0,
+    10, 5, 6, 1130, 1131, 1132, 1133, 1134, 1135, 1257, 1258, 1259, 1260, 1261, 1262, 1263,
+    1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279,
+    1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295,
+    1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311,
+    1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327,
+    1328, 1329, 1330, 1331, 1332, 1333, 548, 550, 1145, 551, 552, 1161, 554, 555, 556, 557,
+    558, 559, 560, 561, 562, 564, 1153, 565, 1334, 566, 567, 1189, 568, 1194, 1335, 1157,
+    3, 572, 598, 573, 574, 601, 578, 285, 595, 287, 579, 301, 580, 1141, 11, 585,
+    1336, 288, 181, 586, 587, 590, 292, 302, 293, 628, 1129, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1337, 0, 0, 0, 0, 0, 0, 0, 1338, 1339, 1340, 0,
+    0, 0, 0, 0, 1341, 0, 0, 0, 0, 0, 0, 0, 287, 1189, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1342, 0, 0, 0, 0, 0, 0, 0, 456,
+    0, 0, 0, 0, 0, 0, 0, 1343, 0, 0, 0, 1344, 0, 0, 0, 0,
+    1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360,
+    1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376,
+    1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392,
+    1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408,
+    1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424,
+    1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440,
+    1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456,
+    1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471, 1472,
+    1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488,
+    1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504,
+    1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519, 1520,
+    1521, 1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535, 1536,
+    1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549, 1550, 1551, 1552,
+    1553, 1554, 1555, 1556, 1557, 1558, 0, 0, 0, 0, 633, 413, 306, 412, 1559, 1559,
+    0, 0, 0, 0, 0, 0, 1560, 0, 1368, 1561, 1562, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1563, 0, 1564, 0, 1565, 0, 1566, 0, 1567, 0, 1568, 0,
+    1569, 0, 1570, 0, 1571, 0, 1572, 0, 1573, 0, 1574, 0, 0, 1575, 0, 1576,
+    0, 1577, 0, 0, 0, 0, 0, 0, 1578, 1579, 0, 1580, 1581, 0, 1582, 1583,
+    0, 1584, 1585, 0, 1586, 1587, 0, 0, 0, 0, 0, 0, 1588, 0, 0, 0,
+    0, 1589, 1589, 1590, 1591, 0, 1592, 1593, 0, 0, 0, 0, 1594, 0, 1595, 0,
+    1596, 0, 1597, 0, 1598, 0, 1599, 0, 1600, 0, 1601, 0, 1602, 0, 1603, 0,
+    1604, 0, 1605, 0, 0, 1606, 0, 1607, 0, 1608, 0, 0, 0, 0, 0, 0,
+    1609, 1610, 0, 1611, 1612, 0, 1613, 1614, 0, 1615, 1616, 0, 1617, 1618, 0, 0,
+    0, 0, 0, 0, 1619, 0, 0, 1620, 1621, 1622, 1623, 0, 0, 0, 1624, 1625,
+    0, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640,
+    1641, 1642, 1643, 1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 1656,
+    1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665, 1666, 1667, 1668, 1669, 1670, 1671, 1672,
+    1673, 1674, 1675, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688,
+    1689, 1690, 1691, 1692, 1693, 1694, 1695, 1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704,
+    1705, 1706, 1707, 1708, 1709, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717, 1718, 1719, 0,
+    0, 0, 1345, 1351, 1720, 1721, 1722, 1723, 1724, 1725, 1349, 1726, 1727, 1728, 1729, 1353,
+    1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745,
+    1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760, 0,
+    1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776,
+    1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792,
+    1793, 1794, 1795, 1796, 1797, 1798, 1411, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807,
+    1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1626, 1629, 1632, 1634, 1642, 1643, 1646, 1648,
+    1649, 1651, 1652, 1653, 1654, 1655, 1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825,
+    1826, 1827, 1828, 1829, 1830, 1831, 1832, 0, 1345, 1351, 1720, 1721, 1833, 1834, 1835, 1356,
+    1836, 1368, 1418, 1430, 1429, 1419, 1511, 1376, 1416, 1837, 1838, 1839, 1840, 1841, 1842, 1843,
+    1844, 1845, 1846, 1382, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854, 1722, 1723, 1724, 1855,
+    1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871,
+    1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887,
+    1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903,
+    1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919,
+    1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935,
+    1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951,
+    1952, 1953, 1954, 1955, 1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967,
+    1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983,
+    1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999,
+    2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015,
+    2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031,
+    2032, 2033, 2034, 2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047,
+    2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063,
+    2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079,
+    2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094, 2095,
+    2096, 2097, 2098, 2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111,
+    2112, 2113, 2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127,
+    2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140, 2141, 2142, 2143,
+    2144, 2145, 2146, 2147, 2148, 2149, 2150, 2151, 2152, 2153, 2154, 2155, 2156, 2157, 2158, 2159,
+    2160, 2161, 2162, 2163, 2164, 2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173, 2174, 2175,
+    2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183, 2184, 2185, 2186, 2187, 2188, 2189, 2190, 2191,
+    2192, 2193, 2194, 2195, 2196, 2197, 2198, 2199, 0, 0, 0, 0, 305, 305, 305, 305,
+    305, 305, 305, 305, 305, 305, 0, 0, 0, 0, 0, 0, 2200, 2201, 305, 305,
+    2202, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1145, 1161, 1153, 0, 0, 0,
+    2203, 2204, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 456, 0,
+    0, 0, 0, 307, 307, 307, 0, 0, 0, 0, 0, 456, 0, 0, 0, 0,
+    0, 0, 0, 465, 0, 0, 0, 0, 305, 0, 305, 305, 307, 0, 0, 305,
+    305, 0, 0, 0, 0, 0, 305, 305, 0, 305, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2205, 2206, 2207, 2208, 0, 2209, 0, 0, 0, 0, 0, 0,
+    2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 0, 0, 0, 0,
+    2211, 2212, 2213, 2214, 2215, 2216, 2217, 2218, 2218, 2219, 2220, 2221, 2222, 2223, 2224, 2225,
+    2226, 2227, 2228, 2229, 2230, 2231, 2232, 2233, 2234, 2235, 2236, 2237, 2238, 2239, 2240, 2241,
+    2242, 2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251, 2252, 2253, 2254, 2255, 2256, 2257,
+    2258, 2259, 2260, 2261, 2262, 2263, 2264, 2265, 2266, 2267, 2268, 2269, 2270, 2271, 2272, 2273,
+    2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281, 2282, 2283, 2284, 2285, 2286, 2287, 2288, 2289,
+    2290, 2291, 2292, 2293, 2294, 2295, 2296, 2297, 2298, 2299, 2300, 2301, 2230, 2302, 2303, 2304,
+    2305, 2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2318, 2319, 2320,
+    2321, 2322, 2323, 2324, 2325, 2326, 2327, 2328, 2329, 2330, 2331, 2332, 2333, 2334, 2335, 2336,
+    2337, 2338, 2339, 2340, 2341, 2342, 2343, 2344, 2345, 2346, 2347, 2348, 2349, 2350, 2351, 2352,
+    2353, 2354, 2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362, 2363, 2364, 2365, 2366, 2367, 2368,
+    2369, 2320, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377, 2304, 2378, 2379, 2380, 2381, 2382,
+    2383, 2384, 2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394, 2395, 2396, 2397, 2230,
+    2398, 2399, 2400, 2401, 2402, 2403, 2404, 2405, 2406, 2407, 2408, 2409, 2410, 2411, 2412, 2413,
+    2414, 2415, 2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423, 2424, 2306, 2425, 2426, 2427, 2428,
+    2429, 2430, 2431, 2432, 2433, 2434, 2435, 2436, 2437, 2438, 2439, 2440, 2441, 2442, 2443, 2444,
+    2445, 2446, 2447, 2448, 2449, 2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457, 2458, 2459, 2460,
+    2461, 2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2473, 2474, 0, 0,
+    2475, 0, 2476, 0, 0, 2477, 2478, 2479, 2480, 2481, 2482, 2483, 2484, 2485, 2486, 0,
+    2487, 0, 2488, 0, 0, 2489, 2490, 0, 0, 0, 2491, 2492, 2493, 2494, 2495, 2496,
+    2497, 2498, 2499, 2500, 2501, 2502, 2503, 2504, 2505, 2506, 2507, 2508, 2509, 2510, 2511, 2512,
+    2513, 2514, 2515, 2516, 2517, 2518, 2519, 2520, 2521, 2522, 2523, 2524, 2525, 2526, 2527, 2528,
+    2529, 2530, 2531, 2532, 2533, 2534, 2535, 2359, 2536, 2537, 2538, 2539, 2540, 2541, 2541, 2542,
+    2543, 2544, 2545, 2546, 2547, 2548, 2549, 2489, 2550, 2551, 2552, 2553, 2554, 2555, 0, 0,
+    2556, 2557, 2558, 2559, 2560, 2561, 2562, 2563, 2503, 2564, 2565, 2566, 2475, 2567, 2568, 2569,
+    2570, 2571, 2572, 2573, 2574, 2575, 2576, 2577, 2578, 2512, 2579, 2513, 2580, 2581, 2582, 2583,
+    2584, 2476, 2251, 2585, 2586, 2587, 2321, 2408, 2588, 2589, 2520, 2590, 2521, 2591, 2592, 2593,
+    2478, 2594, 2595, 2596, 2597, 2598, 2479, 2599, 2600, 2601, 2602, 2603, 2604, 2535, 2605, 2606,
+    2359, 2607, 2539, 2608, 2609, 2610, 2611, 2612, 2544, 2613, 2488, 2614, 2545, 2302, 2615, 2546,
+    2616, 2548, 2617, 2618, 2619, 2620, 2621, 2550, 2484, 2622, 2551, 2623, 2552, 2624, 2218, 2625,
+    2626, 2627, 2628, 2629, 2630, 2631, 2632, 2633, 2634, 2635, 0, 0, 0, 0, 0, 0,
+    2636, 2637, 2638, 2639, 2640, 2641, 2641, 0, 0, 0, 0, 2642, 2643, 2644, 2645, 2646,
+    0, 0, 0, 0, 0, 2647, 2648, 2649, 2650, 1162, 1165, 2651, 2652, 2653, 2654, 2655,
+    2656, 1136, 2657, 2658, 2659, 2660, 2661, 2662, 2663, 2664, 2665, 2666, 2667, 2668, 2669, 0,
+    2670, 2671, 2672, 2673, 2674, 0, 2675, 0, 2676, 2677, 0, 2678, 2679, 0, 2680, 2681,
+    2682, 2683, 2684, 2685, 2686, 2687, 2688, 2689, 2690, 2690, 2691, 2691, 2691, 2691, 2692, 2692,
+    2692, 2692, 2693, 2693, 2693, 2693, 2694, 2694, 2694, 2694, 2695, 2695, 2695, 2695, 2696, 2696,
+    2696, 2696, 2697, 2697, 2697, 2697, 2698, 2698, 2698, 2698, 2699, 2699, 2699, 2699, 2700, 2700,
+    2700, 2700, 2701, 2701, 2701, 2701, 2702, 2702, 2702, 2702, 2703, 2703, 2704, 2704, 2705, 2705,
+    2706, 2706, 2707, 2707, 2708, 2708, 2709, 2709, 2709, 2709, 2710, 2710, 2710, 2710, 2711, 2711,
+    2711, 2711, 2712, 2712, 2712, 2712, 2713, 2713, 2714, 2714, 2714, 2714, 2715, 2715, 2716, 2716,
+    2716, 2716, 2717, 2717, 2717, 2717, 2718, 2718, 2719, 2719, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2720, 2720, 2720, 2720, 2721, 2721, 2722, 2722, 2723, 2723, 446, 2724, 2724,
+    2725, 2725, 2726, 2726, 2727, 2727, 2727, 2727, 2728, 2728, 2729, 2729, 2730, 2730, 2731, 2731,
+    2732, 2732, 2733, 2733, 2734, 2734, 2735, 2735, 2735, 2736, 2736, 2736, 2737, 2737, 2737, 2737,
+    2738, 2739, 2740, 2736, 2741, 2742, 2743, 2744, 2745, 2746, 2747, 2748, 2749, 2750, 2751, 2752,
+    2753, 2754, 2755, 2756, 2757, 2758, 2759, 2760, 2761, 2762, 2763, 2764, 2765, 2766, 2767, 2768,
+    2769, 2770, 2771, 2772, 2773, 2774, 2775, 2776, 2777, 2778, 2779, 2780, 2781, 2782, 2783, 2784,
+    2785, 2786, 2787, 2788, 2789, 2790, 2791, 2792, 2793, 2794, 2795, 2796, 2797, 2798, 2799, 2800,
+    2801, 2802, 2803, 2804, 2805, 2806, 2807, 2808, 2809, 2810, 2811, 2812, 2813, 2814, 2815, 2816,
+    2817, 2818, 2819, 2820, 2821, 2822, 2823, 2824, 2825, 2826, 2827, 2828, 2829, 2830, 2831, 2832,
+    2833, 2834, 2835, 2836, 2837, 2838, 2740, 2839, 2736, 2741, 2840, 2841, 2745, 2842, 2746, 2747,
+    2843, 2844, 2751, 2845, 2752, 2753, 2846, 2847, 2755, 2848, 2756, 2757, 2786, 2787, 2790, 2791,
+    2792, 2796, 2797, 2798, 2799, 2803, 2804, 2805, 2849, 2809, 2850, 2851, 2815, 2852, 2816, 2817,
+    2830, 2853, 2854, 2825, 2855, 2826, 2827, 2738, 2739, 2856, 2740, 2857, 2742, 2743, 2744, 2745,
+    2858, 2748, 2749, 2750, 2751, 2859, 2755, 2758, 2759, 2760, 2761, 2762, 2764, 2765, 2766, 2767,
+    2768, 2769, 2860, 2770, 2771, 2772, 2773, 2774, 2775, 2777, 2778, 2779, 2780, 2781, 2782, 2783,
+    2784, 2785, 2788, 2789, 2793, 2794, 2795, 2796, 2797, 2800, 2801, 2802, 2803, 2861, 2806, 2807,
+    2808, 2809, 2812, 2813, 2814, 2815, 2862, 2818, 2819, 2863, 2822, 2823, 2824, 2825, 2864, 2740,
+    2857, 2745, 2858, 2751, 2859, 2755, 2865, 2768, 2866, 2867, 2868, 2796, 2797, 2803, 2815, 2862,
+    2825, 2864, 2869, 2870, 2871, 2872, 2873, 2874, 2875, 2876, 2877, 2878, 2879, 2880, 2881, 2882,
+    2883, 2884, 2885, 2886, 2887, 2888, 2889, 2890, 2891, 2892, 2893, 2894, 2867, 2895, 2896, 2897,
+    2898, 2872, 2873, 2874, 2875, 2876, 2877, 2878, 2879, 2880, 2881, 2882, 2883, 2884, 2885, 2886,
+    2887, 2888, 2889, 2890, 2891, 2892, 2893, 2894, 2867, 2895, 2896, 2897, 2898, 2892, 2893, 2894,
+    2867, 2866, 2868, 2776, 2765, 2766, 2767, 2892, 2893, 2894, 2776, 2777, 2899, 2899, 0, 0,
+    2900, 2901, 2901, 2902, 2903, 2904, 2905, 2906, 2907, 2907, 2908, 2909, 2910, 2911, 2912, 2913,
+    2913, 2914, 2915, 2915, 2916, 2916, 2917, 2918, 2918, 2919, 2920, 2920, 2921, 2921, 2922, 2923,
+    2923, 2924, 2924, 2925, 2926, 2927, 2928, 2928, 2929, 2930, 2931, 2932, 2933, 2933, 2934, 2935,
+    2936, 2937, 2938, 2939, 2939, 2940, 2940, 2941, 2941, 2942, 2943, 2944, 2945, 2946, 2947, 2948,
+    0, 0, 2949, 2950, 2951, 2952, 2953, 2954, 2954, 2955, 2956, 2957, 2958, 2958, 2959, 2960,
+    2961, 2962, 2963, 2964, 2965, 2966, 2967, 2968, 2969, 2970, 2971, 2972, 2973, 2974, 2975, 2976,
+    2977, 2978, 2979, 2980, 2934, 2936, 2981, 2982, 2983, 2984, 2985, 2986, 2985, 2983, 2987, 2988,
+    2989, 2990, 2991, 2986, 2927, 2917, 2992, 2993, 2994, 2995, 2996, 2997, 2998, 2999, 3000, 3001,
+    3002, 3003, 3004, 3005, 3006, 0, 0, 0, 3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014,
+    3015, 1118, 0, 0, 0, 0, 0, 0, 305, 305, 305, 305, 305, 305, 305, 307,
+    307, 307, 307, 307, 307, 307, 305, 305, 1117, 3016, 3017, 3018, 3018, 1139, 1140, 3019,
+    3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028, 3029, 3030, 3031, 3032, 0, 0, 3033,
+    3034, 1124, 1124, 1124, 1124, 3018, 3018, 3018, 3007, 3008, 1116, 0, 3011, 3010, 3013, 3012,
+    3016, 1139, 1140, 3019, 3020, 3021, 3022, 3035, 3036, 3037, 1136, 3038, 3039, 3040, 1138, 0,
+    3041, 3042, 3043, 3044, 0, 0, 0, 0, 3045, 3046, 3047, 0, 3048, 0, 3049, 3050,
+    3051, 3052, 3053, 3054, 3055, 3056, 3057, 3058, 3059, 3060, 3060, 3061, 3061, 3062, 3062, 3063,
+    3063, 3064, 3064, 3064, 3064, 3065, 3065, 3066, 3066, 3066, 3066, 3067, 3067, 3068, 3068, 3068,
+    3068, 3069, 3069, 3069, 3069, 3070, 3070, 3070, 3070, 3071, 3071, 3071, 3071, 3072, 3072, 3072,
+    3072, 3073, 3073, 3074, 3074, 3075, 3075, 3076, 3076, 3077, 3077, 3077, 3077, 3078, 3078, 3078,
+    3078, 3079, 3079, 3079, 3079, 3080, 3080, 3080, 3080, 3081, 3081, 3081, 3081, 3082, 3082, 3082,
+    3082, 3083, 3083, 3083, 3083, 3084, 3084, 3084, 3084, 3085, 3085, 3085, 3085, 3086, 3086, 3086,
+    3086, 3087, 3087, 3087, 3087, 3088, 3088, 3088, 3088, 3089, 3089, 3089, 3089, 3090, 3090, 3090,
+    3090, 3091, 3091, 3091, 3091, 3092, 3092, 2728, 2728, 3093, 3093, 3093, 3093, 3094, 3094, 3095,
+    3095, 3096, 3096, 3097, 3097, 0, 0, 0, 0, 3012, 3098, 3035, 3042, 3043, 3036, 3099,
+    1139, 1140, 3037, 1136, 3007, 3038, 1116, 3100, 1134, 1135, 3010, 3011, 3039, 1138, 3040, 3013,
+    3044, 548, 550, 1145, 551, 552, 1161, 554, 555, 556, 557, 558, 559, 560, 561, 562,
+    564, 1153, 565, 1334, 566, 567, 1189, 568, 1194, 1335, 1157, 3033, 3041, 3034, 3101, 3018,
+    3102, 3, 572, 598, 573, 574, 601, 578, 285, 595, 287, 579, 301, 580, 1141, 11,
+    585, 1336, 288, 181, 586, 587, 590, 292, 302, 293, 628, 3019, 3103, 3020, 3104, 3105,
+    3106, 3009, 3029, 3030, 3008, 3107, 1942, 3108, 3109, 3110, 3111, 3112, 3113, 3114, 3115, 3116,
+    3117, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908, 1909, 1910,
+    1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926,
+    1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 3118, 3119, 3120,
+    1677, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 0,
+    0, 0, 1656, 1657, 1658, 1659, 1660, 1661, 0, 0, 1662, 1663, 1664, 1665, 1666, 1667,
+    0, 0, 1668, 1669, 1670, 1671, 1672, 1673, 0, 0, 1674, 1675, 1676, 0, 0, 0,
+    3121, 3122, 3123, 4, 3124, 3125, 3126, 0, 3127, 3128, 3129, 3130, 3131, 3132, 3133, 0,
+    305, 305, 305, 0, 0, 0, 0, 0, 0, 3134, 3135, 3136, 3137, 3138, 0, 3139,
+    3140, 3141, 3142, 3143, 3144, 3145, 3146, 3147, 3148, 3149, 3150, 3151, 3152, 1151, 3153, 3154,
+    3155, 3156, 3157, 3158, 3159, 3160, 3161, 3162, 3163, 3164, 3165, 3166, 3167, 1336, 3168, 3169,
+    3170, 3171, 3172, 3173, 3174, 3175, 3176, 3177, 3178, 0, 3179, 3180, 3181, 3182, 3183, 3184,
+    3185, 3186, 3187, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 307, 0, 305,
+    305, 312, 307, 0, 0, 0, 0, 456, 0, 0, 0, 0, 0, 305, 307, 0,
+    0, 0, 0, 305, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 307, 307,
+    305, 305, 305, 307, 305, 307, 307, 307, 0, 0, 305, 307, 305, 307, 0, 0,
+    0, 0, 3188, 0, 3189, 0, 0, 0, 0, 0, 0, 3190, 0, 0, 0, 0,
+    0, 456, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3191, 3192,
+    0, 0, 0, 456, 456, 0, 0, 0, 0, 0, 465, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 456, 465, 0, 0, 465, 456, 0, 0, 0, 0, 0,
+    0, 0, 0, 465, 465, 0, 466, 0, 0, 0, 0, 3193, 3194, 456, 0, 0,
+    305, 305, 305, 305, 305, 0, 0, 0, 0, 0, 456, 0, 0, 0, 465, 0,
+    466, 0, 0, 0, 0, 0, 0, 0, 0, 0, 466, 3195, 3196, 466, 3197, 0,
+    0, 0, 456, 465, 0, 0, 0, 0, 0, 0, 3198, 3199, 0, 0, 0, 456,
+    465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 456, 465,
+    0, 456, 465, 0, 0, 0, 0, 0, 3200, 0, 0, 0, 0, 456, 456, 0,
+    0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 465, 0, 456, 456, 0, 0,
+    312, 312, 312, 312, 312, 0, 0, 0, 305, 305, 305, 305, 305, 305, 305, 0,
+    3201, 3201, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 312, 0,
+    0, 0, 0, 0, 0, 0, 3202, 3203, 3204, 3205, 3206, 3207, 3208, 512, 512, 312,
+    312, 312, 0, 0, 0, 3209, 512, 512, 512, 512, 512, 0, 0, 0, 0, 0,
+    0, 0, 0, 307, 307, 307, 307, 307, 307, 307, 307, 0, 0, 305, 305, 305,
+    305, 305, 307, 307, 0, 0, 0, 0, 0, 0, 305, 305, 305, 305, 0, 0,
+    0, 0, 0, 3210, 3211, 3212, 3213, 3214, 3215, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 305, 305, 305, 0, 0, 0, 548, 550, 1145, 551, 552, 1161, 554, 555,
+    556, 557, 558, 559, 560, 561, 562, 564, 1153, 565, 1334, 566, 567, 1189, 568, 1194,
+    1335, 1157, 3, 572, 598, 573, 574, 601, 578, 285, 595, 287, 579, 301, 580, 1141,
+    11, 585, 1336, 288, 181, 586, 587, 590, 292, 302, 293, 628, 548, 550, 1145, 551,
+    552, 1161, 554, 555, 556, 557, 558, 559, 560, 561, 562, 564, 1153, 565, 1334, 566,
+    567, 1189, 568, 1194, 1335, 1157, 3, 572, 598, 573, 574, 601, 578, 0, 595, 287,
+    579, 301, 580, 1141, 11, 585, 1336, 288, 181, 586, 587, 590, 292, 302, 293, 628,
+    292, 302, 293, 628, 548, 0, 1145, 551, 0, 0, 554, 0, 0, 557, 558, 0,
+    0, 561, 562, 564, 1153, 0, 1334, 566, 598, 573, 0, 601, 0, 285, 595, 287,
+    579, 301, 580, 1141, 0, 585, 1336, 288, 292, 302, 293, 628, 548, 550, 0, 551,
+    552, 1161, 554, 0, 0, 557, 558, 559, 560, 561, 562, 564, 1153, 0, 1334, 566,
+    567, 1189, 568, 1194, 1335, 0, 3, 572, 598, 573, 574, 601, 578, 285, 595, 287,
+    548, 550, 0, 551, 552, 1161, 554, 0, 556, 557, 558, 559, 560, 0, 562, 0,
+    0, 0, 1334, 566, 567, 1189, 568, 1194, 1335, 0, 3, 572, 598, 573, 574, 601,
+    292, 302, 293, 628, 3216, 3217, 0, 0, 3218, 3219, 1167, 3220, 3221, 3222, 3223, 356,
+    3224, 3225, 3226, 3227, 3228, 3229, 3230, 1168, 3231, 356, 358, 3232, 348, 3233, 3234, 3235,
+    3236, 3237, 3238, 346, 592, 593, 357, 3239, 3240, 347, 3241, 353, 3242, 8, 3243, 3244,
+    3245, 352, 354, 355, 3246, 3247, 3248, 351, 594, 3249, 3250, 3251, 357, 347, 353, 351,
+    354, 352, 3218, 3219, 1167, 3220, 3221, 3222, 3223, 356, 3224, 3225, 3226, 3227, 3228, 3229,
+    3230, 1168, 3231, 356, 358, 3232, 348, 3233, 3234, 3235, 3236, 3237, 3238, 346, 592, 593,
+    357, 3239, 3240, 347, 3241, 353, 3242, 8, 3243, 3244, 3245, 352, 354, 355, 3246, 3247,
+    3248, 351, 594, 3249, 3250, 3251, 357, 347, 353, 351, 354, 352, 3218, 3219, 1167, 3220,
+    3221, 3222, 3223, 356, 3224, 3225, 3226, 3227, 3228, 3229, 3230, 1168, 3231, 356, 358, 3232,
+    348, 3233, 3234, 3235, 3236, 3237, 3238, 346, 592, 593, 357, 3239, 3240, 347, 3241, 353,
+    3242, 8, 3243, 3244, 3245, 352, 354, 355, 3246, 3247, 3248, 351, 594, 3249, 3250, 3251,
+    357, 347, 353, 351, 354, 352, 3218, 3219, 1167, 3220, 3221, 3222, 3223, 356, 3224, 3225,
+    3226, 3227, 3228, 3229, 3230, 1168, 3231, 356, 358, 3232, 348, 3233, 3234, 3235, 3236, 3237,
+    3238, 346, 592, 593, 357, 3239, 3240, 347, 3241, 353, 3242, 8, 3243, 3244, 3245, 352,
+    354, 355, 3246, 3247, 3248, 351, 594, 3249, 3250, 3251, 357, 347, 353, 351, 354, 352,
+    354, 352, 3252, 3253, 0, 0, 1129, 10, 5, 6, 1130, 1131, 1132, 1133, 1134, 1135,
+    1134, 1135, 1129, 10, 5, 6, 1130, 1131, 1132, 1133, 1134, 1135, 1129, 10, 5, 6,
+    1130, 1131, 1132, 1133, 1134, 1135, 1129, 10, 305, 0, 0, 305, 305, 305, 305, 305,
+    305, 305, 0, 305, 305, 0, 305, 305, 307, 307, 307, 307, 307, 307, 307, 0,
+    305, 305, 465, 0, 0, 0, 0, 0, 3065, 3066, 3070, 3073, 0, 3092, 3076, 3071,
+    3081, 3093, 3087, 3088, 3089, 3090, 3077, 3083, 3085, 3079, 3086, 3075, 3078, 3068, 3069, 3072,
+    3074, 3080, 3082, 3084, 3254, 2713, 3255, 3256, 0, 3066, 3070, 0, 3091, 0, 0, 3071,
+    0, 3093, 3087, 3088, 3089, 3090, 3077, 3083, 3085, 3079, 3086, 0, 3078, 3068, 3069, 3072,
+    0, 3080, 0, 3084, 0, 0, 0, 0, 0, 0, 3070, 0, 0, 0, 0, 3071,
+    0, 3093, 0, 3088, 0, 3090, 3077, 3083, 0, 3079, 3086, 0, 3078, 0, 0, 3072,
+    0, 3080, 0, 3084, 0, 2713, 0, 3256, 3081, 3093, 3087, 0, 3089, 3090, 3077, 3083,
+    0, 3080, 3082, 3084, 3254, 0, 3255, 0, 3065, 3066, 3070, 3073, 3091, 3092, 3076, 3071,
+    3081, 3093, 0, 3088, 3089, 3090, 3077, 3083, 3074, 3080, 3082, 3084, 0, 0, 0, 0,
+    0, 3066, 3070, 3073, 0, 3092, 3076, 3071, 3257, 3258, 3259, 3260, 3261, 3262, 3263, 3264,
+    3265, 3266, 3267, 0, 0, 0, 0, 0, 3268, 3269, 3270, 3271, 3272, 3273, 3274, 3275,
+    3276, 3277, 3278, 3279, 3280, 3281, 3282, 3283, 3284, 3285, 3286, 3287, 3288, 3289, 3290, 3291,
+    3292, 3293, 3294, 1145, 565, 3295, 3296, 0, 1335, 1157, 3297, 2129, 3298, 3299, 3300, 3301,
+    0, 0, 3302, 3303, 3304, 0, 0, 0, 3305, 0, 0, 0, 0, 0, 0, 0,
+    3306, 3307, 1906, 0, 0, 0, 0, 0, 1408, 3308, 3309, 3310, 1351, 3311, 3312, 1728,
+    3313, 3314, 3315, 3316, 3317, 3318, 3319, 3320, 3321, 3322, 1444, 3323, 3324, 3325, 3326, 3327,
+    3328, 1345, 1720, 3329, 1855, 1723, 1856, 3330, 1500, 3331, 3332, 3333, 3334, 3335, 1838, 1418,
+    3336, 3337, 3338, 3339, 0, 0, 0, 0, 3340, 3341, 3342, 3343, 3344, 3345, 3346, 3347,
+    3348, 0, 0, 0, 0, 0, 0, 0, 3349, 3350, 0, 0, 0, 0, 0, 0,
+    1134, 1135, 0, 0, 0, 0, 0, 0, 3351, 3352, 3353, 3354, 3355, 2497, 3356, 3357,
+    3358, 3359, 2498, 3360, 3361, 3362, 2499, 3363, 3364, 3365, 3366, 3367, 3368, 3369, 3370, 3371,
+    3372, 3373, 3374, 2557, 3375, 3376, 3377, 3378, 3379, 3380, 3381, 3382, 3383, 2562, 2500, 2501,
+    2563, 3384, 3385, 2308, 3386, 2502, 3387, 3388, 3389, 3390, 3390, 3390, 3391, 3392, 3393, 3394,
+    3395, 3396, 3397, 3398, 3399, 3400, 3401, 3402, 3403, 3404, 3405, 3406, 3407, 3408, 3408, 2565,
+    3409, 3410, 3411, 3412, 2504, 3413, 3414, 3415, 2461, 3416, 3417, 3418, 3419, 3420, 3421, 3422,
+    3423, 3424, 3425, 3426, 3427, 3428, 3429, 3430, 3431, 3432, 3433, 3434, 3435, 3436, 3437, 3438,
+    3439, 3440, 3441, 3441, 3442, 3443, 3444, 2304, 3445, 3446, 3447, 3448, 3449, 3450, 3451, 3452,
+    2509, 3453, 3454, 3455, 3456, 3457, 3458, 3459, 3460, 3461, 3462, 3463, 3464, 3465, 3466, 3467,
+    3468, 3469, 3470, 3471, 3472, 3473, 2250, 3474, 3475, 3476, 3476, 3477, 3478, 3478, 3479, 3480,
+    3481, 3482, 3483, 3484, 3485, 3486, 3487, 3488, 3489, 3490, 3491, 2510, 3492, 3493, 3494, 3495,
+    2577, 3495, 3496, 2512, 3497, 3498, 3499, 3500, 2513, 2223, 3501, 3502, 3503, 3504, 3505, 3506,
+    3507, 3508, 3509, 3510, 3511, 3512, 3513, 3514, 3515, 3516, 3517, 3518, 3519, 3520, 3521, 3522,
+    2514, 3523, 3524, 3525, 3526, 3527, 3528, 2516, 3529, 3530, 3531, 3532, 3533, 3534, 3535, 3536,
+    2251, 2585, 3537, 3538, 3539, 3540, 3541, 3542, 3543, 3544, 2517, 3545, 3546, 3547, 3548, 2628,
+    3549, 3550, 3551, 3552, 3553, 3554, 3555, 3556, 3557, 3558, 3559, 3560, 3561, 2321, 3562, 3563,
+    3564, 3565, 3566, 3567, 3568, 3569, 3570, 3571, 3572, 2518, 2408, 3573, 3574, 3575, 3576, 3577,
+    3578, 3579, 3580, 2589, 3581, 3582, 3583, 3584, 3585, 3586, 3587, 3588, 2590, 3589, 3590, 3591,
+    3592, 3593, 3594, 3595, 3596, 3597, 3598, 3599, 3600, 2592, 3601, 3602, 3603, 3604, 3605, 3606,
+    3607, 3608, 3609, 3610, 3611, 3611, 3612, 3613, 2594, 3614, 3615, 3616, 3617, 3618, 3619, 3620,
+    2307, 3621, 3622, 3623, 3624, 3625, 3626, 3627, 2600, 3628, 3629, 3630, 3631, 3632, 3633, 3633,
+    2601, 2630, 3634, 3635, 3636, 3637, 3638, 2269, 2603, 3639, 3640, 2529, 3641, 3642, 2483, 3643,
+    3644, 2533, 3645, 3646, 3647, 3648, 3648, 3649, 3650, 3651, 3652, 3653, 3654, 3655, 3656, 3657,
+    3658, 3659, 3660, 3661, 3662, 3663, 3664, 3665, 3666, 3667, 3668, 3669, 3670, 3671, 3672, 3673,
+    3674, 3675, 2539, 3676, 3677, 3678, 3679, 3680, 3681, 3682, 3683, 3684, 3685, 3686, 3687, 3688,
+    3689, 3690, 3691, 3477, 3692, 3693, 3694, 3695, 3696, 3697, 3698, 3699, 3700, 3701, 3702, 3703,
+    2325, 3704, 3705, 3706, 3707, 3708, 3709, 2542, 3710, 3711, 3712, 3713, 3714, 3715, 3716, 3717,
+    3718, 3719, 3720, 3721, 3722, 3723, 3724, 3725, 3726, 3727, 3728, 3729, 2264, 3730, 3731, 3732,
+    3733, 3734, 3735, 2610, 3736, 3737, 3738, 3739, 3740, 3741, 3742, 3743, 3744, 3745, 3746, 3747,
+    3748, 3749, 3750, 3751, 3752, 3753, 3754, 3755, 2615, 2616, 3756, 3757, 3758, 3759, 3760, 3761,
+    3762, 3763, 3764, 3765, 3766, 3767, 3768, 2617, 3769, 3770, 3771, 3772, 3773, 3774, 3775, 3776,
+    3777, 3778, 3779, 3780, 3781, 3782, 3783, 3784, 3785, 3786, 3787, 3788, 3789, 3790, 3791, 3792,
+    3793, 3794, 3795, 3796, 3797, 3798, 2623, 2623, 3799, 3800, 3801, 3802, 3803, 3804, 3805, 3806,
+    3807, 3808, 2624, 3809, 3810, 3811, 3812, 3813, 3814, 3815, 3816, 3817, 3818, 3819, 3820, 3821,
+    3822, 3823, 3824, 3825, 3826, 3827, 0, 0,
+};
+
+// {canonical_combining_class, flags, decomposition}
+static const struct gp_norm_record { uint8_t ccc, flags; uint16_t decomposition; }
+gp_norm_records[3828] = {
+    {0,0,0}, {0,24,2}, {0,24,5}, {0,24,10}, {0,24,13}, {0,24,18},
+    {0,24,21}, {0,24,24}, {0,24,29}, {0,24,33}, {0,24,38}, {0,24,41},
+    {0,24,44}, {0,24,51}, {0,24,58}, {0,9,65}, {0,9,70}, {0,9,75},
+    {0,9,80}, {0,9,85}, {0,9,90}, {0,9,95}, {0,9,100}, {0,9,105},
+    {0,9,110}, {0,9,115}, {0,9,120}, {0,9,125}, {0,9,130}, {0,9,135},
+    {0,9,140}, {0,9,145}, {0,9,150}, {0,9,155}, {0,9,160}, {0,9,165},
+    {0,9,170}, {0,9,175}, {0,9,180}, {0,9,185}, {0,9,190}, {0,9,195},
+    {0,9,200}, {0,9,205}, {0,9,210}, {0,9,215}, {0,9,220}, {0,9,225},
+    {0,9,230}, {0,9,235}, {0,9,240}, {0,9,245}, {0,9,250}, {0,9,255},
+    {0,9,260}, {0,9,265}, {0,9,270}, {0,9,275}, {0,9,280}, {0,9,285},
+    {0,9,290}, {0,9,295}, {0,9,300}, {0,9,305}, {0,9,310}, {0,9,315},
+    {0,9,320}, {0,9,325}, {0,9,330}, {0,9,335}, {0,9,340}, {0,9,345},
+    {0,9,350}, {0,9,355}, {0,9,360}, {0,9,365}, {0,9,370}, {0,9,375},
+    {0,9,380}, {0,9,385}, {0,9,390}, {0,9,395}, {0,9,400}, {0,9,405},
+    {0,9,410}, {0,9,415}, {0,9,420}, {0,9,425}, {0,9,430}, {0,9,435},
+    {0,9,440}, {0,9,445}, {0,9,450}, {0,9,455}, {0,9,460}, {0,9,465},
+    {0,9,470}, {0,9,475}, {0,9,480}, {0,9,485}, {0,9,490}, {0,9,495},
+    {0,9,500}, {0,9,505}, {0,9,510}, {0,9,515}, {0,9,520}, {0,9,525},
+    {0,9,530}, {0,9,535}, {0,9,540}, {0,9,545}, {0,9,550}, {0,24,555},
+    {0,24,559}, {0,9,563}, {0,9,568}, {0,9,573}, {0,9,578}, {0,9,583},
+    {0,9,588}, {0,9,593}, {0,9,598}, {0,9,603}, {0,9,608}, {0,24,613},
+    {0,24,618}, {0,9,623}, {0,9,628}, {0,9,633}, {0,9,638}, {0,9,643},
+    {0,9,648}, {0,24,653}, {0,9,658}, {0,9,663}, {0,9,668}, {0,9,673},
+    {0,9,678}, {0,9,683}, {0,9,688}, {0,9,693}, {0,9,698}, {0,9,703},
+    {0,9,708}, {0,9,713}, {0,9,718}, {0,9,723}, {0,9,728}, {0,9,733},
+    {0,9,738}, {0,9,743}, {0,9,748}, {0,9,753}, {0,9,758}, {0,9,763},
+    {0,9,768}, {0,9,773}, {0,9,778}, {0,9,783}, {0,9,788}, {0,9,793},
+    {0,9,798}, {0,9,803}, {0,9,808}, {0,9,813}, {0,9,818}, {0,9,823},
+    {0,9,828}, {0,9,833}, {0,9,838}, {0,9,843}, {0,9,848}, {0,9,853},
+    {0,9,858}, {0,9,863}, {0,9,868}, {0,9,873}, {0,9,878}, {0,9,883},
+    {0,9,888}, {0,24,893}, {0,9,896}, {0,9,901}, {0,9,906}, {0,9,911},
+    {0,24,916}, {0,24,922}, {0,24,928}, {0,24,934}, {0,24,938}, {0,24,942},
+    {0,24,946}, {0,24,950}, {0,24,954}, {0,9,958}, {0,9,963}, {0,9,968},
+    {0,9,973}, {0,9,978}, {0,9,983}, {0,9,988}, {0,9,993}, {0,9,998},
+    {0,9,1005}, {0,9,1012}, {0,9,1019}, {0,9,1026}, {0,9,1033}, {0,9,1040},
+    {0,9,1047}, {0,9,1054}, {0,9,1061}, {0,9,1068}, {0,9,1075}, {0,9,1082},
+    {0,9,1088}, {0,9,1094}, {0,9,1099}, {0,9,1104}, {0,9,1109}, {0,9,1114},
+    {0,9,1119}, {0,9,1124}, {0,9,1131}, {0,9,1138}, {0,9,1144}, {0,9,1150},
+    {0,24,1155}, {0,24,1159}, {0,24,1163}, {0,9,1167}, {0,9,1172}, {0,9,1177},
+    {0,9,1182}, {0,9,1187}, {0,9,1194}, {0,9,1201}, {0,9,1207}, {0,9,1213},
+    {0,9,1219}, {0,9,1225}, {0,9,1230}, {0,9,1235}, {0,9,1240}, {0,9,1245},
+    {0,9,1250}, {0,9,1255}, {0,9,1260}, {0,9,1265}, {0,9,1270}, {0,9,1275},
+    {0,9,1280}, {0,9,1285}, {0,9,1290}, {0,9,1295}, {0,9,1300}, {0,9,1305},
+    {0,9,1310}, {0,9,1315}, {0,9,1320}, {0,9,1325}, {0,9,1330}, {0,9,1335},
+    {0,9,1340}, {0,9,1345}, {0,9,1350}, {0,9,1355}, {0,9,1360}, {0,9,1365},
+    {0,9,1370}, {0,9,1375}, {0,9,1380}, {0,9,1385}, {0,9,1390}, {0,9,1395},
+    {0,9,1402}, {0,9,1409}, {0,9,1416}, {0,9,1423}, {0,9,1428}, {0,9,1433},
+    {0,9,1440}, {0,9,1447}, {0,9,1452}, {0,24,1457}, {0,24,1460}, {0,24,1464},
+    {0,24,1467}, {0,24,1470}, {0,24,1474}, {0,24,1478}, {0,24,1482}, {0,24,1485},
+    {0,24,1488}, {0,24,1493}, {0,24,1498}, {0,24,1503}, {0,24,1508}, {0,24,1513},
+    {0,24,1518}, {0,24,1522}, {0,24,1525}, {0,24,1528}, {230,36,0}, {230,0,0},
+    {232,0,0}, {220,0,0}, {216,36,0}, {202,0,0}, {220,36,0}, {202,36,0},
+    {1,0,0}, {1,36,0}, {230,27,1532}, {230,27,1536}, {230,27,1540}, {230,27,1544},
+    {240,36,0}, {233,0,0}, {234,0,0}, {0,27,1550}, {0,24,1554}, {0,27,1559},
+    {0,25,1562}, {0,9,1573}, {0,27,1579}, {0,9,1583}, {0,9,1589}, {0,9,1595},
+    {0,9,1601}, {0,9,1607}, {0,9,1613}, {0,9,1619}, {0,9,1627}, {0,9,1633},
+    {0,9,1639}, {0,9,1645}, {0,9,1651}, {0,9,1657}, {0,9,1663}, {0,9,1671},
+    {0,9,1677}, {0,9,1683}, {0,9,1689}, {0,9,1695}, {0,24,1701}, {0,24,1705},
+    {0,24,1709}, {0,25,1713}, {0,25,1723}, {0,24,1733}, {0,24,1737}, {0,24,1741},
+    {0,24,1745}, {0,24,1749}, {0,24,1753}, {0,24,1757}, {0,24,1761}, {0,9,1765},
+    {0,9,1771}, {0,9,1777}, {0,9,1783}, {0,9,1789}, {0,9,1795}, {0,9,1801},
+    {0,9,1807}, {0,9,1813}, {0,9,1819}, {0,9,1825}, {0,9,1831}, {0,9,1837},
+    {0,9,1843}, {0,9,1849}, {0,9,1855}, {0,9,1861}, {0,9,1867}, {0,9,1873},
+    {0,9,1879}, {0,9,1885}, {0,9,1891}, {0,9,1897}, {0,9,1903}, {0,9,1909},
+    {0,9,1915}, {0,9,1921}, {0,9,1927}, {0,9,1933}, {0,9,1939}, {0,9,1945},
+    {0,9,1951}, {0,9,1957}, {0,9,1963}, {0,9,1969}, {0,9,1975}, {0,9,1981},
+    {0,9,1987}, {0,9,1993}, {0,9,1999}, {0,9,2005}, {0,9,2011}, {0,9,2017},
+    {0,9,2023}, {0,9,2029}, {0,9,2035}, {0,9,2041}, {0,9,2047}, {0,9,2053},
+    {0,9,2059}, {0,9,2065}, {0,9,2071}, {0,24,2077}, {222,0,0}, {228,0,0},
+    {10,0,0}, {11,0,0}, {12,0,0}, {13,0,0}, {14,0,0}, {15,0,0},
+    {16,0,0}, {17,0,0}, {18,0,0}, {19,0,0}, {20,0,0}, {21,0,0},
+    {22,0,0}, {23,0,0}, {24,0,0}, {25,0,0}, {30,0,0}, {31,0,0},
+    {32,0,0}, {0,9,2083}, {0,9,2089}, {0,9,2095}, {0,9,2101}, {0,9,2107},
+    {27,0,0}, {28,0,0}, {29,0,0}, {33,0,0}, {34,0,0}, {35,0,0},
+    {0,24,2113}, {0,24,2119}, {0,24,2125}, {0,24,2131}, {0,9,2137}, {0,9,2143},
+    {0,9,2149}, {36,0,0}, {0,9,2155}, {0,9,2163}, {0,9,2171}, {7,36,0},
+    {9,0,0}, {0,27,2179}, {0,27,2187}, {0,27,2195}, {0,27,2203}, {0,27,2211},
+    {0,27,2219}, {0,27,2227}, {0,27,2235}, {7,0,0}, {0,36,0}, {0,9,2243},
+    {0,9,2251}, {0,27,2259}, {0,27,2267}, {0,27,2275}, {0,27,2283}, {0,27,2291},
+    {0,27,2299}, {0,27,2307}, {0,27,2315}, {0,27,2323}, {0,9,2331}, {0,9,2339},
+    {0,9,2347}, {0,27,2355}, {0,27,2363}, {0,9,2371}, {0,9,2379}, {0,9,2387},
+    {0,9,2395}, {0,9,2403}, {84,0,0}, {91,36,0}, {0,9,2411}, {0,9,2419},
+    {0,9,2427}, {0,9,2435}, {0,9,2443}, {0,9,2454}, {0,9,2462}, {0,9,2470},
+    {9,36,0}, {0,9,2478}, {0,9,2486}, {0,9,2494}, {0,9,2505}, {0,24,2513},
+    {103,0,0}, {107,0,0}, {0,24,2521}, {118,0,0}, {122,0,0}, {0,24,2529},
+    {0,24,2537}, {0,24,2545}, {216,0,0}, {0,27,2550}, {0,27,2558}, {0,27,2566},
+    {0,27,2574}, {0,27,2582}, {0,27,2590}, {129,0,0}, {130,0,0}, {0,27,2598},
+    {132,0,0}, {0,27,2606}, {0,27,2614}, {0,24,2622}, {0,27,2633}, {0,24,2641},
+    {0,27,2652}, {0,27,2660}, {0,27,2668}, {0,27,2676}, {0,27,2684}, {0,27,2692},
+    {0,27,2700}, {0,9,2708}, {0,24,2716}, {0,9,2721}, {0,9,2729}, {0,9,2737},
+    {0,9,2745}, {0,9,2753}, {0,9,2761}, {0,9,2769}, {0,9,2777}, {0,9,2785},
+    {0,9,2793}, {0,9,2801}, {0,24,2809}, {0,24,2812}, {0,24,2816}, {0,24,2819},
+    {0,24,2822}, {0,24,2825}, {0,24,2829}, {0,24,2832}, {0,24,2835}, {0,24,2838},
+    {0,24,2841}, {0,24,2844}, {0,24,2847}, {0,24,2850}, {0,24,2853}, {0,24,2856},
+    {0,24,2860}, {0,24,2863}, {0,24,2866}, {0,24,2869}, {0,24,2872}, {0,24,2875},
+    {0,24,2879}, {0,24,2883}, {0,24,2888}, {0,24,2891}, {0,24,2894}, {0,24,2897},
+    {0,24,2901}, {0,24,2905}, {0,24,2909}, {0,24,2912}, {0,24,2915}, {0,24,2918},
+    {0,24,2922}, {0,24,2926}, {0,24,2931}, {0,24,2936}, {0,24,2939}, {0,24,2942},
+    {0,24,2945}, {0,24,2950}, {0,24,2954}, {0,24,2957}, {0,24,2962}, {0,24,2966},
+    {0,24,2970}, {0,24,2974}, {0,24,2977}, {0,24,2981}, {0,24,2985}, {0,24,2988},
+    {0,24,2992}, {0,24,2996}, {0,24,2999}, {0,24,3003}, {0,24,3007}, {0,24,3011},
+    {0,24,3015}, {0,24,3019}, {0,24,3023}, {0,24,3028}, {0,24,3032}, {0,24,3036},
+    {0,24,3041}, {0,24,3045}, {0,24,3049}, {0,24,3053}, {0,24,3057}, {0,24,3061},
+    {0,24,3065}, {0,24,3069}, {0,24,3073}, {0,24,3077}, {0,24,3081}, {0,24,3085},
+    {0,24,3089}, {0,24,3093}, {0,24,3098}, {0,24,3102}, {0,24,3106}, {0,24,3109},
+    {0,24,3113}, {0,24,3117}, {214,0,0}, {218,0,0}, {0,9,3121}, {0,9,3126},
+    {0,9,3131}, {0,9,3136}, {0,9,3141}, {0,9,3146}, {0,9,3151}, {0,9,3156},
+    {0,9,3161}, {0,9,3168}, {0,9,3175}, {0,9,3180}, {0,9,3185}, {0,9,3190},
+    {0,9,3195}, {0,9,3200}, {0,9,3205}, {0,9,3210}, {0,9,3215}, {0,9,3220},
+    {0,9,3225}, {0,9,3232}, {0,9,3239}, {0,9,3246}, {0,9,3253}, {0,9,3258},
+    {0,9,3263}, {0,9,3268}, {0,9,3273}, {0,9,3280}, {0,9,3287}, {0,9,3292},
+    {0,9,3297}, {0,9,3302}, {0,9,3307}, {0,9,3312}, {0,9,3317}, {0,9,3322},
+    {0,9,3327}, {0,9,3332}, {0,9,3337}, {0,9,3342}, {0,9,3347}, {0,9,3352},
+    {0,9,3357}, {0,9,3362}, {0,9,3367}, {0,9,3374}, {0,9,3381}, {0,9,3386},
+    {0,9,3391}, {0,9,3396}, {0,9,3401}, {0,9,3406}, {0,9,3411}, {0,9,3416},
+    {0,9,3421}, {0,9,3428}, {0,9,3435}, {0,9,3440}, {0,9,3445}, {0,9,3450},
+    {0,9,3455}, {0,9,3460}, {0,9,3465}, {0,9,3470}, {0,9,3475}, {0,9,3480},
+    {0,9,3485}, {0,9,3490}, {0,9,3495}, {0,9,3500}, {0,9,3505}, {0,9,3510},
+    {0,9,3515}, {0,9,3520}, {0,9,3525}, {0,9,3532}, {0,9,3539}, {0,9,3546},
+    {0,9,3553}, {0,9,3560}, {0,9,3567}, {0,9,3574}, {0,9,3581}, {0,9,3586},
+    {0,9,3591}, {0,9,3596}, {0,9,3601}, {0,9,3606}, {0,9,3611}, {0,9,3616},
+    {0,9,3621}, {0,9,3628}, {0,9,3635}, {0,9,3640}, {0,9,3645}, {0,9,3650},
+    {0,9,3655}, {0,9,3660}, {0,9,3665}, {0,9,3672}, {0,9,3679}, {0,9,3686},
+    {0,9,3693}, {0,9,3700}, {0,9,3707}, {0,9,3712}, {0,9,3717}, {0,9,3722},
+    {0,9,3727}, {0,9,3732}, {0,9,3737}, {0,9,3742}, {0,9,3747}, {0,9,3752},
+    {0,9,3757}, {0,9,3762}, {0,9,3767}, {0,9,3772}, {0,9,3777}, {0,9,3784},
+    {0,9,3791}, {0,9,3798}, {0,9,3805}, {0,9,3810}, {0,9,3815}, {0,9,3820},
+    {0,9,3825}, {0,9,3830}, {0,9,3835}, {0,9,3840}, {0,9,3845}, {0,9,3850},
+    {0,9,3855}, {0,9,3860}, {0,9,3865}, {0,9,3870}, {0,9,3875}, {0,9,3880},
+    {0,9,3885}, {0,9,3890}, {0,9,3895}, {0,9,3900}, {0,9,3905}, {0,9,3910},
+    {0,9,3915}, {0,9,3920}, {0,9,3925}, {0,9,3930}, {0,9,3935}, {0,9,3940},
+    {0,9,3945}, {0,9,3950}, {0,24,3955}, {0,25,3960}, {0,9,3969}, {0,9,3974},
+    {0,9,3979}, {0,9,3984}, {0,9,3989}, {0,9,3996}, {0,9,4003}, {0,9,4010},
+    {0,9,4017}, {0,9,4024}, {0,9,4031}, {0,9,4038}, {0,9,4045}, {0,9,4052},
+    {0,9,4059}, {0,9,4066}, {0,9,4073}, {0,9,4080}, {0,9,4087}, {0,9,4094},
+    {0,9,4101}, {0,9,4108}, {0,9,4115}, {0,9,4122}, {0,9,4129}, {0,9,4134},
+    {0,9,4139}, {0,9,4144}, {0,9,4149}, {0,9,4154}, {0,9,4159}, {0,9,4166},
+    {0,9,4173}, {0,9,4180}, {0,9,4187}, {0,9,4194}, {0,9,4201}, {0,9,4208},
+    {0,9,4215}, {0,9,4222}, {0,9,4229}, {0,9,4234}, {0,9,4239}, {0,9,4244},
+    {0,9,4249}, {0,9,4254}, {0,9,4259}, {0,9,4264}, {0,9,4269}, {0,9,4276},
+    {0,9,4283}, {0,9,4290}, {0,9,4297}, {0,9,4304}, {0,9,4311}, {0,9,4318},
+    {0,9,4325}, {0,9,4332}, {0,9,4339}, {0,9,4346}, {0,9,4353}, {0,9,4360},
+    {0,9,4367}, {0,9,4374}, {0,9,4381}, {0,9,4388}, {0,9,4395}, {0,9,4402},
+    {0,9,4409}, {0,9,4414}, {0,9,4419}, {0,9,4424}, {0,9,4429}, {0,9,4436},
+    {0,9,4443}, {0,9,4450}, {0,9,4457}, {0,9,4464}, {0,9,4471}, {0,9,4478},
+    {0,9,4485}, {0,9,4492}, {0,9,4499}, {0,9,4504}, {0,9,4509}, {0,9,4514},
+    {0,9,4519}, {0,9,4524}, {0,9,4529}, {0,9,4534}, {0,9,4539}, {0,9,4545},
+    {0,9,4551}, {0,9,4559}, {0,9,4567}, {0,9,4575}, {0,9,4583}, {0,9,4591},
+    {0,9,4599}, {0,9,4605}, {0,9,4611}, {0,9,4619}, {0,9,4627}, {0,9,4635},
+    {0,9,4643}, {0,9,4651}, {0,9,4659}, {0,9,4665}, {0,9,4671}, {0,9,4679},
+    {0,9,4687}, {0,9,4695}, {0,9,4703}, {0,9,4709}, {0,9,4715}, {0,9,4723},
+    {0,9,4731}, {0,9,4739}, {0,9,4747}, {0,9,4753}, {0,9,4759}, {0,9,4767},
+    {0,9,4775}, {0,9,4783}, {0,9,4791}, {0,9,4799}, {0,9,4807}, {0,9,4813},
+    {0,9,4819}, {0,9,4827}, {0,9,4835}, {0,9,4843}, {0,9,4851}, {0,9,4859},
+    {0,9,4867}, {0,9,4873}, {0,9,4879}, {0,9,4887}, {0,9,4895}, {0,9,4903},
+    {0,9,4911}, {0,9,4919}, {0,9,4927}, {0,9,4933}, {0,9,4939}, {0,9,4947},
+    {0,9,4955}, {0,9,4963}, {0,9,4971}, {0,9,4979}, {0,9,4987}, {0,9,4993},
+    {0,9,4999}, {0,9,5007}, {0,9,5015}, {0,9,5023}, {0,9,5031}, {0,9,5037},
+    {0,9,5043}, {0,9,5051}, {0,9,5059}, {0,9,5067}, {0,9,5075}, {0,9,5081},
+    {0,9,5087}, {0,9,5095}, {0,9,5103}, {0,9,5111}, {0,9,5119}, {0,9,5127},
+    {0,9,5135}, {0,9,5141}, {0,9,5149}, {0,9,5157}, {0,9,5165}, {0,9,5171},
+    {0,9,5177}, {0,9,5185}, {0,9,5193}, {0,9,5201}, {0,9,5209}, {0,9,5217},
+    {0,9,5225}, {0,9,5231}, {0,9,5237}, {0,9,5245}, {0,9,5253}, {0,9,5261},
+    {0,9,5269}, {0,9,5277}, {0,9,5285}, {0,27,1639}, {0,9,5291}, {0,27,1645},
+    {0,9,5297}, {0,27,1651}, {0,9,5303}, {0,27,1657}, {0,9,5309}, {0,27,1683},
+    {0,9,5315}, {0,27,1689}, {0,9,5321}, {0,27,1695}, {0,9,5327}, {0,9,5335},
+    {0,9,5343}, {0,9,5353}, {0,9,5363}, {0,9,5373}, {0,9,5383}, {0,9,5393},
+    {0,9,5403}, {0,9,5411}, {0,9,5419}, {0,9,5429}, {0,9,5439}, {0,9,5449},
+    {0,9,5459}, {0,9,5469}, {0,9,5479}, {0,9,5487}, {0,9,5495}, {0,9,5505},
+    {0,9,5515}, {0,9,5525}, {0,9,5535}, {0,9,5545}, {0,9,5555}, {0,9,5563},
+    {0,9,5571}, {0,9,5581}, {0,9,5591}, {0,9,5601}, {0,9,5611}, {0,9,5621},
+    {0,9,5631}, {0,9,5639}, {0,9,5647}, {0,9,5657}, {0,9,5667}, {0,9,5677},
+    {0,9,5687}, {0,9,5697}, {0,9,5707}, {0,9,5715}, {0,9,5723}, {0,9,5733},
+    {0,9,5743}, {0,9,5753}, {0,9,5763}, {0,9,5773}, {0,9,5783}, {0,9,5789},
+    {0,9,5795}, {0,9,5803}, {0,9,5809}, {0,9,5817}, {0,9,5823}, {0,9,5831},
+    {0,9,5837}, {0,9,5843}, {0,27,1573}, {0,9,5849}, {0,24,5855}, {0,27,5860},
+    {0,24,5864}, {0,25,5869}, {0,9,5880}, {0,9,5888}, {0,9,5894}, {0,9,5902},
+    {0,9,5908}, {0,9,5916}, {0,27,1583}, {0,9,5922}, {0,27,1589}, {0,9,5928},
+    {0,25,5934}, {0,25,5946}, {0,25,5958}, {0,9,5970}, {0,9,5976}, {0,9,5982},
+    {0,27,1619}, {0,9,5990}, {0,9,5996}, {0,9,6004}, {0,9,6010}, {0,9,6016},
+    {0,27,1595}, {0,25,6022}, {0,25,6034}, {0,25,6046}, {0,9,6058}, {0,9,6064},
+    {0,9,6070}, {0,27,1663}, {0,9,6078}, {0,9,6084}, {0,9,6090}, {0,9,6096},
+    {0,9,6104}, {0,9,6110}, {0,9,6116}, {0,27,1607}, {0,9,6122}, {0,25,6128},
+    {0,27,1562}, {0,27,6139}, {0,9,6142}, {0,9,6150}, {0,9,6156}, {0,9,6164},
+    {0,9,6170}, {0,9,6178}, {0,27,1601}, {0,9,6184}, {0,27,1613}, {0,9,6190},
+    {0,27,6196}, {0,24,6203}, {0,27,6208}, {0,27,6214}, {0,24,6220}, {0,24,6225},
+    {0,24,6230}, {0,24,6233}, {0,24,6237}, {0,24,6242}, {0,24,6250}, {0,24,6261},
+    {0,24,6269}, {0,24,6280}, {0,24,6284}, {0,24,6289}, {0,24,6293}, {0,24,6297},
+    {0,24,6301}, {0,24,6315}, {0,24,6318}, {0,24,6321}, {0,24,6324}, {0,24,6327},
+    {0,24,6330}, {0,24,6333}, {0,24,6336}, {0,24,6339}, {0,24,6344}, {0,24,6347},
+    {0,24,6350}, {0,24,6353}, {0,24,6356}, {0,24,6360}, {0,24,6365}, {0,24,6370},
+    {0,24,6373}, {0,24,6378}, {0,24,6383}, {0,24,6388}, {0,24,6392}, {0,24,6397},
+    {0,24,6401}, {0,24,6405}, {0,24,6408}, {0,24,6412}, {0,24,6417}, {0,24,6421},
+    {0,27,6424}, {0,27,6428}, {0,27,90}, {0,24,6431}, {0,24,6434}, {0,24,6438},
+    {0,24,6442}, {0,24,6446}, {0,24,6450}, {0,24,6455}, {0,24,6459}, {0,24,6463},
+    {0,24,6468}, {0,24,6475}, {0,24,6482}, {0,24,6490}, {0,24,6497}, {0,24,6504},
+    {0,24,6511}, {0,24,6518}, {0,24,6525}, {0,24,6532}, {0,24,6539}, {0,24,6546},
+    {0,24,6553}, {0,24,6560}, {0,24,6567}, {0,24,6574}, {0,24,6580}, {0,24,6584},
+    {0,24,6589}, {0,24,6593}, {0,24,6596}, {0,24,6600}, {0,24,6605}, {0,24,6611},
+    {0,24,6615}, {0,24,6618}, {0,24,6622}, {0,24,6627}, {0,24,6631}, {0,24,6636},
+    {0,24,6640}, {0,24,6644}, {0,24,6649}, {0,24,6655}, {0,24,6659}, {0,24,6663},
+    {0,24,6668}, {0,9,6675}, {0,9,6682}, {0,9,6689}, {0,9,6696}, {0,9,6703},
+    {0,9,6710}, {0,9,6717}, {0,9,6724}, {0,9,6731}, {0,9,6738}, {0,9,6745},
+    {0,24,6752}, {0,24,6760}, {0,24,6771}, {0,24,6779}, {0,9,6790}, {0,9,6797},
+    {0,9,6804}, {0,9,6811}, {0,9,6818}, {0,9,6823}, {0,9,6830}, {0,9,6837},
+    {0,9,6842}, {0,9,6847}, {0,9,6854}, {0,9,6861}, {0,9,6868}, {0,9,6875},
+    {0,9,6882}, {0,9,6889}, {0,9,6896}, {0,9,6903}, {0,9,6910}, {0,9,6917},
+    {0,9,6924}, {0,9,6931}, {0,9,6938}, {0,9,6945}, {0,9,6952}, {0,9,6959},
+    {0,9,6966}, {0,9,6973}, {0,9,6980}, {0,9,6987}, {0,9,6994}, {0,9,7001},
+    {0,9,7008}, {0,27,7015}, {0,27,7020}, {0,24,7025}, {0,24,7029}, {0,24,7033},
+    {0,24,7037}, {0,24,7041}, {0,24,7045}, {0,24,7049}, {0,24,7053}, {0,24,7057},
+    {0,24,7061}, {0,24,7065}, {0,24,7069}, {0,24,7074}, {0,24,7079}, {0,24,7084},
+    {0,24,7089}, {0,24,7094}, {0,24,7099}, {0,24,7104}, {0,24,7109}, {0,24,7114},
+    {0,24,7120}, {0,24,7126}, {0,24,7132}, {0,24,7138}, {0,24,7144}, {0,24,7150},
+    {0,24,7156}, {0,24,7162}, {0,24,7168}, {0,24,7174}, {0,24,7180}, {0,24,7184},
+    {0,24,7188}, {0,24,7192}, {0,24,7196}, {0,24,7200}, {0,24,7204}, {0,24,7208},
+    {0,24,7212}, {0,24,7216}, {0,24,7221}, {0,24,7226}, {0,24,7231}, {0,24,7236},
+    {0,24,7241}, {0,24,7246}, {0,24,7251}, {0,24,7256}, {0,24,7261}, {0,24,7266},
+    {0,24,7271}, {0,24,7276}, {0,24,7281}, {0,24,7286}, {0,24,7291}, {0,24,7296},
+    {0,24,7301}, {0,24,7306}, {0,24,7311}, {0,24,7316}, {0,24,7321}, {0,24,7326},
+    {0,24,7331}, {0,24,7336}, {0,24,7341}, {0,24,7346}, {0,24,7351}, {0,24,7356},
+    {0,24,7361}, {0,24,7366}, {0,24,7371}, {0,24,7376}, {0,24,7381}, {0,24,7386},
+    {0,24,7391}, {0,24,7396}, {0,24,7401}, {0,24,7404}, {0,24,7407}, {0,24,7410},
+    {0,24,7424}, {0,24,7429}, {0,24,7433}, {0,27,7438}, {0,24,7445}, {0,24,7450},
+    {0,24,7455}, {0,24,7460}, {0,24,7465}, {0,24,7470}, {0,24,7475}, {0,24,7480},
+    {0,24,7485}, {0,24,7490}, {0,24,7495}, {0,24,7500}, {0,24,7505}, {0,24,7510},
+    {0,24,7515}, {0,24,7520}, {0,24,7525}, {0,24,7530}, {0,24,7535}, {0,24,7540},
+    {0,24,7545}, {0,24,7550}, {0,24,7555}, {0,24,7560}, {0,24,7565}, {0,24,7570},
+    {0,24,7575}, {0,24,7580}, {0,24,7585}, {0,24,7590}, {0,24,7595}, {0,24,7600},
+    {0,24,7605}, {0,24,7610}, {0,24,7615}, {0,24,7620}, {0,24,7625}, {0,24,7630},
+    {0,24,7635}, {0,24,7640}, {0,24,7645}, {0,24,7650}, {0,24,7655}, {0,24,7660},
+    {0,24,7665}, {0,24,7670}, {0,24,7675}, {0,24,7680}, {0,24,7685}, {0,24,7690},
+    {0,24,7695}, {0,24,7700}, {0,24,7705}, {0,24,7710}, {0,24,7715}, {0,24,7720},
+    {0,24,7725}, {0,24,7730}, {0,24,7735}, {0,24,7740}, {0,24,7745}, {0,24,7750},
+    {0,24,7755}, {0,24,7760}, {0,24,7765}, {0,24,7770}, {0,24,7775}, {0,24,7780},
+    {0,24,7785}, {0,24,7790}, {0,24,7795}, {0,24,7800}, {0,24,7805}, {0,24,7810},
+    {0,24,7815}, {0,24,7820}, {0,24,7825}, {0,24,7830}, {0,24,7835}, {0,24,7840},
+    {0,24,7845}, {0,24,7850}, {0,24,7855}, {0,24,7860}, {0,24,7865}, {0,24,7870},
+    {0,24,7875}, {0,24,7880}, {0,24,7885}, {0,24,7890}, {0,24,7895}, {0,24,7900},
+    {0,24,7905}, {0,24,7910}, {0,24,7915}, {0,24,7920}, {0,24,7925}, {0,24,7930},
+    {0,24,7935}, {0,24,7940}, {0,24,7945}, {0,24,7950}, {0,24,7955}, {0,24,7960},
+    {0,24,7965}, {0,24,7970}, {0,24,7975}, {0,24,7980}, {0,24,7985}, {0,24,7990},
+    {0,24,7995}, {0,24,8000}, {0,24,8005}, {0,24,8010}, {0,24,8015}, {0,24,8020},
+    {0,24,8025}, {0,24,8030}, {0,24,8035}, {0,24,8040}, {0,24,8045}, {0,24,8050},
+    {0,24,8055}, {0,24,8060}, {0,24,8065}, {0,24,8070}, {0,24,8075}, {0,24,8080},
+    {0,24,8085}, {0,24,8090}, {0,24,8095}, {0,24,8100}, {0,24,8105}, {0,24,8110},
+    {0,24,8115}, {0,24,8120}, {0,24,8125}, {0,24,8130}, {0,24,8135}, {0,24,8140},
+    {0,24,8145}, {0,24,8150}, {0,24,8155}, {0,24,8160}, {0,24,8165}, {0,24,8170},
+    {0,24,8175}, {0,24,8180}, {0,24,8185}, {0,24,8190}, {0,24,8195}, {0,24,8200},
+    {0,24,8205}, {0,24,8210}, {0,24,8215}, {0,24,8220}, {0,24,8225}, {0,24,8230},
+    {0,24,8235}, {0,24,8240}, {0,24,8245}, {0,24,8250}, {0,24,8255}, {0,24,8260},
+    {0,24,8265}, {0,24,8270}, {0,24,8275}, {0,24,8280}, {0,24,8285}, {0,24,8290},
+    {0,24,8295}, {0,24,8300}, {0,24,8305}, {0,24,8310}, {0,24,8315}, {0,24,8320},
+    {0,24,8325}, {0,24,8330}, {0,24,8335}, {0,24,8340}, {0,24,8345}, {0,24,8350},
+    {0,24,8355}, {0,24,8360}, {0,24,8365}, {0,24,8370}, {0,24,8375}, {0,24,8380},
+    {0,24,8385}, {0,24,8390}, {0,24,8395}, {0,24,8400}, {0,24,8405}, {0,24,8410},
+    {0,24,8415}, {0,24,8420}, {0,24,8425}, {0,24,8430}, {0,24,8435}, {0,24,8440},
+    {0,24,8445}, {0,24,8450}, {0,24,8455}, {0,24,8460}, {0,24,8465}, {0,24,8470},
+    {0,24,8475}, {0,24,8480}, {0,24,8485}, {0,24,8490}, {0,24,8495}, {0,24,8500},
+    {0,24,8505}, {0,24,8510}, {0,24,8515}, {0,24,8520}, {0,24,8525}, {224,0,0},
+    {0,24,8530}, {0,24,8535}, {0,24,8540}, {0,9,8545}, {0,9,8553}, {0,9,8561},
+    {0,9,8569}, {0,9,8577}, {0,9,8585}, {0,9,8593}, {0,9,8601}, {0,9,8609},
+    {0,9,8617}, {0,9,8625}, {0,9,8633}, {0,9,8641}, {0,9,8649}, {0,9,8657},
+    {0,9,8665}, {0,9,8673}, {0,9,8681}, {0,9,8689}, {0,9,8697}, {0,9,8705},
+    {0,9,8713}, {0,9,8721}, {0,9,8729}, {0,9,8737}, {0,9,8745}, {8,36,0},
+    {0,24,8753}, {0,24,8759}, {0,9,8765}, {0,24,8773}, {0,9,8781}, {0,9,8789},
+    {0,9,8797}, {0,9,8805}, {0,9,8813}, {0,9,8821}, {0,9,8829}, {0,9,8837},
+    {0,9,8845}, {0,9,8853}, {0,9,8861}, {0,9,8869}, {0,9,8877}, {0,9,8885},
+    {0,9,8893}, {0,9,8901}, {0,9,8909}, {0,9,8917}, {0,9,8925}, {0,9,8933},
+    {0,9,8941}, {0,9,8949}, {0,9,8957}, {0,9,8965}, {0,9,8973}, {0,9,8981},
+    {0,9,8989}, {0,9,8997}, {0,9,9005}, {0,9,9013}, {0,9,9021}, {0,24,9029},
+    {0,24,9037}, {0,24,9042}, {0,24,9047}, {0,24,9052}, {0,24,9057}, {0,24,9062},
+    {0,24,9067}, {0,24,9072}, {0,24,9077}, {0,24,9082}, {0,24,9087}, {0,24,9092},
+    {0,24,9097}, {0,24,9102}, {0,24,9107}, {0,24,9112}, {0,24,9117}, {0,24,9122},
+    {0,24,9127}, {0,24,9132}, {0,24,9137}, {0,24,9142}, {0,24,9147}, {0,24,9152},
+    {0,24,9157}, {0,24,9162}, {0,24,9167}, {0,24,9172}, {0,24,9177}, {0,24,9182},
+    {0,24,9187}, {0,24,9192}, {0,24,9197}, {0,24,9202}, {0,24,9207}, {0,24,9212},
+    {0,24,9217}, {0,24,9222}, {0,24,9227}, {0,24,9232}, {0,24,9237}, {0,24,9242},
+    {0,24,9247}, {0,24,9252}, {0,24,9257}, {0,24,9262}, {0,24,9267}, {0,24,9272},
+    {0,24,9277}, {0,24,9282}, {0,24,9287}, {0,24,9292}, {0,24,9297}, {0,24,9302},
+    {0,24,9307}, {0,24,9312}, {0,24,9317}, {0,24,9322}, {0,24,9327}, {0,24,9332},
+    {0,24,9337}, {0,24,9342}, {0,24,9347}, {0,24,9352}, {0,24,9357}, {0,24,9362},
+    {0,24,9367}, {0,24,9372}, {0,24,9377}, {0,24,9382}, {0,24,9387}, {0,24,9392},
+    {0,24,9397}, {0,24,9402}, {0,24,9407}, {0,24,9412}, {0,24,9417}, {0,24,9422},
+    {0,24,9427}, {0,24,9432}, {0,24,9437}, {0,24,9442}, {0,24,9447}, {0,24,9452},
+    {0,24,9457}, {0,24,9462}, {0,24,9467}, {0,24,9472}, {0,24,9477}, {0,24,9482},
+    {0,24,9487}, {0,24,9492}, {0,24,9497}, {0,24,9502}, {0,24,9507}, {0,24,9512},
+    {0,24,9517}, {0,24,9522}, {0,24,9527}, {0,24,9532}, {0,24,9537}, {0,24,9542},
+    {0,24,9547}, {0,24,9552}, {0,24,9557}, {0,24,9564}, {0,24,9571}, {0,24,9578},
+    {0,24,9585}, {0,24,9592}, {0,24,9599}, {0,24,9606}, {0,24,9613}, {0,24,9620},
+    {0,24,9627}, {0,24,9634}, {0,24,9641}, {0,24,9648}, {0,24,9655}, {0,24,9665},
+    {0,24,9675}, {0,24,9685}, {0,24,9695}, {0,24,9705}, {0,24,9715}, {0,24,9725},
+    {0,24,9735}, {0,24,9745}, {0,24,9755}, {0,24,9765}, {0,24,9775}, {0,24,9785},
+    {0,24,9795}, {0,24,9805}, {0,24,9824}, {0,24,9840}, {0,24,9847}, {0,24,9854},
+    {0,24,9861}, {0,24,9868}, {0,24,9875}, {0,24,9882}, {0,24,9889}, {0,24,9896},
+    {0,24,9903}, {0,24,9910}, {0,24,9917}, {0,24,9924}, {0,24,9931}, {0,24,9938},
+    {0,24,9945}, {0,24,9952}, {0,24,9959}, {0,24,9966}, {0,24,9973}, {0,24,9980},
+    {0,24,9987}, {0,24,9994}, {0,24,10001}, {0,24,10008}, {0,24,10015}, {0,24,10022},
+    {0,24,10029}, {0,24,10036}, {0,24,10043}, {0,24,10050}, {0,24,10057}, {0,24,10064},
+    {0,24,10071}, {0,24,10078}, {0,24,10085}, {0,24,10092}, {0,24,10097}, {0,24,10102},
+    {0,24,10107}, {0,24,10112}, {0,24,10116}, {0,24,10120}, {0,24,10124}, {0,24,10128},
+    {0,24,10132}, {0,24,10136}, {0,24,10140}, {0,24,10144}, {0,24,10148}, {0,24,10152},
+    {0,24,10156}, {0,24,10160}, {0,24,10164}, {0,24,10168}, {0,24,10172}, {0,24,10180},
+    {0,24,10188}, {0,24,10196}, {0,24,10204}, {0,24,10212}, {0,24,10220}, {0,24,10228},
+    {0,24,10236}, {0,24,10244}, {0,24,10252}, {0,24,10260}, {0,24,10268}, {0,24,10276},
+    {0,24,10284}, {0,24,10301}, {0,24,10315}, {0,24,10323}, {0,24,10328}, {0,24,10333},
+    {0,24,10338}, {0,24,10343}, {0,24,10348}, {0,24,10353}, {0,24,10358}, {0,24,10363},
+    {0,24,10368}, {0,24,10373}, {0,24,10378}, {0,24,10383}, {0,24,10388}, {0,24,10393},
+    {0,24,10398}, {0,24,10403}, {0,24,10408}, {0,24,10413}, {0,24,10418}, {0,24,10423},
+    {0,24,10428}, {0,24,10433}, {0,24,10438}, {0,24,10443}, {0,24,10448}, {0,24,10453},
+    {0,24,10458}, {0,24,10463}, {0,24,10468}, {0,24,10473}, {0,24,10478}, {0,24,10483},
+    {0,24,10487}, {0,24,10491}, {0,24,10495}, {0,24,10499}, {0,24,10503}, {0,24,10507},
+    {0,24,10511}, {0,24,10515}, {0,24,10519}, {0,24,10523}, {0,24,10527}, {0,24,10531},
+    {0,24,10535}, {0,24,10539}, {0,24,10543}, {0,24,10549}, {0,24,10555}, {0,24,10561},
+    {0,24,10567}, {0,24,10573}, {0,24,10579}, {0,24,10585}, {0,24,10591}, {0,24,10597},
+    {0,24,10604}, {0,24,10611}, {0,24,10618}, {0,24,10622}, {0,24,10627}, {0,24,10631},
+    {0,24,10636}, {0,24,10641}, {0,24,10646}, {0,24,10651}, {0,24,10656}, {0,24,10661},
+    {0,24,10666}, {0,24,10671}, {0,24,10676}, {0,24,10681}, {0,24,10686}, {0,24,10691},
+    {0,24,10696}, {0,24,10701}, {0,24,10706}, {0,24,10711}, {0,24,10716}, {0,24,10721},
+    {0,24,10726}, {0,24,10731}, {0,24,10736}, {0,24,10741}, {0,24,10746}, {0,24,10751},
+    {0,24,10756}, {0,24,10761}, {0,24,10766}, {0,24,10771}, {0,24,10776}, {0,24,10781},
+    {0,24,10786}, {0,24,10791}, {0,24,10796}, {0,24,10801}, {0,24,10806}, {0,24,10811},
+    {0,24,10816}, {0,24,10821}, {0,24,10826}, {0,24,10831}, {0,24,10836}, {0,24,10841},
+    {0,24,10846}, {0,24,10851}, {0,24,10856}, {0,24,10861}, {0,24,10866}, {0,24,10871},
+    {0,24,10879}, {0,24,10896}, {0,24,10910}, {0,24,10927}, {0,24,10938}, {0,24,10955},
+    {0,24,10966}, {0,24,10977}, {0,24,10997}, {0,24,11011}, {0,24,11022}, {0,24,11033},
+    {0,24,11044}, {0,24,11058}, {0,24,11072}, {0,24,11086}, {0,24,11100}, {0,24,11114},
+    {0,24,11128}, {0,24,11142}, {0,24,11162}, {0,24,11170}, {0,24,11190}, {0,24,11210},
+    {0,24,11227}, {0,24,11241}, {0,24,11261}, {0,24,11281}, {0,24,11295}, {0,24,11306},
+    {0,24,11317}, {0,24,11331}, {0,24,11345}, {0,24,11362}, {0,24,11379}, {0,24,11390},
+    {0,24,11401}, {0,24,11415}, {0,24,11426}, {0,24,11437}, {0,24,11445}, {0,24,11453},
+    {0,24,11464}, {0,24,11475}, {0,24,11495}, {0,24,11509}, {0,24,11526}, {0,24,11546},
+    {0,24,11560}, {0,24,11571}, {0,24,11582}, {0,24,11602}, {0,24,11616}, {0,24,11636},
+    {0,24,11647}, {0,24,11664}, {0,24,11675}, {0,24,11689}, {0,24,11700}, {0,24,11714},
+    {0,24,11731}, {0,24,11745}, {0,24,11762}, {0,24,11776}, {0,24,11784}, {0,24,11801},
+    {0,24,11812}, {0,24,11823}, {0,24,11837}, {0,24,11848}, {0,24,11859}, {0,24,11870},
+    {0,24,11887}, {0,24,11901}, {0,24,11909}, {0,24,11929}, {0,24,11940}, {0,24,11957},
+    {0,24,11971}, {0,24,11985}, {0,24,11996}, {0,24,12007}, {0,24,12021}, {0,24,12029},
+    {0,24,12043}, {0,24,12060}, {0,24,12068}, {0,24,12088}, {0,24,12099}, {0,24,12105},
+    {0,24,12111}, {0,24,12117}, {0,24,12123}, {0,24,12129}, {0,24,12135}, {0,24,12141},
+    {0,24,12147}, {0,24,12153}, {0,24,12159}, {0,24,12166}, {0,24,12173}, {0,24,12180},
+    {0,24,12187}, {0,24,12194}, {0,24,12201}, {0,24,12208}, {0,24,12215}, {0,24,12222},
+    {0,24,12229}, {0,24,12236}, {0,24,12243}, {0,24,12250}, {0,24,12257}, {0,24,12264},
+    {0,24,12269}, {0,24,12273}, {0,24,12277}, {0,24,12282}, {0,24,12286}, {0,24,12290},
+    {0,24,12294}, {0,24,12299}, {0,24,12304}, {0,24,12308}, {0,24,12316}, {0,24,12324},
+    {0,24,12332}, {0,24,12340}, {0,24,12354}, {0,24,12358}, {0,24,12362}, {0,24,12367},
+    {0,24,12371}, {0,24,12375}, {0,24,12379}, {0,24,12383}, {0,24,12387}, {0,24,12392},
+    {0,24,12398}, {0,24,12402}, {0,24,12406}, {0,24,12411}, {0,24,12416}, {0,24,12420},
+    {0,24,12424}, {0,24,12428}, {0,24,12433}, {0,24,12438}, {0,24,12443}, {0,24,12448},
+    {0,24,12453}, {0,24,12457}, {0,24,12461}, {0,24,12465}, {0,24,12469}, {0,24,12473},
+    {0,24,12478}, {0,24,12482}, {0,24,12486}, {0,24,12490}, {0,24,12495}, {0,24,12500},
+    {0,24,12504}, {0,24,12509}, {0,24,12514}, {0,24,12519}, {0,24,12523}, {0,24,12528},
+    {0,24,12535}, {0,24,12543}, {0,24,12547}, {0,24,12552}, {0,24,12557}, {0,24,12562},
+    {0,24,12567}, {0,24,12576}, {0,24,12586}, {0,24,12590}, {0,24,12594}, {0,24,12599},
+    {0,24,12603}, {0,24,12607}, {0,24,12611}, {0,24,12616}, {0,24,12620}, {0,24,12624},
+    {0,24,12628}, {0,24,12632}, {0,24,12636}, {0,24,12641}, {0,24,12645}, {0,24,12649},
+    {0,24,12653}, {0,24,12658}, {0,24,12663}, {0,24,12669}, {0,24,12673}, {0,24,12677},
+    {0,24,12681}, {0,24,12689}, {0,24,12694}, {0,24,12698}, {0,24,12702}, {0,24,12706},
+    {0,24,12710}, {0,24,12714}, {0,24,12718}, {0,24,12722}, {0,24,12726}, {0,24,12730},
+    {0,24,12734}, {0,24,12739}, {0,24,12743}, {0,24,12747}, {0,24,12752}, {0,24,12757},
+    {0,24,12761}, {0,24,12767}, {0,24,12772}, {0,24,12776}, {0,24,12780}, {0,24,12784},
+    {0,24,12788}, {0,24,12795}, {0,24,12802}, {0,24,12808}, {0,24,12814}, {0,24,12820},
+    {0,24,12826}, {0,24,12832}, {0,24,12838}, {0,24,12844}, {0,24,12850}, {0,24,12856},
+    {0,24,12863}, {0,24,12870}, {0,24,12877}, {0,24,12884}, {0,24,12891}, {0,24,12898},
+    {0,24,12905}, {0,24,12912}, {0,24,12919}, {0,24,12926}, {0,24,12933}, {0,24,12940},
+    {0,24,12947}, {0,24,12954}, {0,24,12961}, {0,24,12968}, {0,24,12975}, {0,24,12982},
+    {0,24,12989}, {0,24,12996}, {0,24,13003}, {0,24,13010}, {0,24,13015}, {0,24,13019},
+    {0,24,13023}, {0,24,13028}, {0,24,13032}, {0,24,13036}, {0,24,13041}, {0,24,13046},
+    {0,24,13050}, {0,24,13055}, {0,9,0}, {0,27,13059}, {0,27,13064}, {0,27,13069},
+    {0,27,13074}, {0,27,13079}, {0,27,13084}, {0,27,13089}, {0,27,13094}, {0,27,13099},
+    {0,27,13104}, {0,27,13109}, {0,27,13114}, {0,27,13119}, {0,27,13124}, {0,27,13129},
+    {0,27,13134}, {0,27,13139}, {0,27,13144}, {0,27,13149}, {0,27,13154}, {0,27,13159},
+    {0,27,13164}, {0,27,13169}, {0,27,13174}, {0,27,13179}, {0,27,13184}, {0,27,13189},
+    {0,27,13194}, {0,27,13199}, {0,27,13204}, {0,27,13209}, {0,27,13214}, {0,27,13219},
+    {0,27,13224}, {0,27,13229}, {0,27,13234}, {0,27,13239}, {0,27,13244}, {0,27,13249},
+    {0,27,13254}, {0,27,13259}, {0,27,13264}, {0,27,13269}, {0,27,13274}, {0,27,13279},
+    {0,27,13284}, {0,27,13289}, {0,27,13294}, {0,27,13299}, {0,27,13304}, {0,27,13309},
+    {0,27,13314}, {0,27,13319}, {0,27,13324}, {0,27,13329}, {0,27,13334}, {0,27,13339},
+    {0,27,13344}, {0,27,13349}, {0,27,13354}, {0,27,13359}, {0,27,13364}, {0,27,13369},
+    {0,27,13374}, {0,27,13379}, {0,27,13384}, {0,27,13389}, {0,27,13394}, {0,27,13399},
+    {0,27,13404}, {0,27,13409}, {0,27,13414}, {0,27,13419}, {0,27,13424}, {0,27,13429},
+    {0,27,13434}, {0,27,13439}, {0,27,13444}, {0,27,13449}, {0,27,13454}, {0,27,13459},
+    {0,27,13464}, {0,27,13469}, {0,27,13474}, {0,27,13479}, {0,27,13484}, {0,27,13489},
+    {0,27,13494}, {0,27,13499}, {0,27,13504}, {0,27,13509}, {0,27,13514}, {0,27,13519},
+    {0,27,13524}, {0,27,13529}, {0,27,13534}, {0,27,13539}, {0,27,13544}, {0,27,13549},
+    {0,27,13554}, {0,27,13559}, {0,27,13564}, {0,27,13569}, {0,27,13574}, {0,27,13579},
+    {0,27,13584}, {0,27,13589}, {0,27,13594}, {0,27,13599}, {0,27,13604}, {0,27,13609},
+    {0,27,13614}, {0,27,13619}, {0,27,13624}, {0,27,13629}, {0,27,13634}, {0,27,13639},
+    {0,27,13644}, {0,27,13649}, {0,27,13654}, {0,27,13659}, {0,27,13664}, {0,27,13669},
+    {0,27,13674}, {0,27,13679}, {0,27,13684}, {0,27,13689}, {0,27,13694}, {0,27,13699},
+    {0,27,13704}, {0,27,13709}, {0,27,13714}, {0,27,13719}, {0,27,13724}, {0,27,13729},
+    {0,27,13734}, {0,27,13739}, {0,27,13744}, {0,27,13749}, {0,27,13754}, {0,27,13759},
+    {0,27,13764}, {0,27,13769}, {0,27,13774}, {0,27,13779}, {0,27,13784}, {0,27,13789},
+    {0,27,13794}, {0,27,13799}, {0,27,13804}, {0,27,13809}, {0,27,13814}, {0,27,13819},
+    {0,27,13824}, {0,27,13829}, {0,27,13834}, {0,27,13839}, {0,27,13844}, {0,27,13849},
+    {0,27,13854}, {0,27,13859}, {0,27,13864}, {0,27,13869}, {0,27,13874}, {0,27,13879},
+    {0,27,13884}, {0,27,13889}, {0,27,13894}, {0,27,13899}, {0,27,13904}, {0,27,13909},
+    {0,27,13914}, {0,27,13919}, {0,27,13924}, {0,27,13929}, {0,27,13934}, {0,27,13939},
+    {0,27,13944}, {0,27,13949}, {0,27,13954}, {0,27,13959}, {0,27,13964}, {0,27,13969},
+    {0,27,13974}, {0,27,13979}, {0,27,13984}, {0,27,13989}, {0,27,13994}, {0,27,13999},
+    {0,27,14004}, {0,27,14009}, {0,27,14014}, {0,27,14019}, {0,27,14024}, {0,27,14029},
+    {0,27,14034}, {0,27,14039}, {0,27,14044}, {0,27,14049}, {0,27,14054}, {0,27,14059},
+    {0,27,14064}, {0,27,14069}, {0,27,14074}, {0,27,14079}, {0,27,14084}, {0,27,14089},
+    {0,27,14094}, {0,27,14099}, {0,27,14104}, {0,27,14109}, {0,27,14114}, {0,27,14119},
+    {0,27,14124}, {0,27,14129}, {0,27,14134}, {0,27,14139}, {0,27,14144}, {0,27,14149},
+    {0,27,14154}, {0,27,14159}, {0,27,14164}, {0,27,14169}, {0,27,14174}, {0,27,14179},
+    {0,27,14184}, {0,27,14189}, {0,27,14194}, {0,27,14199}, {0,27,14204}, {0,27,14209},
+    {0,27,14214}, {0,27,14219}, {0,27,14224}, {0,27,14229}, {0,27,14234}, {0,27,14239},
+    {0,27,14244}, {0,27,14249}, {0,27,14254}, {0,27,14259}, {0,27,14264}, {0,27,14269},
+    {0,27,14274}, {0,27,14279}, {0,27,14284}, {0,27,14289}, {0,27,14294}, {0,27,14299},
+    {0,27,14304}, {0,27,14309}, {0,27,14314}, {0,27,14319}, {0,27,14324}, {0,27,14329},
+    {0,27,14334}, {0,27,14339}, {0,27,14344}, {0,27,14349}, {0,27,14354}, {0,27,14359},
+    {0,27,14364}, {0,27,14369}, {0,27,14374}, {0,27,14379}, {0,27,14384}, {0,27,14389},
+    {0,27,14394}, {0,27,14399}, {0,27,14404}, {0,27,14409}, {0,27,14414}, {0,27,14419},
+    {0,27,14424}, {0,27,14429}, {0,27,14434}, {0,27,14439}, {0,27,14444}, {0,27,14449},
+    {0,27,14454}, {0,27,14459}, {0,27,14464}, {0,27,14469}, {0,27,14474}, {0,27,14479},
+    {0,27,14484}, {0,27,14489}, {0,27,14494}, {0,27,14499}, {0,27,14504}, {0,27,14509},
+    {0,27,14514}, {0,27,14519}, {0,27,14524}, {0,27,14529}, {0,27,14534}, {0,27,14539},
+    {0,27,14544}, {0,27,14549}, {0,27,14554}, {0,27,14559}, {0,27,14564}, {0,27,14569},
+    {0,27,14574}, {0,27,14579}, {0,27,14584}, {0,27,14589}, {0,27,14594}, {0,27,14599},
+    {0,27,14604}, {0,27,14609}, {0,27,14614}, {0,27,14619}, {0,27,14624}, {0,27,14629},
+    {0,27,14634}, {0,27,14639}, {0,27,14644}, {0,27,14649}, {0,27,14654}, {0,27,14659},
+    {0,27,14664}, {0,27,14669}, {0,27,14674}, {0,27,14679}, {0,27,14684}, {0,27,14689},
+    {0,27,14694}, {0,27,14699}, {0,27,14704}, {0,27,14709}, {0,27,14714}, {0,27,14719},
+    {0,27,14724}, {0,27,14729}, {0,27,14734}, {0,27,14739}, {0,27,14744}, {0,27,14749},
+    {0,27,14754}, {0,27,14759}, {0,27,14764}, {0,27,14769}, {0,27,14774}, {0,27,14780},
+    {0,27,14785}, {0,27,14790}, {0,27,14795}, {0,27,14800}, {0,27,14805}, {0,27,14810},
+    {0,27,14815}, {0,27,14820}, {0,27,14825}, {0,27,14830}, {0,27,14835}, {0,27,14840},
+    {0,27,14845}, {0,27,14850}, {0,27,14855}, {0,27,14860}, {0,27,14865}, {0,27,14870},
+    {0,27,14875}, {0,27,14880}, {0,27,14885}, {0,27,14890}, {0,27,14895}, {0,27,14900},
+    {0,27,14905}, {0,27,14910}, {0,27,14915}, {0,27,14920}, {0,27,14925}, {0,27,14930},
+    {0,27,14935}, {0,27,14940}, {0,27,14945}, {0,27,14950}, {0,27,14955}, {0,27,14960},
+    {0,27,14965}, {0,27,14970}, {0,27,14975}, {0,27,14980}, {0,27,14985}, {0,27,14990},
+    {0,27,14995}, {0,27,15000}, {0,27,15005}, {0,27,15010}, {0,27,15015}, {0,27,15020},
+    {0,27,15025}, {0,27,15030}, {0,27,15035}, {0,27,15040}, {0,27,15045}, {0,27,15050},
+    {0,27,15055}, {0,27,15060}, {0,27,15065}, {0,27,15070}, {0,27,15075}, {0,27,15080},
+    {0,27,15085}, {0,27,15090}, {0,27,15095}, {0,27,15100}, {0,27,15105}, {0,27,15110},
+    {0,27,15115}, {0,27,15120}, {0,27,15125}, {0,27,15130}, {0,27,15136}, {0,27,15142},
+    {0,27,15148}, {0,27,15153}, {0,27,15158}, {0,27,15163}, {0,27,15169}, {0,27,15175},
+    {0,27,15181}, {0,27,15186}, {0,24,15191}, {0,24,15195}, {0,24,15199}, {0,24,15203},
+    {0,24,15208}, {0,24,15213}, {0,24,15217}, {0,24,15223}, {0,24,15229}, {0,24,15235},
+    {0,24,15241}, {0,27,15247}, {26,0,0}, {0,27,15253}, {0,24,15259}, {0,24,15263},
+    {0,24,15267}, {0,24,15271}, {0,24,15275}, {0,24,15279}, {0,24,15283}, {0,27,15287},
+    {0,27,15293}, {0,27,15299}, {0,27,15307}, {0,27,15315}, {0,27,15321}, {0,27,15327},
+    {0,27,15333}, {0,27,15339}, {0,27,15345}, {0,27,15351}, {0,27,15357}, {0,27,15363},
+    {0,27,15369}, {0,27,15375}, {0,27,15381}, {0,27,15387}, {0,27,15393}, {0,27,15399},
+    {0,27,15405}, {0,27,15411}, {0,27,15417}, {0,27,15423}, {0,27,15429}, {0,27,15435},
+    {0,27,15441}, {0,27,15447}, {0,27,15453}, {0,27,15459}, {0,27,15465}, {0,27,15471},
+    {0,27,15477}, {0,24,15483}, {0,24,15489}, {0,24,15493}, {0,24,15497}, {0,24,15501},
+    {0,24,15505}, {0,24,15509}, {0,24,15513}, {0,24,15517}, {0,24,15521}, {0,24,15525},
+    {0,24,15529}, {0,24,15533}, {0,24,15537}, {0,24,15541}, {0,24,15545}, {0,24,15549},
+    {0,24,15553}, {0,24,15557}, {0,24,15561}, {0,24,15565}, {0,24,15569}, {0,24,15573},
+    {0,24,15577}, {0,24,15581}, {0,24,15585}, {0,24,15589}, {0,24,15595}, {0,24,15599},
+    {0,24,15603}, {0,24,15607}, {0,24,15613}, {0,24,15617}, {0,24,15621}, {0,24,15625},
+    {0,24,15629}, {0,24,15633}, {0,24,15637}, {0,24,15641}, {0,24,15645}, {0,24,15649},
+    {0,24,15657}, {0,24,15665}, {0,24,15673}, {0,24,15681}, {0,24,15689}, {0,24,15697},
+    {0,24,15705}, {0,24,15713}, {0,24,15717}, {0,24,15725}, {0,24,15733}, {0,24,15741},
+    {0,24,15749}, {0,24,15755}, {0,24,15761}, {0,24,15767}, {0,24,15773}, {0,24,15779},
+    {0,24,15785}, {0,24,15791}, {0,24,15797}, {0,24,15803}, {0,24,15809}, {0,24,15815},
+    {0,24,15821}, {0,24,15827}, {0,24,15833}, {0,24,15839}, {0,24,15845}, {0,24,15851},
+    {0,24,15857}, {0,24,15863}, {0,24,15869}, {0,24,15875}, {0,24,15881}, {0,24,15887},
+    {0,24,15893}, {0,24,15899}, {0,24,15905}, {0,24,15911}, {0,24,15917}, {0,24,15923},
+    {0,24,15929}, {0,24,15935}, {0,24,15941}, {0,24,15947}, {0,24,15953}, {0,24,15959},
+    {0,24,15965}, {0,24,15971}, {0,24,15977}, {0,24,15983}, {0,24,15989}, {0,24,15995},
+    {0,24,16001}, {0,24,16007}, {0,24,16013}, {0,24,16019}, {0,24,16025}, {0,24,16031},
+    {0,24,16037}, {0,24,16043}, {0,24,16049}, {0,24,16055}, {0,24,16061}, {0,24,16067},
+    {0,24,16073}, {0,24,16079}, {0,24,16085}, {0,24,16091}, {0,24,16097}, {0,24,16103},
+    {0,24,16109}, {0,24,16115}, {0,24,16121}, {0,24,16127}, {0,24,16133}, {0,24,16139},
+    {0,24,16145}, {0,24,16151}, {0,24,16157}, {0,24,16163}, {0,24,16169}, {0,24,16175},
+    {0,24,16181}, {0,24,16187}, {0,24,16193}, {0,24,16199}, {0,24,16205}, {0,24,16211},
+    {0,24,16217}, {0,24,16223}, {0,24,16229}, {0,24,16235}, {0,24,16241}, {0,24,16247},
+    {0,24,16253}, {0,24,16259}, {0,24,16265}, {0,24,16271}, {0,24,16277}, {0,24,16283},
+    {0,24,16290}, {0,24,16297}, {0,24,16304}, {0,24,16311}, {0,24,16318}, {0,24,16325},
+    {0,24,16333}, {0,24,16341}, {0,24,16349}, {0,24,16355}, {0,24,16361}, {0,24,16367},
+    {0,24,16373}, {0,24,16379}, {0,24,16385}, {0,24,16391}, {0,24,16397}, {0,24,16403},
+    {0,24,16409}, {0,24,16415}, {0,24,16421}, {0,24,16427}, {0,24,16433}, {0,24,16439},
+    {0,24,16445}, {0,24,16453}, {0,24,16461}, {0,24,16467}, {0,24,16473}, {0,24,16479},
+    {0,24,16485}, {0,24,16491}, {0,24,16497}, {0,24,16503}, {0,24,16509}, {0,24,16515},
+    {0,24,16521}, {0,24,16527}, {0,24,16535}, {0,24,16543}, {0,24,16551}, {0,24,16557},
+    {0,24,16563}, {0,24,16569}, {0,24,16575}, {0,24,16581}, {0,24,16587}, {0,24,16593},
+    {0,24,16599}, {0,24,16605}, {0,24,16611}, {0,24,16617}, {0,24,16623}, {0,24,16629},
+    {0,24,16635}, {0,24,16641}, {0,24,16647}, {0,24,16653}, {0,24,16659}, {0,24,16665},
+    {0,24,16671}, {0,24,16677}, {0,24,16683}, {0,24,16689}, {0,24,16695}, {0,24,16701},
+    {0,24,16707}, {0,24,16713}, {0,24,16719}, {0,24,16727}, {0,24,16735}, {0,24,16743},
+    {0,24,16751}, {0,24,16759}, {0,24,16767}, {0,24,16775}, {0,24,16783}, {0,24,16791},
+    {0,24,16799}, {0,24,16807}, {0,24,16815}, {0,24,16823}, {0,24,16831}, {0,24,16839},
+    {0,24,16847}, {0,24,16855}, {0,24,16863}, {0,24,16871}, {0,24,16879}, {0,24,16887},
+    {0,24,16895}, {0,24,16903}, {0,24,16911}, {0,24,16919}, {0,24,16927}, {0,24,16935},
+    {0,24,16943}, {0,24,16951}, {0,24,16959}, {0,24,16967}, {0,24,16975}, {0,24,16983},
+    {0,24,16991}, {0,24,16999}, {0,24,17007}, {0,24,17015}, {0,24,17023}, {0,24,17031},
+    {0,24,17039}, {0,24,17047}, {0,24,17055}, {0,24,17063}, {0,24,17071}, {0,24,17079},
+    {0,24,17087}, {0,24,17095}, {0,24,17103}, {0,24,17111}, {0,24,17119}, {0,24,17127},
+    {0,24,17135}, {0,24,17143}, {0,24,17151}, {0,24,17159}, {0,24,17167}, {0,24,17175},
+    {0,24,17183}, {0,24,17191}, {0,24,17199}, {0,24,17207}, {0,24,17215}, {0,24,17223},
+    {0,24,17231}, {0,24,17239}, {0,24,17247}, {0,24,17255}, {0,24,17263}, {0,24,17271},
+    {0,24,17279}, {0,24,17287}, {0,24,17295}, {0,24,17303}, {0,24,17311}, {0,24,17319},
+    {0,24,17327}, {0,24,17335}, {0,24,17343}, {0,24,17351}, {0,24,17359}, {0,24,17367},
+    {0,24,17375}, {0,24,17383}, {0,24,17391}, {0,24,17399}, {0,24,17407}, {0,24,17415},
+    {0,24,17423}, {0,24,17431}, {0,24,17439}, {0,24,17447}, {0,24,17455}, {0,24,17463},
+    {0,24,17471}, {0,24,17479}, {0,24,17487}, {0,24,17497}, {0,24,17507}, {0,24,17517},
+    {0,24,17527}, {0,24,17537}, {0,24,17547}, {0,24,17557}, {0,24,17565}, {0,24,17600},
+    {0,24,17617}, {0,24,17627}, {0,24,17630}, {0,24,17635}, {0,24,17640}, {0,24,17643},
+    {0,24,17646}, {0,24,17649}, {0,24,17652}, {0,24,17657}, {0,24,17662}, {0,24,17667},
+    {0,24,17672}, {0,24,17675}, {0,24,17678}, {0,24,17681}, {0,24,17686}, {0,24,17691},
+    {0,24,17696}, {0,24,17701}, {0,24,17706}, {0,24,17711}, {0,24,17716}, {0,24,17721},
+    {0,24,17726}, {0,24,17731}, {0,24,17736}, {0,24,17741}, {0,24,17744}, {0,24,17747},
+    {0,24,17750}, {0,24,17753}, {0,24,17756}, {0,24,17759}, {0,24,17762}, {0,24,17765},
+    {0,24,17768}, {0,24,17771}, {0,24,17774}, {0,24,17777}, {0,24,17782}, {0,24,17788},
+    {0,24,17793}, {0,24,17798}, {0,24,17803}, {0,24,17809}, {0,24,17814}, {0,24,17820},
+    {0,24,17825}, {0,24,17831}, {0,24,17836}, {0,24,17842}, {0,24,17847}, {0,24,17853},
+    {0,24,17857}, {0,24,17863}, {0,24,17869}, {0,24,17875}, {0,24,17881}, {0,24,17887},
+    {0,24,17891}, {0,24,17895}, {0,24,17899}, {0,24,17903}, {0,24,17907}, {0,24,17911},
+    {0,24,17915}, {0,24,17919}, {0,24,17923}, {0,24,17927}, {0,24,17931}, {0,24,17935},
+    {0,24,17939}, {0,24,17943}, {0,24,17947}, {0,24,17951}, {0,24,17955}, {0,24,17959},
+    {0,24,17963}, {0,24,17967}, {0,24,17971}, {0,24,17975}, {0,24,17979}, {0,24,17983},
+    {0,24,17987}, {0,24,17991}, {0,24,17995}, {0,24,17999}, {0,24,18003}, {0,24,18011},
+    {0,24,18019}, {0,24,18027}, {0,24,18033}, {0,24,18036}, {0,24,18039}, {0,24,18042},
+    {0,24,18045}, {0,24,18048}, {0,24,18051}, {0,24,18054}, {0,24,18059}, {0,24,18064},
+    {0,24,18069}, {0,24,18074}, {0,24,18079}, {0,24,18084}, {0,24,18089}, {0,24,18094},
+    {0,24,18099}, {0,24,18104}, {0,24,18109}, {0,24,18114}, {0,24,18119}, {0,24,18124},
+    {0,24,18129}, {0,24,18134}, {0,24,18138}, {0,24,18142}, {0,24,18146}, {0,24,18150},
+    {0,24,18154}, {0,24,18159}, {0,24,18164}, {0,24,18169}, {0,24,18174}, {0,24,18179},
+    {0,24,18184}, {0,24,18189}, {0,24,18194}, {0,24,18198}, {0,24,18202}, {0,24,18206},
+    {0,24,18210}, {0,24,18214}, {0,24,18218}, {0,24,18223}, {0,24,18227}, {0,24,18231},
+    {0,24,18235}, {0,24,18239}, {0,24,18244}, {0,24,18248}, {0,24,18252}, {0,24,18256},
+    {0,24,18260}, {0,24,18264}, {0,24,18268}, {0,24,18272}, {0,24,18276}, {0,24,18280},
+    {0,24,18284}, {0,24,18288}, {0,24,18292}, {0,24,18296}, {0,24,18302}, {0,24,18307},
+    {0,24,18311}, {0,24,18317}, {0,24,18321}, {0,24,18327}, {0,24,18331}, {0,24,18335},
+    {0,24,18339}, {0,24,18343}, {0,24,18349}, {0,24,18353}, {0,24,18357}, {0,24,18361},
+    {0,24,18365}, {0,24,18369}, {0,24,18374}, {0,24,18378}, {0,24,18382}, {0,24,18387},
+    {0,24,18391}, {0,24,18395}, {0,24,18399}, {0,24,18403}, {0,24,18407}, {0,24,18411},
+    {0,24,18415}, {0,24,18421}, {0,9,18427}, {0,9,18437}, {0,9,18447}, {0,9,18457},
+    {0,9,18467}, {0,9,18477}, {0,9,18487}, {0,9,18497}, {0,9,18507}, {0,9,18517},
+    {0,9,18527}, {0,9,18537}, {0,9,18547}, {6,0,0}, {0,27,18557}, {0,27,18567},
+    {0,27,18577}, {0,27,18591}, {0,27,18605}, {0,27,18619}, {0,27,18633}, {226,0,0},
+    {0,27,18647}, {0,27,18657}, {0,27,18667}, {0,27,18681}, {0,27,18695}, {0,27,18709},
+    {0,24,18723}, {0,24,18727}, {0,24,18731}, {0,24,18735}, {0,24,18739}, {0,24,18743},
+    {0,24,18747}, {0,24,18751}, {0,24,18755}, {0,24,18759}, {0,24,18763}, {0,24,18767},
+    {0,24,18771}, {0,24,18775}, {0,24,18779}, {0,24,18783}, {0,24,18787}, {0,24,18791},
+    {0,24,18795}, {0,24,18799}, {0,24,18803}, {0,24,18807}, {0,24,18812}, {0,24,18816},
+    {0,24,18820}, {0,24,18824}, {0,24,18828}, {0,24,18832}, {0,24,18836}, {0,24,18840},
+    {0,24,18844}, {0,24,18848}, {0,24,18852}, {0,24,18856}, {0,24,18860}, {0,24,18864},
+    {0,24,18869}, {0,24,18873}, {0,24,18877}, {0,24,18881}, {0,24,18885}, {0,24,18889},
+    {0,24,18893}, {0,24,18897}, {0,24,18901}, {0,24,18905}, {0,24,18909}, {0,24,18913},
+    {0,24,18917}, {0,24,18921}, {0,24,18925}, {0,24,18929}, {0,24,18933}, {0,24,18938},
+    {0,24,18943}, {0,24,18948}, {0,24,18953}, {0,24,18958}, {0,24,18963}, {0,24,18968},
+    {0,24,18973}, {0,24,18978}, {0,24,18983}, {0,24,18988}, {0,24,18993}, {0,24,18998},
+    {0,24,19003}, {0,24,19008}, {0,24,19013}, {0,24,19018}, {0,24,19023}, {0,24,19028},
+    {0,24,19033}, {0,24,19038}, {0,24,19043}, {0,24,19048}, {0,24,19053}, {0,24,19058},
+    {0,24,19063}, {0,24,19072}, {0,24,19076}, {0,24,19080}, {0,24,19084}, {0,24,19088},
+    {0,24,19092}, {0,24,19097}, {0,24,19101}, {0,24,19105}, {0,24,19109}, {0,24,19113},
+    {0,24,19117}, {0,24,19125}, {0,24,19133}, {0,24,19138}, {0,24,19143}, {0,24,19151},
+    {0,24,19156}, {0,24,19161}, {0,24,19166}, {0,24,19171}, {0,24,19176}, {0,24,19181},
+    {0,24,19186}, {0,24,19191}, {0,24,19196}, {0,24,19201}, {0,24,19206}, {0,24,19211},
+    {0,24,19216}, {0,24,19221}, {0,24,19226}, {0,24,19231}, {0,24,19236}, {0,24,19241},
+    {0,24,19246}, {0,24,19251}, {0,24,19256}, {0,24,19261}, {0,24,19266}, {0,24,19271},
+    {0,24,19276}, {0,24,19281}, {0,24,19286}, {0,24,19291}, {0,24,19296}, {0,24,19307},
+    {0,24,19318}, {0,24,19329}, {0,24,19340}, {0,24,19351}, {0,24,19362}, {0,24,19373},
+    {0,24,19384}, {0,24,19395}, {0,24,19400}, {0,27,19405}, {0,27,19410}, {0,27,19415},
+    {0,27,19420}, {0,27,19426}, {0,27,19431}, {0,27,19436}, {0,27,19441}, {0,27,19446},
+    {0,27,19451}, {0,27,19456}, {0,27,19461}, {0,27,19467}, {0,27,19472}, {0,27,19477},
+    {0,27,19482}, {0,27,19488}, {0,27,19493}, {0,27,19498}, {0,27,19503}, {0,27,19509},
+    {0,27,19514}, {0,27,19519}, {0,27,19524}, {0,27,19529}, {0,27,19535}, {0,27,19540},
+    {0,27,19545}, {0,27,19550}, {0,27,19555}, {0,27,19560}, {0,27,19565}, {0,27,19570},
+    {0,27,19575}, {0,27,19580}, {0,27,19585}, {0,27,19590}, {0,27,19595}, {0,27,19600},
+    {0,27,19605}, {0,27,19610}, {0,27,19616}, {0,27,19621}, {0,27,19626}, {0,27,19631},
+    {0,27,19637}, {0,27,19642}, {0,27,19647}, {0,27,19652}, {0,27,19657}, {0,27,19662},
+    {0,27,19667}, {0,27,19672}, {0,27,19677}, {0,27,19682}, {0,27,19687}, {0,27,19692},
+    {0,27,19697}, {0,27,19702}, {0,27,19707}, {0,27,19712}, {0,27,19717}, {0,27,19722},
+    {0,27,19727}, {0,27,19732}, {0,27,19737}, {0,27,19742}, {0,27,19747}, {0,27,19752},
+    {0,27,19757}, {0,27,19762}, {0,27,19767}, {0,27,19772}, {0,27,19777}, {0,27,19783},
+    {0,27,19788}, {0,27,19793}, {0,27,19798}, {0,27,19803}, {0,27,19808}, {0,27,19813},
+    {0,27,19819}, {0,27,19825}, {0,27,19830}, {0,27,19835}, {0,27,19840}, {0,27,19845},
+    {0,27,19850}, {0,27,19855}, {0,27,19860}, {0,27,19865}, {0,27,19870}, {0,27,19876},
+    {0,27,19881}, {0,27,19886}, {0,27,19891}, {0,27,19897}, {0,27,19902}, {0,27,19907},
+    {0,27,19912}, {0,27,19917}, {0,27,19922}, {0,27,19927}, {0,27,19932}, {0,27,19937},
+    {0,27,19943}, {0,27,19948}, {0,27,19954}, {0,27,19959}, {0,27,19964}, {0,27,19969},
+    {0,27,19974}, {0,27,19979}, {0,27,19984}, {0,27,19989}, {0,27,19994}, {0,27,19999},
+    {0,27,20004}, {0,27,20009}, {0,27,20015}, {0,27,20020}, {0,27,20025}, {0,27,20030},
+    {0,27,20035}, {0,27,20041}, {0,27,20046}, {0,27,20052}, {0,27,20057}, {0,27,20062},
+    {0,27,20067}, {0,27,20073}, {0,27,20079}, {0,27,20084}, {0,27,20089}, {0,27,20094},
+    {0,27,20099}, {0,27,20104}, {0,27,20109}, {0,27,20114}, {0,27,20119}, {0,27,20124},
+    {0,27,20129}, {0,27,20135}, {0,27,20140}, {0,27,20145}, {0,27,20150}, {0,27,20155},
+    {0,27,20160}, {0,27,20165}, {0,27,20170}, {0,27,20175}, {0,27,20180}, {0,27,20185},
+    {0,27,20190}, {0,27,20195}, {0,27,20200}, {0,27,20205}, {0,27,20211}, {0,27,20216},
+    {0,27,20221}, {0,27,20226}, {0,27,20231}, {0,27,20236}, {0,27,20242}, {0,27,20247},
+    {0,27,20252}, {0,27,20257}, {0,27,20262}, {0,27,20267}, {0,27,20272}, {0,27,20277},
+    {0,27,20282}, {0,27,20287}, {0,27,20292}, {0,27,20298}, {0,27,20303}, {0,27,20308},
+    {0,27,20313}, {0,27,20318}, {0,27,20323}, {0,27,20328}, {0,27,20333}, {0,27,20338},
+    {0,27,20343}, {0,27,20348}, {0,27,20353}, {0,27,20358}, {0,27,20363}, {0,27,20368},
+    {0,27,20373}, {0,27,20379}, {0,27,20384}, {0,27,20389}, {0,27,20394}, {0,27,20399},
+    {0,27,20405}, {0,27,20410}, {0,27,20415}, {0,27,20420}, {0,27,20425}, {0,27,20430},
+    {0,27,20435}, {0,27,20440}, {0,27,20446}, {0,27,20451}, {0,27,20456}, {0,27,20461},
+    {0,27,20467}, {0,27,20472}, {0,27,20477}, {0,27,20482}, {0,27,20487}, {0,27,20492},
+    {0,27,20498}, {0,27,20504}, {0,27,20510}, {0,27,20515}, {0,27,20521}, {0,27,20526},
+    {0,27,20531}, {0,27,20536}, {0,27,20541}, {0,27,20546}, {0,27,20551}, {0,27,20556},
+    {0,27,20561}, {0,27,20567}, {0,27,20572}, {0,27,20577}, {0,27,20582}, {0,27,20587},
+    {0,27,20592}, {0,27,20598}, {0,27,20603}, {0,27,20608}, {0,27,20614}, {0,27,20620},
+    {0,27,20625}, {0,27,20630}, {0,27,20635}, {0,27,20640}, {0,27,20645}, {0,27,20650},
+    {0,27,20655}, {0,27,20660}, {0,27,20666}, {0,27,20671}, {0,27,20677}, {0,27,20682},
+    {0,27,20688}, {0,27,20693}, {0,27,20698}, {0,27,20704}, {0,27,20709}, {0,27,20714},
+    {0,27,20720}, {0,27,20726}, {0,27,20731}, {0,27,20736}, {0,27,20741}, {0,27,20746},
+    {0,27,20751}, {0,27,20756}, {0,27,20761}, {0,27,20766}, {0,27,20771}, {0,27,20776},
+    {0,27,20781}, {0,27,20787}, {0,27,20792}, {0,27,20798}, {0,27,20804}, {0,27,20809},
+    {0,27,20815}, {0,27,20821}, {0,27,20827}, {0,27,20832}, {0,27,20837}, {0,27,20843},
+    {0,27,20849}, {0,27,20855}, {0,27,20861}, {0,27,20866}, {0,27,20871}, {0,27,20876},
+    {0,27,20881}, {0,27,20886}, {0,27,20892}, {0,27,20897}, {0,27,20902}, {0,27,20908},
+    {0,27,20914}, {0,27,20920}, {0,27,20925}, {0,27,20930}, {0,27,20935}, {0,27,20940},
+    {0,27,20946}, {0,27,20952}, {0,27,20957}, {0,27,20962}, {0,27,20968}, {0,27,20973},
+    {0,27,20978}, {0,27,20983}, {0,27,20989}, {0,27,20994}, {0,27,20999}, {0,27,21004},
+    {0,27,21009}, {0,27,21014}, {0,27,21020}, {0,27,21025}, {0,27,21030}, {0,27,21035},
+    {0,27,21040}, {0,27,21045}, {0,27,21050}, {0,27,21056}, {0,27,21062}, {0,27,21067},
+    {0,27,21073}, {0,27,21078}, {0,27,21084}, {0,27,21089}, {0,27,21094}, {0,27,21100},
+    {0,27,21106}, {0,27,21111}, {0,27,21117}, {0,27,21122}, {0,27,21128}, {0,27,21133},
+    {0,27,21138}, {0,27,21143}, {0,27,21148}, {0,27,21153}, {0,27,21158}, {0,27,21164},
+    {0,27,21170}, {0,27,21176}, {0,27,21182}, {0,27,21187}, {0,27,21192}, {0,27,21197},
+    {0,27,21202}, {0,27,21207}, {0,27,21212}, {0,27,21217}, {0,27,21222}, {0,27,21227},
+    {0,27,21232}, {0,27,21237}, {0,27,21243}, {0,27,21248}, {0,27,21253}, {0,27,21258},
+    {0,27,21263}, {0,27,21268}, {0,27,21273}, {0,27,21278}, {0,27,21283}, {0,27,21288},
+    {0,27,21293}, {0,27,21299}, {0,27,21305}, {0,27,21311}, {0,27,21316}, {0,27,21321},
+    {0,27,21326}, {0,27,21331}, {0,27,21337}, {0,27,21342}, {0,27,21348}, {0,27,21353},
+    {0,27,21358}, {0,27,21364}, {0,27,21370}, {0,27,21375}, {0,27,21380}, {0,27,21385},
+    {0,27,21390}, {0,27,21395}, {0,27,21400}, {0,27,21405}, {0,27,21410}, {0,27,21415},
+    {0,27,21420}, {0,27,21425}, {0,27,21430}, {0,27,21435}, {0,27,21440}, {0,27,21445},
+    {0,27,21450}, {0,27,21455}, {0,27,21461}, {0,27,21466}, {0,27,21471}, {0,27,21476},
+    {0,27,21481}, {0,27,21486}, {0,27,21492}, {0,27,21498}, {0,27,21503}, {0,27,21508},
+    {0,27,21513}, {0,27,21518}, {0,27,21524}, {0,27,21529}, {0,27,21534}, {0,27,21539},
+    {0,27,21544}, {0,27,21550}, {0,27,21556}, {0,27,21561}, {0,27,21566}, {0,27,21571},
+    {0,27,21577}, {0,27,21582}, {0,27,21588}, {0,27,21594}, {0,27,21599}, {0,27,21604},
+    {0,27,21609}, {0,27,21615}, {0,27,21620}, {0,27,21625}, {0,27,21630}, {0,27,21635},
+    {0,27,21640}, {0,27,21645}, {0,27,21650}, {0,27,21656}, {0,27,21661}, {0,27,21666},
+    {0,27,21671}, {0,27,21677}, {0,27,21682}, {0,27,21687}, {0,27,21692}, {0,27,21697},
+    {0,27,21703}, {0,27,21709}, {0,27,21714}, {0,27,21719}, {0,27,21724}, {0,27,21730},
+    {0,27,21735}, {0,27,21741}, {0,27,21746}, {0,27,21752}, {0,27,21757}, {0,27,21762},
+    {0,27,21767}, {0,27,21772}, {0,27,21777}, {0,27,21782}, {0,27,21787}, {0,27,21793},
+    {0,27,21798}, {0,27,21803}, {0,27,21808}, {0,27,21813}, {0,27,21818}, {0,27,21824},
+    {0,27,21829}, {0,27,21835}, {0,27,21841}, {0,27,21847}, {0,27,21852}, {0,27,21857},
+    {0,27,21862}, {0,27,21867}, {0,27,21872}, {0,27,21877}, {0,27,21882}, {0,27,21887},
+};
+
+// {canonical_length, compat_length, canonical..., compat...} in UTF-8
+static const uint8_t gp_norm_decompositions[21893] = {
+    0, 0, 0, 1, 32, 0, 3, 32, 204, 136, 0, 1, 97, 0, 3, 32,
+    204, 132, 0, 1, 50, 0, 1, 51, 0, 3, 32, 204, 129, 0, 2, 206,
+    188, 0, 3, 32, 204, 167, 0, 1, 49, 0, 1, 111, 0, 5, 49, 226,
+    129, 132, 52, 0, 5, 49, 226, 129, 132, 50, 0, 5, 51, 226, 129, 132,
+    52, 3, 0, 65, 204, 128, 3, 0, 65, 204, 129, 3, 0, 65, 204, 130,
+    3, 0, 65, 204, 131, 3, 0, 65, 204, 136, 3, 0, 65, 204, 138, 3,
+    0, 67, 204, 167, 3, 0, 69, 204, 128, 3, 0, 69, 204, 129, 3, 0,
+    69, 204, 130, 3, 0, 69, 204, 136, 3, 0, 73, 204, 128, 3, 0, 73,
+    204, 129, 3, 0, 73, 204, 130, 3, 0, 73, 204, 136, 3, 0, 78, 204,
+    131, 3, 0, 79, 204, 128, 3, 0, 79, 204, 129, 3, 0, 79, 204, 130,
+    3, 0, 79, 204, 131, 3, 0, 79, 204, 136, 3, 0, 85, 204, 128, 3,
+    0, 85, 204, 129, 3, 0, 85, 204, 130, 3, 0, 85, 204, 136, 3, 0,
+    89, 204, 129, 3, 0, 97, 204, 128, 3, 0, 97, 204, 129, 3, 0, 97,
+    204, 130, 3, 0, 97, 204, 131, 3, 0, 97, 204, 136, 3, 0, 97, 204,
+    138, 3, 0, 99, 204, 167, 3, 0, 101, 204, 128, 3, 0, 101, 204, 129,
+    3, 0, 101, 204, 130, 3, 0, 101, 204, 136, 3, 0, 105, 204, 128, 3,
+    0, 105, 204, 129, 3, 0, 105, 204, 130, 3, 0, 105, 204, 136, 3, 0,
+    110, 204, 131, 3, 0, 111, 204, 128, 3, 0, 111, 204, 129, 3, 0, 111,
+    204, 130, 3, 0, 111, 204, 131, 3, 0, 111, 204, 136, 3, 0, 117, 204,
+    128, 3, 0, 117, 204, 129, 3, 0, 117, 204, 130, 3, 0, 117, 204, 136,
+    3, 0, 121, 204, 129, 3, 0, 121, 204, 136, 3, 0, 65, 204, 132, 3,
+    0, 97, 204, 132, 3, 0, 65, 204, 134, 3, 0, 97, 204, 134, 3, 0,
+    65, 204, 168, 3, 0, 97, 204, 168, 3, 0, 67, 204, 129, 3, 0, 99,
+    204, 129, 3, 0, 67, 204, 130, 3, 0, 99, 204, 130, 3, 0, 67, 204,
+    135, 3, 0, 99, 204, 135, 3, 0, 67, 204, 140, 3, 0, 99, 204, 140,
+    3, 0, 68, 204, 140, 3, 0, 100, 204, 140, 3, 0, 69, 204, 132, 3,
+    0, 101, 204, 132, 3, 0, 69, 204, 134, 3, 0, 101, 204, 134, 3, 0,
+    69, 204, 135, 3, 0, 101, 204, 135, 3, 0, 69, 204, 168, 3, 0, 101,
+    204, 168, 3, 0, 69, 204, 140, 3, 0, 101, 204, 140, 3, 0, 71, 204,
+    130, 3, 0, 103, 204, 130, 3, 0, 71, 204, 134, 3, 0, 103, 204, 134,
+    3, 0, 71, 204, 135, 3, 0, 103, 204, 135, 3, 0, 71, 204, 167, 3,
+    0, 103, 204, 167, 3, 0, 72, 204, 130, 3, 0, 104, 204, 130, 3, 0,
+    73, 204, 131, 3, 0, 105, 204, 131, 3, 0, 73, 204, 132, 3, 0, 105,
+    204, 132, 3, 0, 73, 204, 134, 3, 0, 105, 204, 134, 3, 0, 73, 204,
+    168, 3, 0, 105, 204, 168, 3, 0, 73, 204, 135, 0, 2, 73, 74, 0,
+    2, 105, 106, 3, 0, 74, 204, 130, 3, 0, 106, 204, 130, 3, 0, 75,
+    204, 167, 3, 0, 107, 204, 167, 3, 0, 76, 204, 129, 3, 0, 108, 204,
+    129, 3, 0, 76, 204, 167, 3, 0, 108, 204, 167, 3, 0, 76, 204, 140,
+    3, 0, 108, 204, 140, 0, 3, 76, 194, 183, 0, 3, 108, 194, 183, 3,
+    0, 78, 204, 129, 3, 0, 110, 204, 129, 3, 0, 78, 204, 167, 3, 0,
+    110, 204, 167, 3, 0, 78, 204, 140, 3, 0, 110, 204, 140, 0, 3, 202,
+    188, 110, 3, 0, 79, 204, 132, 3, 0, 111, 204, 132, 3, 0, 79, 204,
+    134, 3, 0, 111, 204, 134, 3, 0, 79, 204, 139, 3, 0, 111, 204, 139,
+    3, 0, 82, 204, 129, 3, 0, 114, 204, 129, 3, 0, 82, 204, 167, 3,
+    0, 114, 204, 167, 3, 0, 82, 204, 140, 3, 0, 114, 204, 140, 3, 0,
+    83, 204, 129, 3, 0, 115, 204, 129, 3, 0, 83, 204, 130, 3, 0, 115,
+    204, 130, 3, 0, 83, 204, 167, 3, 0, 115, 204, 167, 3, 0, 83, 204,
+    140, 3, 0, 115, 204, 140, 3, 0, 84, 204, 167, 3, 0, 116, 204, 167,
+    3, 0, 84, 204, 140, 3, 0, 116, 204, 140, 3, 0, 85, 204, 131, 3,
+    0, 117, 204, 131, 3, 0, 85, 204, 132, 3, 0, 117, 204, 132, 3, 0,
+    85, 204, 134, 3, 0, 117, 204, 134, 3, 0, 85, 204, 138, 3, 0, 117,
+    204, 138, 3, 0, 85, 204, 139, 3, 0, 117, 204, 139, 3, 0, 85, 204,
+    168, 3, 0, 117, 204, 168, 3, 0, 87, 204, 130, 3, 0, 119, 204, 130,
+    3, 0, 89, 204, 130, 3, 0, 121, 204, 130, 3, 0, 89, 204, 136, 3,
+    0, 90, 204, 129, 3, 0, 122, 204, 129, 3, 0, 90, 204, 135, 3, 0,
+    122, 204, 135, 3, 0, 90, 204, 140, 3, 0, 122, 204, 140, 0, 1, 115,
+    3, 0, 79, 204, 155, 3, 0, 111, 204, 155, 3, 0, 85, 204, 155, 3,
+    0, 117, 204, 155, 0, 4, 68, 90, 204, 140, 0, 4, 68, 122, 204, 140,
+    0, 4, 100, 122, 204, 140, 0, 2, 76, 74, 0, 2, 76, 106, 0, 2,
+    108, 106, 0, 2, 78, 74, 0, 2, 78, 106, 0, 2, 110, 106, 3, 0,
+    65, 204, 140, 3, 0, 97, 204, 140, 3, 0, 73, 204, 140, 3, 0, 105,
+    204, 140, 3, 0, 79, 204, 140, 3, 0, 111, 204, 140, 3, 0, 85, 204,
+    140, 3, 0, 117, 204, 140, 5, 0, 85, 204, 136, 204, 132, 5, 0, 117,
+    204, 136, 204, 132, 5, 0, 85, 204, 136, 204, 129, 5, 0, 117, 204, 136,
+    204, 129, 5, 0, 85, 204, 136, 204, 140, 5, 0, 117, 204, 136, 204, 140,
+    5, 0, 85, 204, 136, 204, 128, 5, 0, 117, 204, 136, 204, 128, 5, 0,
+    65, 204, 136, 204, 132, 5, 0, 97, 204, 136, 204, 132, 5, 0, 65, 204,
+    135, 204, 132, 5, 0, 97, 204, 135, 204, 132, 4, 0, 195, 134, 204, 132,
+    4, 0, 195, 166, 204, 132, 3, 0, 71, 204, 140, 3, 0, 103, 204, 140,
+    3, 0, 75, 204, 140, 3, 0, 107, 204, 140, 3, 0, 79, 204, 168, 3,
+    0, 111, 204, 168, 5, 0, 79, 204, 168, 204, 132, 5, 0, 111, 204, 168,
+    204, 132, 4, 0, 198, 183, 204, 140, 4, 0, 202, 146, 204, 140, 3, 0,
+    106, 204, 140, 0, 2, 68, 90, 0, 2, 68, 122, 0, 2, 100, 122, 3,
+    0, 71, 204, 129, 3, 0, 103, 204, 129, 3, 0, 78, 204, 128, 3, 0,
+    110, 204, 128, 5, 0, 65, 204, 138, 204, 129, 5, 0, 97, 204, 138, 204,
+    129, 4, 0, 195, 134, 204, 129, 4, 0, 195, 166, 204, 129, 4, 0, 195,
+    152, 204, 129, 4, 0, 195, 184, 204, 129, 3, 0, 65, 204, 143, 3, 0,
+    97, 204, 143, 3, 0, 65, 204, 145, 3, 0, 97, 204, 145, 3, 0, 69,
+    204, 143, 3, 0, 101, 204, 143, 3, 0, 69, 204, 145, 3, 0, 101, 204,
+    145, 3, 0, 73, 204, 143, 3, 0, 105, 204, 143, 3, 0, 73, 204, 145,
+    3, 0, 105, 204, 145, 3, 0, 79, 204, 143, 3, 0, 111, 204, 143, 3,
+    0, 79, 204, 145, 3, 0, 111, 204, 145, 3, 0, 82, 204, 143, 3, 0,
+    114, 204, 143, 3, 0, 82, 204, 145, 3, 0, 114, 204, 145, 3, 0, 85,
+    204, 143, 3, 0, 117, 204, 143, 3, 0, 85, 204, 145, 3, 0, 117, 204,
+    145, 3, 0, 83, 204, 166, 3, 0, 115, 204, 166, 3, 0, 84, 204, 166,
+    3, 0, 116, 204, 166, 3, 0, 72, 204, 140, 3, 0, 104, 204, 140, 3,
+    0, 65, 204, 135, 3, 0, 97, 204, 135, 3, 0, 69, 204, 167, 3, 0,
+    101, 204, 167, 5, 0, 79, 204, 136, 204, 132, 5, 0, 111, 204, 136, 204,
+    132, 5, 0, 79, 204, 131, 204, 132, 5, 0, 111, 204, 131, 204, 132, 3,
+    0, 79, 204, 135, 3, 0, 111, 204, 135, 5, 0, 79, 204, 135, 204, 132,
+    5, 0, 111, 204, 135, 204, 132, 3, 0, 89, 204, 132, 3, 0, 121, 204,
+    132, 0, 1, 104, 0, 2, 201, 166, 0, 1, 106, 0, 1, 114, 0, 2,
+    201, 185, 0, 2, 201, 187, 0, 2, 202, 129, 0, 1, 119, 0, 1, 121,
+    0, 3, 32, 204, 134, 0, 3, 32, 204, 135, 0, 3, 32, 204, 138, 0,
+    3, 32, 204, 168, 0, 3, 32, 204, 131, 0, 3, 32, 204, 139, 0, 2,
+    201, 163, 0, 1, 108, 0, 1, 120, 0, 2, 202, 149, 2, 0, 204, 128,
+    2, 0, 204, 129, 2, 0, 204, 147, 4, 0, 204, 136, 204, 129, 2, 0,
+    202, 185, 0, 3, 32, 205, 133, 1, 0, 59, 4, 5, 194, 168, 204, 129,
+    32, 204, 136, 204, 129, 4, 0, 206, 145, 204, 129, 2, 0, 194, 183, 4,
+    0, 206, 149, 204, 129, 4, 0, 206, 151, 204, 129, 4, 0, 206, 153, 204,
+    129, 4, 0, 206, 159, 204, 129, 4, 0, 206, 165, 204, 129, 4, 0, 206,
+    169, 204, 129, 6, 0, 206, 185, 204, 136, 204, 129, 4, 0, 206, 153, 204,
+    136, 4, 0, 206, 165, 204, 136, 4, 0, 206, 177, 204, 129, 4, 0, 206,
+    181, 204, 129, 4, 0, 206, 183, 204, 129, 4, 0, 206, 185, 204, 129, 6,
+    0, 207, 133, 204, 136, 204, 129, 4, 0, 206, 185, 204, 136, 4, 0, 207,
+    133, 204, 136, 4, 0, 206, 191, 204, 129, 4, 0, 207, 133, 204, 129, 4,
+    0, 207, 137, 204, 129, 0, 2, 206, 178, 0, 2, 206, 184, 0, 2, 206,
+    165, 4, 4, 207, 146, 204, 129, 206, 165, 204, 129, 4, 4, 207, 146, 204,
+    136, 206, 165, 204, 136, 0, 2, 207, 134, 0, 2, 207, 128, 0, 2, 206,
+    186, 0, 2, 207, 129, 0, 2, 207, 130, 0, 2, 206, 152, 0, 2, 206,
+    181, 0, 2, 206, 163, 4, 0, 208, 149, 204, 128, 4, 0, 208, 149, 204,
+    136, 4, 0, 208, 147, 204, 129, 4, 0, 208, 134, 204, 136, 4, 0, 208,
+    154, 204, 129, 4, 0, 208, 152, 204, 128, 4, 0, 208, 163, 204, 134, 4,
+    0, 208, 152, 204, 134, 4, 0, 208, 184, 204, 134, 4, 0, 208, 181, 204,
+    128, 4, 0, 208, 181, 204, 136, 4, 0, 208, 179, 204, 129, 4, 0, 209,
+    150, 204, 136, 4, 0, 208, 186, 204, 129, 4, 0, 208, 184, 204, 128, 4,
+    0, 209, 131, 204, 134, 4, 0, 209, 180, 204, 143, 4, 0, 209, 181, 204,
+    143, 4, 0, 208, 150, 204, 134, 4, 0, 208, 182, 204, 134, 4, 0, 208,
+    144, 204, 134, 4, 0, 208, 176, 204, 134, 4, 0, 208, 144, 204, 136, 4,
+    0, 208, 176, 204, 136, 4, 0, 208, 149, 204, 134, 4, 0, 208, 181, 204,
+    134, 4, 0, 211, 152, 204, 136, 4, 0, 211, 153, 204, 136, 4, 0, 208,
+    150, 204, 136, 4, 0, 208, 182, 204, 136, 4, 0, 208, 151, 204, 136, 4,
+    0, 208, 183, 204, 136, 4, 0, 208, 152, 204, 132, 4, 0, 208, 184, 204,
+    132, 4, 0, 208, 152, 204, 136, 4, 0, 208, 184, 204, 136, 4, 0, 208,
+    158, 204, 136, 4, 0, 208, 190, 204, 136, 4, 0, 211, 168, 204, 136, 4,
+    0, 211, 169, 204, 136, 4, 0, 208, 173, 204, 136, 4, 0, 209, 141, 204,
+    136, 4, 0, 208, 163, 204, 132, 4, 0, 209, 131, 204, 132, 4, 0, 208,
+    163, 204, 136, 4, 0, 209, 131, 204, 136, 4, 0, 208, 163, 204, 139, 4,
+    0, 209, 131, 204, 139, 4, 0, 208, 167, 204, 136, 4, 0, 209, 135, 204,
+    136, 4, 0, 208, 171, 204, 136, 4, 0, 209, 139, 204, 136, 0, 4, 213,
+    165, 214, 130, 4, 0, 216, 167, 217, 147, 4, 0, 216, 167, 217, 148, 4,
+    0, 217, 136, 217, 148, 4, 0, 216, 167, 217, 149, 4, 0, 217, 138, 217,
+    148, 0, 4, 216, 167, 217, 180, 0, 4, 217, 136, 217, 180, 0, 4, 219,
+    135, 217, 180, 0, 4, 217, 138, 217, 180, 4, 0, 219, 149, 217, 148, 4,
+    0, 219, 129, 217, 148, 4, 0, 219, 146, 217, 148, 6, 0, 224, 164, 168,
+    224, 164, 188, 6, 0, 224, 164, 176, 224, 164, 188, 6, 0, 224, 164, 179,
+    224, 164, 188, 6, 0, 224, 164, 149, 224, 164, 188, 6, 0, 224, 164, 150,
+    224, 164, 188, 6, 0, 224, 164, 151, 224, 164, 188, 6, 0, 224, 164, 156,
+    224, 164, 188, 6, 0, 224, 164, 161, 224, 164, 188, 6, 0, 224, 164, 162,
+    224, 164, 188, 6, 0, 224, 164, 171, 224, 164, 188, 6, 0, 224, 164, 175,
+    224, 164, 188, 6, 0, 224, 167, 135, 224, 166, 190, 6, 0, 224, 167, 135,
+    224, 167, 151, 6, 0, 224, 166, 161, 224, 166, 188, 6, 0, 224, 166, 162,
+    224, 166, 188, 6, 0, 224, 166, 175, 224, 166, 188, 6, 0, 224, 168, 178,
+    224, 168, 188, 6, 0, 224, 168, 184, 224, 168, 188, 6, 0, 224, 168, 150,
+    224, 168, 188, 6, 0, 224, 168, 151, 224, 168, 188, 6, 0, 224, 168, 156,
+    224, 168, 188, 6, 0, 224, 168, 171, 224, 168, 188, 6, 0, 224, 173, 135,
+    224, 173, 150, 6, 0, 224, 173, 135, 224, 172, 190, 6, 0, 224, 173, 135,
+    224, 173, 151, 6, 0, 224, 172, 161, 224, 172, 188, 6, 0, 224, 172, 162,
+    224, 172, 188, 6, 0, 224, 174, 146, 224, 175, 151, 6, 0, 224, 175, 134,
+    224, 174, 190, 6, 0, 224, 175, 135, 224, 174, 190, 6, 0, 224, 175, 134,
+    224, 175, 151, 6, 0, 224, 177, 134, 224, 177, 150, 6, 0, 224, 178, 191,
+    224, 179, 149, 6, 0, 224, 179, 134, 224, 179, 149, 6, 0, 224, 179, 134,
+    224, 179, 150, 6, 0, 224, 179, 134, 224, 179, 130, 9, 0, 224, 179, 134,
+    224, 179, 130, 224, 179, 149, 6, 0, 224, 181, 134, 224, 180, 190, 6, 0,
+    224, 181, 135, 224, 180, 190, 6, 0, 224, 181, 134, 224, 181, 151, 6, 0,
+    224, 183, 153, 224, 183, 138, 6, 0, 224, 183, 153, 224, 183, 143, 9, 0,
+    224, 183, 153, 224, 183, 143, 224, 183, 138, 6, 0, 224, 183, 153, 224, 183,
+    159, 0, 6, 224, 185, 141, 224, 184, 178, 0, 6, 224, 187, 141, 224, 186,
+    178, 0, 6, 224, 186, 171, 224, 186, 153, 0, 6, 224, 186, 171, 224, 186,
+    161, 0, 3, 224, 188, 139, 6, 0, 224, 189, 130, 224, 190, 183, 6, 0,
+    224, 189, 140, 224, 190, 183, 6, 0, 224, 189, 145, 224, 190, 183, 6, 0,
+    224, 189, 150, 224, 190, 183, 6, 0, 224, 189, 155, 224, 190, 183, 6, 0,
+    224, 189, 128, 224, 190, 181, 6, 0, 224, 189, 177, 224, 189, 178, 6, 0,
+    224, 189, 177, 224, 189, 180, 6, 0, 224, 190, 178, 224, 190, 128, 0, 9,
+    224, 190, 178, 224, 189, 177, 224, 190, 128, 6, 0, 224, 190, 179, 224, 190,
+    128, 0, 9, 224, 190, 179, 224, 189, 177, 224, 190, 128, 6, 0, 224, 189,
+    177, 224, 190, 128, 6, 0, 224, 190, 146, 224, 190, 183, 6, 0, 224, 190,
+    156, 224, 190, 183, 6, 0, 224, 190, 161, 224, 190, 183, 6, 0, 224, 190,
+    166, 224, 190, 183, 6, 0, 224, 190, 171, 224, 190, 183, 6, 0, 224, 190,
+    144, 224, 190, 181, 6, 0, 225, 128, 165, 225, 128, 174, 0, 3, 225, 131,
+    156, 6, 0, 225, 172, 133, 225, 172, 181, 6, 0, 225, 172, 135, 225, 172,
+    181, 6, 0, 225, 172, 137, 225, 172, 181, 6, 0, 225, 172, 139, 225, 172,
+    181, 6, 0, 225, 172, 141, 225, 172, 181, 6, 0, 225, 172, 145, 225, 172,
+    181, 6, 0, 225, 172, 186, 225, 172, 181, 6, 0, 225, 172, 188, 225, 172,
+    181, 6, 0, 225, 172, 190, 225, 172, 181, 6, 0, 225, 172, 191, 225, 172,
+    181, 6, 0, 225, 173, 130, 225, 172, 181, 0, 1, 65, 0, 2, 195, 134,
+    0, 1, 66, 0, 1, 68, 0, 1, 69, 0, 2, 198, 142, 0, 1, 71,
+    0, 1, 72, 0, 1, 73, 0, 1, 74, 0, 1, 75, 0, 1, 76, 0,
+    1, 77, 0, 1, 78, 0, 1, 79, 0, 2, 200, 162, 0, 1, 80, 0,
+    1, 82, 0, 1, 84, 0, 1, 85, 0, 1, 87, 0, 2, 201, 144, 0,
+    2, 201, 145, 0, 3, 225, 180, 130, 0, 1, 98, 0, 1, 100, 0, 1,
+    101, 0, 2, 201, 153, 0, 2, 201, 155, 0, 2, 201, 156, 0, 1, 103,
+    0, 1, 107, 0, 1, 109, 0, 2, 197, 139, 0, 2, 201, 148, 0, 3,
+    225, 180, 150, 0, 3, 225, 180, 151, 0, 1, 112, 0, 1, 116, 0, 1,
+    117, 0, 3, 225, 180, 157, 0, 2, 201, 175, 0, 1, 118, 0, 3, 225,
+    180, 165, 0, 2, 206, 179, 0, 2, 206, 180, 0, 2, 207, 135, 0, 1,
+    105, 0, 2, 208, 189, 0, 2, 201, 146, 0, 1, 99, 0, 2, 201, 149,
+    0, 2, 195, 176, 0, 1, 102, 0, 2, 201, 159, 0, 2, 201, 161, 0,
+    2, 201, 165, 0, 2, 201, 168, 0, 2, 201, 169, 0, 2, 201, 170, 0,
+    3, 225, 181, 187, 0, 2, 202, 157, 0, 2, 201, 173, 0, 3, 225, 182,
+    133, 0, 2, 202, 159, 0, 2, 201, 177, 0, 2, 201, 176, 0, 2, 201,
+    178, 0, 2, 201, 179, 0, 2, 201, 180, 0, 2, 201, 181, 0, 2, 201,
+    184, 0, 2, 202, 130, 0, 2, 202, 131, 0, 2, 198, 171, 0, 2, 202,
+    137, 0, 2, 202, 138, 0, 3, 225, 180, 156, 0, 2, 202, 139, 0, 2,
+    202, 140, 0, 1, 122, 0, 2, 202, 144, 0, 2, 202, 145, 0, 2, 202,
+    146, 3, 0, 65, 204, 165, 3, 0, 97, 204, 165, 3, 0, 66, 204, 135,
+    3, 0, 98, 204, 135, 3, 0, 66, 204, 163, 3, 0, 98, 204, 163, 3,
+    0, 66, 204, 177, 3, 0, 98, 204, 177, 5, 0, 67, 204, 167, 204, 129,
+    5, 0, 99, 204, 167, 204, 129, 3, 0, 68, 204, 135, 3, 0, 100, 204,
+    135, 3, 0, 68, 204, 163, 3, 0, 100, 204, 163, 3, 0, 68, 204, 177,
+    3, 0, 100, 204, 177, 3, 0, 68, 204, 167, 3, 0, 100, 204, 167, 3,
+    0, 68, 204, 173, 3, 0, 100, 204, 173, 5, 0, 69, 204, 132, 204, 128,
+    5, 0, 101, 204, 132, 204, 128, 5, 0, 69, 204, 132, 204, 129, 5, 0,
+    101, 204, 132, 204, 129, 3, 0, 69, 204, 173, 3, 0, 101, 204, 173, 3,
+    0, 69, 204, 176, 3, 0, 101, 204, 176, 5, 0, 69, 204, 167, 204, 134,
+    5, 0, 101, 204, 167, 204, 134, 3, 0, 70, 204, 135, 3, 0, 102, 204,
+    135, 3, 0, 71, 204, 132, 3, 0, 103, 204, 132, 3, 0, 72, 204, 135,
+    3, 0, 104, 204, 135, 3, 0, 72, 204, 163, 3, 0, 104, 204, 163, 3,
+    0, 72, 204, 136, 3, 0, 104, 204, 136, 3, 0, 72, 204, 167, 3, 0,
+    104, 204, 167, 3, 0, 72, 204, 174, 3, 0, 104, 204, 174, 3, 0, 73,
+    204, 176, 3, 0, 105, 204, 176, 5, 0, 73, 204, 136, 204, 129, 5, 0,
+    105, 204, 136, 204, 129, 3, 0, 75, 204, 129, 3, 0, 107, 204, 129, 3,
+    0, 75, 204, 163, 3, 0, 107, 204, 163, 3, 0, 75, 204, 177, 3, 0,
+    107, 204, 177, 3, 0, 76, 204, 163, 3, 0, 108, 204, 163, 5, 0, 76,
+    204, 163, 204, 132, 5, 0, 108, 204, 163, 204, 132, 3, 0, 76, 204, 177,
+    3, 0, 108, 204, 177, 3, 0, 76, 204, 173, 3, 0, 108, 204, 173, 3,
+    0, 77, 204, 129, 3, 0, 109, 204, 129, 3, 0, 77, 204, 135, 3, 0,
+    109, 204, 135, 3, 0, 77, 204, 163, 3, 0, 109, 204, 163, 3, 0, 78,
+    204, 135, 3, 0, 110, 204, 135, 3, 0, 78, 204, 163, 3, 0, 110, 204,
+    163, 3, 0, 78, 204, 177, 3, 0, 110, 204, 177, 3, 0, 78, 204, 173,
+    3, 0, 110, 204, 173, 5, 0, 79, 204, 131, 204, 129, 5, 0, 111, 204,
+    131, 204, 129, 5, 0, 79, 204, 131, 204, 136, 5, 0, 111, 204, 131, 204,
+    136, 5, 0, 79, 204, 132, 204, 128, 5, 0, 111, 204, 132, 204, 128, 5,
+    0, 79, 204, 132, 204, 129, 5, 0, 111, 204, 132, 204, 129, 3, 0, 80,
+    204, 129, 3, 0, 112, 204, 129, 3, 0, 80, 204, 135, 3, 0, 112, 204,
+    135, 3, 0, 82, 204, 135, 3, 0, 114, 204, 135, 3, 0, 82, 204, 163,
+    3, 0, 114, 204, 163, 5, 0, 82, 204, 163, 204, 132, 5, 0, 114, 204,
+    163, 204, 132, 3, 0, 82, 204, 177, 3, 0, 114, 204, 177, 3, 0, 83,
+    204, 135, 3, 0, 115, 204, 135, 3, 0, 83, 204, 163, 3, 0, 115, 204,
+    163, 5, 0, 83, 204, 129, 204, 135, 5, 0, 115, 204, 129, 204, 135, 5,
+    0, 83, 204, 140, 204, 135, 5, 0, 115, 204, 140, 204, 135, 5, 0, 83,
+    204, 163, 204, 135, 5, 0, 115, 204, 163, 204, 135, 3, 0, 84, 204, 135,
+    3, 0, 116, 204, 135, 3, 0, 84, 204, 163, 3, 0, 116, 204, 163, 3,
+    0, 84, 204, 177, 3, 0, 116, 204, 177, 3, 0, 84, 204, 173, 3, 0,
+    116, 204, 173, 3, 0, 85, 204, 164, 3, 0, 117, 204, 164, 3, 0, 85,
+    204, 176, 3, 0, 117, 204, 176, 3, 0, 85, 204, 173, 3, 0, 117, 204,
+    173, 5, 0, 85, 204, 131, 204, 129, 5, 0, 117, 204, 131, 204, 129, 5,
+    0, 85, 204, 132, 204, 136, 5, 0, 117, 204, 132, 204, 136, 3, 0, 86,
+    204, 131, 3, 0, 118, 204, 131, 3, 0, 86, 204, 163, 3, 0, 118, 204,
+    163, 3, 0, 87, 204, 128, 3, 0, 119, 204, 128, 3, 0, 87, 204, 129,
+    3, 0, 119, 204, 129, 3, 0, 87, 204, 136, 3, 0, 119, 204, 136, 3,
+    0, 87, 204, 135, 3, 0, 119, 204, 135, 3, 0, 87, 204, 163, 3, 0,
+    119, 204, 163, 3, 0, 88, 204, 135, 3, 0, 120, 204, 135, 3, 0, 88,
+    204, 136, 3, 0, 120, 204, 136, 3, 0, 89, 204, 135, 3, 0, 121, 204,
+    135, 3, 0, 90, 204, 130, 3, 0, 122, 204, 130, 3, 0, 90, 204, 163,
+    3, 0, 122, 204, 163, 3, 0, 90, 204, 177, 3, 0, 122, 204, 177, 3,
+    0, 104, 204, 177, 3, 0, 116, 204, 136, 3, 0, 119, 204, 138, 3, 0,
+    121, 204, 138, 0, 3, 97, 202, 190, 4, 3, 197, 191, 204, 135, 115, 204,
+    135, 3, 0, 65, 204, 163, 3, 0, 97, 204, 163, 3, 0, 65, 204, 137,
+    3, 0, 97, 204, 137, 5, 0, 65, 204, 130, 204, 129, 5, 0, 97, 204,
+    130, 204, 129, 5, 0, 65, 204, 130, 204, 128, 5, 0, 97, 204, 130, 204,
+    128, 5, 0, 65, 204, 130, 204, 137, 5, 0, 97, 204, 130, 204, 137, 5,
+    0, 65, 204, 130, 204, 131, 5, 0, 97, 204, 130, 204, 131, 5, 0, 65,
+    204, 163, 204, 130, 5, 0, 97, 204, 163, 204, 130, 5, 0, 65, 204, 134,
+    204, 129, 5, 0, 97, 204, 134, 204, 129, 5, 0, 65, 204, 134, 204, 128,
+    5, 0, 97, 204, 134, 204, 128, 5, 0, 65, 204, 134, 204, 137, 5, 0,
+    97, 204, 134, 204, 137, 5, 0, 65, 204, 134, 204, 131, 5, 0, 97, 204,
+    134, 204, 131, 5, 0, 65, 204, 163, 204, 134, 5, 0, 97, 204, 163, 204,
+    134, 3, 0, 69, 204, 163, 3, 0, 101, 204, 163, 3, 0, 69, 204, 137,
+    3, 0, 101, 204, 137, 3, 0, 69, 204, 131, 3, 0, 101, 204, 131, 5,
+    0, 69, 204, 130, 204, 129, 5, 0, 101, 204, 130, 204, 129, 5, 0, 69,
+    204, 130, 204, 128, 5, 0, 101, 204, 130, 204, 128, 5, 0, 69, 204, 130,
+    204, 137, 5, 0, 101, 204, 130, 204, 137, 5, 0, 69, 204, 130, 204, 131,
+    5, 0, 101, 204, 130, 204, 131, 5, 0, 69, 204, 163, 204, 130, 5, 0,
+    101, 204, 163, 204, 130, 3, 0, 73, 204, 137, 3, 0, 105, 204, 137, 3,
+    0, 73, 204, 163, 3, 0, 105, 204, 163, 3, 0, 79, 204, 163, 3, 0,
+    111, 204, 163, 3, 0, 79, 204, 137, 3, 0, 111, 204, 137, 5, 0, 79,
+    204, 130, 204, 129, 5, 0, 111, 204, 130, 204, 129, 5, 0, 79, 204, 130,
+    204, 128, 5, 0, 111, 204, 130, 204, 128, 5, 0, 79, 204, 130, 204, 137,
+    5, 0, 111, 204, 130, 204, 137, 5, 0, 79, 204, 130, 204, 131, 5, 0,
+    111, 204, 130, 204, 131, 5, 0, 79, 204, 163, 204, 130, 5, 0, 111, 204,
+    163, 204, 130, 5, 0, 79, 204, 155, 204, 129, 5, 0, 111, 204, 155, 204,
+    129, 5, 0, 79, 204, 155, 204, 128, 5, 0, 111, 204, 155, 204, 128, 5,
+    0, 79, 204, 155, 204, 137, 5, 0, 111, 204, 155, 204, 137, 5, 0, 79,
+    204, 155, 204, 131, 5, 0, 111, 204, 155, 204, 131, 5, 0, 79, 204, 155,
+    204, 163, 5, 0, 111, 204, 155, 204, 163, 3, 0, 85, 204, 163, 3, 0,
+    117, 204, 163, 3, 0, 85, 204, 137, 3, 0, 117, 204, 137, 5, 0, 85,
+    204, 155, 204, 129, 5, 0, 117, 204, 155, 204, 129, 5, 0, 85, 204, 155,
+    204, 128, 5, 0, 117, 204, 155, 204, 128, 5, 0, 85, 204, 155, 204, 137,
+    5, 0, 117, 204, 155, 204, 137, 5, 0, 85, 204, 155, 204, 131, 5, 0,
+    117, 204, 155, 204, 131, 5, 0, 85, 204, 155, 204, 163, 5, 0, 117, 204,
+    155, 204, 163, 3, 0, 89, 204, 128, 3, 0, 121, 204, 128, 3, 0, 89,
+    204, 163, 3, 0, 121, 204, 163, 3, 0, 89, 204, 137, 3, 0, 121, 204,
+    137, 3, 0, 89, 204, 131, 3, 0, 121, 204, 131, 4, 0, 206, 177, 204,
+    147, 4, 0, 206, 177, 204, 148, 6, 0, 206, 177, 204, 147, 204, 128, 6,
+    0, 206, 177, 204, 148, 204, 128, 6, 0, 206, 177, 204, 147, 204, 129, 6,
+    0, 206, 177, 204, 148, 204, 129, 6, 0, 206, 177, 204, 147, 205, 130, 6,
+    0, 206, 177, 204, 148, 205, 130, 4, 0, 206, 145, 204, 147, 4, 0, 206,
+    145, 204, 148, 6, 0, 206, 145, 204, 147, 204, 128, 6, 0, 206, 145, 204,
+    148, 204, 128, 6, 0, 206, 145, 204, 147, 204, 129, 6, 0, 206, 145, 204,
+    148, 204, 129, 6, 0, 206, 145, 204, 147, 205, 130, 6, 0, 206, 145, 204,
+    148, 205, 130, 4, 0, 206, 181, 204, 147, 4, 0, 206, 181, 204, 148, 6,
+    0, 206, 181, 204, 147, 204, 128, 6, 0, 206, 181, 204, 148, 204, 128, 6,
+    0, 206, 181, 204, 147, 204, 129, 6, 0, 206, 181, 204, 148, 204, 129, 4,
+    0, 206, 149, 204, 147, 4, 0, 206, 149, 204, 148, 6, 0, 206, 149, 204,
+    147, 204, 128, 6, 0, 206, 149, 204, 148, 204, 128, 6, 0, 206, 149, 204,
+    147, 204, 129, 6, 0, 206, 149, 204, 148, 204, 129, 4, 0, 206, 183, 204,
+    147, 4, 0, 206, 183, 204, 148, 6, 0, 206, 183, 204, 147, 204, 128, 6,
+    0, 206, 183, 204, 148, 204, 128, 6, 0, 206, 183, 204, 147, 204, 129, 6,
+    0, 206, 183, 204, 148, 204, 129, 6, 0, 206, 183, 204, 147, 205, 130, 6,
+    0, 206, 183, 204, 148, 205, 130, 4, 0, 206, 151, 204, 147, 4, 0, 206,
+    151, 204, 148, 6, 0, 206, 151, 204, 147, 204, 128, 6, 0, 206, 151, 204,
+    148, 204, 128, 6, 0, 206, 151, 204, 147, 204, 129, 6, 0, 206, 151, 204,
+    148, 204, 129, 6, 0, 206, 151, 204, 147, 205, 130, 6, 0, 206, 151, 204,
+    148, 205, 130, 4, 0, 206, 185, 204, 147, 4, 0, 206, 185, 204, 148, 6,
+    0, 206, 185, 204, 147, 204, 128, 6, 0, 206, 185, 204, 148, 204, 128, 6,
+    0, 206, 185, 204, 147, 204, 129, 6, 0, 206, 185, 204, 148, 204, 129, 6,
+    0, 206, 185, 204, 147, 205, 130, 6, 0, 206, 185, 204, 148, 205, 130, 4,
+    0, 206, 153, 204, 147, 4, 0, 206, 153, 204, 148, 6, 0, 206, 153, 204,
+    147, 204, 128, 6, 0, 206, 153, 204, 148, 204, 128, 6, 0, 206, 153, 204,
+    147, 204, 129, 6, 0, 206, 153, 204, 148, 204, 129, 6, 0, 206, 153, 204,
+    147, 205, 130, 6, 0, 206, 153, 204, 148, 205, 130, 4, 0, 206, 191, 204,
+    147, 4, 0, 206, 191, 204, 148, 6, 0, 206, 191, 204, 147, 204, 128, 6,
+    0, 206, 191, 204, 148, 204, 128, 6, 0, 206, 191, 204, 147, 204, 129, 6,
+    0, 206, 191, 204, 148, 204, 129, 4, 0, 206, 159, 204, 147, 4, 0, 206,
+    159, 204, 148, 6, 0, 206, 159, 204, 147, 204, 128, 6, 0, 206, 159, 204,
+    148, 204, 128, 6, 0, 206, 159, 204, 147, 204, 129, 6, 0, 206, 159, 204,
+    148, 204, 129, 4, 0, 207, 133, 204, 147, 4, 0, 207, 133, 204, 148, 6,
+    0, 207, 133, 204, 147, 204, 128, 6, 0, 207, 133, 204, 148, 204, 128, 6,
+    0, 207, 133, 204, 147, 204, 129, 6, 0, 207, 133, 204, 148, 204, 129, 6,
+    0, 207, 133, 204, 147, 205, 130, 6, 0, 207, 133, 204, 148, 205, 130, 4,
+    0, 206, 165, 204, 148, 6, 0, 206, 165, 204, 148, 204, 128, 6, 0, 206,
+    165, 204, 148, 204, 129, 6, 0, 206, 165, 204, 148, 205, 130, 4, 0, 207,
+    137, 204, 147, 4, 0, 207, 137, 204, 148, 6, 0, 207, 137, 204, 147, 204,
+    128, 6, 0, 207, 137, 204, 148, 204, 128, 6, 0, 207, 137, 204, 147, 204,
+    129, 6, 0, 207, 137, 204, 148, 204, 129, 6, 0, 207, 137, 204, 147, 205,
+    130, 6, 0, 207, 137, 204, 148, 205, 130, 4, 0, 206, 169, 204, 147, 4,
+    0, 206, 169, 204, 148, 6, 0, 206, 169, 204, 147, 204, 128, 6, 0, 206,
+    169, 204, 148, 204, 128, 6, 0, 206, 169, 204, 147, 204, 129, 6, 0, 206,
+    169, 204, 148, 204, 129, 6, 0, 206, 169, 204, 147, 205, 130, 6, 0, 206,
+    169, 204, 148, 205, 130, 4, 0, 206, 177, 204, 128, 4, 0, 206, 181, 204,
+    128, 4, 0, 206, 183, 204, 128, 4, 0, 206, 185, 204, 128, 4, 0, 206,
+    191, 204, 128, 4, 0, 207, 133, 204, 128, 4, 0, 207, 137, 204, 128, 6,
+    0, 206, 177, 204, 147, 205, 133, 6, 0, 206, 177, 204, 148, 205, 133, 8,
+    0, 206, 177, 204, 147, 204, 128, 205, 133, 8, 0, 206, 177, 204, 148, 204,
+    128, 205, 133, 8, 0, 206, 177, 204, 147, 204, 129, 205, 133, 8, 0, 206,
+    177, 204, 148, 204, 129, 205, 133, 8, 0, 206, 177, 204, 147, 205, 130, 205,
+    133, 8, 0, 206, 177, 204, 148, 205, 130, 205, 133, 6, 0, 206, 145, 204,
+    147, 205, 133, 6, 0, 206, 145, 204, 148, 205, 133, 8, 0, 206, 145, 204,
+    147, 204, 128, 205, 133, 8, 0, 206, 145, 204, 148, 204, 128, 205, 133, 8,
+    0, 206, 145, 204, 147, 204, 129, 205, 133, 8, 0, 206, 145, 204, 148, 204,
+    129, 205, 133, 8, 0, 206, 145, 204, 147, 205, 130, 205, 133, 8, 0, 206,
+    145, 204, 148, 205, 130, 205, 133, 6, 0, 206, 183, 204, 147, 205, 133, 6,
+    0, 206, 183, 204, 148, 205, 133, 8, 0, 206, 183, 204, 147, 204, 128, 205,
+    133, 8, 0, 206, 183, 204, 148, 204, 128, 205, 133, 8, 0, 206, 183, 204,
+    147, 204, 129, 205, 133, 8, 0, 206, 183, 204, 148, 204, 129, 205, 133, 8,
+    0, 206, 183, 204, 147, 205, 130, 205, 133, 8, 0, 206, 183, 204, 148, 205,
+    130, 205, 133, 6, 0, 206, 151, 204, 147, 205, 133, 6, 0, 206, 151, 204,
+    148, 205, 133, 8, 0, 206, 151, 204, 147, 204, 128, 205, 133, 8, 0, 206,
+    151, 204, 148, 204, 128, 205, 133, 8, 0, 206, 151, 204, 147, 204, 129, 205,
+    133, 8, 0, 206, 151, 204, 148, 204, 129, 205, 133, 8, 0, 206, 151, 204,
+    147, 205, 130, 205, 133, 8, 0, 206, 151, 204, 148, 205, 130, 205, 133, 6,
+    0, 207, 137, 204, 147, 205, 133, 6, 0, 207, 137, 204, 148, 205, 133, 8,
+    0, 207, 137, 204, 147, 204, 128, 205, 133, 8, 0, 207, 137, 204, 148, 204,
+    128, 205, 133, 8, 0, 207, 137, 204, 147, 204, 129, 205, 133, 8, 0, 207,
+    137, 204, 148, 204, 129, 205, 133, 8, 0, 207, 137, 204, 147, 205, 130, 205,
+    133, 8, 0, 207, 137, 204, 148, 205, 130, 205, 133, 6, 0, 206, 169, 204,
+    147, 205, 133, 6, 0, 206, 169, 204, 148, 205, 133, 8, 0, 206, 169, 204,
+    147, 204, 128, 205, 133, 8, 0, 206, 169, 204, 148, 204, 128, 205, 133, 8,
+    0, 206, 169, 204, 147, 204, 129, 205, 133, 8, 0, 206, 169, 204, 148, 204,
+    129, 205, 133, 8, 0, 206, 169, 204, 147, 205, 130, 205, 133, 8, 0, 206,
+    169, 204, 148, 205, 130, 205, 133, 4, 0, 206, 177, 204, 134, 4, 0, 206,
+    177, 204, 132, 6, 0, 206, 177, 204, 128, 205, 133, 4, 0, 206, 177, 205,
+    133, 6, 0, 206, 177, 204, 129, 205, 133, 4, 0, 206, 177, 205, 130, 6,
+    0, 206, 177, 205, 130, 205, 133, 4, 0, 206, 145, 204, 134, 4, 0, 206,
+    145, 204, 132, 4, 0, 206, 145, 204, 128, 4, 0, 206, 145, 205, 133, 0,
+    3, 32, 204, 147, 2, 0, 206, 185, 0, 3, 32, 205, 130, 4, 5, 194,
+    168, 205, 130, 32, 204, 136, 205, 130, 6, 0, 206, 183, 204, 128, 205, 133,
+    4, 0, 206, 183, 205, 133, 6, 0, 206, 183, 204, 129, 205, 133, 4, 0,
+    206, 183, 205, 130, 6, 0, 206, 183, 205, 130, 205, 133, 4, 0, 206, 149,
+    204, 128, 4, 0, 206, 151, 204, 128, 4, 0, 206, 151, 205, 133, 5, 5,
+    225, 190, 191, 204, 128, 32, 204, 147, 204, 128, 5, 5, 225, 190, 191, 204,
+    129, 32, 204, 147, 204, 129, 5, 5, 225, 190, 191, 205, 130, 32, 204, 147,
+    205, 130, 4, 0, 206, 185, 204, 134, 4, 0, 206, 185, 204, 132, 6, 0,
+    206, 185, 204, 136, 204, 128, 4, 0, 206, 185, 205, 130, 6, 0, 206, 185,
+    204, 136, 205, 130, 4, 0, 206, 153, 204, 134, 4, 0, 206, 153, 204, 132,
+    4, 0, 206, 153, 204, 128, 5, 5, 225, 191, 190, 204, 128, 32, 204, 148,
+    204, 128, 5, 5, 225, 191, 190, 204, 129, 32, 204, 148, 204, 129, 5, 5,
+    225, 191, 190, 205, 130, 32, 204, 148, 205, 130, 4, 0, 207, 133, 204, 134,
+    4, 0, 207, 133, 204, 132, 6, 0, 207, 133, 204, 136, 204, 128, 4, 0,
+    207, 129, 204, 147, 4, 0, 207, 129, 204, 148, 4, 0, 207, 133, 205, 130,
+    6, 0, 207, 133, 204, 136, 205, 130, 4, 0, 206, 165, 204, 134, 4, 0,
+    206, 165, 204, 132, 4, 0, 206, 165, 204, 128, 4, 0, 206, 161, 204, 148,
+    4, 5, 194, 168, 204, 128, 32, 204, 136, 204, 128, 1, 0, 96, 6, 0,
+    207, 137, 204, 128, 205, 133, 4, 0, 207, 137, 205, 133, 6, 0, 207, 137,
+    204, 129, 205, 133, 4, 0, 207, 137, 205, 130, 6, 0, 207, 137, 205, 130,
+    205, 133, 4, 0, 206, 159, 204, 128, 4, 0, 206, 169, 204, 128, 4, 0,
+    206, 169, 205, 133, 2, 3, 194, 180, 32, 204, 129, 0, 3, 32, 204, 148,
+    3, 1, 226, 128, 130, 32, 3, 1, 226, 128, 131, 32, 0, 3, 226, 128,
+    144, 0, 3, 32, 204, 179, 0, 1, 46, 0, 2, 46, 46, 0, 3, 46,
+    46, 46, 0, 6, 226, 128, 178, 226, 128, 178, 0, 9, 226, 128, 178, 226,
+    128, 178, 226, 128, 178, 0, 6, 226, 128, 181, 226, 128, 181, 0, 9, 226,
+    128, 181, 226, 128, 181, 226, 128, 181, 0, 2, 33, 33, 0, 3, 32, 204,
+    133, 0, 2, 63, 63, 0, 2, 63, 33, 0, 2, 33, 63, 0, 12, 226,
+    128, 178, 226, 128, 178, 226, 128, 178, 226, 128, 178, 0, 1, 48, 0, 1,
+    52, 0, 1, 53, 0, 1, 54, 0, 1, 55, 0, 1, 56, 0, 1, 57,
+    0, 1, 43, 0, 3, 226, 136, 146, 0, 1, 61, 0, 1, 40, 0, 1,
+    41, 0, 1, 110, 0, 2, 82, 115, 0, 3, 97, 47, 99, 0, 3, 97,
+    47, 115, 0, 1, 67, 0, 3, 194, 176, 67, 0, 3, 99, 47, 111, 0,
+    3, 99, 47, 117, 0, 2, 198, 144, 0, 3, 194, 176, 70, 0, 2, 196,
+    167, 0, 2, 78, 111, 0, 1, 81, 0, 2, 83, 77, 0, 3, 84, 69,
+    76, 0, 2, 84, 77, 0, 1, 90, 2, 0, 206, 169, 1, 0, 75, 0,
+    1, 70, 0, 2, 215, 144, 0, 2, 215, 145, 0, 2, 215, 146, 0, 2,
+    215, 147, 0, 3, 70, 65, 88, 0, 2, 206, 147, 0, 2, 206, 160, 0,
+    3, 226, 136, 145, 0, 5, 49, 226, 129, 132, 55, 0, 5, 49, 226, 129,
+    132, 57, 0, 6, 49, 226, 129, 132, 49, 48, 0, 5, 49, 226, 129, 132,
+    51, 0, 5, 50, 226, 129, 132, 51, 0, 5, 49, 226, 129, 132, 53, 0,
+    5, 50, 226, 129, 132, 53, 0, 5, 51, 226, 129, 132, 53, 0, 5, 52,
+    226, 129, 132, 53, 0, 5, 49, 226, 129, 132, 54, 0, 5, 53, 226, 129,
+    132, 54, 0, 5, 49, 226, 129, 132, 56, 0, 5, 51, 226, 129, 132, 56,
+    0, 5, 53, 226, 129, 132, 56, 0, 5, 55, 226, 129, 132, 56, 0, 4,
+    49, 226, 129, 132, 0, 2, 73, 73, 0, 3, 73, 73, 73, 0, 2, 73,
+    86, 0, 1, 86, 0, 2, 86, 73, 0, 3, 86, 73, 73, 0, 4, 86,
+    73, 73, 73, 0, 2, 73, 88, 0, 1, 88, 0, 2, 88, 73, 0, 3,
+    88, 73, 73, 0, 2, 105, 105, 0, 3, 105, 105, 105, 0, 2, 105, 118,
+    0, 2, 118, 105, 0, 3, 118, 105, 105, 0, 4, 118, 105, 105, 105, 0,
+    2, 105, 120, 0, 2, 120, 105, 0, 3, 120, 105, 105, 0, 5, 48, 226,
+    129, 132, 51, 5, 0, 226, 134, 144, 204, 184, 5, 0, 226, 134, 146, 204,
+    184, 5, 0, 226, 134, 148, 204, 184, 5, 0, 226, 135, 144, 204, 184, 5,
+    0, 226, 135, 148, 204, 184, 5, 0, 226, 135, 146, 204, 184, 5, 0, 226,
+    136, 131, 204, 184, 5, 0, 226, 136, 136, 204, 184, 5, 0, 226, 136, 139,
+    204, 184, 5, 0, 226, 136, 163, 204, 184, 5, 0, 226, 136, 165, 204, 184,
+    0, 6, 226, 136, 171, 226, 136, 171, 0, 9, 226, 136, 171, 226, 136, 171,
+    226, 136, 171, 0, 6, 226, 136, 174, 226, 136, 174, 0, 9, 226, 136, 174,
+    226, 136, 174, 226, 136, 174, 5, 0, 226, 136, 188, 204, 184, 5, 0, 226,
+    137, 131, 204, 184, 5, 0, 226, 137, 133, 204, 184, 5, 0, 226, 137, 136,
+    204, 184, 3, 0, 61, 204, 184, 5, 0, 226, 137, 161, 204, 184, 5, 0,
+    226, 137, 141, 204, 184, 3, 0, 60, 204, 184, 3, 0, 62, 204, 184, 5,
+    0, 226, 137, 164, 204, 184, 5, 0, 226, 137, 165, 204, 184, 5, 0, 226,
+    137, 178, 204, 184, 5, 0, 226, 137, 179, 204, 184, 5, 0, 226, 137, 182,
+    204, 184, 5, 0, 226, 137, 183, 204, 184, 5, 0, 226, 137, 186, 204, 184,
+    5, 0, 226, 137, 187, 204, 184, 5, 0, 226, 138, 130, 204, 184, 5, 0,
+    226, 138, 131, 204, 184, 5, 0, 226, 138, 134, 204, 184, 5, 0, 226, 138,
+    135, 204, 184, 5, 0, 226, 138, 162, 204, 184, 5, 0, 226, 138, 168, 204,
+    184, 5, 0, 226, 138, 169, 204, 184, 5, 0, 226, 138, 171, 204, 184, 5,
+    0, 226, 137, 188, 204, 184, 5, 0, 226, 137, 189, 204, 184, 5, 0, 226,
+    138, 145, 204, 184, 5, 0, 226, 138, 146, 204, 184, 5, 0, 226, 138, 178,
+    204, 184, 5, 0, 226, 138, 179, 204, 184, 5, 0, 226, 138, 180, 204, 184,
+    5, 0, 226, 138, 181, 204, 184, 3, 0, 227, 128, 136, 3, 0, 227, 128,
+    137, 0, 2, 49, 48, 0, 2, 49, 49, 0, 2, 49, 50, 0, 2, 49,
+    51, 0, 2, 49, 52, 0, 2, 49, 53, 0, 2, 49, 54, 0, 2, 49,
+    55, 0, 2, 49, 56, 0, 2, 49, 57, 0, 2, 50, 48, 0, 3, 40,
+    49, 41, 0, 3, 40, 50, 41, 0, 3, 40, 51, 41, 0, 3, 40, 52,
+    41, 0, 3, 40, 53, 41, 0, 3, 40, 54, 41, 0, 3, 40, 55, 41,
+    0, 3, 40, 56, 41, 0, 3, 40, 57, 41, 0, 4, 40, 49, 48, 41,
+    0, 4, 40, 49, 49, 41, 0, 4, 40, 49, 50, 41, 0, 4, 40, 49,
+    51, 41, 0, 4, 40, 49, 52, 41, 0, 4, 40, 49, 53, 41, 0, 4,
+    40, 49, 54, 41, 0, 4, 40, 49, 55, 41, 0, 4, 40, 49, 56, 41,
+    0, 4, 40, 49, 57, 41, 0, 4, 40, 50, 48, 41, 0, 2, 49, 46,
+    0, 2, 50, 46, 0, 2, 51, 46, 0, 2, 52, 46, 0, 2, 53, 46,
+    0, 2, 54, 46, 0, 2, 55, 46, 0, 2, 56, 46, 0, 2, 57, 46,
+    0, 3, 49, 48, 46, 0, 3, 49, 49, 46, 0, 3, 49, 50, 46, 0,
+    3, 49, 51, 46, 0, 3, 49, 52, 46, 0, 3, 49, 53, 46, 0, 3,
+    49, 54, 46, 0, 3, 49, 55, 46, 0, 3, 49, 56, 46, 0, 3, 49,
+    57, 46, 0, 3, 50, 48, 46, 0, 3, 40, 97, 41, 0, 3, 40, 98,
+    41, 0, 3, 40, 99, 41, 0, 3, 40, 100, 41, 0, 3, 40, 101, 41,
+    0, 3, 40, 102, 41, 0, 3, 40, 103, 41, 0, 3, 40, 104, 41, 0,
+    3, 40, 105, 41, 0, 3, 40, 106, 41, 0, 3, 40, 107, 41, 0, 3,
+    40, 108, 41, 0, 3, 40, 109, 41, 0, 3, 40, 110, 41, 0, 3, 40,
+    111, 41, 0, 3, 40, 112, 41, 0, 3, 40, 113, 41, 0, 3, 40, 114,
+    41, 0, 3, 40, 115, 41, 0, 3, 40, 116, 41, 0, 3, 40, 117, 41,
+    0, 3, 40, 118, 41, 0, 3, 40, 119, 41, 0, 3, 40, 120, 41, 0,
+    3, 40, 121, 41, 0, 3, 40, 122, 41, 0, 1, 83, 0, 1, 89, 0,
+    1, 113, 0, 12, 226, 136, 171, 226, 136, 171, 226, 136, 171, 226, 136, 171,
+    0, 3, 58, 58, 61, 0, 2, 61, 61, 0, 3, 61, 61, 61, 5, 0,
+    226, 171, 157, 204, 184, 0, 3, 226, 181, 161, 0, 3, 230, 175, 141, 0,
+    3, 233, 190, 159, 0, 3, 228, 184, 128, 0, 3, 228, 184, 168, 0, 3,
+    228, 184, 182, 0, 3, 228, 184, 191, 0, 3, 228, 185, 153, 0, 3, 228,
+    186, 133, 0, 3, 228, 186, 140, 0, 3, 228, 186, 160, 0, 3, 228, 186,
+    186, 0, 3, 229, 132, 191, 0, 3, 229, 133, 165, 0, 3, 229, 133, 171,
+    0, 3, 229, 134, 130, 0, 3, 229, 134, 150, 0, 3, 229, 134, 171, 0,
+    3, 229, 135, 160, 0, 3, 229, 135, 181, 0, 3, 229, 136, 128, 0, 3,
+    229, 138, 155, 0, 3, 229, 139, 185, 0, 3, 229, 140, 149, 0, 3, 229,
+    140, 154, 0, 3, 229, 140, 184, 0, 3, 229, 141, 129, 0, 3, 229, 141,
+    156, 0, 3, 229, 141, 169, 0, 3, 229, 142, 130, 0, 3, 229, 142, 182,
+    0, 3, 229, 143, 136, 0, 3, 229, 143, 163, 0, 3, 229, 155, 151, 0,
+    3, 229, 156, 159, 0, 3, 229, 163, 171, 0, 3, 229, 164, 130, 0, 3,
+    229, 164, 138, 0, 3, 229, 164, 149, 0, 3, 229, 164, 167, 0, 3, 229,
+    165, 179, 0, 3, 229, 173, 144, 0, 3, 229, 174, 128, 0, 3, 229, 175,
+    184, 0, 3, 229, 176, 143, 0, 3, 229, 176, 162, 0, 3, 229, 176, 184,
+    0, 3, 229, 177, 174, 0, 3, 229, 177, 177, 0, 3, 229, 183, 155, 0,
+    3, 229, 183, 165, 0, 3, 229, 183, 177, 0, 3, 229, 183, 190, 0, 3,
+    229, 185, 178, 0, 3, 229, 185, 186, 0, 3, 229, 185, 191, 0, 3, 229,
+    187, 180, 0, 3, 229, 187, 190, 0, 3, 229, 188, 139, 0, 3, 229, 188,
+    147, 0, 3, 229, 189, 144, 0, 3, 229, 189, 161, 0, 3, 229, 189, 179,
+    0, 3, 229, 191, 131, 0, 3, 230, 136, 136, 0, 3, 230, 136, 182, 0,
+    3, 230, 137, 139, 0, 3, 230, 148, 175, 0, 3, 230, 148, 180, 0, 3,
+    230, 150, 135, 0, 3, 230, 150, 151, 0, 3, 230, 150, 164, 0, 3, 230,
+    150, 185, 0, 3, 230, 151, 160, 0, 3, 230, 151, 165, 0, 3, 230, 155,
+    176, 0, 3, 230, 156, 136, 0, 3, 230, 156, 168, 0, 3, 230, 172, 160,
+    0, 3, 230, 173, 162, 0, 3, 230, 173, 185, 0, 3, 230, 174, 179, 0,
+    3, 230, 175, 139, 0, 3, 230, 175, 148, 0, 3, 230, 175, 155, 0, 3,
+    230, 176, 143, 0, 3, 230, 176, 148, 0, 3, 230, 176, 180, 0, 3, 231,
+    129, 171, 0, 3, 231, 136, 170, 0, 3, 231, 136, 182, 0, 3, 231, 136,
+    187, 0, 3, 231, 136, 191, 0, 3, 231, 137, 135, 0, 3, 231, 137, 153,
+    0, 3, 231, 137, 155, 0, 3, 231, 138, 172, 0, 3, 231, 142, 132, 0,
+    3, 231, 142, 137, 0, 3, 231, 147, 156, 0, 3, 231, 147, 166, 0, 3,
+    231, 148, 152, 0, 3, 231, 148, 159, 0, 3, 231, 148, 168, 0, 3, 231,
+    148, 176, 0, 3, 231, 150, 139, 0, 3, 231, 150, 146, 0, 3, 231, 153,
+    182, 0, 3, 231, 153, 189, 0, 3, 231, 154, 174, 0, 3, 231, 154, 191,
+    0, 3, 231, 155, 174, 0, 3, 231, 159, 155, 0, 3, 231, 159, 162, 0,
+    3, 231, 159, 179, 0, 3, 231, 164, 186, 0, 3, 231, 166, 184, 0, 3,
+    231, 166, 190, 0, 3, 231, 169, 180, 0, 3, 231, 171, 139, 0, 3, 231,
+    171, 185, 0, 3, 231, 177, 179, 0, 3, 231, 179, 184, 0, 3, 231, 188,
+    182, 0, 3, 231, 189, 145, 0, 3, 231, 190, 138, 0, 3, 231, 190, 189,
+    0, 3, 232, 128, 129, 0, 3, 232, 128, 140, 0, 3, 232, 128, 146, 0,
+    3, 232, 128, 179, 0, 3, 232, 129, 191, 0, 3, 232, 130, 137, 0, 3,
+    232, 135, 163, 0, 3, 232, 135, 170, 0, 3, 232, 135, 179, 0, 3, 232,
+    135, 188, 0, 3, 232, 136, 140, 0, 3, 232, 136, 155, 0, 3, 232, 136,
+    159, 0, 3, 232, 137, 174, 0, 3, 232, 137, 178, 0, 3, 232, 137, 184,
+    0, 3, 232, 153, 141, 0, 3, 232, 153, 171, 0, 3, 232, 161, 128, 0,
+    3, 232, 161, 140, 0, 3, 232, 161, 163, 0, 3, 232, 165, 190, 0, 3,
+    232, 166, 139, 0, 3, 232, 167, 146, 0, 3, 232, 168, 128, 0, 3, 232,
+    176, 183, 0, 3, 232, 177, 134, 0, 3, 232, 177, 149, 0, 3, 232, 177,
+    184, 0, 3, 232, 178, 157, 0, 3, 232, 181, 164, 0, 3, 232, 181, 176,
+    0, 3, 232, 182, 179, 0, 3, 232, 186, 171, 0, 3, 232, 187, 138, 0,
+    3, 232, 190, 155, 0, 3, 232, 190, 176, 0, 3, 232, 190, 181, 0, 3,
+    233, 130, 145, 0, 3, 233, 133, 137, 0, 3, 233, 135, 134, 0, 3, 233,
+    135, 140, 0, 3, 233, 135, 145, 0, 3, 233, 149, 183, 0, 3, 233, 150,
+    128, 0, 3, 233, 152, 156, 0, 3, 233, 154, 182, 0, 3, 233, 154, 185,
+    0, 3, 233, 155, 168, 0, 3, 233, 157, 145, 0, 3, 233, 157, 158, 0,
+    3, 233, 157, 162, 0, 3, 233, 157, 169, 0, 3, 233, 159, 139, 0, 3,
+    233, 159, 173, 0, 3, 233, 159, 179, 0, 3, 233, 160, 129, 0, 3, 233,
+    162, 168, 0, 3, 233, 163, 155, 0, 3, 233, 163, 159, 0, 3, 233, 166,
+    150, 0, 3, 233, 166, 153, 0, 3, 233, 166, 172, 0, 3, 233, 170, 168,
+    0, 3, 233, 171, 152, 0, 3, 233, 171, 159, 0, 3, 233, 172, 165, 0,
+    3, 233, 172, 175, 0, 3, 233, 172, 178, 0, 3, 233, 172, 188, 0, 3,
+    233, 173, 154, 0, 3, 233, 179, 165, 0, 3, 233, 185, 181, 0, 3, 233,
+    185, 191, 0, 3, 233, 186, 165, 0, 3, 233, 186, 187, 0, 3, 233, 187,
+    131, 0, 3, 233, 187, 141, 0, 3, 233, 187, 145, 0, 3, 233, 187, 185,
+    0, 3, 233, 187, 189, 0, 3, 233, 188, 142, 0, 3, 233, 188, 147, 0,
+    3, 233, 188, 160, 0, 3, 233, 188, 187, 0, 3, 233, 189, 138, 0, 3,
+    233, 189, 146, 0, 3, 233, 190, 141, 0, 3, 233, 190, 156, 0, 3, 233,
+    190, 160, 0, 3, 227, 128, 146, 0, 3, 229, 141, 132, 0, 3, 229, 141,
+    133, 6, 0, 227, 129, 139, 227, 130, 153, 6, 0, 227, 129, 141, 227, 130,
+    153, 6, 0, 227, 129, 143, 227, 130, 153, 6, 0, 227, 129, 145, 227, 130,
+    153, 6, 0, 227, 129, 147, 227, 130, 153, 6, 0, 227, 129, 149, 227, 130,
+    153, 6, 0, 227, 129, 151, 227, 130, 153, 6, 0, 227, 129, 153, 227, 130,
+    153, 6, 0, 227, 129, 155, 227, 130, 153, 6, 0, 227, 129, 157, 227, 130,
+    153, 6, 0, 227, 129, 159, 227, 130, 153, 6, 0, 227, 129, 161, 227, 130,
+    153, 6, 0, 227, 129, 164, 227, 130, 153, 6, 0, 227, 129, 166, 227, 130,
+    153, 6, 0, 227, 129, 168, 227, 130, 153, 6, 0, 227, 129, 175, 227, 130,
+    153, 6, 0, 227, 129, 175, 227, 130, 154, 6, 0, 227, 129, 178, 227, 130,
+    153, 6, 0, 227, 129, 178, 227, 130, 154, 6, 0, 227, 129, 181, 227, 130,
+    153, 6, 0, 227, 129, 181, 227, 130, 154, 6, 0, 227, 129, 184, 227, 130,
+    153, 6, 0, 227, 129, 184, 227, 130, 154, 6, 0, 227, 129, 187, 227, 130,
+    153, 6, 0, 227, 129, 187, 227, 130, 154, 6, 0, 227, 129, 134, 227, 130,
+    153, 0, 4, 32, 227, 130, 153, 0, 4, 32, 227, 130, 154, 6, 0, 227,
+    130, 157, 227, 130, 153, 0, 6, 227, 130, 136, 227, 130, 138, 6, 0, 227,
+    130, 171, 227, 130, 153, 6, 0, 227, 130, 173, 227, 130, 153, 6, 0, 227,
+    130, 175, 227, 130, 153, 6, 0, 227, 130, 177, 227, 130, 153, 6, 0, 227,
+    130, 179, 227, 130, 153, 6, 0, 227, 130, 181, 227, 130, 153, 6, 0, 227,
+    130, 183, 227, 130, 153, 6, 0, 227, 130, 185, 227, 130, 153, 6, 0, 227,
+    130, 187, 227, 130, 153, 6, 0, 227, 130, 189, 227, 130, 153, 6, 0, 227,
+    130, 191, 227, 130, 153, 6, 0, 227, 131, 129, 227, 130, 153, 6, 0, 227,
+    131, 132, 227, 130, 153, 6, 0, 227, 131, 134, 227, 130, 153, 6, 0, 227,
+    131, 136, 227, 130, 153, 6, 0, 227, 131, 143, 227, 130, 153, 6, 0, 227,
+    131, 143, 227, 130, 154, 6, 0, 227, 131, 146, 227, 130, 153, 6, 0, 227,
+    131, 146, 227, 130, 154, 6, 0, 227, 131, 149, 227, 130, 153, 6, 0, 227,
+    131, 149, 227, 130, 154, 6, 0, 227, 131, 152, 227, 130, 153, 6, 0, 227,
+    131, 152, 227, 130, 154, 6, 0, 227, 131, 155, 227, 130, 153, 6, 0, 227,
+    131, 155, 227, 130, 154, 6, 0, 227, 130, 166, 227, 130, 153, 6, 0, 227,
+    131, 175, 227, 130, 153, 6, 0, 227, 131, 176, 227, 130, 153, 6, 0, 227,
+    131, 177, 227, 130, 153, 6, 0, 227, 131, 178, 227, 130, 153, 6, 0, 227,
+    131, 189, 227, 130, 153, 0, 6, 227, 130, 179, 227, 131, 136, 0, 3, 225,
+    132, 128, 0, 3, 225, 132, 129, 0, 3, 225, 134, 170, 0, 3, 225, 132,
+    130, 0, 3, 225, 134, 172, 0, 3, 225, 134, 173, 0, 3, 225, 132, 131,
+    0, 3, 225, 132, 132, 0, 3, 225, 132, 133, 0, 3, 225, 134, 176, 0,
+    3, 225, 134, 177, 0, 3, 225, 134, 178, 0, 3, 225, 134, 179, 0, 3,
+    225, 134, 180, 0, 3, 225, 134, 181, 0, 3, 225, 132, 154, 0, 3, 225,
+    132, 134, 0, 3, 225, 132, 135, 0, 3, 225, 132, 136, 0, 3, 225, 132,
+    161, 0, 3, 225, 132, 137, 0, 3, 225, 132, 138, 0, 3, 225, 132, 139,
+    0, 3, 225, 132, 140, 0, 3, 225, 132, 141, 0, 3, 225, 132, 142, 0,
+    3, 225, 132, 143, 0, 3, 225, 132, 144, 0, 3, 225, 132, 145, 0, 3,
+    225, 132, 146, 0, 3, 225, 133, 161, 0, 3, 225, 133, 162, 0, 3, 225,
+    133, 163, 0, 3, 225, 133, 164, 0, 3, 225, 133, 165, 0, 3, 225, 133,
+    166, 0, 3, 225, 133, 167, 0, 3, 225, 133, 168, 0, 3, 225, 133, 169,
+    0, 3, 225, 133, 170, 0, 3, 225, 133, 171, 0, 3, 225, 133, 172, 0,
+    3, 225, 133, 173, 0, 3, 225, 133, 174, 0, 3, 225, 133, 175, 0, 3,
+    225, 133, 176, 0, 3, 225, 133, 177, 0, 3, 225, 133, 178, 0, 3, 225,
+    133, 179, 0, 3, 225, 133, 180, 0, 3, 225, 133, 181, 0, 3, 225, 133,
+    160, 0, 3, 225, 132, 148, 0, 3, 225, 132, 149, 0, 3, 225, 135, 135,
+    0, 3, 225, 135, 136, 0, 3, 225, 135, 140, 0, 3, 225, 135, 142, 0,
+    3, 225, 135, 147, 0, 3, 225, 135, 151, 0, 3, 225, 135, 153, 0, 3,
+    225, 132, 156, 0, 3, 225, 135, 157, 0, 3, 225, 135, 159, 0, 3, 225,
+    132, 157, 0, 3, 225, 132, 158, 0, 3, 225, 132, 160, 0, 3, 225, 132,
+    162, 0, 3, 225, 132, 163, 0, 3, 225, 132, 167, 0, 3, 225, 132, 169,
+    0, 3, 225, 132, 171, 0, 3, 225, 132, 172, 0, 3, 225, 132, 173, 0,
+    3, 225, 132, 174, 0, 3, 225, 132, 175, 0, 3, 225, 132, 178, 0, 3,
+    225, 132, 182, 0, 3, 225, 133, 128, 0, 3, 225, 133, 135, 0, 3, 225,
+    133, 140, 0, 3, 225, 135, 177, 0, 3, 225, 135, 178, 0, 3, 225, 133,
+    151, 0, 3, 225, 133, 152, 0, 3, 225, 133, 153, 0, 3, 225, 134, 132,
+    0, 3, 225, 134, 133, 0, 3, 225, 134, 136, 0, 3, 225, 134, 145, 0,
+    3, 225, 134, 146, 0, 3, 225, 134, 148, 0, 3, 225, 134, 158, 0, 3,
+    225, 134, 161, 0, 3, 228, 184, 137, 0, 3, 229, 155, 155, 0, 3, 228,
+    184, 138, 0, 3, 228, 184, 173, 0, 3, 228, 184, 139, 0, 3, 231, 148,
+    178, 0, 3, 228, 184, 153, 0, 3, 228, 184, 129, 0, 3, 229, 164, 169,
+    0, 3, 229, 156, 176, 0, 5, 40, 225, 132, 128, 41, 0, 5, 40, 225,
+    132, 130, 41, 0, 5, 40, 225, 132, 131, 41, 0, 5, 40, 225, 132, 133,
+    41, 0, 5, 40, 225, 132, 134, 41, 0, 5, 40, 225, 132, 135, 41, 0,
+    5, 40, 225, 132, 137, 41, 0, 5, 40, 225, 132, 139, 41, 0, 5, 40,
+    225, 132, 140, 41, 0, 5, 40, 225, 132, 142, 41, 0, 5, 40, 225, 132,
+    143, 41, 0, 5, 40, 225, 132, 144, 41, 0, 5, 40, 225, 132, 145, 41,
+    0, 5, 40, 225, 132, 146, 41, 0, 8, 40, 225, 132, 128, 225, 133, 161,
+    41, 0, 8, 40, 225, 132, 130, 225, 133, 161, 41, 0, 8, 40, 225, 132,
+    131, 225, 133, 161, 41, 0, 8, 40, 225, 132, 133, 225, 133, 161, 41, 0,
+    8, 40, 225, 132, 134, 225, 133, 161, 41, 0, 8, 40, 225, 132, 135, 225,
+    133, 161, 41, 0, 8, 40, 225, 132, 137, 225, 133, 161, 41, 0, 8, 40,
+    225, 132, 139, 225, 133, 161, 41, 0, 8, 40, 225, 132, 140, 225, 133, 161,
+    41, 0, 8, 40, 225, 132, 142, 225, 133, 161, 41, 0, 8, 40, 225, 132,
+    143, 225, 133, 161, 41, 0, 8, 40, 225, 132, 144, 225, 133, 161, 41, 0,
+    8, 40, 225, 132, 145, 225, 133, 161, 41, 0, 8, 40, 225, 132, 146, 225,
+    133, 161, 41, 0, 8, 40, 225, 132, 140, 225, 133, 174, 41, 0, 17, 40,
+    225, 132, 139, 225, 133, 169, 225, 132, 140, 225, 133, 165, 225, 134, 171, 41,
+    0, 14, 40, 225, 132, 139, 225, 133, 169, 225, 132, 146, 225, 133, 174, 41,
+    0, 5, 40, 228, 184, 128, 41, 0, 5, 40, 228, 186, 140, 41, 0, 5,
+    40, 228, 184, 137, 41, 0, 5, 40, 229, 155, 155, 41, 0, 5, 40, 228,
+    186, 148, 41, 0, 5, 40, 229, 133, 173, 41, 0, 5, 40, 228, 184, 131,
+    41, 0, 5, 40, 229, 133, 171, 41, 0, 5, 40, 228, 185, 157, 41, 0,
+    5, 40, 229, 141, 129, 41, 0, 5, 40, 230, 156, 136, 41, 0, 5, 40,
+    231, 129, 171, 41, 0, 5, 40, 230, 176, 180, 41, 0, 5, 40, 230, 156,
+    168, 41, 0, 5, 40, 233, 135, 145, 41, 0, 5, 40, 229, 156, 159, 41,
+    0, 5, 40, 230, 151, 165, 41, 0, 5, 40, 230, 160, 170, 41, 0, 5,
+    40, 230, 156, 137, 41, 0, 5, 40, 231, 164, 190, 41, 0, 5, 40, 229,
+    144, 141, 41, 0, 5, 40, 231, 137, 185, 41, 0, 5, 40, 232, 178, 161,
+    41, 0, 5, 40, 231, 165, 157, 41, 0, 5, 40, 229, 138, 180, 41, 0,
+    5, 40, 228, 187, 163, 41, 0, 5, 40, 229, 145, 188, 41, 0, 5, 40,
+    229, 173, 166, 41, 0, 5, 40, 231, 155, 163, 41, 0, 5, 40, 228, 188,
+    129, 41, 0, 5, 40, 232, 179, 135, 41, 0, 5, 40, 229, 141, 148, 41,
+    0, 5, 40, 231, 165, 173, 41, 0, 5, 40, 228, 188, 145, 41, 0, 5,
+    40, 232, 135, 170, 41, 0, 5, 40, 232, 135, 179, 41, 0, 3, 229, 149,
+    143, 0, 3, 229, 185, 188, 0, 3, 231, 174, 143, 0, 3, 80, 84, 69,
+    0, 2, 50, 49, 0, 2, 50, 50, 0, 2, 50, 51, 0, 2, 50, 52,
+    0, 2, 50, 53, 0, 2, 50, 54, 0, 2, 50, 55, 0, 2, 50, 56,
+    0, 2, 50, 57, 0, 2, 51, 48, 0, 2, 51, 49, 0, 2, 51, 50,
+    0, 2, 51, 51, 0, 2, 51, 52, 0, 2, 51, 53, 0, 6, 225, 132,
+    128, 225, 133, 161, 0, 6, 225, 132, 130, 225, 133, 161, 0, 6, 225, 132,
+    131, 225, 133, 161, 0, 6, 225, 132, 133, 225, 133, 161, 0, 6, 225, 132,
+    134, 225, 133, 161, 0, 6, 225, 132, 135, 225, 133, 161, 0, 6, 225, 132,
+    137, 225, 133, 161, 0, 6, 225, 132, 139, 225, 133, 161, 0, 6, 225, 132,
+    140, 225, 133, 161, 0, 6, 225, 132, 142, 225, 133, 161, 0, 6, 225, 132,
+    143, 225, 133, 161, 0, 6, 225, 132, 144, 225, 133, 161, 0, 6, 225, 132,
+    145, 225, 133, 161, 0, 6, 225, 132, 146, 225, 133, 161, 0, 15, 225, 132,
+    142, 225, 133, 161, 225, 134, 183, 225, 132, 128, 225, 133, 169, 0, 12, 225,
+    132, 140, 225, 133, 174, 225, 132, 139, 225, 133, 180, 0, 6, 225, 132, 139,
+    225, 133, 174, 0, 3, 228, 186, 148, 0, 3, 229, 133, 173, 0, 3, 228,
+    184, 131, 0, 3, 228, 185, 157, 0, 3, 230, 160, 170, 0, 3, 230, 156,
+    137, 0, 3, 231, 164, 190, 0, 3, 229, 144, 141, 0, 3, 231, 137, 185,
+    0, 3, 232, 178, 161, 0, 3, 231, 165, 157, 0, 3, 229, 138, 180, 0,
+    3, 231, 167, 152, 0, 3, 231, 148, 183, 0, 3, 233, 129, 169, 0, 3,
+    229, 132, 170, 0, 3, 229, 141, 176, 0, 3, 230, 179, 168, 0, 3, 233,
+    160, 133, 0, 3, 228, 188, 145, 0, 3, 229, 134, 153, 0, 3, 230, 173,
+    163, 0, 3, 229, 183, 166, 0, 3, 229, 143, 179, 0, 3, 229, 140, 187,
+    0, 3, 229, 174, 151, 0, 3, 229, 173, 166, 0, 3, 231, 155, 163, 0,
+    3, 228, 188, 129, 0, 3, 232, 179, 135, 0, 3, 229, 141, 148, 0, 3,
+    229, 164, 156, 0, 2, 51, 54, 0, 2, 51, 55, 0, 2, 51, 56, 0,
+    2, 51, 57, 0, 2, 52, 48, 0, 2, 52, 49, 0, 2, 52, 50, 0,
+    2, 52, 51, 0, 2, 52, 52, 0, 2, 52, 53, 0, 2, 52, 54, 0,
+    2, 52, 55, 0, 2, 52, 56, 0, 2, 52, 57, 0, 2, 53, 48, 0,
+    4, 49, 230, 156, 136, 0, 4, 50, 230, 156, 136, 0, 4, 51, 230, 156,
+    136, 0, 4, 52, 230, 156, 136, 0, 4, 53, 230, 156, 136, 0, 4, 54,
+    230, 156, 136, 0, 4, 55, 230, 156, 136, 0, 4, 56, 230, 156, 136, 0,
+    4, 57, 230, 156, 136, 0, 5, 49, 48, 230, 156, 136, 0, 5, 49, 49,
+    230, 156, 136, 0, 5, 49, 50, 230, 156, 136, 0, 2, 72, 103, 0, 3,
+    101, 114, 103, 0, 2, 101, 86, 0, 3, 76, 84, 68, 0, 3, 227, 130,
+    162, 0, 3, 227, 130, 164, 0, 3, 227, 130, 166, 0, 3, 227, 130, 168,
+    0, 3, 227, 130, 170, 0, 3, 227, 130, 171, 0, 3, 227, 130, 173, 0,
+    3, 227, 130, 175, 0, 3, 227, 130, 177, 0, 3, 227, 130, 179, 0, 3,
+    227, 130, 181, 0, 3, 227, 130, 183, 0, 3, 227, 130, 185, 0, 3, 227,
+    130, 187, 0, 3, 227, 130, 189, 0, 3, 227, 130, 191, 0, 3, 227, 131,
+    129, 0, 3, 227, 131, 132, 0, 3, 227, 131, 134, 0, 3, 227, 131, 136,
+    0, 3, 227, 131, 138, 0, 3, 227, 131, 139, 0, 3, 227, 131, 140, 0,
+    3, 227, 131, 141, 0, 3, 227, 131, 142, 0, 3, 227, 131, 143, 0, 3,
+    227, 131, 146, 0, 3, 227, 131, 149, 0, 3, 227, 131, 152, 0, 3, 227,
+    131, 155, 0, 3, 227, 131, 158, 0, 3, 227, 131, 159, 0, 3, 227, 131,
+    160, 0, 3, 227, 131, 161, 0, 3, 227, 131, 162, 0, 3, 227, 131, 164,
+    0, 3, 227, 131, 166, 0, 3, 227, 131, 168, 0, 3, 227, 131, 169, 0,
+    3, 227, 131, 170, 0, 3, 227, 131, 171, 0, 3, 227, 131, 172, 0, 3,
+    227, 131, 173, 0, 3, 227, 131, 175, 0, 3, 227, 131, 176, 0, 3, 227,
+    131, 177, 0, 3, 227, 131, 178, 0, 6, 228, 187, 164, 229, 146, 140, 0,
+    15, 227, 130, 162, 227, 131, 143, 227, 130, 154, 227, 131, 188, 227, 131, 136,
+    0, 12, 227, 130, 162, 227, 131, 171, 227, 131, 149, 227, 130, 161, 0, 15,
+    227, 130, 162, 227, 131, 179, 227, 131, 152, 227, 130, 154, 227, 130, 162, 0,
+    9, 227, 130, 162, 227, 131, 188, 227, 131, 171, 0, 15, 227, 130, 164, 227,
+    131, 139, 227, 131, 179, 227, 130, 175, 227, 130, 153, 0, 9, 227, 130, 164,
+    227, 131, 179, 227, 131, 129, 0, 9, 227, 130, 166, 227, 130, 169, 227, 131,
+    179, 0, 18, 227, 130, 168, 227, 130, 185, 227, 130, 175, 227, 131, 188, 227,
+    131, 136, 227, 130, 153, 0, 12, 227, 130, 168, 227, 131, 188, 227, 130, 171,
+    227, 131, 188, 0, 9, 227, 130, 170, 227, 131, 179, 227, 130, 185, 0, 9,
+    227, 130, 170, 227, 131, 188, 227, 131, 160, 0, 9, 227, 130, 171, 227, 130,
+    164, 227, 131, 170, 0, 12, 227, 130, 171, 227, 131, 169, 227, 131, 131, 227,
+    131, 136, 0, 12, 227, 130, 171, 227, 131, 173, 227, 131, 170, 227, 131, 188,
+    0, 12, 227, 130, 171, 227, 130, 153, 227, 131, 173, 227, 131, 179, 0, 12,
+    227, 130, 171, 227, 130, 153, 227, 131, 179, 227, 131, 158, 0, 12, 227, 130,
+    173, 227, 130, 153, 227, 130, 171, 227, 130, 153, 0, 12, 227, 130, 173, 227,
+    130, 153, 227, 131, 139, 227, 131, 188, 0, 12, 227, 130, 173, 227, 131, 165,
+    227, 131, 170, 227, 131, 188, 0, 18, 227, 130, 173, 227, 130, 153, 227, 131,
+    171, 227, 130, 191, 227, 130, 153, 227, 131, 188, 0, 6, 227, 130, 173, 227,
+    131, 173, 0, 18, 227, 130, 173, 227, 131, 173, 227, 130, 175, 227, 130, 153,
+    227, 131, 169, 227, 131, 160, 0, 18, 227, 130, 173, 227, 131, 173, 227, 131,
+    161, 227, 131, 188, 227, 131, 136, 227, 131, 171, 0, 15, 227, 130, 173, 227,
+    131, 173, 227, 131, 175, 227, 131, 131, 227, 131, 136, 0, 12, 227, 130, 175,
+    227, 130, 153, 227, 131, 169, 227, 131, 160, 0, 18, 227, 130, 175, 227, 130,
+    153, 227, 131, 169, 227, 131, 160, 227, 131, 136, 227, 131, 179, 0, 18, 227,
+    130, 175, 227, 131, 171, 227, 130, 187, 227, 130, 153, 227, 130, 164, 227, 131,
+    173, 0, 12, 227, 130, 175, 227, 131, 173, 227, 131, 188, 227, 131, 141, 0,
+    9, 227, 130, 177, 227, 131, 188, 227, 130, 185, 0, 9, 227, 130, 179, 227,
+    131, 171, 227, 131, 138, 0, 12, 227, 130, 179, 227, 131, 188, 227, 131, 155,
+    227, 130, 154, 0, 12, 227, 130, 181, 227, 130, 164, 227, 130, 175, 227, 131,
+    171, 0, 15, 227, 130, 181, 227, 131, 179, 227, 131, 129, 227, 131, 188, 227,
+    131, 160, 0, 15, 227, 130, 183, 227, 131, 170, 227, 131, 179, 227, 130, 175,
+    227, 130, 153, 0, 9, 227, 130, 187, 227, 131, 179, 227, 131, 129, 0, 9,
+    227, 130, 187, 227, 131, 179, 227, 131, 136, 0, 12, 227, 130, 191, 227, 130,
+    153, 227, 131, 188, 227, 130, 185, 0, 9, 227, 131, 134, 227, 130, 153, 227,
+    130, 183, 0, 9, 227, 131, 136, 227, 130, 153, 227, 131, 171, 0, 6, 227,
+    131, 136, 227, 131, 179, 0, 6, 227, 131, 138, 227, 131, 142, 0, 9, 227,
+    131, 142, 227, 131, 131, 227, 131, 136, 0, 9, 227, 131, 143, 227, 130, 164,
+    227, 131, 132, 0, 18, 227, 131, 143, 227, 130, 154, 227, 131, 188, 227, 130,
+    187, 227, 131, 179, 227, 131, 136, 0, 12, 227, 131, 143, 227, 130, 154, 227,
+    131, 188, 227, 131, 132, 0, 15, 227, 131, 143, 227, 130, 153, 227, 131, 188,
+    227, 131, 172, 227, 131, 171, 0, 18, 227, 131, 146, 227, 130, 154, 227, 130,
+    162, 227, 130, 185, 227, 131, 136, 227, 131, 171, 0, 12, 227, 131, 146, 227,
+    130, 154, 227, 130, 175, 227, 131, 171, 0, 9, 227, 131, 146, 227, 130, 154,
+    227, 130, 179, 0, 9, 227, 131, 146, 227, 130, 153, 227, 131, 171, 0, 18,
+    227, 131, 149, 227, 130, 161, 227, 131, 169, 227, 131, 131, 227, 131, 136, 227,
+    130, 153, 0, 12, 227, 131, 149, 227, 130, 163, 227, 131, 188, 227, 131, 136,
+    0, 18, 227, 131, 149, 227, 130, 153, 227, 131, 131, 227, 130, 183, 227, 130,
+    167, 227, 131, 171, 0, 9, 227, 131, 149, 227, 131, 169, 227, 131, 179, 0,
+    15, 227, 131, 152, 227, 130, 175, 227, 130, 191, 227, 131, 188, 227, 131, 171,
+    0, 9, 227, 131, 152, 227, 130, 154, 227, 130, 189, 0, 12, 227, 131, 152,
+    227, 130, 154, 227, 131, 139, 227, 131, 146, 0, 9, 227, 131, 152, 227, 131,
+    171, 227, 131, 132, 0, 12, 227, 131, 152, 227, 130, 154, 227, 131, 179, 227,
+    130, 185, 0, 15, 227, 131, 152, 227, 130, 154, 227, 131, 188, 227, 130, 183,
+    227, 130, 153, 0, 12, 227, 131, 152, 227, 130, 153, 227, 131, 188, 227, 130,
+    191, 0, 15, 227, 131, 155, 227, 130, 154, 227, 130, 164, 227, 131, 179, 227,
+    131, 136, 0, 12, 227, 131, 155, 227, 130, 153, 227, 131, 171, 227, 131, 136,
+    0, 6, 227, 131, 155, 227, 131, 179, 0, 15, 227, 131, 155, 227, 130, 154,
+    227, 131, 179, 227, 131, 136, 227, 130, 153, 0, 9, 227, 131, 155, 227, 131,
+    188, 227, 131, 171, 0, 9, 227, 131, 155, 227, 131, 188, 227, 131, 179, 0,
+    12, 227, 131, 158, 227, 130, 164, 227, 130, 175, 227, 131, 173, 0, 9, 227,
+    131, 158, 227, 130, 164, 227, 131, 171, 0, 9, 227, 131, 158, 227, 131, 131,
+    227, 131, 143, 0, 9, 227, 131, 158, 227, 131, 171, 227, 130, 175, 0, 15,
+    227, 131, 158, 227, 131, 179, 227, 130, 183, 227, 131, 167, 227, 131, 179, 0,
+    12, 227, 131, 159, 227, 130, 175, 227, 131, 173, 227, 131, 179, 0, 6, 227,
+    131, 159, 227, 131, 170, 0, 18, 227, 131, 159, 227, 131, 170, 227, 131, 143,
+    227, 130, 153, 227, 131, 188, 227, 131, 171, 0, 9, 227, 131, 161, 227, 130,
+    171, 227, 130, 153, 0, 15, 227, 131, 161, 227, 130, 171, 227, 130, 153, 227,
+    131, 136, 227, 131, 179, 0, 12, 227, 131, 161, 227, 131, 188, 227, 131, 136,
+    227, 131, 171, 0, 12, 227, 131, 164, 227, 131, 188, 227, 131, 136, 227, 130,
+    153, 0, 9, 227, 131, 164, 227, 131, 188, 227, 131, 171, 0, 9, 227, 131,
+    166, 227, 130, 162, 227, 131, 179, 0, 12, 227, 131, 170, 227, 131, 131, 227,
+    131, 136, 227, 131, 171, 0, 6, 227, 131, 170, 227, 131, 169, 0, 12, 227,
+    131, 171, 227, 131, 146, 227, 130, 154, 227, 131, 188, 0, 15, 227, 131, 171,
+    227, 131, 188, 227, 131, 149, 227, 130, 153, 227, 131, 171, 0, 6, 227, 131,
+    172, 227, 131, 160, 0, 18, 227, 131, 172, 227, 131, 179, 227, 131, 136, 227,
+    130, 177, 227, 130, 153, 227, 131, 179, 0, 9, 227, 131, 175, 227, 131, 131,
+    227, 131, 136, 0, 4, 48, 231, 130, 185, 0, 4, 49, 231, 130, 185, 0,
+    4, 50, 231, 130, 185, 0, 4, 51, 231, 130, 185, 0, 4, 52, 231, 130,
+    185, 0, 4, 53, 231, 130, 185, 0, 4, 54, 231, 130, 185, 0, 4, 55,
+    231, 130, 185, 0, 4, 56, 231, 130, 185, 0, 4, 57, 231, 130, 185, 0,
+    5, 49, 48, 231, 130, 185, 0, 5, 49, 49, 231, 130, 185, 0, 5, 49,
+    50, 231, 130, 185, 0, 5, 49, 51, 231, 130, 185, 0, 5, 49, 52, 231,
+    130, 185, 0, 5, 49, 53, 231, 130, 185, 0, 5, 49, 54, 231, 130, 185,
+    0, 5, 49, 55, 231, 130, 185, 0, 5, 49, 56, 231, 130, 185, 0, 5,
+    49, 57, 231, 130, 185, 0, 5, 50, 48, 231, 130, 185, 0, 5, 50, 49,
+    231, 130, 185, 0, 5, 50, 50, 231, 130, 185, 0, 5, 50, 51, 231, 130,
+    185, 0, 5, 50, 52, 231, 130, 185, 0, 3, 104, 80, 97, 0, 2, 100,
+    97, 0, 2, 65, 85, 0, 3, 98, 97, 114, 0, 2, 111, 86, 0, 2,
+    112, 99, 0, 2, 100, 109, 0, 3, 100, 109, 50, 0, 3, 100, 109, 51,
+    0, 2, 73, 85, 0, 6, 229, 185, 179, 230, 136, 144, 0, 6, 230, 152,
+    173, 229, 146, 140, 0, 6, 229, 164, 167, 230, 173, 163, 0, 6, 230, 152,
+    142, 230, 178, 187, 0, 12, 230, 160, 170, 229, 188, 143, 228, 188, 154, 231,
+    164, 190, 0, 2, 112, 65, 0, 2, 110, 65, 0, 3, 206, 188, 65, 0,
+    2, 109, 65, 0, 2, 107, 65, 0, 2, 75, 66, 0, 2, 77, 66, 0,
+    2, 71, 66, 0, 3, 99, 97, 108, 0, 4, 107, 99, 97, 108, 0, 2,
+    112, 70, 0, 2, 110, 70, 0, 3, 206, 188, 70, 0, 3, 206, 188, 103,
+    0, 2, 109, 103, 0, 2, 107, 103, 0, 2, 72, 122, 0, 3, 107, 72,
+    122, 0, 3, 77, 72, 122, 0, 3, 71, 72, 122, 0, 3, 84, 72, 122,
+    0, 3, 206, 188, 108, 0, 2, 109, 108, 0, 2, 100, 108, 0, 2, 107,
+    108, 0, 2, 102, 109, 0, 2, 110, 109, 0, 3, 206, 188, 109, 0, 2,
+    109, 109, 0, 2, 99, 109, 0, 2, 107, 109, 0, 3, 109, 109, 50, 0,
+    3, 99, 109, 50, 0, 2, 109, 50, 0, 3, 107, 109, 50, 0, 3, 109,
+    109, 51, 0, 3, 99, 109, 51, 0, 2, 109, 51, 0, 3, 107, 109, 51,
+    0, 5, 109, 226, 136, 149, 115, 0, 6, 109, 226, 136, 149, 115, 50, 0,
+    2, 80, 97, 0, 3, 107, 80, 97, 0, 3, 77, 80, 97, 0, 3, 71,
+    80, 97, 0, 3, 114, 97, 100, 0, 7, 114, 97, 100, 226, 136, 149, 115,
+    0, 8, 114, 97, 100, 226, 136, 149, 115, 50, 0, 2, 112, 115, 0, 2,
+    110, 115, 0, 3, 206, 188, 115, 0, 2, 109, 115, 0, 2, 112, 86, 0,
+    2, 110, 86, 0, 3, 206, 188, 86, 0, 2, 109, 86, 0, 2, 107, 86,
+    0, 2, 77, 86, 0, 2, 112, 87, 0, 2, 110, 87, 0, 3, 206, 188,
+    87, 0, 2, 109, 87, 0, 2, 107, 87, 0, 2, 77, 87, 0, 3, 107,
+    206, 169, 0, 3, 77, 206, 169, 0, 4, 97, 46, 109, 46, 0, 2, 66,
+    113, 0, 2, 99, 99, 0, 2, 99, 100, 0, 6, 67, 226, 136, 149, 107,
+    103, 0, 3, 67, 111, 46, 0, 2, 100, 66, 0, 2, 71, 121, 0, 2,
+    104, 97, 0, 2, 72, 80, 0, 2, 105, 110, 0, 2, 75, 75, 0, 2,
+    75, 77, 0, 2, 107, 116, 0, 2, 108, 109, 0, 2, 108, 110, 0, 3,
+    108, 111, 103, 0, 2, 108, 120, 0, 2, 109, 98, 0, 3, 109, 105, 108,
+    0, 3, 109, 111, 108, 0, 2, 80, 72, 0, 4, 112, 46, 109, 46, 0,
+    3, 80, 80, 77, 0, 2, 80, 82, 0, 2, 115, 114, 0, 2, 83, 118,
+    0, 2, 87, 98, 0, 5, 86, 226, 136, 149, 109, 0, 5, 65, 226, 136,
+    149, 109, 0, 4, 49, 230, 151, 165, 0, 4, 50, 230, 151, 165, 0, 4,
+    51, 230, 151, 165, 0, 4, 52, 230, 151, 165, 0, 4, 53, 230, 151, 165,
+    0, 4, 54, 230, 151, 165, 0, 4, 55, 230, 151, 165, 0, 4, 56, 230,
+    151, 165, 0, 4, 57, 230, 151, 165, 0, 5, 49, 48, 230, 151, 165, 0,
+    5, 49, 49, 230, 151, 165, 0, 5, 49, 50, 230, 151, 165, 0, 5, 49,
+    51, 230, 151, 165, 0, 5, 49, 52, 230, 151, 165, 0, 5, 49, 53, 230,
+    151, 165, 0, 5, 49, 54, 230, 151, 165, 0, 5, 49, 55, 230, 151, 165,
+    0, 5, 49, 56, 230, 151, 165, 0, 5, 49, 57, 230, 151, 165, 0, 5,
+    50, 48, 230, 151, 165, 0, 5, 50, 49, 230, 151, 165, 0, 5, 50, 50,
+    230, 151, 165, 0, 5, 50, 51, 230, 151, 165, 0, 5, 50, 52, 230, 151,
+    165, 0, 5, 50, 53, 230, 151, 165, 0, 5, 50, 54, 230, 151, 165, 0,
+    5, 50, 55, 230, 151, 165, 0, 5, 50, 56, 230, 151, 165, 0, 5, 50,
+    57, 230, 151, 165, 0, 5, 51, 48, 230, 151, 165, 0, 5, 51, 49, 230,
+    151, 165, 0, 3, 103, 97, 108, 0, 2, 209, 138, 0, 2, 209, 140, 0,
+    3, 234, 157, 175, 0, 2, 196, 166, 0, 2, 197, 147, 0, 3, 234, 156,
+    167, 0, 3, 234, 172, 183, 0, 2, 201, 171, 0, 3, 234, 173, 146, 0,
+    2, 202, 141, 3, 0, 232, 177, 136, 3, 0, 230, 155, 180, 3, 0, 232,
+    187, 138, 3, 0, 232, 179, 136, 3, 0, 230, 187, 145, 3, 0, 228, 184,
+    178, 3, 0, 229, 143, 165, 3, 0, 233, 190, 156, 3, 0, 229, 165, 145,
+    3, 0, 233, 135, 145, 3, 0, 229, 150, 135, 3, 0, 229, 165, 136, 3,
+    0, 230, 135, 182, 3, 0, 231, 153, 169, 3, 0, 231, 190, 133, 3, 0,
+    232, 152, 191, 3, 0, 232, 158, 186, 3, 0, 232, 163, 184, 3, 0, 233,
+    130, 143, 3, 0, 230, 168, 130, 3, 0, 230, 180, 155, 3, 0, 231, 131,
+    153, 3, 0, 231, 143, 158, 3, 0, 232, 144, 189, 3, 0, 233, 133, 170,
+    3, 0, 233, 167, 177, 3, 0, 228, 186, 130, 3, 0, 229, 141, 181, 3,
+    0, 230, 172, 132, 3, 0, 231, 136, 155, 3, 0, 232, 152, 173, 3, 0,
+    233, 184, 158, 3, 0, 229, 181, 144, 3, 0, 230, 191, 171, 3, 0, 232,
+    151, 141, 3, 0, 232, 165, 164, 3, 0, 230, 139, 137, 3, 0, 232, 135,
+    152, 3, 0, 232, 160, 159, 3, 0, 229, 187, 138, 3, 0, 230, 156, 151,
+    3, 0, 230, 181, 170, 3, 0, 231, 139, 188, 3, 0, 233, 131, 142, 3,
+    0, 228, 190, 134, 3, 0, 229, 134, 183, 3, 0, 229, 139, 158, 3, 0,
+    230, 147, 132, 3, 0, 230, 171, 147, 3, 0, 231, 136, 144, 3, 0, 231,
+    155, 167, 3, 0, 232, 128, 129, 3, 0, 232, 152, 134, 3, 0, 232, 153,
+    156, 3, 0, 232, 183, 175, 3, 0, 233, 156, 178, 3, 0, 233, 173, 175,
+    3, 0, 233, 183, 186, 3, 0, 231, 162, 140, 3, 0, 231, 165, 191, 3,
+    0, 231, 182, 160, 3, 0, 232, 143, 137, 3, 0, 233, 140, 132, 3, 0,
+    233, 185, 191, 3, 0, 232, 171, 150, 3, 0, 229, 163, 159, 3, 0, 229,
+    188, 132, 3, 0, 231, 177, 160, 3, 0, 232, 129, 190, 3, 0, 231, 137,
+    162, 3, 0, 231, 163, 138, 3, 0, 232, 179, 130, 3, 0, 233, 155, 183,
+    3, 0, 229, 163, 152, 3, 0, 229, 177, 162, 3, 0, 230, 168, 147, 3,
+    0, 230, 183, 154, 3, 0, 230, 188, 143, 3, 0, 231, 180, 175, 3, 0,
+    231, 184, 183, 3, 0, 233, 153, 139, 3, 0, 229, 139, 146, 3, 0, 232,
+    130, 139, 3, 0, 229, 135, 156, 3, 0, 229, 135, 140, 3, 0, 231, 168,
+    156, 3, 0, 231, 182, 190, 3, 0, 232, 143, 177, 3, 0, 233, 153, 181,
+    3, 0, 232, 174, 128, 3, 0, 230, 139, 143, 3, 0, 232, 171, 190, 3,
+    0, 228, 184, 185, 3, 0, 229, 175, 167, 3, 0, 230, 128, 146, 3, 0,
+    231, 142, 135, 3, 0, 231, 149, 176, 3, 0, 229, 140, 151, 3, 0, 231,
+    163, 187, 3, 0, 228, 190, 191, 3, 0, 229, 190, 169, 3, 0, 228, 184,
+    141, 3, 0, 230, 179, 140, 3, 0, 230, 149, 184, 3, 0, 231, 180, 162,
+    3, 0, 229, 143, 131, 3, 0, 229, 161, 158, 3, 0, 231, 156, 129, 3,
+    0, 232, 145, 137, 3, 0, 232, 170, 170, 3, 0, 230, 174, 186, 3, 0,
+    232, 190, 176, 3, 0, 230, 178, 136, 3, 0, 230, 139, 190, 3, 0, 232,
+    139, 165, 3, 0, 230, 142, 160, 3, 0, 231, 149, 165, 3, 0, 228, 186,
+    174, 3, 0, 229, 133, 169, 3, 0, 229, 135, 137, 3, 0, 230, 162, 129,
+    3, 0, 231, 179, 167, 3, 0, 232, 137, 175, 3, 0, 232, 171, 146, 3,
+    0, 233, 135, 143, 3, 0, 229, 139, 181, 3, 0, 229, 145, 130, 3, 0,
+    229, 165, 179, 3, 0, 229, 187, 172, 3, 0, 230, 151, 133, 3, 0, 230,
+    191, 190, 3, 0, 231, 164, 170, 3, 0, 233, 150, 173, 3, 0, 233, 169,
+    170, 3, 0, 233, 186, 151, 3, 0, 233, 187, 142, 3, 0, 229, 138, 155,
+    3, 0, 230, 155, 134, 3, 0, 230, 173, 183, 3, 0, 232, 189, 162, 3,
+    0, 229, 185, 180, 3, 0, 230, 134, 144, 3, 0, 230, 136, 128, 3, 0,
+    230, 146, 154, 3, 0, 230, 188, 163, 3, 0, 231, 133, 137, 3, 0, 231,
+    146, 137, 3, 0, 231, 167, 138, 3, 0, 231, 183, 180, 3, 0, 232, 129,
+    175, 3, 0, 232, 188, 166, 3, 0, 232, 147, 174, 3, 0, 233, 128, 163,
+    3, 0, 233, 141, 138, 3, 0, 229, 136, 151, 3, 0, 229, 138, 163, 3,
+    0, 229, 146, 189, 3, 0, 231, 131, 136, 3, 0, 232, 163, 130, 3, 0,
+    229, 187, 137, 3, 0, 229, 191, 181, 3, 0, 230, 141, 187, 3, 0, 230,
+    174, 174, 3, 0, 231, 176, 190, 3, 0, 231, 141, 181, 3, 0, 228, 187,
+    164, 3, 0, 229, 155, 185, 3, 0, 229, 182, 186, 3, 0, 230, 128, 156,
+    3, 0, 231, 142, 178, 3, 0, 231, 145, 169, 3, 0, 231, 190, 154, 3,
+    0, 232, 129, 134, 3, 0, 233, 136, 180, 3, 0, 233, 155, 182, 3, 0,
+    233, 157, 136, 3, 0, 233, 160, 152, 3, 0, 228, 190, 139, 3, 0, 231,
+    166, 174, 3, 0, 233, 134, 180, 3, 0, 233, 154, 184, 3, 0, 230, 131,
+    161, 3, 0, 228, 186, 134, 3, 0, 229, 131, 154, 3, 0, 229, 175, 174,
+    3, 0, 229, 176, 191, 3, 0, 230, 150, 153, 3, 0, 231, 135, 142, 3,
+    0, 231, 153, 130, 3, 0, 232, 147, 188, 3, 0, 233, 129, 188, 3, 0,
+    233, 190, 141, 3, 0, 230, 154, 136, 3, 0, 233, 152, 174, 3, 0, 229,
+    138, 137, 3, 0, 230, 157, 187, 3, 0, 230, 159, 179, 3, 0, 230, 181,
+    129, 3, 0, 230, 186, 156, 3, 0, 231, 144, 137, 3, 0, 231, 149, 153,
+    3, 0, 231, 161, 171, 3, 0, 231, 180, 144, 3, 0, 233, 161, 158, 3,
+    0, 229, 133, 173, 3, 0, 230, 136, 174, 3, 0, 233, 153, 184, 3, 0,
+    229, 128, 171, 3, 0, 229, 180, 153, 3, 0, 230, 183, 170, 3, 0, 232,
+    188, 170, 3, 0, 229, 190, 139, 3, 0, 230, 133, 132, 3, 0, 230, 160,
+    151, 3, 0, 233, 154, 134, 3, 0, 229, 136, 169, 3, 0, 229, 144, 143,
+    3, 0, 229, 177, 165, 3, 0, 230, 152, 147, 3, 0, 230, 157, 142, 3,
+    0, 230, 162, 168, 3, 0, 230, 179, 165, 3, 0, 231, 144, 134, 3, 0,
+    231, 151, 162, 3, 0, 231, 189, 185, 3, 0, 232, 163, 143, 3, 0, 232,
+    163, 161, 3, 0, 233, 135, 140, 3, 0, 233, 155, 162, 3, 0, 229, 140,
+    191, 3, 0, 230, 186, 186, 3, 0, 229, 144, 157, 3, 0, 231, 135, 144,
+    3, 0, 231, 146, 152, 3, 0, 232, 151, 186, 3, 0, 233, 154, 163, 3,
+    0, 233, 177, 151, 3, 0, 233, 186, 159, 3, 0, 230, 158, 151, 3, 0,
+    230, 183, 139, 3, 0, 232, 135, 168, 3, 0, 231, 171, 139, 3, 0, 231,
+    172, 160, 3, 0, 231, 178, 146, 3, 0, 231, 139, 128, 3, 0, 231, 130,
+    153, 3, 0, 232, 173, 152, 3, 0, 228, 187, 128, 3, 0, 232, 140, 182,
+    3, 0, 229, 136, 186, 3, 0, 229, 136, 135, 3, 0, 229, 186, 166, 3,
+    0, 230, 139, 147, 3, 0, 231, 179, 150, 3, 0, 229, 174, 133, 3, 0,
+    230, 180, 158, 3, 0, 230, 154, 180, 3, 0, 232, 188, 187, 3, 0, 232,
+    161, 140, 3, 0, 233, 153, 141, 3, 0, 232, 166, 139, 3, 0, 229, 187,
+    147, 3, 0, 229, 133, 128, 3, 0, 229, 151, 128, 3, 0, 229, 161, 154,
+    3, 0, 230, 153, 180, 3, 0, 229, 135, 158, 3, 0, 231, 140, 170, 3,
+    0, 231, 155, 138, 3, 0, 231, 164, 188, 3, 0, 231, 165, 158, 3, 0,
+    231, 165, 165, 3, 0, 231, 166, 143, 3, 0, 233, 157, 150, 3, 0, 231,
+    178, 190, 3, 0, 231, 190, 189, 3, 0, 232, 152, 146, 3, 0, 232, 171,
+    184, 3, 0, 233, 128, 184, 3, 0, 233, 131, 189, 3, 0, 233, 163, 175,
+    3, 0, 233, 163, 188, 3, 0, 233, 164, 168, 3, 0, 233, 182, 180, 3,
+    0, 233, 131, 158, 3, 0, 233, 154, 183, 3, 0, 228, 190, 174, 3, 0,
+    229, 131, 167, 3, 0, 229, 133, 141, 3, 0, 229, 139, 137, 3, 0, 229,
+    139, 164, 3, 0, 229, 141, 145, 3, 0, 229, 150, 157, 3, 0, 229, 152,
+    134, 3, 0, 229, 153, 168, 3, 0, 229, 161, 128, 3, 0, 229, 162, 168,
+    3, 0, 229, 177, 164, 3, 0, 229, 177, 174, 3, 0, 230, 130, 148, 3,
+    0, 230, 133, 168, 3, 0, 230, 134, 142, 3, 0, 230, 135, 178, 3, 0,
+    230, 149, 143, 3, 0, 230, 151, 162, 3, 0, 230, 154, 145, 3, 0, 230,
+    162, 133, 3, 0, 230, 181, 183, 3, 0, 230, 184, 154, 3, 0, 230, 188,
+    162, 3, 0, 231, 133, 174, 3, 0, 231, 136, 171, 3, 0, 231, 144, 162,
+    3, 0, 231, 162, 145, 3, 0, 231, 164, 190, 3, 0, 231, 165, 137, 3,
+    0, 231, 165, 136, 3, 0, 231, 165, 144, 3, 0, 231, 165, 150, 3, 0,
+    231, 165, 157, 3, 0, 231, 166, 141, 3, 0, 231, 166, 142, 3, 0, 231,
+    169, 128, 3, 0, 231, 170, 129, 3, 0, 231, 175, 128, 3, 0, 231, 184,
+    137, 3, 0, 231, 185, 129, 3, 0, 231, 189, 178, 3, 0, 232, 128, 133,
+    3, 0, 232, 135, 173, 3, 0, 232, 137, 185, 3, 0, 232, 145, 151, 3,
+    0, 232, 164, 144, 3, 0, 232, 166, 150, 3, 0, 232, 172, 129, 3, 0,
+    232, 172, 185, 3, 0, 232, 179, 147, 3, 0, 232, 180, 136, 3, 0, 232,
+    190, 182, 3, 0, 233, 155, 163, 3, 0, 233, 159, 191, 3, 0, 233, 160,
+    187, 3, 0, 230, 129, 181, 4, 0, 240, 164, 139, 174, 3, 0, 232, 136,
+    152, 3, 0, 228, 184, 166, 3, 0, 229, 134, 181, 3, 0, 229, 133, 168,
+    3, 0, 228, 190, 128, 3, 0, 229, 133, 133, 3, 0, 229, 134, 128, 3,
+    0, 229, 139, 135, 3, 0, 229, 139, 186, 3, 0, 229, 149, 149, 3, 0,
+    229, 150, 153, 3, 0, 229, 151, 162, 3, 0, 229, 162, 179, 3, 0, 229,
+    165, 132, 3, 0, 229, 165, 148, 3, 0, 229, 169, 162, 3, 0, 229, 172,
+    168, 3, 0, 229, 187, 146, 3, 0, 229, 187, 153, 3, 0, 229, 189, 169,
+    3, 0, 229, 190, 173, 3, 0, 230, 131, 152, 3, 0, 230, 133, 142, 3,
+    0, 230, 132, 136, 3, 0, 230, 133, 160, 3, 0, 230, 136, 180, 3, 0,
+    230, 143, 132, 3, 0, 230, 144, 156, 3, 0, 230, 145, 146, 3, 0, 230,
+    149, 150, 3, 0, 230, 156, 155, 3, 0, 230, 157, 150, 3, 0, 230, 173,
+    185, 3, 0, 230, 187, 155, 3, 0, 230, 187, 139, 3, 0, 231, 128, 158,
+    3, 0, 231, 158, 167, 3, 0, 231, 136, 181, 3, 0, 231, 138, 175, 3,
+    0, 231, 145, 177, 3, 0, 231, 148, 134, 3, 0, 231, 148, 187, 3, 0,
+    231, 152, 157, 3, 0, 231, 152, 159, 3, 0, 231, 155, 155, 3, 0, 231,
+    155, 180, 3, 0, 231, 157, 138, 3, 0, 231, 157, 128, 3, 0, 231, 163,
+    140, 3, 0, 231, 170, 177, 3, 0, 231, 177, 187, 3, 0, 231, 181, 155,
+    3, 0, 231, 188, 190, 3, 0, 232, 141, 146, 3, 0, 232, 143, 175, 3,
+    0, 232, 157, 185, 3, 0, 232, 165, 129, 3, 0, 232, 166, 134, 3, 0,
+    232, 170, 191, 3, 0, 232, 171, 139, 3, 0, 232, 171, 173, 3, 0, 232,
+    174, 138, 3, 0, 232, 188, 184, 3, 0, 233, 129, 178, 3, 0, 233, 134,
+    153, 3, 0, 233, 137, 182, 3, 0, 233, 153, 188, 3, 0, 233, 159, 155,
+    3, 0, 233, 160, 139, 3, 0, 233, 172, 146, 4, 0, 240, 162, 161, 138,
+    4, 0, 240, 162, 161, 132, 4, 0, 240, 163, 143, 149, 3, 0, 227, 174,
+    157, 3, 0, 228, 128, 152, 3, 0, 228, 128, 185, 4, 0, 240, 165, 137,
+    137, 4, 0, 240, 165, 179, 144, 4, 0, 240, 167, 187, 147, 3, 0, 233,
+    189, 131, 3, 0, 233, 190, 142, 0, 2, 102, 102, 0, 2, 102, 105, 0,
+    2, 102, 108, 0, 3, 102, 102, 105, 0, 3, 102, 102, 108, 0, 2, 115,
+    116, 0, 4, 213, 180, 213, 182, 0, 4, 213, 180, 213, 165, 0, 4, 213,
+    180, 213, 171, 0, 4, 213, 190, 213, 182, 0, 4, 213, 180, 213, 173, 4,
+    0, 215, 153, 214, 180, 4, 0, 215, 178, 214, 183, 0, 2, 215, 162, 0,
+    2, 215, 148, 0, 2, 215, 155, 0, 2, 215, 156, 0, 2, 215, 157, 0,
+    2, 215, 168, 0, 2, 215, 170, 4, 0, 215, 169, 215, 129, 4, 0, 215,
+    169, 215, 130, 6, 0, 215, 169, 214, 188, 215, 129, 6, 0, 215, 169, 214,
+    188, 215, 130, 4, 0, 215, 144, 214, 183, 4, 0, 215, 144, 214, 184, 4,
+    0, 215, 144, 214, 188, 4, 0, 215, 145, 214, 188, 4, 0, 215, 146, 214,
+    188, 4, 0, 215, 147, 214, 188, 4, 0, 215, 148, 214, 188, 4, 0, 215,
+    149, 214, 188, 4, 0, 215, 150, 214, 188, 4, 0, 215, 152, 214, 188, 4,
+    0, 215, 153, 214, 188, 4, 0, 215, 154, 214, 188, 4, 0, 215, 155, 214,
+    188, 4, 0, 215, 156, 214, 188, 4, 0, 215, 158, 214, 188, 4, 0, 215,
+    160, 214, 188, 4, 0, 215, 161, 214, 188, 4, 0, 215, 163, 214, 188, 4,
+    0, 215, 164, 214, 188, 4, 0, 215, 166, 214, 188, 4, 0, 215, 167, 214,
+    188, 4, 0, 215, 168, 214, 188, 4, 0, 215, 169, 214, 188, 4, 0, 215,
+    170, 214, 188, 4, 0, 215, 149, 214, 185, 4, 0, 215, 145, 214, 191, 4,
+    0, 215, 155, 214, 191, 4, 0, 215, 164, 214, 191, 0, 4, 215, 144, 215,
+    156, 0, 2, 217, 177, 0, 2, 217, 187, 0, 2, 217, 190, 0, 2, 218,
+    128, 0, 2, 217, 186, 0, 2, 217, 191, 0, 2, 217, 185, 0, 2, 218,
+    164, 0, 2, 218, 166, 0, 2, 218, 132, 0, 2, 218, 131, 0, 2, 218,
+    134, 0, 2, 218, 135, 0, 2, 218, 141, 0, 2, 218, 140, 0, 2, 218,
+    142, 0, 2, 218, 136, 0, 2, 218, 152, 0, 2, 218, 145, 0, 2, 218,
+    169, 0, 2, 218, 175, 0, 2, 218, 179, 0, 2, 218, 177, 0, 2, 218,
+    186, 0, 2, 218, 187, 0, 4, 219, 149, 217, 148, 0, 2, 219, 129, 0,
+    2, 218, 190, 0, 2, 219, 146, 0, 4, 219, 146, 217, 148, 0, 2, 218,
+    173, 0, 2, 219, 135, 0, 2, 219, 134, 0, 2, 219, 136, 0, 2, 219,
+    139, 0, 2, 219, 133, 0, 2, 219, 137, 0, 2, 219, 144, 0, 2, 217,
+    137, 0, 6, 217, 138, 217, 148, 216, 167, 0, 6, 217, 138, 217, 148, 219,
+    149, 0, 6, 217, 138, 217, 148, 217, 136, 0, 6, 217, 138, 217, 148, 219,
+    135, 0, 6, 217, 138, 217, 148, 219, 134, 0, 6, 217, 138, 217, 148, 219,
+    136, 0, 6, 217, 138, 217, 148, 219, 144, 0, 6, 217, 138, 217, 148, 217,
+    137, 0, 2, 219, 140, 0, 6, 217, 138, 217, 148, 216, 172, 0, 6, 217,
+    138, 217, 148, 216, 173, 0, 6, 217, 138, 217, 148, 217, 133, 0, 6, 217,
+    138, 217, 148, 217, 138, 0, 4, 216, 168, 216, 172, 0, 4, 216, 168, 216,
+    173, 0, 4, 216, 168, 216, 174, 0, 4, 216, 168, 217, 133, 0, 4, 216,
+    168, 217, 137, 0, 4, 216, 168, 217, 138, 0, 4, 216, 170, 216, 172, 0,
+    4, 216, 170, 216, 173, 0, 4, 216, 170, 216, 174, 0, 4, 216, 170, 217,
+    133, 0, 4, 216, 170, 217, 137, 0, 4, 216, 170, 217, 138, 0, 4, 216,
+    171, 216, 172, 0, 4, 216, 171, 217, 133, 0, 4, 216, 171, 217, 137, 0,
+    4, 216, 171, 217, 138, 0, 4, 216, 172, 216, 173, 0, 4, 216, 172, 217,
+    133, 0, 4, 216, 173, 216, 172, 0, 4, 216, 173, 217, 133, 0, 4, 216,
+    174, 216, 172, 0, 4, 216, 174, 216, 173, 0, 4, 216, 174, 217, 133, 0,
+    4, 216, 179, 216, 172, 0, 4, 216, 179, 216, 173, 0, 4, 216, 179, 216,
+    174, 0, 4, 216, 179, 217, 133, 0, 4, 216, 181, 216, 173, 0, 4, 216,
+    181, 217, 133, 0, 4, 216, 182, 216, 172, 0, 4, 216, 182, 216, 173, 0,
+    4, 216, 182, 216, 174, 0, 4, 216, 182, 217, 133, 0, 4, 216, 183, 216,
+    173, 0, 4, 216, 183, 217, 133, 0, 4, 216, 184, 217, 133, 0, 4, 216,
+    185, 216, 172, 0, 4, 216, 185, 217, 133, 0, 4, 216, 186, 216, 172, 0,
+    4, 216, 186, 217, 133, 0, 4, 217, 129, 216, 172, 0, 4, 217, 129, 216,
+    173, 0, 4, 217, 129, 216, 174, 0, 4, 217, 129, 217, 133, 0, 4, 217,
+    129, 217, 137, 0, 4, 217, 129, 217, 138, 0, 4, 217, 130, 216, 173, 0,
+    4, 217, 130, 217, 133, 0, 4, 217, 130, 217, 137, 0, 4, 217, 130, 217,
+    138, 0, 4, 217, 131, 216, 167, 0, 4, 217, 131, 216, 172, 0, 4, 217,
+    131, 216, 173, 0, 4, 217, 131, 216, 174, 0, 4, 217, 131, 217, 132, 0,
+    4, 217, 131, 217, 133, 0, 4, 217, 131, 217, 137, 0, 4, 217, 131, 217,
+    138, 0, 4, 217, 132, 216, 172, 0, 4, 217, 132, 216, 173, 0, 4, 217,
+    132, 216, 174, 0, 4, 217, 132, 217, 133, 0, 4, 217, 132, 217, 137, 0,
+    4, 217, 132, 217, 138, 0, 4, 217, 133, 216, 172, 0, 4, 217, 133, 216,
+    173, 0, 4, 217, 133, 216, 174, 0, 4, 217, 133, 217, 133, 0, 4, 217,
+    133, 217, 137, 0, 4, 217, 133, 217, 138, 0, 4, 217, 134, 216, 172, 0,
+    4, 217, 134, 216, 173, 0, 4, 217, 134, 216, 174, 0, 4, 217, 134, 217,
+    133, 0, 4, 217, 134, 217, 137, 0, 4, 217, 134, 217, 138, 0, 4, 217,
+    135, 216, 172, 0, 4, 217, 135, 217, 133, 0, 4, 217, 135, 217, 137, 0,
+    4, 217, 135, 217, 138, 0, 4, 217, 138, 216, 172, 0, 4, 217, 138, 216,
+    173, 0, 4, 217, 138, 216, 174, 0, 4, 217, 138, 217, 133, 0, 4, 217,
+    138, 217, 137, 0, 4, 217, 138, 217, 138, 0, 4, 216, 176, 217, 176, 0,
+    4, 216, 177, 217, 176, 0, 4, 217, 137, 217, 176, 0, 5, 32, 217, 140,
+    217, 145, 0, 5, 32, 217, 141, 217, 145, 0, 5, 32, 217, 142, 217, 145,
+    0, 5, 32, 217, 143, 217, 145, 0, 5, 32, 217, 144, 217, 145, 0, 5,
+    32, 217, 145, 217, 176, 0, 6, 217, 138, 217, 148, 216, 177, 0, 6, 217,
+    138, 217, 148, 216, 178, 0, 6, 217, 138, 217, 148, 217, 134, 0, 4, 216,
+    168, 216, 177, 0, 4, 216, 168, 216, 178, 0, 4, 216, 168, 217, 134, 0,
+    4, 216, 170, 216, 177, 0, 4, 216, 170, 216, 178, 0, 4, 216, 170, 217,
+    134, 0, 4, 216, 171, 216, 177, 0, 4, 216, 171, 216, 178, 0, 4, 216,
+    171, 217, 134, 0, 4, 217, 133, 216, 167, 0, 4, 217, 134, 216, 177, 0,
+    4, 217, 134, 216, 178, 0, 4, 217, 134, 217, 134, 0, 4, 217, 138, 216,
+    177, 0, 4, 217, 138, 216, 178, 0, 4, 217, 138, 217, 134, 0, 6, 217,
+    138, 217, 148, 216, 174, 0, 6, 217, 138, 217, 148, 217, 135, 0, 4, 216,
+    168, 217, 135, 0, 4, 216, 170, 217, 135, 0, 4, 216, 181, 216, 174, 0,
+    4, 217, 132, 217, 135, 0, 4, 217, 134, 217, 135, 0, 4, 217, 135, 217,
+    176, 0, 4, 217, 138, 217, 135, 0, 4, 216, 171, 217, 135, 0, 4, 216,
+    179, 217, 135, 0, 4, 216, 180, 217, 133, 0, 4, 216, 180, 217, 135, 0,
+    6, 217, 128, 217, 142, 217, 145, 0, 6, 217, 128, 217, 143, 217, 145, 0,
+    6, 217, 128, 217, 144, 217, 145, 0, 4, 216, 183, 217, 137, 0, 4, 216,
+    183, 217, 138, 0, 4, 216, 185, 217, 137, 0, 4, 216, 185, 217, 138, 0,
+    4, 216, 186, 217, 137, 0, 4, 216, 186, 217, 138, 0, 4, 216, 179, 217,
+    137, 0, 4, 216, 179, 217, 138, 0, 4, 216, 180, 217, 137, 0, 4, 216,
+    180, 217, 138, 0, 4, 216, 173, 217, 137, 0, 4, 216, 173, 217, 138, 0,
+    4, 216, 172, 217, 137, 0, 4, 216, 172, 217, 138, 0, 4, 216, 174, 217,
+    137, 0, 4, 216, 174, 217, 138, 0, 4, 216, 181, 217, 137, 0, 4, 216,
+    181, 217, 138, 0, 4, 216, 182, 217, 137, 0, 4, 216, 182, 217, 138, 0,
+    4, 216, 180, 216, 172, 0, 4, 216, 180, 216, 173, 0, 4, 216, 180, 216,
+    174, 0, 4, 216, 180, 216, 177, 0, 4, 216, 179, 216, 177, 0, 4, 216,
+    181, 216, 177, 0, 4, 216, 182, 216, 177, 0, 4, 216, 167, 217, 139, 0,
+    6, 216, 170, 216, 172, 217, 133, 0, 6, 216, 170, 216, 173, 216, 172, 0,
+    6, 216, 170, 216, 173, 217, 133, 0, 6, 216, 170, 216, 174, 217, 133, 0,
+    6, 216, 170, 217, 133, 216, 172, 0, 6, 216, 170, 217, 133, 216, 173, 0,
+    6, 216, 170, 217, 133, 216, 174, 0, 6, 216, 172, 217, 133, 216, 173, 0,
+    6, 216, 173, 217, 133, 217, 138, 0, 6, 216, 173, 217, 133, 217, 137, 0,
+    6, 216, 179, 216, 173, 216, 172, 0, 6, 216, 179, 216, 172, 216, 173, 0,
+    6, 216, 179, 216, 172, 217, 137, 0, 6, 216, 179, 217, 133, 216, 173, 0,
+    6, 216, 179, 217, 133, 216, 172, 0, 6, 216, 179, 217, 133, 217, 133, 0,
+    6, 216, 181, 216, 173, 216, 173, 0, 6, 216, 181, 217, 133, 217, 133, 0,
+    6, 216, 180, 216, 173, 217, 133, 0, 6, 216, 180, 216, 172, 217, 138, 0,
+    6, 216, 180, 217, 133, 216, 174, 0, 6, 216, 180, 217, 133, 217, 133, 0,
+    6, 216, 182, 216, 173, 217, 137, 0, 6, 216, 182, 216, 174, 217, 133, 0,
+    6, 216, 183, 217, 133, 216, 173, 0, 6, 216, 183, 217, 133, 217, 133, 0,
+    6, 216, 183, 217, 133, 217, 138, 0, 6, 216, 185, 216, 172, 217, 133, 0,
+    6, 216, 185, 217, 133, 217, 133, 0, 6, 216, 185, 217, 133, 217, 137, 0,
+    6, 216, 186, 217, 133, 217, 133, 0, 6, 216, 186, 217, 133, 217, 138, 0,
+    6, 216, 186, 217, 133, 217, 137, 0, 6, 217, 129, 216, 174, 217, 133, 0,
+    6, 217, 130, 217, 133, 216, 173, 0, 6, 217, 130, 217, 133, 217, 133, 0,
+    6, 217, 132, 216, 173, 217, 133, 0, 6, 217, 132, 216, 173, 217, 138, 0,
+    6, 217, 132, 216, 173, 217, 137, 0, 6, 217, 132, 216, 172, 216, 172, 0,
+    6, 217, 132, 216, 174, 217, 133, 0, 6, 217, 132, 217, 133, 216, 173, 0,
+    6, 217, 133, 216, 173, 216, 172, 0, 6, 217, 133, 216, 173, 217, 133, 0,
+    6, 217, 133, 216, 173, 217, 138, 0, 6, 217, 133, 216, 172, 216, 173, 0,
+    6, 217, 133, 216, 172, 217, 133, 0, 6, 217, 133, 216, 174, 216, 172, 0,
+    6, 217, 133, 216, 174, 217, 133, 0, 6, 217, 133, 216, 172, 216, 174, 0,
+    6, 217, 135, 217, 133, 216, 172, 0, 6, 217, 135, 217, 133, 217, 133, 0,
+    6, 217, 134, 216, 173, 217, 133, 0, 6, 217, 134, 216, 173, 217, 137, 0,
+    6, 217, 134, 216, 172, 217, 133, 0, 6, 217, 134, 216, 172, 217, 137, 0,
+    6, 217, 134, 217, 133, 217, 138, 0, 6, 217, 134, 217, 133, 217, 137, 0,
+    6, 217, 138, 217, 133, 217, 133, 0, 6, 216, 168, 216, 174, 217, 138, 0,
+    6, 216, 170, 216, 172, 217, 138, 0, 6, 216, 170, 216, 172, 217, 137, 0,
+    6, 216, 170, 216, 174, 217, 138, 0, 6, 216, 170, 216, 174, 217, 137, 0,
+    6, 216, 170, 217, 133, 217, 138, 0, 6, 216, 170, 217, 133, 217, 137, 0,
+    6, 216, 172, 217, 133, 217, 138, 0, 6, 216, 172, 216, 173, 217, 137, 0,
+    6, 216, 172, 217, 133, 217, 137, 0, 6, 216, 179, 216, 174, 217, 137, 0,
+    6, 216, 181, 216, 173, 217, 138, 0, 6, 216, 180, 216, 173, 217, 138, 0,
+    6, 216, 182, 216, 173, 217, 138, 0, 6, 217, 132, 216, 172, 217, 138, 0,
+    6, 217, 132, 217, 133, 217, 138, 0, 6, 217, 138, 216, 173, 217, 138, 0,
+    6, 217, 138, 216, 172, 217, 138, 0, 6, 217, 138, 217, 133, 217, 138, 0,
+    6, 217, 133, 217, 133, 217, 138, 0, 6, 217, 130, 217, 133, 217, 138, 0,
+    6, 217, 134, 216, 173, 217, 138, 0, 6, 216, 185, 217, 133, 217, 138, 0,
+    6, 217, 131, 217, 133, 217, 138, 0, 6, 217, 134, 216, 172, 216, 173, 0,
+    6, 217, 133, 216, 174, 217, 138, 0, 6, 217, 132, 216, 172, 217, 133, 0,
+    6, 217, 131, 217, 133, 217, 133, 0, 6, 216, 172, 216, 173, 217, 138, 0,
+    6, 216, 173, 216, 172, 217, 138, 0, 6, 217, 133, 216, 172, 217, 138, 0,
+    6, 217, 129, 217, 133, 217, 138, 0, 6, 216, 168, 216, 173, 217, 138, 0,
+    6, 216, 179, 216, 174, 217, 138, 0, 6, 217, 134, 216, 172, 217, 138, 0,
+    6, 216, 181, 217, 132, 219, 146, 0, 6, 217, 130, 217, 132, 219, 146, 0,
+    8, 216, 167, 217, 132, 217, 132, 217, 135, 0, 8, 216, 167, 217, 131, 216,
+    168, 216, 177, 0, 8, 217, 133, 216, 173, 217, 133, 216, 175, 0, 8, 216,
+    181, 217, 132, 216, 185, 217, 133, 0, 8, 216, 177, 216, 179, 217, 136, 217,
+    132, 0, 8, 216, 185, 217, 132, 217, 138, 217, 135, 0, 8, 217, 136, 216,
+    179, 217, 132, 217, 133, 0, 6, 216, 181, 217, 132, 217, 137, 0, 33, 216,
+    181, 217, 132, 217, 137, 32, 216, 167, 217, 132, 217, 132, 217, 135, 32, 216,
+    185, 217, 132, 217, 138, 217, 135, 32, 217, 136, 216, 179, 217, 132, 217, 133,
+    0, 15, 216, 172, 217, 132, 32, 216, 172, 217, 132, 216, 167, 217, 132, 217,
+    135, 0, 8, 216, 177, 219, 140, 216, 167, 217, 132, 0, 1, 44, 0, 3,
+    227, 128, 129, 0, 3, 227, 128, 130, 0, 1, 58, 0, 1, 59, 0, 1,
+    33, 0, 1, 63, 0, 3, 227, 128, 150, 0, 3, 227, 128, 151, 0, 3,
+    226, 128, 148, 0, 3, 226, 128, 147, 0, 1, 95, 0, 1, 123, 0, 1,
+    125, 0, 3, 227, 128, 148, 0, 3, 227, 128, 149, 0, 3, 227, 128, 144,
+    0, 3, 227, 128, 145, 0, 3, 227, 128, 138, 0, 3, 227, 128, 139, 0,
+    3, 227, 128, 136, 0, 3, 227, 128, 137, 0, 3, 227, 128, 140, 0, 3,
+    227, 128, 141, 0, 3, 227, 128, 142, 0, 3, 227, 128, 143, 0, 1, 91,
+    0, 1, 93, 0, 1, 35, 0, 1, 38, 0, 1, 42, 0, 1, 45, 0,
+    1, 60, 0, 1, 62, 0, 1, 92, 0, 1, 36, 0, 1, 37, 0, 1,
+    64, 0, 3, 32, 217, 139, 0, 4, 217, 128, 217, 139, 0, 3, 32, 217,
+    140, 0, 3, 32, 217, 141, 0, 3, 32, 217, 142, 0, 4, 217, 128, 217,
+    142, 0, 3, 32, 217, 143, 0, 4, 217, 128, 217, 143, 0, 3, 32, 217,
+    144, 0, 4, 217, 128, 217, 144, 0, 3, 32, 217, 145, 0, 4, 217, 128,
+    217, 145, 0, 3, 32, 217, 146, 0, 4, 217, 128, 217, 146, 0, 2, 216,
+    161, 0, 4, 216, 167, 217, 147, 0, 4, 216, 167, 217, 148, 0, 4, 217,
+    136, 217, 148, 0, 4, 216, 167, 217, 149, 0, 4, 217, 138, 217, 148, 0,
+    2, 216, 167, 0, 2, 216, 168, 0, 2, 216, 169, 0, 2, 216, 170, 0,
+    2, 216, 171, 0, 2, 216, 172, 0, 2, 216, 173, 0, 2, 216, 174, 0,
+    2, 216, 175, 0, 2, 216, 176, 0, 2, 216, 177, 0, 2, 216, 178, 0,
+    2, 216, 179, 0, 2, 216, 180, 0, 2, 216, 181, 0, 2, 216, 182, 0,
+    2, 216, 183, 0, 2, 216, 184, 0, 2, 216, 185, 0, 2, 216, 186, 0,
+    2, 217, 129, 0, 2, 217, 130, 0, 2, 217, 131, 0, 2, 217, 132, 0,
+    2, 217, 133, 0, 2, 217, 134, 0, 2, 217, 135, 0, 2, 217, 136, 0,
+    2, 217, 138, 0, 6, 217, 132, 216, 167, 217, 147, 0, 6, 217, 132, 216,
+    167, 217, 148, 0, 6, 217, 132, 216, 167, 217, 149, 0, 4, 217, 132, 216,
+    167, 0, 1, 34, 0, 1, 39, 0, 1, 47, 0, 1, 94, 0, 1, 96,
+    0, 1, 124, 0, 1, 126, 0, 3, 226, 166, 133, 0, 3, 226, 166, 134,
+    0, 3, 227, 131, 187, 0, 3, 227, 130, 161, 0, 3, 227, 130, 163, 0,
+    3, 227, 130, 165, 0, 3, 227, 130, 167, 0, 3, 227, 130, 169, 0, 3,
+    227, 131, 163, 0, 3, 227, 131, 165, 0, 3, 227, 131, 167, 0, 3, 227,
+    131, 131, 0, 3, 227, 131, 188, 0, 3, 227, 131, 179, 0, 3, 227, 130,
+    153, 0, 3, 227, 130, 154, 0, 2, 194, 162, 0, 2, 194, 163, 0, 2,
+    194, 172, 0, 2, 194, 166, 0, 2, 194, 165, 0, 3, 226, 130, 169, 0,
+    3, 226, 148, 130, 0, 3, 226, 134, 144, 0, 3, 226, 134, 145, 0, 3,
+    226, 134, 146, 0, 3, 226, 134, 147, 0, 3, 226, 150, 160, 0, 3, 226,
+    151, 139, 0, 2, 203, 144, 0, 2, 203, 145, 0, 2, 195, 166, 0, 2,
+    202, 153, 0, 2, 201, 147, 0, 2, 202, 163, 0, 3, 234, 173, 166, 0,
+    2, 202, 165, 0, 2, 202, 164, 0, 2, 201, 150, 0, 2, 201, 151, 0,
+    3, 225, 182, 145, 0, 2, 201, 152, 0, 2, 201, 158, 0, 2, 202, 169,
+    0, 2, 201, 164, 0, 2, 201, 162, 0, 2, 201, 160, 0, 2, 202, 155,
+    0, 2, 202, 156, 0, 2, 201, 167, 0, 2, 202, 132, 0, 2, 202, 170,
+    0, 2, 202, 171, 0, 2, 201, 172, 0, 4, 240, 157, 188, 132, 0, 3,
+    234, 158, 142, 0, 2, 201, 174, 0, 4, 240, 157, 188, 133, 0, 2, 202,
+    142, 0, 4, 240, 157, 188, 134, 0, 2, 195, 184, 0, 2, 201, 182, 0,
+    2, 201, 183, 0, 2, 201, 186, 0, 4, 240, 157, 188, 136, 0, 2, 201,
+    189, 0, 2, 201, 190, 0, 2, 202, 128, 0, 2, 202, 168, 0, 2, 202,
+    166, 0, 3, 234, 173, 167, 0, 2, 202, 167, 0, 2, 202, 136, 0, 3,
+    226, 177, 177, 0, 2, 202, 143, 0, 2, 202, 161, 0, 2, 202, 162, 0,
+    2, 202, 152, 0, 2, 199, 128, 0, 2, 199, 129, 0, 2, 199, 130, 0,
+    4, 240, 157, 188, 138, 0, 4, 240, 157, 188, 158, 8, 0, 240, 145, 130,
+    153, 240, 145, 130, 186, 8, 0, 240, 145, 130, 155, 240, 145, 130, 186, 8,
+    0, 240, 145, 130, 165, 240, 145, 130, 186, 8, 0, 240, 145, 132, 177, 240,
+    145, 132, 167, 8, 0, 240, 145, 132, 178, 240, 145, 132, 167, 8, 0, 240,
+    145, 141, 135, 240, 145, 140, 190, 8, 0, 240, 145, 141, 135, 240, 145, 141,
+    151, 8, 0, 240, 145, 146, 185, 240, 145, 146, 186, 8, 0, 240, 145, 146,
+    185, 240, 145, 146, 176, 8, 0, 240, 145, 146, 185, 240, 145, 146, 189, 8,
+    0, 240, 145, 150, 184, 240, 145, 150, 175, 8, 0, 240, 145, 150, 185, 240,
+    145, 150, 175, 8, 0, 240, 145, 164, 181, 240, 145, 164, 176, 8, 0, 240,
+    157, 133, 151, 240, 157, 133, 165, 8, 0, 240, 157, 133, 152, 240, 157, 133,
+    165, 12, 0, 240, 157, 133, 152, 240, 157, 133, 165, 240, 157, 133, 174, 12,
+    0, 240, 157, 133, 152, 240, 157, 133, 165, 240, 157, 133, 175, 12, 0, 240,
+    157, 133, 152, 240, 157, 133, 165, 240, 157, 133, 176, 12, 0, 240, 157, 133,
+    152, 240, 157, 133, 165, 240, 157, 133, 177, 12, 0, 240, 157, 133, 152, 240,
+    157, 133, 165, 240, 157, 133, 178, 8, 0, 240, 157, 134, 185, 240, 157, 133,
+    165, 8, 0, 240, 157, 134, 186, 240, 157, 133, 165, 12, 0, 240, 157, 134,
+    185, 240, 157, 133, 165, 240, 157, 133, 174, 12, 0, 240, 157, 134, 186, 240,
+    157, 133, 165, 240, 157, 133, 174, 12, 0, 240, 157, 134, 185, 240, 157, 133,
+    165, 240, 157, 133, 175, 12, 0, 240, 157, 134, 186, 240, 157, 133, 165, 240,
+    157, 133, 175, 0, 2, 196, 177, 0, 2, 200, 183, 0, 2, 206, 145, 0,
+    2, 206, 146, 0, 2, 206, 148, 0, 2, 206, 149, 0, 2, 206, 150, 0,
+    2, 206, 151, 0, 2, 206, 153, 0, 2, 206, 154, 0, 2, 206, 155, 0,
+    2, 206, 156, 0, 2, 206, 157, 0, 2, 206, 158, 0, 2, 206, 159, 0,
+    2, 206, 161, 0, 2, 206, 164, 0, 2, 206, 166, 0, 2, 206, 167, 0,
+    2, 206, 168, 0, 2, 206, 169, 0, 3, 226, 136, 135, 0, 2, 206, 177,
+    0, 2, 206, 182, 0, 2, 206, 183, 0, 2, 206, 185, 0, 2, 206, 187,
+    0, 2, 206, 189, 0, 2, 206, 190, 0, 2, 206, 191, 0, 2, 207, 131,
+    0, 2, 207, 132, 0, 2, 207, 133, 0, 2, 207, 136, 0, 2, 207, 137,
+    0, 3, 226, 136, 130, 0, 2, 207, 156, 0, 2, 207, 157, 0, 2, 217,
+    174, 0, 2, 218, 161, 0, 2, 217, 175, 0, 2, 48, 46, 0, 2, 48,
+    44, 0, 2, 49, 44, 0, 2, 50, 44, 0, 2, 51, 44, 0, 2, 52,
+    44, 0, 2, 53, 44, 0, 2, 54, 44, 0, 2, 55, 44, 0, 2, 56,
+    44, 0, 2, 57, 44, 0, 3, 40, 65, 41, 0, 3, 40, 66, 41, 0,
+    3, 40, 67, 41, 0, 3, 40, 68, 41, 0, 3, 40, 69, 41, 0, 3,
+    40, 70, 41, 0, 3, 40, 71, 41, 0, 3, 40, 72, 41, 0, 3, 40,
+    73, 41, 0, 3, 40, 74, 41, 0, 3, 40, 75, 41, 0, 3, 40, 76,
+    41, 0, 3, 40, 77, 41, 0, 3, 40, 78, 41, 0, 3, 40, 79, 41,
+    0, 3, 40, 80, 41, 0, 3, 40, 81, 41, 0, 3, 40, 82, 41, 0,
+    3, 40, 83, 41, 0, 3, 40, 84, 41, 0, 3, 40, 85, 41, 0, 3,
+    40, 86, 41, 0, 3, 40, 87, 41, 0, 3, 40, 88, 41, 0, 3, 40,
+    89, 41, 0, 3, 40, 90, 41, 0, 7, 227, 128, 148, 83, 227, 128, 149,
+    0, 2, 67, 68, 0, 2, 87, 90, 0, 2, 72, 86, 0, 2, 83, 68,
+    0, 2, 83, 83, 0, 3, 80, 80, 86, 0, 2, 87, 67, 0, 2, 77,
+    67, 0, 2, 77, 68, 0, 2, 77, 82, 0, 2, 68, 74, 0, 6, 227,
+    129, 187, 227, 129, 139, 0, 6, 227, 130, 179, 227, 130, 179, 0, 3, 229,
+    173, 151, 0, 3, 229, 143, 140, 0, 6, 227, 131, 134, 227, 130, 153, 0,
+    3, 229, 164, 154, 0, 3, 232, 167, 163, 0, 3, 228, 186, 164, 0, 3,
+    230, 152, 160, 0, 3, 231, 132, 161, 0, 3, 230, 150, 153, 0, 3, 229,
+    137, 141, 0, 3, 229, 190, 140, 0, 3, 229, 134, 141, 0, 3, 230, 150,
+    176, 0, 3, 229, 136, 157, 0, 3, 231, 181, 130, 0, 3, 232, 178, 169,
+    0, 3, 229, 163, 176, 0, 3, 229, 144, 185, 0, 3, 230, 188, 148, 0,
+    3, 230, 138, 149, 0, 3, 230, 141, 149, 0, 3, 233, 129, 138, 0, 3,
+    230, 140, 135, 0, 3, 230, 137, 147, 0, 3, 231, 166, 129, 0, 3, 231,
+    169, 186, 0, 3, 229, 144, 136, 0, 3, 230, 186, 128, 0, 3, 231, 148,
+    179, 0, 3, 229, 137, 178, 0, 3, 229, 150, 182, 0, 3, 233, 133, 141,
+    0, 9, 227, 128, 148, 230, 156, 172, 227, 128, 149, 0, 9, 227, 128, 148,
+    228, 184, 137, 227, 128, 149, 0, 9, 227, 128, 148, 228, 186, 140, 227, 128,
+    149, 0, 9, 227, 128, 148, 229, 174, 137, 227, 128, 149, 0, 9, 227, 128,
+    148, 231, 130, 185, 227, 128, 149, 0, 9, 227, 128, 148, 230, 137, 147, 227,
+    128, 149, 0, 9, 227, 128, 148, 231, 155, 151, 227, 128, 149, 0, 9, 227,
+    128, 148, 229, 139, 157, 227, 128, 149, 0, 9, 227, 128, 148, 230, 149, 151,
+    227, 128, 149, 0, 3, 229, 190, 151, 0, 3, 229, 143, 175, 3, 0, 228,
+    184, 189, 3, 0, 228, 184, 184, 3, 0, 228, 185, 129, 4, 0, 240, 160,
+    132, 162, 3, 0, 228, 189, 160, 3, 0, 228, 190, 187, 3, 0, 229, 128,
+    130, 3, 0, 229, 129, 186, 3, 0, 229, 130, 153, 3, 0, 229, 131, 143,
+    3, 0, 227, 146, 158, 4, 0, 240, 160, 152, 186, 3, 0, 229, 133, 148,
+    3, 0, 229, 133, 164, 3, 0, 229, 133, 183, 4, 0, 240, 160, 148, 156,
+    3, 0, 227, 146, 185, 3, 0, 229, 133, 167, 3, 0, 229, 134, 141, 4,
+    0, 240, 160, 149, 139, 3, 0, 229, 134, 151, 3, 0, 229, 134, 164, 3,
+    0, 228, 187, 140, 3, 0, 229, 134, 172, 4, 0, 240, 169, 135, 159, 3,
+    0, 229, 135, 181, 3, 0, 229, 136, 131, 3, 0, 227, 147, 159, 3, 0,
+    229, 136, 187, 3, 0, 229, 137, 134, 3, 0, 229, 137, 178, 3, 0, 229,
+    137, 183, 3, 0, 227, 148, 149, 3, 0, 229, 140, 133, 3, 0, 229, 140,
+    134, 3, 0, 229, 141, 137, 3, 0, 229, 141, 154, 3, 0, 229, 141, 179,
+    3, 0, 229, 141, 189, 3, 0, 229, 141, 191, 4, 0, 240, 160, 168, 172,
+    3, 0, 231, 129, 176, 3, 0, 229, 143, 138, 3, 0, 229, 143, 159, 4,
+    0, 240, 160, 173, 163, 3, 0, 229, 143, 171, 3, 0, 229, 143, 177, 3,
+    0, 229, 144, 134, 3, 0, 229, 146, 158, 3, 0, 229, 144, 184, 3, 0,
+    229, 145, 136, 3, 0, 229, 145, 168, 3, 0, 229, 146, 162, 3, 0, 229,
+    147, 182, 3, 0, 229, 148, 144, 3, 0, 229, 149, 147, 3, 0, 229, 149,
+    163, 3, 0, 229, 150, 132, 3, 0, 229, 150, 171, 3, 0, 229, 150, 179,
+    3, 0, 229, 151, 130, 3, 0, 229, 156, 150, 3, 0, 229, 156, 151, 3,
+    0, 229, 153, 145, 3, 0, 229, 153, 180, 3, 0, 229, 163, 174, 3, 0,
+    229, 159, 142, 3, 0, 229, 159, 180, 3, 0, 229, 160, 141, 3, 0, 229,
+    158, 139, 3, 0, 229, 160, 178, 3, 0, 229, 160, 177, 3, 0, 229, 162,
+    172, 4, 0, 240, 161, 147, 164, 3, 0, 229, 163, 178, 3, 0, 229, 163,
+    183, 3, 0, 229, 164, 134, 3, 0, 229, 164, 154, 3, 0, 229, 164, 162,
+    3, 0, 229, 165, 162, 4, 0, 240, 161, 154, 168, 4, 0, 240, 161, 155,
+    170, 3, 0, 229, 167, 172, 3, 0, 229, 168, 155, 3, 0, 229, 168, 167,
+    3, 0, 229, 167, 152, 3, 0, 229, 169, 166, 3, 0, 227, 155, 174, 3,
+    0, 227, 155, 188, 3, 0, 229, 172, 136, 3, 0, 229, 172, 190, 4, 0,
+    240, 161, 167, 136, 3, 0, 229, 175, 131, 3, 0, 229, 175, 152, 3, 0,
+    229, 175, 179, 4, 0, 240, 161, 172, 152, 3, 0, 229, 175, 191, 3, 0,
+    229, 176, 134, 3, 0, 229, 189, 147, 3, 0, 229, 176, 162, 3, 0, 227,
+    158, 129, 3, 0, 229, 177, 160, 3, 0, 229, 179, 128, 3, 0, 229, 178,
+    141, 4, 0, 240, 161, 183, 164, 3, 0, 229, 181, 131, 4, 0, 240, 161,
+    183, 166, 3, 0, 229, 181, 174, 3, 0, 229, 181, 171, 3, 0, 229, 181,
+    188, 3, 0, 229, 183, 161, 3, 0, 229, 183, 162, 3, 0, 227, 160, 175,
+    3, 0, 229, 183, 189, 3, 0, 229, 184, 168, 3, 0, 229, 184, 189, 3,
+    0, 229, 185, 169, 3, 0, 227, 161, 162, 4, 0, 240, 162, 134, 131, 3,
+    0, 227, 161, 188, 3, 0, 229, 186, 176, 3, 0, 229, 186, 179, 3, 0,
+    229, 186, 182, 4, 0, 240, 170, 142, 146, 3, 0, 229, 187, 190, 4, 0,
+    240, 162, 140, 177, 3, 0, 232, 136, 129, 3, 0, 229, 188, 162, 3, 0,
+    227, 163, 135, 4, 0, 240, 163, 138, 184, 4, 0, 240, 166, 135, 154, 3,
+    0, 229, 189, 162, 3, 0, 229, 189, 171, 3, 0, 227, 163, 163, 3, 0,
+    229, 190, 154, 3, 0, 229, 191, 141, 3, 0, 229, 191, 151, 3, 0, 229,
+    191, 185, 3, 0, 230, 130, 129, 3, 0, 227, 164, 186, 3, 0, 227, 164,
+    156, 4, 0, 240, 162, 155, 148, 3, 0, 230, 131, 135, 3, 0, 230, 133,
+    136, 3, 0, 230, 133, 140, 3, 0, 230, 133, 186, 3, 0, 230, 134, 178,
+    3, 0, 230, 134, 164, 3, 0, 230, 134, 175, 3, 0, 230, 135, 158, 3,
+    0, 230, 136, 144, 3, 0, 230, 136, 155, 3, 0, 230, 137, 157, 3, 0,
+    230, 138, 177, 3, 0, 230, 139, 148, 3, 0, 230, 141, 144, 4, 0, 240,
+    162, 172, 140, 3, 0, 230, 140, 189, 3, 0, 230, 139, 188, 3, 0, 230,
+    141, 168, 3, 0, 230, 142, 131, 3, 0, 230, 143, 164, 4, 0, 240, 162,
+    175, 177, 3, 0, 230, 144, 162, 3, 0, 230, 143, 133, 3, 0, 230, 142,
+    169, 3, 0, 227, 168, 174, 3, 0, 230, 145, 169, 3, 0, 230, 145, 190,
+    3, 0, 230, 146, 157, 3, 0, 230, 145, 183, 3, 0, 227, 169, 172, 3,
+    0, 230, 149, 172, 4, 0, 240, 163, 128, 138, 3, 0, 230, 151, 163, 3,
+    0, 230, 155, 184, 3, 0, 230, 153, 137, 3, 0, 227, 172, 153, 3, 0,
+    227, 172, 136, 3, 0, 227, 171, 164, 3, 0, 229, 134, 146, 3, 0, 229,
+    134, 149, 3, 0, 230, 156, 128, 3, 0, 230, 154, 156, 3, 0, 232, 130,
+    173, 3, 0, 228, 143, 153, 3, 0, 230, 156, 161, 3, 0, 230, 157, 158,
+    3, 0, 230, 157, 147, 4, 0, 240, 163, 143, 131, 3, 0, 227, 173, 137,
+    3, 0, 230, 159, 186, 3, 0, 230, 158, 133, 3, 0, 230, 161, 146, 4,
+    0, 240, 163, 145, 173, 3, 0, 230, 162, 142, 3, 0, 230, 160, 159, 3,
+    0, 230, 164, 148, 3, 0, 230, 165, 130, 3, 0, 230, 166, 163, 3, 0,
+    230, 167, 170, 3, 0, 230, 170, 168, 4, 0, 240, 163, 154, 163, 3, 0,
+    230, 171, 155, 3, 0, 227, 176, 152, 3, 0, 230, 172, 161, 4, 0, 240,
+    163, 162, 167, 3, 0, 230, 173, 148, 3, 0, 227, 177, 142, 3, 0, 230,
+    173, 178, 3, 0, 230, 174, 159, 3, 0, 230, 174, 187, 4, 0, 240, 163,
+    170, 141, 4, 0, 240, 161, 180, 139, 4, 0, 240, 163, 171, 186, 3, 0,
+    230, 177, 142, 4, 0, 240, 163, 178, 188, 3, 0, 230, 178, 191, 3, 0,
+    230, 179, 141, 3, 0, 230, 177, 167, 3, 0, 230, 180, 150, 3, 0, 230,
+    180, 190, 3, 0, 230, 181, 169, 3, 0, 230, 181, 184, 3, 0, 230, 182,
+    133, 4, 0, 240, 163, 180, 158, 3, 0, 230, 180, 180, 3, 0, 230, 184,
+    175, 3, 0, 230, 185, 174, 3, 0, 227, 180, 179, 3, 0, 230, 187, 135,
+    4, 0, 240, 163, 187, 145, 3, 0, 230, 183, 185, 3, 0, 230, 189, 174,
+    4, 0, 240, 163, 189, 158, 4, 0, 240, 163, 190, 142, 3, 0, 230, 191,
+    134, 3, 0, 231, 128, 185, 3, 0, 231, 128, 155, 3, 0, 227, 182, 150,
+    3, 0, 231, 129, 138, 3, 0, 231, 129, 189, 3, 0, 231, 129, 183, 3,
+    0, 231, 130, 173, 4, 0, 240, 160, 148, 165, 3, 0, 231, 133, 133, 4,
+    0, 240, 164, 137, 163, 3, 0, 231, 134, 156, 4, 0, 240, 164, 142, 171,
+    3, 0, 231, 136, 168, 3, 0, 231, 137, 144, 4, 0, 240, 164, 152, 136,
+    3, 0, 231, 138, 128, 3, 0, 231, 138, 149, 4, 0, 240, 164, 156, 181,
+    4, 0, 240, 164, 160, 148, 3, 0, 231, 141, 186, 3, 0, 231, 142, 139,
+    3, 0, 227, 186, 172, 3, 0, 231, 142, 165, 3, 0, 227, 186, 184, 3,
+    0, 231, 145, 135, 3, 0, 231, 145, 156, 3, 0, 231, 146, 133, 3, 0,
+    231, 147, 138, 3, 0, 227, 188, 155, 3, 0, 231, 148, 164, 4, 0, 240,
+    164, 176, 182, 3, 0, 231, 148, 190, 4, 0, 240, 164, 178, 146, 4, 0,
+    240, 162, 134, 159, 3, 0, 231, 152, 144, 4, 0, 240, 164, 190, 161, 4,
+    0, 240, 164, 190, 184, 4, 0, 240, 165, 129, 132, 3, 0, 227, 191, 188,
+    3, 0, 228, 128, 136, 4, 0, 240, 165, 131, 179, 4, 0, 240, 165, 131,
+    178, 4, 0, 240, 165, 132, 153, 4, 0, 240, 165, 132, 179, 3, 0, 231,
+    156, 158, 3, 0, 231, 156, 159, 3, 0, 231, 158, 139, 3, 0, 228, 129,
+    134, 3, 0, 228, 130, 150, 4, 0, 240, 165, 144, 157, 3, 0, 231, 161,
+    142, 3, 0, 228, 131, 163, 4, 0, 240, 165, 152, 166, 4, 0, 240, 165,
+    154, 154, 4, 0, 240, 165, 155, 133, 3, 0, 231, 167, 171, 3, 0, 228,
+    132, 175, 3, 0, 231, 169, 138, 3, 0, 231, 169, 143, 4, 0, 240, 165,
+    165, 188, 4, 0, 240, 165, 170, 167, 3, 0, 231, 171, 174, 3, 0, 228,
+    136, 130, 4, 0, 240, 165, 174, 171, 3, 0, 231, 175, 134, 3, 0, 231,
+    175, 137, 3, 0, 228, 136, 167, 4, 0, 240, 165, 178, 128, 3, 0, 231,
+    179, 146, 3, 0, 228, 138, 160, 3, 0, 231, 179, 168, 3, 0, 231, 179,
+    163, 3, 0, 231, 180, 128, 4, 0, 240, 165, 190, 134, 3, 0, 231, 181,
+    163, 3, 0, 228, 140, 129, 3, 0, 231, 183, 135, 3, 0, 231, 184, 130,
+    3, 0, 231, 185, 133, 3, 0, 228, 140, 180, 4, 0, 240, 166, 136, 168,
+    4, 0, 240, 166, 137, 135, 3, 0, 228, 141, 153, 4, 0, 240, 166, 139,
+    153, 3, 0, 231, 189, 186, 4, 0, 240, 166, 140, 190, 3, 0, 231, 190,
+    149, 3, 0, 231, 191, 186, 4, 0, 240, 166, 147, 154, 4, 0, 240, 166,
+    148, 163, 3, 0, 232, 129, 160, 4, 0, 240, 166, 150, 168, 3, 0, 232,
+    129, 176, 4, 0, 240, 163, 141, 159, 3, 0, 228, 143, 149, 3, 0, 232,
+    130, 178, 3, 0, 232, 132, 131, 3, 0, 228, 144, 139, 3, 0, 232, 132,
+    190, 3, 0, 229, 170, 181, 4, 0, 240, 166, 158, 167, 4, 0, 240, 166,
+    158, 181, 4, 0, 240, 163, 142, 147, 4, 0, 240, 163, 142, 156, 3, 0,
+    232, 136, 132, 3, 0, 232, 190, 158, 3, 0, 228, 145, 171, 3, 0, 232,
+    138, 145, 3, 0, 232, 138, 139, 3, 0, 232, 138, 157, 3, 0, 229, 138,
+    179, 3, 0, 232, 138, 177, 3, 0, 232, 138, 179, 3, 0, 232, 138, 189,
+    3, 0, 232, 139, 166, 4, 0, 240, 166, 172, 188, 3, 0, 232, 140, 157,
+    3, 0, 232, 141, 163, 3, 0, 232, 142, 173, 3, 0, 232, 140, 163, 3,
+    0, 232, 142, 189, 3, 0, 232, 143, 167, 3, 0, 232, 141, 147, 3, 0,
+    232, 143, 138, 3, 0, 232, 143, 140, 3, 0, 232, 143, 156, 4, 0, 240,
+    166, 176, 182, 4, 0, 240, 166, 181, 171, 4, 0, 240, 166, 179, 149, 3,
+    0, 228, 148, 171, 3, 0, 232, 147, 177, 3, 0, 232, 147, 179, 3, 0,
+    232, 148, 150, 4, 0, 240, 167, 143, 138, 3, 0, 232, 149, 164, 4, 0,
+    240, 166, 188, 172, 3, 0, 228, 149, 157, 3, 0, 228, 149, 161, 4, 0,
+    240, 166, 190, 177, 4, 0, 240, 167, 131, 146, 3, 0, 228, 149, 171, 3,
+    0, 232, 153, 144, 3, 0, 232, 153, 167, 3, 0, 232, 153, 169, 3, 0,
+    232, 154, 169, 3, 0, 232, 154, 136, 3, 0, 232, 156, 142, 3, 0, 232,
+    155, 162, 3, 0, 232, 156, 168, 3, 0, 232, 157, 171, 3, 0, 232, 158,
+    134, 3, 0, 228, 151, 151, 3, 0, 232, 159, 161, 3, 0, 232, 160, 129,
+    3, 0, 228, 151, 185, 3, 0, 232, 161, 160, 3, 0, 232, 161, 163, 4,
+    0, 240, 167, 153, 167, 3, 0, 232, 163, 151, 3, 0, 232, 163, 158, 3,
+    0, 228, 152, 181, 3, 0, 232, 163, 186, 3, 0, 227, 146, 187, 4, 0,
+    240, 167, 162, 174, 4, 0, 240, 167, 165, 166, 3, 0, 228, 154, 190, 3,
+    0, 228, 155, 135, 3, 0, 232, 170, 160, 3, 0, 232, 177, 149, 4, 0,
+    240, 167, 178, 168, 3, 0, 232, 178, 171, 3, 0, 232, 179, 129, 3, 0,
+    232, 180, 155, 3, 0, 232, 181, 183, 4, 0, 240, 167, 188, 175, 4, 0,
+    240, 160, 160, 132, 3, 0, 232, 183, 139, 3, 0, 232, 182, 188, 3, 0,
+    232, 183, 176, 4, 0, 240, 160, 163, 158, 3, 0, 232, 187, 148, 4, 0,
+    240, 168, 151, 146, 4, 0, 240, 168, 151, 173, 3, 0, 233, 130, 148, 3,
+    0, 233, 131, 177, 3, 0, 233, 132, 145, 4, 0, 240, 168, 156, 174, 3,
+    0, 233, 132, 155, 3, 0, 233, 136, 184, 3, 0, 233, 139, 151, 3, 0,
+    233, 139, 152, 3, 0, 233, 137, 188, 3, 0, 233, 143, 185, 3, 0, 233,
+    144, 149, 4, 0, 240, 168, 175, 186, 3, 0, 233, 150, 139, 3, 0, 228,
+    166, 149, 3, 0, 233, 150, 183, 4, 0, 240, 168, 181, 183, 3, 0, 228,
+    167, 166, 3, 0, 233, 155, 131, 3, 0, 229, 182, 178, 3, 0, 233, 156,
+    163, 4, 0, 240, 169, 133, 133, 4, 0, 240, 169, 136, 154, 3, 0, 228,
+    169, 174, 3, 0, 228, 169, 182, 3, 0, 233, 159, 160, 4, 0, 240, 169,
+    144, 138, 3, 0, 228, 170, 178, 4, 0, 240, 169, 146, 150, 3, 0, 233,
+    160, 169, 4, 0, 240, 169, 150, 182, 3, 0, 233, 163, 162, 3, 0, 228,
+    172, 179, 3, 0, 233, 164, 169, 3, 0, 233, 166, 167, 3, 0, 233, 167,
+    130, 3, 0, 233, 167, 190, 3, 0, 228, 175, 142, 4, 0, 240, 169, 172,
+    176, 3, 0, 233, 177, 128, 3, 0, 233, 179, 189, 3, 0, 228, 179, 142,
+    3, 0, 228, 179, 173, 3, 0, 233, 181, 167, 4, 0, 240, 170, 131, 142,
+    3, 0, 228, 179, 184, 4, 0, 240, 170, 132, 133, 4, 0, 240, 170, 136,
+    142, 4, 0, 240, 170, 138, 145, 3, 0, 233, 186, 187, 3, 0, 228, 181,
+    150, 3, 0, 233, 187, 185, 3, 0, 233, 187, 190, 3, 0, 233, 188, 133,
+    3, 0, 233, 188, 143, 3, 0, 233, 188, 150, 3, 0, 233, 188, 187, 4,
+    0, 240, 170, 152, 128,
+};
+
+// {first, second, composite} sorted by first and second
+static const uint32_t gp_norm_compositions[941][3] = {
+    {0x3C,0x338,0x226E}, {0x3D,0x338,0x2260}, {0x3E,0x338,0x226F},
+    {0x41,0x300,0xC0}, {0x41,0x301,0xC1}, {0x41,0x302,0xC2},
+    {0x41,0x303,0xC3}, {0x41,0x304,0x100}, {0x41,0x306,0x102},
+    {0x41,0x307,0x226}, {0x41,0x308,0xC4}, {0x41,0x309,0x1EA2},
+    {0x41,0x30A,0xC5}, {0x41,0x30C,0x1CD}, {0x41,0x30F,0x200},
+    {0x41,0x311,0x202}, {0x41,0x323,0x1EA0}, {0x41,0x325,0x1E00},
+    {0x41,0x328,0x104}, {0x42,0x307,0x1E02}, {0x42,0x323,0x1E04},
+    {0x42,0x331,0x1E06}, {0x43,0x301,0x106}, {0x43,0x302,0x108},
+    {0x43,0x307,0x10A}, {0x43,0x30C,0x10C}, {0x43,0x327,0xC7},
+    {0x44,0x307,0x1E0A}, {0x44,0x30C,0x10E}, {0x44,0x323,0x1E0C},
+    {0x44,0x327,0x1E10}, {0x44,0x32D,0x1E12}, {0x44,0x331,0x1E0E},
+    {0x45,0x300,0xC8}, {0x45,0x301,0xC9}, {0x45,0x302,0xCA},
+    {0x45,0x303,0x1EBC}, {0x45,0x304,0x112}, {0x45,0x306,0x114},
+    {0x45,0x307,0x116}, {0x45,0x308,0xCB}, {0x45,0x309,0x1EBA},
+    {0x45,0x30C,0x11A}, {0x45,0x30F,0x204}, {0x45,0x311,0x206},
+    {0x45,0x323,0x1EB8}, {0x45,0x327,0x228}, {0x45,0x328,0x118},
+    {0x45,0x32D,0x1E18}, {0x45,0x330,0x1E1A}, {0x46,0x307,0x1E1E},
+    {0x47,0x301,0x1F4}, {0x47,0x302,0x11C}, {0x47,0x304,0x1E20},
+    {0x47,0x306,0x11E}, {0x47,0x307,0x120}, {0x47,0x30C,0x1E6},
+    {0x47,0x327,0x122}, {0x48,0x302,0x124}, {0x48,0x307,0x1E22},
+    {0x48,0x308,0x1E26}, {0x48,0x30C,0x21E}, {0x48,0x323,0x1E24},
+    {0x48,0x327,0x1E28}, {0x48,0x32E,0x1E2A}, {0x49,0x300,0xCC},
+    {0x49,0x301,0xCD}, {0x49,0x302,0xCE}, {0x49,0x303,0x128},
+    {0x49,0x304,0x12A}, {0x49,0x306,0x12C}, {0x49,0x307,0x130},
+    {0x49,0x308,0xCF}, {0x49,0x309,0x1EC8}, {0x49,0x30C,0x1CF},
+    {0x49,0x30F,0x208}, {0x49,0x311,0x20A}, {0x49,0x323,0x1ECA},
+    {0x49,0x328,0x12E}, {0x49,0x330,0x1E2C}, {0x4A,0x302,0x134},
+    {0x4B,0x301,0x1E30}, {0x4B,0x30C,0x1E8}, {0x4B,0x323,0x1E32},
+    {0x4B,0x327,0x136}, {0x4B,0x331,0x1E34}, {0x4C,0x301,0x139},
+    {0x4C,0x30C,0x13D}, {0x4C,0x323,0x1E36}, {0x4C,0x327,0x13B},
+    {0x4C,0x32D,0x1E3C}, {0x4C,0x331,0x1E3A}, {0x4D,0x301,0x1E3E},
+    {0x4D,0x307,0x1E40}, {0x4D,0x323,0x1E42}, {0x4E,0x300,0x1F8},
+    {0x4E,0x301,0x143}, {0x4E,0x303,0xD1}, {0x4E,0x307,0x1E44},
+    {0x4E,0x30C,0x147}, {0x4E,0x323,0x1E46}, {0x4E,0x327,0x145},
+    {0x4E,0x32D,0x1E4A}, {0x4E,0x331,0x1E48}, {0x4F,0x300,0xD2},
+    {0x4F,0x301,0xD3}, {0x4F,0x302,0xD4}, {0x4F,0x303,0xD5},
+    {0x4F,0x304,0x14C}, {0x4F,0x306,0x14E}, {0x4F,0x307,0x22E},
+    {0x4F,0x308,0xD6}, {0x4F,0x309,0x1ECE}, {0x4F,0x30B,0x150},
+    {0x4F,0x30C,0x1D1}, {0x4F,0x30F,0x20C}, {0x4F,0x311,0x20E},
+    {0x4F,0x31B,0x1A0}, {0x4F,0x323,0x1ECC}, {0x4F,0x328,0x1EA},
+    {0x50,0x301,0x1E54}, {0x50,0x307,0x1E56}, {0x52,0x301,0x154},
+    {0x52,0x307,0x1E58}, {0x52,0x30C,0x158}, {0x52,0x30F,0x210},
+    {0x52,0x311,0x212}, {0x52,0x323,0x1E5A}, {0x52,0x327,0x156},
+    {0x52,0x331,0x1E5E}, {0x53,0x301,0x15A}, {0x53,0x302,0x15C},
+    {0x53,0x307,0x1E60}, {0x53,0x30C,0x160}, {0x53,0x323,0x1E62},
+    {0x53,0x326,0x218}, {0x53,0x327,0x15E}, {0x54,0x307,0x1E6A},
+    {0x54,0x30C,0x164}, {0x54,0x323,0x1E6C}, {0x54,0x326,0x21A},
+    {0x54,0x327,0x162}, {0x54,0x32D,0x1E70}, {0x54,0x331,0x1E6E},
+    {0x55,0x300,0xD9}, {0x55,0x301,0xDA}, {0x55,0x302,0xDB},
+    {0x55,0x303,0x168}, {0x55,0x304,0x16A}, {0x55,0x306,0x16C},
+    {0x55,0x308,0xDC}, {0x55,0x309,0x1EE6}, {0x55,0x30A,0x16E},
+    {0x55,0x30B,0x170}, {0x55,0x30C,0x1D3}, {0x55,0x30F,0x214},
+    {0x55,0x311,0x216}, {0x55,0x31B,0x1AF}, {0x55,0x323,0x1EE4},
+    {0x55,0x324,0x1E72}, {0x55,0x328,0x172}, {0x55,0x32D,0x1E76},
+    {0x55,0x330,0x1E74}, {0x56,0x303,0x1E7C}, {0x56,0x323,0x1E7E},
+    {0x57,0x300,0x1E80}, {0x57,0x301,0x1E82}, {0x57,0x302,0x174},
+    {0x57,0x307,0x1E86}, {0x57,0x308,0x1E84}, {0x57,0x323,0x1E88},
+    {0x58,0x307,0x1E8A}, {0x58,0x308,0x1E8C}, {0x59,0x300,0x1EF2},
+    {0x59,0x301,0xDD}, {0x59,0x302,0x176}, {0x59,0x303,0x1EF8},
+    {0x59,0x304,0x232}, {0x59,0x307,0x1E8E}, {0x59,0x308,0x178},
+    {0x59,0x309,0x1EF6}, {0x59,0x323,0x1EF4}, {0x5A,0x301,0x179},
+    {0x5A,0x302,0x1E90}, {0x5A,0x307,0x17B}, {0x5A,0x30C,0x17D},
+    {0x5A,0x323,0x1E92}, {0x5A,0x331,0x1E94}, {0x61,0x300,0xE0},
+    {0x61,0x301,0xE1}, {0x61,0x302,0xE2}, {0x61,0x303,0xE3},
+    {0x61,0x304,0x101}, {0x61,0x306,0x103}, {0x61,0x307,0x227},
+    {0x61,0x308,0xE4}, {0x61,0x309,0x1EA3}, {0x61,0x30A,0xE5},
+    {0x61,0x30C,0x1CE}, {0x61,0x30F,0x201}, {0x61,0x311,0x203},
+    {0x61,0x323,0x1EA1}, {0x61,0x325,0x1E01}, {0x61,0x328,0x105},
+    {0x62,0x307,0x1E03}, {0x62,0x323,0x1E05}, {0x62,0x331,0x1E07},
+    {0x63,0x301,0x107}, {0x63,0x302,0x109}, {0x63,0x307,0x10B},
+    {0x63,0x30C,0x10D}, {0x63,0x327,0xE7}, {0x64,0x307,0x1E0B},
+    {0x64,0x30C,0x10F}, {0x64,0x323,0x1E0D}, {0x64,0x327,0x1E11},
+    {0x64,0x32D,0x1E13}, {0x64,0x331,0x1E0F}, {0x65,0x300,0xE8},
+    {0x65,0x301,0xE9}, {0x65,0x302,0xEA}, {0x65,0x303,0x1EBD},
+    {0x65,0x304,0x113}, {0x65,0x306,0x115}, {0x65,0x307,0x117},
+    {0x65,0x308,0xEB}, {0x65,0x309,0x1EBB}, {0x65,0x30C,0x11B},
+    {0x65,0x30F,0x205}, {0x65,0x311,0x207}, {0x65,0x323,0x1EB9},
+    {0x65,0x327,0x229}, {0x65,0x328,0x119}, {0x65,0x32D,0x1E19},
+    {0x65,0x330,0x1E1B}, {0x66,0x307,0x1E1F}, {0x67,0x301,0x1F5},
+    {0x67,0x302,0x11D}, {0x67,0x304,0x1E21}, {0x67,0x306,0x11F},
+    {0x67,0x307,0x121}, {0x67,0x30C,0x1E7}, {0x67,0x327,0x123},
+    {0x68,0x302,0x125}, {0x68,0x307,0x1E23}, {0x68,0x308,0x1E27},
+    {0x68,0x30C,0x21F}, {0x68,0x323,0x1E25}, {0x68,0x327,0x1E29},
+    {0x68,0x32E,0x1E2B}, {0x68,0x331,0x1E96}, {0x69,0x300,0xEC},
+    {0x69,0x301,0xED}, {0x69,0x302,0xEE}, {0x69,0x303,0x129},
+    {0x69,0x304,0x12B}, {0x69,0x306,0x12D}, {0x69,0x308,0xEF},
+    {0x69,0x309,0x1EC9}, {0x69,0x30C,0x1D0}, {0x69,0x30F,0x209},
+    {0x69,0x311,0x20B}, {0x69,0x323,0x1ECB}, {0x69,0x328,0x12F},
+    {0x69,0x330,0x1E2D}, {0x6A,0x302,0x135}, {0x6A,0x30C,0x1F0},
+    {0x6B,0x301,0x1E31}, {0x6B,0x30C,0x1E9}, {0x6B,0x323,0x1E33},
+    {0x6B,0x327,0x137}, {0x6B,0x331,0x1E35}, {0x6C,0x301,0x13A},
+    {0x6C,0x30C,0x13E}, {0x6C,0x323,0x1E37}, {0x6C,0x327,0x13C},
+    {0x6C,0x32D,0x1E3D}, {0x6C,0x331,0x1E3B}, {0x6D,0x301,0x1E3F},
+    {0x6D,0x307,0x1E41}, {0x6D,0x323,0x1E43}, {0x6E,0x300,0x1F9},
+    {0x6E,0x301,0x144}, {0x6E,0x303,0xF1}, {0x6E,0x307,0x1E45},
+    {0x6E,0x30C,0x148}, {0x6E,0x323,0x1E47}, {0x6E,0x327,0x146},
+    {0x6E,0x32D,0x1E4B}, {0x6E,0x331,0x1E49}, {0x6F,0x300,0xF2},
+    {0x6F,0x301,0xF3}, {0x6F,0x302,0xF4}, {0x6F,0x303,0xF5},
+    {0x6F,0x304,0x14D}, {0x6F,0x306,0x14F}, {0x6F,0x307,0x22F},
+    {0x6F,0x308,0xF6}, {0x6F,0x309,0x1ECF}, {0x6F,0x30B,0x151},
+    {0x6F,0x30C,0x1D2}, {0x6F,0x30F,0x20D}, {0x6F,0x311,0x20F},
+    {0x6F,0x31B,0x1A1}, {0x6F,0x323,0x1ECD}, {0x6F,0x328,0x1EB},
+    {0x70,0x301,0x1E55}, {0x70,0x307,0x1E57}, {0x72,0x301,0x155},
+    {0x72,0x307,0x1E59}, {0x72,0x30C,0x159}, {0x72,0x30F,0x211},
+    {0x72,0x311,0x213}, {0x72,0x323,0x1E5B}, {0x72,0x327,0x157},
+    {0x72,0x331,0x1E5F}, {0x73,0x301,0x15B}, {0x73,0x302,0x15D},
+    {0x73,0x307,0x1E61}, {0x73,0x30C,0x161}, {0x73,0x323,0x1E63},
+    {0x73,0x326,0x219}, {0x73,0x327,0x15F}, {0x74,0x307,0x1E6B},
+    {0x74,0x308,0x1E97}, {0x74,0x30C,0x165}, {0x74,0x323,0x1E6D},
+    {0x74,0x326,0x21B}, {0x74,0x327,0x163}, {0x74,0x32D,0x1E71},
+    {0x74,0x331,0x1E6F}, {0x75,0x300,0xF9}, {0x75,0x301,0xFA},
+    {0x75,0x302,0xFB}, {0x75,0x303,0x169}, {0x75,0x304,0x16B},
+    {0x75,0x306,0x16D}, {0x75,0x308,0xFC}, {0x75,0x309,0x1EE7},
+    {0x75,0x30A,0x16F}, {0x75,0x30B,0x171}, {0x75,0x30C,0x1D4},
+    {0x75,0x30F,0x215}, {0x75,0x311,0x217}, {0x75,0x31B,0x1B0},
+    {0x75,0x323,0x1EE5}, {0x75,0x324,0x1E73}, {0x75,0x328,0x173},
+    {0x75,0x32D,0x1E77}, {0x75,0x330,0x1E75}, {0x76,0x303,0x1E7D},
+    {0x76,0x323,0x1E7F}, {0x77,0x300,0x1E81}, {0x77,0x301,0x1E83},
+    {0x77,0x302,0x175}, {0x77,0x307,0x1E87}, {0x77,0x308,0x1E85},
+    {0x77,0x30A,0x1E98}, {0x77,0x323,0x1E89}, {0x78,0x307,0x1E8B},
+    {0x78,0x308,0x1E8D}, {0x79,0x300,0x1EF3}, {0x79,0x301,0xFD},
+    {0x79,0x302,0x177}, {0x79,0x303,0x1EF9}, {0x79,0x304,0x233},
+    {0x79,0x307,0x1E8F}, {0x79,0x308,0xFF}, {0x79,0x309,0x1EF7},
+    {0x79,0x30A,0x1E99}, {0x79,0x323,0x1EF5}, {0x7A,0x301,0x17A},
+    {0x7A,0x302,0x1E91}, {0x7A,0x307,0x17C}, {0x7A,0x30C,0x17E},
+    {0x7A,0x323,0x1E93}, {0x7A,0x331,0x1E95}, {0xA8,0x300,0x1FED},
+    {0xA8,0x301,0x385}, {0xA8,0x342,0x1FC1}, {0xC2,0x300,0x1EA6},
+    {0xC2,0x301,0x1EA4}, {0xC2,0x303,0x1EAA}, {0xC2,0x309,0x1EA8},
+    {0xC4,0x304,0x1DE}, {0xC5,0x301,0x1FA}, {0xC6,0x301,0x1FC},
+    {0xC6,0x304,0x1E2}, {0xC7,0x301,0x1E08}, {0xCA,0x300,0x1EC0},
+    {0xCA,0x301,0x1EBE}, {0xCA,0x303,0x1EC4}, {0xCA,0x309,0x1EC2},
+    {0xCF,0x301,0x1E2E}, {0xD4,0x300,0x1ED2}, {0xD4,0x301,0x1ED0},
+    {0xD4,0x303,0x1ED6}, {0xD4,0x309,0x1ED4}, {0xD5,0x301,0x1E4C},
+    {0xD5,0x304,0x22C}, {0xD5,0x308,0x1E4E}, {0xD6,0x304,0x22A},
+    {0xD8,0x301,0x1FE}, {0xDC,0x300,0x1DB}, {0xDC,0x301,0x1D7},
+    {0xDC,0x304,0x1D5}, {0xDC,0x30C,0x1D9}, {0xE2,0x300,0x1EA7},
+    {0xE2,0x301,0x1EA5}, {0xE2,0x303,0x1EAB}, {0xE2,0x309,0x1EA9},
+    {0xE4,0x304,0x1DF}, {0xE5,0x301,0x1FB}, {0xE6,0x301,0x1FD},
+    {0xE6,0x304,0x1E3}, {0xE7,0x301,0x1E09}, {0xEA,0x300,0x1EC1},
+    {0xEA,0x301,0x1EBF}, {0xEA,0x303,0x1EC5}, {0xEA,0x309,0x1EC3},
+    {0xEF,0x301,0x1E2F}, {0xF4,0x300,0x1ED3}, {0xF4,0x301,0x1ED1},
+    {0xF4,0x303,0x1ED7}, {0xF4,0x309,0x1ED5}, {0xF5,0x301,0x1E4D},
+    {0xF5,0x304,0x22D}, {0xF5,0x308,0x1E4F}, {0xF6,0x304,0x22B},
+    {0xF8,0x301,0x1FF}, {0xFC,0x300,0x1DC}, {0xFC,0x301,0x1D8},
+    {0xFC,0x304,0x1D6}, {0xFC,0x30C,0x1DA}, {0x102,0x300,0x1EB0},
+    {0x102,0x301,0x1EAE}, {0x102,0x303,0x1EB4}, {0x102,0x309,0x1EB2},
+    {0x103,0x300,0x1EB1}, {0x103,0x301,0x1EAF}, {0x103,0x303,0x1EB5},
+    {0x103,0x309,0x1EB3}, {0x112,0x300,0x1E14}, {0x112,0x301,0x1E16},
+    {0x113,0x300,0x1E15}, {0x113,0x301,0x1E17}, {0x14C,0x300,0x1E50},
+    {0x14C,0x301,0x1E52}, {0x14D,0x300,0x1E51}, {0x14D,0x301,0x1E53},
+    {0x15A,0x307,0x1E64}, {0x15B,0x307,0x1E65}, {0x160,0x307,0x1E66},
+    {0x161,0x307,0x1E67}, {0x168,0x301,0x1E78}, {0x169,0x301,0x1E79},
+    {0x16A,0x308,0x1E7A}, {0x16B,0x308,0x1E7B}, {0x17F,0x307,0x1E9B},
+    {0x1A0,0x300,0x1EDC}, {0x1A0,0x301,0x1EDA}, {0x1A0,0x303,0x1EE0},
+    {0x1A0,0x309,0x1EDE}, {0x1A0,0x323,0x1EE2}, {0x1A1,0x300,0x1EDD},
+    {0x1A1,0x301,0x1EDB}, {0x1A1,0x303,0x1EE1}, {0x1A1,0x309,0x1EDF},
+    {0x1A1,0x323,0x1EE3}, {0x1AF,0x300,0x1EEA}, {0x1AF,0x301,0x1EE8},
+    {0x1AF,0x303,0x1EEE}, {0x1AF,0x309,0x1EEC}, {0x1AF,0x323,0x1EF0},
+    {0x1B0,0x300,0x1EEB}, {0x1B0,0x301,0x1EE9}, {0x1B0,0x303,0x1EEF},
+    {0x1B0,0x309,0x1EED}, {0x1B0,0x323,0x1EF1}, {0x1B7,0x30C,0x1EE},
+    {0x1EA,0x304,0x1EC}, {0x1EB,0x304,0x1ED}, {0x226,0x304,0x1E0},
+    {0x227,0x304,0x1E1}, {0x228,0x306,0x1E1C}, {0x229,0x306,0x1E1D},
+    {0x22E,0x304,0x230}, {0x22F,0x304,0x231}, {0x292,0x30C,0x1EF},
+    {0x391,0x300,0x1FBA}, {0x391,0x301,0x386}, {0x391,0x304,0x1FB9},
+    {0x391,0x306,0x1FB8}, {0x391,0x313,0x1F08}, {0x391,0x314,0x1F09},
+    {0x391,0x345,0x1FBC}, {0x395,0x300,0x1FC8}, {0x395,0x301,0x388},
+    {0x395,0x313,0x1F18}, {0x395,0x314,0x1F19}, {0x397,0x300,0x1FCA},
+    {0x397,0x301,0x389}, {0x397,0x313,0x1F28}, {0x397,0x314,0x1F29},
+    {0x397,0x345,0x1FCC}, {0x399,0x300,0x1FDA}, {0x399,0x301,0x38A},
+    {0x399,0x304,0x1FD9}, {0x399,0x306,0x1FD8}, {0x399,0x308,0x3AA},
+    {0x399,0x313,0x1F38}, {0x399,0x314,0x1F39}, {0x39F,0x300,0x1FF8},
+    {0x39F,0x301,0x38C}, {0x39F,0x313,0x1F48}, {0x39F,0x314,0x1F49},
+    {0x3A1,0x314,0x1FEC}, {0x3A5,0x300,0x1FEA}, {0x3A5,0x301,0x38E},
+    {0x3A5,0x304,0x1FE9}, {0x3A5,0x306,0x1FE8}, {0x3A5,0x308,0x3AB},
+    {0x3A5,0x314,0x1F59}, {0x3A9,0x300,0x1FFA}, {0x3A9,0x301,0x38F},
+    {0x3A9,0x313,0x1F68}, {0x3A9,0x314,0x1F69}, {0x3A9,0x345,0x1FFC},
+    {0x3AC,0x345,0x1FB4}, {0x3AE,0x345,0x1FC4}, {0x3B1,0x300,0x1F70},
+    {0x3B1,0x301,0x3AC}, {0x3B1,0x304,0x1FB1}, {0x3B1,0x306,0x1FB0},
+    {0x3B1,0x313,0x1F00}, {0x3B1,0x314,0x1F01}, {0x3B1,0x342,0x1FB6},
+    {0x3B1,0x345,0x1FB3}, {0x3B5,0x300,0x1F72}, {0x3B5,0x301,0x3AD},
+    {0x3B5,0x313,0x1F10}, {0x3B5,0x314,0x1F11}, {0x3B7,0x300,0x1F74},
+    {0x3B7,0x301,0x3AE}, {0x3B7,0x313,0x1F20}, {0x3B7,0x314,0x1F21},
+    {0x3B7,0x342,0x1FC6}, {0x3B7,0x345,0x1FC3}, {0x3B9,0x300,0x1F76},
+    {0x3B9,0x301,0x3AF}, {0x3B9,0x304,0x1FD1}, {0x3B9,0x306,0x1FD0},
+    {0x3B9,0x308,0x3CA}, {0x3B9,0x313,0x1F30}, {0x3B9,0x314,0x1F31},
+    {0x3B9,0x342,0x1FD6}, {0x3BF,0x300,0x1F78}, {0x3BF,0x301,0x3CC},
+    {0x3BF,0x313,0x1F40}, {0x3BF,0x314,0x1F41}, {0x3C1,0x313,0x1FE4},
+    {0x3C1,0x314,0x1FE5}, {0x3C5,0x300,0x1F7A}, {0x3C5,0x301,0x3CD},
+    {0x3C5,0x304,0x1FE1}, {0x3C5,0x306,0x1FE0}, {0x3C5,0x308,0x3CB},
+    {0x3C5,0x313,0x1F50}, {0x3C5,0x314,0x1F51}, {0x3C5,0x342,0x1FE6},
+    {0x3C9,0x300,0x1F7C}, {0x3C9,0x301,0x3CE}, {0x3C9,0x313,0x1F60},
+    {0x3C9,0x314,0x1F61}, {0x3C9,0x342,0x1FF6}, {0x3C9,0x345,0x1FF3},
+    {0x3CA,0x300,0x1FD2}, {0x3CA,0x301,0x390}, {0x3CA,0x342,0x1FD7},
+    {0x3CB,0x300,0x1FE2}, {0x3CB,0x301,0x3B0}, {0x3CB,0x342,0x1FE7},
+    {0x3CE,0x345,0x1FF4}, {0x3D2,0x301,0x3D3}, {0x3D2,0x308,0x3D4},
+    {0x406,0x308,0x407}, {0x410,0x306,0x4D0}, {0x410,0x308,0x4D2},
+    {0x413,0x301,0x403}, {0x415,0x300,0x400}, {0x415,0x306,0x4D6},
+    {0x415,0x308,0x401}, {0x416,0x306,0x4C1}, {0x416,0x308,0x4DC},
+    {0x417,0x308,0x4DE}, {0x418,0x300,0x40D}, {0x418,0x304,0x4E2},
+    {0x418,0x306,0x419}, {0x418,0x308,0x4E4}, {0x41A,0x301,0x40C},
+    {0x41E,0x308,0x4E6}, {0x423,0x304,0x4EE}, {0x423,0x306,0x40E},
+    {0x423,0x308,0x4F0}, {0x423,0x30B,0x4F2}, {0x427,0x308,0x4F4},
+    {0x42B,0x308,0x4F8}, {0x42D,0x308,0x4EC}, {0x430,0x306,0x4D1},
+    {0x430,0x308,0x4D3}, {0x433,0x301,0x453}, {0x435,0x300,0x450},
+    {0x435,0x306,0x4D7}, {0x435,0x308,0x451}, {0x436,0x306,0x4C2},
+    {0x436,0x308,0x4DD}, {0x437,0x308,0x4DF}, {0x438,0x300,0x45D},
+    {0x438,0x304,0x4E3}, {0x438,0x306,0x439}, {0x438,0x308,0x4E5},
+    {0x43A,0x301,0x45C}, {0x43E,0x308,0x4E7}, {0x443,0x304,0x4EF},
+    {0x443,0x306,0x45E}, {0x443,0x308,0x4F1}, {0x443,0x30B,0x4F3},
+    {0x447,0x308,0x4F5}, {0x44B,0x308,0x4F9}, {0x44D,0x308,0x4ED},
+    {0x456,0x308,0x457}, {0x474,0x30F,0x476}, {0x475,0x30F,0x477},
+    {0x4D8,0x308,0x4DA}, {0x4D9,0x308,0x4DB}, {0x4E8,0x308,0x4EA},
+    {0x4E9,0x308,0x4EB}, {0x627,0x653,0x622}, {0x627,0x654,0x623},
+    {0x627,0x655,0x625}, {0x648,0x654,0x624}, {0x64A,0x654,0x626},
+    {0x6C1,0x654,0x6C2}, {0x6D2,0x654,0x6D3}, {0x6D5,0x654,0x6C0},
+    {0x928,0x93C,0x929}, {0x930,0x93C,0x931}, {0x933,0x93C,0x934},
+    {0x9C7,0x9BE,0x9CB}, {0x9C7,0x9D7,0x9CC}, {0xB47,0xB3E,0xB4B},
+    {0xB47,0xB56,0xB48}, {0xB47,0xB57,0xB4C}, {0xB92,0xBD7,0xB94},
+    {0xBC6,0xBBE,0xBCA}, {0xBC6,0xBD7,0xBCC}, {0xBC7,0xBBE,0xBCB},
+    {0xC46,0xC56,0xC48}, {0xCBF,0xCD5,0xCC0}, {0xCC6,0xCC2,0xCCA},
+    {0xCC6,0xCD5,0xCC7}, {0xCC6,0xCD6,0xCC8}, {0xCCA,0xCD5,0xCCB},
+    {0xD46,0xD3E,0xD4A}, {0xD46,0xD57,0xD4C}, {0xD47,0xD3E,0xD4B},
+    {0xDD9,0xDCA,0xDDA}, {0xDD9,0xDCF,0xDDC}, {0xDD9,0xDDF,0xDDE},
+    {0xDDC,0xDCA,0xDDD}, {0x1025,0x102E,0x1026}, {0x1B05,0x1B35,0x1B06},
+    {0x1B07,0x1B35,0x1B08}, {0x1B09,0x1B35,0x1B0A}, {0x1B0B,0x1B35,0x1B0C},
+    {0x1B0D,0x1B35,0x1B0E}, {0x1B11,0x1B35,0x1B12}, {0x1B3A,0x1B35,0x1B3B},
+    {0x1B3C,0x1B35,0x1B3D}, {0x1B3E,0x1B35,0x1B40}, {0x1B3F,0x1B35,0x1B41},
+    {0x1B42,0x1B35,0x1B43}, {0x1E36,0x304,0x1E38}, {0x1E37,0x304,0x1E39},
+    {0x1E5A,0x304,0x1E5C}, {0x1E5B,0x304,0x1E5D}, {0x1E62,0x307,0x1E68},
+    {0x1E63,0x307,0x1E69}, {0x1EA0,0x302,0x1EAC}, {0x1EA0,0x306,0x1EB6},
+    {0x1EA1,0x302,0x1EAD}, {0x1EA1,0x306,0x1EB7}, {0x1EB8,0x302,0x1EC6},
+    {0x1EB9,0x302,0x1EC7}, {0x1ECC,0x302,0x1ED8}, {0x1ECD,0x302,0x1ED9},
+    {0x1F00,0x300,0x1F02}, {0x1F00,0x301,0x1F04}, {0x1F00,0x342,0x1F06},
+    {0x1F00,0x345,0x1F80}, {0x1F01,0x300,0x1F03}, {0x1F01,0x301,0x1F05},
+    {0x1F01,0x342,0x1F07}, {0x1F01,0x345,0x1F81}, {0x1F02,0x345,0x1F82},
+    {0x1F03,0x345,0x1F83}, {0x1F04,0x345,0x1F84}, {0x1F05,0x345,0x1F85},
+    {0x1F06,0x345,0x1F86}, {0x1F07,0x345,0x1F87}, {0x1F08,0x300,0x1F0A},
+    {0x1F08,0x301,0x1F0C}, {0x1F08,0x342,0x1F0E}, {0x1F08,0x345,0x1F88},
+    {0x1F09,0x300,0x1F0B}, {0x1F09,0x301,0x1F0D}, {0x1F09,0x342,0x1F0F},
+    {0x1F09,0x345,0x1F89}, {0x1F0A,0x345,0x1F8A}, {0x1F0B,0x345,0x1F8B},
+    {0x1F0C,0x345,0x1F8C}, {0x1F0D,0x345,0x1F8D}, {0x1F0E,0x345,0x1F8E},
+    {0x1F0F,0x345,0x1F8F}, {0x1F10,0x300,0x1F12}, {0x1F10,0x301,0x1F14},
+    {0x1F11,0x300,0x1F13}, {0x1F11,0x301,0x1F15}, {0x1F18,0x300,0x1F1A},
+    {0x1F18,0x301,0x1F1C}, {0x1F19,0x300,0x1F1B}, {0x1F19,0x301,0x1F1D},
+    {0x1F20,0x300,0x1F22}, {0x1F20,0x301,0x1F24}, {0x1F20,0x342,0x1F26},
+    {0x1F20,0x345,0x1F90}, {0x1F21,0x300,0x1F23}, {0x1F21,0x301,0x1F25},
+    {0x1F21,0x342,0x1F27}, {0x1F21,0x345,0x1F91}, {0x1F22,0x345,0x1F92},
+    {0x1F23,0x345,0x1F93}, {0x1F24,0x345,0x1F94}, {0x1F25,0x345,0x1F95},
+    {0x1F26,0x345,0x1F96}, {0x1F27,0x345,0x1F97}, {0x1F28,0x300,0x1F2A},
+    {0x1F28,0x301,0x1F2C}, {0x1F28,0x342,0x1F2E}, {0x1F28,0x345,0x1F98},
+    {0x1F29,0x300,0x1F2B}, {0x1F29,0x301,0x1F2D}, {0x1F29,0x342,0x1F2F},
+    {0x1F29,0x345,0x1F99}, {0x1F2A,0x345,0x1F9A}, {0x1F2B,0x345,0x1F9B},
+    {0x1F2C,0x345,0x1F9C}, {0x1F2D,0x345,0x1F9D}, {0x1F2E,0x345,0x1F9E},
+    {0x1F2F,0x345,0x1F9F}, {0x1F30,0x300,0x1F32}, {0x1F30,0x301,0x1F34},
+    {0x1F30,0x342,0x1F36}, {0x1F31,0x300,0x1F33}, {0x1F31,0x301,0x1F35},
+    {0x1F31,0x342,0x1F37}, {0x1F38,0x300,0x1F3A}, {0x1F38,0x301,0x1F3C},
+    {0x1F38,0x342,0x1F3E}, {0x1F39,0x300,0x1F3B}, {0x1F39,0x301,0x1F3D},
+    {0x1F39,0x342,0x1F3F}, {0x1F40,0x300,0x1F42}, {0x1F40,0x301,0x1F44},
+    {0x1F41,0x300,0x1F43}, {0x1F41,0x301,0x1F45}, {0x1F48,0x300,0x1F4A},
+    {0x1F48,0x301,0x1F4C}, {0x1F49,0x300,0x1F4B}, {0x1F49,0x301,0x1F4D},
+    {0x1F50,0x300,0x1F52}, {0x1F50,0x301,0x1F54}, {0x1F50,0x342,0x1F56},
+    {0x1F51,0x300,0x1F53}, {0x1F51,0x301,0x1F55}, {0x1F51,0x342,0x1F57},
+    {0x1F59,0x300,0x1F5B}, {0x1F59,0x301,0x1F5D}, {0x1F59,0x342,0x1F5F},
+    {0x1F60,0x300,0x1F62}, {0x1F60,0x301,0x1F64}, {0x1F60,0x342,0x1F66},
+    {0x1F60,0x345,0x1FA0}, {0x1F61,0x300,0x1F63}, {0x1F61,0x301,0x1F65},
+    {0x1F61,0x342,0x1F67}, {0x1F61,0x345,0x1FA1}, {0x1F62,0x345,0x1FA2},
+    {0x1F63,0x345,0x1FA3}, {0x1F64,0x345,0x1FA4}, {0x1F65,0x345,0x1FA5},
+    {0x1F66,0x345,0x1FA6}, {0x1F67,0x345,0x1FA7}, {0x1F68,0x300,0x1F6A},
+    {0x1F68,0x301,0x1F6C}, {0x1F68,0x342,0x1F6E}, {0x1F68,0x345,0x1FA8},
+    {0x1F69,0x300,0x1F6B}, {0x1F69,0x301,0x1F6D}, {0x1F69,0x342,0x1F6F},
+    {0x1F69,0x345,0x1FA9}, {0x1F6A,0x345,0x1FAA}, {0x1F6B,0x345,0x1FAB},
+    {0x1F6C,0x345,0x1FAC}, {0x1F6D,0x345,0x1FAD}, {0x1F6E,0x345,0x1FAE},
+    {0x1F6F,0x345,0x1FAF}, {0x1F70,0x345,0x1FB2}, {0x1F74,0x345,0x1FC2},
+    {0x1F7C,0x345,0x1FF2}, {0x1FB6,0x345,0x1FB7}, {0x1FBF,0x300,0x1FCD},
+    {0x1FBF,0x301,0x1FCE}, {0x1FBF,0x342,0x1FCF}, {0x1FC6,0x345,0x1FC7},
+    {0x1FF6,0x345,0x1FF7}, {0x1FFE,0x300,0x1FDD}, {0x1FFE,0x301,0x1FDE},
+    {0x1FFE,0x342,0x1FDF}, {0x2190,0x338,0x219A}, {0x2192,0x338,0x219B},
+    {0x2194,0x338,0x21AE}, {0x21D0,0x338,0x21CD}, {0x21D2,0x338,0x21CF},
+    {0x21D4,0x338,0x21CE}, {0x2203,0x338,0x2204}, {0x2208,0x338,0x2209},
+    {0x220B,0x338,0x220C}, {0x2223,0x338,0x2224}, {0x2225,0x338,0x2226},
+    {0x223C,0x338,0x2241}, {0x2243,0x338,0x2244}, {0x2245,0x338,0x2247},
+    {0x2248,0x338,0x2249}, {0x224D,0x338,0x226D}, {0x2261,0x338,0x2262},
+    {0x2264,0x338,0x2270}, {0x2265,0x338,0x2271}, {0x2272,0x338,0x2274},
+    {0x2273,0x338,0x2275}, {0x2276,0x338,0x2278}, {0x2277,0x338,0x2279},
+    {0x227A,0x338,0x2280}, {0x227B,0x338,0x2281}, {0x227C,0x338,0x22E0},
+    {0x227D,0x338,0x22E1}, {0x2282,0x338,0x2284}, {0x2283,0x338,0x2285},
+    {0x2286,0x338,0x2288}, {0x2287,0x338,0x2289}, {0x2291,0x338,0x22E2},
+    {0x2292,0x338,0x22E3}, {0x22A2,0x338,0x22AC}, {0x22A8,0x338,0x22AD},
+    {0x22A9,0x338,0x22AE}, {0x22AB,0x338,0x22AF}, {0x22B2,0x338,0x22EA},
+    {0x22B3,0x338,0x22EB}, {0x22B4,0x338,0x22EC}, {0x22B5,0x338,0x22ED},
+    {0x3046,0x3099,0x3094}, {0x304B,0x3099,0x304C}, {0x304D,0x3099,0x304E},
+    {0x304F,0x3099,0x3050}, {0x3051,0x3099,0x3052}, {0x3053,0x3099,0x3054},
+    {0x3055,0x3099,0x3056}, {0x3057,0x3099,0x3058}, {0x3059,0x3099,0x305A},
+    {0x305B,0x3099,0x305C}, {0x305D,0x3099,0x305E}, {0x305F,0x3099,0x3060},
+    {0x3061,0x3099,0x3062}, {0x3064,0x3099,0x3065}, {0x3066,0x3099,0x3067},
+    {0x3068,0x3099,0x3069}, {0x306F,0x3099,0x3070}, {0x306F,0x309A,0x3071},
+    {0x3072,0x3099,0x3073}, {0x3072,0x309A,0x3074}, {0x3075,0x3099,0x3076},
+    {0x3075,0x309A,0x3077}, {0x3078,0x3099,0x3079}, {0x3078,0x309A,0x307A},
+    {0x307B,0x3099,0x307C}, {0x307B,0x309A,0x307D}, {0x309D,0x3099,0x309E},
+    {0x30A6,0x3099,0x30F4}, {0x30AB,0x3099,0x30AC}, {0x30AD,0x3099,0x30AE},
+    {0x30AF,0x3099,0x30B0}, {0x30B1,0x3099,0x30B2}, {0x30B3,0x3099,0x30B4},
+    {0x30B5,0x3099,0x30B6}, {0x30B7,0x3099,0x30B8}, {0x30B9,0x3099,0x30BA},
+    {0x30BB,0x3099,0x30BC}, {0x30BD,0x3099,0x30BE}, {0x30BF,0x3099,0x30C0},
+    {0x30C1,0x3099,0x30C2}, {0x30C4,0x3099,0x30C5}, {0x30C6,0x3099,0x30C7},
+    {0x30C8,0x3099,0x30C9}, {0x30CF,0x3099,0x30D0}, {0x30CF,0x309A,0x30D1},
+    {0x30D2,0x3099,0x30D3}, {0x30D2,0x309A,0x30D4}, {0x30D5,0x3099,0x30D6},
+    {0x30D5,0x309A,0x30D7}, {0x30D8,0x3099,0x30D9}, {0x30D8,0x309A,0x30DA},
+    {0x30DB,0x3099,0x30DC}, {0x30DB,0x309A,0x30DD}, {0x30EF,0x3099,0x30F7},
+    {0x30F0,0x3099,0x30F8}, {0x30F1,0x3099,0x30F9}, {0x30F2,0x3099,0x30FA},
+    {0x30FD,0x3099,0x30FE}, {0x11099,0x110BA,0x1109A}, {0x1109B,0x110BA,0x1109C},
+    {0x110A5,0x110BA,0x110AB}, {0x11131,0x11127,0x1112E}, {0x11132,0x11127,0x1112F},
+    {0x11347,0x1133E,0x1134B}, {0x11347,0x11357,0x1134C}, {0x114B9,0x114B0,0x114BC},
+    {0x114B9,0x114BA,0x114BB}, {0x114B9,0x114BD,0x114BE}, {0x115B8,0x115AF,0x115BA},
+    {0x115B9,0x115AF,0x115BB}, {0x11935,0x11930,0x11938},
+};
+
+#endif // GP_NORM_TABLE_H
@@ -9,12 +9,22 @@
 
 #include <gpc/string.h>
 #include <gpc/unicode.h>
+#include <gpc/hashmap.h>
+#include <gpc/thread.h>
+#include <gpc/memory.h>
+#include <gpc/assert.h>
 #include "common.h"
 
 #include <stdlib.h>
 #include <inttypes.h>
 #include <math.h>
 #include <limits.h>
+#if _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#include <errno.h>
+#endif
 
 typedef struct pf_misc_data
 {
@@ -238,7 +248,7 @@ static size_t pf_write_i(
     // All potentially promoted args must be casted back to the original type to
     // truncate potential sign extension caused by default argument promotion.
 
-    long long i;
+    long long i = 0;
     GPInt128 i128;
     bool is_128 = false;
 
@@ -344,9 +354,11 @@ static size_t pf_write_i(
         pf_u128toa(
             pf_capacity_left(*out),
             out->data + out->length,
-            gp_uint128_negate(gp_uint128_i128(i128)))
+            is_negative ?
+                gp_uint128_negate(gp_uint128_i128(i128)) : gp_uint128_i128(i128))
       : pf_utoa(
-            pf_capacity_left(*out), out->data + out->length, llabs(i));
+            pf_capacity_left(*out), out->data + out->length,
+            is_negative ? -(unsigned long long)i : (unsigned long long)i);
 
     pf_write_leading_zeroes(out, max_written, fmt);
     return out->length - original_length;
@@ -513,7 +525,7 @@ static size_t pf_write_f(
     const double f = va_arg(args->list, gp_promoted_arg_double_t);
     #endif
     const size_t written_by_conversion = pf_strfromd(
-        out->data + out->length, out->capacity, fmt, f);
+        out->data + out->length, pf_capacity_left(*out), fmt, f);
     out->length += written_by_conversion;
 
     md->has_sign = pf_signbit(f) || fmt.flag.plus || fmt.flag.space;
@@ -522,6 +534,198 @@ static size_t pf_write_f(
     return written_by_conversion;
 }
 
+// Shortest round trip representation. Unlike other float conversions, h reads
+// float (promoted to double) and precision is ignored.
+static size_t pf_write_r(
+    PFString* out,
+    PFMiscData* md,
+    pf_va_list* args,
+    const PFFormatSpecifier fmt)
+{
+    const size_t original_length = out->length;
+    bool negative;
+    #if GP_HAS_LONG_DOUBLE
+    if (fmt.length_modifier == 'L')
+    {
+        const long double f = va_arg(args->list, long double);
+        negative = signbit(f);
+        md->is_nan_or_inf = isnan(f) || isinf(f);
+        if ( ! negative && (fmt.flag.plus || fmt.flag.space))
+            pf_push_char(out, fmt.flag.plus ? '+' : ' ');
+        out->length += pf_Lrtoa(
+            pf_capacity_left(*out), out->data + out->length, f);
+    }
+    else
+    #endif
+    {
+        const double f = va_arg(args->list, gp_promoted_arg_double_t);
+        negative = pf_signbit(f);
+        md->is_nan_or_inf = pf_isnan(f) || pf_isinf(f);
+        if ( ! negative && (fmt.flag.plus || fmt.flag.space))
+            pf_push_char(out, fmt.flag.plus ? '+' : ' ');
+        out->length += fmt.length_modifier == 'h' ?
+            pf_hrtoa(pf_capacity_left(*out), out->data + out->length, (float)f)
+          : pf_rtoa (pf_capacity_left(*out), out->data + out->length, f);
+    }
+    md->has_sign = negative || fmt.flag.plus || fmt.flag.space;
+
+    return out->length - original_length;
+}
+
+// Encoding conversions take the length of input bytes as precision or a null-
+// terminated string if precision is not given. Output is encoded directly to
+// out, or in chunks if truncated.
+static size_t pf_write_encoded(
+    PFString* out,
+    pf_va_list* args,
+    const PFFormatSpecifier fmt,
+    size_t (*encode)(char*restrict, const void*restrict, size_t, int),
+    const int flags)
+{
+    const uint8_t* src = va_arg(args->list, const void*);
+    const size_t src_length = fmt.precision.option == PF_NONE ?
+        strlen((const char*)src) : fmt.precision.width;
+
+    size_t length;
+    switch (fmt.conversion_format) {
+    case 'y': case 'Y':
+        length = 2 * src_length;
+        break;
+    case 'v':
+        length = gp_internal_base64_encoded_length(src_length, flags);
+        break;
+    default:
+        length = gp_internal_escaped_length(src, src_length, flags);
+    }
+
+    if (length <= pf_capacity_left(*out)) {
+        encode(out->data + out->length, src, src_length, flags);
+        out->length += length;
+        return length;
+    }
+    // Chunks are multiple of 3 so Base64 is not padded in between. Escape
+    // sequences are 6 bytes at most.
+    char chunk[6 * 48];
+    const size_t start = out->length;
+    for (size_t i = 0; i < src_length && pf_capacity_left(*out) > 0; i += 48)
+        pf_concat(out, chunk, encode(chunk, src + i, pf_min(48, src_length - i), flags));
+    out->length = start + length;
+    return length;
+}
+
+// ------------------------------
+// Registered conversions
+
+// Conversions are only appended and replaced, so lookups do not need to lock.
+// Entries are complete before they are counted.
+typedef struct pf_registered_conversion
+{
+    char                         name[PF_MAX_CONVERSION_NAME + 1];
+    size_t                       length;
+    GP_MAYBE_ATOMIC PFConversion conversion;
+} PFRegisteredConversion;
+
+static PFRegisteredConversion pf_s_conversions[PF_MAX_CONVERSIONS];
+static GP_MAYBE_ATOMIC size_t pf_s_conversions_length;
+static GPMutex                pf_s_conversions_mutex;
+
+static void pf_delete_conversions_mutex(void)
+{
+    gp_mutex_destroy(&pf_s_conversions_mutex);
+}
+
+static void pf_init_conversions_mutex(void)
+{
+    gp_mutex_init(&pf_s_conversions_mutex);
+    atexit(pf_delete_conversions_mutex);
+}
+
+static PFRegisteredConversion* pf_find_conversion(const char* name, const size_t length)
+{
+    const size_t conversions_length = pf_s_conversions_length;
+    for (size_t i = 0; i < conversions_length; ++i)
+        if (pf_s_conversions[i].length == length && memcmp(pf_s_conversions[i].name, name, length) == 0)
+            return &pf_s_conversions[i];
+    return NULL;
+}
+
+bool pf_register_conversion(const char* name, PFConversion conversion)
+{
+    size_t length = 0;
+    for (; name[length] != '\0'; ++length) {
+        const char c = name[length];
+        if ( ! (('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || ('0' <= c && c <= '9') || c == '_'))
+            return false;
+    }
+    if (length == 0 || length > PF_MAX_CONVERSION_NAME)
+        return false;
+
+    static GPThreadOnce conversions_once = GP_THREAD_ONCE_INIT;
+    gp_thread_once(&conversions_once, pf_init_conversions_mutex);
+
+    bool success = true;
+    gp_mutex_lock(&pf_s_conversions_mutex);
+    PFRegisteredConversion* registered = pf_find_conversion(name, length);
+    if (registered != NULL)
+        registered->conversion = conversion;
+    else if (pf_s_conversions_length < PF_MAX_CONVERSIONS)
+    {
+        registered = &pf_s_conversions[pf_s_conversions_length];
+        memcpy(registered->name, name, length);
+        registered->length     = length;
+        registered->conversion = conversion;
+        pf_s_conversions_length++;
+    }
+    else
+        success = false;
+    gp_mutex_unlock(&pf_s_conversions_mutex);
+    return success;
+}
+
+static const PFRegisteredConversion* pf_find_registered(const PFFormatSpecifier fmt)
+{
+    const char* name = (const char*)memchr(fmt.string, '{', fmt.string_length) + 1;
+    const size_t name_length = fmt.string + fmt.string_length - 1 - name;
+    return pf_find_conversion(name, name_length);
+}
+
+static size_t pf_write_registered(
+    PFString* out,
+    pf_va_list* args,
+    const PFFormatSpecifier fmt,
+    const PFRegisteredConversion* registered)
+{
+    gp_db_assert(registered != NULL, "Unregistered conversion in format string.",
+        "%.*s", (int)fmt.string_length, fmt.string);
+    if (registered == NULL) { // consume the argument anyway to not misalign rest
+        (void)va_arg(args->list, void*);
+        pf_concat(out, fmt.string, fmt.string_length);
+        return fmt.string_length;
+    }
+    const PFConversion conversion = registered->conversion;
+
+    pf_va_list retry;
+    va_copy(retry.list, args->list);
+    const size_t capacity = pf_capacity_left(*out);
+    const size_t length   = conversion(
+        capacity != 0 ? out->data + out->length : NULL, capacity, fmt, args);
+
+    // The last byte is the null-terminator if the conversion did not fit, so
+    // convert again to include it if there is room to be truncated later.
+    if (capacity != 0 && length >= capacity)
+    {
+        GPArena* scratch = gp_scratch_arena();
+        char* buffer = gp_mem_alloc(&scratch->base, length + 1);
+        conversion(buffer, length + 1, fmt, &retry);
+        pf_concat(out, buffer, length);
+        gp_arena_rewind(scratch, buffer);
+    }
+    else
+        out->length += length;
+    va_end(retry.list);
+    return length;
+}
+
 static size_t pf_add_padding(
     PFString* out,
     const size_t written,
@@ -569,6 +773,96 @@ static size_t pf_add_padding(
 // ------------------------------
 // String functtions
 
+// Writes conversion and padding. Asterisks in fmt must be resolved already.
+static void pf_write_conversion(
+    PFString* out,
+    pf_va_list* args,
+    const PFFormatSpecifier fmt)
+{
+    size_t written_by_conversion = 0;
+    PFMiscData misc = {0};
+
+    switch (fmt.conversion_format)
+    {
+    case 'c':
+        if (fmt.length_modifier != 'l') {
+            pf_push_char(out, (char)va_arg(args->list, gp_promoted_arg_char_t));
+            written_by_conversion = 1;
+        } else {
+            written_by_conversion = pf_write_wc(out, args);
+        } break;
+
+    case 's': // TODO wide strings!!!!!!!!!
+        written_by_conversion = pf_write_s(out, args, fmt);
+        break;
+
+    case 'S':
+        written_by_conversion = pf_write_S(out, args, fmt);
+        break;
+
+    case 'd':
+    case 'i':
+        written_by_conversion = pf_write_i(out, &misc, args, fmt);
+        break;
+
+    case 'o':
+        written_by_conversion = pf_write_o(out, args, fmt);
+        break;
+
+    case 'x':
+        written_by_conversion = pf_write_x(out, &misc, args, fmt);
+        break;
+
+    case 'X':
+        written_by_conversion = pf_write_X(out, &misc, args, fmt);
+        break;
+
+    case 'u':
+        written_by_conversion = pf_write_u(out, args, fmt);
+        break;
+
+    case 'p':
+        written_by_conversion = pf_write_p(out, args, fmt);
+        break;
+
+    case 'f': case 'F':
+    case 'e': case 'E':
+    case 'g': case 'G':
+        written_by_conversion = pf_write_f(out, &misc, args, fmt);
+        break;
+
+    case 'r':
+        written_by_conversion = pf_write_r(out, &misc, args, fmt);
+        break;
+
+    case 'y': case 'Y':
+        written_by_conversion = pf_write_encoded(out, args, fmt, gp_internal_hex_encode,
+            fmt.conversion_format == 'Y' ? GP_HEX_UPPERCASE : 0);
+        break;
+
+    case 'v':
+        written_by_conversion = pf_write_encoded(out, args, fmt, gp_internal_base64_encode,
+            fmt.flag.hash ? GP_BASE64_URL | GP_BASE64_NO_PADDING : 0);
+        break;
+
+    case 'q':
+        written_by_conversion = pf_write_encoded(out, args, fmt, gp_internal_escape,
+            fmt.flag.hash ? GP_ESCAPE_C : GP_ESCAPE_JSON);
+        break;
+
+    case '{':
+        written_by_conversion = pf_write_registered(out, args, fmt, pf_find_registered(fmt));
+        break;
+
+    case '%':
+        pf_push_char(out, '%');
+        break;
+    }
+
+    if (written_by_conversion < fmt.field.width)
+        pf_add_padding(out, written_by_conversion, misc, fmt);
+}
+
 size_t pf_vsnprintf_consuming_no_null_termination(
     char*restrict out_buf,
     const size_t max_size,
@@ -588,66 +882,8 @@ size_t pf_vsnprintf_consuming_no_null_termination(
         // Jump over format specifier for next iteration
         format = fmt.string + fmt.string_length;
 
-        size_t written_by_conversion = 0;
-        PFMiscData misc = {0};
-
-        switch (fmt.conversion_format)
-        {
-        case 'c':
-            if (fmt.length_modifier != 'l') {
-                pf_push_char(&out, (char)va_arg(args->list, gp_promoted_arg_char_t));
-                written_by_conversion = 1;
-            } else {
-                written_by_conversion = pf_write_wc(&out, args);
-            } break;
-
-        case 's': // TODO wide strings!!!!!!!!!
-            written_by_conversion = pf_write_s(&out, args, fmt);
-            break;
-
-        case 'S':
-            written_by_conversion = pf_write_S(&out, args, fmt);
-            break;
-
-        case 'd':
-        case 'i':
-            written_by_conversion = pf_write_i(&out, &misc, args, fmt);
-            break;
-
-        case 'o':
-            written_by_conversion = pf_write_o(&out, args, fmt);
-            break;
-
-        case 'x':
-            written_by_conversion = pf_write_x(&out, &misc, args, fmt);
-            break;
-
-        case 'X':
-            written_by_conversion = pf_write_X(&out, &misc, args, fmt);
-            break;
-
-        case 'u':
-            written_by_conversion = pf_write_u(&out, args, fmt);
-            break;
-
-        case 'p':
-            written_by_conversion = pf_write_p(&out, args, fmt);
-            break;
-
-        case 'f': case 'F':
-        case 'e': case 'E':
-        case 'g': case 'G':
-            written_by_conversion = pf_write_f(&out, &misc, args, fmt);
-            break;
-
-        case '%':
-            pf_push_char(&out, '%');
-            break;
-        }
-
-        if (written_by_conversion < fmt.field.width)
-            pf_add_padding(&out, written_by_conversion, misc, fmt);
-    } // while (1)
+        pf_write_conversion(&out, args, fmt);
+    }
 
     pf_concat(&out, format, strlen(format)); // write what's left in format
     return out.length;
@@ -703,39 +939,342 @@ size_t pf_snprintf(
     return written;
 }
 
+// ------------------------------
+// Precompiled format strings
+
+// Each op writes a literal and then a conversion unless conversion_format is 0.
+// Literals point to the original format string. Registered conversions are
+// looked up when compiling if they are registered already. Registered entries
+// are never moved, so the pointer stays valid.
+typedef struct pf_format_op
+{
+    const char*                   literal;
+    size_t                        literal_length;
+    PFFormatSpecifier             fmt;
+    const PFRegisteredConversion* registered;
+} PFFormatOp;
+
+struct pf_format
+{
+    const char* string;
+    size_t      length; // ops
+    PFFormatOp* ops;
+};
+
+static PFFormat* pf_format_new(const char* format)
+{
+    size_t length = 1;
+    for (const char* c = format; (c = strchr(c, '%')) != NULL; c += 1 + (c[1] == '%'))
+        ++length;
+
+    PFFormat* compiled = gp_mem_alloc(gp_global_heap,
+        sizeof*compiled + length * sizeof compiled->ops[0]);
+    compiled->string = format;
+    compiled->ops    = (PFFormatOp*)(compiled + 1);
+
+    size_t i = 0;
+    while (1)
+    {
+        const PFFormatSpecifier fmt = pf_scan_format_string(format, NULL);
+        if (fmt.string == NULL)
+            break;
+
+        if (fmt.conversion_format == '%') // no need to convert, merge to literal
+            compiled->ops[i++] = (PFFormatOp){ .literal = format, .literal_length = fmt.string + 1 - format };
+        else
+            compiled->ops[i++] = (PFFormatOp){ .literal = format, .literal_length = fmt.string - format, .fmt = fmt,
+                .registered = fmt.conversion_format == '{' ? pf_find_registered(fmt) : NULL };
+        format = fmt.string + fmt.string_length;
+    }
+    compiled->ops[i++] = (PFFormatOp){ .literal = format, .literal_length = strlen(format) };
+    compiled->length = i;
+    return compiled;
+}
+
+// Compiled formats are never freed, there is a finite amount of format strings.
+static GPMap   pf_s_format_cache;
+static GPMutex pf_s_format_cache_mutex;
+
+// Direct mapped cache in front of the shared cache avoids locking.
+#ifndef GP_NO_THREAD_LOCALS
+#define PF_LOCAL_FORMAT_CACHE_SIZE 64
+static GP_MAYBE_THREAD_LOCAL PFFormat* pf_s_local_format_cache[PF_LOCAL_FORMAT_CACHE_SIZE];
+#endif
+
+static void pf_delete_format_cache(void)
+{
+    for (GPMapIterator it = gp_map_begin(pf_s_format_cache)
+        ; it.value != NULL
+        ; it = gp_map_next(it))
+        gp_mem_dealloc(gp_global_heap, *(PFFormat**)it.value);
+    gp_map_delete(pf_s_format_cache);
+    gp_mutex_destroy(&pf_s_format_cache_mutex);
+}
+
+static void pf_init_format_cache(void)
+{
+    pf_s_format_cache = gp_map_new(sizeof(PFFormat*), gp_global_heap, 64);
+    gp_mutex_init(&pf_s_format_cache_mutex);
+    atexit(pf_delete_format_cache); // shut up sanitizer
+}
+
+const PFFormat* pf_compile(const char* format)
+{
+    #ifndef GP_NO_THREAD_LOCALS
+    PFFormat** local = &pf_s_local_format_cache[
+        ((uintptr_t)format >> 3) % PF_LOCAL_FORMAT_CACHE_SIZE];
+    if (*local != NULL && (*local)->string == format)
+        return *local;
+    #endif
+
+    static GPThreadOnce format_cache_once = GP_THREAD_ONCE_INIT;
+    gp_thread_once(&format_cache_once, pf_init_format_cache);
+
+    // Formats are identified by address, which is unique, so it works as hash.
+    const uint64_t key = (uintptr_t)format;
+    gp_mutex_lock(&pf_s_format_cache_mutex);
+    PFFormat** compiled = gp_map_get(pf_s_format_cache, NULL, key);
+    if (compiled == NULL) {
+        PFFormat* new_format = pf_format_new(format);
+        compiled = gp_map_put(&pf_s_format_cache, NULL, key, &new_format);
+    }
+    PFFormat* result = *compiled;
+    gp_mutex_unlock(&pf_s_format_cache_mutex);
+
+    #ifndef GP_NO_THREAD_LOCALS
+    *local = result;
+    #endif
+    return result;
+}
+
+size_t pf_vsnprintf_compiled_consuming_no_null_termination(
+    char*restrict out_buf,
+    const size_t max_size,
+    const PFFormat* format,
+    pf_va_list* args)
+{
+    PFString out = { out_buf ? out_buf : "", .capacity = max_size };
+
+    const PFFormatOp* op = format->ops;
+    for (const PFFormatOp* end = op + format->length - 1; op != end; ++op)
+    {
+        pf_concat(&out, op->literal, op->literal_length);
+        if (op->fmt.conversion_format == '\0')
+            continue;
+
+        PFFormatSpecifier fmt = op->fmt;
+        if (fmt.field.asterisk) { // same as pf_scan_format_string()
+            const int width = va_arg(args->list, int);
+            fmt.field.asterisk = false;
+            fmt.field.width    = width >= 0 ? (unsigned)width : 0;
+        }
+        if (fmt.precision.option == PF_ASTERISK) {
+            const int width = va_arg(args->list, int);
+            fmt.precision.option = width >= 0 ? PF_SOME : PF_NONE;
+            fmt.precision.width  = width >= 0 ? (unsigned)width : 0;
+        }
+        if (op->registered != NULL) {
+            const size_t written = pf_write_registered(&out, args, fmt, op->registered);
+            if (written < fmt.field.width)
+                pf_add_padding(&out, written, (PFMiscData){0}, fmt);
+        } else
+            pf_write_conversion(&out, args, fmt);
+    }
+    pf_concat(&out, op->literal, op->literal_length);
+    return out.length;
+}
+
+size_t pf_vsnprintf_compiled(
+    char*restrict out_buf,
+    const size_t max_size,
+    const PFFormat*restrict format,
+    va_list _args)
+{
+    pf_va_list args;
+    va_copy(args.list, _args);
+    const size_t length = pf_vsnprintf_compiled_consuming_no_null_termination(
+        out_buf, max_size, format, &args);
+    va_end(args.list);
+    if (max_size > 0)
+        out_buf[length < max_size ? length : max_size - 1] = '\0';
+    return length;
+}
+
+size_t pf_snprintf_compiled(
+    char*restrict out_buf, const size_t max_size, const PFFormat*restrict format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    const size_t length = pf_vsnprintf_compiled(out_buf, max_size, format, args);
+    va_end(args);
+    return length;
+}
+
 // ------------------------------
 // IO functtions
 
-#define PAGE_SIZE 4096
-#define BUF_SIZE (PAGE_SIZE + sizeof(""))
+// Streaming output is formatted to a buffer, which is flushed to the sink
+// between conversions, so padding is still inserted within the buffer. A
+// conversion that does not fit the room left is formatted again after flushing.
+#define PF_SINK_BUFFER_SIZE 4096
+#define PF_SINK_CONVERSION_ROOM 128
+
+static void pf_sink_flush(PFString* out, size_t* flushed, const PFSink sink)
+{
+    if (out->length > 0)
+        sink.write(sink.context, out->data, out->length);
+    *flushed += out->length;
+    out->length = 0;
+}
+
+static void pf_sink_literal(
+    PFString* out,
+    size_t* flushed,
+    const PFSink sink,
+    const char* literal,
+    const size_t length)
+{
+    if (length > pf_capacity_left(*out))
+    {
+        pf_sink_flush(out, flushed, sink);
+        if (length > out->capacity) {
+            sink.write(sink.context, literal, length);
+            *flushed += length;
+            return;
+        }
+    }
+    pf_concat(out, literal, length);
+}
+
+static void pf_sink_conversion(
+    PFString* out,
+    size_t* flushed,
+    const PFSink sink,
+    pf_va_list* args,
+    const PFFormatSpecifier fmt)
+{
+    if (pf_capacity_left(*out) < PF_SINK_CONVERSION_ROOM)
+        pf_sink_flush(out, flushed, sink);
+
+    pf_va_list retry;
+    va_copy(retry.list, args->list);
+    const size_t start = out->length;
+    pf_write_conversion(out, args, fmt);
+
+    if (out->length > out->capacity) // truncated, retry with more room
+    {
+        const size_t length = out->length - start;
+        out->length = start;
+        pf_sink_flush(out, flushed, sink);
+        if (length <= out->capacity)
+            pf_write_conversion(out, &retry, fmt);
+        else { // does not fit the buffer at all, rare
+            GPArena* scratch = gp_scratch_arena();
+            PFString big = {
+                gp_mem_alloc(&scratch->base, length), .capacity = length };
+            pf_write_conversion(&big, &retry, fmt);
+            sink.write(sink.context, big.data, length);
+            *flushed += length;
+            gp_arena_rewind(scratch, big.data);
+        }
+    }
+    va_end(retry.list);
+}
+
+static size_t pf_vsinkprintf_consuming(
+    const PFSink sink,
+    const char* format,
+    pf_va_list* args)
+{
+    char buf[PF_SINK_BUFFER_SIZE];
+    PFString out = { buf, .capacity = sizeof buf };
+    size_t flushed = 0;
+
+    while (1)
+    {
+        const PFFormatSpecifier fmt = pf_scan_format_string(format, args);
+        if (fmt.string == NULL)
+            break;
+
+        pf_sink_literal(&out, &flushed, sink, format, fmt.string - format);
+        format = fmt.string + fmt.string_length;
+        pf_sink_conversion(&out, &flushed, sink, args, fmt);
+    }
+    pf_sink_literal(&out, &flushed, sink, format, strlen(format));
+    pf_sink_flush(&out, &flushed, sink);
+    return flushed;
+}
+
+size_t pf_vsinkprintf(
+    const PFSink sink, const char*restrict fmt, va_list _args)
+{
+    pf_va_list args;
+    va_copy(args.list, _args);
+    const size_t length = pf_vsinkprintf_consuming(sink, fmt, &args);
+    va_end(args.list);
+    return length;
+}
+
+size_t pf_sinkprintf(
+    const PFSink sink, const char*restrict fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    const size_t n = pf_vsinkprintf(sink, fmt, args);
+    va_end(args);
+    return n;
+}
+
+static void pf_file_write(void* stream, const char* data, size_t length)
+{
+    fwrite(data, sizeof(char), length, stream);
+}
+
+static void pf_fd_write(void* fd, const char* data, size_t length)
+{
+    const int fildes = *(int*)fd;
+    while (length > 0) // handle partial writes
+    {
+        #if _WIN32
+        const int result = _write(fildes, data, length < INT_MAX ? (unsigned)length : INT_MAX);
+        #else
+        const ssize_t result = write(fildes, data, length);
+        if (result < 0 && errno == EINTR)
+            continue;
+        #endif
+        if (result <= 0)
+            return;
+        data   += result;
+        length -= result;
+    }
+}
 
 size_t pf_vfprintf(
     FILE*restrict stream, const char*restrict fmt, va_list args)
 {
-    char buf[BUF_SIZE];
-    char* pbuf = buf;
-    va_list args_copy;
-    va_copy(args_copy, args);
-
-    const size_t out_length = pf_vsnprintf(buf, BUF_SIZE, fmt, args);
-    if (out_length >= BUF_SIZE) // try again from the very beginning. Why not
-    {                           // flush and continue where we left off? Because
-                                // we don't where to continue from without state,
-                                // which would make average case slower, this
-                                // has worst case of 2x slowdown, usually less.
-                                // I you have a better idea, feel free to implement.
-        // TODO TODO WHY IS MALLOC HERE?? WE **DO NOT** USE MALLOC!!!!!
-        // Also, why do we bother with null-termination when using fwrite() anyway??
-        pbuf = malloc(out_length + sizeof(""));
-
-        pf_vsprintf(pbuf, fmt, args_copy);
-    }
-    fwrite(pbuf, sizeof(char), out_length, stream);
-
-    if (pbuf != buf)
-        free(pbuf);
-    va_end(args_copy);
-    return out_length;
+    return pf_vsinkprintf((PFSink){ pf_file_write, stream }, fmt, args);
+}
+
+size_t pf_vfprintf_consuming(
+    FILE*restrict stream, const char*restrict fmt, pf_va_list* args)
+{
+    return pf_vsinkprintf_consuming((PFSink){ pf_file_write, stream }, fmt, args);
+}
+
+size_t pf_vdprintf(
+    int fd, const char*restrict fmt, va_list args)
+{
+    return pf_vsinkprintf((PFSink){ pf_fd_write, &fd }, fmt, args);
+}
+
+size_t pf_dprintf(
+    int fd, const char*restrict fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    size_t n = pf_vdprintf(fd, fmt, args);
+    va_end(args);
+    return n;
 }
 
 size_t pf_vprintf(
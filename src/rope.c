@@ -0,0 +1,336 @@
+// MIT License
+// Copyright (c) 2023 Lauri Lorenzo Fiestas
+// https://github.com/PrinssiFiestas/libGPC/blob/main/LICENSE.md
+
+#include <gpc/rope.h>
+#include <gpc/utils.h>
+#include <gpc/unicode.h>
+#include <string.h>
+
+// Implicit treap: nodes are ordered by position and heap ordered by random
+// priority, which keeps the tree balanced with high probability. Each node owns
+// a chunk of the string. Splitting a chunk copies at most GP_ROPE_CHUNK_SIZE
+// bytes, so all edits are O(log n) excluding the edited bytes themselves.
+
+typedef struct gp_rope_node
+{
+    struct gp_rope_node* left;
+    struct gp_rope_node* right;
+    size_t   length;          // subtree bytes
+    size_t   codepoint_count; // subtree non-continuation bytes
+    uint32_t priority;
+    uint32_t chunk_length;
+    uint32_t chunk_capacity;
+    uint32_t chunk_codepoint_count;
+    uint8_t  chunk[];
+} GPRopeNode;
+
+struct gp_rope
+{
+    GPAllocator*  allocator;
+    GPRopeNode*   root;
+    GPRandomState random_state; // node priorities
+};
+
+#define GP_ROPE_MIN_CHUNK_CAPACITY 64
+
+// Counts bytes that are not continuation bytes. Unlike gp_str_codepoint_count(),
+// this does not look at surrounding bytes, so counts stay additive when chunks
+// are split in the middle of a codepoint.
+static size_t gp_s_rope_count_codepoints(const void* bytes, size_t length)
+{
+    return length == 0 ? 0 : gp_utf32_length_from_utf8(bytes, length);
+}
+
+static size_t gp_s_rope_node_length(const GPRopeNode* node)
+{
+    return node == NULL ? 0 : node->length;
+}
+
+static size_t gp_s_rope_node_codepoint_count(const GPRopeNode* node)
+{
+    return node == NULL ? 0 : node->codepoint_count;
+}
+
+static void gp_s_rope_update(GPRopeNode* node)
+{
+    node->length = node->chunk_length
+        + gp_s_rope_node_length(node->left)
+        + gp_s_rope_node_length(node->right);
+    node->codepoint_count = node->chunk_codepoint_count
+        + gp_s_rope_node_codepoint_count(node->left)
+        + gp_s_rope_node_codepoint_count(node->right);
+}
+
+static GPRopeNode* gp_s_rope_node_new(
+    GPRope rope, const void* chunk, size_t length, uint32_t priority)
+{
+    gp_db_assert(length <= UINT32_MAX);
+    const size_t capacity = gp_max(length, (size_t)GP_ROPE_MIN_CHUNK_CAPACITY);
+    GPRopeNode* node = gp_mem_alloc(rope->allocator, sizeof*node + capacity);
+    *node = (GPRopeNode){
+        .priority              = priority,
+        .chunk_length          = length,
+        .chunk_capacity        = capacity,
+        .chunk_codepoint_count = gp_s_rope_count_codepoints(chunk, length)
+    };
+    memcpy(node->chunk, chunk, length);
+    gp_s_rope_update(node);
+    return node;
+}
+
+static void gp_s_rope_node_delete(GPRope rope, GPRopeNode* node)
+{
+    if (node == NULL)
+        return;
+    gp_s_rope_node_delete(rope, node->left);
+    gp_s_rope_node_delete(rope, node->right);
+    gp_mem_dealloc(rope->allocator, node);
+}
+
+static GPRopeNode* gp_s_rope_merge(GPRopeNode* l, GPRopeNode* r)
+{
+    if (l == NULL)
+        return r;
+    if (r == NULL)
+        return l;
+    if (l->priority > r->priority) {
+        l->right = gp_s_rope_merge(l->right, r);
+        gp_s_rope_update(l);
+        return l;
+    }
+    r->left = gp_s_rope_merge(l, r->left);
+    gp_s_rope_update(r);
+    return r;
+}
+
+// Split to bytes before position and bytes starting from position.
+static void gp_s_rope_split(
+    GPRope       rope,
+    GPRopeNode*  node,
+    size_t       position,
+    GPRopeNode** l,
+    GPRopeNode** r)
+{
+    if (node == NULL) {
+        *l = *r = NULL;
+        return;
+    }
+    const size_t left_length = gp_s_rope_node_length(node->left);
+    if (position <= left_length) {
+        gp_s_rope_split(rope, node->left, position, l, &node->left);
+        gp_s_rope_update(node);
+        *r = node;
+    } else if (position >= left_length + node->chunk_length) {
+        gp_s_rope_split(
+            rope, node->right, position - left_length - node->chunk_length, &node->right, r);
+        gp_s_rope_update(node);
+        *l = node;
+    } else { // split chunk, tail inherits priority to keep heap order
+        const size_t offset = position - left_length;
+        GPRopeNode* tail = gp_s_rope_node_new(
+            rope, node->chunk + offset, node->chunk_length - offset, node->priority);
+        tail->right = node->right;
+        gp_s_rope_update(tail);
+
+        node->right                 = NULL;
+        node->chunk_length          = offset;
+        node->chunk_codepoint_count -= tail->chunk_codepoint_count;
+        gp_s_rope_update(node);
+        *l = node;
+        *r = tail;
+    }
+}
+
+// Fill spare capacity of the last chunk to avoid creating tiny chunks when
+// inserting repeatedly to the same position.
+static size_t gp_s_rope_append_last_chunk(
+    GPRopeNode* node, const void* src, size_t length)
+{
+    if (node == NULL)
+        return 0;
+    size_t appended;
+    if (node->right != NULL)
+        appended = gp_s_rope_append_last_chunk(node->right, src, length);
+    else {
+        appended = gp_min(length, (size_t)(node->chunk_capacity - node->chunk_length));
+        memcpy(node->chunk + node->chunk_length, src, appended);
+        node->chunk_codepoint_count += gp_s_rope_count_codepoints(src, appended);
+        node->chunk_length          += appended;
+    }
+    gp_s_rope_update(node);
+    return appended;
+}
+
+GPRope gp_rope_new(
+    GPAllocator* allocator,
+    const void*  init,
+    size_t       init_length)
+{
+    GPRope rope = gp_mem_alloc(allocator, sizeof*rope);
+    *rope = (struct gp_rope){
+        .allocator    = allocator,
+        .random_state = gp_random_state_seed(0, (uintptr_t)rope)
+    };
+    if (init != NULL)
+        gp_rope_insert(rope, 0, init, init_length);
+    return rope;
+}
+
+void gp_rope_delete(GPRope rope)
+{
+    if (rope == NULL)
+        return;
+    gp_s_rope_node_delete(rope, rope->root);
+    gp_mem_dealloc(rope->allocator, rope);
+}
+
+size_t gp_rope_length(GPRope rope)
+{
+    return gp_s_rope_node_length(rope->root);
+}
+
+size_t gp_rope_codepoint_count(GPRope rope)
+{
+    return gp_s_rope_node_codepoint_count(rope->root);
+}
+
+size_t gp_rope_codepoint_index(GPRope rope, size_t codepoint_index)
+{
+    gp_db_assert(codepoint_index <= gp_rope_codepoint_count(rope), "Index out of bounds.");
+    size_t base = 0;
+    const GPRopeNode* node = rope->root;
+    while (node != NULL)
+    {
+        const size_t left_count = gp_s_rope_node_codepoint_count(node->left);
+        if (codepoint_index < left_count) {
+            node = node->left;
+            continue;
+        }
+        codepoint_index -= left_count;
+        base += gp_s_rope_node_length(node->left);
+        if (codepoint_index < node->chunk_codepoint_count) {
+            for (size_t i = 0; i < node->chunk_length; ++i)
+                if ((node->chunk[i] & 0xC0) != 0x80 && codepoint_index-- == 0)
+                    return base + i;
+            GP_UNREACHABLE("Invalid chunk codepoint count.");
+        }
+        codepoint_index -= node->chunk_codepoint_count;
+        base += node->chunk_length;
+        node = node->right;
+    }
+    return base;
+}
+
+// Find chunk containing byte at position and store offset of position in chunk.
+static const GPRopeNode* gp_s_rope_find(
+    const GPRopeNode* node, size_t position, size_t* offset)
+{
+    while (node != NULL)
+    {
+        const size_t left_length = gp_s_rope_node_length(node->left);
+        if (position < left_length) {
+            node = node->left;
+        } else if (position < left_length + node->chunk_length) {
+            *offset = position - left_length;
+            return node;
+        } else {
+            position -= left_length + node->chunk_length;
+            node = node->right;
+        }
+    }
+    return NULL;
+}
+
+uint8_t gp_rope_at(GPRope rope, size_t index)
+{
+    gp_db_assert(index < gp_rope_length(rope), "Index out of bounds.");
+    size_t offset = 0;
+    return gp_s_rope_find(rope->root, index, &offset)->chunk[offset];
+}
+
+void gp_rope_insert(
+    GPRope      rope,
+    size_t      position,
+    const void* _src,
+    size_t      src_length)
+{
+    gp_db_assert(position <= gp_rope_length(rope), "Index out of bounds.");
+    const uint8_t* src = _src;
+    GPRopeNode *l, *r, *middle = NULL;
+    gp_s_rope_split(rope, rope->root, position, &l, &r);
+
+    const size_t appended = gp_s_rope_append_last_chunk(l, src, src_length);
+    for (size_t i = appended; i < src_length; i += GP_ROPE_CHUNK_SIZE)
+        middle = gp_s_rope_merge(middle, gp_s_rope_node_new(
+            rope,
+            src + i,
+            gp_min(src_length - i, (size_t)GP_ROPE_CHUNK_SIZE),
+            gp_random(&rope->random_state)));
+
+    rope->root = gp_s_rope_merge(gp_s_rope_merge(l, middle), r);
+}
+
+void gp_rope_erase(
+    GPRope rope,
+    size_t position,
+    size_t count)
+{
+    gp_db_assert(position + count <= gp_rope_length(rope), "Index out of bounds.");
+    GPRopeNode *l, *middle, *r;
+    gp_s_rope_split(rope, rope->root, position, &l, &r);
+    gp_s_rope_split(rope, r, count, &middle, &r);
+    gp_s_rope_node_delete(rope, middle);
+    rope->root = gp_s_rope_merge(l, r);
+}
+
+void gp_rope_slice(
+    GPRope rope,
+    size_t start,
+    size_t end)
+{
+    gp_db_assert(start <= end, "Invalid range.");
+    gp_db_assert(end <= gp_rope_length(rope), "Index out of bounds.");
+    GPRopeNode *l, *middle, *r;
+    gp_s_rope_split(rope, rope->root, end, &middle, &r);
+    gp_s_rope_node_delete(rope, r);
+    gp_s_rope_split(rope, middle, start, &l, &middle);
+    gp_s_rope_node_delete(rope, l);
+    rope->root = middle;
+}
+
+size_t gp_rope_flatten(GPString* out, GPRope rope)
+{
+    const size_t length  = gp_rope_length(rope);
+    const size_t trunced = gp_str_reserve(out, length);
+    gp_str_set(*out)->length = 0;
+
+    GPRopeIterator it = gp_rope_iterator(rope, 0);
+    while (gp_rope_next(&it) && gp_str_length(*out) < length - trunced) {
+        const size_t copy_length = gp_min(
+            it.chunk_length, length - trunced - gp_str_length(*out));
+        memcpy(*out + gp_str_length(*out), it.chunk, copy_length);
+        gp_str_set(*out)->length += copy_length;
+    }
+    return trunced;
+}
+
+GPRopeIterator gp_rope_iterator(GPRope rope, size_t start)
+{
+    gp_db_assert(start <= gp_rope_length(rope), "Index out of bounds.");
+    return (GPRopeIterator){ ._rope = rope, ._position = start };
+}
+
+bool gp_rope_next(GPRopeIterator* it)
+{
+    size_t offset = 0;
+    const GPRopeNode* node = gp_s_rope_find(it->_rope->root, it->_position, &offset);
+    if (node == NULL) {
+        it->chunk_length = 0;
+        return false;
+    }
+    it->chunk        = (const char*)node->chunk + offset;
+    it->chunk_length = node->chunk_length - offset;
+    it->_position   += it->chunk_length;
+    return true;
+}
@@ -39,6 +39,10 @@ int d2exp_buffered_n(double d, uint32_t precision, char* result);
 void d2exp_buffered(double d, uint32_t precision, char* result);
 char* d2exp(double d, uint32_t precision);
 
+// libGPC additions
+void d2s_decimal(double f, uint64_t* mantissa, int32_t* exponent);
+void f2s_decimal(float f, uint32_t* mantissa, int32_t* exponent);
+
 #ifdef __cplusplus
 }
 #endif
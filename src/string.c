@@ -7,7 +7,9 @@
 #include <gpc/utils.h>
 #include <gpc/array.h>
 #include <gpc/unicode.h>
+#include <gpc/hashmap.h>
 #include <printf/printf.h>
+#include <printf/conversions.h>
 #include "common.h"
 #include <stdarg.h>
 #include <wchar.h>
@@ -51,6 +53,80 @@ size_t gp_str_replace(
     gp_str_set(*dest)->length = position + replacement_length + tail_length;
     return trunced;
 }
+static size_t gp_s_str_replace_all(
+    GPString*                    haystack,
+    const GPInternalReplacement* replacements,
+    size_t                       replacements_length,
+    size_t*                      optional_replacement_count)
+{
+    // Matches cannot live in the scratch arena if haystack does too, rewinding
+    // would free reallocated haystack.
+    GPArena*     scratch   = gp_scratch_arena();
+    GPAllocator* allocator = gp_str_allocator(*haystack) == &scratch->base ?
+        gp_global_heap : &scratch->base;
+    GPArray(GPInternalMatch) matches = gp_arr_new(sizeof matches[0], allocator, 32);
+    void* scratch_position = gp_arr_allocation(matches);
+
+    const size_t length     = gp_str_length(*haystack);
+    const size_t out_length = gp_internal_bytes_find_all(
+        &matches, *haystack, length, replacements, replacements_length);
+    size_t trunced = 0;
+    if (gp_arr_length(matches) != 0)
+    {
+        if (out_length > length)
+            trunced = gp_str_reserve(haystack, out_length);
+        gp_internal_bytes_replace_matches(
+            *haystack, length, gp_str_capacity(*haystack), out_length, replacements, matches);
+        gp_str_set(*haystack)->length = out_length - trunced;
+    }
+
+    if (optional_replacement_count != NULL)
+        *optional_replacement_count = gp_arr_length(matches);
+    if (allocator == &scratch->base)
+        gp_arena_rewind(scratch, scratch_position);
+    else
+        gp_arr_delete(matches);
+    return trunced;
+}
+
+size_t gp_str_replace_all(
+    GPString*   haystack,
+    const void* needle,
+    size_t      needle_length,
+    const void* replacement,
+    size_t      replacement_length,
+    size_t*     optional_replacement_count)
+{
+    const GPInternalReplacement r = {
+        needle, needle_length, replacement, replacement_length };
+    return gp_s_str_replace_all(haystack, &r, 1, optional_replacement_count);
+}
+
+size_t gp_str_replace_many(
+    GPString*         haystack,
+    size_t            count,
+    const char*const* needles,
+    const char*const* replacements,
+    size_t*           optional_replacement_count)
+{
+    // Like matches in gp_s_str_replace_all(), rewinding would free haystack.
+    GPArena*     scratch   = gp_scratch_arena();
+    GPAllocator* allocator = gp_str_allocator(*haystack) == &scratch->base ?
+        gp_global_heap : &scratch->base;
+    GPInternalReplacement* rs = gp_mem_alloc(allocator, count * sizeof rs[0]);
+    for (size_t i = 0; i < count; ++i)
+        rs[i] = (GPInternalReplacement){
+            needles[i], strlen(needles[i]), replacements[i], strlen(replacements[i]) };
+
+    const size_t trunced = gp_s_str_replace_all(
+        haystack, rs, count, optional_replacement_count);
+    if (allocator == &scratch->base)
+        gp_arena_rewind(scratch, rs);
+    else
+        gp_mem_dealloc(allocator, rs);
+    return trunced;
+}
+
 size_t gp_str_find_first_of(
     const GPString   haystack,
     const char*const char_set,
@@ -101,6 +177,8 @@ bool gp_str_equal(
 {
     if (gp_str_length(s1) != s2_size)
         return false;
+    else if ((const void*)s1 == s2) // interned
+        return true;
     else
         return memcmp(s1, s2, s2_size) == 0;
 }
@@ -157,16 +235,292 @@ bool gp_str_is_valid(
     return gp_bytes_is_valid_utf8(str, gp_str_length(str), invalid_index);
 }
 
+// ----------------------------------------------------------------------------
+// String builder
+
+#define GP_STR_BUILDER_STORAGE_SIZE 256
+#define GP_STR_BUILDER_MAX_NUMBER_LENGTH 32
+
+// Storage blocks are linked trough their first bytes for deallocation.
+static char* gp_s_str_builder_storage(GPStrBuilder* builder, size_t length)
+{
+    if (builder->_storage_capacity - builder->_storage_length >= length) {
+        builder->_storage_length += length;
+        return builder->_storage + builder->_storage_length - length;
+    }
+    const size_t capacity = gp_max(length, (size_t)GP_STR_BUILDER_STORAGE_SIZE);
+    char* block = gp_mem_alloc(builder->_allocator, sizeof(char*) + capacity);
+    memcpy(block, &builder->_storage, sizeof(char*));
+    builder->_storage          = block + sizeof(char*);
+    builder->_storage_length   = length;
+    builder->_storage_capacity = capacity;
+    return builder->_storage;
+}
+
+// Unused storage after the last segment can be given back.
+static void gp_s_str_builder_storage_shrink(
+    GPStrBuilder* builder, const char* storage, size_t used)
+{
+    if (storage + used > builder->_storage
+        && storage + used <= builder->_storage + builder->_storage_length)
+        builder->_storage_length = storage + used - builder->_storage;
+}
+
+GPStrBuilder gp_str_builder(GPAllocator* allocator)
+{
+    return (GPStrBuilder){
+        ._allocator = allocator,
+        ._segments  = gp_arr_new(sizeof(GPStrSegment), allocator, 16)
+    };
+}
+
+void gp_str_builder_delete(GPStrBuilder* builder)
+{
+    gp_arr_delete(builder->_segments);
+    for (char* block = builder->_storage; block != NULL; )
+    {
+        char* previous;
+        memcpy(&previous, block - sizeof(char*), sizeof(char*));
+        gp_mem_dealloc(builder->_allocator, block - sizeof(char*));
+        block = previous;
+    }
+    *builder = (GPStrBuilder){0};
+}
+
+void gp_str_builder_append(
+    GPStrBuilder* builder,
+    const void*   str,
+    const size_t  str_length)
+{
+    builder->length += str_length;
+    const size_t segments_length = gp_arr_length(builder->_segments);
+    if (segments_length != 0) { // merge contiguous segments
+        GPStrSegment* last = &builder->_segments[segments_length - 1];
+        if (last->data + last->length == (const char*)str) {
+            last->length += str_length;
+            return;
+        }
+    }
+    const GPStrSegment segment = { .data = str, .length = str_length };
+    gp_arr_push(sizeof segment, &builder->_segments, &segment);
+}
+
+void gp_str_builder_append_copy(
+    GPStrBuilder* builder,
+    const void*   str,
+    const size_t  str_length)
+{
+    char* copy = gp_s_str_builder_storage(builder, str_length);
+    gp_str_builder_append(builder, memcpy(copy, str, str_length), str_length);
+}
+
+void gp_str_builder_uint(GPStrBuilder* builder, unsigned long long x)
+{
+    char* buf = gp_s_str_builder_storage(builder, GP_STR_BUILDER_MAX_NUMBER_LENGTH);
+    const size_t length = pf_utoa(GP_STR_BUILDER_MAX_NUMBER_LENGTH, buf, x);
+    gp_s_str_builder_storage_shrink(builder, buf, length);
+    gp_str_builder_append(builder, buf, length);
+}
+
+void gp_str_builder_int(GPStrBuilder* builder, long long x)
+{
+    char* buf = gp_s_str_builder_storage(builder, GP_STR_BUILDER_MAX_NUMBER_LENGTH);
+    const size_t length = pf_itoa(GP_STR_BUILDER_MAX_NUMBER_LENGTH, buf, x);
+    gp_s_str_builder_storage_shrink(builder, buf, length);
+    gp_str_builder_append(builder, buf, length);
+}
+
+void gp_str_builder_double(GPStrBuilder* builder, double x)
+{
+    char* buf = gp_s_str_builder_storage(builder, GP_STR_BUILDER_MAX_NUMBER_LENGTH);
+    const size_t length = pf_gtoa(GP_STR_BUILDER_MAX_NUMBER_LENGTH, buf, x);
+    gp_s_str_builder_storage_shrink(builder, buf, length);
+    gp_str_builder_append(builder, buf, length);
+}
+
+size_t gp_str_builder_write_buffer(
+    void*               buffer,
+    const size_t        capacity,
+    const GPStrBuilder* builder)
+{
+    size_t length = 0;
+    for (size_t i = 0; i < gp_arr_length(builder->_segments) && length < capacity; ++i)
+    {
+        const size_t copy_length = gp_min(builder->_segments[i].length, capacity - length);
+        memcpy((char*)buffer + length, builder->_segments[i].data, copy_length);
+        length += copy_length;
+    }
+    return builder->length;
+}
+
+static bool gp_s_str_builder_aliases(const GPStrBuilder* builder, const GPString str)
+{
+    const char* begin = (const char*)str;
+    const char* end   = begin + gp_str_capacity(str);
+    for (size_t i = 0; i < gp_arr_length(builder->_segments); ++i)
+        if (builder->_segments[i].data < end
+            && begin < builder->_segments[i].data + builder->_segments[i].length)
+            return true;
+    return false;
+}
+
+size_t gp_str_builder_write(
+    GPString*           dest,
+    const GPStrBuilder* builder)
+{
+    if ( ! gp_s_str_builder_aliases(builder, *dest)) {
+        const size_t trunced = gp_str_reserve(dest, builder->length);
+        gp_str_set(*dest)->length = gp_str_builder_write_buffer(
+            *dest, builder->length - trunced, builder) - trunced;
+        return trunced;
+    }
+
+    // Segments refer to dest, which would be overwritten or freed when
+    // reallocating, so build to a separate buffer first. The buffer cannot live
+    // in the scratch arena if dest does too, rewinding would free reallocated
+    // dest.
+    GPArena*     scratch   = gp_scratch_arena();
+    GPAllocator* allocator = gp_str_allocator(*dest) == &scratch->base ?
+        gp_global_heap : &scratch->base;
+    char* buffer = gp_mem_alloc(allocator, builder->length);
+    gp_str_builder_write_buffer(buffer, builder->length, builder);
+    const size_t trunced = gp_str_copy(dest, buffer, builder->length);
+    if (allocator == &scratch->base)
+        gp_arena_rewind(scratch, buffer);
+    else
+        gp_mem_dealloc(allocator, buffer);
+    return trunced;
+}
+
+// ----------------------------------------------------------------------------
+// String interning
+
+struct gp_intern_table
+{
+    GPAllocator*      allocator;
+    GPArena*          arena;     // string storage
+    GPArray(GPString) strings;   // indexed by id
+    GPArray(uint64_t) hashes;    // indexed by id
+    uint32_t*         slots;     // open addressing, id + 1 or 0 if empty
+    size_t            slot_mask;
+};
+
+GPInternTable gp_intern_table_new(GPAllocator* allocator)
+{
+    const size_t init_slots = 64;
+    GPInternTable table = gp_mem_alloc(allocator, sizeof*table);
+    *table = (struct gp_intern_table){
+        .allocator = allocator,
+        .arena     = gp_arena_new(&(GPArenaInitializer){
+            .backing_allocator = allocator }, 4096),
+        .strings   = gp_arr_new(sizeof(GPString), allocator, init_slots / 2),
+        .hashes    = gp_arr_new(sizeof(uint64_t), allocator, init_slots / 2),
+        .slots     = gp_mem_alloc_zeroes(allocator, init_slots * sizeof(uint32_t)),
+        .slot_mask = init_slots - 1
+    };
+    return table;
+}
+
+void gp_intern_table_delete(GPInternTable table)
+{
+    if (table == NULL)
+        return;
+    gp_arena_delete(table->arena);
+    gp_arr_delete(table->strings);
+    gp_arr_delete(table->hashes);
+    gp_mem_dealloc(table->allocator, table->slots);
+    gp_mem_dealloc(table->allocator, table);
+}
+
+// Returns slot containing the string or the empty slot where it should go.
+static size_t gp_s_intern_slot(
+    GPInternTable table, const void* str, size_t length, uint64_t hash)
+{
+    for (size_t i = hash & table->slot_mask;; i = (i + 1) & table->slot_mask)
+    {
+        const uint32_t slot = table->slots[i];
+        if (slot == 0)
+            return i;
+        if (table->hashes[slot - 1] == hash
+            && gp_str_equal(table->strings[slot - 1], str, length))
+            return i;
+    }
+}
+
+static void gp_s_intern_grow(GPInternTable table)
+{
+    const size_t slots_length = 2 * (table->slot_mask + 1);
+    gp_mem_dealloc(table->allocator, table->slots);
+    table->slots     = gp_mem_alloc_zeroes(table->allocator, slots_length * sizeof(uint32_t));
+    table->slot_mask = slots_length - 1;
+
+    for (size_t id = 0; id < gp_arr_length(table->strings); ++id) {
+        size_t i = table->hashes[id] & table->slot_mask;
+        while (table->slots[i] != 0)
+            i = (i + 1) & table->slot_mask;
+        table->slots[i] = id + 1;
+    }
+}
+
+uint32_t gp_intern(
+    GPInternTable table,
+    const void*   str,
+    const size_t  length)
+{
+    const uint64_t hash = gp_bytes_hash(str, length);
+    const size_t   i    = gp_s_intern_slot(table, str, length, hash);
+    if (table->slots[i] != 0)
+        return table->slots[i] - 1;
+
+    const size_t id = gp_arr_length(table->strings);
+    gp_assert(id < UINT32_MAX - 1, "Too many interned strings.");
+
+    GPStringHeader* header = gp_mem_alloc(
+        &table->arena->base, sizeof*header + length + sizeof"");
+    *header = (GPStringHeader){ .capacity = length, .length = length };
+    GPString interned = memcpy(header + 1, str, length);
+    interned[length].c = '\0';
+
+    gp_arr_push(sizeof interned, &table->strings, &interned);
+    gp_arr_push(sizeof hash, &table->hashes, &hash);
+    table->slots[i] = id + 1;
+
+    if (2 * gp_arr_length(table->strings) > table->slot_mask)
+        gp_s_intern_grow(table);
+    return id;
+}
+
+uint32_t gp_intern_find(
+    GPInternTable table,
+    const void*   str,
+    const size_t  length)
+{
+    const size_t i = gp_s_intern_slot(table, str, length, gp_bytes_hash(str, length));
+    return table->slots[i] - 1;
+}
+
+GPString gp_interned_str(GPInternTable table, uint32_t id)
+{
+    gp_db_assert(id < gp_arr_length(table->strings), "Invalid id.");
+    return table->strings[id];
+}
+
+uint64_t gp_interned_hash(GPInternTable table, uint32_t id)
+{
+    gp_db_assert(id < gp_arr_length(table->hashes), "Invalid id.");
+    return table->hashes[id];
+}
+
 static size_t gp_s_printable_max_allocation_size(GPInternalReflectionData object, pf_va_list _args)
 {
     va_list args;
     va_copy(args, _args.list);
 
     size_t length = 0;
-    if (object.identifier[0] == '\"')
+    if (object.identifier[0] == '\"') // estimate, see gp_s_str_print_object()
     {
         const char* fmt = va_arg(args, char*);
-        length = pf_vsnprintf(NULL, 0, fmt, args);
+        length = strlen(fmt);
     }
     else {
         switch (object.type)
@@ -196,8 +550,8 @@ static size_t gp_s_printable_max_allocation_size(GPInternalReflectionData object
             break;
 
         case GP_TYPE_FLOAT:
-        case GP_TYPE_DOUBLE: // %g
-            length = sizeof"-0.111111e-9999"-sizeof"";
+        case GP_TYPE_DOUBLE: // shortest round trip representation
+            length = sizeof"-2.2250738585072014e-308"-sizeof"";
             break;
 
         case GP_TYPE_PTR:
@@ -223,6 +577,45 @@ static size_t gp_s_printable_max_allocation_size(GPInternalReflectionData object
     return length;
 }
 
+// Objects are converted directly to the remaining capacity. Conversions of
+// format strings may not fit, in which case the capacity is increased and only
+// the overflowing object is converted again, which is rare with exponential
+// growth of capacity. This is faster than finding the length of formatted
+// output first, which would format everything twice.
+static size_t gp_s_str_print_object(
+    GPString* out,
+    pf_va_list* args,
+    size_t* i,
+    const GPInternalReflectionData* objs)
+{
+    const size_t start = gp_str_length(*out);
+    gp_str_reserve(out, start + gp_s_printable_max_allocation_size(objs[*i], *args));
+
+    const bool is_format = objs[*i].identifier[0] == '\"';
+    const size_t first_i = *i;
+    pf_va_list first_args;
+    if (is_format)
+        va_copy(first_args.list, args->list);
+
+    size_t length = gp_internal_bytes_print_objects(
+        gp_str_capacity(*out) - start, *out + start, args, i, objs[*i]);
+
+    if (is_format) {
+        if (start + length > gp_str_capacity(*out) && gp_str_reserve(out, start + length) == 0) {
+            va_end(args->list);
+            va_copy(args->list, first_args.list);
+            *i = first_i;
+            length = gp_internal_bytes_print_objects(
+                gp_str_capacity(*out) - start, *out + start, args, i, objs[*i]);
+        }
+        va_end(first_args.list);
+    }
+
+    const size_t trunced = gp_imax(0, start + length - gp_str_capacity(*out));
+    gp_str_set(*out)->length += length - trunced;
+    return trunced;
+}
+
 size_t gp_internal_str_print(
     GPString* out,
     size_t arg_count,
@@ -237,22 +630,7 @@ size_t gp_internal_str_print(
     size_t trunced_total = 0;
     gp_str_set(*out)->length = 0;
     for (size_t i = 0; i < arg_count; i++)
-    {
-        gp_str_reserve(
-            out,
-            gp_str_length(*out) + gp_s_printable_max_allocation_size(objs[i], args));
-
-        size_t converted_obj_length = gp_internal_bytes_print_objects(
-            gp_imax(0, gp_str_capacity(*out) - gp_str_length(*out)),
-            *out + gp_str_length(*out),
-            &args,
-            &i,
-            objs[i]);
-
-        size_t trunced = gp_imax(0, gp_str_length(*out) + converted_obj_length - gp_str_capacity(*out));
-        gp_str_set(*out)->length += converted_obj_length - trunced;
-        trunced_total += trunced;
-    }
+        trunced_total += gp_s_str_print_object(out, &args, &i, objs);
     va_end(_args);
     va_end(args.list);
 
@@ -274,21 +652,8 @@ size_t gp_internal_str_println(
     gp_str_set(*out)->length = 0;
     for (size_t i = 0; i < arg_count; i++)
     {
-        gp_str_reserve(
-            out,
-            gp_str_length(*out) + sizeof" "-sizeof"" + gp_s_printable_max_allocation_size(
-                objs[i], args));
-
-        size_t converted_obj_length = gp_internal_bytes_print_objects(
-            gp_imax(0, gp_str_capacity(*out) - gp_str_length(*out)),
-            *out + gp_str_length(*out),
-            &args,
-            &i,
-            objs[i]);
-
-        size_t trunced = gp_imax(0, gp_str_length(*out) + converted_obj_length - gp_str_capacity(*out));
-        gp_str_set(*out)->length += converted_obj_length - trunced;
-        trunced_total += trunced + gp_arr_push(sizeof(GPChar), out, &(GPChar){' '});
+        trunced_total += gp_s_str_print_object(out, &args, &i, objs);
+        trunced_total += gp_arr_push(sizeof(GPChar), out, &(GPChar){' '});
     }
     va_end(_args);
     va_end(args.list);
@@ -298,6 +663,49 @@ size_t gp_internal_str_println(
     return trunced_total;
 }
 
+// Total length is known before copying, so unlike gp_internal_str_print(), this
+// reserves exactly once and never converts twice.
+static size_t gp_s_str_print_formatted(
+    GPString* out,
+    const size_t arg_count,
+    const GPInternalFormatted* objs,
+    const bool add_spaces)
+{
+    size_t length = add_spaces ? arg_count : 0;
+    for (size_t i = 0; i < arg_count; i++)
+        length += objs[i].length;
+
+    const size_t trunced = gp_str_reserve(out, length);
+    const size_t capacity = length - trunced;
+    size_t position = 0;
+    for (size_t i = 0; i < arg_count && position < capacity; i++)
+    {
+        const size_t n = gp_min(objs[i].length, capacity - position);
+        memcpy(*out + position, objs[i].data != NULL ? objs[i].data : objs[i].buffer, n);
+        position += n;
+        if (add_spaces && position < capacity)
+            (*out)[position++].c = i < arg_count - 1 ? ' ' : '\n';
+    }
+    gp_str_set(*out)->length = capacity;
+    return trunced;
+}
+
+size_t gp_internal_str_print_formatted(
+    GPString* out,
+    const size_t arg_count,
+    const GPInternalFormatted* objs)
+{
+    return gp_s_str_print_formatted(out, arg_count, objs, false);
+}
+
+size_t gp_internal_str_println_formatted(
+    GPString* out,
+    const size_t arg_count,
+    const GPInternalFormatted* objs)
+{
+    return gp_s_str_print_formatted(out, arg_count, objs, true);
+}
+
 static size_t gp_s_str_trim_invalid(
     GPString str, size_t length, const char* char_set, bool left, bool right)
 {
@@ -462,6 +870,12 @@ size_t gp_str_to_upper(GPString* str)
         if (i >= gp_str_length(*str))
             return 0;
 
+        if ((*str)[i].c < 0x80) { // ASCII fast path
+            if ('a' <= (*str)[i].c && (*str)[i].c <= 'z')
+                (*str)[i].c &= ~('a'^'A');
+            bytes_read = 1;
+            continue;
+        }
         bytes_read = gp_utf8_decode(&decoding, *str, gp_str_length(*str), i, &is_valid);
         if ( ! is_valid) // leave invalids unprocessed
             continue;
@@ -520,6 +934,12 @@ size_t gp_str_to_lower(GPString* str)
         if (i >= gp_str_length(*str))
             return 0;
 
+        if ((*str)[i].c < 0x80) { // ASCII fast path
+            if ('A' <= (*str)[i].c && (*str)[i].c <= 'Z')
+                (*str)[i].c |= 'a'^'A';
+            bytes_read = 1;
+            continue;
+        }
         bytes_read = gp_utf8_decode(&decoding, *str, gp_str_length(*str), i, &is_valid);
         if ( ! is_valid) // leave invalids unprocessed
             continue;
@@ -582,6 +1002,12 @@ size_t gp_str_to_title(GPString* str)
         if (i >= gp_str_length(*str))
             return 0;
 
+        if ((*str)[i].c < 0x80) { // ASCII fast path
+            if ('a' <= (*str)[i].c && (*str)[i].c <= 'z')
+                (*str)[i].c &= ~('a'^'A');
+            bytes_read = 1;
+            continue;
+        }
         bytes_read = gp_utf8_decode(&decoding, *str, gp_str_length(*str), i, &is_valid);
         if ( ! is_valid) // leave invalids unprocessed
             continue;
@@ -7,6 +7,9 @@
 #include <gpc/hashmap.h>
 #include <gpc/thread.h>
 #include "common.h"
+#include "case_table.h"
+#include "break_table.h"
+#include "norm_table.h"
 #include <stdlib.h>
 #include <wchar.h>
 #include <wctype.h>
@@ -58,19 +61,30 @@ typedef void* GPLocale;
 // ----------------------------------------------------------------------------
 // Locale
 
-#if GP_HAS_LOCALE
+struct gp_locale_info
+{
+    GPLocale locale; // (GPLocale)0 if not available
+    char     code[16];
+};
 
 static GPMap   gp_s_locale_table;
 static GPMutex gp_s_locale_table_mutex;
+static struct gp_locale_info gp_s_default_locale;
+
+// Code comparison is much cheaper than hashing and looking up the table, and
+// programs rarely switch between locales.
+#ifndef GP_NO_THREAD_LOCALS
+static GP_MAYBE_THREAD_LOCAL GPLocaleHandle gp_s_last_locale;
+#endif
 
-static void gp_s_locale_delete(void* locale)
+static void gp_s_locale_delete(GPLocale locale)
 {
     #if GP_HAS_LOCALE
-    if ((GPLocale)locale != (GPLocale)0 && (GPLocale)locale != (GPLocale)-1)
+    if (locale != (GPLocale)0)
         #if _WIN32
-        _free_locale((GPLocale)locale);
+        _free_locale(locale);
         #else
-        freelocale((GPLocale)locale);
+        freelocale(locale);
         #endif
     #else
     (void)locale;
@@ -78,17 +92,19 @@ static void gp_s_locale_delete(void* locale)
     return;
 }
 
-static GPLocale gp_s_default_locale;
-
 static void gp_s_delete_locale_table(void)
 {
     for (GPMapIterator it = gp_map_begin(gp_s_locale_table)
         ; it.value != NULL
         ; it = gp_map_next(it))
-        gp_s_locale_delete(*(void**)it.value);
+    {
+        struct gp_locale_info* info = *(struct gp_locale_info**)it.value;
+        gp_s_locale_delete(info->locale);
+        gp_mem_dealloc(gp_global_heap, info);
+    }
     gp_map_delete(gp_s_locale_table);
     gp_mutex_destroy(&gp_s_locale_table_mutex);
-    gp_s_locale_delete(gp_s_default_locale);
+    gp_s_locale_delete(gp_s_default_locale.locale);
 }
 
 static void gp_s_init_locale_table(void)
@@ -98,75 +114,97 @@ static void gp_s_init_locale_table(void)
 
     #if GP_HAS_LOCALE
     #  if !_WIN32
-    gp_s_default_locale = newlocale(LC_ALL_MASK, "C.UTF-8", (locale_t)0);
+    gp_s_default_locale.locale = newlocale(LC_ALL_MASK, "C.UTF-8", (locale_t)0);
     #  elif __MINGW32__
-    gp_default_locale = _create_locale(LC_ALL, "");
+    gp_s_default_locale.locale = _create_locale(LC_ALL, "");
     #  else
-    gp_default_locale = _create_locale(LC_ALL, ".UTF-8");
+    gp_s_default_locale.locale = _create_locale(LC_ALL, ".UTF-8");
     #  endif
     #endif // GP_HAS_LOCALE
 
     atexit(gp_s_delete_locale_table); // shut up sanitizer
 }
-#endif // GP_HAS_LOCALE
 
-#ifdef gp_locale
-#undef gp_locale
-#endif
-GPLocale gp_locale(const char* locale_code)
+static struct gp_locale_info* gp_s_locale_create(const char* locale_code)
 {
-    #if ! GP_HAS_LOCALE
-    (void)locale_code;
-    return NULL;
+    struct gp_locale_info* info = gp_mem_alloc(gp_global_heap, sizeof*info);
+    memset(info, 0, sizeof*info);
+    strncpy(info->code, locale_code, sizeof info->code - sizeof"");
+
+    #if GP_HAS_LOCALE
+    char full_locale_code[16] = "";
+    strncpy(full_locale_code, locale_code, sizeof"xxx_XX"-sizeof"");
+    #ifndef __MINGW32__
+    strcat(full_locale_code, ".UTF-8");
+    #endif
+
+    #if _WIN32
+    info->locale = _create_locale(LC_ALL, full_locale_code);
     #else
+    info->locale = newlocale(LC_ALL_MASK, full_locale_code, (GPLocale)0);
+    #endif
+    #endif // GP_HAS_LOCALE
+    return info;
+}
+
+GPLocaleHandle gp_locale_handle(const char* locale_code)
+{
     if (locale_code == NULL)
-        return (GPLocale)0;
+        return NULL;
 
     static GPThreadOnce locale_table_once = GP_THREAD_ONCE_INIT;
     gp_thread_once(&locale_table_once, gp_s_init_locale_table);
 
     if (locale_code[0] == '\0')
-        return gp_s_default_locale;
+        return &gp_s_default_locale;
+
+    #ifndef GP_NO_THREAD_LOCALS
+    if (gp_s_last_locale != NULL && strcmp(gp_s_last_locale->code, locale_code) == 0)
+        return gp_s_last_locale;
+    #endif
 
     uint64_t key = gp_bytes_hash(locale_code, strlen(locale_code));
-    GP_MAYBE_ATOMIC GPLocale* locale_addr = gp_map_get(gp_s_locale_table, NULL, key);
+    GP_MAYBE_ATOMIC GPLocaleHandle* info_addr = gp_map_get(gp_s_locale_table, NULL, key);
 
-    if (locale_addr == NULL)
+    if (info_addr == NULL)
     {
         gp_mutex_lock(&gp_s_locale_table_mutex);
 
-        locale_addr = gp_map_get(gp_s_locale_table, NULL, key);
-        if (locale_addr != NULL)
-        {
-            gp_mutex_unlock(&gp_s_locale_table_mutex);
-            return *locale_addr != (GPLocale)-1 ? *locale_addr : (GPLocale)0;
+        info_addr = gp_map_get(gp_s_locale_table, NULL, key);
+        if (info_addr == NULL) {
+            GPLocaleHandle info = gp_s_locale_create(locale_code);
+            info_addr = gp_map_put(&gp_s_locale_table, NULL, key, &info);
         }
-        char full_locale_code[16] = "";
-        strncpy(full_locale_code, locale_code, sizeof"xxx_XX"-sizeof"");
-        #ifndef _WIN32
-        if (locale_code[0] == '\0')
-            full_locale_code[0] = 'C';
-        #endif
-        #ifndef __MINGW32__
-        strcat(full_locale_code, ".UTF-8");
-        #endif
-
-        #if _WIN32
-        GPLocale locale = _create_locale(LC_ALL, full_locale_code);
-        #elif GP_HAS_LOCALE
-        GPLocale locale = newlocale(LC_ALL_MASK, full_locale_code, (GPLocale)0);
-        #endif
-        if (locale == (GPLocale)0) // mark the locale as unavailable
-            locale = (GPLocale)-1;
-        locale_addr = gp_map_put(&gp_s_locale_table, NULL, key, &locale);
         gp_mutex_unlock(&gp_s_locale_table_mutex);
     }
-    if (*locale_addr == (GPLocale)-1)
-        return (GPLocale)0;
-    return *locale_addr;
+    #ifndef GP_NO_THREAD_LOCALS
+    gp_s_last_locale = *info_addr;
+    #endif
+    return *info_addr;
+}
+
+#ifdef gp_locale
+#undef gp_locale
+#endif
+GPLocale gp_locale(const char* locale_code)
+{
+    #if ! GP_HAS_LOCALE
+    (void)locale_code;
+    return NULL;
+    #else
+    GPLocaleHandle locale = gp_locale_handle(locale_code);
+    return locale != NULL ? locale->locale : (GPLocale)0;
     #endif // GP_HAS_LOCALE
 }
 
+// Language code used by language sensitive case mappings.
+static const char* gp_s_locale_code(GPLocaleHandle locale, char code_buf[GP_STATIC 4])
+{
+    if (locale != NULL)
+        return locale->code;
+    return strncpy(code_buf, setlocale(LC_ALL, NULL), 2);
+}
+
 const char* gp_set_utf8_global_locale(int category, const char* locale_code)
 {
     char full_locale_code[16] = "";
@@ -385,472 +423,1231 @@ size_t gp_utf8_encode(
     return gp_utf8_encode_unsafe(mem, u32);
 }
 
-// User has dedicated functions for validation, which is why we ignore them in
-// conversion functions for simplicity.
+// ----------------------------------------------------------------------------
+// Transcoding kernels
+//
+// Kernels validate and transcode valid input in a single pass and stop at the
+// first invalid sequence. Public conversions continue from there one codepoint
+// at a time, which preserves invalid sequences. Runs of ASCII and output
+// lengths are processed in blocks with SSE2 or AVX2 selected at runtime on x86.
+// Other targets use scalar loops, which compilers vectorize reasonably well.
+
+#if (__GNUC__ || __clang__) && (__x86_64__ || __i386__) && !GP_NO_SIMD
+#define GP_UTF_X86 1
+#include <immintrin.h>
+#define GP_TARGET_SSE2 __attribute__((target("sse2")))
+#define GP_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
 
-size_t gp_utf32_from_utf8(
-    GPArray(uint32_t)* out_utf32,
-    const void*        _utf8,
-    size_t             utf8_length)
+enum { GP_SIMD_NONE, GP_SIMD_SSE2, GP_SIMD_AVX2 };
+
+static int gp_s_simd_level(void)
 {
-    gp_arrt_set(uint32_t, *out_utf32)->length = 0;
-    const uint8_t* utf8 = _utf8;
-    size_t trunced = 0;
+    #if GP_UTF_X86
+    if (__builtin_cpu_supports("avx2"))
+        return GP_SIMD_AVX2;
+    if (__builtin_cpu_supports("sse2"))
+        return GP_SIMD_SSE2;
+    #endif
+    return GP_SIMD_NONE;
+}
 
-    for (size_t i = 0; i < utf8_length; ) {
-        uint32_t decoding;
-        i += gp_utf8_decode(&decoding, utf8, utf8_length, i, &(bool){0});
-        trunced += gp_arr_push(sizeof decoding, out_utf32, &decoding);
-    }
-    return trunced;
+#if GP_UTF_X86
+// SIMD kernels process full blocks and return the number of processed elements
+// or the block where scanning should stop. Scalar code finishes the rest.
+
+GP_TARGET_SSE2 static size_t gp_s_ascii8_sse2(const uint8_t* s, size_t n)
+{
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+        if (_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(s + i))) != 0)
+            break;
+    return i;
 }
 
-size_t gp_utf8_from_utf32(
-    GPString*        out_utf8,
-    const uint32_t*  utf32,
-    size_t           utf32_length)
+GP_TARGET_AVX2 static size_t gp_s_ascii8_avx2(const uint8_t* s, size_t n)
 {
-    gp_str_set(*out_utf8)->length = 0;
-    size_t trunced = 0;
-    bool last_is_valid = false;
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32)
+        if (_mm256_movemask_epi8(_mm256_loadu_si256((const __m256i*)(s + i))) != 0)
+            break;
+    return i;
+}
 
-    for (size_t i = 0; i < utf32_length; ++i) {
-        uint8_t encoding[4];
-        size_t  encoding_length = gp_utf8_encode(encoding, utf32[i], &last_is_valid);
-        trunced += gp_str_append(out_utf8, encoding, encoding_length);
+GP_TARGET_SSE2 static size_t gp_s_ascii16_sse2(const uint16_t* s, size_t n)
+{
+    const __m128i non_ascii = _mm_set1_epi16((short)0xFF80);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m128i v = _mm_and_si128(_mm_loadu_si128((const __m128i*)(s + i)), non_ascii);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(v, _mm_setzero_si128())) != 0xFFFF)
+            break;
     }
+    return i;
+}
 
-    // On one hand, we want to preserve invalid sequences. On the other hand,
-    // we don't want to turn valid sequences to invalid ones by truncation.
-    if (last_is_valid)
-        return trunced + gp_str_truncate_invalid_tail(out_utf8);
-    return trunced;
+GP_TARGET_AVX2 static size_t gp_s_ascii16_avx2(const uint16_t* s, size_t n)
+{
+    const __m256i non_ascii = _mm256_set1_epi16((short)0xFF80);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m256i v = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(s + i)), non_ascii);
+        if ( ! _mm256_testz_si256(v, v))
+            break;
+    }
+    return i;
 }
 
-size_t gp_utf16_from_utf8(
-    GPArray(uint16_t)* out_utf16,
-    const void*        _utf8,
-    size_t             utf8_length)
+GP_TARGET_SSE2 static size_t gp_s_ascii32_sse2(const uint32_t* s, size_t n)
 {
-    gp_arrt_set(uint16_t, *out_utf16)->length = 0;
-    const uint8_t* utf8 = _utf8;
-    size_t trunced = 0;
+    const __m128i non_ascii = _mm_set1_epi32((int)0xFFFFFF80);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m128i v = _mm_and_si128(_mm_loadu_si128((const __m128i*)(s + i)), non_ascii);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(v, _mm_setzero_si128())) != 0xFFFF)
+            break;
+    }
+    return i;
+}
 
-    for (size_t i = 0; i < utf8_length; ) {
-        uint32_t decoding;
-        i += gp_utf8_decode(&decoding, utf8, utf8_length, i, &(bool){0});
-        if (decoding <= UINT16_MAX)
-            trunced += gp_arr_push(sizeof(uint16_t), out_utf16, &(uint16_t){decoding});
-        else {
-            decoding &= ~0x10000;
-            uint16_t surrogate0 = (decoding >> 10)   | 0xD800;
-            uint16_t surrogate1 = (decoding & 0x3FF) | 0xDC00;
-            trunced += gp_arr_push(sizeof(uint16_t), out_utf16, &surrogate0);
-            trunced += gp_arr_push(sizeof(uint16_t), out_utf16, &surrogate1);
-        }
+GP_TARGET_AVX2 static size_t gp_s_ascii32_avx2(const uint32_t* s, size_t n)
+{
+    const __m256i non_ascii = _mm256_set1_epi32((int)0xFFFFFF80);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m256i v = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(s + i)), non_ascii);
+        if ( ! _mm256_testz_si256(v, v))
+            break;
     }
-    return trunced;
+    return i;
 }
 
-size_t gp_utf8_from_utf16(
-    GPString*        out_utf8,
-    const uint16_t*  utf16,
-    size_t           utf16_length)
+// Count bytes that are not continuation bytes and leading bytes of 4 byte
+// sequences.
+GP_TARGET_SSE2 static size_t gp_s_utf8_count_sse2(
+    const uint8_t* s, size_t n, size_t* count, size_t* four_byte_count)
 {
-    gp_str_set(*out_utf8)->length = 0;
-    size_t trunced = 0;
-    bool last_is_valid = false;
+    const __m128i continuation_max = _mm_set1_epi8((char)0xBF); // signed compare
+    const __m128i four_byte_min    = _mm_set1_epi8((char)0xF0);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(s + i));
+        *count += __builtin_popcount(
+            (unsigned)_mm_movemask_epi8(_mm_cmpgt_epi8(v, continuation_max)));
+        *four_byte_count += __builtin_popcount(
+            (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(v, four_byte_min), v)));
+    }
+    return i;
+}
 
-    for (size_t i = 0; i < utf16_length; ++i) {
-        uint32_t decoding = utf16[i];
-        if (0xD7FF < decoding && decoding < 0xE000) { // surrogate
-            if (i == utf16_length - 1)
-                return trunced + 2 + gp_str_truncate_invalid_tail(out_utf8);
-            decoding = 0x10000
-                | ((uint32_t)(utf16[i + 0] &~ 0xD800) << 10)
-                | ((uint32_t)(utf16[i + 1] &~ 0xDC00));
-        }
-        uint8_t encoding[4];
-        size_t  encoding_length = gp_utf8_encode(encoding, decoding, &last_is_valid);
-        trunced += gp_str_append(out_utf8, encoding, encoding_length);
+GP_TARGET_AVX2 static size_t gp_s_utf8_count_avx2(
+    const uint8_t* s, size_t n, size_t* count, size_t* four_byte_count)
+{
+    const __m256i continuation_max = _mm256_set1_epi8((char)0xBF);
+    const __m256i four_byte_min    = _mm256_set1_epi8((char)0xF0);
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        const __m256i v = _mm256_loadu_si256((const __m256i*)(s + i));
+        *count += __builtin_popcount(
+            (unsigned)_mm256_movemask_epi8(_mm256_cmpgt_epi8(v, continuation_max)));
+        *four_byte_count += __builtin_popcount(
+            (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(v, four_byte_min), v)));
     }
+    return i;
+}
 
-    // On one hand, we want to preserve invalid sequences. On the other hand,
-    // we don't want to turn valid sequences to invalid ones by truncation.
-    if (last_is_valid)
-        return trunced + gp_str_truncate_invalid_tail(out_utf8);
-    return trunced;
+// Count codepoint starts, see gp_s_utf8_codepoint_count(). Continuation bytes
+// are absorbed by a leading byte up to 3 bytes behind, so i must be at least 3.
+GP_TARGET_SSE2 static inline __m128i gp_s_in_range_sse2(__m128i v, uint8_t min, uint8_t max)
+{
+    return _mm_cmpeq_epi8(_mm_min_epu8(_mm_max_epu8(v, _mm_set1_epi8((char)min)),
+        _mm_set1_epi8((char)max)), v);
 }
 
-size_t gp_wcs_from_utf8(
-    GPArray(wchar_t)* out_wcs,
-    const void*       utf8,
-    size_t            utf8_length)
+GP_TARGET_SSE2 static size_t gp_s_utf8_codepoint_count_sse2(
+    const uint8_t* s, size_t n, size_t i, size_t* count)
 {
-    if (sizeof(wchar_t) == sizeof(uint16_t))
-        return gp_utf16_from_utf8((GPArray(uint16_t)*)out_wcs, utf8, utf8_length);
-    return gp_utf32_from_utf8((GPArray(uint32_t)*)out_wcs, utf8, utf8_length);
+    const __m128i continuation_limit = _mm_set1_epi8((char)0xC0); // signed compare
+    for (; i + 16 <= n; i += 16) {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(s + i));
+        const unsigned continuation = _mm_movemask_epi8(_mm_cmpgt_epi8(continuation_limit, v));
+        *count += 16 - __builtin_popcount(continuation);
+        if (continuation == 0)
+            continue;
+
+        const __m128i p1 = _mm_loadu_si128((const __m128i*)(s + i - 1));
+        const __m128i p2 = _mm_loadu_si128((const __m128i*)(s + i - 2));
+        const __m128i p3 = _mm_loadu_si128((const __m128i*)(s + i - 3));
+        const unsigned continuation1 = _mm_movemask_epi8(_mm_cmpgt_epi8(continuation_limit, p1));
+        const unsigned continuation2 = _mm_movemask_epi8(_mm_cmpgt_epi8(continuation_limit, p2));
+        const unsigned absorbed =
+              (unsigned)_mm_movemask_epi8(gp_s_in_range_sse2(p1, 0xC0, 0xF7))
+            | (continuation1 & (unsigned)_mm_movemask_epi8(gp_s_in_range_sse2(p2, 0xE0, 0xF7)))
+            | (continuation1 & continuation2
+                & (unsigned)_mm_movemask_epi8(gp_s_in_range_sse2(p3, 0xF0, 0xF7)));
+        *count += __builtin_popcount(continuation & ~absorbed);
+    }
+    return i;
 }
 
-size_t gp_utf8_from_wcs(
-    GPString*       out_utf8,
-    const wchar_t*  wcs,
-    size_t          wcs_length)
+GP_TARGET_AVX2 static inline __m256i gp_s_in_range_avx2(__m256i v, uint8_t min, uint8_t max)
 {
-    if (sizeof(wchar_t) == sizeof(uint16_t))
-        return gp_utf8_from_utf16(out_utf8, (void*)wcs, wcs_length);
-    return gp_utf8_from_utf32(out_utf8, (void*)wcs, wcs_length);
+    return _mm256_cmpeq_epi8(_mm256_min_epu8(_mm256_max_epu8(v, _mm256_set1_epi8((char)min)),
+        _mm256_set1_epi8((char)max)), v);
 }
 
-// All gp_utfX_to_utfY() functions skip any Unicode validation. This makes them
-// unsafe, which is why they are private for now. They are faster though, so
-// don't remove, publish as unsafe functions if they turn out to be useful.
+GP_TARGET_AVX2 static size_t gp_s_utf8_codepoint_count_avx2(
+    const uint8_t* s, size_t n, size_t i, size_t* count)
+{
+    const __m256i continuation_limit = _mm256_set1_epi8((char)0xC0);
+    for (; i + 32 <= n; i += 32) {
+        const __m256i v = _mm256_loadu_si256((const __m256i*)(s + i));
+        const unsigned continuation = _mm256_movemask_epi8(_mm256_cmpgt_epi8(continuation_limit, v));
+        *count += 32 - __builtin_popcount(continuation);
+        if (continuation == 0)
+            continue;
 
-size_t gp_utf8_to_utf32(
-    GPArray(uint32_t)* u32,
-    const void*const   u8,
-    const size_t       u8_length)
+        const __m256i p1 = _mm256_loadu_si256((const __m256i*)(s + i - 1));
+        const __m256i p2 = _mm256_loadu_si256((const __m256i*)(s + i - 2));
+        const __m256i p3 = _mm256_loadu_si256((const __m256i*)(s + i - 3));
+        const unsigned continuation1 = _mm256_movemask_epi8(_mm256_cmpgt_epi8(continuation_limit, p1));
+        const unsigned continuation2 = _mm256_movemask_epi8(_mm256_cmpgt_epi8(continuation_limit, p2));
+        const unsigned absorbed =
+              (unsigned)_mm256_movemask_epi8(gp_s_in_range_avx2(p1, 0xC0, 0xF7))
+            | (continuation1 & (unsigned)_mm256_movemask_epi8(gp_s_in_range_avx2(p2, 0xE0, 0xF7)))
+            | (continuation1 & continuation2
+                & (unsigned)_mm256_movemask_epi8(gp_s_in_range_avx2(p3, 0xF0, 0xF7)));
+        *count += __builtin_popcount(continuation & ~absorbed);
+    }
+    return i;
+}
+
+// Masks have 2 bits per 16-bit lane, 4 bits per 32-bit lane.
+GP_TARGET_SSE2 static size_t gp_s_utf16_utf8_length_sse2(
+    const uint16_t* s, size_t n, size_t* length)
 {
-    ((GPArrayHeader*)*u32 - 1)->length = 0;
+    const __m128i zero           = _mm_setzero_si128();
+    const __m128i two_byte_mask  = _mm_set1_epi16((short)0xFF80);
+    const __m128i multibyte_mask = _mm_set1_epi16((short)0xF800);
+    const __m128i surrogate      = _mm_set1_epi16((short)0xD800);
     size_t i = 0;
-    size_t codepoint_length;
-    uint32_t decoding;
-    for (; gp_arr_length(*u32) < gp_arr_capacity(*u32); i += codepoint_length)
-    {
-        if (i >= u8_length)
-            return 0;
-        codepoint_length = gp_utf8_decode_unsafe(&decoding, u8, i);
-        (*u32)[((GPArrayHeader*)*u32 - 1)->length++] = decoding;
+    for (; i + 8 <= n; i += 8) {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(s + i));
+        const __m128i high = _mm_and_si128(v, multibyte_mask);
+        const unsigned ascii   = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, two_byte_mask), zero));
+        const unsigned small   = _mm_movemask_epi8(_mm_cmpeq_epi16(high, zero));
+        const unsigned surrogates = _mm_movemask_epi8(_mm_cmpeq_epi16(high, surrogate));
+        *length += 3*8 - (__builtin_popcount(ascii)
+            + __builtin_popcount(small) + __builtin_popcount(surrogates)) / 2;
     }
-    size_t gp_internal_bytes_codepoint_count(const void*, size_t);
-    size_t trunced = gp_arr_reserve(sizeof(*u32)[0], u32,
-        gp_arr_length(*u32) + gp_internal_bytes_codepoint_count((uint8_t*)u8 + i, u8_length - i));
+    return i;
+}
 
-    if ( ! trunced ) for (; i < u8_length; i += codepoint_length)
-    {
-        codepoint_length = gp_utf8_decode_unsafe(&decoding, u8, i);
-        (*u32)[((GPArrayHeader*)*u32 - 1)->length++] = decoding;
-    }
-    else for (; i < u8_length && gp_arr_length(*u32) < gp_arr_capacity(*u32); i += codepoint_length)
-    {
-        codepoint_length = gp_utf8_decode_unsafe(&decoding, u8, i);
-        (*u32)[((GPArrayHeader*)*u32 - 1)->length++] = decoding;
+GP_TARGET_AVX2 static size_t gp_s_utf16_utf8_length_avx2(
+    const uint16_t* s, size_t n, size_t* length)
+{
+    const __m256i zero           = _mm256_setzero_si256();
+    const __m256i two_byte_mask  = _mm256_set1_epi16((short)0xFF80);
+    const __m256i multibyte_mask = _mm256_set1_epi16((short)0xF800);
+    const __m256i surrogate      = _mm256_set1_epi16((short)0xD800);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m256i v = _mm256_loadu_si256((const __m256i*)(s + i));
+        const __m256i high = _mm256_and_si256(v, multibyte_mask);
+        const unsigned ascii   = _mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_and_si256(v, two_byte_mask), zero));
+        const unsigned small   = _mm256_movemask_epi8(_mm256_cmpeq_epi16(high, zero));
+        const unsigned surrogates = _mm256_movemask_epi8(_mm256_cmpeq_epi16(high, surrogate));
+        *length += 3*16 - (__builtin_popcount(ascii)
+            + __builtin_popcount(small) + __builtin_popcount(surrogates)) / 2;
     }
-    return trunced;
+    return i;
 }
 
-// Not just no validation, but no bounds checks either
-static void gp_s_utf8_to_utf32_very_unsafe(
-    GPArray(uint32_t)* u32,
-    const void*const   u8,
-    const size_t       u8_length)
+GP_TARGET_SSE2 static size_t gp_s_utf32_utf8_length_sse2(
+    const uint32_t* s, size_t n, size_t* length)
 {
-    for (size_t i = 0, codepoint_length; i < u8_length; i += codepoint_length)
-    {
-        uint32_t decoding;
-        codepoint_length = gp_utf8_decode_unsafe(&decoding, u8, i);
-        (*u32)[((GPArrayHeader*)*u32 - 1)->length++] = decoding;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one_byte_mask   = _mm_set1_epi32((int)0xFFFFFF80);
+    const __m128i two_byte_mask   = _mm_set1_epi32((int)0xFFFFF800);
+    const __m128i three_byte_mask = _mm_set1_epi32((int)0xFFFF0000);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(s + i));
+        const unsigned fits1 = _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(v, one_byte_mask),   zero));
+        const unsigned fits2 = _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(v, two_byte_mask),   zero));
+        const unsigned fits3 = _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(v, three_byte_mask), zero));
+        *length += 4*4 - (__builtin_popcount(fits1)
+            + __builtin_popcount(fits2) + __builtin_popcount(fits3)) / 4;
     }
+    return i;
 }
 
-size_t gp_utf32_to_utf8(
-    GPString*        u8,
-    const uint32_t*  u32,
-    size_t           u32_length)
+GP_TARGET_AVX2 static size_t gp_s_utf32_utf8_length_avx2(
+    const uint32_t* s, size_t n, size_t* length)
 {
-    ((GPStringHeader*)*u8 - 1)->length = 0;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one_byte_mask   = _mm256_set1_epi32((int)0xFFFFFF80);
+    const __m256i two_byte_mask   = _mm256_set1_epi32((int)0xFFFFF800);
+    const __m256i three_byte_mask = _mm256_set1_epi32((int)0xFFFF0000);
     size_t i = 0;
-    #ifndef GP_STATIC_ANALYSIS // false positive on writes
-    for (; gp_str_length(*u8) + 3 < gp_str_capacity(*u8); ++i) // skip bounds checking
-    { // Manually inlined gp_utf8_encode() is faster for some reason.
-        if (i >= u32_length)
-            return 0;
-
-        if (u32[i] > 0x7F)
-        {
-            if (u32[i] < 0x800) {
-                (*u8)[gp_str_length(*u8) + 0].c = ((u32[i] & 0x000FC0) >>  6) | 0xC0;
-                (*u8)[gp_str_length(*u8) + 1].c = ((u32[i] & 0x00003F) >>  0) | 0x80;
-                ((GPStringHeader*)*u8 - 1)->length += 2;
-            } else if (u32[i] < 0x10000) {
-                (*u8)[gp_str_length(*u8) + 0].c = ((u32[i] & 0x03F000) >> 12) | 0xE0;
-                (*u8)[gp_str_length(*u8) + 1].c = ((u32[i] & 0x000FC0) >>  6) | 0x80;
-                (*u8)[gp_str_length(*u8) + 2].c = ((u32[i] & 0x00003F) >>  0) | 0x80;
-                ((GPStringHeader*)*u8 - 1)->length += 3;
-            } else {
-                (*u8)[gp_str_length(*u8) + 0].c = ((u32[i] & 0x1C0000) >> 18) | 0xF0;
-                (*u8)[gp_str_length(*u8) + 1].c = ((u32[i] & 0x03F000) >> 12) | 0x80;
-                (*u8)[gp_str_length(*u8) + 2].c = ((u32[i] & 0x000FC0) >>  6) | 0x80;
-                (*u8)[gp_str_length(*u8) + 3].c = ((u32[i] & 0x00003F) >>  0) | 0x80;
-                ((GPStringHeader*)*u8 - 1)->length += 4;
-            }
-        }
-        else
-        { // Also this weird control flow is somewhat faster for some reason.
-          // Maybe it's better for the branch predictor?
-            (*u8)[((GPStringHeader*)*u8 - 1)->length++].c = u32[i];
-        }
+    for (; i + 8 <= n; i += 8) {
+        const __m256i v = _mm256_loadu_si256((const __m256i*)(s + i));
+        const unsigned fits1 = _mm256_movemask_epi8(_mm256_cmpeq_epi32(_mm256_and_si256(v, one_byte_mask),   zero));
+        const unsigned fits2 = _mm256_movemask_epi8(_mm256_cmpeq_epi32(_mm256_and_si256(v, two_byte_mask),   zero));
+        const unsigned fits3 = _mm256_movemask_epi8(_mm256_cmpeq_epi32(_mm256_and_si256(v, three_byte_mask), zero));
+        *length += 4*8 - (__builtin_popcount(fits1)
+            + __builtin_popcount(fits2) + __builtin_popcount(fits3)) / 4;
     }
-    #endif
+    return i;
+}
+#endif // GP_UTF_X86
 
-    size_t required_capacity = gp_str_length(*u8);
-    for (size_t j = i; j < u32_length; ++j)
-    {
-        if (u32[j] > 0x7F)
-        {
-            if (u32[j] < 0x800)
-                required_capacity += 2;
-            else if (u32[j] < 0x10000)
-                required_capacity += 3;
-            else
-                required_capacity += 4;
-        }
-        else
-            ++required_capacity;
+static size_t gp_s_utf8_ascii_length(const uint8_t* s, size_t n, int simd)
+{
+    size_t i = 0;
+    #if GP_UTF_X86
+    if (simd == GP_SIMD_AVX2)
+        i = gp_s_ascii8_avx2(s, n);
+    else if (simd == GP_SIMD_SSE2)
+        i = gp_s_ascii8_sse2(s, n);
+    #else
+    (void)simd;
+    #endif
+    for (uint64_t x; i + sizeof x <= n; i += sizeof x) {
+        memcpy(&x, s + i, sizeof x);
+        if (x & 0x8080808080808080)
+            break;
     }
-    size_t trunced = gp_str_reserve(u8, required_capacity);
+    while (i < n && s[i] < 0x80)
+        ++i;
+    return i;
+}
 
-    if ( ! trunced) for (; i < u32_length; ++i) // skip bounds checking
-    {
-        if (u32[i] > 0x7F)
-        {
-            if (u32[i] < 0x800) {
-                (*u8)[gp_str_length(*u8) + 0].c = ((u32[i] & 0x000FC0) >>  6) | 0xC0;
-                (*u8)[gp_str_length(*u8) + 1].c = ((u32[i] & 0x00003F) >>  0) | 0x80;
-                ((GPStringHeader*)*u8 - 1)->length += 2;
-            } else if (u32[i] < 0x10000) {
-                (*u8)[gp_str_length(*u8) + 0].c = ((u32[i] & 0x03F000) >> 12) | 0xE0;
-                (*u8)[gp_str_length(*u8) + 1].c = ((u32[i] & 0x000FC0) >>  6) | 0x80;
-                (*u8)[gp_str_length(*u8) + 2].c = ((u32[i] & 0x00003F) >>  0) | 0x80;
-                ((GPStringHeader*)*u8 - 1)->length += 3;
-            } else {
-                (*u8)[gp_str_length(*u8) + 0].c = ((u32[i] & 0x1C0000) >> 18) | 0xF0;
-                (*u8)[gp_str_length(*u8) + 1].c = ((u32[i] & 0x03F000) >> 12) | 0x80;
-                (*u8)[gp_str_length(*u8) + 2].c = ((u32[i] & 0x000FC0) >>  6) | 0x80;
-                (*u8)[gp_str_length(*u8) + 3].c = ((u32[i] & 0x00003F) >>  0) | 0x80;
-                ((GPStringHeader*)*u8 - 1)->length += 4;
-            }
-        }
-        else
-            (*u8)[((GPStringHeader*)*u8 - 1)->length++].c = u32[i];
-    }
-    else for (; i < u32_length && gp_str_length(*u8) < gp_str_capacity(*u8); ++i)
-    {
-        #ifdef GP_STATIC_ANALYSIS // buffer overflow false positive, bounds checked before writing anything
-        gp_str_set(*u8)->length = gp_str_capacity(*u8);
-        return trunced;
-        #endif
+static size_t gp_s_utf16_ascii_length(const uint16_t* s, size_t n, int simd)
+{
+    size_t i = 0;
+    #if GP_UTF_X86
+    if (simd == GP_SIMD_AVX2)
+        i = gp_s_ascii16_avx2(s, n);
+    else if (simd == GP_SIMD_SSE2)
+        i = gp_s_ascii16_sse2(s, n);
+    #else
+    (void)simd;
+    #endif
+    while (i < n && s[i] < 0x80)
+        ++i;
+    return i;
+}
 
-        if (u32[i] > 0x7F)
-        {
-            if (u32[i] < 0x800) {
-                if (gp_str_length(*u8) + 2 > gp_str_capacity(*u8))
-                    return trunced + gp_str_capacity(*u8) - gp_str_length(*u8);
-                (*u8)[gp_str_length(*u8) + 0].c = ((u32[i] & 0x000FC0) >>  6) | 0xC0;
-                (*u8)[gp_str_length(*u8) + 1].c = ((u32[i] & 0x00003F) >>  0) | 0x80;
-                ((GPStringHeader*)*u8 - 1)->length += 2;
-            } else if (u32[i] < 0x10000) {
-                if (gp_str_length(*u8) + 3 > gp_str_capacity(*u8))
-                    return trunced + gp_str_capacity(*u8) - gp_str_length(*u8);
-                (*u8)[gp_str_length(*u8) + 0].c = ((u32[i] & 0x03F000) >> 12) | 0xE0;
-                (*u8)[gp_str_length(*u8) + 1].c = ((u32[i] & 0x000FC0) >>  6) | 0x80;
-                (*u8)[gp_str_length(*u8) + 2].c = ((u32[i] & 0x00003F) >>  0) | 0x80;
-                ((GPStringHeader*)*u8 - 1)->length += 3;
-            } else {
-                if (gp_str_length(*u8) + 4 > gp_str_capacity(*u8)) // bounds checked here
-                    return trunced + gp_str_capacity(*u8) - gp_str_length(*u8);
-                (*u8)[gp_str_length(*u8) + 0].c = ((u32[i] & 0x1C0000) >> 18) | 0xF0;
-                (*u8)[gp_str_length(*u8) + 1].c = ((u32[i] & 0x03F000) >> 12) | 0x80;
-                (*u8)[gp_str_length(*u8) + 2].c = ((u32[i] & 0x000FC0) >>  6) | 0x80;
-                (*u8)[gp_str_length(*u8) + 3].c = ((u32[i] & 0x00003F) >>  0) | 0x80; // false positive here
-                ((GPStringHeader*)*u8 - 1)->length += 4;
-            }
-        }
-        else
-            (*u8)[((GPStringHeader*)*u8 - 1)->length++].c = u32[i];
+static size_t gp_s_utf32_ascii_length(const uint32_t* s, size_t n, int simd)
+{
+    size_t i = 0;
+    #if GP_UTF_X86
+    if (simd == GP_SIMD_AVX2)
+        i = gp_s_ascii32_avx2(s, n);
+    else if (simd == GP_SIMD_SSE2)
+        i = gp_s_ascii32_sse2(s, n);
+    #else
+    (void)simd;
+    #endif
+    while (i < n && s[i] < 0x80)
+        ++i;
+    return i;
+}
+
+static size_t gp_s_utf8_count(const uint8_t* s, size_t n, size_t* four_byte_count)
+{
+    size_t count = 0;
+    size_t i = 0;
+    *four_byte_count = 0;
+    #if GP_UTF_X86
+    const int simd = gp_s_simd_level();
+    if (simd == GP_SIMD_AVX2)
+        i = gp_s_utf8_count_avx2(s, n, &count, four_byte_count);
+    else if (simd == GP_SIMD_SSE2)
+        i = gp_s_utf8_count_sse2(s, n, &count, four_byte_count);
+    #endif
+    for (; i < n; ++i) {
+        count            += (s[i] & 0xC0) != 0x80;
+        *four_byte_count += s[i] >= 0xF0;
     }
+    return count;
+}
 
-    return trunced;
+size_t gp_utf32_length_from_utf8(const void* utf8, size_t utf8_length)
+{
+    size_t four_byte_count;
+    return gp_s_utf8_count(utf8, utf8_length, &four_byte_count);
 }
 
-size_t gp_utf8_to_utf16(
-    GPArray(uint16_t)* u16,
-    const void*        u8,
-    size_t             u8_length)
+size_t gp_utf16_length_from_utf8(const void* utf8, size_t utf8_length)
 {
-    ((GPArrayHeader*)*u16 - 1)->length = 0;
+    size_t four_byte_count;
+    const size_t count = gp_s_utf8_count(utf8, utf8_length, &four_byte_count);
+    return count + four_byte_count; // surrogate pairs
+}
+
+size_t gp_utf8_length_from_utf16(const uint16_t* utf16, size_t utf16_length)
+{
+    size_t length = 0;
     size_t i = 0;
-    size_t codepoint_length;
-    uint32_t decoding;
-    for (; gp_arr_length(*u16) < gp_arr_capacity(*u16); i += codepoint_length)
-    {
-        if (i >= u8_length)
+    #if GP_UTF_X86
+    const int simd = gp_s_simd_level();
+    if (simd == GP_SIMD_AVX2)
+        i = gp_s_utf16_utf8_length_avx2(utf16, utf16_length, &length);
+    else if (simd == GP_SIMD_SSE2)
+        i = gp_s_utf16_utf8_length_sse2(utf16, utf16_length, &length);
+    #endif
+    for (; i < utf16_length; ++i) // surrogates encode 2 bytes each
+        length += 1 + (utf16[i] >= 0x80) + (utf16[i] >= 0x800)
+            - ((utf16[i] & 0xF800) == 0xD800);
+    return length;
+}
+
+size_t gp_utf8_length_from_utf32(const uint32_t* utf32, size_t utf32_length)
+{
+    size_t length = 0;
+    size_t i = 0;
+    #if GP_UTF_X86
+    const int simd = gp_s_simd_level();
+    if (simd == GP_SIMD_AVX2)
+        i = gp_s_utf32_utf8_length_avx2(utf32, utf32_length, &length);
+    else if (simd == GP_SIMD_SSE2)
+        i = gp_s_utf32_utf8_length_sse2(utf32, utf32_length, &length);
+    #endif
+    for (; i < utf32_length; ++i)
+        length += 1 + (utf32[i] >= 0x80) + (utf32[i] >= 0x800) + (utf32[i] >= 0x10000);
+    return length;
+}
+
+// Codepoints are counted like stepping with gp_utf8_decode_codepoint_length()
+// where a truncated sequence ends at the first byte that is not a continuation
+// byte and stray continuation bytes are codepoints of their own. This makes
+// codepoint starts local: a byte starts a codepoint unless it is a continuation
+// byte within the length of the leading byte at most 3 bytes behind it.
+static bool gp_s_utf8_is_codepoint_start(const uint8_t* s, size_t i)
+{
+    if ((s[i] & 0xC0) != 0x80)
+        return true;
+    for (size_t j = 1; j <= 3 && j <= i; ++j) {
+        const uint8_t c = s[i - j];
+        if ((c & 0xC0) != 0x80)
+            return c < 0xC0 || 0xF7 < c || j >= gp_utf8_decode_codepoint_length(&c, 0);
+    }
+    return true;
+}
+
+// Count codepoint starts in [start, end). Bytes before start are looked at, so
+// the count is the same as if s was counted from the beginning.
+static size_t gp_s_utf8_codepoint_count(const uint8_t* s, size_t start, size_t end)
+{
+    size_t count = 0;
+    size_t i = start;
+    for (; i < end && i < 3; ++i)
+        count += gp_s_utf8_is_codepoint_start(s, i);
+    #if GP_UTF_X86
+    const int simd = gp_s_simd_level();
+    if (simd == GP_SIMD_AVX2)
+        i = gp_s_utf8_codepoint_count_avx2(s, end, i, &count);
+    else if (simd == GP_SIMD_SSE2)
+        i = gp_s_utf8_codepoint_count_sse2(s, end, i, &count);
+    #endif
+    while (i < end) {
+        uint64_t x;
+        if (i + sizeof x <= end && (memcpy(&x, s + i, sizeof x), (x & 0x8080808080808080) == 0)) {
+            count += sizeof x;
+            i     += sizeof x;
+        } else
+            count += gp_s_utf8_is_codepoint_start(s, i++);
+    }
+    return count;
+}
+
+size_t gp_internal_bytes_codepoint_count(const void* str, size_t n)
+{
+    return gp_s_utf8_codepoint_count(str, 0, n);
+}
+
+// Byte index of the n:th codepoint start counting from i or length if not found.
+static size_t gp_s_utf8_find_codepoint(const uint8_t* s, size_t length, size_t i, size_t n)
+{
+    enum { BLOCK_SIZE = 64 };
+    for (size_t count; i + BLOCK_SIZE <= length; i += BLOCK_SIZE, n -= count)
+        if ((count = gp_s_utf8_codepoint_count(s, i, i + BLOCK_SIZE)) >= n)
+            break;
+    for (uint64_t x; i + sizeof x < length && n > sizeof x; i += sizeof x, n -= sizeof x) {
+        memcpy(&x, s + i, sizeof x);
+        if (x & 0x8080808080808080)
+            break;
+    }
+    for (; i < length; ++i)
+        if (gp_s_utf8_is_codepoint_start(s, i) && --n == 0)
+            return i;
+    return length;
+}
+
+struct gp_utf8_index
+{
+    GPAllocator*   allocator;
+    const uint8_t* str;
+    size_t         length;
+    size_t         codepoint_count;
+    size_t         stride;
+    size_t*        checkpoints; // byte index of every stride:th codepoint
+};
+
+GPUtf8Index gp_utf8_index_new(
+    GPAllocator* allocator,
+    const void*  utf8,
+    size_t       utf8_length,
+    size_t       stride)
+{
+    if (stride == 0)
+        stride = 64;
+    const size_t codepoint_count  = gp_s_utf8_codepoint_count(utf8, 0, utf8_length);
+    const size_t checkpoint_count = (codepoint_count + stride - 1) / stride;
+
+    GPUtf8Index index = gp_mem_alloc(allocator,
+        sizeof*index + checkpoint_count * sizeof index->checkpoints[0]);
+    *index = (struct gp_utf8_index){
+        .allocator       = allocator,
+        .str             = utf8,
+        .length          = utf8_length,
+        .codepoint_count = codepoint_count,
+        .stride          = stride,
+        .checkpoints     = (size_t*)(index + 1)
+    };
+    if (checkpoint_count > 0)
+        index->checkpoints[0] = 0;
+    for (size_t i = 1; i < checkpoint_count; ++i)
+        index->checkpoints[i] = gp_s_utf8_find_codepoint(
+            utf8, utf8_length, index->checkpoints[i - 1] + 1, stride);
+    return index;
+}
+
+void gp_utf8_index_delete(GPUtf8Index optional)
+{
+    if (optional != NULL)
+        gp_mem_dealloc(optional->allocator, optional);
+}
+
+size_t gp_utf8_index_codepoint_count(GPUtf8Index index)
+{
+    return index->codepoint_count;
+}
+
+size_t gp_utf8_index_byte_index(GPUtf8Index index, size_t codepoint_index)
+{
+    gp_db_assert(codepoint_index <= index->codepoint_count, "Index out of bounds.");
+    if (codepoint_index >= index->codepoint_count)
+        return index->length;
+    return gp_s_utf8_find_codepoint(index->str, index->length,
+        index->checkpoints[codepoint_index / index->stride],
+        codepoint_index % index->stride + 1);
+}
+
+size_t gp_utf8_index_codepoint_index(GPUtf8Index index, size_t byte_index)
+{
+    gp_db_assert(byte_index <= index->length, "Index out of bounds.");
+    if (byte_index >= index->length)
+        return index->codepoint_count;
+
+    // Last checkpoint at or before byte_index, there is always one at 0.
+    size_t low = 0;
+    size_t high = (index->codepoint_count + index->stride - 1) / index->stride;
+    while (high - low > 1) {
+        const size_t mid = low + (high - low) / 2;
+        if (index->checkpoints[mid] <= byte_index)
+            low = mid;
+        else
+            high = mid;
+    }
+    return low * index->stride + gp_s_utf8_codepoint_count(
+        index->str, index->checkpoints[low] + 1, byte_index + 1);
+}
+
+// Decode non-ASCII codepoint. Returns 0 if invalid.
+static inline size_t gp_s_utf8_decode_valid(
+    uint32_t* decoding, const uint8_t* s, size_t n, size_t i)
+{
+    const uint32_t b0 = s[i];
+    if (b0 < 0xC2 || 0xF4 < b0)
+        return 0;
+    if (b0 < 0xE0) {
+        if (i + 1 >= n || (s[i + 1] & 0xC0) != 0x80)
             return 0;
-        codepoint_length = gp_utf8_decode_unsafe(&decoding, u8, i);
-        if (decoding <= UINT16_MAX) {
-            (*u16)[((GPArrayHeader*)*u16 - 1)->length++] = decoding;
-        } else {
-            if (GP_UNLIKELY(gp_arr_length(*u16) + 2 > gp_arr_capacity(*u16)))
-                break;
-            decoding &= ~0x10000;
-            (*u16)[gp_arr_length(*u16) + 0] = (decoding >> 10)   | 0xD800;
-            (*u16)[gp_arr_length(*u16) + 1] = (decoding & 0x3FF) | 0xDC00;
-            ((GPArrayHeader*)*u16 - 1)->length += 2;
-        }
+        *decoding = (b0 & 0x1F) << 6 | (s[i + 1] & 0x3F);
+        return 2;
     }
-    size_t capacity_needed = gp_arr_length(*u16);
-    for (size_t j = i; j < u8_length; j += codepoint_length) {
-        codepoint_length = gp_utf8_decode_codepoint_length(u8, j);
-        capacity_needed += codepoint_length <= 3 ? 1 : 2;
+    if (b0 < 0xF0) {
+        if (i + 2 >= n || (s[i + 1] & 0xC0) != 0x80 || (s[i + 2] & 0xC0) != 0x80)
+            return 0;
+        *decoding = (b0 & 0x0F) << 12 | (uint32_t)(s[i + 1] & 0x3F) << 6 | (s[i + 2] & 0x3F);
+        return 0x800 <= *decoding && (*decoding < 0xD800 || 0xDFFF < *decoding) ? 3 : 0;
     }
-    size_t trunced = gp_arr_reserve(sizeof(*u16)[0], u16, capacity_needed);
+    if (i + 3 >= n
+        || (s[i + 1] & 0xC0) != 0x80 || (s[i + 2] & 0xC0) != 0x80 || (s[i + 3] & 0xC0) != 0x80)
+        return 0;
+    *decoding = (b0 & 0x07) << 18 | (uint32_t)(s[i + 1] & 0x3F) << 12
+        | (uint32_t)(s[i + 2] & 0x3F) << 6 | (s[i + 3] & 0x3F);
+    return 0x10000 <= *decoding && *decoding <= 0x10FFFF ? 4 : 0;
+}
 
-    if ( ! trunced) for (; i < u8_length; i += codepoint_length)
-    {
-        codepoint_length = gp_utf8_decode_unsafe(&decoding, u8, i);
-        if (decoding <= UINT16_MAX) {
-            (*u16)[((GPArrayHeader*)*u16 - 1)->length++] = decoding;
-        } else {
-            decoding &= ~0x10000;
-            (*u16)[gp_arr_length(*u16) + 0] = (decoding >> 10)   | 0xD800;
-            (*u16)[gp_arr_length(*u16) + 1] = (decoding & 0x3FF) | 0xDC00;
-            ((GPArrayHeader*)*u16 - 1)->length += 2;
-        }
+// Encode valid non-ASCII codepoint.
+static inline size_t gp_s_utf8_encode_valid(uint8_t* out, uint32_t cp)
+{
+    if (cp < 0x800) {
+        out[0] = cp >>  6 | 0xC0;
+        out[1] = (cp & 0x3F) | 0x80;
+        return 2;
+    } else if (cp < 0x10000) {
+        out[0] = cp >> 12 | 0xE0;
+        out[1] = (cp >> 6 & 0x3F) | 0x80;
+        out[2] = (cp      & 0x3F) | 0x80;
+        return 3;
     }
-    else for (; i < u8_length && gp_arr_length(*u16) < gp_arr_capacity(*u16); i += codepoint_length)
+    out[0] = cp >> 18 | 0xF0;
+    out[1] = (cp >> 12 & 0x3F) | 0x80;
+    out[2] = (cp >>  6 & 0x3F) | 0x80;
+    out[3] = (cp       & 0x3F) | 0x80;
+    return 4;
+}
+
+// Kernels below return the number of consumed input elements and store the
+// number of written output elements. Output must have room for the exact
+// length of the valid input.
+
+static size_t gp_s_utf8_to_utf32_valid(
+    uint32_t* out, size_t* out_length, const uint8_t* in, size_t n)
+{
+    const int simd = gp_s_simd_level();
+    size_t i = 0;
+    size_t j = 0;
+    while (i < n)
     {
-        codepoint_length = gp_utf8_decode_unsafe(&decoding, u8, i);
-        if (decoding <= UINT16_MAX) {
-            (*u16)[((GPArrayHeader*)*u16 - 1)->length++] = decoding;
-        } else {
-            decoding &= ~0x10000;
-            (*u16)[gp_arr_length(*u16) + 0] = (decoding >> 10)   | 0xD800;
-            (*u16)[gp_arr_length(*u16) + 1] = (decoding & 0x3FF) | 0xDC00;
-            ((GPArrayHeader*)*u16 - 1)->length += 2;
+        const size_t ascii_length = gp_s_utf8_ascii_length(in + i, n - i, simd);
+        for (size_t k = 0; k < ascii_length; ++k)
+            out[j + k] = in[i + k];
+        i += ascii_length;
+        j += ascii_length;
+
+        for (size_t codepoint_length; i < n && in[i] >= 0x80; i += codepoint_length) {
+            uint32_t decoding;
+            if ((codepoint_length = gp_s_utf8_decode_valid(&decoding, in, n, i)) == 0)
+                goto end;
+            out[j++] = decoding;
         }
     }
-    return trunced;
+    end:
+    *out_length = j;
+    return i;
 }
 
-// Not just no validation, but no bounds checks either
-static void gp_s_utf8_to_utf16_very_unsafe(
-    GPArray(uint16_t)* u16,
-    const void*        u8,
-    size_t             u8_length)
+static size_t gp_s_utf8_to_utf16_valid(
+    uint16_t* out, size_t* out_length, const uint8_t* in, size_t n)
 {
-    for (size_t i = 0, codepoint_length; i < u8_length; i += codepoint_length)
+    const int simd = gp_s_simd_level();
+    size_t i = 0;
+    size_t j = 0;
+    while (i < n)
     {
-        uint32_t decoding;
-        codepoint_length = gp_utf8_decode_unsafe(&decoding, u8, i);
-        if (decoding <= UINT16_MAX)
-            (*u16)[((GPArrayHeader*)*u16 - 1)->length++] = decoding;
-        else {
-            decoding &= ~0x10000;
-            (*u16)[gp_arr_length(*u16) + 0] = (decoding >> 10)   | 0xD800;
-            (*u16)[gp_arr_length(*u16) + 1] = (decoding & 0x3FF) | 0xDC00;
-            ((GPArrayHeader*)*u16 - 1)->length += 2;
+        const size_t ascii_length = gp_s_utf8_ascii_length(in + i, n - i, simd);
+        for (size_t k = 0; k < ascii_length; ++k)
+            out[j + k] = in[i + k];
+        i += ascii_length;
+        j += ascii_length;
+
+        for (size_t codepoint_length; i < n && in[i] >= 0x80; i += codepoint_length) {
+            uint32_t decoding;
+            if ((codepoint_length = gp_s_utf8_decode_valid(&decoding, in, n, i)) == 0)
+                goto end;
+            if (decoding <= UINT16_MAX)
+                out[j++] = decoding;
+            else {
+                decoding -= 0x10000;
+                out[j++] = (decoding >> 10)   | 0xD800;
+                out[j++] = (decoding & 0x3FF) | 0xDC00;
+            }
         }
     }
+    end:
+    *out_length = j;
+    return i;
 }
 
-size_t gp_utf16_to_utf8(
-    GPString*        u8,
-    const uint16_t*  u16,
-    size_t           u16_length)
+static size_t gp_s_utf16_to_utf8_valid(
+    uint8_t* out, size_t* out_length, const uint16_t* in, size_t n)
 {
-    ((GPStringHeader*)*u8 - 1)->length = 0;
+    const int simd = gp_s_simd_level();
     size_t i = 0;
-    for (; gp_str_length(*u8) + 3 < gp_str_capacity(*u8); ++i) // skip bounds checking
+    size_t j = 0;
+    while (i < n)
     {
-        if (i >= u16_length)
-            return 0;
-
-        if (u16[i] > 0x7F)
-        {
-            if (u16[i] < 0x800) {
-                (*u8)[gp_str_length(*u8) + 0].c = ((u16[i] & 0x000FC0) >>  6) | 0xC0;
-                (*u8)[gp_str_length(*u8) + 1].c = ((u16[i] & 0x00003F) >>  0) | 0x80;
-                ((GPStringHeader*)*u8 - 1)->length += 2;
-            } else if (u16[i] <= 0xD7FF || 0xE000 <= u16[i]) {
-                (*u8)[gp_str_length(*u8) + 0].c = ((u16[i] & 0x03F000) >> 12) | 0xE0;
-                (*u8)[gp_str_length(*u8) + 1].c = ((u16[i] & 0x000FC0) >>  6) | 0x80;
-                (*u8)[gp_str_length(*u8) + 2].c = ((u16[i] & 0x00003F) >>  0) | 0x80;
-                ((GPStringHeader*)*u8 - 1)->length += 3;
-            } else { // surrogate pair
-                const uint32_t decoding = 0x10000
-                    | ((uint32_t)(u16[i + 0] &~ 0xD800) << 10)
-                    | ((uint32_t)(u16[i + 1] &~ 0xDC00));
-                (*u8)[gp_str_length(*u8) + 0].c = ((decoding & 0x1C0000) >> 18) | 0xF0;
-                (*u8)[gp_str_length(*u8) + 1].c = ((decoding & 0x03F000) >> 12) | 0x80;
-                (*u8)[gp_str_length(*u8) + 2].c = ((decoding & 0x000FC0) >>  6) | 0x80;
-                (*u8)[gp_str_length(*u8) + 3].c = ((decoding & 0x00003F) >>  0) | 0x80;
-                ((GPStringHeader*)*u8 - 1)->length += 4;
-                ++i;
+        const size_t ascii_length = gp_s_utf16_ascii_length(in + i, n - i, simd);
+        for (size_t k = 0; k < ascii_length; ++k)
+            out[j + k] = in[i + k];
+        i += ascii_length;
+        j += ascii_length;
+
+        for (; i < n && in[i] >= 0x80; ++i) {
+            uint32_t decoding = in[i];
+            if ((decoding & 0xF800) == 0xD800) { // surrogate
+                if (decoding > 0xDBFF || i + 1 >= n || (in[i + 1] & 0xFC00) != 0xDC00)
+                    goto end;
+                decoding = 0x10000 + ((decoding & 0x3FF) << 10 | (in[++i] & 0x3FF));
             }
+            j += gp_s_utf8_encode_valid(out + j, decoding);
         }
-        else
-            (*u8)[((GPStringHeader*)*u8 - 1)->length++].c = u16[i];
     }
+    end:
+    *out_length = j;
+    return i;
+}
 
-    size_t required_capacity = gp_str_length(*u8);
-    for (size_t j = i; j < u16_length; ++j)
+static size_t gp_s_utf32_to_utf8_valid(
+    uint8_t* out, size_t* out_length, const uint32_t* in, size_t n)
+{
+    const int simd = gp_s_simd_level();
+    size_t i = 0;
+    size_t j = 0;
+    while (i < n)
     {
-        if (u16[j] > 0x7F)
-        {
-            if (u16[j] < 0x800)
-                required_capacity += 2;
-            else if (u16[j] <= 0xD7FF || 0xE000 <= u16[j])
-                required_capacity += 3;
-            else
-                required_capacity += 4;
+        const size_t ascii_length = gp_s_utf32_ascii_length(in + i, n - i, simd);
+        for (size_t k = 0; k < ascii_length; ++k)
+            out[j + k] = in[i + k];
+        i += ascii_length;
+        j += ascii_length;
+
+        for (; i < n && in[i] >= 0x80; ++i) {
+            if ((in[i] & 0xFFFFF800) == 0xD800 || in[i] > 0x10FFFF)
+                goto end;
+            j += gp_s_utf8_encode_valid(out + j, in[i]);
         }
-        else
-            ++required_capacity;
     }
-    size_t trunced = gp_str_reserve(u8, required_capacity);
+    end:
+    *out_length = j;
+    return i;
+}
 
-    if ( ! trunced) for (; i < u16_length; ++i) // skip bounds checking
+// User has dedicated functions for validation, which is why we ignore them in
+// conversion functions for simplicity.
+
+size_t gp_utf32_from_utf8(
+    GPArray(uint32_t)* out_utf32,
+    const void*        _utf8,
+    size_t             utf8_length)
+{
+    gp_arrt_set(uint32_t, *out_utf32)->length = 0;
+    const uint8_t* utf8 = _utf8;
+    size_t trunced = 0;
+    size_t i = 0;
+    if (gp_arr_reserve(sizeof(*out_utf32)[0], out_utf32,
+        gp_utf32_length_from_utf8(utf8, utf8_length)) == 0)
+        i = gp_s_utf8_to_utf32_valid(
+            *out_utf32, &gp_arrt_set(uint32_t, *out_utf32)->length, utf8, utf8_length);
+
+    while (i < utf8_length) { // invalid or truncating
+        uint32_t decoding;
+        i += gp_utf8_decode(&decoding, utf8, utf8_length, i, &(bool){0});
+        trunced += gp_arr_push(sizeof decoding, out_utf32, &decoding);
+    }
+    return trunced;
+}
+
+size_t gp_utf8_from_utf32(
+    GPString*        out_utf8,
+    const uint32_t*  utf32,
+    size_t           utf32_length)
+{
+    gp_str_set(*out_utf8)->length = 0;
+    size_t trunced = 0;
+    bool last_is_valid = false;
+    size_t i = 0;
+    if (gp_str_reserve(out_utf8, gp_utf8_length_from_utf32(utf32, utf32_length)) == 0)
+        i = gp_s_utf32_to_utf8_valid(
+            (uint8_t*)*out_utf8, &gp_str_set(*out_utf8)->length, utf32, utf32_length);
+
+    for (; i < utf32_length; ++i) { // invalid or truncating
+        uint8_t encoding[4];
+        size_t  encoding_length = gp_utf8_encode(encoding, utf32[i], &last_is_valid);
+        trunced += gp_str_append(out_utf8, encoding, encoding_length);
+    }
+
+    // On one hand, we want to preserve invalid sequences. On the other hand,
+    // we don't want to turn valid sequences to invalid ones by truncation.
+    if (last_is_valid)
+        return trunced + gp_str_truncate_invalid_tail(out_utf8);
+    return trunced;
+}
+
+size_t gp_utf16_from_utf8(
+    GPArray(uint16_t)* out_utf16,
+    const void*        _utf8,
+    size_t             utf8_length)
+{
+    gp_arrt_set(uint16_t, *out_utf16)->length = 0;
+    const uint8_t* utf8 = _utf8;
+    size_t trunced = 0;
+    size_t i = 0;
+    if (gp_arr_reserve(sizeof(*out_utf16)[0], out_utf16,
+        gp_utf16_length_from_utf8(utf8, utf8_length)) == 0)
+        i = gp_s_utf8_to_utf16_valid(
+            *out_utf16, &gp_arrt_set(uint16_t, *out_utf16)->length, utf8, utf8_length);
+
+    while (i < utf8_length) { // invalid or truncating
+        uint32_t decoding;
+        i += gp_utf8_decode(&decoding, utf8, utf8_length, i, &(bool){0});
+        if (decoding <= UINT16_MAX)
+            trunced += gp_arr_push(sizeof(uint16_t), out_utf16, &(uint16_t){decoding});
+        else {
+            decoding &= ~0x10000;
+            uint16_t surrogate0 = (decoding >> 10)   | 0xD800;
+            uint16_t surrogate1 = (decoding & 0x3FF) | 0xDC00;
+            trunced += gp_arr_push(sizeof(uint16_t), out_utf16, &surrogate0);
+            trunced += gp_arr_push(sizeof(uint16_t), out_utf16, &surrogate1);
+        }
+    }
+    return trunced;
+}
+
+size_t gp_utf8_from_utf16(
+    GPString*        out_utf8,
+    const uint16_t*  utf16,
+    size_t           utf16_length)
+{
+    gp_str_set(*out_utf8)->length = 0;
+    size_t trunced = 0;
+    bool last_is_valid = false;
+    size_t i = 0;
+    if (gp_str_reserve(out_utf8, gp_utf8_length_from_utf16(utf16, utf16_length)) == 0)
+        i = gp_s_utf16_to_utf8_valid(
+            (uint8_t*)*out_utf8, &gp_str_set(*out_utf8)->length, utf16, utf16_length);
+
+    for (; i < utf16_length; ++i) { // invalid or truncating
+        uint32_t decoding = utf16[i];
+        if (0xD7FF < decoding && decoding < 0xE000) { // surrogate
+            if (i == utf16_length - 1)
+                return trunced + 2 + gp_str_truncate_invalid_tail(out_utf8);
+            decoding = 0x10000
+                | ((uint32_t)(utf16[i + 0] &~ 0xD800) << 10)
+                | ((uint32_t)(utf16[i + 1] &~ 0xDC00));
+        }
+        uint8_t encoding[4];
+        size_t  encoding_length = gp_utf8_encode(encoding, decoding, &last_is_valid);
+        trunced += gp_str_append(out_utf8, encoding, encoding_length);
+    }
+
+    // On one hand, we want to preserve invalid sequences. On the other hand,
+    // we don't want to turn valid sequences to invalid ones by truncation.
+    if (last_is_valid)
+        return trunced + gp_str_truncate_invalid_tail(out_utf8);
+    return trunced;
+}
+
+size_t gp_wcs_from_utf8(
+    GPArray(wchar_t)* out_wcs,
+    const void*       utf8,
+    size_t            utf8_length)
+{
+    if (sizeof(wchar_t) == sizeof(uint16_t))
+        return gp_utf16_from_utf8((GPArray(uint16_t)*)out_wcs, utf8, utf8_length);
+    return gp_utf32_from_utf8((GPArray(uint32_t)*)out_wcs, utf8, utf8_length);
+}
+
+size_t gp_utf8_from_wcs(
+    GPString*       out_utf8,
+    const wchar_t*  wcs,
+    size_t          wcs_length)
+{
+    if (sizeof(wchar_t) == sizeof(uint16_t))
+        return gp_utf8_from_utf16(out_utf8, (void*)wcs, wcs_length);
+    return gp_utf8_from_utf32(out_utf8, (void*)wcs, wcs_length);
+}
+
+size_t gp_wcs_length_from_utf8(const void* utf8, size_t utf8_length)
+{
+    if (sizeof(wchar_t) == sizeof(uint16_t))
+        return gp_utf16_length_from_utf8(utf8, utf8_length);
+    return gp_utf32_length_from_utf8(utf8, utf8_length);
+}
+
+size_t gp_utf8_length_from_wcs(const wchar_t* wcs, size_t wcs_length)
+{
+    if (sizeof(wchar_t) == sizeof(uint16_t))
+        return gp_utf8_length_from_utf16((const uint16_t*)wcs, wcs_length);
+    return gp_utf8_length_from_utf32((const uint32_t*)wcs, wcs_length);
+}
+
+// Direct buffer conversions run the same kernels as the array conversions
+// above, but write to raw pointers and leave reserving to the caller, so
+// internal users can convert to arena memory without touching array headers.
+
+size_t gp_wcs_from_utf8_unsafe(
+    wchar_t*    out,
+    const void* _utf8,
+    size_t      utf8_length)
+{
+    const uint8_t* utf8 = _utf8;
+    size_t length;
+    size_t i;
+    if (sizeof(wchar_t) == sizeof(uint16_t))
+        i = gp_s_utf8_to_utf16_valid((uint16_t*)out, &length, utf8, utf8_length);
+    else
+        i = gp_s_utf8_to_utf32_valid((uint32_t*)out, &length, utf8, utf8_length);
+
+    while (i < utf8_length) { // invalid
+        uint32_t decoding;
+        i += gp_utf8_decode(&decoding, utf8, utf8_length, i, &(bool){0});
+        if (sizeof(wchar_t) == sizeof(uint32_t) || decoding <= UINT16_MAX)
+            out[length++] = decoding;
+        else { // like gp_utf16_from_utf8()
+            decoding &= ~0x10000;
+            out[length++] = (decoding >> 10)   | 0xD800;
+            out[length++] = (decoding & 0x3FF) | 0xDC00;
+        }
+    }
+    out[length] = L'\0';
+    return length;
+}
+
+size_t gp_utf8_from_wcs_unsafe(
+    void*          _out,
+    const wchar_t* wcs,
+    size_t         wcs_length)
+{
+    uint8_t* out = _out;
+    size_t length;
+    size_t i;
+    if (sizeof(wchar_t) == sizeof(uint16_t))
+        i = gp_s_utf16_to_utf8_valid(out, &length, (const uint16_t*)wcs, wcs_length);
+    else
+        i = gp_s_utf32_to_utf8_valid(out, &length, (const uint32_t*)wcs, wcs_length);
+
+    for (; i < wcs_length; ++i) { // invalid
+        uint32_t decoding = (uint32_t)wcs[i];
+        if (sizeof(wchar_t) == sizeof(uint16_t)
+            && 0xD800 <= decoding && decoding <= 0xDBFF
+            && i + 1 < wcs_length && ((uint32_t)wcs[i + 1] & 0xFC00) == 0xDC00)
+            decoding = 0x10000 + ((decoding & 0x3FF) << 10 | ((uint32_t)wcs[++i] & 0x3FF));
+        length += gp_utf8_encode(out + length, decoding, &(bool){0});
+    }
+    return length;
+}
+
+// All gp_utfX_to_utfY() functions skip any Unicode validation. This makes them
+// unsafe, which is why they are private for now. They are faster though, so
+// don't remove, publish as unsafe functions if they turn out to be useful.
+
+size_t gp_utf8_to_utf32(
+    GPArray(uint32_t)* u32,
+    const void*const   u8,
+    const size_t       u8_length)
+{
+    ((GPArrayHeader*)*u32 - 1)->length = 0;
+    size_t i = 0;
+    size_t codepoint_length;
+    uint32_t decoding;
+    for (; gp_arr_length(*u32) < gp_arr_capacity(*u32); i += codepoint_length)
     {
-        if (u16[i] > 0x7F)
+        if (i >= u8_length)
+            return 0;
+        codepoint_length = gp_utf8_decode_unsafe(&decoding, u8, i);
+        (*u32)[((GPArrayHeader*)*u32 - 1)->length++] = decoding;
+    }
+    size_t gp_internal_bytes_codepoint_count(const void*, size_t);
+    size_t trunced = gp_arr_reserve(sizeof(*u32)[0], u32,
+        gp_arr_length(*u32) + gp_internal_bytes_codepoint_count((uint8_t*)u8 + i, u8_length - i));
+
+    if ( ! trunced ) for (; i < u8_length; i += codepoint_length)
+    {
+        codepoint_length = gp_utf8_decode_unsafe(&decoding, u8, i);
+        (*u32)[((GPArrayHeader*)*u32 - 1)->length++] = decoding;
+    }
+    else for (; i < u8_length && gp_arr_length(*u32) < gp_arr_capacity(*u32); i += codepoint_length)
+    {
+        codepoint_length = gp_utf8_decode_unsafe(&decoding, u8, i);
+        (*u32)[((GPArrayHeader*)*u32 - 1)->length++] = decoding;
+    }
+    return trunced;
+}
+
+size_t gp_utf32_to_utf8(
+    GPString*        u8,
+    const uint32_t*  u32,
+    size_t           u32_length)
+{
+    ((GPStringHeader*)*u8 - 1)->length = 0;
+    size_t i = 0;
+    #ifndef GP_STATIC_ANALYSIS // false positive on writes
+    for (; gp_str_length(*u8) + 3 < gp_str_capacity(*u8); ++i) // skip bounds checking
+    { // Manually inlined gp_utf8_encode() is faster for some reason.
+        if (i >= u32_length)
+            return 0;
+
+        if (u32[i] > 0x7F)
         {
-            if (u16[i] < 0x800) {
-                (*u8)[gp_str_length(*u8) + 0].c = ((u16[i] & 0x000FC0) >>  6) | 0xC0;
-                (*u8)[gp_str_length(*u8) + 1].c = ((u16[i] & 0x00003F) >>  0) | 0x80;
+            if (u32[i] < 0x800) {
+                (*u8)[gp_str_length(*u8) + 0].c = ((u32[i] & 0x000FC0) >>  6) | 0xC0;
+                (*u8)[gp_str_length(*u8) + 1].c = ((u32[i] & 0x00003F) >>  0) | 0x80;
                 ((GPStringHeader*)*u8 - 1)->length += 2;
-            } else if (u16[i] <= 0xD7FF || 0xE000 <= u16[i]) {
-                (*u8)[gp_str_length(*u8) + 0].c = ((u16[i] & 0x03F000) >> 12) | 0xE0;
-                (*u8)[gp_str_length(*u8) + 1].c = ((u16[i] & 0x000FC0) >>  6) | 0x80;
-                (*u8)[gp_str_length(*u8) + 2].c = ((u16[i] & 0x00003F) >>  0) | 0x80;
+            } else if (u32[i] < 0x10000) {
+                (*u8)[gp_str_length(*u8) + 0].c = ((u32[i] & 0x03F000) >> 12) | 0xE0;
+                (*u8)[gp_str_length(*u8) + 1].c = ((u32[i] & 0x000FC0) >>  6) | 0x80;
+                (*u8)[gp_str_length(*u8) + 2].c = ((u32[i] & 0x00003F) >>  0) | 0x80;
                 ((GPStringHeader*)*u8 - 1)->length += 3;
-            } else { // surrogate pair
-                const uint32_t encoding = 0x10000
-                    | ((uint32_t)(u16[i + 0] &~ 0xD800) << 10)
-                    | ((uint32_t)(u16[i + 1] &~ 0xDC00));
-                (*u8)[gp_str_length(*u8) + 0].c = ((encoding & 0x1C0000) >> 18) | 0xF0;
-                (*u8)[gp_str_length(*u8) + 1].c = ((encoding & 0x03F000) >> 12) | 0x80;
-                (*u8)[gp_str_length(*u8) + 2].c = ((encoding & 0x000FC0) >>  6) | 0x80;
-                (*u8)[gp_str_length(*u8) + 3].c = ((encoding & 0x00003F) >>  0) | 0x80;
+            } else {
+                (*u8)[gp_str_length(*u8) + 0].c = ((u32[i] & 0x1C0000) >> 18) | 0xF0;
+                (*u8)[gp_str_length(*u8) + 1].c = ((u32[i] & 0x03F000) >> 12) | 0x80;
+                (*u8)[gp_str_length(*u8) + 2].c = ((u32[i] & 0x000FC0) >>  6) | 0x80;
+                (*u8)[gp_str_length(*u8) + 3].c = ((u32[i] & 0x00003F) >>  0) | 0x80;
                 ((GPStringHeader*)*u8 - 1)->length += 4;
-                ++i;
             }
         }
         else
-        {
-            (*u8)[((GPStringHeader*)*u8 - 1)->length++].c = u16[i];
+        { // Also this weird control flow is somewhat faster for some reason.
+          // Maybe it's better for the branch predictor?
+            (*u8)[((GPStringHeader*)*u8 - 1)->length++].c = u32[i];
         }
     }
-    else for (; i < u16_length && gp_str_length(*u8) < gp_str_capacity(*u8); ++i)
+    #endif
+
+    size_t required_capacity = gp_str_length(*u8);
+    for (size_t j = i; j < u32_length; ++j)
     {
-        if (u16[i] > 0x7F)
+        if (u32[j] > 0x7F)
         {
-            if (u16[i] < 0x800) {
-                if (gp_str_length(*u8) + 2 > gp_str_capacity(*u8))
-                    return trunced + gp_str_capacity(*u8) - gp_str_length(*u8);
-                (*u8)[gp_str_length(*u8) + 0].c = ((u16[i] & 0x000FC0) >>  6) | 0xC0;
-                (*u8)[gp_str_length(*u8) + 1].c = ((u16[i] & 0x00003F) >>  0) | 0x80;
-                ((GPStringHeader*)*u8 - 1)->length += 2;
-            } else if (u16[i] <= 0xD7FF || 0xE000 <= u16[i]) {
-                if (gp_str_length(*u8) + 3 > gp_str_capacity(*u8))
+            if (u32[j] < 0x800)
+                required_capacity += 2;
+            else if (u32[j] < 0x10000)
+                required_capacity += 3;
+            else
+                required_capacity += 4;
+        }
+        else
+            ++required_capacity;
+    }
+    size_t trunced = gp_str_reserve(u8, required_capacity);
+
+    if ( ! trunced) for (; i < u32_length; ++i) // skip bounds checking
+    {
+        if (u32[i] > 0x7F)
+        {
+            if (u32[i] < 0x800) {
+                (*u8)[gp_str_length(*u8) + 0].c = ((u32[i] & 0x000FC0) >>  6) | 0xC0;
+                (*u8)[gp_str_length(*u8) + 1].c = ((u32[i] & 0x00003F) >>  0) | 0x80;
+                ((GPStringHeader*)*u8 - 1)->length += 2;
+            } else if (u32[i] < 0x10000) {
+                (*u8)[gp_str_length(*u8) + 0].c = ((u32[i] & 0x03F000) >> 12) | 0xE0;
+                (*u8)[gp_str_length(*u8) + 1].c = ((u32[i] & 0x000FC0) >>  6) | 0x80;
+                (*u8)[gp_str_length(*u8) + 2].c = ((u32[i] & 0x00003F) >>  0) | 0x80;
+                ((GPStringHeader*)*u8 - 1)->length += 3;
+            } else {
+                (*u8)[gp_str_length(*u8) + 0].c = ((u32[i] & 0x1C0000) >> 18) | 0xF0;
+                (*u8)[gp_str_length(*u8) + 1].c = ((u32[i] & 0x03F000) >> 12) | 0x80;
+                (*u8)[gp_str_length(*u8) + 2].c = ((u32[i] & 0x000FC0) >>  6) | 0x80;
+                (*u8)[gp_str_length(*u8) + 3].c = ((u32[i] & 0x00003F) >>  0) | 0x80;
+                ((GPStringHeader*)*u8 - 1)->length += 4;
+            }
+        }
+        else
+            (*u8)[((GPStringHeader*)*u8 - 1)->length++].c = u32[i];
+    }
+    else for (; i < u32_length && gp_str_length(*u8) < gp_str_capacity(*u8); ++i)
+    {
+        #ifdef GP_STATIC_ANALYSIS // buffer overflow false positive, bounds checked before writing anything
+        gp_str_set(*u8)->length = gp_str_capacity(*u8);
+        return trunced;
+        #endif
+
+        if (u32[i] > 0x7F)
+        {
+            if (u32[i] < 0x800) {
+                if (gp_str_length(*u8) + 2 > gp_str_capacity(*u8))
+                    return trunced + gp_str_capacity(*u8) - gp_str_length(*u8);
+                (*u8)[gp_str_length(*u8) + 0].c = ((u32[i] & 0x000FC0) >>  6) | 0xC0;
+                (*u8)[gp_str_length(*u8) + 1].c = ((u32[i] & 0x00003F) >>  0) | 0x80;
+                ((GPStringHeader*)*u8 - 1)->length += 2;
+            } else if (u32[i] < 0x10000) {
+                if (gp_str_length(*u8) + 3 > gp_str_capacity(*u8))
+                    return trunced + gp_str_capacity(*u8) - gp_str_length(*u8);
+                (*u8)[gp_str_length(*u8) + 0].c = ((u32[i] & 0x03F000) >> 12) | 0xE0;
+                (*u8)[gp_str_length(*u8) + 1].c = ((u32[i] & 0x000FC0) >>  6) | 0x80;
+                (*u8)[gp_str_length(*u8) + 2].c = ((u32[i] & 0x00003F) >>  0) | 0x80;
+                ((GPStringHeader*)*u8 - 1)->length += 3;
+            } else {
+                if (gp_str_length(*u8) + 4 > gp_str_capacity(*u8)) // bounds checked here
+                    return trunced + gp_str_capacity(*u8) - gp_str_length(*u8);
+                (*u8)[gp_str_length(*u8) + 0].c = ((u32[i] & 0x1C0000) >> 18) | 0xF0;
+                (*u8)[gp_str_length(*u8) + 1].c = ((u32[i] & 0x03F000) >> 12) | 0x80;
+                (*u8)[gp_str_length(*u8) + 2].c = ((u32[i] & 0x000FC0) >>  6) | 0x80;
+                (*u8)[gp_str_length(*u8) + 3].c = ((u32[i] & 0x00003F) >>  0) | 0x80; // false positive here
+                ((GPStringHeader*)*u8 - 1)->length += 4;
+            }
+        }
+        else
+            (*u8)[((GPStringHeader*)*u8 - 1)->length++].c = u32[i];
+    }
+
+    return trunced;
+}
+
+size_t gp_utf8_to_utf16(
+    GPArray(uint16_t)* u16,
+    const void*        u8,
+    size_t             u8_length)
+{
+    ((GPArrayHeader*)*u16 - 1)->length = 0;
+    size_t i = 0;
+    size_t codepoint_length;
+    uint32_t decoding;
+    for (; gp_arr_length(*u16) < gp_arr_capacity(*u16); i += codepoint_length)
+    {
+        if (i >= u8_length)
+            return 0;
+        codepoint_length = gp_utf8_decode_unsafe(&decoding, u8, i);
+        if (decoding <= UINT16_MAX) {
+            (*u16)[((GPArrayHeader*)*u16 - 1)->length++] = decoding;
+        } else {
+            if (GP_UNLIKELY(gp_arr_length(*u16) + 2 > gp_arr_capacity(*u16)))
+                break;
+            decoding &= ~0x10000;
+            (*u16)[gp_arr_length(*u16) + 0] = (decoding >> 10)   | 0xD800;
+            (*u16)[gp_arr_length(*u16) + 1] = (decoding & 0x3FF) | 0xDC00;
+            ((GPArrayHeader*)*u16 - 1)->length += 2;
+        }
+    }
+    size_t capacity_needed = gp_arr_length(*u16);
+    for (size_t j = i; j < u8_length; j += codepoint_length) {
+        codepoint_length = gp_utf8_decode_codepoint_length(u8, j);
+        capacity_needed += codepoint_length <= 3 ? 1 : 2;
+    }
+    size_t trunced = gp_arr_reserve(sizeof(*u16)[0], u16, capacity_needed);
+
+    if ( ! trunced) for (; i < u8_length; i += codepoint_length)
+    {
+        codepoint_length = gp_utf8_decode_unsafe(&decoding, u8, i);
+        if (decoding <= UINT16_MAX) {
+            (*u16)[((GPArrayHeader*)*u16 - 1)->length++] = decoding;
+        } else {
+            decoding &= ~0x10000;
+            (*u16)[gp_arr_length(*u16) + 0] = (decoding >> 10)   | 0xD800;
+            (*u16)[gp_arr_length(*u16) + 1] = (decoding & 0x3FF) | 0xDC00;
+            ((GPArrayHeader*)*u16 - 1)->length += 2;
+        }
+    }
+    else for (; i < u8_length && gp_arr_length(*u16) < gp_arr_capacity(*u16); i += codepoint_length)
+    {
+        codepoint_length = gp_utf8_decode_unsafe(&decoding, u8, i);
+        if (decoding <= UINT16_MAX) {
+            (*u16)[((GPArrayHeader*)*u16 - 1)->length++] = decoding;
+        } else {
+            decoding &= ~0x10000;
+            (*u16)[gp_arr_length(*u16) + 0] = (decoding >> 10)   | 0xD800;
+            (*u16)[gp_arr_length(*u16) + 1] = (decoding & 0x3FF) | 0xDC00;
+            ((GPArrayHeader*)*u16 - 1)->length += 2;
+        }
+    }
+    return trunced;
+}
+
+size_t gp_utf16_to_utf8(
+    GPString*        u8,
+    const uint16_t*  u16,
+    size_t           u16_length)
+{
+    ((GPStringHeader*)*u8 - 1)->length = 0;
+    size_t i = 0;
+    for (; gp_str_length(*u8) + 3 < gp_str_capacity(*u8); ++i) // skip bounds checking
+    {
+        if (i >= u16_length)
+            return 0;
+
+        if (u16[i] > 0x7F)
+        {
+            if (u16[i] < 0x800) {
+                (*u8)[gp_str_length(*u8) + 0].c = ((u16[i] & 0x000FC0) >>  6) | 0xC0;
+                (*u8)[gp_str_length(*u8) + 1].c = ((u16[i] & 0x00003F) >>  0) | 0x80;
+                ((GPStringHeader*)*u8 - 1)->length += 2;
+            } else if (u16[i] <= 0xD7FF || 0xE000 <= u16[i]) {
+                (*u8)[gp_str_length(*u8) + 0].c = ((u16[i] & 0x03F000) >> 12) | 0xE0;
+                (*u8)[gp_str_length(*u8) + 1].c = ((u16[i] & 0x000FC0) >>  6) | 0x80;
+                (*u8)[gp_str_length(*u8) + 2].c = ((u16[i] & 0x00003F) >>  0) | 0x80;
+                ((GPStringHeader*)*u8 - 1)->length += 3;
+            } else { // surrogate pair
+                const uint32_t decoding = 0x10000
+                    | ((uint32_t)(u16[i + 0] &~ 0xD800) << 10)
+                    | ((uint32_t)(u16[i + 1] &~ 0xDC00));
+                (*u8)[gp_str_length(*u8) + 0].c = ((decoding & 0x1C0000) >> 18) | 0xF0;
+                (*u8)[gp_str_length(*u8) + 1].c = ((decoding & 0x03F000) >> 12) | 0x80;
+                (*u8)[gp_str_length(*u8) + 2].c = ((decoding & 0x000FC0) >>  6) | 0x80;
+                (*u8)[gp_str_length(*u8) + 3].c = ((decoding & 0x00003F) >>  0) | 0x80;
+                ((GPStringHeader*)*u8 - 1)->length += 4;
+                ++i;
+            }
+        }
+        else
+            (*u8)[((GPStringHeader*)*u8 - 1)->length++].c = u16[i];
+    }
+
+    size_t required_capacity = gp_str_length(*u8);
+    for (size_t j = i; j < u16_length; ++j)
+    {
+        if (u16[j] > 0x7F)
+        {
+            if (u16[j] < 0x800)
+                required_capacity += 2;
+            else if (u16[j] <= 0xD7FF || 0xE000 <= u16[j])
+                required_capacity += 3;
+            else
+                required_capacity += 4;
+        }
+        else
+            ++required_capacity;
+    }
+    size_t trunced = gp_str_reserve(u8, required_capacity);
+
+    if ( ! trunced) for (; i < u16_length; ++i) // skip bounds checking
+    {
+        if (u16[i] > 0x7F)
+        {
+            if (u16[i] < 0x800) {
+                (*u8)[gp_str_length(*u8) + 0].c = ((u16[i] & 0x000FC0) >>  6) | 0xC0;
+                (*u8)[gp_str_length(*u8) + 1].c = ((u16[i] & 0x00003F) >>  0) | 0x80;
+                ((GPStringHeader*)*u8 - 1)->length += 2;
+            } else if (u16[i] <= 0xD7FF || 0xE000 <= u16[i]) {
+                (*u8)[gp_str_length(*u8) + 0].c = ((u16[i] & 0x03F000) >> 12) | 0xE0;
+                (*u8)[gp_str_length(*u8) + 1].c = ((u16[i] & 0x000FC0) >>  6) | 0x80;
+                (*u8)[gp_str_length(*u8) + 2].c = ((u16[i] & 0x00003F) >>  0) | 0x80;
+                ((GPStringHeader*)*u8 - 1)->length += 3;
+            } else { // surrogate pair
+                const uint32_t encoding = 0x10000
+                    | ((uint32_t)(u16[i + 0] &~ 0xD800) << 10)
+                    | ((uint32_t)(u16[i + 1] &~ 0xDC00));
+                (*u8)[gp_str_length(*u8) + 0].c = ((encoding & 0x1C0000) >> 18) | 0xF0;
+                (*u8)[gp_str_length(*u8) + 1].c = ((encoding & 0x03F000) >> 12) | 0x80;
+                (*u8)[gp_str_length(*u8) + 2].c = ((encoding & 0x000FC0) >>  6) | 0x80;
+                (*u8)[gp_str_length(*u8) + 3].c = ((encoding & 0x00003F) >>  0) | 0x80;
+                ((GPStringHeader*)*u8 - 1)->length += 4;
+                ++i;
+            }
+        }
+        else
+        {
+            (*u8)[((GPStringHeader*)*u8 - 1)->length++].c = u16[i];
+        }
+    }
+    else for (; i < u16_length && gp_str_length(*u8) < gp_str_capacity(*u8); ++i)
+    {
+        if (u16[i] > 0x7F)
+        {
+            if (u16[i] < 0x800) {
+                if (gp_str_length(*u8) + 2 > gp_str_capacity(*u8))
+                    return trunced + gp_str_capacity(*u8) - gp_str_length(*u8);
+                (*u8)[gp_str_length(*u8) + 0].c = ((u16[i] & 0x000FC0) >>  6) | 0xC0;
+                (*u8)[gp_str_length(*u8) + 1].c = ((u16[i] & 0x00003F) >>  0) | 0x80;
+                ((GPStringHeader*)*u8 - 1)->length += 2;
+            } else if (u16[i] <= 0xD7FF || 0xE000 <= u16[i]) {
+                if (gp_str_length(*u8) + 3 > gp_str_capacity(*u8))
                     return trunced + gp_str_capacity(*u8) - gp_str_length(*u8);
                 (*u8)[gp_str_length(*u8) + 0].c = ((u16[i] & 0x03F000) >> 12) | 0xE0;
                 (*u8)[gp_str_length(*u8) + 1].c = ((u16[i] & 0x000FC0) >>  6) | 0x80;
@@ -868,195 +1665,1354 @@ size_t gp_utf16_to_utf8(
                 (*u8)[gp_str_length(*u8) + 3].c = ((encoding & 0x00003F) >>  0) | 0x80;
                 ((GPStringHeader*)*u8 - 1)->length += 4;
                 ++i;
-            }
+            }
+        }
+        else
+        {
+            (*u8)[((GPStringHeader*)*u8 - 1)->length++].c = u16[i];
+        }
+    }
+    return trunced;
+}
+
+size_t gp_utf8_to_wcs(
+    GPArray(wchar_t)* wcs,
+    const void*       utf8,
+    size_t            utf8_length)
+{
+    size_t trunced;
+    if (WCHAR_MAX > UINT16_MAX)
+        trunced = gp_utf32_from_utf8((GPArray(uint32_t)*)wcs, utf8, utf8_length);
+    else
+        trunced = gp_utf16_from_utf8((GPArray(uint16_t)*)wcs, utf8, utf8_length);
+    trunced += gp_arr_reserve(sizeof(*wcs)[0], wcs, gp_arr_length(*wcs) + sizeof"");
+    if (gp_arrt_length(wchar_t, *wcs) == 0)
+        return trunced;
+    if (gp_arrt_length(wchar_t, *wcs) == gp_arrt_capacity(wchar_t, *wcs)) {
+        gp_arrt_set(wchar_t, *wcs)->length--;
+        ++trunced;
+    }
+    (*wcs)[gp_arrt_length(wchar_t, *wcs)] = L'\0';
+    return trunced;
+}
+
+size_t gp_wcs_to_utf8(
+    GPString*       utf8,
+    const wchar_t*  wcs,
+    size_t          wcs_length)
+
+{
+    if (WCHAR_MAX > UINT16_MAX)
+        return gp_utf8_from_utf32(utf8, (uint32_t*)wcs, wcs_length);
+    else
+        return gp_utf8_from_utf16(utf8, (uint16_t*)wcs, wcs_length);
+}
+
+uint32_t gp_u32_to_upper(uint32_t);
+uint32_t gp_u32_to_lower(uint32_t);
+uint32_t gp_u32_to_title(uint32_t);
+
+// ----------------------------------------------------------------------------
+// String extensions
+
+static size_t gp_s_utf8_find_first_of(
+    const void*const haystack,
+    const size_t     haystack_length,
+    const char*const char_set,
+    const size_t     start)
+{
+    #ifndef NDEBUG
+    gp_assert(gp_utf8_is_valid(char_set, strlen(char_set), NULL));
+    #endif
+    for (size_t cplen, i = start; i < haystack_length; i += cplen) {
+        if ( ! gp_utf8_is_valid_codepoint(haystack, haystack_length, i, &cplen))
+            continue;
+        if (strstr(char_set, memcpy((char[8]){""}, (char*)haystack + i, cplen)) != NULL)
+            return i;
+    }
+    return GP_NOT_FOUND;
+}
+
+static size_t gp_s_utf8_find_first_not_of(
+    const void*const haystack,
+    const size_t     haystack_length,
+    const char*const char_set,
+    const size_t     start)
+{
+    #ifndef NDEBUG
+    gp_assert(gp_utf8_is_valid(char_set, strlen(char_set), NULL));
+    #endif
+    for (size_t cplen, i = start; i < haystack_length; i += cplen) {
+        if ( ! gp_utf8_is_valid_codepoint(
+            haystack, haystack_length, i, &cplen))
+            return i;
+        if (strstr(char_set, memcpy((char[8]){""}, (char*)haystack + i, cplen)) == NULL)
+            return i;
+    }
+    return GP_NOT_FOUND;
+}
+
+GPArray(GPString) gp_str_split(
+    GPAllocator* allocator,
+    const void*const str,
+    const size_t str_length,
+    const char*const separators)
+{
+    GPArray(GPString) substrs = NULL;
+    size_t j, i = gp_s_utf8_find_first_not_of(str, str_length, separators, 0);
+    if (i == GP_NOT_FOUND)
+        return gp_arr_new(sizeof(GPString), allocator, 1);
+
+    size_t indices_length = 0;
+    struct start_end_pair {
+        size_t start, end;
+    } indices[256];
+
+    while (i != GP_NOT_FOUND)
+    {
+        for (indices_length = 0;
+            indices_length < sizeof indices / sizeof indices[0];
+            ++indices_length)
+        {
+            indices[indices_length].start = i;
+            i = gp_s_utf8_find_first_of(str, str_length, separators, i);
+            if (i == GP_NOT_FOUND) {
+                indices[indices_length++].end = str_length;
+                break;
+            }
+            indices[indices_length].end = i;
+            i = gp_s_utf8_find_first_not_of(str, str_length, separators, i);
+            if (i == GP_NOT_FOUND) {
+                ++indices_length;
+                break;
+            }
+        }
+
+        if (substrs == NULL)
+            substrs = gp_arr_new(
+                sizeof(GPString),
+                allocator,
+                i == GP_NOT_FOUND ? indices_length : 2 * indices_length);
+        else
+            gp_arr_reserve(
+                sizeof(GPString),
+                &substrs,
+                i == GP_NOT_FOUND ?
+                    gp_arr_length(substrs) + indices_length
+                  : 3 * gp_arr_length(substrs));
+
+        for (j = 0; j < indices_length; ++j)
+        {
+            substrs[gp_arr_length(substrs) + j] = gp_str_new(
+                allocator,
+                gp_next_power_of_2(indices[j].end - indices[j].start));
+
+            ((GPStringHeader*)(substrs[gp_arr_length(substrs) + j]) - 1)->length =
+                indices[j].end - indices[j].start;
+            memcpy(
+                substrs[gp_arr_length(substrs) + j],
+                (uint8_t*)str + indices[j].start,
+                gp_str_length(substrs[gp_arr_length(substrs) + j]));
+        }
+        ((GPArrayHeader*)substrs - 1)->length += indices_length;
+    }
+    return substrs;
+}
+
+void gp_str_join(GPString* out, GPArray(GPString) strs, const char* separator)
+{
+    ((GPStringHeader*)*out - 1)->length = 0;
+    if (gp_arr_length(strs) == 0)
+        return;
+
+    const size_t separator_length = strlen(separator);
+    size_t required_capacity = -separator_length;
+    for (size_t i = 0; i < gp_arr_length(strs); ++i)
+        required_capacity += gp_str_length(strs[i]) + separator_length;
+
+    gp_str_reserve(out, required_capacity);
+    for (size_t i = 0; i < gp_arr_length(strs) - 1; ++i)
+    {
+        memcpy(*out + gp_str_length(*out), strs[i], gp_str_length(strs[i]));
+        memcpy(*out + gp_str_length(*out) + gp_str_length(strs[i]), separator, separator_length);
+        ((GPStringHeader*)*out - 1)->length += gp_str_length(strs[i]) + separator_length;
+    }
+    memcpy(
+        *out + gp_str_length(*out),
+        strs[gp_arr_length(strs) - 1],
+        gp_str_length(strs[gp_arr_length(strs) - 1]));
+    ((GPStringHeader*)*out - 1)->length += gp_str_length(strs[gp_arr_length(strs) - 1]);
+}
+
+// ----------------------------------------------------------------------------
+// Split Iterator
+
+static GPStrSplitIterator gp_s_split_iterator_init(
+    const char* separator,
+    const int   flags,
+    const size_t max_splits)
+{
+    gp_assert(flags == 0 || flags == GP_SPLIT_STRING, "Invalid split flags.");
+    #ifndef NDEBUG
+    gp_assert(gp_utf8_is_valid(separator, strlen(separator), NULL));
+    #endif
+    GPStrSplitIterator it = {
+        .separator           = separator,
+        .separator_length    = strlen(separator),
+        .max_splits          = max_splits,
+        .separator_is_string = flags == GP_SPLIT_STRING
+    };
+    gp_db_assert( ! it.separator_is_string || it.separator_length > 0,
+        "Empty separator string.");
+
+    // Skip strstr() for ASCII separators.
+    for (size_t i = 0; i < it.separator_length; ++i)
+        if ((uint8_t)separator[i] < 0x80)
+            it.ascii_set[(uint8_t)separator[i] / 64] |= 1ull << (separator[i] % 64);
+    return it;
+}
+
+GPStrSplitIterator gp_str_split_iterator(
+    const void*  str,
+    const size_t str_length,
+    const char*  separator,
+    const int    flags,
+    const size_t max_splits)
+{
+    GPStrSplitIterator it = gp_s_split_iterator_init(separator, flags, max_splits);
+    it.data     = (char*)str; // only written to when reading streams
+    it.length   = str_length;
+    it.capacity = str_length;
+    return it;
+}
+
+GPStrSplitIterator gp_file_split_iterator(
+    FILE*        stream,
+    void*        buffer,
+    const size_t buffer_capacity,
+    const char*  separator,
+    const int    flags,
+    const size_t max_splits)
+{
+    GPStrSplitIterator it = gp_s_split_iterator_init(separator, flags, max_splits);
+    gp_db_assert(buffer_capacity >= 4 && buffer_capacity > it.separator_length,
+        "Split iterator buffer too small.");
+    it.data     = buffer;
+    it.capacity = buffer_capacity;
+    it.stream   = stream;
+    return it;
+}
+
+static bool gp_s_split_is_complete(const GPStrSplitIterator* it)
+{
+    return it->stream == NULL || it->eof;
+}
+
+// Discard consumed data and read more. Returns the number of bytes discarded.
+static size_t gp_s_split_refill(GPStrSplitIterator* it)
+{
+    const size_t discarded = it->start;
+    memmove(it->data, it->data + it->start, it->length - it->start);
+    it->length -= it->start;
+    it->start   = 0;
+
+    const size_t requested = it->capacity - it->length;
+    const size_t read = fread(it->data + it->length, sizeof(char), requested, it->stream);
+    it->length += read;
+    it->eof     = read < requested;
+    return discarded;
+}
+
+// Finds first codepoint that is or is not a separator starting from start. If
+// input is not complete, scanning stops at a codepoint truncated by the end of
+// the buffer. Invalid codepoints are never separators. If not found, stores the
+// position where the search can be resumed to resume.
+static size_t gp_s_split_find_char_set(
+    const GPStrSplitIterator* it,
+    const size_t start,
+    const bool   complete,
+    const bool   separator,
+    size_t*      resume)
+{
+    size_t i = start;
+    for (size_t cplen; i < it->length; i += cplen)
+    {
+        const uint8_t c = it->data[i];
+        bool is_separator;
+        if (c < 0x80) {
+            cplen = 1;
+            is_separator = it->ascii_set[c / 64] & (1ull << (c % 64));
+        } else if ( ! complete && i + gp_utf8_decode_codepoint_length(it->data, i) > it->length)
+            break; // rest of the codepoint not read yet
+        else if ( ! gp_utf8_is_valid_codepoint(it->data, it->length, i, &cplen))
+            is_separator = false;
+        else
+            is_separator = strstr(it->separator,
+                memcpy((char[8]){""}, it->data + i, cplen)) != NULL;
+
+        if (is_separator == separator)
+            return i;
+    }
+    *resume = i;
+    return GP_NOT_FOUND;
+}
+
+static size_t gp_s_split_find_string(
+    const GPStrSplitIterator* it,
+    const size_t start,
+    size_t*      resume)
+{
+    if (it->length - start < it->separator_length) {
+        *resume = start;
+        return GP_NOT_FOUND;
+    }
+    const size_t last = it->length - it->separator_length;
+    for (const char* p = it->data + start;
+        (p = memchr(p, it->separator[0], last + 1 - (p - it->data))) != NULL;
+        ++p)
+    {
+        if (memcmp(p, it->separator, it->separator_length) == 0)
+            return p - it->data;
+    }
+    *resume = last + 1;
+    return GP_NOT_FOUND;
+}
+
+bool gp_str_split_next(GPStrSplitIterator* it)
+{
+    const bool continuing = it->partial;
+    it->partial      = false;
+    it->token_length = 0;
+    if (it->finished)
+        return false;
+
+    size_t resume;
+    if ( ! it->separator_is_string && ! continuing) while (true) // skip separators
+    {
+        const bool complete = gp_s_split_is_complete(it);
+        const size_t i = gp_s_split_find_char_set(it, it->start, complete, false, &resume);
+        if (i != GP_NOT_FOUND) {
+            it->start = i;
+            break;
+        }
+        it->start = resume;
+        if (complete) {
+            it->finished = true;
+            return false;
+        }
+        gp_s_split_refill(it);
+    }
+
+    const bool remainder = it->max_splits != 0 && it->splits == it->max_splits;
+    size_t scan = it->start;
+    size_t end;
+    while (true)
+    {
+        const bool complete = gp_s_split_is_complete(it);
+        if (remainder) {
+            end    = GP_NOT_FOUND;
+            resume = it->length;
+        } else if (it->separator_is_string)
+            end = gp_s_split_find_string(it, scan, &resume);
+        else
+            end = gp_s_split_find_char_set(it, scan, complete, true, &resume);
+
+        if (end != GP_NOT_FOUND)
+            break;
+        if (complete) {
+            end = it->length;
+            it->finished = true;
+            break;
+        }
+        if (it->start == 0 && it->length == it->capacity) { // buffer full
+            // Keep the last codepoint, which is not a separator, in the buffer
+            // so the last part of the token is never empty.
+            size_t length = resume;
+            if (length == it->length)
+                do --length;
+                while (length > 0 && resume - length < 4 && ((uint8_t)it->data[length] & 0xC0) == 0x80);
+            if (length == 0)
+                length = resume;
+            it->token        = it->data;
+            it->token_length = length;
+            it->partial      = true;
+            it->start        = length;
+            return true;
+        }
+        scan = resume - gp_s_split_refill(it);
+    }
+
+    it->token        = it->data + it->start;
+    it->token_length = end - it->start;
+    if ( ! it->finished) {
+        ++it->splits;
+        it->start = end + (it->separator_is_string ? it->separator_length : 0);
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Text segmentation
+//
+// Break properties are looked up from a three-level table generated by
+// tools/breaktablegen.c, see src/break_table.h. Rules are checked in the order
+// they are listed in UAX #29 and UAX #14 and first matching rule wins. Runs of
+// ASCII letters and digits are skipped without lookups, since no rule can
+// break them apart.
+
+enum { GP_SEGMENT_GRAPHEME, GP_SEGMENT_WORD, GP_SEGMENT_LINE };
+
+typedef struct gp_break_property
+{
+    uint32_t codepoint;
+    size_t   length; // in bytes
+    uint8_t  grapheme;
+    uint8_t  word;
+    uint8_t  line;
+    uint8_t  flags;
+} GPBreakProperty;
+
+static GPBreakProperty gp_s_break_property(const char* str, size_t length, size_t i)
+{
+    GPBreakProperty p;
+    if ((uint8_t)str[i] < 0x80) {
+        p.codepoint = (uint8_t)str[i];
+        p.length    = 1;
+    } else {
+        bool is_valid;
+        p.length = gp_utf8_decode(&p.codepoint, str, length, i, &is_valid);
+    }
+    const uint32_t c = p.codepoint;
+    const uint8_t* record = gp_break_records[0];
+    if (c < GP_BREAK_TABLE_LIMIT) {
+        const size_t i1 = (size_t)gp_break_stage0[c >> (GP_BREAK_STAGE1_SHIFT + GP_BREAK_STAGE2_SHIFT)]
+            << GP_BREAK_STAGE1_SHIFT | (c >> GP_BREAK_STAGE2_SHIFT & GP_BREAK_STAGE1_MASK);
+        record = gp_break_records[
+            (size_t)gp_break_stage2[(size_t)gp_break_stage1[i1] << GP_BREAK_STAGE2_SHIFT | (c & GP_BREAK_STAGE2_MASK)]];
+    }
+    p.grapheme = record[0];
+    p.word     = record[1];
+    p.line     = record[2];
+    p.flags    = record[3];
+    return p;
+}
+
+static bool gp_s_is_ascii_alnum(const char c)
+{
+    return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || ('0' <= c && c <= '9');
+}
+
+// Same as gp_s_break_property() for ASCII letters and digits.
+static GPBreakProperty gp_s_ascii_alnum_break_property(const char c)
+{
+    const bool digit = '0' <= c && c <= '9';
+    return (GPBreakProperty){
+        .codepoint = (uint8_t)c,
+        .length    = 1,
+        .grapheme  = GP_GB_OTHER,
+        .word      = digit ? GP_WB_NUMERIC : GP_WB_ALETTER,
+        .line      = digit ? GP_LB_NU      : GP_LB_AL };
+}
+
+static size_t gp_s_next_grapheme(const char* str, size_t length, size_t start)
+{
+    GPBreakProperty prev = gp_s_break_property(str, length, start);
+    size_t i = start + prev.length;
+    bool   emoji     = prev.flags & GP_BREAK_EXTENDED_PICTOGRAPHIC; // ExtPict Extend*
+    bool   emoji_zwj = false;                                        // ExtPict Extend* ZWJ
+    bool   consonant = prev.flags & GP_BREAK_INCB_CONSONANT; // Consonant [Extend Linker]*
+    bool   conjunct  = false;                                // and at least one Linker
+    size_t ris       = prev.grapheme == GP_GB_REGIONAL_INDICATOR;
+
+    while (i < length)
+    {
+        if (prev.codepoint < 0x80 && (uint8_t)str[i] < 0x80) // GB3, GB999
+            return prev.codepoint == '\r' && str[i] == '\n' ? i + 1 : i;
+
+        const GPBreakProperty next = gp_s_break_property(str, length, i);
+        const uint8_t p = prev.grapheme;
+        const uint8_t n = next.grapheme;
+        bool join;
+        if (p == GP_GB_CR && n == GP_GB_LF)
+            join = true;
+        else if (p == GP_GB_CONTROL || p == GP_GB_CR || p == GP_GB_LF ||
+                 n == GP_GB_CONTROL || n == GP_GB_CR || n == GP_GB_LF)
+            join = false;
+        else if (p == GP_GB_L && (n == GP_GB_L || n == GP_GB_V || n == GP_GB_LV || n == GP_GB_LVT))
+            join = true;
+        else if ((p == GP_GB_LV || p == GP_GB_V) && (n == GP_GB_V || n == GP_GB_T))
+            join = true;
+        else if ((p == GP_GB_LVT || p == GP_GB_T) && n == GP_GB_T)
+            join = true;
+        else if (n == GP_GB_EXTEND || n == GP_GB_ZWJ || n == GP_GB_SPACING_MARK || p == GP_GB_PREPEND)
+            join = true;
+        else if (conjunct && (next.flags & GP_BREAK_INCB_CONSONANT)) // GB9c
+            join = true;
+        else if (emoji_zwj && (next.flags & GP_BREAK_EXTENDED_PICTOGRAPHIC))
+            join = true;
+        else
+            join = p == GP_GB_REGIONAL_INDICATOR && n == GP_GB_REGIONAL_INDICATOR && ris % 2 == 1;
+
+        if ( ! join)
+            return i;
+        const bool incb_extend = next.flags & (GP_BREAK_INCB_EXTEND | GP_BREAK_INCB_LINKER);
+        conjunct  = consonant && incb_extend && (conjunct || (next.flags & GP_BREAK_INCB_LINKER));
+        consonant = (next.flags & GP_BREAK_INCB_CONSONANT) || (consonant && incb_extend);
+        emoji_zwj = emoji && n == GP_GB_ZWJ;
+        emoji     = (next.flags & GP_BREAK_EXTENDED_PICTOGRAPHIC) || (emoji && n == GP_GB_EXTEND);
+        ris       = n == GP_GB_REGIONAL_INDICATOR ? ris + 1 : 0;
+        prev      = next;
+        i        += next.length;
+    }
+    return i;
+}
+
+static bool gp_s_wb_is_ignorable(uint8_t wb) // WB4
+{
+    return wb == GP_WB_EXTEND || wb == GP_WB_FORMAT || wb == GP_WB_ZWJ;
+}
+
+static bool gp_s_wb_is_ahletter(uint8_t wb)
+{
+    return wb == GP_WB_ALETTER || wb == GP_WB_HEBREW_LETTER;
+}
+
+static bool gp_s_wb_is_mid_num_let_q(uint8_t wb)
+{
+    return wb == GP_WB_MID_NUM_LET || wb == GP_WB_SINGLE_QUOTE;
+}
+
+// Next word break property skipping ignorables.
+static uint8_t gp_s_wb_lookahead(const char* str, size_t length, size_t i)
+{
+    while (i < length) {
+        const GPBreakProperty p = gp_s_break_property(str, length, i);
+        if ( ! gp_s_wb_is_ignorable(p.word))
+            return p.word;
+        i += p.length;
+    }
+    return GP_WB_OTHER;
+}
+
+static size_t gp_s_next_word(const char* str, size_t length, size_t start)
+{
+    GPBreakProperty raw = gp_s_break_property(str, length, start);
+    size_t  i     = start + raw.length;
+    uint8_t prev  = raw.word;    // ignoring WB4 ignorables
+    uint8_t prev2 = GP_WB_OTHER; // the one before prev
+    size_t  ris   = prev == GP_WB_REGIONAL_INDICATOR;
+
+    while (i < length)
+    {
+        if (raw.codepoint < 0x80 && gp_s_is_ascii_alnum(raw.codepoint) && gp_s_is_ascii_alnum(str[i])) {
+            // WB5, WB8, WB9, WB10, skip the whole run
+            while (i + 1 < length && gp_s_is_ascii_alnum(str[i + 1]))
+                ++i;
+            raw   = gp_s_ascii_alnum_break_property(str[i]);
+            ris   = 0;
+            prev2 = gp_s_ascii_alnum_break_property(str[i - 1]).word;
+            prev  = raw.word;
+            i    += 1;
+            continue;
         }
+        const GPBreakProperty next = gp_s_break_property(str, length, i);
+        const uint8_t r = raw.word;
+        const uint8_t n = next.word;
+        bool join;
+        if (r == GP_WB_CR && n == GP_WB_LF)
+            join = true;
+        else if (r == GP_WB_NEWLINE || r == GP_WB_CR || r == GP_WB_LF ||
+                 n == GP_WB_NEWLINE || n == GP_WB_CR || n == GP_WB_LF)
+            join = false;
+        else if (r == GP_WB_ZWJ && (next.flags & GP_BREAK_EXTENDED_PICTOGRAPHIC))
+            join = true;
+        else if (r == GP_WB_WSEG_SPACE && n == GP_WB_WSEG_SPACE)
+            join = true;
+        else if (gp_s_wb_is_ignorable(n))
+            join = true;
+        else if (gp_s_wb_is_ahletter(prev) && gp_s_wb_is_ahletter(n))
+            join = true;
+        else if (gp_s_wb_is_ahletter(prev) && (n == GP_WB_MID_LETTER || gp_s_wb_is_mid_num_let_q(n)) &&
+            gp_s_wb_is_ahletter(gp_s_wb_lookahead(str, length, i + next.length)))
+            join = true;
+        else if (gp_s_wb_is_ahletter(prev2) && (prev == GP_WB_MID_LETTER || gp_s_wb_is_mid_num_let_q(prev)) &&
+            gp_s_wb_is_ahletter(n))
+            join = true;
+        else if (prev == GP_WB_HEBREW_LETTER && n == GP_WB_SINGLE_QUOTE)
+            join = true;
+        else if (prev == GP_WB_HEBREW_LETTER && n == GP_WB_DOUBLE_QUOTE &&
+            gp_s_wb_lookahead(str, length, i + next.length) == GP_WB_HEBREW_LETTER)
+            join = true;
+        else if (prev2 == GP_WB_HEBREW_LETTER && prev == GP_WB_DOUBLE_QUOTE && n == GP_WB_HEBREW_LETTER)
+            join = true;
+        else if ((prev == GP_WB_NUMERIC || gp_s_wb_is_ahletter(prev)) && n == GP_WB_NUMERIC)
+            join = true;
+        else if (prev == GP_WB_NUMERIC && gp_s_wb_is_ahletter(n))
+            join = true;
+        else if (prev2 == GP_WB_NUMERIC && (prev == GP_WB_MID_NUM || gp_s_wb_is_mid_num_let_q(prev)) &&
+            n == GP_WB_NUMERIC)
+            join = true;
+        else if (prev == GP_WB_NUMERIC && (n == GP_WB_MID_NUM || gp_s_wb_is_mid_num_let_q(n)) &&
+            gp_s_wb_lookahead(str, length, i + next.length) == GP_WB_NUMERIC)
+            join = true;
+        else if (prev == GP_WB_KATAKANA && n == GP_WB_KATAKANA)
+            join = true;
+        else if ((gp_s_wb_is_ahletter(prev) || prev == GP_WB_NUMERIC || prev == GP_WB_KATAKANA ||
+            prev == GP_WB_EXTEND_NUM_LET) && n == GP_WB_EXTEND_NUM_LET)
+            join = true;
+        else if (prev == GP_WB_EXTEND_NUM_LET &&
+            (gp_s_wb_is_ahletter(n) || n == GP_WB_NUMERIC || n == GP_WB_KATAKANA))
+            join = true;
         else
-        {
-            (*u8)[((GPStringHeader*)*u8 - 1)->length++].c = u16[i];
+            join = prev == GP_WB_REGIONAL_INDICATOR && n == GP_WB_REGIONAL_INDICATOR && ris % 2 == 1;
+
+        if ( ! join)
+            return i;
+        if ( ! gp_s_wb_is_ignorable(n)) {
+            ris   = n == GP_WB_REGIONAL_INDICATOR ? ris + 1 : 0;
+            prev2 = prev;
+            prev  = n;
         }
+        raw = next;
+        i  += next.length;
     }
-    return trunced;
+    return i;
 }
 
-size_t gp_utf8_to_wcs(
-    GPArray(wchar_t)* wcs,
-    const void*       utf8,
-    size_t            utf8_length)
+typedef struct gp_line_break_state
 {
-    size_t trunced;
-    if (WCHAR_MAX > UINT16_MAX)
-        trunced = gp_utf32_from_utf8((GPArray(uint32_t)*)wcs, utf8, utf8_length);
-    else
-        trunced = gp_utf16_from_utf8((GPArray(uint16_t)*)wcs, utf8, utf8_length);
-    trunced += gp_arr_reserve(sizeof(*wcs)[0], wcs, gp_arr_length(*wcs) + sizeof"");
-    if (gp_arrt_length(wchar_t, *wcs) == 0)
-        return trunced;
-    if (gp_arrt_length(wchar_t, *wcs) == gp_arrt_capacity(wchar_t, *wcs)) {
-        gp_arrt_set(wchar_t, *wcs)->length--;
-        ++trunced;
+    uint8_t prev;          // after LB9 and LB10
+    uint8_t prev2;         // the one before prev
+    uint8_t before_sp;     // prev skipping spaces
+    uint8_t prev_flags;
+    uint8_t prev2_flags;
+    bool    prev_zwj;      // not affected by LB9
+    bool    prev_hyphen;   // HY or U+2010
+    bool    prev_aksara;   // AK, AS, or U+25CC
+    bool    prev2_aksara;
+    bool    quote_start;   // before_sp is [\p{Pi}&QU] in the context of LB15a
+    bool    hyphen_start;  // prev is a hyphen in the context of LB20a
+    bool    number;        // NU (SY | IS)*
+    bool    number_closed; // NU (SY | IS)* (CL | CP)
+    size_t  ris;
+} GPLineBreakState;
+
+static bool gp_s_lb_is_alphabetic(uint8_t lb)
+{
+    return lb == GP_LB_AL || lb == GP_LB_HL;
+}
+
+static bool gp_s_lb_is_hangul(uint8_t lb)
+{
+    return lb == GP_LB_JL || lb == GP_LB_JV || lb == GP_LB_JT || lb == GP_LB_H2 || lb == GP_LB_H3;
+}
+
+static bool gp_s_lb_is_aksara(const GPBreakProperty p) // LB28a
+{
+    return p.line == GP_LB_AK || p.line == GP_LB_AS || p.codepoint == 0x25CC;
+}
+
+// Classes that can precede an initial quote in LB15a. sot is handled by caller.
+static bool gp_s_lb_is_quote_context(uint8_t lb)
+{
+    return lb == GP_LB_BK || lb == GP_LB_CR || lb == GP_LB_LF || lb == GP_LB_NL || lb == GP_LB_OP ||
+        lb == GP_LB_QU || lb == GP_LB_GL || lb == GP_LB_SP || lb == GP_LB_ZW;
+}
+
+// Classes that can precede a word-initial hyphen in LB20a. sot is handled by
+// caller.
+static bool gp_s_lb_is_hyphen_context(uint8_t lb)
+{
+    return lb == GP_LB_BK || lb == GP_LB_CR || lb == GP_LB_LF || lb == GP_LB_NL || lb == GP_LB_SP ||
+        lb == GP_LB_ZW || lb == GP_LB_CB || lb == GP_LB_GL;
+}
+
+// Break property at i skipping CM and ZWJ, which LB9 would absorb to the
+// codepoint before i. Length is 0 and line break class is 0xFF at the end of
+// input.
+static GPBreakProperty gp_s_lb_lookahead(const char* str, size_t length, size_t i)
+{
+    while (i < length) {
+        const GPBreakProperty p = gp_s_break_property(str, length, i);
+        if (p.line != GP_LB_CM && p.line != GP_LB_ZWJ)
+            return p;
+        i += p.length;
     }
-    (*wcs)[gp_arrt_length(wchar_t, *wcs)] = L'\0';
-    return trunced;
+    return (GPBreakProperty){ .length = 0, .line = 0xFF };
 }
 
-static void gp_s_utf8_to_wcs_very_unsafe(
-    GPArray(wchar_t)* wcs,
-    const void*       utf8,
-    size_t            utf8_length)
+// LB25: NU (SY | IS)* (CL | CP)? × (PO | PR), (PO | PR) × OP IS? NU,
+// (PO | PR | HY | IS) × NU, and NU (SY | IS)* × NU.
+static bool gp_s_lb25(const GPLineBreakState* s, uint8_t n, const char* str, size_t length, size_t lookahead)
 {
-    if (WCHAR_MAX > UINT16_MAX)
-        gp_s_utf8_to_utf32_very_unsafe((GPArray(uint32_t)*)wcs, utf8, utf8_length);
-    else
-        gp_s_utf8_to_utf16_very_unsafe((GPArray(uint16_t)*)wcs, utf8, utf8_length);
-    (*wcs)[gp_arr_length(*wcs)] = L'\0';
+    const uint8_t p = s->prev;
+    if ((s->number || s->number_closed) && (n == GP_LB_PO || n == GP_LB_PR))
+        return true;
+    if ((p == GP_LB_PO || p == GP_LB_PR) && n == GP_LB_OP) {
+        GPBreakProperty next = gp_s_lb_lookahead(str, length, lookahead);
+        if (next.line == GP_LB_IS)
+            next = gp_s_lb_lookahead(str, length, lookahead + next.length);
+        return next.line == GP_LB_NU;
+    }
+    if ((p == GP_LB_PO || p == GP_LB_PR || p == GP_LB_HY || p == GP_LB_IS) && n == GP_LB_NU)
+        return true;
+    return s->number && n == GP_LB_NU;
 }
 
-size_t gp_wcs_to_utf8(
-    GPString*       utf8,
-    const wchar_t*  wcs,
-    size_t          wcs_length)
+// Returns true if line can be broken between state and next. LB9 may change
+// next to be absorbed in state, LB10 may change it to AL.
+static bool gp_s_line_break(
+    const GPLineBreakState* s,
+    uint8_t*                next_line,
+    const GPBreakProperty   next,
+    const char*             str,
+    size_t                  length,
+    size_t                  lookahead,
+    bool*                   mandatory)
+{
+    const uint8_t p = s->prev;
+    uint8_t       n = *next_line;
+
+    if (p == GP_LB_BK || p == GP_LB_LF || p == GP_LB_NL || (p == GP_LB_CR && n != GP_LB_LF)) // LB4, LB5
+        return *mandatory = true;
+    if (p == GP_LB_CR || n == GP_LB_BK || n == GP_LB_CR || n == GP_LB_LF || n == GP_LB_NL) // LB5, LB6
+        return false;
+    if (n == GP_LB_SP || n == GP_LB_ZW) // LB7
+        return false;
+    if (s->before_sp == GP_LB_ZW) // LB8
+        return true;
+    const bool absorb = (n == GP_LB_CM || n == GP_LB_ZWJ) && p != GP_LB_SP; // LB9
+    if (absorb)
+        *next_line = 0xFF;
+    else if (n == GP_LB_CM || n == GP_LB_ZWJ) // LB10
+        *next_line = n = GP_LB_AL;
+    if (s->prev_zwj || absorb) // LB8a, LB9
+        return false;
+
+    const bool east_asian      = next.flags & GP_BREAK_EAST_ASIAN_WIDE;
+    const bool prev_east_asian = s->prev_flags & GP_BREAK_EAST_ASIAN_WIDE;
+    if (n == GP_LB_WJ || p == GP_LB_WJ) // LB11
+        return false;
+    if (p == GP_LB_GL) // LB12
+        return false;
+    if (n == GP_LB_GL && p != GP_LB_SP && p != GP_LB_BA && p != GP_LB_HY) // LB12a
+        return false;
+    if (n == GP_LB_CL || n == GP_LB_CP || n == GP_LB_EX || n == GP_LB_SY) // LB13
+        return false;
+    if (s->before_sp == GP_LB_OP) // LB14
+        return false;
+    if (s->quote_start) // LB15a
+        return false;
+    if (n == GP_LB_QU && (next.flags & GP_BREAK_QUOTE_FINAL)) { // LB15b
+        const GPBreakProperty after = gp_s_lb_lookahead(str, length, lookahead);
+        const uint8_t a = after.line;
+        if (after.length == 0 || a == GP_LB_SP || a == GP_LB_GL || a == GP_LB_WJ || a == GP_LB_CL ||
+            a == GP_LB_QU || a == GP_LB_CP || a == GP_LB_EX || a == GP_LB_IS || a == GP_LB_SY ||
+            a == GP_LB_BK || a == GP_LB_CR || a == GP_LB_LF || a == GP_LB_NL || a == GP_LB_ZW)
+            return false;
+    }
+    if (p == GP_LB_SP && n == GP_LB_IS && gp_s_lb_lookahead(str, length, lookahead).line == GP_LB_NU) // LB15c
+        return true;
+    if (n == GP_LB_IS) // LB15d
+        return false;
+    if ((s->before_sp == GP_LB_CL || s->before_sp == GP_LB_CP) && n == GP_LB_NS) // LB16
+        return false;
+    if (s->before_sp == GP_LB_B2 && n == GP_LB_B2) // LB17
+        return false;
+    if (p == GP_LB_SP) // LB18
+        return true;
+    if ((n == GP_LB_QU && !(next.flags & GP_BREAK_QUOTE_INITIAL)) || // LB19
+        (p == GP_LB_QU && !(s->prev_flags & GP_BREAK_QUOTE_FINAL)))
+        return false;
+    if (n == GP_LB_QU) { // LB19a
+        const GPBreakProperty after = gp_s_lb_lookahead(str, length, lookahead);
+        if ( ! prev_east_asian || after.length == 0 || !(after.flags & GP_BREAK_EAST_ASIAN_WIDE))
+            return false;
+    }
+    if (p == GP_LB_QU && ( ! east_asian || !(s->prev2_flags & GP_BREAK_EAST_ASIAN_WIDE))) // LB19a
+        return false;
+    if (n == GP_LB_CB || p == GP_LB_CB) // LB20
+        return true;
+    if (s->hyphen_start && n == GP_LB_AL) // LB20a
+        return false;
+    if (n == GP_LB_BA || n == GP_LB_HY || n == GP_LB_NS || p == GP_LB_BB) // LB21
+        return false;
+    if (s->prev2 == GP_LB_HL && n != GP_LB_HL && // LB21a
+        (p == GP_LB_HY || (p == GP_LB_BA && ! prev_east_asian)))
+        return false;
+    if (p == GP_LB_SY && n == GP_LB_HL) // LB21b
+        return false;
+    if (n == GP_LB_IN) // LB22
+        return false;
+    if ((gp_s_lb_is_alphabetic(p) && n == GP_LB_NU) || (p == GP_LB_NU && gp_s_lb_is_alphabetic(n))) // LB23
+        return false;
+    if ((p == GP_LB_PR && (n == GP_LB_ID || n == GP_LB_EB || n == GP_LB_EM)) || // LB23a
+        ((p == GP_LB_ID || p == GP_LB_EB || p == GP_LB_EM) && n == GP_LB_PO))
+        return false;
+    if (((p == GP_LB_PR || p == GP_LB_PO) && gp_s_lb_is_alphabetic(n)) || // LB24
+        (gp_s_lb_is_alphabetic(p) && (n == GP_LB_PR || n == GP_LB_PO)))
+        return false;
+    if (gp_s_lb25(s, n, str, length, lookahead))
+        return false;
+    if ((p == GP_LB_JL && (n == GP_LB_JL || n == GP_LB_JV || n == GP_LB_H2 || n == GP_LB_H3)) || // LB26
+        ((p == GP_LB_JV || p == GP_LB_H2) && (n == GP_LB_JV || n == GP_LB_JT)) ||
+        ((p == GP_LB_JT || p == GP_LB_H3) && n == GP_LB_JT))
+        return false;
+    if ((gp_s_lb_is_hangul(p) && n == GP_LB_PO) || (p == GP_LB_PR && gp_s_lb_is_hangul(n))) // LB27
+        return false;
+    if (gp_s_lb_is_alphabetic(p) && gp_s_lb_is_alphabetic(n)) // LB28
+        return false;
+    const bool aksara = gp_s_lb_is_aksara(next);
+    if ((p == GP_LB_AP && aksara) || // LB28a
+        (s->prev_aksara && (n == GP_LB_VF || n == GP_LB_VI)) ||
+        (s->prev2_aksara && p == GP_LB_VI && (n == GP_LB_AK || next.codepoint == 0x25CC)) ||
+        (s->prev_aksara && aksara && gp_s_lb_lookahead(str, length, lookahead).line == GP_LB_VF))
+        return false;
+    if (p == GP_LB_IS && gp_s_lb_is_alphabetic(n)) // LB29
+        return false;
+    if (((gp_s_lb_is_alphabetic(p) || p == GP_LB_NU) && n == GP_LB_OP && ! east_asian) || // LB30
+        (p == GP_LB_CP && ! prev_east_asian && (gp_s_lb_is_alphabetic(n) || n == GP_LB_NU)))
+        return false;
+    if (p == GP_LB_RI && n == GP_LB_RI && s->ris % 2 == 1) // LB30a
+        return false;
+    if (n == GP_LB_EM && (p == GP_LB_EB || // LB30b
+        (s->prev_flags & (GP_BREAK_EXTENDED_PICTOGRAPHIC | GP_BREAK_UNASSIGNED))
+            == (GP_BREAK_EXTENDED_PICTOGRAPHIC | GP_BREAK_UNASSIGNED)))
+        return false;
+    return true; // LB31
+}
 
+static size_t gp_s_next_line_break(const char* str, size_t length, size_t start, bool* mandatory)
 {
-    if (WCHAR_MAX > UINT16_MAX)
-        return gp_utf8_from_utf32(utf8, (uint32_t*)wcs, wcs_length);
-    else
-        return gp_utf8_from_utf16(utf8, (uint16_t*)wcs, wcs_length);
+    const GPBreakProperty first = gp_s_break_property(str, length, start);
+    GPLineBreakState s = {
+        .prev         = first.line == GP_LB_CM || first.line == GP_LB_ZWJ ? GP_LB_AL : first.line, // LB10
+        .prev2        = GP_LB_AL,
+        .prev_flags   = first.flags,
+        .prev_zwj     = first.line == GP_LB_ZWJ,
+        .prev_hyphen  = first.line == GP_LB_HY || first.codepoint == 0x2010,
+        .prev_aksara  = gp_s_lb_is_aksara(first),
+        .number       = first.line == GP_LB_NU,
+        .ris          = first.line == GP_LB_RI };
+    // Start is like sot in LB15a and LB20a. Lines can only be broken before
+    // hyphens after their context and before initial quotes after their
+    // context or when followed by East Asian characters, which LB19 keeps
+    // together with the quote anyway.
+    s.before_sp    = s.prev;
+    s.quote_start  = first.line == GP_LB_QU && (first.flags & GP_BREAK_QUOTE_INITIAL);
+    s.hyphen_start = s.prev_hyphen;
+    size_t i = start + first.length;
+    *mandatory = false;
+
+    while (i < length)
+    {
+        if ((s.prev == GP_LB_AL || s.prev == GP_LB_NU) && gp_s_is_ascii_alnum(str[i]) &&
+            gp_s_is_ascii_alnum(str[i - 1])) { // LB23, LB25, LB28
+            s.prev2 = s.prev;
+            s.prev  = s.before_sp = '0' <= str[i] && str[i] <= '9' ? GP_LB_NU : GP_LB_AL;
+            s.prev2_flags   = s.prev_flags;
+            s.prev_flags    = 0;
+            s.prev_zwj      = false;
+            s.prev_hyphen   = false;
+            s.prev2_aksara  = s.prev_aksara;
+            s.prev_aksara   = false;
+            s.quote_start   = false;
+            s.hyphen_start  = false;
+            s.number        = s.prev == GP_LB_NU;
+            s.number_closed = false;
+            s.ris           = 0;
+            i += 1;
+            continue;
+        }
+        const GPBreakProperty next = gp_s_break_property(str, length, i);
+        uint8_t n = next.line;
+        if (gp_s_line_break(&s, &n, next, str, length, i + next.length, mandatory))
+            return i;
+        s.prev_zwj = next.line == GP_LB_ZWJ;
+        if (n != 0xFF) { // not absorbed by LB9
+            const bool hyphen = n == GP_LB_HY || next.codepoint == 0x2010;
+            s.hyphen_start  = hyphen && gp_s_lb_is_hyphen_context(s.prev);
+            if (n != GP_LB_SP)
+                s.quote_start = n == GP_LB_QU && (next.flags & GP_BREAK_QUOTE_INITIAL) &&
+                    gp_s_lb_is_quote_context(s.prev);
+            s.number_closed = s.number && (n == GP_LB_CL || n == GP_LB_CP);
+            s.number        = n == GP_LB_NU || (s.number && (n == GP_LB_SY || n == GP_LB_IS));
+            s.ris           = n == GP_LB_RI ? s.ris + 1 : 0;
+            s.prev2        = s.prev;
+            s.prev2_flags  = s.prev_flags;
+            s.prev2_aksara = s.prev_aksara;
+            s.prev         = n;
+            s.prev_flags   = next.flags;
+            s.prev_hyphen  = hyphen;
+            s.prev_aksara  = gp_s_lb_is_aksara(next);
+            if (n != GP_LB_SP)
+                s.before_sp = n;
+        }
+        i += next.length;
+    }
+    *mandatory = true; // LB3
+    return i;
 }
 
-uint32_t gp_u32_to_upper(uint32_t);
-uint32_t gp_u32_to_lower(uint32_t);
-uint32_t gp_u32_to_title(uint32_t);
+static GPSegmentIterator gp_s_segment_iterator(const void* str, size_t str_length, int type)
+{
+    return (GPSegmentIterator){ .str = str, .length = str_length, .type = type };
+}
+
+GPSegmentIterator gp_grapheme_iterator(const void* str, const size_t str_length)
+{
+    return gp_s_segment_iterator(str, str_length, GP_SEGMENT_GRAPHEME);
+}
+
+GPSegmentIterator gp_word_iterator(const void* str, const size_t str_length)
+{
+    return gp_s_segment_iterator(str, str_length, GP_SEGMENT_WORD);
+}
+
+GPSegmentIterator gp_line_break_iterator(const void* str, const size_t str_length)
+{
+    return gp_s_segment_iterator(str, str_length, GP_SEGMENT_LINE);
+}
+
+bool gp_segment_next(GPSegmentIterator* it)
+{
+    if (it->position >= it->length) {
+        it->segment_length = 0;
+        return false;
+    }
+    size_t end;
+    switch (it->type) {
+        case GP_SEGMENT_GRAPHEME: end = gp_s_next_grapheme(it->str, it->length, it->position); break;
+        case GP_SEGMENT_WORD:     end = gp_s_next_word(it->str, it->length, it->position);     break;
+        default: end = gp_s_next_line_break(it->str, it->length, it->position, &it->mandatory);
+    }
+    it->segment        = it->str + it->position;
+    it->segment_length = end - it->position;
+    it->position       = end;
+    return true;
+}
 
 // ----------------------------------------------------------------------------
-// String extensions
+// Normalization
+//
+// Canonical combining classes, quick check properties, and full decompositions
+// are looked up from a three-level table generated by tools/normtablegen.c, see
+// src/norm_table.h. Decompositions are stored in UTF-8 in canonical order, so
+// only marks following them need to be reordered. Text is quick checked first
+// and only the tail starting from the last starter before the first codepoint
+// that fails the check is normalized. Bytes smaller than the smallest leading
+// byte of a codepoint that can fail the check are skipped in blocks.
+
+#define GP_HANGUL_S_BASE  0xAC00
+#define GP_HANGUL_L_BASE  0x1100
+#define GP_HANGUL_V_BASE  0x1161
+#define GP_HANGUL_T_BASE  0x11A7
+#define GP_HANGUL_L_COUNT 19
+#define GP_HANGUL_V_COUNT 21
+#define GP_HANGUL_T_COUNT 28
+#define GP_HANGUL_N_COUNT (GP_HANGUL_V_COUNT * GP_HANGUL_T_COUNT)
+#define GP_HANGUL_S_COUNT (GP_HANGUL_L_COUNT * GP_HANGUL_N_COUNT)
+
+static const uint8_t gp_s_norm_min_lead_bytes[] = {
+    [GP_NFC]  = GP_NORM_NFC_MIN_LEAD_BYTE,  [GP_NFD]  = GP_NORM_NFD_MIN_LEAD_BYTE,
+    [GP_NFKC] = GP_NORM_NFKC_MIN_LEAD_BYTE, [GP_NFKD] = GP_NORM_NFKD_MIN_LEAD_BYTE };
+static const uint8_t gp_s_norm_no_flags[] = {
+    [GP_NFC]  = GP_NORM_NFC_NO,  [GP_NFD]  = GP_NORM_NFD_NO,
+    [GP_NFKC] = GP_NORM_NFKC_NO, [GP_NFKD] = GP_NORM_NFKD_NO };
+static const uint8_t gp_s_norm_maybe_flags[] = {
+    [GP_NFC]  = GP_NORM_NFC_MAYBE,  [GP_NFD]  = 0,
+    [GP_NFKC] = GP_NORM_NFKC_MAYBE, [GP_NFKD] = 0 };
+
+static const struct gp_norm_record* gp_s_norm_record(uint32_t c)
+{
+    if (c >= GP_NORM_TABLE_LIMIT)
+        return &gp_norm_records[0];
+    const size_t i1 = (size_t)gp_norm_stage0[c >> (GP_NORM_STAGE1_SHIFT + GP_NORM_STAGE2_SHIFT)]
+        << GP_NORM_STAGE1_SHIFT | (c >> GP_NORM_STAGE2_SHIFT & GP_NORM_STAGE1_MASK);
+    return &gp_norm_records[
+        (size_t)gp_norm_stage2[(size_t)gp_norm_stage1[i1] << GP_NORM_STAGE2_SHIFT | (c & GP_NORM_STAGE2_MASK)]];
+}
 
-static size_t gp_s_utf8_find_first_of(
-    const void*const haystack,
-    const size_t     haystack_length,
-    const char*const char_set,
-    const size_t     start)
+#if GP_UTF_X86
+GP_TARGET_SSE2 static size_t gp_s_bytes_below_sse2(const uint8_t* s, size_t n, uint8_t limit)
 {
-    #ifndef NDEBUG
-    gp_assert(gp_utf8_is_valid(char_set, strlen(char_set), NULL));
+    const __m128i min = _mm_set1_epi8((char)limit);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(s + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(v, min), v)) != 0)
+            break;
+    }
+    return i;
+}
+
+GP_TARGET_AVX2 static size_t gp_s_bytes_below_avx2(const uint8_t* s, size_t n, uint8_t limit)
+{
+    const __m256i min = _mm256_set1_epi8((char)limit);
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        const __m256i v = _mm256_loadu_si256((const __m256i*)(s + i));
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(v, min), v)) != 0)
+            break;
+    }
+    return i;
+}
+#endif // GP_UTF_X86
+
+// Number of bytes smaller than limit, which must be at least 0x80.
+static size_t gp_s_bytes_below(const uint8_t* s, size_t n, uint8_t limit, int simd)
+{
+    size_t i = 0;
+    #if GP_UTF_X86
+    if (simd == GP_SIMD_AVX2)
+        i = gp_s_bytes_below_avx2(s, n, limit);
+    else if (simd == GP_SIMD_SSE2)
+        i = gp_s_bytes_below_sse2(s, n, limit);
+    #else
+    (void)simd;
     #endif
-    for (size_t cplen, i = start; i < haystack_length; i += cplen) {
-        if ( ! gp_utf8_is_valid_codepoint(haystack, haystack_length, i, &cplen))
+    // Bytes with the high bit set overflow to the high bit if the rest of the
+    // bits are at least limit - 0x80.
+    const uint64_t add = 0x0101010101010101 * (uint64_t)(0x100 - limit);
+    for (uint64_t x; i + sizeof x <= n; i += sizeof x) {
+        memcpy(&x, s + i, sizeof x);
+        if (((x & 0x7F7F7F7F7F7F7F7F) + add) & x & 0x8080808080808080)
+            break;
+    }
+    while (i < n && s[i] < limit)
+        ++i;
+    return i;
+}
+
+// Returns the index of the first codepoint starting from i that fails the
+// quick check or violates canonical ordering or utf8_length if none. Stores the
+// index of the last starter that passes the check to safe.
+static size_t gp_s_norm_quick_check(
+    const uint8_t* utf8,
+    size_t         utf8_length,
+    size_t         i,
+    GPNormalForm   form,
+    uint8_t*       last_ccc,
+    size_t*        safe)
+{
+    const uint8_t min_lead_byte = gp_s_norm_min_lead_bytes[form];
+    const uint8_t fail_flags    = gp_s_norm_no_flags[form] | gp_s_norm_maybe_flags[form];
+    const int     simd          = gp_s_simd_level();
+    while (i < utf8_length)
+    {
+        if (utf8[i] < min_lead_byte) {
+            const size_t start = i;
+            i += gp_s_bytes_below(utf8 + i, utf8_length - i, min_lead_byte, simd);
+            *last_ccc = 0;
+            *safe = i - 1;
+            while (*safe > start && (utf8[*safe] & 0xC0) == 0x80)
+                --*safe;
             continue;
-        if (strstr(char_set, memcpy((char[8]){""}, (char*)haystack + i, cplen)) != NULL)
+        }
+        uint32_t c;
+        bool is_valid;
+        const size_t codepoint_length = gp_utf8_decode(&c, utf8, utf8_length, i, &is_valid);
+        const struct gp_norm_record* record = is_valid ? gp_s_norm_record(c) : &gp_norm_records[0];
+        if ((record->ccc != 0 && *last_ccc > record->ccc) || (record->flags & fail_flags))
             return i;
+        if (record->ccc == 0)
+            *safe = i;
+        *last_ccc = record->ccc;
+        i += codepoint_length;
     }
-    return GP_NOT_FOUND;
+    return utf8_length;
 }
 
-static size_t gp_s_utf8_find_first_not_of(
-    const void*const haystack,
-    const size_t     haystack_length,
-    const char*const char_set,
-    const size_t     start)
+GPNormalizationCheck gp_utf8_normalization_quick_check(
+    const void*const utf8,
+    const size_t utf8_length,
+    const GPNormalForm form)
 {
-    #ifndef NDEBUG
-    gp_assert(gp_utf8_is_valid(char_set, strlen(char_set), NULL));
-    #endif
-    for (size_t cplen, i = start; i < haystack_length; i += cplen) {
-        if ( ! gp_utf8_is_valid_codepoint(
-            haystack, haystack_length, i, &cplen))
-            return i;
-        if (strstr(char_set, memcpy((char[8]){""}, (char*)haystack + i, cplen)) == NULL)
-            return i;
+    GPNormalizationCheck result = GP_NORMALIZED_YES;
+    uint8_t last_ccc = 0;
+    size_t safe = 0;
+    size_t i = 0;
+    while ((i = gp_s_norm_quick_check(utf8, utf8_length, i, form, &last_ccc, &safe)) < utf8_length)
+    {
+        uint32_t c;
+        const size_t codepoint_length = gp_utf8_decode(&c, utf8, utf8_length, i, &(bool){0});
+        const struct gp_norm_record* record = gp_s_norm_record(c);
+        if ((record->ccc != 0 && last_ccc > record->ccc) || (record->flags & gp_s_norm_no_flags[form]))
+            return GP_NORMALIZED_NO;
+        result = GP_NORMALIZED_MAYBE;
+        last_ccc = record->ccc;
+        i += codepoint_length;
     }
-    return GP_NOT_FOUND;
+    return result;
 }
 
-GPArray(GPString) gp_str_split(
-    GPAllocator* allocator,
-    const void*const str,
-    const size_t str_length,
-    const char*const separators)
+bool gp_utf8_is_normalized(
+    const void*const utf8,
+    const size_t utf8_length,
+    const GPNormalForm form)
 {
-    GPArray(GPString) substrs = NULL;
-    size_t j, i = gp_s_utf8_find_first_not_of(str, str_length, separators, 0);
-    if (i == GP_NOT_FOUND)
-        return gp_arr_new(sizeof(GPString), allocator, 1);
+    const GPNormalizationCheck check = gp_utf8_normalization_quick_check(utf8, utf8_length, form);
+    if (check != GP_NORMALIZED_MAYBE)
+        return check == GP_NORMALIZED_YES;
 
-    size_t indices_length = 0;
-    struct start_end_pair {
-        size_t start, end;
-    } indices[256];
+    GPArena* scratch = gp_scratch_arena();
+    GPString normalized = gp_str_new(&scratch->base, utf8_length);
+    gp_utf8_normalize(&normalized, utf8, utf8_length, form);
+    const bool result = gp_bytes_equal(normalized, gp_str_length(normalized), utf8, utf8_length);
+    gp_arena_rewind(scratch, gp_str_allocation(normalized));
+    return result;
+}
 
-    while (i != GP_NOT_FOUND)
+// Buffered codepoints since last starter. Elements are packed as
+// codepoint | combines_backward << 21 | ccc << 24.
+typedef struct gp_norm_buffer
+{
+    uint32_t* data;
+    size_t    length;
+    size_t    capacity;
+    uint32_t  stack[32];
+    bool      compose;
+} GPNormBuffer;
+
+#define GP_NORM_COMBINES_BACKWARD ((uint32_t)1 << 21)
+#define GP_NORM_CODEPOINT(X)      ((X) & 0x1FFFFF)
+#define GP_NORM_CCC(X)            ((X) >> 24)
+
+// Primary composite or 0.
+static uint32_t gp_s_compose(uint32_t first, uint32_t second)
+{
+    if (GP_HANGUL_L_BASE <= first && first < GP_HANGUL_L_BASE + GP_HANGUL_L_COUNT &&
+        GP_HANGUL_V_BASE <= second && second < GP_HANGUL_V_BASE + GP_HANGUL_V_COUNT)
+        return GP_HANGUL_S_BASE
+            + ((first - GP_HANGUL_L_BASE) * GP_HANGUL_V_COUNT + second - GP_HANGUL_V_BASE) * GP_HANGUL_T_COUNT;
+    if (GP_HANGUL_S_BASE <= first && first < GP_HANGUL_S_BASE + GP_HANGUL_S_COUNT &&
+        (first - GP_HANGUL_S_BASE) % GP_HANGUL_T_COUNT == 0 &&
+        GP_HANGUL_T_BASE < second && second < GP_HANGUL_T_BASE + GP_HANGUL_T_COUNT)
+        return first + second - GP_HANGUL_T_BASE;
+
+    size_t low  = 0;
+    size_t high = sizeof gp_norm_compositions / sizeof gp_norm_compositions[0];
+    while (low < high) {
+        const size_t mid = low + (high - low) / 2;
+        const uint32_t* composition = gp_norm_compositions[mid];
+        if (composition[0] < first || (composition[0] == first && composition[1] < second))
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    if (low < sizeof gp_norm_compositions / sizeof gp_norm_compositions[0] &&
+        gp_norm_compositions[low][0] == first && gp_norm_compositions[low][1] == second)
+        return gp_norm_compositions[low][2];
+    return 0;
+}
+
+// Canonical composition of buffer, which starts with a starter unless the text
+// starts with non-starters.
+static void gp_s_norm_buffer_compose(GPNormBuffer* buf)
+{
+    if (buf->length < 2 || GP_NORM_CCC(buf->data[0]) != 0)
+        return;
+    uint32_t starter = GP_NORM_CODEPOINT(buf->data[0]);
+    size_t   length  = 1;
+    uint32_t last_ccc = 0;
+    for (size_t i = 1; i < buf->length; ++i)
     {
-        for (indices_length = 0;
-            indices_length < sizeof indices / sizeof indices[0];
-            ++indices_length)
-        {
-            indices[indices_length].start = i;
-            i = gp_s_utf8_find_first_of(str, str_length, separators, i);
-            if (i == GP_NOT_FOUND) {
-                indices[indices_length++].end = str_length;
-                break;
+        const uint32_t c   = buf->data[i];
+        const uint32_t ccc = GP_NORM_CCC(c);
+        if ((c & GP_NORM_COMBINES_BACKWARD) && (length == 1 || last_ccc < ccc)) {
+            const uint32_t composite = gp_s_compose(starter, GP_NORM_CODEPOINT(c));
+            if (composite != 0) {
+                starter = composite;
+                continue;
             }
-            indices[indices_length].end = i;
-            i = gp_s_utf8_find_first_not_of(str, str_length, separators, i);
-            if (i == GP_NOT_FOUND) {
-                ++indices_length;
-                break;
+        }
+        last_ccc = ccc;
+        buf->data[length++] = c;
+    }
+    buf->data[0] = starter;
+    buf->length  = length;
+}
+
+static size_t gp_s_norm_buffer_flush(GPNormBuffer* buf, GPString* out)
+{
+    if (buf->compose)
+        gp_s_norm_buffer_compose(buf);
+    size_t trunced = 0;
+    uint8_t encoding[64];
+    size_t  encoding_length = 0;
+    for (size_t i = 0; i < buf->length; ++i)
+    {
+        const uint32_t c = GP_NORM_CODEPOINT(buf->data[i]);
+        if (c < 0x80)
+            encoding[encoding_length++] = c;
+        else
+            encoding_length += gp_s_utf8_encode_valid(encoding + encoding_length, c);
+        if (encoding_length > sizeof encoding - 4) {
+            trunced += gp_str_append(out, encoding, encoding_length);
+            encoding_length = 0;
+        }
+    }
+    buf->length = 0;
+    return trunced + gp_str_append(out, encoding, encoding_length);
+}
+
+static size_t gp_s_norm_buffer_push(GPNormBuffer* buf, GPString* out, uint32_t c)
+{
+    const struct gp_norm_record* record = gp_s_norm_record(c);
+    const uint32_t ccc = record->ccc;
+    const uint32_t element = c | (uint32_t)ccc << 24
+        | ((record->flags & GP_NORM_NFC_MAYBE) ? GP_NORM_COMBINES_BACKWARD : 0);
+
+    size_t trunced = 0;
+    if (ccc == 0 && buf->length != 0)
+    {
+        if (buf->compose) {
+            gp_s_norm_buffer_compose(buf);
+            if (buf->length == 1 && GP_NORM_CCC(buf->data[0]) == 0 && (element & GP_NORM_COMBINES_BACKWARD)) {
+                const uint32_t composite = gp_s_compose(GP_NORM_CODEPOINT(buf->data[0]), c);
+                if (composite != 0) {
+                    buf->data[0] = composite;
+                    return 0;
+                }
             }
         }
+        trunced = gp_s_norm_buffer_flush(buf, out);
+    }
 
-        if (substrs == NULL)
-            substrs = gp_arr_new(
-                sizeof(GPString),
-                allocator,
-                i == GP_NOT_FOUND ? indices_length : 2 * indices_length);
-        else
-            gp_arr_reserve(
-                sizeof(GPString),
-                &substrs,
-                i == GP_NOT_FOUND ?
-                    gp_arr_length(substrs) + indices_length
-                  : 3 * gp_arr_length(substrs));
+    if (buf->length == buf->capacity) {
+        uint32_t* data = gp_mem_alloc(gp_global_heap, 2 * buf->capacity * sizeof data[0]);
+        memcpy(data, buf->data, buf->length * sizeof data[0]);
+        if (buf->data != buf->stack)
+            gp_mem_dealloc(gp_global_heap, buf->data);
+        buf->data = data;
+        buf->capacity *= 2;
+    }
+    size_t i = buf->length++;
+    for (; i > 0 && GP_NORM_CCC(buf->data[i - 1]) > ccc; --i) // canonical ordering
+        buf->data[i] = buf->data[i - 1];
+    buf->data[i] = element;
+    return trunced;
+}
 
-        for (j = 0; j < indices_length; ++j)
-        {
-            substrs[gp_arr_length(substrs) + j] = gp_str_new(
-                allocator,
-                gp_next_power_of_2(indices[j].end - indices[j].start));
+static size_t gp_s_norm_decompose(GPNormBuffer* buf, GPString* out, uint32_t c, bool compat)
+{
+    size_t trunced = 0;
+    if (GP_HANGUL_S_BASE <= c && c < GP_HANGUL_S_BASE + GP_HANGUL_S_COUNT) {
+        const uint32_t s = c - GP_HANGUL_S_BASE;
+        trunced += gp_s_norm_buffer_push(buf, out, GP_HANGUL_L_BASE + s / GP_HANGUL_N_COUNT);
+        trunced += gp_s_norm_buffer_push(buf, out, GP_HANGUL_V_BASE + s % GP_HANGUL_N_COUNT / GP_HANGUL_T_COUNT);
+        if (s % GP_HANGUL_T_COUNT != 0)
+            trunced += gp_s_norm_buffer_push(buf, out, GP_HANGUL_T_BASE + s % GP_HANGUL_T_COUNT);
+        return trunced;
+    }
 
-            ((GPStringHeader*)(substrs[gp_arr_length(substrs) + j]) - 1)->length =
-                indices[j].end - indices[j].start;
-            memcpy(
-                substrs[gp_arr_length(substrs) + j],
-                (uint8_t*)str + indices[j].start,
-                gp_str_length(substrs[gp_arr_length(substrs) + j]));
+    // {canonical_length, compat_length, canonical..., compat...}
+    const uint8_t* decomposition = gp_norm_decompositions + gp_s_norm_record(c)->decomposition;
+    size_t decomposition_length = decomposition[0];
+    if (compat && decomposition[1] != 0) {
+        decomposition_length = decomposition[1];
+        decomposition       += decomposition[0];
+    }
+    decomposition += 2;
+    if (decomposition_length == 0)
+        return gp_s_norm_buffer_push(buf, out, c);
+
+    for (size_t i = 0; i < decomposition_length;) {
+        uint32_t d = decomposition[i];
+        i += d < 0x80 ? 1 : gp_s_utf8_decode_valid(&d, decomposition, decomposition_length, i);
+        trunced += gp_s_norm_buffer_push(buf, out, d);
+    }
+    return trunced;
+}
+
+static size_t gp_s_normalize_append(
+    GPString*      out,
+    const uint8_t* utf8,
+    size_t         utf8_length,
+    GPNormalForm   form)
+{
+    GPNormBuffer buf = { .capacity = 32, .compose = form == GP_NFC || form == GP_NFKC };
+    buf.data = buf.stack;
+    const bool    compat        = form == GP_NFKC || form == GP_NFKD;
+    const uint8_t min_lead_byte = gp_s_norm_min_lead_bytes[form];
+    const int     simd          = gp_s_simd_level();
+    size_t trunced = 0;
+
+    for (size_t i = 0; i < utf8_length;)
+    {
+        uint32_t c;
+        bool is_valid;
+        if (utf8[i] < min_lead_byte)
+        { // normalized starters that never combine backward
+            const size_t start = i;
+            i += gp_s_bytes_below(utf8 + i, utf8_length - i, min_lead_byte, simd);
+            trunced += gp_s_norm_buffer_flush(&buf, out);
+            if ( ! buf.compose) {
+                trunced += gp_str_append(out, utf8 + start, i - start);
+                continue;
+            }
+            // The last one might compose with following marks.
+            size_t last = i - 1;
+            while (last > start && (utf8[last] & 0xC0) == 0x80)
+                --last;
+            if (gp_utf8_decode(&c, utf8, utf8_length, last, &is_valid) != i - last || ! is_valid)
+                last = i;
+            trunced += gp_str_append(out, utf8 + start, last - start);
+            if (last != i)
+                trunced += gp_s_norm_decompose(&buf, out, c, compat);
+            continue;
         }
-        ((GPArrayHeader*)substrs - 1)->length += indices_length;
+
+        const size_t codepoint_length = gp_utf8_decode(&c, utf8, utf8_length, i, &is_valid);
+        if ( ! is_valid) { // preserve
+            trunced += gp_s_norm_buffer_flush(&buf, out);
+            trunced += gp_str_append(out, utf8 + i, codepoint_length);
+        } else
+            trunced += gp_s_norm_decompose(&buf, out, c, compat);
+        i += codepoint_length;
     }
-    return substrs;
+    trunced += gp_s_norm_buffer_flush(&buf, out);
+    if (buf.data != buf.stack)
+        gp_mem_dealloc(gp_global_heap, buf.data);
+    return trunced;
 }
 
-void gp_str_join(GPString* out, GPArray(GPString) strs, const char* separator)
+size_t gp_utf8_normalize(
+    GPString*const out,
+    const void*const utf8,
+    const size_t utf8_length,
+    const GPNormalForm form)
 {
-    ((GPStringHeader*)*out - 1)->length = 0;
-    if (gp_arr_length(strs) == 0)
+    uint8_t last_ccc = 0;
+    size_t safe = 0;
+    if (gp_s_norm_quick_check(utf8, utf8_length, 0, form, &last_ccc, &safe) == utf8_length)
+        return gp_str_copy(out, utf8, utf8_length);
+    const size_t trunced = gp_str_copy(out, utf8, safe);
+    return trunced + gp_s_normalize_append(out, (const uint8_t*)utf8 + safe, utf8_length - safe, form);
+}
+
+void gp_str_normalize(GPString* str, const GPNormalForm form)
+{
+    uint8_t last_ccc = 0;
+    size_t safe = 0;
+    if (gp_s_norm_quick_check((uint8_t*)*str, gp_str_length(*str), 0, form, &last_ccc, &safe)
+        == gp_str_length(*str))
         return;
 
-    const size_t separator_length = strlen(separator);
-    size_t required_capacity = -separator_length;
-    for (size_t i = 0; i < gp_arr_length(strs); ++i)
-        required_capacity += gp_str_length(strs[i]) + separator_length;
+    // Rewinding would free str if it's reallocated after the tail.
+    const size_t tail_length = gp_str_length(*str) - safe;
+    GPArena* scratch = gp_scratch_arena();
+    GPArena* tmp = gp_str_allocator(*str) == &scratch->base ? gp_arena_new(NULL, tail_length) : scratch;
+    uint8_t* tail = gp_mem_alloc(&tmp->base, tail_length);
+    memcpy(tail, *str + safe, tail_length);
 
-    gp_str_reserve(out, required_capacity);
-    for (size_t i = 0; i < gp_arr_length(strs) - 1; ++i)
-    {
-        memcpy(*out + gp_str_length(*out), strs[i], gp_str_length(strs[i]));
-        memcpy(*out + gp_str_length(*out) + gp_str_length(strs[i]), separator, separator_length);
-        ((GPStringHeader*)*out - 1)->length += gp_str_length(strs[i]) + separator_length;
-    }
-    memcpy(
-        *out + gp_str_length(*out),
-        strs[gp_arr_length(strs) - 1],
-        gp_str_length(strs[gp_arr_length(strs) - 1]));
-    ((GPStringHeader*)*out - 1)->length += gp_str_length(strs[gp_arr_length(strs) - 1]);
+    gp_str_set(*str)->length = safe;
+    gp_s_normalize_append(str, tail, tail_length, form);
+
+    if (tmp == scratch)
+        gp_arena_rewind(scratch, tail);
+    else
+        gp_arena_delete(tmp);
 }
 
 static bool gp_s_is_soft_dotted(const uint32_t encoding)
@@ -1109,10 +3065,16 @@ uint32_t gp_u32_to_upper(uint32_t);
 void gp_str_to_upper_full(
     GPString* str,
     const char* locale_code)
+{
+    gp_str_to_upper_full_l(str, gp_locale_handle(locale_code));
+}
+
+void gp_str_to_upper_full_l(
+    GPString* str,
+    GPLocaleHandle locale)
 {
     char code_buf[4] = "";
-    if (locale_code == NULL)
-        locale_code = strncpy(code_buf, setlocale(LC_ALL, NULL), 2);
+    const char* locale_code = gp_s_locale_code(locale, code_buf);
 
     // TODO ASCII optimization would go here if not Turkish locale
 
@@ -1333,10 +3295,16 @@ uint32_t gp_u32_to_lower(uint32_t);
 void gp_str_to_lower_full(
     GPString* str,
     const char* locale_code)
+{
+    gp_str_to_lower_full_l(str, gp_locale_handle(locale_code));
+}
+
+void gp_str_to_lower_full_l(
+    GPString* str,
+    GPLocaleHandle locale)
 {
     char code_buf[4] = "";
-    if (locale_code == NULL)
-        locale_code = strncpy(code_buf, setlocale(LC_ALL, NULL), 2);
+    const char* locale_code = gp_s_locale_code(locale, code_buf);
 
     // TODO ASCII optimization would go here if not Turkish locale.
 
@@ -1423,10 +3391,16 @@ uint32_t gp_u32_to_title(uint32_t);
 void gp_str_capitalize(
     GPString* str,
     const char* locale_code)
+{
+    gp_str_capitalize_l(str, gp_locale_handle(locale_code));
+}
+
+void gp_str_capitalize_l(
+    GPString* str,
+    GPLocaleHandle locale)
 {
     char code_buf[4] = "";
-    if (locale_code == NULL)
-        locale_code = strncpy(code_buf, setlocale(LC_ALL, NULL), 2);
+    const char* locale_code = gp_s_locale_code(locale, code_buf);
 
     // TODO ASCII optimization would go here if not Turkish locale
 
@@ -1547,251 +3521,560 @@ void gp_str_capitalize(
     ((GPStringHeader*)*str - 1)->length += required_capacity - first_length;
 }
 
-GP_NONNULL_ARGS()
-static void gp_s_wcs_append(
-    GPArray(wchar_t)*restrict wcs, wchar_t*restrict codepoints, size_t codepoints_length)
+// Full case folding of a single codepoint. Returns the number of codepoints
+// stored in folding.
+static size_t gp_s_u32_fold_full(uint32_t c, uint32_t folding[GP_STATIC 3], bool turkish)
 {
-    gp_arr_reserve(sizeof (*wcs)[0], wcs, gp_arr_capacity(*wcs) + codepoints_length - 1);
-    for (size_t i = 0; i < codepoints_length; ++i)
-        (*wcs)[gp_arr_length(*wcs) + i] = codepoints[i];
-    ((GPArrayHeader*)*wcs - 1)->length += codepoints_length;
-}
+    #define GP_FOLD(...) return memcpy(folding, (uint32_t[]){__VA_ARGS__}, \
+        sizeof(uint32_t[]){__VA_ARGS__}), sizeof(uint32_t[]){__VA_ARGS__} / sizeof(uint32_t)
+
+    switch (c) {
+    case 'I': if (turkish) GP_FOLD(0x0131); GP_FOLD('i');
+    case 0x0130: if (turkish) GP_FOLD('i'); GP_FOLD('i', 0x0307); // LATIN CAPITAL LETTER I WITH DOT ABOVE
+
+    case 0x00B5: GP_FOLD(0x03BC                ); // MICRO SIGN
+    case 0x00DF: GP_FOLD(0x0073, 0x0073        ); // LATIN SMALL LETTER SHARP S
+    case 0x0149: GP_FOLD(0x02BC, 0x006E        ); // LATIN SMALL LETTER N PRECEDED BY APOSTROPHE
+    case 0x017F: GP_FOLD(0x0073                ); // LATIN SMALL LETTER LONG S
+    case 0x01F0: GP_FOLD(0x006A, 0x030C        ); // LATIN SMALL LETTER J WITH CARON
+    case 0x0345: GP_FOLD(0x03B9                ); // COMBINING GREEK YPOGEGRAMMENI
+    case 0x0390: GP_FOLD(0x03B9, 0x0308, 0x0301); // GREEK SMALL LETTER IOTA WITH DIALYTIKA AND TONOS
+    case 0x03B0: GP_FOLD(0x03C5, 0x0308, 0x0301); // GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND TONOS
+    case 0x03C2: GP_FOLD(0x03C3                ); // GREEK SMALL LETTER FINAL SIGMA
+    case 0x03D0: GP_FOLD(0x03B2                ); // GREEK BETA SYMBOL
+    case 0x03D1: GP_FOLD(0x03B8                ); // GREEK THETA SYMBOL
+    case 0x03D5: GP_FOLD(0x03C6                ); // GREEK PHI SYMBOL
+    case 0x03D6: GP_FOLD(0x03C0                ); // GREEK PI SYMBOL
+    case 0x03F0: GP_FOLD(0x03BA                ); // GREEK KAPPA SYMBOL
+    case 0x03F1: GP_FOLD(0x03C1                ); // GREEK RHO SYMBOL
+    case 0x03F5: GP_FOLD(0x03B5                ); // GREEK LUNATE EPSILON SYMBOL
+    case 0x0587: GP_FOLD(0x0565, 0x0582        ); // ARMENIAN SMALL LIGATURE ECH YIWN
+    case 0x1E9E: GP_FOLD(0x0073, 0x0073        ); // LATIN CAPITAL LETTER SHARP S
+    case 0x1F50: GP_FOLD(0x03C5, 0x0313        ); // GREEK SMALL LETTER UPSILON WITH PSILI
+    case 0x1F52: GP_FOLD(0x03C5, 0x0313, 0x0300); // GREEK SMALL LETTER UPSILON WITH PSILI AND VARIA
+    case 0x1F54: GP_FOLD(0x03C5, 0x0313, 0x0301); // GREEK SMALL LETTER UPSILON WITH PSILI AND OXIA
+    case 0x1F56: GP_FOLD(0x03C5, 0x0313, 0x0342); // GREEK SMALL LETTER UPSILON WITH PSILI AND PERISPOMENI
+    case 0x1FB2: GP_FOLD(0x1F70, 0x03B9        ); // GREEK SMALL LETTER ALPHA WITH VARIA AND YPOGEGRAMMENI
+    case 0x1FB3: GP_FOLD(0x03B1, 0x03B9        ); // GREEK SMALL LETTER ALPHA WITH YPOGEGRAMMENI
+    case 0x1FB4: GP_FOLD(0x03AC, 0x03B9        ); // GREEK SMALL LETTER ALPHA WITH OXIA AND YPOGEGRAMMENI
+    case 0x1FB6: GP_FOLD(0x03B1, 0x0342        ); // GREEK SMALL LETTER ALPHA WITH PERISPOMENI
+    case 0x1FB7: GP_FOLD(0x03B1, 0x0342, 0x03B9); // GREEK SMALL LETTER ALPHA WITH PERISPOMENI AND YPOGEGRAMMENI
+    case 0x1FBC: GP_FOLD(0x03B1, 0x03B9        ); // GREEK CAPITAL LETTER ALPHA WITH PROSGEGRAMMENI
+    case 0x1FBE: GP_FOLD(0x03B9                ); // GREEK PROSGEGRAMMENI
+    case 0x1FC2: GP_FOLD(0x1F74, 0x03B9        ); // GREEK SMALL LETTER ETA WITH VARIA AND YPOGEGRAMMENI
+    case 0x1FC3: GP_FOLD(0x03B7, 0x03B9        ); // GREEK SMALL LETTER ETA WITH YPOGEGRAMMENI
+    case 0x1FC4: GP_FOLD(0x03AE, 0x03B9        ); // GREEK SMALL LETTER ETA WITH OXIA AND YPOGEGRAMMENI
+    case 0x1FC6: GP_FOLD(0x03B7, 0x0342        ); // GREEK SMALL LETTER ETA WITH PERISPOMENI
+    case 0x1FC7: GP_FOLD(0x03B7, 0x0342, 0x03B9); // GREEK SMALL LETTER ETA WITH PERISPOMENI AND YPOGEGRAMMENI
+    case 0x1FCC: GP_FOLD(0x03B7, 0x03B9        ); // GREEK CAPITAL LETTER ETA WITH PROSGEGRAMMENI
+    case 0x1FD2: GP_FOLD(0x03B9, 0x0308, 0x0300); // GREEK SMALL LETTER IOTA WITH DIALYTIKA AND VARIA
+    case 0x1FD3: GP_FOLD(0x03B9, 0x0308, 0x0301); // GREEK SMALL LETTER IOTA WITH DIALYTIKA AND OXIA
+    case 0x1FD6: GP_FOLD(0x03B9, 0x0342        ); // GREEK SMALL LETTER IOTA WITH PERISPOMENI
+    case 0x1FD7: GP_FOLD(0x03B9, 0x0308, 0x0342); // GREEK SMALL LETTER IOTA WITH DIALYTIKA AND PERISPOMENI
+    case 0x1FE2: GP_FOLD(0x03C5, 0x0308, 0x0300); // GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND VARIA
+    case 0x1FE3: GP_FOLD(0x03C5, 0x0308, 0x0301); // GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND OXIA
+    case 0x1FE4: GP_FOLD(0x03C1, 0x0313        ); // GREEK SMALL LETTER RHO WITH PSILI
+    case 0x1FE6: GP_FOLD(0x03C5, 0x0342        ); // GREEK SMALL LETTER UPSILON WITH PERISPOMENI
+    case 0x1FE7: GP_FOLD(0x03C5, 0x0308, 0x0342); // GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND PERISPOMENI
+    case 0x1FF2: GP_FOLD(0x1F7C, 0x03B9        ); // GREEK SMALL LETTER OMEGA WITH VARIA AND YPOGEGRAMMENI
+    case 0x1FF3: GP_FOLD(0x03C9, 0x03B9        ); // GREEK SMALL LETTER OMEGA WITH YPOGEGRAMMENI
+    case 0x1FF4: GP_FOLD(0x03CE, 0x03B9        ); // GREEK SMALL LETTER OMEGA WITH OXIA AND YPOGEGRAMMENI
+    case 0x1FF6: GP_FOLD(0x03C9, 0x0342        ); // GREEK SMALL LETTER OMEGA WITH PERISPOMENI
+    case 0x1FF7: GP_FOLD(0x03C9, 0x0342, 0x03B9); // GREEK SMALL LETTER OMEGA WITH PERISPOMENI AND YPOGEGRAMMENI
+    case 0x1FFC: GP_FOLD(0x03C9, 0x03B9        ); // GREEK CAPITAL LETTER OMEGA WITH PROSGEGRAMMENI
+    case 0x1C80: GP_FOLD(0x0432                ); // CYRILLIC SMALL LETTER ROUNDED VE
+    case 0x1C81: GP_FOLD(0x0434                ); // CYRILLIC SMALL LETTER LONG-LEGGED DE
+    case 0x1C82: GP_FOLD(0x043E                ); // CYRILLIC SMALL LETTER NARROW O
+    case 0x1C83: GP_FOLD(0x0441                ); // CYRILLIC SMALL LETTER WIDE ES
+    case 0x1C84: GP_FOLD(0x0442                ); // CYRILLIC SMALL LETTER TALL TE
+    case 0x1C85: GP_FOLD(0x0442                ); // CYRILLIC SMALL LETTER THREE-LEGGED TE
+    case 0x1C86: GP_FOLD(0x044A                ); // CYRILLIC SMALL LETTER TALL HARD SIGN
+    case 0x1C87: GP_FOLD(0x0463                ); // CYRILLIC SMALL LETTER TALL YAT
+    case 0x1C88: GP_FOLD(0xA64B                ); // CYRILLIC SMALL LETTER UNBLENDED UK
+    case 0x1E96: GP_FOLD(0x0068, 0x0331        ); // LATIN SMALL LETTER H WITH LINE BELOW
+    case 0x1E97: GP_FOLD(0x0074, 0x0308        ); // LATIN SMALL LETTER T WITH DIAERESIS
+    case 0x1E98: GP_FOLD(0x0077, 0x030A        ); // LATIN SMALL LETTER W WITH RING ABOVE
+    case 0x1E99: GP_FOLD(0x0079, 0x030A        ); // LATIN SMALL LETTER Y WITH RING ABOVE
+    case 0x1E9A: GP_FOLD(0x0061, 0x02BE        ); // LATIN SMALL LETTER A WITH RIGHT HALF RING
+    case 0x1E9B: GP_FOLD(0x1E61                ); // LATIN SMALL LETTER LONG S WITH DOT ABOVE
+    case 0xFB00: GP_FOLD(0x0066, 0x0066        ); // LATIN SMALL LIGATURE FF
+    case 0xFB01: GP_FOLD(0x0066, 0x0069        ); // LATIN SMALL LIGATURE FI
+    case 0xFB02: GP_FOLD(0x0066, 0x006C        ); // LATIN SMALL LIGATURE FL
+    case 0xFB03: GP_FOLD(0x0066, 0x0066, 0x0069); // LATIN SMALL LIGATURE FFI
+    case 0xFB04: GP_FOLD(0x0066, 0x0066, 0x006C); // LATIN SMALL LIGATURE FFL
+    case 0xFB05: GP_FOLD(0x0073, 0x0074        ); // LATIN SMALL LIGATURE LONG S T
+    case 0xFB06: GP_FOLD(0x0073, 0x0074        ); // LATIN SMALL LIGATURE ST
+    case 0xFB13: GP_FOLD(0x0574, 0x0576        ); // ARMENIAN SMALL LIGATURE MEN NOW
+    case 0xFB14: GP_FOLD(0x0574, 0x0565        ); // ARMENIAN SMALL LIGATURE MEN ECH
+    case 0xFB15: GP_FOLD(0x0574, 0x056B        ); // ARMENIAN SMALL LIGATURE MEN INI
+    case 0xFB16: GP_FOLD(0x057E, 0x0576        ); // ARMENIAN SMALL LIGATURE VEW NOW
+    case 0xFB17: GP_FOLD(0x0574, 0x056D        ); // ARMENIAN SMALL LIGATURE MEN XEH
 
-#define GP_wcs_APPEND(...) gp_s_wcs_append( \
-    wcs, (wchar_t[]){__VA_ARGS__}, sizeof(wchar_t[]){__VA_ARGS__} / sizeof(wchar_t))
+    default:
+        if      (0x13F8 <= c && c <= 0x13FD) GP_FOLD(c - 0x8);
+        else if (0x1F80 <= c && c <= 0x1F87) GP_FOLD(c - 0x80, 0x03B9);
+        else if (0x1F88 <= c && c <= 0x1F8F) GP_FOLD(c - 0x88, 0x03B9);
+        else if (0x1F90 <= c && c <= 0x1F97) GP_FOLD(c - 0x70, 0x03B9);
+        else if (0x1F98 <= c && c <= 0x1F9F) GP_FOLD(c - 0x78, 0x03B9);
+        else if (0x1FA0 <= c && c <= 0x1FA7) GP_FOLD(c - 0x40, 0x03B9);
+        else if (0x1FA8 <= c && c <= 0x1FAF) GP_FOLD(c - 0x48, 0x03B9);
+        else if (0xAB70 <= c && c <= 0xABBF) GP_FOLD(c - 0x97D0);
+        else if (0x13A0 <= c && c <= 0x13F5) GP_FOLD(c); // Cherokee folds to upper
+        else GP_FOLD(gp_u32_to_lower(c));
+    }
+    #undef GP_FOLD
+}
 
-void gp_wcs_fold_utf8(
-    GPArray(wchar_t)* wcs, const void*_str, const size_t str_length, const char* locale_code)
+static bool gp_s_locale_is_turkish(GPLocaleHandle locale)
 {
     char code_buf[4] = "";
-    if (locale_code == NULL)
-        locale_code = strncpy(code_buf, setlocale(LC_ALL, NULL), 2);
+    const char* locale_code = gp_s_locale_code(locale, code_buf);
+    return strncmp(locale_code, "tr", 2) == 0 || strncmp(locale_code, "az", 2) == 0;
+}
 
+// Writes null-terminated folded wide string to out, which must have room for
+// 2 * str_length + 1 wide characters. Any codepoint folds to at most 2 wide
+// characters per byte, surrogate pairs and invalid sequences included.
+static size_t gp_s_wcs_fold_utf8(
+    wchar_t* out, const void*_str, const size_t str_length, GPLocaleHandle locale)
+{
     const uint8_t* str = _str;
-    ((GPArrayHeader*)*wcs - 1)->length = 0;
-    size_t wcs_capacity = str_length + sizeof"";
-    gp_arr_reserve(sizeof(*wcs)[0], wcs, wcs_capacity);
-    const bool turkish = strncmp(locale_code, "tr", 2) == 0 || strncmp(locale_code, "az", 2) == 0;
+    const bool turkish = gp_s_locale_is_turkish(locale);
 
     size_t i = 0;
     if ( ! turkish) for (; i < str_length; ++i)
     {
         if (str[i] > 0x7F)
             break;
-        (*wcs)[i] = 'A' <= str[i] && str[i] <= 'Z' ? str[i] + 'a' - 'A' : str[i];
+        out[i] = 'A' <= str[i] && str[i] <= 'Z' ? str[i] + 'a' - 'A' : str[i];
     }
-    ((GPArrayHeader*)*wcs - 1)->length = i;
+    size_t length = i;
 
     for (size_t codepoint_length; i < str_length; i += codepoint_length)
     {
-        // TODO more ASCII optimization here
-
         uint32_t encoding;
-        codepoint_length = gp_utf8_decode_unsafe(&encoding, str, i);
-
-        switch (encoding) {
-        case 'I': if (turkish) GP_wcs_APPEND(0x0131); else GP_wcs_APPEND('i'); break;
-        case 0x0130: GP_wcs_APPEND('i'); if ( ! turkish) GP_wcs_APPEND(0x0307); break; // LATIN CAPITAL LETTER I WITH DOT ABOVE
-
-        case 0x00B5: GP_wcs_APPEND(0x03BC                ); break; // MICRO SIGN
-        case 0x00DF: GP_wcs_APPEND(0x0073, 0x0073        ); break; // LATIN SMALL LETTER SHARP S
-        case 0x0149: GP_wcs_APPEND(0x02BC, 0x006E        ); break; // LATIN SMALL LETTER N PRECEDED BY APOSTROPHE
-        case 0x017F: GP_wcs_APPEND(0x0073                ); break; // LATIN SMALL LETTER LONG S
-        case 0x01F0: GP_wcs_APPEND(0x006A, 0x030C        ); break; // LATIN SMALL LETTER J WITH CARON
-        case 0x0345: GP_wcs_APPEND(0x03B9                ); break; // COMBINING GREEK YPOGEGRAMMENI
-        case 0x0390: GP_wcs_APPEND(0x03B9, 0x0308, 0x0301); break; // GREEK SMALL LETTER IOTA WITH DIALYTIKA AND TONOS
-        case 0x03B0: GP_wcs_APPEND(0x03C5, 0x0308, 0x0301); break; // GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND TONOS
-        case 0x03C2: GP_wcs_APPEND(0x03C3                ); break; // GREEK SMALL LETTER FINAL SIGMA
-        case 0x03D0: GP_wcs_APPEND(0x03B2                ); break; // GREEK BETA SYMBOL
-        case 0x03D1: GP_wcs_APPEND(0x03B8                ); break; // GREEK THETA SYMBOL
-        case 0x03D5: GP_wcs_APPEND(0x03C6                ); break; // GREEK PHI SYMBOL
-        case 0x03D6: GP_wcs_APPEND(0x03C0                ); break; // GREEK PI SYMBOL
-        case 0x03F0: GP_wcs_APPEND(0x03BA                ); break; // GREEK KAPPA SYMBOL
-        case 0x03F1: GP_wcs_APPEND(0x03C1                ); break; // GREEK RHO SYMBOL
-        case 0x03F5: GP_wcs_APPEND(0x03B5                ); break; // GREEK LUNATE EPSILON SYMBOL
-        case 0x0587: GP_wcs_APPEND(0x0565, 0x0582        ); break; // ARMENIAN SMALL LIGATURE ECH YIWN
-        case 0x1E9E: GP_wcs_APPEND(0x0073, 0x0073        ); break; // LATIN CAPITAL LETTER SHARP S
-        case 0x1F50: GP_wcs_APPEND(0x03C5, 0x0313        ); break; // GREEK SMALL LETTER UPSILON WITH PSILI
-        case 0x1F52: GP_wcs_APPEND(0x03C5, 0x0313, 0x0300); break; // GREEK SMALL LETTER UPSILON WITH PSILI AND VARIA
-        case 0x1F54: GP_wcs_APPEND(0x03C5, 0x0313, 0x0301); break; // GREEK SMALL LETTER UPSILON WITH PSILI AND OXIA
-        case 0x1F56: GP_wcs_APPEND(0x03C5, 0x0313, 0x0342); break; // GREEK SMALL LETTER UPSILON WITH PSILI AND PERISPOMENI
-        case 0x1FB2: GP_wcs_APPEND(0x1F70, 0x03B9        ); break; // GREEK SMALL LETTER ALPHA WITH VARIA AND YPOGEGRAMMENI
-        case 0x1FB3: GP_wcs_APPEND(0x03B1, 0x03B9        ); break; // GREEK SMALL LETTER ALPHA WITH YPOGEGRAMMENI
-        case 0x1FB4: GP_wcs_APPEND(0x03AC, 0x03B9        ); break; // GREEK SMALL LETTER ALPHA WITH OXIA AND YPOGEGRAMMENI
-        case 0x1FB6: GP_wcs_APPEND(0x03B1, 0x0342        ); break; // GREEK SMALL LETTER ALPHA WITH PERISPOMENI
-        case 0x1FB7: GP_wcs_APPEND(0x03B1, 0x0342, 0x03B9); break; // GREEK SMALL LETTER ALPHA WITH PERISPOMENI AND YPOGEGRAMMENI
-        case 0x1FBC: GP_wcs_APPEND(0x03B1, 0x03B9        ); break; // GREEK CAPITAL LETTER ALPHA WITH PROSGEGRAMMENI
-        case 0x1FBE: GP_wcs_APPEND(0x03B9                ); break; // GREEK PROSGEGRAMMENI
-        case 0x1FC2: GP_wcs_APPEND(0x1F74, 0x03B9        ); break; // GREEK SMALL LETTER ETA WITH VARIA AND YPOGEGRAMMENI
-        case 0x1FC3: GP_wcs_APPEND(0x03B7, 0x03B9        ); break; // GREEK SMALL LETTER ETA WITH YPOGEGRAMMENI
-        case 0x1FC4: GP_wcs_APPEND(0x03AE, 0x03B9        ); break; // GREEK SMALL LETTER ETA WITH OXIA AND YPOGEGRAMMENI
-        case 0x1FC6: GP_wcs_APPEND(0x03B7, 0x0342        ); break; // GREEK SMALL LETTER ETA WITH PERISPOMENI
-        case 0x1FC7: GP_wcs_APPEND(0x03B7, 0x0342, 0x03B9); break; // GREEK SMALL LETTER ETA WITH PERISPOMENI AND YPOGEGRAMMENI
-        case 0x1FCC: GP_wcs_APPEND(0x03B7, 0x03B9        ); break; // GREEK CAPITAL LETTER ETA WITH PROSGEGRAMMENI
-        case 0x1FD2: GP_wcs_APPEND(0x03B9, 0x0308, 0x0300); break; // GREEK SMALL LETTER IOTA WITH DIALYTIKA AND VARIA
-        case 0x1FD3: GP_wcs_APPEND(0x03B9, 0x0308, 0x0301); break; // GREEK SMALL LETTER IOTA WITH DIALYTIKA AND OXIA
-        case 0x1FD6: GP_wcs_APPEND(0x03B9, 0x0342        ); break; // GREEK SMALL LETTER IOTA WITH PERISPOMENI
-        case 0x1FD7: GP_wcs_APPEND(0x03B9, 0x0308, 0x0342); break; // GREEK SMALL LETTER IOTA WITH DIALYTIKA AND PERISPOMENI
-        case 0x1FE2: GP_wcs_APPEND(0x03C5, 0x0308, 0x0300); break; // GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND VARIA
-        case 0x1FE3: GP_wcs_APPEND(0x03C5, 0x0308, 0x0301); break; // GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND OXIA
-        case 0x1FE4: GP_wcs_APPEND(0x03C1, 0x0313        ); break; // GREEK SMALL LETTER RHO WITH PSILI
-        case 0x1FE6: GP_wcs_APPEND(0x03C5, 0x0342        ); break; // GREEK SMALL LETTER UPSILON WITH PERISPOMENI
-        case 0x1FE7: GP_wcs_APPEND(0x03C5, 0x0308, 0x0342); break; // GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND PERISPOMENI
-        case 0x1FF2: GP_wcs_APPEND(0x1F7C, 0x03B9        ); break; // GREEK SMALL LETTER OMEGA WITH VARIA AND YPOGEGRAMMENI
-        case 0x1FF3: GP_wcs_APPEND(0x03C9, 0x03B9        ); break; // GREEK SMALL LETTER OMEGA WITH YPOGEGRAMMENI
-        case 0x1FF4: GP_wcs_APPEND(0x03CE, 0x03B9        ); break; // GREEK SMALL LETTER OMEGA WITH OXIA AND YPOGEGRAMMENI
-        case 0x1FF6: GP_wcs_APPEND(0x03C9, 0x0342        ); break; // GREEK SMALL LETTER OMEGA WITH PERISPOMENI
-        case 0x1FF7: GP_wcs_APPEND(0x03C9, 0x0342, 0x03B9); break; // GREEK SMALL LETTER OMEGA WITH PERISPOMENI AND YPOGEGRAMMENI
-        case 0x1FFC: GP_wcs_APPEND(0x03C9, 0x03B9        ); break; // GREEK CAPITAL LETTER OMEGA WITH PROSGEGRAMMENI
-        case 0x1C80: GP_wcs_APPEND(0x0432                ); break; // CYRILLIC SMALL LETTER ROUNDED VE
-        case 0x1C81: GP_wcs_APPEND(0x0434                ); break; // CYRILLIC SMALL LETTER LONG-LEGGED DE
-        case 0x1C82: GP_wcs_APPEND(0x043E                ); break; // CYRILLIC SMALL LETTER NARROW O
-        case 0x1C83: GP_wcs_APPEND(0x0441                ); break; // CYRILLIC SMALL LETTER WIDE ES
-        case 0x1C84: GP_wcs_APPEND(0x0442                ); break; // CYRILLIC SMALL LETTER TALL TE
-        case 0x1C85: GP_wcs_APPEND(0x0442                ); break; // CYRILLIC SMALL LETTER THREE-LEGGED TE
-        case 0x1C86: GP_wcs_APPEND(0x044A                ); break; // CYRILLIC SMALL LETTER TALL HARD SIGN
-        case 0x1C87: GP_wcs_APPEND(0x0463                ); break; // CYRILLIC SMALL LETTER TALL YAT
-        case 0x1C88: GP_wcs_APPEND(0xA64B                ); break; // CYRILLIC SMALL LETTER UNBLENDED UK
-        case 0x1E96: GP_wcs_APPEND(0x0068, 0x0331        ); break; // LATIN SMALL LETTER H WITH LINE BELOW
-        case 0x1E97: GP_wcs_APPEND(0x0074, 0x0308        ); break; // LATIN SMALL LETTER T WITH DIAERESIS
-        case 0x1E98: GP_wcs_APPEND(0x0077, 0x030A        ); break; // LATIN SMALL LETTER W WITH RING ABOVE
-        case 0x1E99: GP_wcs_APPEND(0x0079, 0x030A        ); break; // LATIN SMALL LETTER Y WITH RING ABOVE
-        case 0x1E9A: GP_wcs_APPEND(0x0061, 0x02BE        ); break; // LATIN SMALL LETTER A WITH RIGHT HALF RING
-        case 0x1E9B: GP_wcs_APPEND(0x1E61                ); break; // LATIN SMALL LETTER LONG S WITH DOT ABOVE
-        case 0xFB00: GP_wcs_APPEND(0x0066, 0x0066        ); break; // LATIN SMALL LIGATURE FF
-        case 0xFB01: GP_wcs_APPEND(0x0066, 0x0069        ); break; // LATIN SMALL LIGATURE FI
-        case 0xFB02: GP_wcs_APPEND(0x0066, 0x006C        ); break; // LATIN SMALL LIGATURE FL
-        case 0xFB03: GP_wcs_APPEND(0x0066, 0x0066, 0x0069); break; // LATIN SMALL LIGATURE FFI
-        case 0xFB04: GP_wcs_APPEND(0x0066, 0x0066, 0x006C); break; // LATIN SMALL LIGATURE FFL
-        case 0xFB05: GP_wcs_APPEND(0x0073, 0x0074        ); break; // LATIN SMALL LIGATURE LONG S T
-        case 0xFB06: GP_wcs_APPEND(0x0073, 0x0074        ); break; // LATIN SMALL LIGATURE ST
-        case 0xFB13: GP_wcs_APPEND(0x0574, 0x0576        ); break; // ARMENIAN SMALL LIGATURE MEN NOW
-        case 0xFB14: GP_wcs_APPEND(0x0574, 0x0565        ); break; // ARMENIAN SMALL LIGATURE MEN ECH
-        case 0xFB15: GP_wcs_APPEND(0x0574, 0x056B        ); break; // ARMENIAN SMALL LIGATURE MEN INI
-        case 0xFB16: GP_wcs_APPEND(0x057E, 0x0576        ); break; // ARMENIAN SMALL LIGATURE VEW NOW
-        case 0xFB17: GP_wcs_APPEND(0x0574, 0x056D        ); break; // ARMENIAN SMALL LIGATURE MEN XEH
+        codepoint_length = gp_utf8_decode(&encoding, str, str_length, i, &(bool){0});
+        uint32_t folding[3];
+        const size_t folding_length = gp_s_u32_fold_full(encoding, folding, turkish);
 
-        default:
-            if      (0x13F8 <= encoding && encoding <= 0x13FD) GP_wcs_APPEND(encoding - 0x8);
-            else if (0x1F80 <= encoding && encoding <= 0x1F87) GP_wcs_APPEND(encoding - 0x80, 0x03B9);
-            else if (0x1F88 <= encoding && encoding <= 0x1F8F) GP_wcs_APPEND(encoding - 0x88, 0x03B9);
-            else if (0x1F90 <= encoding && encoding <= 0x1F97) GP_wcs_APPEND(encoding - 0x70, 0x03B9);
-            else if (0x1F98 <= encoding && encoding <= 0x1F9F) GP_wcs_APPEND(encoding - 0x78, 0x03B9);
-            else if (0x1FA0 <= encoding && encoding <= 0x1FA7) GP_wcs_APPEND(encoding - 0x40, 0x03B9);
-            else if (0x1FA8 <= encoding && encoding <= 0x1FAF) GP_wcs_APPEND(encoding - 0x48, 0x03B9);
-            else if (0xAB70 <= encoding && encoding <= 0xABBF) GP_wcs_APPEND(encoding - 0x97D0);
-            else {
-                uint32_t lower = gp_u32_to_lower(encoding);
-                if (lower <= WCHAR_MAX) {
-                    GP_wcs_APPEND(lower);
-                } else { // surrogate pair in Windows
-                    lower &= ~0x10000;
-                    GP_wcs_APPEND((lower >> 10) | 0xD800, (lower & 0x3FF) | 0xDC00);
-                }
+        for (size_t j = 0; j < folding_length; ++j)
+        {
+            if (sizeof(wchar_t) == sizeof(uint32_t) || folding[j] <= UINT16_MAX) {
+                out[length++] = folding[j];
+            } else { // surrogate pair in Windows
+                const uint32_t u = folding[j] - 0x10000;
+                out[length++] = (u >> 10)   | 0xD800;
+                out[length++] = (u & 0x3FF) | 0xDC00;
             }
         }
     }
-    (*wcs)[gp_arr_length(*wcs)] = L'\0';
+    out[length] = L'\0';
+    return length;
+}
+
+GPFoldIterator gp_fold_iterator(
+    const void*const str, const size_t str_length, GPLocaleHandle locale)
+{
+    return (GPFoldIterator){
+        .str = str, .length = str_length, .turkish = gp_s_locale_is_turkish(locale) };
+}
+
+bool gp_fold_next(GPFoldIterator* it)
+{
+    if (it->pending_length != 0) {
+        it->codepoint = it->pending[0];
+        it->pending[0] = it->pending[1];
+        --it->pending_length;
+        return true;
+    }
+    if (it->position >= it->length)
+        return false;
+
+    const uint8_t c = it->str[it->position];
+    if (c < 0x80 && ! (c == 'I' && it->turkish)) {
+        it->codepoint = 'A' <= c && c <= 'Z' ? c + 'a' - 'A' : c;
+        ++it->position;
+        return true;
+    }
+    uint32_t decoding;
+    it->position += gp_utf8_decode(&decoding, it->str, it->length, it->position, &(bool){0});
+    uint32_t folding[3];
+    it->pending_length = gp_s_u32_fold_full(decoding, folding, it->turkish) - 1;
+    it->codepoint  = folding[0];
+    it->pending[0] = folding[1];
+    it->pending[1] = folding[2];
+    return true;
+}
+
+// Skip common ASCII prefix that folds the same without Turkish dotless i.
+static void gp_s_fold_skip_ascii(GPFoldIterator* it1, GPFoldIterator* it2)
+{
+    if (it1->turkish)
+        return;
+    size_t i = it1->position;
+    size_t j = it2->position;
+    while (i < it1->length && j < it2->length)
+    {
+        uint8_t c1 = it1->str[i];
+        uint8_t c2 = it2->str[j];
+        if ((c1 | c2) >= 0x80)
+            break;
+        c1 += ('A' <= c1 && c1 <= 'Z') * ('a' - 'A');
+        c2 += ('A' <= c2 && c2 <= 'Z') * ('a' - 'A');
+        if (c1 != c2)
+            break;
+        ++i;
+        ++j;
+    }
+    it1->position = i;
+    it2->position = j;
+}
+
+int gp_utf8_compare_fold(
+    const void*const s1,
+    const size_t     s1_length,
+    const void*const s2,
+    const size_t     s2_length,
+    GPLocaleHandle   locale)
+{
+    GPFoldIterator it1 = gp_fold_iterator(s1, s1_length, locale);
+    GPFoldIterator it2 = it1;
+    it2.str    = s2;
+    it2.length = s2_length;
+    while (true)
+    {
+        if (it1.pending_length == 0 && it2.pending_length == 0)
+            gp_s_fold_skip_ascii(&it1, &it2);
+        const bool has1 = gp_fold_next(&it1);
+        const bool has2 = gp_fold_next(&it2);
+        if ( ! has1 || ! has2)
+            return has1 - has2;
+        if (it1.codepoint != it2.codepoint)
+            return it1.codepoint < it2.codepoint ? -1 : 1;
+    }
+}
+
+bool gp_utf8_equal_fold(
+    const void*const s1,
+    const size_t     s1_length,
+    const void*const s2,
+    const size_t     s2_length,
+    GPLocaleHandle   locale)
+{
+    return gp_utf8_compare_fold(s1, s1_length, s2, s2_length, locale) == 0;
+}
+
+bool gp_utf8_starts_with_fold(
+    const void*const str,
+    const size_t     str_length,
+    const void*const prefix,
+    const size_t     prefix_length,
+    GPLocaleHandle   locale)
+{
+    GPFoldIterator it1 = gp_fold_iterator(str, str_length, locale);
+    GPFoldIterator it2 = it1;
+    it2.str    = prefix;
+    it2.length = prefix_length;
+    while (true)
+    {
+        if (it1.pending_length == 0 && it2.pending_length == 0)
+            gp_s_fold_skip_ascii(&it1, &it2);
+        const bool has1 = gp_fold_next(&it1);
+        if ( ! gp_fold_next(&it2))
+            return true;
+        if ( ! has1 || it1.codepoint != it2.codepoint)
+            return false;
+    }
 }
 
-static int gp_s_utf8_codepoint_compare(const void*_s1, const void*_s2)
+uint64_t gp_utf8_hash_fold(
+    const void*const str,
+    const size_t     str_length,
+    GPLocaleHandle   locale)
 {
-    const GPString s1 = *(GPString*)_s1;
-    const GPString s2 = *(GPString*)_s2;
-    const size_t min_length = gp_min(gp_str_length(s1), gp_str_length(s2));
-    for (size_t i = 0, codepoint_length; i < min_length; i += codepoint_length)
+    // Same as gp_bytes_hash64() of folded UTF-8.
+    const uint64_t FNV_prime        = 0x00000100000001B3;
+    const uint64_t FNV_offset_basis = 0xcbf29ce484222325;
+    uint64_t hash = FNV_offset_basis;
+
+    GPFoldIterator it = gp_fold_iterator(str, str_length, locale);
+    while (gp_fold_next(&it))
     {
-        uint32_t cp1, cp2;
-        codepoint_length = gp_utf8_decode_unsafe(&cp1, s1, i); gp_utf8_decode_unsafe(&cp2, s2, i);
-        if (cp1 != cp2)
-            return cp1 - cp2;
+        uint8_t encoding[4];
+        const size_t encoding_length = gp_utf8_encode_unsafe(encoding, it.codepoint);
+        for (size_t i = 0; i < encoding_length; ++i) {
+            hash ^= encoding[i];
+            hash *= FNV_prime;
+        }
     }
-    return gp_str_length(s1) - gp_str_length(s2);
+    return hash;
 }
 
-static int gp_s_utf8_codepoint_compare_reverse(const void*_s1, const void*_s2)
+// UTF-8 byte order is codepoint order, so strings can be sorted by raw bytes
+// with multikey quicksort (Bentley & Sedgewick), which partitions strings by a
+// single byte at a time and never compares common prefixes more than once.
+
+static int gp_s_str_byte_at(const GPString str, size_t depth)
 {
-    return gp_s_utf8_codepoint_compare(_s2, _s1);
+    return depth < gp_str_length(str) ? str[depth].c : -1;
 }
 
-typedef struct gp_narrow_wide
+static void gp_s_str_swap(GPString* strs, size_t i, size_t j)
 {
-    GPString         narrow;
-    GPArray(wchar_t) wide;
-    GPLocale         locale;
-} GPNarrowWide;
+    GPString tmp = strs[i];
+    strs[i] = strs[j];
+    strs[j] = tmp;
+}
 
-static int gp_s_wcs_compare(const void*_s1, const void*_s2)
+// Strings are known to be equal up to depth.
+static int gp_s_str_compare_from(const GPString s1, const GPString s2, size_t depth)
 {
-    const GPNarrowWide* s1 = _s1;
-    const GPNarrowWide* s2 = _s2;
-    return wcscmp(s1->wide, s2->wide);
+    const size_t l1 = gp_str_length(s1);
+    const size_t l2 = gp_str_length(s2);
+    const size_t min_length = gp_min(l1, l2);
+    const int result = depth < min_length ?
+        memcmp(s1 + depth, s2 + depth, min_length - depth) : 0;
+    return result != 0 ? result : (l1 > l2) - (l1 < l2);
 }
 
-static int gp_s_wcs_compare_reverse(const void*_s1, const void*_s2)
+static void gp_s_str_multikey_quicksort(GPString* strs, size_t length, size_t depth)
 {
-    const GPNarrowWide* s1 = _s1;
-    const GPNarrowWide* s2 = _s2;
-    return wcscmp(s2->wide, s1->wide);
+    while (length > 1)
+    {
+        if (length <= 16) {
+            for (size_t i = 1; i < length; ++i)
+                for (size_t j = i; j > 0 && gp_s_str_compare_from(strs[j-1], strs[j], depth) > 0; --j)
+                    gp_s_str_swap(strs, j - 1, j);
+            return;
+        }
+
+        // Median of three bytes as pivot
+        int a = gp_s_str_byte_at(strs[0],          depth);
+        int b = gp_s_str_byte_at(strs[length/2],   depth);
+        int c = gp_s_str_byte_at(strs[length - 1], depth);
+        const int pivot = a < b ?
+            (b < c ? b : a < c ? c : a) :
+            (a < c ? a : b < c ? c : b);
+
+        // Three-way partition: [0, lt) < pivot, [lt, gt) == pivot, [gt, length) > pivot
+        size_t lt = 0;
+        size_t gt = length;
+        for (size_t i = 0; i < gt;) {
+            const int byte = gp_s_str_byte_at(strs[i], depth);
+            if (byte < pivot)
+                gp_s_str_swap(strs, lt++, i++);
+            else if (byte > pivot)
+                gp_s_str_swap(strs, i, --gt);
+            else
+                ++i;
+        }
+
+        // Recurse to the two smaller partitions and loop on the largest, so
+        // each recursion at least halves length and stack depth stays within
+        // log2(length). Middle strings that ended are equal and done.
+        GPString*    parts[]   = { strs, strs + lt, strs + gt };
+        const size_t lengths[] = { lt, pivot == -1 ? 0 : gt - lt, length - gt };
+        const size_t depths[]  = { depth, depth + 1, depth };
+        size_t largest = lengths[0] < lengths[1] ? 1 : 0;
+        if (lengths[largest] < lengths[2])
+            largest = 2;
+        for (size_t i = 0; i < 3; ++i)
+            if (i != largest)
+                gp_s_str_multikey_quicksort(parts[i], lengths[i], depths[i]);
+        strs   = parts[largest];
+        length = lengths[largest];
+        depth  = depths[largest];
+    }
 }
 
-static int gp_s_wcs_collate(const void*_s1, const void*_s2)
+// Keys are wide strings in big-endian byte order, so memcmp() on keys gives the
+// same order as wcscmp() on wide strings, which gives the same order as
+// wcscoll() if wide strings are transformed with wcsxfrm() first.
+
+static size_t gp_s_wcsxfrm(
+    wchar_t* dest, const wchar_t* src, size_t n, GPLocaleHandle locale)
 {
-    const GPNarrowWide* s1 = _s1;
-    const GPNarrowWide* s2 = _s2;
-    if (s1->locale == (GPLocale)0)
-        return wcscoll(s1->wide, s2->wide);
+    if (locale == NULL || locale->locale == (GPLocale)0)
+        return wcsxfrm(dest, src, n);
     #if _WIN32
-    return _wcscoll_l(s1->wide, s2->wide, s1->locale);
+    return _wcsxfrm_l(dest, src, n, locale->locale);
     #elif GP_HAS_LOCALE
-    return wcscoll_l(s1->wide, s2->wide, s1->locale);
+    return wcsxfrm_l(dest, src, n, locale->locale);
     #else
-    return wcscoll(s1->wide, s2->wide);
+    return wcsxfrm(dest, src, n);
     #endif
 }
 
-static int gp_s_wcs_collate_reverse(const void* s1, const void* s2)
+// Room for converting UTF-8 to a null-terminated wide string.
+static size_t gp_s_wcs_capacity(size_t utf8_length, bool fold)
+{
+    if (fold || sizeof(wchar_t) == sizeof(uint16_t))
+        return 2 * utf8_length + sizeof"";
+    return utf8_length + sizeof"";
+}
+
+// Allocates temporaries from tmp and returns the key in wide characters.
+static const wchar_t* gp_s_wcs_sort_key(
+    size_t*     out_length,
+    GPArena*    tmp,
+    const void* str,
+    size_t      str_length,
+    bool        fold,
+    bool        collate,
+    GPLocaleHandle locale)
+{
+    wchar_t* wcs = gp_mem_alloc(&tmp->base, gp_s_wcs_capacity(str_length, fold) * sizeof wcs[0]);
+    const size_t wcs_length = fold ?
+        gp_s_wcs_fold_utf8(wcs, str, str_length, locale)
+      : gp_wcs_from_utf8_unsafe(wcs, str, str_length);
+
+    if ( ! collate) {
+        *out_length = wcs_length;
+        return wcs;
+    }
+    const size_t xfrm_length = gp_s_wcsxfrm(NULL, wcs, 0, locale);
+    wchar_t* xfrm = gp_mem_alloc(&tmp->base, (xfrm_length + 1) * sizeof xfrm[0]);
+    gp_s_wcsxfrm(xfrm, wcs, xfrm_length + 1, locale);
+    *out_length = xfrm_length;
+    return xfrm;
+}
+
+static void gp_s_wcs_to_key(uint8_t* key, const wchar_t* wcs, size_t wcs_length)
+{
+    for (size_t i = 0; i < wcs_length; ++i) {
+        const uint32_t c = (uint32_t)wcs[i];
+        for (size_t j = 0; j < sizeof wcs[0]; ++j)
+            key[i*sizeof wcs[0] + j] = c >> 8*(sizeof wcs[0] - 1 - j);
+    }
+}
+
+size_t gp_str_sort_key(
+    GPString*   out,
+    const void* str,
+    size_t      str_length,
+    int         flags,
+    const char* locale_code)
+{
+    return gp_str_sort_key_l(out, str, str_length, flags, gp_locale_handle(locale_code));
+}
+
+size_t gp_str_sort_key_l(
+    GPString*      out,
+    const void*    str,
+    size_t         str_length,
+    int            flags,
+    GPLocaleHandle locale)
+{
+    gp_assert((flags & ~('f'|'c'|'r')) == 0, "Invalid sorting flags.");
+    const bool fold    = flags & 0x4;
+    const bool collate = flags & 0x1;
+    if ( ! (fold | collate)) // UTF-8 byte order is codepoint order
+        return gp_str_copy(out, str, str_length);
+
+    // Rewinding would free out if it's reallocated after temporaries.
+    GPArena* scratch = gp_scratch_arena();
+    GPArena* tmp = gp_str_allocator(*out) == &scratch->base ?
+        gp_arena_new(NULL, 2*(str_length + sizeof"")*sizeof(wchar_t)) : scratch;
+    void* tmp_position = gp_mem_alloc(&tmp->base, 0);
+
+    size_t wcs_length;
+    const wchar_t* wcs = gp_s_wcs_sort_key(
+        &wcs_length, tmp, str, str_length, fold, collate, locale);
+    const size_t key_length = wcs_length * sizeof wcs[0];
+    const size_t trunced = gp_str_reserve(out, key_length);
+    if (trunced == 0)
+        gp_s_wcs_to_key((uint8_t*)*out, wcs, wcs_length);
+    else { // truncating, convert full characters only to keep prefix order
+        const size_t capacity = gp_str_capacity(*out) / sizeof wcs[0] * sizeof wcs[0];
+        gp_s_wcs_to_key((uint8_t*)*out, wcs, capacity / sizeof wcs[0]);
+        memset(*out + capacity, 0, gp_str_capacity(*out) - capacity);
+    }
+    gp_str_set(*out)->length = key_length - trunced;
+
+    if (tmp == scratch)
+        gp_arena_rewind(scratch, tmp_position);
+    else
+        gp_arena_delete(tmp);
+    return trunced;
+}
+
+typedef struct gp_sort_key
+{
+    GPString       str;
+    const uint8_t* key;
+    size_t         key_length;
+} GPSortKey;
+
+static int gp_s_sort_key_compare(const void*_k1, const void*_k2)
+{
+    const GPSortKey* k1 = _k1;
+    const GPSortKey* k2 = _k2;
+    const int result = memcmp(k1->key, k2->key, gp_min(k1->key_length, k2->key_length));
+    if (result != 0)
+        return result;
+    return (k1->key_length > k2->key_length) - (k1->key_length < k2->key_length);
+}
+
+static int gp_s_sort_key_compare_reverse(const void* k1, const void* k2)
 {
-    return gp_s_wcs_collate(s2, s1);
+    return gp_s_sort_key_compare(k2, k1);
 }
 
 void gp_str_sort(
     GPArray(GPString)* strs,
     const int flags,
     const char* locale_code)
+{
+    gp_str_sort_l(strs, flags, gp_locale_handle(locale_code));
+}
+
+void gp_str_sort_l(
+    GPArray(GPString)* strs,
+    const int flags,
+    GPLocaleHandle locale)
 {
     gp_assert((flags & ~('f'|'c'|'r')) == 0, "Invalid sorting flags.");
     const bool fold    = flags & 0x4;
     const bool collate = flags & 0x1;
     const bool reverse = flags & 0x10;
     if ( ! (fold | collate)) {
-        qsort(*strs, gp_arr_length(*strs), sizeof(GPString),
-            !reverse ? gp_s_utf8_codepoint_compare : gp_s_utf8_codepoint_compare_reverse);
+        const size_t length = gp_arr_length(*strs);
+        gp_s_str_multikey_quicksort(*strs, length, 0);
+        if (reverse)
+            for (size_t i = 0; i < length/2; ++i)
+                gp_s_str_swap(*strs, i, length - 1 - i);
         return;
     }
+
+    // Transform each string only once. Keys live in their own arena, scratch
+    // is rewound after each transformation.
+    size_t total_length = 0;
+    for (size_t i = 0; i < gp_arr_length(*strs); ++i)
+        total_length += gp_str_length((*strs)[i]);
+    const size_t keys_length = gp_arr_length(*strs);
+    GPArena* keys_arena = gp_arena_new(NULL,
+        keys_length * sizeof(GPSortKey) + 2 * total_length * sizeof(wchar_t) + 64);
+    GPSortKey* keys = gp_mem_alloc(&keys_arena->base, keys_length * sizeof keys[0]);
     GPArena* scratch = gp_scratch_arena();
-    GPNarrowWide* pairs = gp_mem_alloc((GPAllocator*)scratch, sizeof pairs[0] * gp_arr_length(*strs));
-
-    for (size_t i = 0; i < gp_arr_length(*strs); ++i) {
-        pairs[i].narrow = (*strs)[i];
-        pairs[i].locale = gp_locale(locale_code);
-        pairs[i].wide = gp_arr_new(
-            sizeof pairs[i].wide[0], (GPAllocator*)scratch, gp_str_length((*strs)[i]));
-        if (fold)
-            gp_wcs_fold_utf8(&pairs[i].wide, (*strs)[i], gp_str_length((*strs)[i]), locale_code);
-        else
-            gp_s_utf8_to_wcs_very_unsafe(&pairs[i].wide, (*strs)[i], gp_str_length((*strs)[i]));
-    }
+    void* scratch_position = gp_mem_alloc(&scratch->base, 0);
 
-    if (collate)
-        qsort(pairs, gp_arr_length(*strs), sizeof pairs[0], !reverse ? gp_s_wcs_collate : gp_s_wcs_collate_reverse);
-    else
-        qsort(pairs, gp_arr_length(*strs), sizeof pairs[0], !reverse ? gp_s_wcs_compare : gp_s_wcs_compare_reverse);
+    for (size_t i = 0; i < keys_length; ++i)
+    {
+        size_t wcs_length;
+        const wchar_t* wcs = gp_s_wcs_sort_key(
+            &wcs_length, scratch, (*strs)[i], gp_str_length((*strs)[i]), fold, collate, locale);
+        uint8_t* key = gp_mem_alloc(&keys_arena->base, wcs_length * sizeof wcs[0]);
+        gp_s_wcs_to_key(key, wcs, wcs_length);
+        keys[i] = (GPSortKey){ (*strs)[i], key, wcs_length * sizeof wcs[0] };
+        gp_arena_rewind(scratch, scratch_position);
+    }
 
-    for (size_t i = 0; i < gp_arr_length(*strs); ++i)
-        (*strs)[i] = pairs[i].narrow;
+    qsort(keys, keys_length, sizeof keys[0],
+        !reverse ? gp_s_sort_key_compare : gp_s_sort_key_compare_reverse);
 
-    gp_arena_rewind(scratch, pairs);
+    for (size_t i = 0; i < keys_length; ++i)
+        (*strs)[i] = keys[i].str;
+    gp_arena_delete(keys_arena);
 }
 
 int gp_str_compare(
@@ -1800,6 +4083,16 @@ int gp_str_compare(
     const size_t s2_length,
     const int flags,
     const char* locale_code)
+{
+    return gp_str_compare_l(s1, s2, s2_length, flags, gp_locale_handle(locale_code));
+}
+
+int gp_str_compare_l(
+    const GPString s1,
+    const void*const s2,
+    const size_t s2_length,
+    const int flags,
+    GPLocaleHandle locale)
 {
     const bool fold    = flags & 0x04;
     const bool collate = flags & 0x01;
@@ -1816,42 +4109,38 @@ int gp_str_compare(
         }
         return !reverse ? gp_str_length(s1) - s2_length : s2_length - gp_str_length(s1);
     }
+    if ( ! collate) {
+        const int result = gp_utf8_compare_fold(s1, gp_str_length(s1), s2, s2_length, locale);
+        return !reverse ? result : -result;
+    }
 
     GPArena* scratch = gp_scratch_arena();
-    GPArray(wchar_t) wcs1 = gp_arr_new(
-        sizeof wcs1[0],
-        (GPAllocator*)scratch,
-        gp_internal_bytes_codepoint_count(s1, gp_str_length(s1)) + sizeof"");
-    GPArray(wchar_t) wcs2 = gp_arr_new(
-        sizeof wcs2[0],
-        (GPAllocator*)scratch,
-        gp_internal_bytes_codepoint_count(s2, s2_length) + sizeof"");
+    wchar_t* wcs1 = gp_mem_alloc(&scratch->base,
+        gp_s_wcs_capacity(gp_str_length(s1), fold) * sizeof wcs1[0]);
+    wchar_t* wcs2 = gp_mem_alloc(&scratch->base,
+        gp_s_wcs_capacity(s2_length, fold) * sizeof wcs2[0]);
 
     if (fold) {
-        gp_wcs_fold_utf8(&wcs1, s1, gp_str_length(s1), locale_code);
-        gp_wcs_fold_utf8(&wcs2, s2, s2_length,         locale_code);
+        gp_s_wcs_fold_utf8(wcs1, s1, gp_str_length(s1), locale);
+        gp_s_wcs_fold_utf8(wcs2, s2, s2_length,         locale);
     } else {
-        gp_s_utf8_to_wcs_very_unsafe(&wcs1, s1, gp_str_length(s1));
-        gp_s_utf8_to_wcs_very_unsafe(&wcs2, s2, s2_length);
+        gp_wcs_from_utf8_unsafe(wcs1, s1, gp_str_length(s1));
+        gp_wcs_from_utf8_unsafe(wcs2, s2, s2_length);
     }
 
     int result;
-    if (collate) {
-        if (locale_code == NULL)
-            result = wcscoll(wcs1, wcs2);
-        else
-            #if _WIN32
-            result = _wcscoll_l(wcs1, wcs2, gp_locale(locale_code));
-            #elif GP_HAS_LOCALE
-            result = wcscoll_l(wcs1, wcs2, gp_locale(locale_code));
-            #else
-            result = wcscoll(wcs1, wcs2);
-            #endif
-    } else {
-        result = wcscmp(wcs1, wcs2);
-    }
+    if (locale == NULL || locale->locale == (GPLocale)0)
+        result = wcscoll(wcs1, wcs2);
+    else
+        #if _WIN32
+        result = _wcscoll_l(wcs1, wcs2, locale->locale);
+        #elif GP_HAS_LOCALE
+        result = wcscoll_l(wcs1, wcs2, locale->locale);
+        #else
+        result = wcscoll(wcs1, wcs2);
+        #endif
 
-    gp_arena_rewind(scratch, gp_arr_allocation(wcs1));
+    gp_arena_rewind(scratch, wcs1);
     return !reverse ? result : -result;
 }
 
@@ -1861,1192 +4150,34 @@ int gp_str_compare(
 // Turns out that Windows, despite Microshits claims, is not very Unicode
 // capable. `towupper()` and relevants fail with a large set of codepoints even
 // with /utf-8, /D_UNICODE, and any locale settings. So here we are, reinventing
-// the wheel, once again, although I really don't feel like doing that, so I'll
-// just rip off some Newlib source code. I extended it to handle Unicode 15.1.0.
-
-// https://chromium.googlesource.com/native_client/nacl-newlib/+/refs/heads/main/newlib/libc/ctype
-
-/* Copyright (c) 2002 Red Hat Incorporated.
-   All rights reserved.
-   Redistribution and use in source and binary forms, with or without
-   modification, are permitted provided that the following conditions are met:
-     Redistributions of source code must retain the above copyright
-     notice, this list of conditions and the following disclaimer.
-     Redistributions in binary form must reproduce the above copyright
-     notice, this list of conditions and the following disclaimer in the
-     documentation and/or other materials provided with the distribution.
-     The name of Red Hat Incorporated may not be used to endorse
-     or promote products derived from this software without specific
-     prior written permission.
-   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
-   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
-   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
-   ARE DISCLAIMED.  IN NO EVENT SHALL RED HAT INCORPORATED BE LIABLE FOR ANY
-   DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
-   (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
-   LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
-   ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
-   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
-   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
+// the wheel, once again. Simple case mappings are looked up from a two-level
+// table generated by tools/casetablegen.c, see src/case_table.h.
 
-uint32_t gp_u32_to_upper(uint32_t c)
+static inline const int32_t* gp_s_case_deltas(uint32_t c)
 {
-    #ifdef GP_STATIC_ANALYSIS
-    char* old_locale = setlocale(LC_ALL, "C.UTF-8");
-    c = towupper(c);
-    setlocale(LC_ALL, old_locale);
-    return c;
-    #endif
-
-    /* Based on and tested against Unicode 5.2 */
-    /* Expression used to filter out the characters for the below code:
-       awk -F\; '{ if ( $13 != "" ) print $1; }' UnicodeData.txt
-    */
-    if (c < 0x100)
-      {
-        if (c == 0x00b5)
-  	return 0x039c;
-
-        if ((c >= 0x00e0 && c <= 0x00fe && c != 0x00f7) ||
-  	  (c >= 0x0061 && c <= 0x007a))
-  	return (c - 0x20);
-
-        if (c == 0xff)
-  	return 0x0178;
-
-        return c;
-      }
-    else if (c < 0x300)
-      {
-        if ((c >= 0x0101 && c <= 0x012f) ||
-  	  (c >= 0x0133 && c <= 0x0137) ||
-  	  (c >= 0x014b && c <= 0x0177) ||
-  	  (c >= 0x01df && c <= 0x01ef) ||
-  	  (c >= 0x01f9 && c <= 0x021f) ||
-  	  (c >= 0x0223 && c <= 0x0233) ||
-  	  (c >= 0x0247 && c <= 0x024f))
-  	{
-  	  if (c & 0x01)
-  	    return (c - 1);
-  	  return c;
-  	}
-        if ((c >= 0x013a && c <= 0x0148) ||
-  	  (c >= 0x01ce && c <= 0x01dc) ||
-  	  c == 0x023c || c == 0x0242)
-  	{
-  	  if (!(c & 0x01))
-  	    return (c - 1);
-  	  return c;
-  	}
-
-        if (c == 0x0131)
-  	return 0x0049;
-
-        if (c == 0x017a || c == 0x017c || c == 0x017e)
-  	return (c - 1);
-
-        if (c >= 0x017f && c <= 0x0292)
-  	{
-  	  wint_t k;
-  	  switch (c)
-  	    {
-  	    case 0x017f:
-  	      k = 0x0053;
-  	      break;
-  	    case 0x0180:
-  	      k = 0x0243;
-  	      break;
-  	    case 0x0183:
-  	      k = 0x0182;
-  	      break;
-  	    case 0x0185:
-  	      k = 0x0184;
-  	      break;
-  	    case 0x0188:
-  	      k = 0x0187;
-  	      break;
-  	    case 0x018c:
-  	      k = 0x018b;
-  	      break;
-  	    case 0x0192:
-  	      k = 0x0191;
-  	      break;
-  	    case 0x0195:
-  	      k = 0x01f6;
-  	      break;
-  	    case 0x0199:
-  	      k = 0x0198;
-  	      break;
-  	    case 0x019a:
-  	      k = 0x023d;
-  	      break;
-  	    case 0x019e:
-  	      k = 0x0220;
-  	      break;
-  	    case 0x01a1:
-  	    case 0x01a3:
-  	    case 0x01a5:
-  	    case 0x01a8:
-  	    case 0x01ad:
-  	    case 0x01b0:
-  	    case 0x01b4:
-  	    case 0x01b6:
-  	    case 0x01b9:
-  	    case 0x01bd:
-  	    case 0x01c5:
-  	    case 0x01c8:
-  	    case 0x01cb:
-  	    case 0x01f2:
-  	    case 0x01f5:
-  	      k = c - 1;
-  	      break;
-  	    case 0x01bf:
-  	      k = 0x01f7;
-  	      break;
-  	    case 0x01c6:
-  	    case 0x01c9:
-  	    case 0x01cc:
-  	      k = c - 2;
-  	      break;
-  	    case 0x01dd:
-  	      k = 0x018e;
-  	      break;
-  	    case 0x01f3:
-  	      k = 0x01f1;
-  	      break;
-  	    case 0x023f:
-  	      k = 0x2c7e;
-  	      break;
-  	    case 0x0240:
-  	      k = 0x2c7f;
-  	      break;
-  	    case 0x0250:
-  	      k = 0x2c6f;
-  	      break;
-  	    case 0x0251:
-  	      k = 0x2c6d;
-  	      break;
-  	    case 0x0252:
-  	      k = 0x2c70;
-  	      break;
-  	    case 0x0253:
-  	      k = 0x0181;
-  	      break;
-  	    case 0x0254:
-  	      k = 0x0186;
-  	      break;
-  	    case 0x0256:
-  	      k = 0x0189;
-  	      break;
-  	    case 0x0257:
-  	      k = 0x018a;
-  	      break;
-  	    case 0x0259:
-  	      k = 0x018f;
-  	      break;
-  	    case 0x025b:
-  	      k = 0x0190;
-  	      break;
-  	    case 0x0260:
-  	      k = 0x0193;
-  	      break;
-  	    case 0x0263:
-  	      k = 0x0194;
-  	      break;
-  	    case 0x0268:
-  	      k = 0x0197;
-  	      break;
-  	    case 0x0269:
-  	      k = 0x0196;
-  	      break;
-  	    case 0x026b:
-  	      k = 0x2c62;
-  	      break;
-  	    case 0x026f:
-  	      k = 0x019c;
-  	      break;
-  	    case 0x0271:
-  	      k = 0x2c6e;
-  	      break;
-  	    case 0x0272:
-  	      k = 0x019d;
-  	      break;
-  	    case 0x0275:
-  	      k = 0x019f;
-  	      break;
-  	    case 0x027d:
-  	      k = 0x2c64;
-  	      break;
-  	    case 0x0280:
-  	      k = 0x01a6;
-  	      break;
-  	    case 0x0283:
-  	      k = 0x01a9;
-  	      break;
-  	    case 0x0288:
-  	      k = 0x01ae;
-  	      break;
-  	    case 0x0289:
-  	      k = 0x0244;
-  	      break;
-  	    case 0x028a:
-  	      k = 0x01b1;
-  	      break;
-  	    case 0x028b:
-  	      k = 0x01b2;
-  	      break;
-  	    case 0x028c:
-  	      k = 0x0245;
-  	      break;
-  	    case 0x0292:
-  	      k = 0x01b7;
-  	      break;
-  	    default:
-  	      k = 0;
-  	    }
-  	  if (k != 0)
-  	    return k;
-  	}
-      }
-    else if (c < 0x0400)
-      {
-        wint_t k;
-        if (c >= 0x03ad && c <= 0x03af)
-        	return (c - 0x25);
-        if (c >= 0x03b1 && c <= 0x03cb && c != 0x03c2)
-  	return (c - 0x20);
-
-        if (c >= 0x03d9 && c <= 0x03ef && (c & 1))
-  	return (c - 1);
-        switch (c)
-  	{
-  	case 0x0345:
-  	  k = 0x0399;
-  	  break;
-  	case 0x0371:
-  	case 0x0373:
-  	case 0x0377:
-  	case 0x03f8:
-  	case 0x03fb:
-  	  k = c - 1;
-  	  break;
-  	case 0x037b:
-  	case 0x037c:
-  	case 0x037d:
-  	  k = c + 0x82;
-  	  break;
-  	case 0x03ac:
-  	  k = 0x0386;
-  	  break;
-  	case 0x03c2:
-  	  k = 0x03a3;
-  	  break;
-  	case 0x03cc:
-  	  k = 0x038c;
-  	  break;
-  	case 0x03cd:
-  	case 0x03ce:
-  	  k = c - 0x3f;
-  	  break;
-  	case 0x03d0:
-  	  k = 0x0392;
-  	  break;
-  	case 0x03d1:
-  	  k = 0x0398;
-  	  break;
-  	case 0x03d5:
-  	  k = 0x03a6;
-  	  break;
-  	case 0x03d6:
-  	  k = 0x03a0;
-  	  break;
-  	case 0x03d7:
-  	  k = 0x03cf;
-  	  break;
-  	case 0x03f0:
-  	  k = 0x039a;
-  	  break;
-  	case 0x03f1:
-  	  k = 0x03a1;
-  	  break;
-  	case 0x03f2:
-  	  k = 0x03f9;
-  	  break;
-  	case 0x03f5:
-  	  k = 0x0395;
-  	  break;
-  	default:
-  	  k = 0;
-  	}
-        if (k != 0)
-  	return k;
-      }
-    else if (c < 0x500)
-      {
-        if (c >= 0x0430 && c <= 0x044f)
-  	return (c - 0x20);
-
-        if (c >= 0x0450 && c <= 0x045f)
-  	return (c - 0x50);
-
-        if ((c >= 0x0461 && c <= 0x0481) ||
-  	  (c >= 0x048b && c <= 0x04bf) ||
-  	  (c >= 0x04d1 && c <= 0x04ff))
-  	{
-  	  if (c & 0x01)
-  	    return (c - 1);
-  	  return c;
-  	}
-
-        if (c >= 0x04c2 && c <= 0x04ce)
-  	{
-  	  if (!(c & 0x01))
-  	    return (c - 1);
-  	  return c;
-  	}
-
-        if (c == 0x04cf)
-        	return 0x04c0;
-        if (c >= 0x04f7 && c <= 0x04f9)
-  	return (c - 1);
-      }
-    else if (c < 0x0600)
-      {
-        if (c >= 0x0501 && c <= 0x0525 && (c & 1))
-        	return c - 1;
-        if (c >= 0x0561 && c <= 0x0586)
-  	return (c - 0x30);
-      }
-    else if (c < 0x1f00)
-      {
-        if (c == 0x1d79)
-        	return 0xa77d;
-        if (c == 0x1d7d)
-        	return 0x2c63;
-        if ((c >= 0x1e01 && c <= 0x1e95) ||
-  	  (c >= 0x1ea1 && c <= 0x1eff))
-  	{
-  	  if (c & 0x01)
-  	    return (c - 1);
-  	  return c;
-  	}
-
-        if (c == 0x1e9b)
-  	return 0x1e60;
-      }
-    else if (c < 0x2000)
-      {
-
-        if ((c >= 0x1f00 && c <= 0x1f07) ||
-  	  (c >= 0x1f10 && c <= 0x1f15) ||
-  	  (c >= 0x1f20 && c <= 0x1f27) ||
-  	  (c >= 0x1f30 && c <= 0x1f37) ||
-  	  (c >= 0x1f40 && c <= 0x1f45) ||
-  	  (c >= 0x1f60 && c <= 0x1f67) ||
-  	  (c >= 0x1f80 && c <= 0x1f87) ||
-  	  (c >= 0x1f90 && c <= 0x1f97) ||
-  	  (c >= 0x1fa0 && c <= 0x1fa7))
-  	return (c + 0x08);
-        if (c >= 0x1f51 && c <= 0x1f57 && (c & 0x01))
-  	return (c + 0x08);
-
-        if (c >= 0x1f70 && c <= 0x1ff3)
-  	{
-  	  wint_t k;
-  	  switch (c)
-  	    {
-  	    case 0x1fb0:
-  	      k = 0x1fb8;
-  	      break;
-  	    case 0x1fb1:
-  	      k = 0x1fb9;
-  	      break;
-  	    case 0x1f70:
-  	      k = 0x1fba;
-  	      break;
-  	    case 0x1f71:
-  	      k = 0x1fbb;
-  	      break;
-  	    case 0x1fb3:
-  	      k = 0x1fbc;
-  	      break;
-  	    case 0x1fbe:
-  	      k = 0x0399;
-  	      break;
-  	    case 0x1f72:
-  	      k = 0x1fc8;
-  	      break;
-  	    case 0x1f73:
-  	      k = 0x1fc9;
-  	      break;
-  	    case 0x1f74:
-  	      k = 0x1fca;
-  	      break;
-  	    case 0x1f75:
-  	      k = 0x1fcb;
-  	      break;
-  	    case 0x1fc3:
-  	      k = 0x1fcc;
-  	      break;
-  	    case 0x1fd0:
-  	      k = 0x1fd8;
-  	      break;
-  	    case 0x1fd1:
-  	      k = 0x1fd9;
-  	      break;
-  	    case 0x1f76:
-  	      k = 0x1fda;
-  	      break;
-  	    case 0x1f77:
-  	      k = 0x1fdb;
-  	      break;
-  	    case 0x1fe0:
-  	      k = 0x1fe8;
-  	      break;
-  	    case 0x1fe1:
-  	      k = 0x1fe9;
-  	      break;
-  	    case 0x1f7a:
-  	      k = 0x1fea;
-  	      break;
-  	    case 0x1f7b:
-  	      k = 0x1feb;
-  	      break;
-  	    case 0x1fe5:
-  	      k = 0x1fec;
-  	      break;
-  	    case 0x1f78:
-  	      k = 0x1ff8;
-  	      break;
-  	    case 0x1f79:
-  	      k = 0x1ff9;
-  	      break;
-  	    case 0x1f7c:
-  	      k = 0x1ffa;
-  	      break;
-  	    case 0x1f7d:
-  	      k = 0x1ffb;
-  	      break;
-  	    case 0x1ff3:
-  	      k = 0x1ffc;
-  	      break;
-  	    default:
-  	      k = 0;
-  	    }
-  	  if (k != 0)
-  	    return k;
-  	}
-      }
-    else if (c < 0x3000)
-      {
-        if (c == 0x214e)
-        	return 0x2132;
-        if (c == 0x2184)
-        	return 0x2183;
-        if (c >= 0x2170 && c <= 0x217f)
-  	return (c - 0x10);
-
-        if (c >= 0x24d0 && c <= 0x24e9)
-  	return (c - 0x1a);
-
-        if (c >= 0x2c30 && c <= 0x2c5e)
-  	return (c - 0x30);
-        if ((c >= 0x2c68 && c <= 0x2c6c && !(c & 1)) ||
-  	  (c >= 0x2c81 && c <= 0x2ce3 &&  (c & 1)) ||
-  	  c == 0x2c73 || c == 0x2c76 ||
-  	  c == 0x2cec || c == 0x2cee)
-        	return (c - 1);
-        if (c >= 0x2c81 && c <= 0x2ce3 && (c & 1))
-  	return (c - 1);
-        if (c >= 0x2d00 && c <= 0x2d25)
-        	return (c - 0x1c60);
-        switch (c)
-        	{
-  	case 0x2c61:
-  	  return 0x2c60;
-  	case 0x2c65:
-  	  return 0x023a;
-  	case 0x2c66:
-  	  return 0x023e;
-  	}
-      }
-    else if (c >= 0xa000 && c < 0xb000)
-      {
-        if (((c >= 0xa641 && c <= 0xa65f) ||
-             (c >= 0xa663 && c <= 0xa66d) ||
-             (c >= 0xa681 && c <= 0xa697) ||
-             (c >= 0xa723 && c <= 0xa72f) ||
-             (c >= 0xa733 && c <= 0xa76f) ||
-             (c >= 0xa77f && c <= 0xa787)) &&
-  	  (c & 1))
-  	return (c - 1);
-
-        if (c == 0xa77a || c == 0xa77c || c == 0xa78c)
-  	return (c - 1);
-      }
-    else
-      {
-        if (c >= 0xff41 && c <= 0xff5a)
-  	return (c - 0x20);
-
-        if (c >= 0x10428 && c <= 0x1044f)
-  	return (c - 0x28);
-
-        // Run the awk expression again with updated UnicodeData.txt and compare
-        // the diff with UnicodeData.txt version 5.2.0 to get the most recent
-        // functionality. The code below is based on Unicode 15.1.0.
-        //
-        // awk -F\; '{ if ( $13 != "" ) print $1; }' UnicodeData.txt
-
-        switch (c) {
-            case 0x025C: return 0xA7AB;
-            case 0x0261: return 0xA7AC;
-            case 0x0265: return 0xA78D;
-            case 0x0266: return 0xA7AA;
-            case 0x026A: return 0xA7AE;
-            case 0x026C: return 0xA7AD;
-            case 0x0282: return 0xA7C5;
-            case 0x0287: return 0xA7B1;
-            case 0x029D: return 0xA7B2;
-            case 0x029E: return 0xA7B0;
-            case 0x03F3: return 0x037F;
-            case 0x0527: return c - 1;
-            case 0x0529: return c - 1;
-            case 0x052B: return c - 1;
-            case 0x052D: return c - 1;
-            case 0x052F: return c - 1;
-            case 0x1C80: return 0x0412;
-            case 0x1C81: return 0x0414;
-            case 0x1C82: return 0x041E;
-            case 0x1C83: return 0x0421;
-            case 0x1C84: return 0x0422;
-            case 0x1C85: return 0x0422;
-            case 0x1C86: return 0x042A;
-            case 0x1C87: return 0x0462;
-            case 0x1C88: return 0xA64A;
-            case 0xA791: return 0xA790;
-            case 0xA793: return 0xA792;
-            case 0xA794: return 0xA7C4;
-            case 0xA7C8: return c - 1;
-            case 0xA7CA: return c - 1;
-            case 0xA7D1: return c - 1;
-            case 0xA7D7: return c - 1;
-            case 0xA7D9: return c - 1;
-            case 0xA7F6: return c - 1;
-            case 0xAB53: return 0xA7B3;
-            case 0x1D8E: return 0xA7C6;
-            case 0x10FD: return 0x1CBD;
-            case 0x10FE: return 0x1CBE;
-            case 0x10FF: return 0x1CBF;
-            case 0x2C5F: return 0x2C2F;
-            case 0x2CF3: return 0x2cF2;
-            case 0x2D27: return 0x10C7;
-            case 0x2D2D: return 0x10CD;
-            case 0xA661: return 0xA660;
-            case 0xA699: return 0xA698;
-            case 0xA69B: return 0xA69A;
-        }
+    if (c >= GP_CASE_TABLE_LIMIT)
+        return gp_case_deltas[0];
+    const size_t block = gp_case_stage1[c >> GP_CASE_BLOCK_SHIFT];
+    return gp_case_deltas[gp_case_stage2[block << GP_CASE_BLOCK_SHIFT | (c & GP_CASE_BLOCK_MASK)]];
+}
 
-        if  (0x10D0  <= c && c <= 0x10FA)   return c + (0x1C90 - 0x10D0);
-        if  (0x13F8  <= c && c <= 0x13FD)   return c - 8;
-        if ((0xA797  <= c && c <= 0xA7A9)   ||
-            (0xA7B5  <= c && c <= 0xA7C3))  return c - (c % 2);
-        if  (0xAB70  <= c && c <= 0xABBF)   return c - (0xAB70 - 0x13A0);
-        if ((0x10428 <= c && c <= 0x1044F)  ||
-            (0x104D8 <= c && c <= 0x104FB)) return c - 0x28;
-        if ((0x10597 <= c && c <= 0x105B9)  ||
-            (0x105BB == c || c == 0x105BC)) return c - 0x27;
-        if ((0x10CC0 <= c && c <= 0x10CF2)) return c - 0x40;
-        if ((0x118C0 <= c && c <= 0x118DF)  ||
-            (0x16E60 <= c && c <= 0x16E7F)) return c - 0x20;
-        if ((0x1E922 <= c && c <= 0x1E943)) return c - 0x22;
-      }
-    return c;
+uint32_t gp_u32_to_upper(uint32_t c)
+{
+    if (c < 0x80)
+        return 'a' <= c && c <= 'z' ? c - ('a' - 'A') : c;
+    return c + (uint32_t)gp_s_case_deltas(c)[0];
 }
 
 uint32_t gp_u32_to_lower(uint32_t c)
 {
-    #ifdef GP_STATIC_ANALYSIS
-    char* old_locale = setlocale(LC_ALL, "C.UTF-8");
-    c = towlower(c);
-    setlocale(LC_ALL, old_locale);
-    return c;
-    #endif
-
-    /* Based on and tested against Unicode 5.2 */
-    /* Expression used to filter out the characters for the below code:
-       awk -F\; '{ if ( $14 != "" ) print $1; }' UnicodeData.txt
-    */
-    if (c < 0x100)
-      {
-        if ((c >= 0x0041 && c <= 0x005a) ||
-  	  (c >= 0x00c0 && c <= 0x00d6) ||
-  	  (c >= 0x00d8 && c <= 0x00de))
-  	return (c + 0x20);
-        return c;
-      }
-    else if (c < 0x300)
-      {
-        if ((c >= 0x0100 && c <= 0x012e) ||
-  	  (c >= 0x0132 && c <= 0x0136) ||
-  	  (c >= 0x014a && c <= 0x0176) ||
-  	  (c >= 0x01de && c <= 0x01ee) ||
-  	  (c >= 0x01f8 && c <= 0x021e) ||
-  	  (c >= 0x0222 && c <= 0x0232))
-  	{
-  	  if (!(c & 0x01))
-  	    return (c + 1);
-  	  return c;
-  	}
-        if (c == 0x0130)
-  	return 0x0069;
-        if ((c >= 0x0139 && c <= 0x0147) ||
-  	  (c >= 0x01cd && c <= 0x01db))
-  	{
-  	  if (c & 0x01)
-  	    return (c + 1);
-  	  return c;
-  	}
-
-        if (c >= 0x178 && c <= 0x01f7)
-  	{
-  	  wint_t k;
-  	  switch (c)
-  	    {
-  	    case 0x0178:
-  	      k = 0x00ff;
-  	      break;
-  	    case 0x0179:
-  	    case 0x017b:
-  	    case 0x017d:
-  	    case 0x0182:
-  	    case 0x0184:
-  	    case 0x0187:
-  	    case 0x018b:
-  	    case 0x0191:
-  	    case 0x0198:
-  	    case 0x01a0:
-  	    case 0x01a2:
-  	    case 0x01a4:
-  	    case 0x01a7:
-  	    case 0x01ac:
-  	    case 0x01af:
-  	    case 0x01b3:
-  	    case 0x01b5:
-  	    case 0x01b8:
-  	    case 0x01bc:
-  	    case 0x01c5:
-  	    case 0x01c8:
-  	    case 0x01cb:
-  	    case 0x01cd:
-  	    case 0x01cf:
-  	    case 0x01d1:
-  	    case 0x01d3:
-  	    case 0x01d5:
-  	    case 0x01d7:
-  	    case 0x01d9:
-  	    case 0x01db:
-  	    case 0x01f2:
-  	    case 0x01f4:
-  	      k = c + 1;
-  	      break;
-  	    case 0x0181:
-  	      k = 0x0253;
-  	      break;
-  	    case 0x0186:
-  	      k = 0x0254;
-  	      break;
-  	    case 0x0189:
-  	      k = 0x0256;
-  	      break;
-  	    case 0x018a:
-  	      k = 0x0257;
-  	      break;
-  	    case 0x018e:
-  	      k = 0x01dd;
-  	      break;
-  	    case 0x018f:
-  	      k = 0x0259;
-  	      break;
-  	    case 0x0190:
-  	      k = 0x025b;
-  	      break;
-  	    case 0x0193:
-  	      k = 0x0260;
-  	      break;
-  	    case 0x0194:
-  	      k = 0x0263;
-  	      break;
-  	    case 0x0196:
-  	      k = 0x0269;
-  	      break;
-  	    case 0x0197:
-  	      k = 0x0268;
-  	      break;
-  	    case 0x019c:
-  	      k = 0x026f;
-  	      break;
-  	    case 0x019d:
-  	      k = 0x0272;
-  	      break;
-  	    case 0x019f:
-  	      k = 0x0275;
-  	      break;
-  	    case 0x01a6:
-  	      k = 0x0280;
-  	      break;
-  	    case 0x01a9:
-  	      k = 0x0283;
-  	      break;
-  	    case 0x01ae:
-  	      k = 0x0288;
-  	      break;
-  	    case 0x01b1:
-  	      k = 0x028a;
-  	      break;
-  	    case 0x01b2:
-  	      k = 0x028b;
-  	      break;
-  	    case 0x01b7:
-  	      k = 0x0292;
-  	      break;
-  	    case 0x01c4:
-  	    case 0x01c7:
-  	    case 0x01ca:
-  	    case 0x01f1:
-  	      k = c + 2;
-  	      break;
-  	    case 0x01f6:
-  	      k = 0x0195;
-  	      break;
-  	    case 0x01f7:
-  	      k = 0x01bf;
-  	      break;
-  	    default:
-  	      k = 0;
-  	    }
-  	  if (k != 0)
-  	    return k;
-  	}
-        else if (c == 0x0220)
-        	return 0x019e;
-        else if (c >= 0x023a && c <= 0x024e)
-        	{
-  	  wint_t k;
-  	  switch (c)
-  	    {
-  	    case 0x023a:
-  	      k = 0x2c65;
-  	      break;
-  	    case 0x023b:
-  	    case 0x0241:
-  	    case 0x0246:
-  	    case 0x0248:
-  	    case 0x024a:
-  	    case 0x024c:
-  	    case 0x024e:
-  	      k = c + 1;
-  	      break;
-  	    case 0x023d:
-  	      k = 0x019a;
-  	      break;
-  	    case 0x023e:
-  	      k = 0x2c66;
-  	      break;
-  	    case 0x0243:
-  	      k = 0x0180;
-  	      break;
-  	    case 0x0244:
-  	      k = 0x0289;
-  	      break;
-  	    case 0x0245:
-  	      k = 0x028c;
-  	      break;
-  	    default:
-  	      k = 0;
-  	    }
-  	  if (k != 0)
-  	    return k;
-  	}
-      }
-    else if (c < 0x0400)
-      {
-        if (c == 0x0370 || c == 0x0372 || c == 0x0376)
-        	return (c + 1);
-        if (c >= 0x0391 && c <= 0x03ab && c != 0x03a2)
-  	return (c + 0x20);
-        if (c >= 0x03d8 && c <= 0x03ee && !(c & 0x01))
-  	return (c + 1);
-        if (c >= 0x0386 && c <= 0x03ff)
-  	{
-  	  wint_t k;
-  	  switch (c)
-  	    {
-  	    case 0x0386:
-  	      k = 0x03ac;
-  	      break;
-  	    case 0x0388:
-  	      k = 0x03ad;
-  	      break;
-  	    case 0x0389:
-  	      k = 0x03ae;
-  	      break;
-  	    case 0x038a:
-  	      k = 0x03af;
-  	      break;
-  	    case 0x038c:
-  	      k = 0x03cc;
-  	      break;
-  	    case 0x038e:
-  	      k = 0x03cd;
-  	      break;
-  	    case 0x038f:
-  	      k = 0x03ce;
-  	      break;
-  	    case 0x03cf:
-  	      k = 0x03d7;
-  	      break;
-  	    case 0x03f4:
-  	      k = 0x03b8;
-  	      break;
-  	    case 0x03f7:
-  	      k = 0x03f8;
-  	      break;
-  	    case 0x03f9:
-  	      k = 0x03f2;
-  	      break;
-  	    case 0x03fa:
-  	      k = 0x03fb;
-  	      break;
-  	    case 0x03fd:
-  	      k = 0x037b;
-  	      break;
-  	    case 0x03fe:
-  	      k = 0x037c;
-  	      break;
-  	    case 0x03ff:
-  	      k = 0x037d;
-  	      break;
-  	    default:
-  	      k = 0;
-  	    }
-  	  if (k != 0)
-  	    return k;
-  	}
-      }
-    else if (c < 0x500)
-      {
-        if (c >= 0x0400 && c <= 0x040f)
-  	return (c + 0x50);
-
-        if (c >= 0x0410 && c <= 0x042f)
-  	return (c + 0x20);
-
-        if ((c >= 0x0460 && c <= 0x0480) ||
-  	  (c >= 0x048a && c <= 0x04be) ||
-  	  (c >= 0x04d0 && c <= 0x04fe))
-  	{
-  	  if (!(c & 0x01))
-  	    return (c + 1);
-  	  return c;
-  	}
-
-        if (c == 0x04c0)
-  	return 0x04cf;
-        if (c >= 0x04c1 && c <= 0x04cd)
-  	{
-  	  if (c & 0x01)
-  	    return (c + 1);
-  	  return c;
-  	}
-      }
-    else if (c < 0x1f00)
-      {
-        if ((c >= 0x0500 && c <= 0x050e) ||
-  	  (c >= 0x0510 && c <= 0x0524) ||
-  	  (c >= 0x1e00 && c <= 0x1e94) ||
-  	  (c >= 0x1ea0 && c <= 0x1ef8))
-  	{
-  	  if (!(c & 0x01))
-  	    return (c + 1);
-  	  return c;
-  	}
-
-        if (c >= 0x0531 && c <= 0x0556)
-  	return (c + 0x30);
-        if (c >= 0x10a0 && c <= 0x10c5)
-  	return (c + 0x1c60);
-        if (c == 0x1e9e)
-  	return 0x00df;
-        if (c >= 0x1efa && c <= 0x1efe && !(c & 0x01))
-  	return (c + 1);
-      }
-    else if (c < 0x2000)
-      {
-        if ((c >= 0x1f08 && c <= 0x1f0f) ||
-  	  (c >= 0x1f18 && c <= 0x1f1d) ||
-  	  (c >= 0x1f28 && c <= 0x1f2f) ||
-  	  (c >= 0x1f38 && c <= 0x1f3f) ||
-  	  (c >= 0x1f48 && c <= 0x1f4d) ||
-  	  (c >= 0x1f68 && c <= 0x1f6f) ||
-  	  (c >= 0x1f88 && c <= 0x1f8f) ||
-  	  (c >= 0x1f98 && c <= 0x1f9f) ||
-  	  (c >= 0x1fa8 && c <= 0x1faf))
-  	return (c - 0x08);
-        if (c >= 0x1f59 && c <= 0x1f5f)
-  	{
-  	  if (c & 0x01)
-  	    return (c - 0x08);
-  	  return c;
-  	}
-
-        if (c >= 0x1fb8 && c <= 0x1ffc)
-  	{
-  	  wint_t k;
-  	  switch (c)
-  	    {
-  	    case 0x1fb8:
-  	    case 0x1fb9:
-  	    case 0x1fd8:
-  	    case 0x1fd9:
-  	    case 0x1fe8:
-  	    case 0x1fe9:
-  	      k = c - 0x08;
-  	      break;
-  	    case 0x1fba:
-  	    case 0x1fbb:
-  	      k = c - 0x4a;
-  	      break;
-  	    case 0x1fbc:
-  	      k = 0x1fb3;
-  	      break;
-  	    case 0x1fc8:
-  	    case 0x1fc9:
-  	    case 0x1fca:
-  	    case 0x1fcb:
-  	      k = c - 0x56;
-  	      break;
-  	    case 0x1fcc:
-  	      k = 0x1fc3;
-  	      break;
-  	    case 0x1fda:
-  	    case 0x1fdb:
-  	      k = c - 0x64;
-  	      break;
-  	    case 0x1fea:
-  	    case 0x1feb:
-  	      k = c - 0x70;
-  	      break;
-  	    case 0x1fec:
-  	      k = 0x1fe5;
-  	      break;
-  	    case 0x1ff8:
-  	    case 0x1ff9:
-  	      k = c - 0x80;
-  	      break;
-  	    case 0x1ffa:
-  	    case 0x1ffb:
-  	      k = c - 0x7e;
-  	      break;
-  	    case 0x1ffc:
-  	      k = 0x1ff3;
-  	      break;
-  	    default:
-  	      k = 0;
-  	    }
-  	  if (k != 0)
-  	    return k;
-  	}
-      }
-    else if (c < 0x2c00)
-      {
-        if (c >= 0x2160 && c <= 0x216f)
-  	return (c + 0x10);
-        if (c >= 0x24b6 && c <= 0x24cf)
-  	return (c + 0x1a);
-
-        switch (c)
-        	{
-  	case 0x2126:
-  	  return 0x03c9;
-  	case 0x212a:
-  	  return 0x006b;
-  	case 0x212b:
-  	  return 0x00e5;
-  	case 0x2132:
-  	  return 0x214e;
-  	case 0x2183:
-  	  return 0x2184;
-  	}
-      }
-    else if (c < 0x2d00)
-      {
-        if (c >= 0x2c00 && c <= 0x2c2e)
-  	return (c + 0x30);
-        if (c >= 0x2c80 && c <= 0x2ce2 && !(c & 0x01))
-  	return (c + 1);
-        switch (c)
-        	{
-  	case 0x2c60:
-  	  return 0x2c61;
-  	case 0x2c62:
-  	  return 0x026b;
-  	case 0x2c63:
-  	  return 0x1d7d;
-  	case 0x2c64:
-  	  return 0x027d;
-  	case 0x2c67:
-  	case 0x2c69:
-  	case 0x2c6b:
-  	case 0x2c72:
-  	case 0x2c75:
-  	case 0x2ceb:
-  	case 0x2ced:
-  	  return c + 1;
-  	case 0x2c6d:
-  	  return 0x0251;
-  	case 0x2c6e:
-  	  return 0x0271;
-  	case 0x2c6f:
-  	  return 0x0250;
-  	case 0x2c70:
-  	  return 0x0252;
-  	case 0x2c7e:
-  	  return 0x023f;
-  	case 0x2c7f:
-  	  return 0x0240;
-  	}
-      }
-    else if (c >= 0xa600 && c < 0xa800)
-      {
-        if ((c >= 0xa640 && c <= 0xa65e) ||
-  	  (c >= 0xa662 && c <= 0xa66c) ||
-  	  (c >= 0xa680 && c <= 0xa696) ||
-  	  (c >= 0xa722 && c <= 0xa72e) ||
-  	  (c >= 0xa732 && c <= 0xa76e) ||
-  	  (c >= 0xa77f && c <= 0xa786))
-  	{
-  	  if (!(c & 1))
-  	    return (c + 1);
-  	  return c;
-  	}
-        switch (c)
-        	{
-  	case 0xa779:
-  	case 0xa77b:
-  	case 0xa77e:
-  	case 0xa78b:
-  	  return (c + 1);
-  	case 0xa77d:
-  	  return 0x1d79;
-  	}
-      }
-    else
-      {
-        if (c >= 0xff21 && c <= 0xff3a)
-  	return (c + 0x20);
-
-        if (c >= 0x10400 && c <= 0x10427)
-  	return (c + 0x28);
-
-        // Run the awk expression again with updated UnicodeData.txt and compare
-        // the diff with UnicodeData.txt version 5.2.0 to get the most recent
-        // functionality. The code below is based on Unicode 15.1.0.
-        //
-        // awk -F\; '{ if ( $14 != "" ) print $1; }' UnicodeData.txt
-
-        switch (c) {
-            case 0x037F: return 0x03F3;
-            case 0x10C7: return 0x2D27;
-            case 0x10CD: return 0x2D2D;
-            case 0x1CBD: return 0x10FD;
-            case 0x1CBE: return 0x10FE;
-            case 0x1CBF: return 0x10FF;
-            case 0x2C2F: return 0x2C5F;
-            case 0x2CF2: return 0x2CF3;
-            case 0xA660: return 0xA661;
-            case 0xA698: return 0xA699;
-            case 0xA69A: return 0xA69B;
-            case 0xA78D: return 0x0265;
-            case 0xA790: return 0xA791;
-            case 0xA792: return 0xA793;
-            case 0xA7C5: return 0x0282;
-            case 0xA7C6: return 0x1D8E;
-            case 0xA7C7: return 0xA7C8;
-            case 0xA7C9: return 0xA7CA;
-            case 0xA7D0: return 0xA7D0;
-            case 0xA7D6: return 0xA7D7;
-            case 0xA7D8: return 0xA7D9;
-            case 0xA7F5: return 0xA7F6;
-            case 0xA7AA: return 0x0266;
-            case 0xA7AB: return 0x025C;
-            case 0xA7AC: return 0x0261;
-            case 0xA7AD: return 0x026C;
-            case 0xA7AE: return 0x026A;
-            case 0xA7B0: return 0x029E;
-            case 0xA7B1: return 0x0287;
-            case 0xA7B2: return 0x029D;
-            case 0xA7B3: return 0xAB53;
-            case 0xA7B4: return 0xA7B5;
-        }
-
-        if ((0x0526  <= c && c <= 0x052E)   && !(c % 2)) return c + 1;
-        if  (0x13A0  <= c && c <= 0x13EF)   return c + (0xAB70 - 0x13A0);
-        if  (0x13F0  <= c && c <= 0x13F5)   return c + 8;
-        if  (0x1C90  <= c && c <= 0x1CBA)   return c + (0x1C90 - 0x10D0);
-        if ((0xA796  <= c && c <= 0xA7A8)   ||
-            (0xA7B6  <= c && c <= 0xA7C4))  return c + !(c % 2);
-        if ((0x10400 <= c && c <= 0x10427)  ||
-            (0x104B0 <= c && c <= 0x104D3)) return c + 0x28;
-        if ((0x10570 <= c && c <= 0x10592)  ||
-            (0x10594 == c || c == 0x10595)) return c + 0x27;
-        if ((0x10C80 <= c && c <= 0x10CB2)) return c + 0x40;
-        if ((0x118A0 <= c && c <= 0x118BF)  ||
-            (0x16E40 <= c && c <= 0x16E5F)) return c + 0x20;
-        if ((0x1E900 <= c && c <= 0x1E921)) return c + 0x22;
-      }
-    return c;
+    if (c < 0x80)
+        return 'A' <= c && c <= 'Z' ? c + ('a' - 'A') : c;
+    return c + (uint32_t)gp_s_case_deltas(c)[1];
 }
 
 uint32_t gp_u32_to_title(uint32_t c)
 {
-    // Code below is based on differences between `stc` (simple titlecase) and
-    // `suc` (simple uppercase) fields in preparsed UnicodeData.txt.
-    //
-    // https://raw.githubusercontent.com/unicode-org/icu/main/icu4c/source/data/unidata/ppucd.txt
-
-    if (c < 0x100)
-    {
-        if (c == 0x00b5)
-	    return 0x039c;
-
-        if ((c >= 0x00e0 && c <= 0x00fe && c != 0x00f7) ||
-	    (c >= 0x0061 && c <= 0x007a))
-	    return (c - 0x20);
-
-        if (c == 0xff)
-	    return 0x0178;
-
-        return c;
-    }
-    if (0x01C4 <= c && c <= 0x01CC)
-    {
-        if (c < 0x01C7)
-            return 0x01C5;
-        else if (c < 0x01CA)
-            return 0x01C8;
-        else
-            return 0x01CB;
-    }
-    if (0x01F1 <= c && c <= 0x01F3)
-    {
-        return 0x01F2;
-    }
-    if ((0x10D0 <= c && c <= 0x10FA) ||
-        (0x10FD <= c && c <= 0x10FF))
-    {
-        return c;
-    }
-    return gp_u32_to_upper(c);
+    if (c < 0x80)
+        return 'a' <= c && c <= 'z' ? c - ('a' - 'A') : c;
+    return c + (uint32_t)gp_s_case_deltas(c)[2];
 }
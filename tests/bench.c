@@ -71,6 +71,10 @@ void gp_bench_ignore(void** output, void* input)
 // Functions defined here must be registered using GP_BENCH_FUNCTIONS macro
 // below to be benchmarked.
 
+// Define GP_BENCH_CASE_MAPPING to benchmark case mapping instead of ASCII
+// trimming, e.g. by adding -DGP_BENCH_CASE_MAPPING to the bench target.
+#ifndef GP_BENCH_CASE_MAPPING
+
 void ascii_trim(
     void** output,
     void* _str)
@@ -129,6 +133,58 @@ void ascii_trim_unroll(
     *output = str;
 }
 
+#else // GP_BENCH_CASE_MAPPING
+
+// Case mapping: gp_str_to_upper() uses table lookups and an ASCII fast path.
+// Compare against mapping every codepoint through the full decode, lookup,
+// encode path with the table and with the old if/switch chains.
+
+#include "bench_old_case_mapping.h"
+uint32_t gp_u32_to_upper(uint32_t);
+
+void to_upper(
+    void** output,
+    void* input)
+{
+    (void)input;
+    gp_str_to_upper((GPString*)output);
+}
+
+static void to_upper_with(
+    uint32_t (*map)(uint32_t),
+    GPString* out,
+    GPString str)
+{
+    gp_str_set(*out)->length = 0;
+    for (size_t i = 0, bytes_read; i < gp_str_length(str); i += bytes_read) {
+        uint32_t decoding;
+        bool is_valid;
+        char encoding[4];
+        bytes_read = gp_utf8_decode(&decoding, str, gp_str_length(str), i, &is_valid);
+        if (is_valid)
+            decoding = map(decoding);
+        gp_str_append(out, encoding, gp_utf8_encode(encoding, decoding, &is_valid));
+    }
+}
+
+void to_upper_per_codepoint(
+    void** output,
+    void* input)
+{
+    GP_NOINLINE;
+    to_upper_with(gp_u32_to_upper, (GPString*)output, input);
+}
+
+void to_upper_per_codepoint_old(
+    void** output,
+    void* input)
+{
+    GP_NOINLINE;
+    to_upper_with(old_u32_to_upper, (GPString*)output, input);
+}
+
+#endif // GP_BENCH_CASE_MAPPING
+
 // END THROWAWAY functions to be benchmarked
 // ----------------------------------------------------------------------------
 
@@ -136,7 +192,11 @@ void ascii_trim_unroll(
 // REGISTER FUNCTIONS TO BE BENCHMARKED HERE
 //
 // List your functions in a comma separated list here to benchmark them.
+#ifndef GP_BENCH_CASE_MAPPING
 #define GP_BENCH_FUNCTIONS ascii_trim, ascii_trim_unroll
+#else
+#define GP_BENCH_FUNCTIONS to_upper, to_upper_per_codepoint, to_upper_per_codepoint_old
+#endif
 // ----------------------------------------------------------------------------
 
 void gp_bench_prepare_global_data(
@@ -175,6 +235,7 @@ void* gp_bench_prepare_arguments(
     // return value will be passed as input to benchmarked functions and to
     // gp_bench_confirm_results().
 
+    #ifndef GP_BENCH_CASE_MAPPING
     GPString str = gp_str_new(allocator, 0);
     const size_t max = 16;
     size_t seg_length;
@@ -196,6 +257,23 @@ void* gp_bench_prepare_arguments(
             &GP_WHITESPACE[gp_random_range(random_state, 0, strlen(GP_WHITESPACE))],
             1);
 
+    #else
+    // Mostly ASCII with some Latin, Greek, Cyrillic, and CJK.
+    static const char*const words[] = {
+        "the ", "quick ", "brown ", "fox ", "jumps ", "over ", "lazy ", "dog, ",
+        "äiti ", "straße ", "ωμέγα ", "привет ", "水 ", "Ǆemal ", "ǉubav " };
+    GPString str = gp_str_new(allocator, 0);
+    const size_t words_length = gp_random_range(random_state, 1, 64);
+    for (size_t i = 0; i < words_length; ++i) {
+        const char* word = words[gp_random_range(random_state, 0, sizeof words / sizeof words[0])];
+        gp_str_append(&str, word, strlen(word));
+    }
+    for (size_t i = 0; i < outputs_length; ++i) {
+        GPString copy = gp_str_new(allocator, gp_str_length(str));
+        gp_str_copy(&copy, str, gp_str_length(str));
+        outputs[i] = copy;
+    }
+    #endif
     return str;
 
     // END THROWAWAY argument preparation
@@ -314,7 +392,7 @@ int main(void)
         exit(EXIT_FAILURE);
     }
 
-    GPRandomState rs = gp_random_state(time(NULL));
+    GPRandomState rs = gp_random_state_seed(time(NULL), 0);
     GPArena* arena = gp_arena_new(NULL, 1024*1024); // size is arbitrary
     const size_t outputs_length = GP_BENCH_FTABLE_LENGTH - 1; // subtract no-op
     static void* outputs[sizeof ftable / sizeof ftable[0]];
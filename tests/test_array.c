@@ -4,6 +4,7 @@
 
 #include <gpc/assert.h>
 #include <gpc/io.h>
+#include <gpc/utils.h>
 #include <gpc/array.h> // note: source included after the tests so we can get access to shadowing macros
 
 #define arr_assert_eq(ARR, CARR, CARR_LENGTH, ...) do { \
@@ -202,6 +203,38 @@ int main(void)
             gp_arr_filter(sizeof arr2[0], &arr2, NULL, 0, FPTR2PTR(more_than_5));
             arr_assert_eq(arr2, ((int[]){6}), 1);
         }
+
+        gp_test("Sort");
+        {
+            int compare_ints(const int* a, const int* b);
+            int compare_ints_void(const void* a, const void* b);
+            GPRandomState rs = gp_random_state_seed(42, 0);
+            GPArray(int) arr      = gp_arr_new(sizeof arr[0],      &scope->base, 100000);
+            GPArray(int) expected = gp_arr_new(sizeof expected[0], &scope->base, 100000);
+
+            const size_t lengths[] = { 0, 1, 2, 17, 100, 1000, 100000 };
+            for (size_t i = 0; i < CARR_LEN(lengths); ++i)
+            for (size_t pattern = 0; pattern < 4; ++pattern)
+            for (size_t threads = 1; threads <= 5; threads += 4)
+            {
+                gp_arr_set(arr)->length = lengths[i];
+                for (size_t j = 0; j < lengths[i]; ++j) switch (pattern) {
+                    case 0: arr[j] = (int)gp_random(&rs);                     break;
+                    case 1: arr[j] = (int)gp_random_bound(&rs, 4);            break; // duplicates
+                    case 2: arr[j] = (int)j;                                  break; // sorted
+                    case 3: arr[j] = (int)(lengths[i] - j) + (j % 8 == 0);    break; // reversed and noisy
+                }
+                gp_arr_copy(sizeof expected[0], &expected, arr, gp_arr_length(arr));
+                qsort(expected, gp_arr_length(expected), sizeof expected[0], compare_ints_void);
+
+                if (threads == 1)
+                    gp_arr_sort(sizeof arr[0], arr, FPTR2PTR(compare_ints));
+                else
+                    gp_arr_sort_parallel(sizeof arr[0], arr, FPTR2PTR(compare_ints), threads);
+                gp_assert(memcmp(arr, expected, gp_arr_length(arr) * sizeof arr[0]) == 0,
+                    lengths[i], pattern, threads);
+            }
+        }
         gp_end((GPScope*)scope);
     } // gp_suite("Array manipulation");
 
@@ -267,6 +300,8 @@ void* append(void* result, const void*_element)
     ((char*)result)[length] = '\0';
     return strcat(strcat(result, element), " ");
 }
+int compare_ints(const int* a, const int* b) { return (*a > *b) - (*a < *b); }
+int compare_ints_void(const void* a, const void* b) { return compare_ints(a, b); }
 bool even(const int* element) { return !(*element % 2); }
 bool more_than_5(const void* element) { return *(int*)element > 5; }
 
@@ -90,6 +90,75 @@ int main(void)
             gp_expect(len == strlen(buf2));
         }
 
+        gp_test("All lengths");
+        {
+            unsigned long long x = 1;
+            for (size_t i = 1; i <= 20; ++i, x *= 10)
+            {
+                sprintf(buf2, "%llu", x - 1);
+                len = pf_utoa(-1, buf, x - 1);
+                expect_str(buf, buf2);
+                gp_expect(len == strlen(buf2), (len));
+
+                sprintf(buf2, "%llu", x);
+                len = pf_utoa(-1, buf, x);
+                if (i < 20) {
+                    expect_str(buf, buf2);
+                    gp_expect(len == strlen(buf2), (len));
+                }
+            }
+        }
+
+        gp_test("128-bit");
+        {
+            len = pf_u128toa(-1, buf, gp_uint128(0, 12345));
+            expect_str(buf, "12345");
+            gp_expect(len == 5, (len));
+
+            len = pf_u128toa(-1, buf, gp_uint128(1, 0));
+            expect_str(buf, "18446744073709551616");
+            gp_expect(len == strlen("18446744073709551616"), (len));
+
+            len = pf_u128toa(-1, buf, gp_uint128(0x8AC7230489E80000, 0)); // 10^19 * 2^64
+            expect_str(buf, "184467440737095516160000000000000000000");
+            gp_expect(len == strlen("184467440737095516160000000000000000000"), (len));
+
+            len = pf_u128toa(-1, buf, gp_uint128(UINT64_MAX, UINT64_MAX));
+            expect_str(buf, "340282366920938463463374607431768211455");
+            gp_expect(len == strlen("340282366920938463463374607431768211455"), (len));
+
+            len = pf_i128toa(-1, buf, gp_int128(INT64_MIN, 0));
+            expect_str(buf, "-170141183460469231731687303715884105728");
+            gp_expect(len == strlen("-170141183460469231731687303715884105728"), (len));
+
+            strcpy(buf, "XXXXXX");
+            len = pf_u128toa(3, buf, gp_uint128(1, 0));
+            expect_str(buf, "184XXX");
+            gp_expect(len == strlen("18446744073709551616"), (len));
+        }
+
+        gp_test("Arrays");
+        {
+            const int64_t is[] = { -1, 0, 1234567890123, INT64_MIN };
+            len = pf_itoa_array(-1, buf, is, 4, ", ");
+            expect_str(buf, "-1, 0, 1234567890123, -9223372036854775808");
+            gp_expect(len == strlen(buf), (len));
+
+            const uint64_t us[] = { 5, UINT64_MAX };
+            len = pf_utoa_array(-1, buf, us, 2, ";");
+            expect_str(buf, "5;18446744073709551615");
+            gp_expect(len == strlen(buf), (len));
+
+            len = pf_utoa_array(-1, buf, us, 0, ";");
+            expect_str(buf, "");
+            gp_expect(len == 0, (len));
+
+            strcpy(buf, "XXXXXXXXXX");
+            len = pf_itoa_array(6, buf, is, 4, ", ");
+            expect_str(buf, "-1, 0,XXXX");
+            gp_expect(len == strlen("-1, 0, 1234567890123, -9223372036854775808"), (len));
+        }
+
         gp_test("Limit max characters");
         {
             strcpy(buf, "XXXXXX");
@@ -720,6 +789,253 @@ int main(void)
             EXPECT_EXP(1e+83, 1, "1.0e+83");
         }
     }
+
+    gp_suite("String to number conversions");
+    {
+        size_t length;
+        bool out_of_range;
+
+        gp_test("Integers");
+        {
+            long long i = 0;
+            length = pf_atoi(strlen("-1234567890123x"), "-1234567890123x", &i, &out_of_range);
+            gp_expect(length == strlen("-1234567890123"), (length));
+            gp_expect(i == -1234567890123, (i));
+            gp_expect( ! out_of_range);
+
+            length = pf_atoi(strlen("-9223372036854775808"), "-9223372036854775808", &i, &out_of_range);
+            gp_expect(i == LLONG_MIN && ! out_of_range, (i));
+
+            length = pf_atoi(strlen("9223372036854775808"), "9223372036854775808", &i, &out_of_range);
+            gp_expect(length == strlen("9223372036854775808"), (length));
+            gp_expect(i == LLONG_MAX && out_of_range, (i));
+
+            i = 3;
+            gp_expect(pf_atoi(strlen("-x"), "-x", &i, NULL) == 0);
+            gp_expect(pf_atoi(0, "", &i, NULL) == 0);
+            gp_expect(i == 3);
+
+            gp_expect(pf_atoi(3, "12345", &i, NULL) == 3 && i == 123, (i));
+
+            unsigned long long u = 0;
+            length = pf_atou(strlen("+000018446744073709551615"), "+000018446744073709551615", &u, &out_of_range);
+            gp_expect(length == strlen("+000018446744073709551615"), (length));
+            gp_expect(u == ULLONG_MAX && ! out_of_range, (u));
+
+            pf_atou(strlen("18446744073709551616"), "18446744073709551616", &u, &out_of_range);
+            gp_expect(u == ULLONG_MAX && out_of_range, (u));
+            gp_expect(pf_atou(strlen("-1"), "-1", &u, NULL) == 0);
+        }
+
+        gp_test("128-bit integers");
+        {
+            GPUInt128 u;
+            const char* max = "340282366920938463463374607431768211455";
+            length = pf_atou128(strlen(max), max, &u, &out_of_range);
+            gp_expect(length == strlen(max), (length));
+            gp_expect(gp_uint128_equal(u, gp_uint128(UINT64_MAX, UINT64_MAX)) && ! out_of_range);
+
+            pf_atou128(strlen("340282366920938463463374607431768211456"), "340282366920938463463374607431768211456", &u, &out_of_range);
+            gp_expect(gp_uint128_equal(u, gp_uint128(UINT64_MAX, UINT64_MAX)) && out_of_range);
+
+            pf_atou128(strlen("18446744073709551616"), "18446744073709551616", &u, NULL);
+            gp_expect(gp_uint128_equal(u, gp_uint128(1, 0)));
+
+            GPInt128 i;
+            const char* min = "-170141183460469231731687303715884105728";
+            length = pf_atoi128(strlen(min), min, &i, &out_of_range);
+            gp_expect(length == strlen(min), (length));
+            gp_expect(gp_int128_equal(i, GP_INT128_MIN) && ! out_of_range);
+
+            pf_atoi128(strlen(min) - 1, min + 1, &i, &out_of_range);
+            gp_expect(gp_int128_equal(i, GP_INT128_MAX) && out_of_range);
+        }
+
+        gp_test("Floats");
+        {
+            double f = 0.;
+            length = pf_atod(strlen("-1.5e3x"), "-1.5e3x", &f, &out_of_range);
+            gp_expect(length == strlen("-1.5e3") && f == -1.5e3 && ! out_of_range, (length), (f));
+
+            gp_expect(pf_atod(strlen(".5e"), ".5e", &f, NULL) == 2 && f == .5, (f));
+            gp_expect(pf_atod(strlen("5.e+"), "5.e+", &f, NULL) == 2 && f == 5., (f));
+            gp_expect(pf_atod(strlen("0.1"), "0.1", &f, NULL) == 3 && f == 0.1, (f));
+            gp_expect(pf_atod(strlen("-0"), "-0", &f, NULL) == 2 && f == 0. && signbit(f));
+            gp_expect(pf_atod(strlen("1.7976931348623157e308"), "1.7976931348623157e308", &f, NULL) && f == 1.7976931348623157e308);
+            gp_expect(pf_atod(strlen("4.9406564584124654e-324"), "4.9406564584124654e-324", &f, NULL) && f == 4.9406564584124654e-324);
+            gp_expect(pf_atod(strlen("9007199254740993"), "9007199254740993", &f, NULL) && f == 9007199254740992., (f)); // halfway
+            gp_expect(pf_atod(strlen("9007199254740993.0000000000000000000001"), "9007199254740993.0000000000000000000001", &f, NULL)
+                && f == 9007199254740994., (f));
+
+            pf_atod(strlen("1e309"), "1e309", &f, &out_of_range);
+            gp_expect(isinf(f) && out_of_range);
+            pf_atod(strlen("-1e-400"), "-1e-400", &f, &out_of_range);
+            gp_expect(f == 0. && signbit(f) && out_of_range);
+
+            gp_expect(pf_atod(strlen("-Infinity"), "-Infinity", &f, NULL) == strlen("-Infinity") && isinf(f) && f < 0);
+            gp_expect(pf_atod(strlen("inFINite"), "inFINite", &f, NULL) == strlen("inf") && isinf(f));
+            gp_expect(pf_atod(strlen("NaN"), "NaN", &f, NULL) == strlen("NaN") && isnan(f));
+
+            f = 3.;
+            gp_expect(pf_atod(strlen("."), ".", &f, NULL) == 0);
+            gp_expect(pf_atod(strlen("-e5"), "-e5", &f, NULL) == 0);
+            gp_expect(f == 3.);
+        }
+
+        gp_test("Round trip");
+        {
+            for (const struct test_case* tc = all_powers_of_ten;
+                tc < all_powers_of_ten + all_powers_of_ten_length;
+                tc++)
+            {
+                double f;
+                gp_assert(pf_atod(strlen(tc->fixed_string), tc->fixed_string, &f, NULL) == strlen(tc->fixed_string));
+                gp_assert(f == tc->value, (tc->fixed_string));
+                gp_assert(pf_atod(strlen(tc->exp_string), tc->exp_string, &f, NULL) == strlen(tc->exp_string));
+                gp_assert(f == tc->value, (tc->exp_string));
+            }
+            for (const struct test_case* tc = all_binary_exponents;
+                tc < all_binary_exponents + all_binary_exponents_length;
+                tc++)
+            {
+                double f;
+                gp_assert(pf_atod(strlen(tc->fixed_string), tc->fixed_string, &f, NULL) == strlen(tc->fixed_string));
+                gp_assert(f == tc->value, (tc->fixed_string));
+                gp_assert(pf_atod(strlen(tc->exp_string), tc->exp_string, &f, NULL) == strlen(tc->exp_string));
+                gp_assert(f == tc->value, (tc->exp_string));
+
+                char buf[32];
+                PFFormatSpecifier fmt = { .conversion_format = 'e', .precision = { .width = 16, .option = PF_SOME } };
+                const size_t shortest_length = pf_strfromd(buf, sizeof buf, fmt, tc->value);
+                gp_assert(pf_atod(shortest_length, buf, &f, NULL) == shortest_length);
+                gp_assert(f == tc->value, (buf));
+            }
+        }
+    } // gp_suite("String to number conversions");
+
+    gp_suite("Shortest round trip");
+    {
+        char buf[64];
+        size_t length;
+
+        gp_test("Basic");
+        {
+            length = pf_rtoa(sizeof buf, buf, 0.1);
+            expect_str(buf, "0.1");
+            gp_expect(length == strlen("0.1"), (length));
+
+            pf_rtoa(sizeof buf, buf, 0.);
+            expect_str(buf, "0");
+            pf_rtoa(sizeof buf, buf, -0.);
+            expect_str(buf, "-0");
+            pf_rtoa(sizeof buf, buf, 1./3.);
+            expect_str(buf, "0.3333333333333333");
+            pf_rtoa(sizeof buf, buf, 120.);
+            expect_str(buf, "120");
+            pf_rtoa(sizeof buf, buf, -0.00012);
+            expect_str(buf, "-0.00012");
+            pf_rtoa(sizeof buf, buf, 0.000012);
+            expect_str(buf, "1.2e-05");
+            pf_rtoa(sizeof buf, buf, 1e16);
+            expect_str(buf, "10000000000000000");
+            pf_rtoa(sizeof buf, buf, 1e17);
+            expect_str(buf, "1e+17");
+            pf_rtoa(sizeof buf, buf, 1.7976931348623157e308);
+            expect_str(buf, "1.7976931348623157e+308");
+            pf_rtoa(sizeof buf, buf, 4.9406564584124654e-324);
+            expect_str(buf, "5e-324");
+            pf_rtoa(sizeof buf, buf, -INFINITY);
+            expect_str(buf, "-inf");
+            pf_rtoa(sizeof buf, buf, NAN);
+            expect_str(buf, "nan");
+
+            memset(buf, 'x', sizeof buf);
+            length = pf_rtoa(4, buf, 3.14159);
+            gp_expect(length == strlen("3.14159") && memcmp(buf, "3.14x", 5) == 0, (length));
+        }
+
+        gp_test("Float");
+        {
+            length = pf_hrtoa(sizeof buf, buf, 0.1f);
+            expect_str(buf, "0.1");
+            gp_expect(length == strlen("0.1"), (length));
+
+            pf_hrtoa(sizeof buf, buf, 1.f/3.f);
+            expect_str(buf, "0.33333334");
+            pf_hrtoa(sizeof buf, buf, 16777216.f);
+            expect_str(buf, "16777216");
+            pf_hrtoa(sizeof buf, buf, 1e9f);
+            expect_str(buf, "1e+09");
+            pf_hrtoa(sizeof buf, buf, 3.4028235e38f);
+            expect_str(buf, "3.4028235e+38");
+            pf_hrtoa(sizeof buf, buf, 1.4e-45f);
+            expect_str(buf, "1e-45");
+
+            uint32_t bits = 1;
+            for (size_t i = 0; i < 100000; i++)
+            {
+                bits = bits * 1664525 + 1013904223;
+                float f;
+                memcpy(&f, &bits, sizeof f);
+                if (isnan(f) || isinf(f))
+                    continue;
+                pf_hrtoa(sizeof buf, buf, f);
+                gp_assert(strtof(buf, NULL) == f, (buf));
+            }
+        }
+
+        gp_test("Round trip");
+        {
+            for (const struct test_case* tc = all_binary_exponents;
+                tc < all_binary_exponents + all_binary_exponents_length;
+                tc++)
+            {
+                double f;
+                length = pf_rtoa(sizeof buf, buf, tc->value);
+                gp_assert(pf_atod(length, buf, &f, NULL) == length);
+                gp_assert(f == tc->value, (buf));
+            }
+            for (const struct test_case* tc = all_powers_of_ten;
+                tc < all_powers_of_ten + all_powers_of_ten_length;
+                tc++)
+            {   // Shortest representation of a power of ten is a single digit
+                length = pf_rtoa(sizeof buf, buf, tc->value);
+                const char* end = memchr(buf, 'e', length);
+                size_t nonzero_digits = 0;
+                for (const char* c = buf; c < (end != NULL ? end : buf + length); c++)
+                    nonzero_digits += '1' <= *c && *c <= '9';
+                gp_assert(nonzero_digits == 1, (buf));
+            }
+        }
+
+        #if GP_HAS_LONG_DOUBLE
+        gp_test("Long double");
+        {
+            pf_Lrtoa(sizeof buf, buf, 0.1L);
+            expect_str(buf, "0.1");
+            pf_Lrtoa(sizeof buf, buf, -0.L);
+            expect_str(buf, "-0");
+            pf_Lrtoa(sizeof buf, buf, 1e100L);
+            expect_str(buf, "1e+100");
+            pf_Lrtoa(sizeof buf, buf, -2.5L);
+            expect_str(buf, "-2.5");
+
+            uint64_t seed = 1;
+            for (size_t i = 0; i < 10000; i++)
+            {
+                seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+                const int exponent = (int)(seed >> 32) % 2000 - 1000;
+                const long double f = ldexpl((long double)(seed | 1), exponent);
+                pf_Lrtoa(sizeof buf, buf, f);
+                gp_assert(strtold(buf, NULL) == f, (buf));
+            }
+            pf_Lrtoa(sizeof buf, buf, LDBL_MAX);
+            gp_expect(strtold(buf, NULL) == LDBL_MAX, (buf));
+            pf_Lrtoa(sizeof buf, buf, LDBL_MIN);
+            gp_expect(strtold(buf, NULL) == LDBL_MIN, (buf));
+        }
+        #endif
+    } // gp_suite("Shortest round trip");
 }
 
 double int64Bits2Double(uint64_t bits)
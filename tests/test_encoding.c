@@ -0,0 +1,269 @@
+// MIT License
+// Copyright (c) 2023 Lauri Lorenzo Fiestas
+// https://github.com/PrinssiFiestas/libGPC/blob/main/LICENSE.md
+
+#include <gpc/assert.h>
+#include <gpc/io.h>
+#include <printf/printf.h>
+#include "../src/encoding.c"
+
+// Straightforward references to check SIMD kernels against.
+
+static void reference_hex(GPString* out, const uint8_t* in, size_t n)
+{
+    gp_str_set(*out)->length = 0;
+    for (size_t i = 0; i < n; ++i) {
+        char digits[3];
+        pf_snprintf(digits, sizeof digits, "%02x", in[i]);
+        gp_str_append(out, digits, 2);
+    }
+}
+
+static void reference_base64(GPString* out, const uint8_t* in, size_t n, int flags)
+{
+    const char* alphabet = gp_s_base64_alphabets[(flags & GP_BASE64_URL) != 0];
+    gp_str_set(*out)->length = 0;
+    for (size_t i = 0; i < n; i += 3) {
+        uint32_t x = 0;
+        for (size_t k = 0; k < 3; ++k)
+            x = x << 8 | (i + k < n ? in[i + k] : 0);
+        const size_t chars = gp_min(n - i, (size_t)3) + 1;
+        for (size_t k = 0; k < 4; ++k) {
+            if (k < chars)
+                gp_str_append(out, &alphabet[x >> (18 - 6*k) & 63], 1);
+            else if ( ! (flags & GP_BASE64_NO_PADDING))
+                gp_str_append(out, "=", 1);
+        }
+    }
+}
+
+int main(void)
+{
+    GPArena* arena = gp_arena_new(NULL, 1 << 16);
+    uint8_t bytes[300];
+    for (size_t i = 0; i < sizeof bytes; ++i)
+        bytes[i] = (uint8_t)(i * 167 + 13);
+
+    gp_suite("Hex");
+    {
+        gp_test("Encoding");
+        {
+            GPString str = gp_str_new(&arena->base, 4);
+            gp_str_hex_encode(&str, "\x01\xAB\xff", 3, 0);
+            gp_expect(gp_str_equal(str, "01abff", 6), str);
+            gp_str_hex_encode(&str, "\x01\xAB\xff", 3, GP_HEX_UPPERCASE);
+            gp_expect(gp_str_equal(str, "01ABFF", 6), str);
+            gp_str_hex_encode(&str, NULL, 0, 0);
+            gp_expect(gp_str_equal(str, "303141424646", 12), str);
+
+            GPString expected = gp_str_new(&arena->base, 1024);
+            for (size_t n = 0; n <= sizeof bytes; ++n) {
+                reference_hex(&expected, bytes, n);
+                gp_str_hex_encode(&str, bytes, n, 0);
+                gp_assert(gp_str_equal(str, expected, gp_str_length(expected)), n, str);
+            }
+        }
+
+        gp_test("Decoding");
+        {
+            GPString str = gp_str_new(&arena->base, 4);
+            size_t invalid;
+            gp_str_hex_decode(&str, "01aBFf", 6, &invalid);
+            gp_expect(gp_str_equal(str, "\x01\xab\xff", 3) && invalid == GP_NOT_FOUND, invalid);
+            gp_str_hex_decode(&str, "01xBFf", 6, &invalid);
+            gp_expect(gp_str_equal(str, "\x01", 1) && invalid == 2, invalid);
+            gp_str_hex_decode(&str, "01aBF", 5, &invalid);
+            gp_expect(gp_str_equal(str, "\x01\xab", 2) && invalid == 5, invalid);
+
+            GPString hex = gp_str_new(&arena->base, 1024);
+            for (size_t n = 0; n <= sizeof bytes; ++n) {
+                gp_str_hex_encode(&hex, bytes, n, n % 2 ? GP_HEX_UPPERCASE : 0);
+                gp_str_hex_decode(&str, hex, gp_str_length(hex), &invalid);
+                gp_assert(gp_str_equal(str, bytes, n) && invalid == GP_NOT_FOUND, n, invalid);
+                gp_str_hex_decode(&hex, NULL, 0, NULL);
+                gp_assert(gp_str_equal(hex, bytes, n), n);
+            }
+
+            // Every character in place of a digit in SIMD blocks
+            gp_str_hex_encode(&hex, bytes, 100, 0);
+            for (int c = 0; c < 256; ++c) {
+                const size_t position = c % 150;
+                const char original = gp_cstr(hex)[position];
+                hex[position].c = c;
+                gp_str_hex_decode(&str, hex, gp_str_length(hex), &invalid);
+                const bool is_digit = gp_s_hex_value(c) >= 0;
+                gp_assert(invalid == (is_digit ? GP_NOT_FOUND : position), c, invalid);
+                gp_assert(gp_str_length(str) == (is_digit ? 100 : position/2), c);
+                hex[position].c = original;
+            }
+        }
+
+        gp_test("Truncating");
+        {
+            GPStringBuffer(5) buf;
+            GPString str = gp_str_buffered(NULL, &buf, "");
+            gp_expect(gp_str_hex_encode(&str, "\x12\x34\x56", 3, 0) == 1);
+            gp_expect(gp_str_equal(str, "12345", 5), str);
+            gp_expect(gp_str_hex_decode(&str, "313233343536", 12, NULL) == 1);
+            gp_expect(gp_str_equal(str, "12345", 5), str);
+        }
+    }
+
+    gp_suite("Base64");
+    {
+        gp_test("RFC 4648 test vectors");
+        {
+            const char* inputs[] = { "", "f", "fo", "foo", "foob", "fooba", "foobar" };
+            const char* outputs[] = {
+                "", "Zg==", "Zm8=", "Zm9v", "Zm9vYg==", "Zm9vYmE=", "Zm9vYmFy" };
+            GPString str = gp_str_new(&arena->base, 4);
+            for (size_t i = 0; i < sizeof inputs / sizeof inputs[0]; ++i) {
+                gp_str_base64_encode(&str, inputs[i], strlen(inputs[i]), 0);
+                gp_expect(gp_str_equal(str, outputs[i], strlen(outputs[i])), str, outputs[i]);
+                gp_str_base64_decode(&str, NULL, 0, 0, NULL);
+                gp_expect(gp_str_equal(str, inputs[i], strlen(inputs[i])), str, inputs[i]);
+            }
+            gp_str_base64_encode(&str, "foob", 4, GP_BASE64_NO_PADDING);
+            gp_expect(gp_str_equal(str, "Zm9vYg", 6), str);
+        }
+
+        gp_test("Round trip");
+        {
+            const int flags[] = {
+                0, GP_BASE64_URL, GP_BASE64_NO_PADDING, GP_BASE64_URL | GP_BASE64_NO_PADDING };
+            GPString expected = gp_str_new(&arena->base, 1024);
+            GPString encoded  = gp_str_new(&arena->base, 1024);
+            GPString decoded  = gp_str_new(&arena->base, 1024);
+            size_t invalid;
+            for (size_t f = 0; f < sizeof flags / sizeof flags[0]; ++f)
+            for (size_t n = 0; n <= sizeof bytes; ++n)
+            {
+                reference_base64(&expected, bytes, n, flags[f]);
+                gp_str_base64_encode(&encoded, bytes, n, flags[f]);
+                gp_assert(gp_str_equal(encoded, expected, gp_str_length(expected)),
+                    flags[f], n, encoded, expected);
+                gp_str_base64_decode(&decoded, encoded, gp_str_length(encoded), flags[f], &invalid);
+                gp_assert(gp_str_equal(decoded, bytes, n) && invalid == GP_NOT_FOUND,
+                    flags[f], n, invalid);
+            }
+        }
+
+        gp_test("Invalid");
+        {
+            GPString str = gp_str_new(&arena->base, 64);
+            size_t invalid;
+            const char* inputs[]    = { "Zg=", "Zm9vY", "Zm9vYg===", "Zm=9", "Zm9v=", "Zm-v", "Zm+v" };
+            const size_t expected[] = {  2,     5,       6,           2,      4,       2,      GP_NOT_FOUND };
+            for (size_t i = 0; i < sizeof inputs / sizeof inputs[0]; ++i) {
+                gp_str_base64_decode(&str, inputs[i], strlen(inputs[i]), 0, &invalid);
+                gp_expect(invalid == expected[i], inputs[i], invalid);
+            }
+            gp_str_base64_decode(&str, "Zm+v", 4, GP_BASE64_URL, &invalid);
+            gp_expect(invalid == 2, invalid);
+
+            // Every character in SIMD blocks in both alphabets
+            GPString base64 = gp_str_new(&arena->base, 512);
+            for (size_t url = 0; url <= 1; ++url)
+            {
+                const char* alphabet = gp_s_base64_alphabets[url];
+                gp_str_base64_encode(&base64, bytes, 150, url ? GP_BASE64_URL : 0);
+                for (int c = 0; c < 256; ++c) {
+                    const size_t position = c % 190;
+                    const char original = gp_cstr(base64)[position];
+                    base64[position].c = c;
+                    gp_str_base64_decode(&str, base64, gp_str_length(base64), url, &invalid);
+                    const bool is_valid = gp_s_base64_value(c, alphabet) >= 0;
+                    gp_assert(invalid == (is_valid ? GP_NOT_FOUND : position), url, c, invalid);
+                    gp_assert(gp_str_length(str) == (is_valid ? 150 : position/4*3), url, c);
+                    base64[position].c = original;
+                }
+            }
+        }
+    }
+
+    gp_suite("Escaping");
+    {
+        gp_test("JSON");
+        {
+            GPString str = gp_str_new(&arena->base, 4);
+            const char input[] = "\"quote\" \\ \b\f\n\r\t\x01\x1f\x7f/ä";
+            const char* escaped = "\\\"quote\\\" \\\\ \\b\\f\\n\\r\\t\\u0001\\u001f\x7f/ä";
+            gp_str_escape(&str, input, sizeof input - 1, GP_ESCAPE_JSON);
+            gp_expect(gp_str_equal(str, escaped, strlen(escaped)), str);
+            gp_str_unescape(&str, NULL, 0, GP_ESCAPE_JSON, NULL);
+            gp_expect(gp_str_equal(str, input, sizeof input - 1), str);
+
+            size_t invalid;
+            const char* unicode = "\\u00e4\\u20AC\\ud83d\\ude00\\/";
+            gp_str_unescape(&str, unicode, strlen(unicode), GP_ESCAPE_JSON, &invalid);
+            gp_expect(gp_str_equal(str, "ä€😀/", strlen("ä€😀/")) && invalid == GP_NOT_FOUND, str);
+
+            const char* inputs[]    = { "ab\\", "\\x41", "a\\u12g4", "\\ud83d", "\\ude00", "\\ud83d\\u0041", "\\a" };
+            const size_t expected[] = {  2,      0,       1,          0,        0,        0,                0 };
+            for (size_t i = 0; i < sizeof inputs / sizeof inputs[0]; ++i) {
+                gp_str_unescape(&str, inputs[i], strlen(inputs[i]), GP_ESCAPE_JSON, &invalid);
+                gp_expect(invalid == expected[i], inputs[i], invalid);
+            }
+        }
+
+        gp_test("C");
+        {
+            GPString str = gp_str_new(&arena->base, 4);
+            const char input[] = "\"\\\a\b\f\n\r\t\v\x01\x7f'?ä";
+            const char* escaped = "\\\"\\\\\\a\\b\\f\\n\\r\\t\\v\\001\\177'?ä";
+            gp_str_escape(&str, input, sizeof input - 1, GP_ESCAPE_C);
+            gp_expect(gp_str_equal(str, escaped, strlen(escaped)), str);
+            gp_str_unescape(&str, NULL, 0, GP_ESCAPE_C, NULL);
+            gp_expect(gp_str_equal(str, input, sizeof input - 1), str);
+
+            size_t invalid;
+            const char* sequences = "\\x41\\101\\0\\7a\\'\\?\\u00e4\\U0001F600";
+            const char unescaped[] = "AA\0\7a'?ä😀";
+            gp_str_unescape(&str, sequences, strlen(sequences), GP_ESCAPE_C, &invalid);
+            gp_expect(gp_str_equal(str, unescaped, sizeof unescaped - 1) && invalid == GP_NOT_FOUND, str);
+
+            const char* inputs[]    = { "\\x", "\\x100", "\\400", "\\ud800", "\\U00110000", "\\/" };
+            const size_t expected[] = {  0,     0,        0,       0,         0,             0 };
+            for (size_t i = 0; i < sizeof inputs / sizeof inputs[0]; ++i) {
+                gp_str_unescape(&str, inputs[i], strlen(inputs[i]), GP_ESCAPE_C, &invalid);
+                gp_expect(invalid == expected[i], inputs[i], invalid);
+            }
+        }
+
+        gp_test("Round trip");
+        {
+            uint8_t all[2 * 256];
+            for (size_t i = 0; i < sizeof all; ++i)
+                all[i] = (uint8_t)i;
+            const int modes[] = { GP_ESCAPE_JSON, GP_ESCAPE_C };
+            GPString escaped = gp_str_new(&arena->base, 4);
+            GPString str     = gp_str_new(&arena->base, 4);
+            size_t invalid;
+            for (size_t m = 0; m < 2; ++m)
+            for (size_t start = 0; start < 64; start += 7)
+            {
+                gp_str_escape(&escaped, all + start, sizeof all - start, modes[m]);
+                for (size_t i = 0; i < gp_str_length(escaped); ++i) {
+                    if (gp_cstr(escaped)[i] == '\\')
+                        ++i; // skip shorthand
+                    else
+                        gp_assert( ! gp_s_needs_escape(gp_cstr(escaped)[i], modes[m]), i);
+                }
+                gp_str_unescape(&str, escaped, gp_str_length(escaped), modes[m], &invalid);
+                gp_assert(gp_str_equal(str, all + start, sizeof all - start) && invalid == GP_NOT_FOUND,
+                    modes[m], start, invalid);
+            }
+        }
+
+        gp_test("Truncating");
+        {
+            GPStringBuffer(5) buf;
+            GPString str = gp_str_buffered(NULL, &buf, "");
+            gp_expect(gp_str_escape(&str, "a\n\xC3\xA4", 4, GP_ESCAPE_JSON) == 0);
+            gp_expect(gp_str_escape(&str, "ab\n\xC3\xA4", 5, GP_ESCAPE_JSON) == 2);
+            gp_expect(gp_str_equal(str, "ab\\n", 4), str, "Invalid tail truncated.");
+        }
+    }
+
+    gp_arena_delete(arena);
+}
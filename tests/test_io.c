@@ -5,6 +5,15 @@
 #include "../include/gpc/assert.h"
 #include "../src/io.c"
 
+typedef struct point { int x, y; } Point;
+
+static size_t write_point(char* out, size_t capacity, PFFormatSpecifier fmt, pf_va_list* args)
+{
+    (void)fmt;
+    const Point* p = va_arg(args->list, const Point*);
+    return pf_snprintf(out, capacity, "(%i, %i)", p->x, p->y);
+}
+
 int main(void)
 {
     // Tiny arena to put address sanitizer to work
@@ -102,10 +111,91 @@ int main(void)
             }
             fclose(f);
         }
+
+        gp_test("Write string builder");
+        {
+            FILE* f;
+            gp_assert((f = tmpfile()) != NULL);
+            GPStrBuilder builder = gp_str_builder(arena);
+            gp_str_builder_append(&builder, "", 0);
+            for (int i = 0; i < 100; ++i) {
+                gp_str_builder_int(&builder, i);
+                gp_str_builder_append(&builder, ",", 1);
+            }
+            fputs("flushed first ", f);
+            gp_expect(gp_file_write_str_builder(f, &builder) == builder.length);
+            rewind(f);
+
+            GPString contents = gp_str_new(arena, 512);
+            GPString expected = gp_str_new_init(arena, 512, "flushed first ");
+            gp_assert(gp_str_builder_write_buffer(
+                expected + gp_str_length(expected), 512 - gp_str_length(expected), &builder)
+                    == builder.length);
+            gp_str_set(expected)->length += builder.length;
+            gp_file_read_line(&contents, f);
+            gp_expect(gp_str_equal(contents, expected, gp_str_length(expected)), contents);
+            fclose(f);
+        }
     }
 
     gp_suite("Printing");
     {
+        gp_test("Values");
+        {
+            FILE* f;
+            gp_assert((f = tmpfile()) != NULL);
+            char long_str[400];
+            memset(long_str, 'x', sizeof long_str - 1);
+            long_str[sizeof long_str - 1] = '\0';
+
+            size_t length = gp_file_print_values(f, "Value ", 1, (char)' ', 2.5);
+            length += gp_file_println_values(f, long_str, -3, long_str);
+            gp_expect(length == strlen("Value 1 2.5") + 2*strlen(long_str) + strlen(" -3 \n"), length);
+            rewind(f);
+
+            GPString contents = gp_str_new(arena, 1024);
+            gp_file_read_line(&contents, f);
+            GPString expected = gp_str_new(arena, 1024);
+            gp_str_print(&expected, "Value 1 2.5", long_str, " -3 ", long_str, "\n");
+            gp_expect(gp_str_equal(contents, expected, gp_str_length(expected)), contents);
+            fclose(f);
+        }
+
+        gp_test("Extended conversions");
+        { // args of format strings must be consumed for the following objects
+            FILE* f;
+            gp_assert((f = tmpfile()) != NULL);
+            size_t length = gp_file_print(f, "%.*y %Y|", 2, "\x01\xab", "\xff", 1);
+            length += gp_file_print(f, "%v %#v|", "foob", "\xfb\xff", 2.5);
+            length += gp_file_println(f, "\"%q\"", "a\"b\n", (char)'c');
+            const char* expected = "01ab FF|1Zm9vYg== -_8|2.5\"a\\\"b\\n\" c\n";
+            gp_expect(length == strlen(expected), length);
+            rewind(f);
+
+            GPString contents = gp_str_new(arena, 64);
+            gp_file_read_line(&contents, f);
+            gp_expect(gp_str_equal(contents, expected, strlen(expected)), contents);
+            fclose(f);
+        }
+
+        gp_test("Registered conversions");
+        {
+            FILE* f;
+            gp_assert((f = tmpfile()) != NULL);
+            gp_assert(pf_register_conversion("point", write_point));
+            const Point p = { 1, 2 };
+            size_t length = gp_file_print(f, "%{point}|%-8{point}|", &p, &p, 3);
+            length += gp_file_println(f, "%{point", "x");
+            const char* expected = "(1, 2)|(1, 2)  |3%{point x\n";
+            gp_expect(length == strlen(expected), length);
+            rewind(f);
+
+            GPString contents = gp_str_new(arena, 64);
+            gp_file_read_line(&contents, f);
+            gp_expect(gp_str_equal(contents, expected, strlen(expected)), contents);
+            fclose(f);
+        }
+
         // No asserts here, uncomment exit(1) to see output.
         gp_print  (1,2,3,"Hello\n");
         gp_println(1, 2, 3, "Hello");
@@ -0,0 +1,246 @@
+// MIT License
+// Copyright (c) 2023 Lauri Lorenzo Fiestas
+// https://github.com/PrinssiFiestas/libGPC/blob/main/LICENSE.md
+
+#include <gpc/assert.h>
+#include <gpc/io.h>
+#include "../src/log.c"
+
+static void log_counter(int i)
+{
+    gp_log("%c%d", (char)('a' + i % 26), (short)i);
+}
+
+static int log_from_thread(void* arg)
+{
+    const int thread = (int)(intptr_t)arg;
+    for (int i = 0; i < 1000; ++i)
+        gp_log("%i %i", thread, i);
+    return 0;
+}
+
+static GP_MAYBE_ATOMIC bool log_stop;
+
+static int log_until_stopped(void* arg)
+{
+    const int thread = (int)(intptr_t)arg;
+    for (int i = 0; ! GP_INTERNAL_LOG_LOAD(&log_stop, relaxed); ++i) {
+        if (i % 2 == 0)
+            gp_log("%i %i", thread, i);
+        else
+            gp_log("%i %i %s", thread, i, "odd");
+    }
+    return 0;
+}
+
+// Reads the whole log as text.
+static GPString decode(GPAllocator* allocator, FILE* binary)
+{
+    rewind(binary);
+    FILE* text;
+    gp_assert((text = tmpfile()) != NULL);
+    gp_expect(gp_log_decode(text, binary));
+    rewind(text);
+
+    GPString str = gp_str_new(allocator, 256);
+    char buf[256];
+    size_t length;
+    while ((length = fread(buf, 1, sizeof buf, text)) != 0)
+        gp_str_append(&str, buf, length);
+    fclose(text);
+    return str;
+}
+
+int main(void)
+{
+    GPArena* arena = gp_arena_new(NULL, 1 << 16);
+
+    gp_suite("Binary logging");
+    {
+        gp_test("Formatting");
+        {
+            gp_log("Not logged, logging is not open.");
+
+            FILE* f;
+            gp_assert((f = tmpfile()) != NULL);
+            gp_assert(gp_log_open(f, 0));
+
+            GPString str = gp_str_new_init(&arena->base, 16, "GPString");
+            gp_log("Hello");
+            gp_log("%d + %u = %s", -1, 2u, "one");
+            gp_log("%x %5.2f|%-4s|", (short)-1, 3.14159, "ab");
+            gp_log("%*d|%.*s", 4, 7, 2, "xyz");
+            gp_log("%lu %i", 3u, -9223372036854775807ll - 1);
+            gp_log("%d%%, %s", 100, str);
+            gp_log("%d, %s", 2.5, 3);
+            gp_log("%.2y %q %.9v", "abc", "\"\n", "f");
+            gp_log("Values:", 1, 2.5, (char)'c', (bool)true, "str", (void*)NULL);
+            gp_log_close();
+
+            gp_log("Not logged, logging is closed.");
+
+            GPString text = decode(&arena->base, f);
+            const char* expected =
+                "Hello\n"
+                "-1 + 2 = one\n"
+                "ffff  3.14|ab  |\n"
+                "   7|xy\n"
+                "3 -9223372036854775808\n"
+                "100%, GPString\n"
+                "2.5, 3\n"
+                "6162 \\\"\\n Zg==\n"
+                "Values: 1 2.5 c true str (nil)\n";
+            gp_expect(gp_str_equal(text, expected, strlen(expected)), text);
+            fclose(f);
+        }
+
+        gp_test("Wrapping and dropping");
+        {
+            char long_str[256];
+            memset(long_str, 'x', sizeof long_str - 1);
+            long_str[sizeof long_str - 1] = '\0';
+
+            // Small buffer to wrap around and flush a lot. Reopening with
+            // different file should redefine the formats.
+            GPString texts[2];
+            for (size_t session = 0; session < 2; ++session)
+            {
+                FILE* f;
+                gp_assert((f = tmpfile()) != NULL);
+                gp_assert(gp_log_open(f, 60));
+                for (int i = 0; i < 100; ++i) {
+                    log_counter(i);
+                    if (i == 50)
+                        gp_log("%s", long_str); // larger than buffer, dropped
+                }
+                gp_log_close();
+                texts[session] = decode(&arena->base, f);
+                fclose(f);
+            }
+
+            GPString expected = gp_str_new(&arena->base, 1024);
+            GPString line     = gp_str_new(&arena->base, 16);
+            for (int i = 0; i < 100; ++i) {
+                gp_str_print(&line, "%c%i\n", 'a' + i % 26, i);
+                gp_str_append(&expected, line, gp_str_length(line));
+            }
+            gp_expect(gp_str_equal(texts[0], expected, gp_str_length(expected)), texts[0]);
+            gp_expect(gp_str_equal(texts[1], expected, gp_str_length(expected)), texts[1]);
+        }
+
+        gp_test("Threads");
+        {
+            FILE* f;
+            gp_assert((f = tmpfile()) != NULL);
+            gp_assert(gp_log_open(f, 256));
+            GPThread threads[4];
+            for (size_t i = 0; i < sizeof threads / sizeof threads[0]; ++i)
+                gp_thread_create(&threads[i], log_from_thread, (void*)(intptr_t)i);
+            for (size_t i = 0; i < sizeof threads / sizeof threads[0]; ++i)
+                gp_thread_join(threads[i], NULL);
+            gp_log_close();
+
+            // Records of different threads may be interleaved, but records of
+            // a single thread must be in order.
+            GPString text = decode(&arena->base, f);
+            int next[4] = {0};
+            const char* line = gp_cstr(text);
+            int thread, i;
+            while (sscanf(line, "%i %i\n", &thread, &i) == 2)
+            {
+                gp_assert(0 <= thread && thread < 4, thread);
+                gp_expect(i == next[thread], thread, i, next[thread]);
+                next[thread] = i + 1;
+                line = strchr(line, '\n') + 1;
+            }
+            for (size_t j = 0; j < 4; ++j)
+                gp_expect(next[j] == 1000, j, next[j]);
+            fclose(f);
+        }
+
+        gp_test("Record published after close");
+        {
+            static const gp_type_t types[] = { GP_TYPE_CHAR_PTR };
+            static GPInternalLogFormat format = { "stale %s", types, 1, 0, 0 };
+
+            FILE* files[2];
+            gp_assert((files[0] = tmpfile()) != NULL);
+            gp_assert((files[1] = tmpfile()) != NULL);
+
+            // Writer passes the session check, but publishes after reopen.
+            gp_assert(gp_log_open(files[0], 256));
+            GPInternalLogWriter writer = gp_internal_log_begin(&format);
+            gp_log_close();
+            gp_internal_log_put_cstr(&writer, "from previous session");
+            gp_internal_log_end(&writer);
+
+            gp_assert(gp_log_open(files[1], 256));
+            gp_log("fresh %i", 1);
+            gp_log_close();
+
+            GPString text = decode(&arena->base, files[0]);
+            gp_expect(gp_str_equal(text, "", 0), text);
+            text = decode(&arena->base, files[1]);
+            gp_expect(gp_str_equal(text, "fresh 1\n", strlen("fresh 1\n")), text);
+            fclose(files[0]);
+            fclose(files[1]);
+        }
+
+        gp_test("Reopen with concurrent producers");
+        {
+            GP_INTERNAL_LOG_STORE(&log_stop, false, relaxed);
+            GPThread threads[4];
+            for (size_t i = 0; i < sizeof threads / sizeof threads[0]; ++i)
+                gp_thread_create(&threads[i], log_until_stopped, (void*)(intptr_t)i);
+
+            FILE* files[8];
+            for (size_t j = 0; j < sizeof files / sizeof files[0]; ++j) {
+                gp_assert((files[j] = tmpfile()) != NULL);
+                gp_assert(gp_log_open(files[j], 128));
+                for (int k = 0; k < 200; ++k)
+                    gp_log_flush();
+            }
+            GP_INTERNAL_LOG_STORE(&log_stop, true, relaxed);
+            for (size_t i = 0; i < sizeof threads / sizeof threads[0]; ++i)
+                gp_thread_join(threads[i], NULL);
+            gp_log_close();
+
+            // Records may be dropped or discarded at close, but every record
+            // in a file must be decoded with the format of its own session.
+            for (size_t j = 0; j < sizeof files / sizeof files[0]; ++j)
+            {
+                GPString text = decode(&arena->base, files[j]);
+                int next[4] = {0};
+                const char* line = gp_cstr(text);
+                int thread, i, consumed;
+                while (sscanf(line, "%i %i%n", &thread, &i, &consumed) == 2)
+                {
+                    gp_assert(0 <= thread && thread < 4, thread);
+                    gp_expect(i >= next[thread], thread, i, next[thread]);
+                    next[thread] = i + 1;
+                    const char* end = i % 2 == 0 ? "\n" : " odd\n";
+                    gp_assert(strncmp(line + consumed, end, strlen(end)) == 0,
+                        line + consumed, i);
+                    line += consumed + strlen(end);
+                }
+                gp_expect(*line == '\0', line);
+                fclose(files[j]);
+            }
+        }
+
+        gp_test("Invalid log");
+        {
+            FILE* binary;
+            FILE* text;
+            gp_assert((binary = tmpfile()) != NULL);
+            gp_assert((text = tmpfile()) != NULL);
+            fputs("Not a log file", binary);
+            rewind(binary);
+            gp_expect( ! gp_log_decode(text, binary));
+            fclose(binary);
+            fclose(text);
+        }
+    }
+
+    gp_arena_delete(arena);
+}
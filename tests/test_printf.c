@@ -35,6 +35,55 @@ do { \
 
 GPRandomState g_rs;
 
+typedef struct test_sink
+{
+    char   data[1 << 15];
+    size_t length;
+    size_t writes;
+} TestSink;
+
+static void test_sink_write(void* context, const char* data, size_t length)
+{
+    TestSink* sink = context;
+    gp_assert(sink->length + length < sizeof sink->data);
+    memcpy(sink->data + sink->length, data, length);
+    sink->length += length;
+    sink->data[sink->length] = '\0';
+    sink->writes++;
+}
+
+typedef struct point
+{
+    int x, y;
+} Point;
+
+static size_t write_point(char* out, size_t capacity, PFFormatSpecifier fmt, pf_va_list* args)
+{
+    const Point* p = va_arg(args->list, const Point*);
+    if (fmt.flag.hash)
+        return pf_snprintf(out, capacity, "Point{%i, %i}", p->x, p->y);
+    return pf_snprintf(out, capacity, "(%i, %i)", p->x, p->y);
+}
+
+static size_t write_point_swapped(char* out, size_t capacity, PFFormatSpecifier fmt, pf_va_list* args)
+{
+    (void)fmt;
+    const Point* p = va_arg(args->list, const Point*);
+    return pf_snprintf(out, capacity, "(%i, %i)", p->y, p->x);
+}
+
+static size_t write_xs(char* out, size_t capacity, PFFormatSpecifier fmt, pf_va_list* args)
+{
+    (void)fmt;
+    const size_t length = va_arg(args->list, size_t);
+    if (capacity != 0) {
+        const size_t written = length < capacity ? length : capacity - 1;
+        memset(out, 'x', written);
+        out[written] = '\0';
+    }
+    return length;
+}
+
 int main(void)
 {
     char buf[512];
@@ -131,6 +180,51 @@ int main(void)
             gp_expect(ret == ret_std);
         }
 
+        gp_test("%r");
+        { // extension, not recognized by compilers
+            const char* fmt = "blah %r blah";
+            ret = pf_sprintf(buf, fmt, 0.1);
+            expect_str(buf, "blah 0.1 blah");
+            gp_expect(ret == strlen("blah 0.1 blah"));
+
+            fmt = "%hr|%+r|%08r|%-6r|% r";
+            pf_sprintf(buf, fmt, 1.f/3.f, 2.5, -1e-7, 0., NAN);
+            expect_str(buf, "0.33333334|+2.5|-001e-07|0     | nan");
+
+            #if GP_HAS_LONG_DOUBLE
+            fmt = "%Lr %r";
+            pf_sprintf(buf, fmt, 0.1L, 0.2);
+            expect_str(buf, "0.1 0.2");
+            #endif
+        }
+
+        gp_test("%y %v %q");
+        { // extensions, not recognized by compilers
+            const char* fmt = "%.*y|%.*Y|%6.2y|%y";
+            ret = pf_sprintf(buf, fmt, 3, "\x00\xab\x10", 1, "\xff", "\x01\x02\x03", "hi");
+            expect_str(buf, "00ab10|FF|  0102|6869");
+            gp_expect(ret == strlen("00ab10|FF|  0102|6869"));
+
+            fmt = "%v|%#v|%.*v|%-6v|";
+            pf_sprintf(buf, fmt, "foob", "\xfb\xff", 2, "f\0", "f");
+            expect_str(buf, "Zm9vYg==|-_8|ZgA=|Zg==  |");
+
+            fmt = "\"%q\" \"%#q\" %.*q";
+            pf_sprintf(buf, fmt, "a\"b\n\x01", "a\"b\n\x01\x7f", 2, "\t\n\t");
+            expect_str(buf, "\"a\\\"b\\n\\u0001\" \"a\\\"b\\n\\001\\177\" \\t\\n");
+
+            // Truncated output is encoded in chunks.
+            char bytes[100];
+            for (size_t i = 0; i < sizeof bytes; ++i)
+                bytes[i] = (char)('\n' + i % 2);
+            fmt = "%.*q";
+            gp_expect(pf_snprintf(buf, 17, fmt, (int)sizeof bytes, bytes) == 50*2 + 50*6);
+            gp_expect(memcmp(buf, "\\n\\u000b\\n\\u000b", 16) == 0 && buf[16] == '\0', buf);
+            fmt = "%.*y";
+            gp_expect(pf_snprintf(buf, 8, fmt, (int)sizeof bytes, bytes) == 200);
+            expect_str(buf, "0a0b0a0");
+        }
+
         gp_test("%p");
         {
             void* p = (void*)-1;
@@ -339,6 +433,203 @@ int main(void)
         }
     } // gp_suite("Misc");
 
+    gp_suite("Precompiled formats");
+    {
+        gp_test("Cached by address");
+        {
+            static const char fmt[] = "%i";
+            gp_expect(pf_compile(fmt) == pf_compile(fmt));
+            gp_expect(pf_compile(fmt) != pf_compile("%s"));
+        }
+
+        gp_test("Same as uncompiled");
+        {
+            ret     = pf_snprintf_compiled(buf, sizeof buf, pf_compile("blah %f, %#0x"), .5, 0x2);
+            ret_std = pf_snprintf(buf_std, sizeof buf_std, "blah %f, %#0x", .5, 0x2);
+            expect_str(buf, buf_std);
+            gp_expect(ret == ret_std);
+
+            ret     = pf_snprintf_compiled(buf, sizeof buf, pf_compile("%.3s, %+4i%%"), "bloink", 63);
+            ret_std = pf_snprintf(buf_std, sizeof buf_std, "%.3s, %+4i%%", "bloink", 63);
+            expect_str(buf, buf_std);
+            gp_expect(ret == ret_std);
+
+            ret     = pf_snprintf_compiled(buf, sizeof buf, pf_compile("%*.*f|%-*d|%.*s"), 10, 2, 3.14159, -5, 7, -1, "str");
+            ret_std = pf_snprintf(buf_std, sizeof buf_std, "%*.*f|%-*d|%.*s", 10, 2, 3.14159, -5, 7, -1, "str");
+            expect_str(buf, buf_std);
+            gp_expect(ret == ret_std);
+
+            ret = pf_snprintf_compiled(buf, sizeof buf, pf_compile("Whatever %% %%"));
+            expect_str(buf, "Whatever % %");
+            gp_expect(ret == strlen("Whatever % %"));
+
+            ret = pf_snprintf_compiled(buf, sizeof buf, pf_compile(""));
+            expect_str(buf, "");
+            gp_expect(ret == 0);
+        }
+
+        gp_test("Truncation");
+        {
+            ret = pf_snprintf_compiled(buf, 6, pf_compile("%s %d"), "blah", 1234);
+            expect_str(buf, "blah ");
+            gp_expect(ret == strlen("blah 1234"));
+            gp_expect(pf_snprintf_compiled(NULL, 0, pf_compile("%s %d"), "blah", 1234) == ret);
+        }
+    } // gp_suite("Precompiled formats");
+
+    gp_suite("Streaming");
+    {
+        static TestSink sink;
+        static char expected[sizeof sink.data];
+        static char long_str[10000];
+        memset(long_str, 'x', sizeof long_str - 1);
+        const PFSink test_sink = { test_sink_write, &sink };
+
+        gp_test("Short output in one write");
+        {
+            sink.length = sink.writes = 0;
+            ret = pf_sinkprintf(test_sink, "blah %i %s %.2f", 3, "bloink", .5);
+            expect_str(sink.data, "blah 3 bloink 0.50");
+            gp_expect(ret == strlen("blah 3 bloink 0.50"));
+            gp_expect(sink.writes == 1, sink.writes);
+        }
+
+        gp_test("Long output");
+        {
+            sink.length = sink.writes = 0;
+            ret = pf_sinkprintf(test_sink, "%s|%-9000i|%.3s|%9000.3f", long_str, 5, long_str, 1.5);
+            ret_std = pf_snprintf(expected, sizeof expected, "%s|%-9000i|%.3s|%9000.3f", long_str, 5, long_str, 1.5);
+            gp_assert(ret_std < sizeof expected);
+            gp_expect(ret == ret_std, ret, ret_std);
+            gp_expect(sink.length == ret);
+            gp_expect(memcmp(sink.data, expected, ret) == 0);
+
+            gp_expect(sink.writes > 1, sink.writes);
+
+            static char fmt[sizeof expected];
+            fmt[0] = expected[0] = '\0';
+            for (size_t i = 0; i < 2000; ++i) {
+                strcat(fmt, "blah %% ");
+                strcat(expected, "blah % ");
+            }
+            sink.length = sink.writes = 0;
+            ret = pf_sinkprintf(test_sink, fmt);
+            gp_expect(ret == strlen(expected));
+            expect_str(sink.data, expected);
+            gp_expect(sink.writes > 1, sink.writes);
+        }
+
+        gp_test("File");
+        {
+            FILE* f = tmpfile();
+            gp_assert(f != NULL);
+            ret = pf_fprintf(f, "%s%i", long_str, 42);
+            gp_expect(ret == sizeof long_str - 1 + strlen("42"));
+            rewind(f);
+            size_t read = fread(sink.data, 1, sizeof sink.data - 1, f);
+            sink.data[read] = '\0';
+            gp_expect(read == ret, read, ret);
+            gp_expect(strcmp(sink.data + read - strlen("x42"), "x42") == 0);
+            fclose(f);
+        }
+
+        gp_test("Floats in truncated output");
+        {
+            struct { char buf[10]; char guard[16]; } s;
+            memset(s.guard, 'G', sizeof s.guard);
+            ret = pf_snprintf(s.buf, sizeof s.buf, "%s%f", "12345678", 1.);
+            expect_str(s.buf, "123456781");
+            gp_expect(ret == strlen("123456781.000000"));
+            gp_expect(s.guard[0] == 'G');
+        }
+    } // gp_suite("Streaming");
+
+    gp_suite("Registered conversions");
+    {
+        const Point p = { 1, 2 };
+
+        gp_test("Basic conversions");
+        {
+            gp_assert(pf_register_conversion("point", write_point));
+            gp_assert(pf_register_conversion("xs", write_xs));
+            const char* fmt = "%{point} %#{point}|%-8{point}|%8{point}|";
+            ret = pf_sprintf(buf, fmt, &p, &p, &p, &p);
+            expect_str(buf, "(1, 2) Point{1, 2}|(1, 2)  |  (1, 2)|");
+            gp_expect(ret == strlen(buf));
+
+            fmt = "%d %{point} %s";
+            ret = pf_snprintf_compiled(buf, sizeof buf, pf_compile(fmt), 3, &p, "blah");
+            expect_str(buf, "3 (1, 2) blah");
+
+            // Missing '}' is not a conversion, the rest is written as is.
+            fmt = "%d %{point %s";
+            ret = pf_sprintf(buf, fmt, 3, "blah");
+            expect_str(buf, "3 %{point %s");
+            ret = pf_snprintf_compiled(buf, sizeof buf, pf_compile(fmt), 3, "blah");
+            expect_str(buf, "3 %{point %s");
+
+            #ifdef NDEBUG // asserted in debug builds
+            // Unregistered conversions consume the argument and are written as is.
+            fmt = "%{nope} %s %d";
+            ret = pf_snprintf(buf, sizeof buf, fmt, "skipped", "str", 5);
+            expect_str(buf, "%{nope} str 5");
+            ret = pf_snprintf_compiled(buf, sizeof buf, pf_compile(fmt), "skipped", "str", 5);
+            expect_str(buf, "%{nope} str 5");
+            #endif
+        }
+
+        gp_test("Truncation");
+        {
+            const char* fmt = "%{point}x";
+            ret = pf_snprintf(buf, 7, fmt, &p);
+            expect_str(buf, "(1, 2)");
+            gp_expect(ret == strlen("(1, 2)x"));
+            ret = pf_snprintf(buf, 6, fmt, &p);
+            expect_str(buf, "(1, 2");
+            ret = pf_snprintf(NULL, 0, fmt, &p);
+            gp_expect(ret == strlen("(1, 2)x"));
+
+            // Exactly filling the streaming buffer must not leave the
+            // null-terminator written by the conversion to the output.
+            static TestSink sink;
+            fmt = "%{xs}|%{xs}";
+            ret = pf_sinkprintf((PFSink){ test_sink_write, &sink }, fmt, (size_t)4096, (size_t)9000);
+            gp_expect(ret == 4096 + 1 + 9000 && sink.length == ret, ret, sink.length);
+            gp_expect(strspn(sink.data, "x") == 4096 && sink.data[4096] == '|');
+            gp_expect(strspn(sink.data + 4097, "x") == 9000);
+        }
+
+        gp_test("Registering");
+        {
+            gp_expect( ! pf_register_conversion("", write_point));
+            gp_expect( ! pf_register_conversion("invalid-name", write_point));
+            gp_expect( ! pf_register_conversion("name_longer_than_thirty_one_char", write_point));
+            gp_expect(pf_register_conversion("name_with_thirty_one_characters", write_point));
+
+            gp_assert(pf_register_conversion("point", write_point_swapped));
+            const char* fmt = "%{point}";
+            pf_sprintf(buf, fmt, &p);
+            expect_str(buf, "(2, 1)");
+
+            // Compiled formats find conversions registered after compiling.
+            const PFFormat* compiled = pf_compile("%{late}|%-7{late}|");
+            gp_assert(pf_register_conversion("late", write_point));
+            pf_snprintf_compiled(buf, sizeof buf, compiled, &p, &p);
+            expect_str(buf, "(1, 2)|(1, 2) |");
+            compiled = pf_compile("%{late}|%7{late}|");
+            pf_snprintf_compiled(buf, sizeof buf, compiled, &p, &p);
+            expect_str(buf, "(1, 2)| (1, 2)|");
+
+            size_t registered = 0;
+            char name[8];
+            for (size_t i = 0; i < PF_MAX_CONVERSIONS; ++i) {
+                pf_snprintf(name, sizeof name, "c%zu", i);
+                registered += pf_register_conversion(name, write_point);
+            }
+            gp_expect(registered == PF_MAX_CONVERSIONS - 4, registered);
+        }
+    } // gp_suite("Registered conversions");
+
     gp_suite("Fuzz test");
     {
         // Seed RNG with date
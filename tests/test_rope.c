@@ -0,0 +1,111 @@
+// MIT License
+// Copyright (c) 2023 Lauri Lorenzo Fiestas
+// https://github.com/PrinssiFiestas/libGPC/blob/main/LICENSE.md
+
+#include "../src/rope.c"
+#include <gpc/assert.h>
+#include <gpc/unicode.h>
+
+int main(void)
+{
+    // Tiny arena to put address sanitizer to work
+    GPArena* _arena = gp_arena_new(NULL, 1);
+    _arena->growth_factor = 0.0;
+    GPAllocator* arena = &_arena->base;
+
+    gp_suite("Rope");
+    {
+        gp_test("Edit");
+        {
+            GPRope rope = gp_rope_new(gp_global_heap, "Hello world!", strlen("Hello world!"));
+            GPString str = gp_str_new(arena, 64);
+
+            gp_rope_insert(rope, strlen("Hello"), ",", 1);
+            gp_rope_append(rope, " Bye!", strlen(" Bye!"));
+            gp_rope_flatten(&str, rope);
+            gp_expect(gp_str_equal(str, "Hello, world! Bye!", strlen("Hello, world! Bye!")), str);
+
+            gp_rope_erase(rope, strlen("Hello"), strlen(", world"));
+            gp_rope_flatten(&str, rope);
+            gp_expect(gp_str_equal(str, "Hello! Bye!", strlen("Hello! Bye!")), str);
+            gp_expect(gp_rope_at(rope, 5) == '!');
+
+            gp_rope_slice(rope, strlen("Hello! "), gp_rope_length(rope) - 1);
+            gp_rope_flatten(&str, rope);
+            gp_expect(gp_str_equal(str, "Bye", strlen("Bye")), str);
+
+            gp_rope_delete(rope);
+        }
+
+        gp_test("Compare to string");
+        {
+            GPRandomState rs = gp_random_state_seed(42, 0);
+            GPRope rope = gp_rope_new(arena, NULL, 0);
+            GPString expected = gp_str_new(gp_global_heap, 64);
+            GPString result   = gp_str_new(gp_global_heap, 64);
+            char src[3000];
+            for (size_t i = 0; i < sizeof src; ++i)
+                src[i] = 'a' + i % 26;
+
+            for (size_t i = 0; i < 500; ++i)
+            {
+                const size_t length   = gp_str_length(expected);
+                const size_t position = gp_random_bound(&rs, length + 1);
+                const size_t count    = gp_random_bound(&rs, gp_min(length - position, (size_t)2000) + 1);
+                switch (gp_random_bound(&rs, 4)) {
+                case 0:
+                    gp_rope_erase(rope, position, count);
+                    gp_str_erase(&expected, position, count);
+                    break;
+                case 1:
+                    if (gp_random_bound(&rs, 8) == 0) {
+                        gp_rope_slice(rope, position, position + count);
+                        gp_str_slice(&expected, NULL, position, position + count);
+                        break;
+                    } // fallthrough
+                default: {
+                    const size_t src_length = gp_random_bound(&rs, sizeof src);
+                    gp_rope_insert(rope, position, src, src_length);
+                    gp_str_insert(&expected, position, src, src_length);
+                }}
+                gp_assert(gp_rope_length(rope) == gp_str_length(expected),
+                    i, gp_rope_length(rope), gp_str_length(expected));
+            }
+            gp_rope_flatten(&result, rope);
+            gp_expect(gp_str_equal(result, expected, gp_str_length(expected)));
+
+            size_t chunks_length = 0;
+            GPRopeIterator it = gp_rope_iterator(rope, gp_str_length(expected) / 2);
+            while (gp_rope_next(&it)) {
+                gp_assert(memcmp(
+                    it.chunk,
+                    expected + gp_str_length(expected) / 2 + chunks_length,
+                    it.chunk_length) == 0);
+                chunks_length += it.chunk_length;
+            }
+            gp_expect(chunks_length == gp_str_length(expected) - gp_str_length(expected) / 2);
+
+            gp_str_delete(expected);
+            gp_str_delete(result);
+        }
+
+        gp_test("Codepoints");
+        {
+            const char* init = "zß水🍌";
+            GPRope rope = gp_rope_new(arena, init, strlen(init));
+            for (size_t i = 0; i < 100; ++i)
+                gp_rope_insert(rope, 0, init, strlen(init));
+            gp_expect(gp_rope_codepoint_count(rope) == 4 * 101);
+
+            gp_rope_erase(rope, 0, 3); // z and ß
+            gp_expect(gp_rope_codepoint_count(rope) == 4 * 101 - 2);
+            gp_expect(gp_rope_codepoint_index(rope, 0) == 0);
+            gp_expect(gp_rope_codepoint_index(rope, 1) == strlen("水"));
+            gp_expect(gp_rope_codepoint_index(rope, 2) == strlen("水🍌"));
+            gp_expect(gp_rope_codepoint_index(rope, 2 + 4*50) == strlen("水🍌") + 50*strlen(init));
+            gp_expect(gp_rope_codepoint_index(rope, gp_rope_codepoint_count(rope)) == gp_rope_length(rope));
+        }
+    }
+
+    gp_arena_delete(_arena);
+}
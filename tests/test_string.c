@@ -7,6 +7,7 @@
 #include "../src/string.c"
 #include <locale.h>
 #include <inttypes.h>
+#include <float.h>
 
 int main(void)
 {
@@ -141,6 +142,104 @@ int main(void)
         }
     }
 
+    gp_suite("String builder");
+    {
+        gp_test("Build");
+        {
+            GPString str = gp_str_new(gp_global_heap, 1);
+            GPStrBuilder builder = gp_str_builder(gp_global_heap);
+            gp_str_builder_append(&builder, "x = ", strlen("x = "));
+            gp_str_builder_int(&builder, -42);
+            gp_str_builder_append(&builder, ", y = ", strlen(", y = "));
+            gp_str_builder_double(&builder, 0.5);
+            {
+                char tmp[] = ", z = ";
+                gp_str_builder_append_copy(&builder, tmp, strlen(tmp));
+                memset(tmp, 0, sizeof tmp);
+            }
+            for (unsigned i = 0; i < 100; ++i)
+                gp_str_builder_uint(&builder, i % 10);
+
+            const char* expected = "x = -42, y = 0.5, z = "
+                "0123456789012345678901234567890123456789012345678901234567890123456789"
+                "012345678901234567890123456789";
+            gp_expect(builder.length == strlen(expected), builder.length);
+            gp_str_builder_write(&str, &builder);
+            gp_expect(gp_str_equal(str, expected, strlen(expected)), str);
+
+            GPStringBuffer(8) buf;
+            GPString truncating = gp_str_buffered(NULL, &buf);
+            gp_expect(gp_str_builder_write(&truncating, &builder) == strlen(expected) - 8);
+            gp_expect(gp_str_equal(truncating, "x = -42,", 8), truncating);
+
+            gp_str_builder_delete(&builder);
+            gp_str_delete(str);
+        }
+
+        gp_test("Build from destination");
+        {
+            GPString str = gp_str_new_init(gp_global_heap, 4, "abcd");
+            GPStrBuilder builder = gp_str_builder(gp_global_heap);
+            gp_str_builder_append(&builder, "0123456789", 10);
+            gp_str_builder_append(&builder, str + 2, 2); // freed when reallocating
+            gp_str_builder_append(&builder, str, 2);
+            gp_str_builder_write(&str, &builder);
+            gp_expect(gp_str_equal(str, "0123456789cdab", 14), str);
+
+            gp_str_builder_delete(&builder);
+            builder = gp_str_builder(gp_global_heap);
+            gp_str_builder_append(&builder, str + 10, 4); // overlapping copy
+            gp_str_builder_write(&str, &builder);
+            gp_expect(gp_str_equal(str, "cdab", 4), str);
+
+            gp_str_builder_delete(&builder);
+            gp_str_delete(str);
+        }
+    }
+
+    gp_suite("Short strings and interning");
+    {
+        gp_test("Short strings");
+        {
+            GPShortString s1 = gp_short_str("blah", strlen("blah"));
+            GPShortString s2 = gp_short_str("blah!", strlen("blah"));
+            GPShortString s3 = gp_short_str("fifteen letters", strlen("fifteen letters"));
+            gp_expect(gp_short_str_equal(s1, s2));
+            gp_expect( ! gp_short_str_equal(s1, s3));
+            gp_expect(gp_short_str_length(s3) == 15);
+            gp_expect(strcmp(s3.data, "fifteen letters") == 0, s3.data);
+
+            GPStringBuffer(16) buf;
+            GPString str = gp_str_buffered(NULL, &buf, "blah");
+            gp_expect(gp_str_equal(str, s1.data, gp_short_str_length(s1)));
+
+            GPMap map = gp_map_new(sizeof(int), gp_global_heap, 0);
+            gp_map_put(&map, &s1, sizeof s1, &(int){1});
+            gp_expect(*(int*)gp_map_get(map, &s2, sizeof s2) == 1);
+            gp_map_delete(map);
+        }
+
+        gp_test("Interning");
+        {
+            GPInternTable table = gp_intern_table_new(gp_global_heap);
+            char key[16];
+            for (size_t i = 0; i < 1000; ++i)
+                gp_assert(gp_intern(table, key, pf_sprintf(key, "key%zu", i)) == i);
+
+            const uint32_t id = gp_intern(table, "key42", strlen("key42"));
+            gp_expect(id == 42, id);
+            gp_expect(gp_intern_find(table, "key42", strlen("key42")) == 42);
+            gp_expect(gp_intern_find(table, "key1000", strlen("key1000")) == UINT32_MAX);
+            gp_expect(gp_intern(table, "", 0) == 1000);
+
+            GPString interned = gp_interned_str(table, id);
+            gp_expect(gp_str_equal(interned, "key42", strlen("key42")));
+            gp_expect(strcmp(gp_cstr(interned), "key42") == 0);
+            gp_expect(gp_interned_hash(table, id) == gp_bytes_hash("key42", strlen("key42")));
+            gp_intern_table_delete(table);
+        }
+    }
+
     gp_suite("UTF-8 examination");
     {
         gp_test("Find first of");
@@ -288,6 +387,55 @@ int main(void)
             cstr = "aaaXcccXXXXX";
             gp_expect(gp_str_equal(str, cstr, strlen(cstr)), str);
         }
+
+        gp_test("Replace all");
+        {
+            GPString str = gp_str_new(&gp_scratch_arena()->base, 1);
+            gp_str_copy(&str, "aaabbbaaacccaaa", strlen("aaabbbaaacccaaa"));
+            size_t count;
+            gp_str_replace_all(&str, "aaa", strlen("aaa"), "X", 1, &count);
+            gp_expect(gp_str_equal(str, "XbbbXcccX", strlen("XbbbXcccX")), str);
+            gp_expect(count == 3, count);
+
+            gp_str_replace_all(&str, "X", 1, "yyyy", 4, &count);
+            const char* cstr = "yyyybbbyyyycccyyyy";
+            gp_expect(gp_str_equal(str, cstr, strlen(cstr)), str);
+            gp_expect(count == 3, count);
+
+            gp_str_replace_all(&str, "zzz", 3, "", 0, &count);
+            gp_expect(gp_str_equal(str, cstr, strlen(cstr)), str);
+            gp_expect(count == 0);
+
+            GPStringBuffer(8) buf;
+            GPString truncating = gp_str_buffered(NULL, &buf, "a-b-c");
+            const size_t trunced = gp_str_replace_all(&truncating, "-", 1, "---", 3, NULL);
+            gp_expect(gp_str_equal(truncating, "a---b---", 8), truncating);
+            gp_expect(trunced == 1, trunced);
+        }
+
+        gp_test("Replace many");
+        {
+            const char* template = "Hello {name}, {greeting}! {name}{name}";
+            GPString str = gp_str_new(gp_global_heap, 1);
+            gp_str_copy(&str, template, strlen(template));
+            const char*const needles[]      = { "{name}", "{greeting}", "{" };
+            const char*const replacements[] = { "Bob",    "how are you {name}", "" };
+            size_t count;
+            gp_str_replace_many(&str, 3, needles, replacements, &count);
+            const char* cstr = "Hello Bob, how are you {name}! BobBob";
+            gp_expect(gp_str_equal(str, cstr, strlen(cstr)), str);
+            gp_expect(count == 4, count);
+            gp_str_delete(str);
+
+            // Growing haystack in scratch arena must survive rewinding
+            str = gp_str_new(&gp_scratch_arena()->base, 1);
+            gp_str_copy(&str, "{name} {name}", strlen("{name} {name}"));
+            const char*const long_name[] = { "Bartholomew the Third" };
+            gp_str_replace_many(&str, 1, needles, long_name, &count);
+            cstr = "Bartholomew the Third Bartholomew the Third";
+            gp_expect(gp_str_equal(str, cstr, strlen(cstr)), str);
+            gp_expect(count == 2, count);
+        }
     }
 
     #ifdef __GLIBC__ // gp_print() conversions match glibc
@@ -298,9 +446,19 @@ int main(void)
             GPStringBuffer(0) buf;
             GPString str = gp_str_buffered(gp_global_heap, &buf);
             gp_str_print(&str, 1, " divided by ", 3, " is ", 1./3.);
-            char buf1[128];
-            sprintf(buf1, "%i divided by %i is %g", 1, 3, 1./3.);
-            gp_expect(gp_str_equal(str, buf1, strlen(buf1)), str, buf1);
+            const char* expected = "1 divided by 3 is 0.3333333333333333";
+            gp_expect(gp_str_equal(str, expected, strlen(expected)), str);
+
+            // Shortest round trip representation for all floating point types
+            gp_str_print(&str, 0.1 + 0.2, " ", -DBL_MIN, " ", 2.5);
+            expected = "0.30000000000000004 -2.2250738585072014e-308 2.5";
+            gp_expect(gp_str_equal(str, expected, strlen(expected)), str);
+            gp_str_print(&str, 1.f/3.f, " ", 0.1f);
+            gp_expect(gp_str_equal(str, "0.33333334 0.1", strlen("0.33333334 0.1")), str);
+            #if GP_HAS_LONG_DOUBLE && LDBL_MANT_DIG == 64
+            gp_str_print(&str, 1.23456789012345678L);
+            gp_expect(gp_str_equal(str, "1.23456789012345678", strlen("1.23456789012345678")), str);
+            #endif
             gp_str_delete(str);
         }
 
@@ -343,6 +501,10 @@ int main(void)
             gp_expect(gp_str_equal(str3, buf, strlen(buf)),
                 "GPString should calculate field width based on UTF-8 "
                 "codepoints. This is not true for char* though.", str3);
+            gp_str_print(&str3, "%r ", 0.1, "%hr", 0.1f, " shortest round trip");
+            gp_expect(gp_str_equal(str3, "0.1 0.1 shortest round trip",
+                strlen("0.1 0.1 shortest round trip")), str3);
+
             gp_str_print(&str3, "|%4.1S|", str2);
             gp_expect(gp_str_equal(str3, "|    |", strlen("|    |")),
                 "Precision is calculated in bytes. Here 'ä' didn't fit. Instead "
@@ -350,6 +512,26 @@ int main(void)
                 "'ä' got removed completely.");
         }
 
+        gp_test("Growing formatted output");
+        {
+            GPString str = gp_str_new(gp_global_heap, 0);
+            char buf[256];
+            gp_str_print(&str, "%s and %-40d|", "Long formats", 42, 7, " %*s|%g", 30, "after growing", .5);
+            sprintf(buf, "%s and %-40d|7 %*s|%g", "Long formats", 42, 30, "after growing", .5);
+            gp_expect(gp_str_equal(str, buf, strlen(buf)), str, buf);
+
+            gp_str_println(&str, "%80s", "right", "%x", 0xbeef);
+            sprintf(buf, "%80s %x\n", "right", 0xbeef);
+            gp_expect(gp_str_equal(str, buf, strlen(buf)), str, buf);
+            gp_str_delete(str);
+
+            GPStringBuffer(16) buf0;
+            str = gp_str_buffered(NULL, &buf0);
+            const size_t trunced = gp_str_print(&str, "%s %d", "Truncated output", 1234, (char)'!');
+            gp_expect(gp_str_equal(str, "Truncated output", 16), str);
+            gp_expect(trunced == strlen(" 1234!"), trunced);
+        }
+
         gp_test("Fixed width length modifiers for format strings");
         { // Can be used for any integer formats. Here we stick with %u for
           // simplicity.
@@ -432,6 +614,49 @@ int main(void)
             gp_str_println(&str, "With %g%i", 2., 0, "fmt specs.");
             gp_expect(gp_str_equal(str, cstr, strlen(cstr)), str);
         }
+
+        gp_test("Values");
+        {
+            GPStringBuffer(127) buf0;
+            GPString str = gp_str_buffered(NULL, &buf0);
+            GPStringBuffer(127) buf1;
+            GPString str1 = gp_str_buffered(NULL, &buf1, "GPString");
+            gp_str_print_values(&str,
+                -1, 2u, (short)3, 4ull, 5.5f, 1./3., (char)'|', "%d ", str1, (bool)false);
+            const char* expected = "-1234" "5.5" "0.3333333333333333" "|%d GPStringfalse";
+            gp_expect(gp_str_equal(str, expected, strlen(expected)), str);
+
+            // Floating point types are converted like in gp_str_print().
+            GPStringBuffer(127) buf3;
+            GPString printed = gp_str_buffered(NULL, &buf3);
+            gp_str_print_values(&str, 1.f/3, " ", 0.1 + 0.2);
+            gp_str_print(&printed, 1.f/3, " ", 0.1 + 0.2);
+            gp_expect(gp_str_equal(str, printed, gp_str_length(printed)), str, printed);
+            #if GP_HAS_LONG_DOUBLE
+            gp_str_print_values(&str, 1.0L/3);
+            gp_str_print(&printed, 1.0L/3);
+            gp_expect(gp_str_equal(str, printed, gp_str_length(printed)), str, printed);
+            #endif
+
+            gp_str_print_values(&str, gp_int128(-1, 0), gp_uint128(1, 0), (void*)NULL);
+            const char* cstr = "-18446744073709551616" "18446744073709551616" "(nil)";
+            gp_expect(gp_str_equal(str, cstr, strlen(cstr)), str);
+
+            gp_str_println_values(&str, "Spaces", 3, "inserted.");
+            cstr = "Spaces 3 inserted.\n";
+            gp_expect(gp_str_equal(str, cstr, strlen(cstr)), str);
+
+            GPStringBuffer(16) buf2;
+            str = gp_str_buffered(NULL, &buf2);
+            const size_t trunced = gp_str_println_values(&str, "Truncated output", 1234);
+            gp_expect(gp_str_equal(str, "Truncated output", 16), str);
+            gp_expect(trunced == strlen(" 1234\n"), trunced);
+
+            str = gp_str_new(gp_global_heap, 0);
+            gp_str_print_values(&str, "Growing ", 1, " time only");
+            gp_expect(gp_str_equal(str, "Growing 1 time only", strlen("Growing 1 time only")), str);
+            gp_str_delete(str);
+        }
     } // gp_suite("String Print");
     #endif
 
@@ -568,6 +793,31 @@ int main(void)
             gp_str_to_title(&str);
             gp_expect(gp_str_equal(str, "AÄǈǈǈǲ", strlen("AÄǈǈǈǲ")), str);
         }
+
+        gp_test("Recent additions");
+        {
+            const char* cstr_lower = "ɜʂ ԯ ა";
+            const char* cstr_upper = "ꞫꟅ Ԯ Ა";
+            gp_str_copy(&str, cstr_lower, strlen(cstr_lower));
+            gp_str_to_upper(&str);
+            gp_expect(gp_str_equal(str, cstr_upper, strlen(cstr_upper)), str);
+            gp_str_to_lower(&str);
+            gp_expect(gp_str_equal(str, cstr_lower, strlen(cstr_lower)), str);
+
+            // Georgian Mkhedruli is not capitalized in titlecase
+            gp_str_to_title(&str);
+            const char* cstr_title = "ꞫꟅ Ԯ ა";
+            gp_expect(gp_str_equal(str, cstr_title, strlen(cstr_title)), str);
+
+            // Unicode 16.0
+            cstr_lower = "\u0264\u019B \u1C8A \U00010D70";
+            cstr_upper = "\uA7CB\uA7DC \u1C89 \U00010D50";
+            gp_str_copy(&str, cstr_lower, strlen(cstr_lower));
+            gp_str_to_upper(&str);
+            gp_expect(gp_str_equal(str, cstr_upper, strlen(cstr_upper)), str);
+            gp_str_to_lower(&str);
+            gp_expect(gp_str_equal(str, cstr_lower, strlen(cstr_lower)), str);
+        }
     }
 
     gp_suite("Validate");
@@ -11,6 +11,58 @@
 #include <uchar.h>
 #endif
 
+// Join segments with '|' for easy comparison.
+static const char* segments(char buf[256], GPSegmentIterator it)
+{
+    size_t length = 0;
+    while (gp_segment_next(&it)) {
+        if (length != 0)
+            buf[length++] = '|';
+        memcpy(buf + length, it.segment, it.segment_length);
+        length += it.segment_length;
+    }
+    buf[length] = '\0';
+    return buf;
+}
+
+// Runs test cases of a file in the format of UCD break tests like
+// GraphemeBreakTest.txt, where each line is "÷ 0061 × 0308 ÷ 0062 ÷".
+static void break_test(const char* path, GPSegmentIterator(*iterator)(const void*, size_t))
+{
+    FILE* f = fopen(path, "r");
+    gp_assert(f != NULL, path);
+    char line[1024];
+    size_t cases = 0;
+    while (fgets(line, sizeof line, f) != NULL)
+    {
+        char* comment = strchr(line, '#');
+        if (comment != NULL)
+            *comment = '\0';
+        char   str[512];
+        bool   expected[sizeof str + 1] = {0}; // break before str[i]
+        bool   actual[sizeof str + 1]   = {0};
+        size_t length = 0;
+        for (char* token = strtok(line, " \t\r\n"); token != NULL; token = strtok(NULL, " \t\r\n"))
+        {
+            if (strcmp(token, "÷") == 0)
+                expected[length] = true;
+            else if (strcmp(token, "×") != 0)
+                length += gp_utf8_encode(str + length, strtoul(token, NULL, 16), NULL);
+        }
+        if (length == 0)
+            continue;
+        ++cases;
+
+        expected[0] = false; // sot is not a segment boundary
+        GPSegmentIterator it = iterator(str, length);
+        while (gp_segment_next(&it))
+            actual[it.position] = true;
+        gp_expect(memcmp(expected, actual, length + 1) == 0, path, cases);
+    }
+    gp_expect(cases > 0, path);
+    fclose(f);
+}
+
 int main(void)
 {
     // Tiny arena to put address sanitizer to work
@@ -69,6 +121,80 @@ int main(void)
         }
         #endif
 
+        gp_test("Long strings");
+        {
+            // Mix ASCII runs of different lengths with multibyte codepoints to
+            // go through both SIMD blocks and scalar tails.
+            static const char* pieces[] = {
+                "a", "bcdefghijklmnopqrstu", "ß", "水", "🍌", " ", "\xF4\x8F\xBF\xBF",
+                "0123456789012345678901234567890123456789", "\xEF\xBF\xBF", "\x7F" };
+            GPRandomState rs = gp_random_state_seed(1, 0);
+            GPString utf8 = gp_str_new(gp_global_heap, 256);
+            GPString result = gp_str_new(gp_global_heap, 0);
+            GPArray(uint32_t) utf32 = gp_arr_new(sizeof utf32[0], gp_global_heap, 0);
+            GPArray(uint16_t) utf16 = gp_arr_new(sizeof utf16[0], gp_global_heap, 0);
+
+            for (size_t i = 0; i < 300; ++i) {
+                const char* piece = pieces[gp_random_bound(&rs, sizeof pieces / sizeof pieces[0])];
+                gp_str_append(&utf8, piece, strlen(piece));
+
+                gp_utf32_from_utf8(&utf32, utf8, gp_str_length(utf8));
+                gp_assert(gp_arr_length(utf32) == gp_utf32_length_from_utf8(utf8, gp_str_length(utf8)));
+                size_t j = 0;
+                for (size_t k = 0; k < gp_str_length(utf8); ++j) {
+                    uint32_t decoding;
+                    k += gp_utf8_decode(&decoding, utf8, gp_str_length(utf8), k, &(bool){0});
+                    gp_assert(utf32[j] == decoding, i, j, utf32[j], decoding);
+                }
+                gp_assert(j == gp_arr_length(utf32));
+                gp_assert(gp_utf8_length_from_utf32(utf32, gp_arr_length(utf32)) == gp_str_length(utf8));
+                gp_utf8_from_utf32(&result, utf32, gp_arr_length(utf32));
+                gp_assert(gp_str_equal(result, utf8, gp_str_length(utf8)), i);
+
+                gp_utf16_from_utf8(&utf16, utf8, gp_str_length(utf8));
+                gp_assert(gp_arr_length(utf16) == gp_utf16_length_from_utf8(utf8, gp_str_length(utf8)));
+                gp_assert(gp_utf8_length_from_utf16(utf16, gp_arr_length(utf16)) == gp_str_length(utf8));
+                gp_utf8_from_utf16(&result, utf16, gp_arr_length(utf16));
+                gp_assert(gp_str_equal(result, utf8, gp_str_length(utf8)), i);
+            }
+
+            // Invalid sequence in the middle of a long string
+            const size_t length = gp_str_length(utf8);
+            gp_str_insert(&utf8, length/2 - length/2 % 64, "\xC0\xAF\xED\xA0\x80", 5);
+            gp_utf32_from_utf8(&utf32, utf8, gp_str_length(utf8));
+            gp_utf8_from_utf32(&result, utf32, gp_arr_length(utf32));
+            gp_expect(gp_str_equal(result, utf8, gp_str_length(utf8)));
+
+            gp_str_delete(utf8);
+            gp_str_delete(result);
+            gp_arr_delete(utf32);
+            gp_arr_delete(utf16);
+        }
+
+        gp_test("Wide strings in preallocated memory");
+        {
+            const char utf8[] = "z\u00DF\u6C34\U0001F34C";
+            const size_t utf8_length = strlen(utf8);
+            wchar_t wcs[16];
+            const size_t wcs_length = gp_wcs_from_utf8_unsafe(wcs, utf8, utf8_length);
+            gp_expect(wcs_length == gp_wcs_length_from_utf8(utf8, utf8_length));
+            gp_expect(wcs[wcs_length] == L'\0');
+            gp_expect(wcs[0] == L'z' && wcs[1] == 0xDF && wcs[2] == 0x6C34);
+
+            char result[32];
+            gp_expect(gp_utf8_length_from_wcs(wcs, wcs_length) == utf8_length);
+            gp_expect(gp_utf8_from_wcs_unsafe(result, wcs, wcs_length) == utf8_length);
+            gp_expect(memcmp(result, utf8, utf8_length) == 0);
+
+            // Invalid sequences survive a round trip
+            const char invalid[] = "\x80" "a\xC0\xAF\xF0\x9F";
+            wchar_t invalid_wcs[2 * sizeof invalid];
+            const size_t invalid_wcs_length = gp_wcs_from_utf8_unsafe(
+                invalid_wcs, invalid, strlen(invalid));
+            gp_expect(gp_utf8_from_wcs_unsafe(result, invalid_wcs, invalid_wcs_length) == strlen(invalid));
+            gp_expect(memcmp(result, invalid, strlen(invalid)) == 0);
+        }
+
         // All other conversions work pretty much the same. They are tested
         // elsewhere.
     } // gp_suite("Conversions");
@@ -97,6 +223,73 @@ int main(void)
         gp_arr_delete(utf32);
     }
 
+    gp_suite("Codepoint Index");
+    {
+        // Long enough for SIMD blocks, stray continuation bytes and truncated
+        // sequences are codepoints of their own.
+        static const char* pieces[] = {
+            "abcdefghijklmnopq", "\u00E4", "\u20AC", "\U0001F34C", "\x80", "\xBF\xBF",
+            "\xF0\x9F", "\xE2", "\xC0", "\xFF", " " };
+        GPRandomState rs = gp_random_state_seed(2, 0);
+        GPString str = gp_str_new(gp_global_heap, 1024);
+        GPArray(size_t) starts = gp_arr_new(sizeof starts[0], gp_global_heap, 256);
+
+        for (size_t i = 0; i < 400; ++i) {
+            const char* piece = pieces[gp_random_bound(&rs, sizeof pieces / sizeof pieces[0])];
+            gp_str_append(&str, piece, strlen(piece));
+        }
+        const size_t length = gp_str_length(str);
+
+        gp_arr_set(starts)->length = 0;
+        for (size_t cp_length, i = 0; i < length; i += cp_length) {
+            gp_arr_push(sizeof starts[0], &starts, &i);
+            cp_length = gp_max(gp_utf8_decode_codepoint_length(str, i), (size_t)1);
+            for (size_t j = i + 1; j < i + cp_length; ++j) {
+                if (j == length || (str[j].c & 0xC0) != 0x80) {
+                    cp_length = j - i;
+                    break;
+                }
+            }
+        }
+
+        gp_test("Codepoint count");
+        {
+            gp_expect(gp_str_codepoint_count(str) == gp_arr_length(starts),
+                gp_str_codepoint_count(str), gp_arr_length(starts));
+        }
+
+        gp_test("Index");
+        {
+            const size_t strides[] = { 0, 1, 7, 1000 };
+            for (size_t s = 0; s < sizeof strides / sizeof strides[0]; ++s)
+            {
+                GPUtf8Index index = gp_utf8_index_new(gp_global_heap, str, length, strides[s]);
+                gp_assert(gp_utf8_index_codepoint_count(index) == gp_arr_length(starts));
+
+                for (size_t i = 0; i < gp_arr_length(starts); ++i) {
+                    gp_assert(gp_utf8_index_byte_index(index, i) == starts[i],
+                        strides[s], i, gp_utf8_index_byte_index(index, i), starts[i]);
+                    const size_t next = i + 1 < gp_arr_length(starts) ? starts[i + 1] : length;
+                    for (size_t j = starts[i]; j < next; ++j)
+                        gp_assert(gp_utf8_index_codepoint_index(index, j) == i,
+                            strides[s], j, gp_utf8_index_codepoint_index(index, j), i);
+                }
+                gp_expect(gp_utf8_index_byte_index(index, gp_arr_length(starts)) == length);
+                gp_expect(gp_utf8_index_codepoint_index(index, length) == gp_arr_length(starts));
+                gp_utf8_index_delete(index);
+            }
+
+            GPUtf8Index index = gp_utf8_index_new(gp_global_heap, "", 0, 0);
+            gp_expect(gp_utf8_index_codepoint_count(index) == 0);
+            gp_expect(gp_utf8_index_byte_index(index, 0) == 0);
+            gp_expect(gp_utf8_index_codepoint_index(index, 0) == 0);
+            gp_utf8_index_delete(index);
+        }
+
+        gp_str_delete(str);
+        gp_arr_delete(starts);
+    }
+
     gp_suite("String Extensions");
     {
         const char* turkish    = "tr_TR";
@@ -171,6 +364,28 @@ int main(void)
             gp_expect(gp_str_equal(str, "İasdf", strlen("İasdf")));
         }
 
+        gp_test("Locale handles");
+        {
+            gp_expect(gp_locale_handle(NULL) == NULL);
+            gp_expect(gp_locale_handle("") == gp_locale_handle(""));
+            GPLocaleHandle tr = gp_locale_handle(turkish);
+            GPLocaleHandle lt = gp_locale_handle(lithuanian);
+            gp_expect(tr != lt);
+            gp_expect(gp_locale_handle(turkish) == tr, "Cached handle should be reused.");
+            gp_expect(gp_locale(turkish) == gp_locale(turkish));
+
+            GPString str = gp_str_new_init(arena, 64, "iasdf");
+            gp_str_to_upper_full_l(&str, tr);
+            gp_expect(gp_str_equal(str, "İASDF", strlen("İASDF")), str);
+            gp_str_to_lower_full_l(&str, tr);
+            gp_expect(gp_str_equal(str, "iasdf", strlen("iasdf")), str);
+            gp_str_capitalize_l(&str, tr);
+            gp_expect(gp_str_equal(str, "İasdf", strlen("İasdf")), str);
+
+            gp_expect(gp_str_compare_l(str, "iasdf", strlen("iasdf"), GP_CASE_FOLD, tr) == 0);
+            gp_expect(gp_str_compare_l(str, "iasdf", strlen("iasdf"), GP_CASE_FOLD, lt) != 0);
+        }
+
         gp_test("Split and join");
         {
             GPString str = gp_str_new_init(arena, 64, "\t\tHello, I'm  the Prince!\r\n");
@@ -199,6 +414,100 @@ int main(void)
             gp_expect(gp_str_equal(substrs[3], "Prince!", strlen("Prince!")));
         }
 
+        gp_test("Split iterator");
+        {
+            const char* str = "\t\tHello, I'm  the\u00A0Prince!\r\n";
+            const char* tokens[] = { "Hello,", "I'm", "the", "Prince!" };
+            GPStrSplitIterator it = gp_str_split_iterator(
+                str, strlen(str), GP_WHITESPACE "\u00A0", 0, 0);
+            size_t i = 0;
+            while (gp_str_split_next(&it)) {
+                gp_assert(i < 4);
+                gp_expect(gp_bytes_equal(
+                    it.token, it.token_length, tokens[i], strlen(tokens[i])),
+                    i, it.token);
+                ++i;
+            }
+            gp_expect(i == 4, i);
+
+            const char* csv = "a, b,, c";
+            it = gp_str_split_iterator(csv, strlen(csv), ", ", GP_SPLIT_STRING, 2);
+            gp_assert(gp_str_split_next(&it));
+            gp_expect(gp_bytes_equal(it.token, it.token_length, "a", 1));
+            gp_assert(gp_str_split_next(&it));
+            gp_expect(gp_bytes_equal(it.token, it.token_length, "b,", 2));
+            gp_assert(gp_str_split_next(&it));
+            gp_expect(gp_bytes_equal(it.token, it.token_length, "c", 1));
+            gp_expect( ! gp_str_split_next(&it));
+
+            it = gp_str_split_iterator(csv, strlen(csv), ",", GP_SPLIT_STRING, 0);
+            const char* fields[] = { "a", " b", "", " c" };
+            for (i = 0; gp_str_split_next(&it); ++i)
+                gp_expect(gp_bytes_equal(
+                    it.token, it.token_length, fields[i], strlen(fields[i])), i);
+            gp_expect(i == 4, i);
+
+            gp_test("Stream");
+            {
+                FILE* f;
+                gp_assert((f = tmpfile()) != NULL);
+                fputs("one\u2028two\u2028\u2028three_is_long\u2028", f);
+                rewind(f);
+
+                char buf[8];
+                it = gp_file_split_iterator(f, buf, sizeof buf, "\u2028", 0, 0);
+                gp_assert(gp_str_split_next(&it));
+                gp_expect(gp_bytes_equal(it.token, it.token_length, "one", 3));
+                gp_assert(gp_str_split_next(&it));
+                gp_expect(gp_bytes_equal(it.token, it.token_length, "two", 3));
+
+                char long_token[32] = "";
+                do {
+                    gp_assert(gp_str_split_next(&it));
+                    strncat(long_token, it.token, it.token_length);
+                } while (it.partial);
+                gp_expect(strcmp(long_token, "three_is_long") == 0, long_token);
+                gp_expect( ! gp_str_split_next(&it));
+
+                rewind(f);
+                it = gp_file_split_iterator(f, buf, sizeof buf, "\u2028", GP_SPLIT_STRING, 1);
+                gp_assert(gp_str_split_next(&it));
+                gp_expect(gp_bytes_equal(it.token, it.token_length, "one", 3));
+                size_t rest_length = 0;
+                while (gp_str_split_next(&it))
+                    rest_length += it.token_length;
+                gp_expect(rest_length == strlen("two\u2028\u2028three_is_long\u2028"),
+                    rest_length);
+
+                // Separators are found up to the end of the buffer.
+                fclose(f);
+                gp_assert((f = tmpfile()) != NULL);
+                fputs("abcde,fg", f);
+                rewind(f);
+                it = gp_file_split_iterator(f, buf, sizeof buf, ",", 0, 0);
+                gp_assert(gp_str_split_next(&it));
+                gp_expect( ! it.partial && gp_bytes_equal(it.token, it.token_length, "abcde", 5));
+                gp_assert(gp_str_split_next(&it));
+                gp_expect( ! it.partial && gp_bytes_equal(it.token, it.token_length, "fg", 2));
+                gp_expect( ! gp_str_split_next(&it));
+
+                // Token fills the buffer, the last part of it is not empty.
+                fclose(f);
+                gp_assert((f = tmpfile()) != NULL);
+                fputs("abcdef\u00e4,x", f);
+                rewind(f);
+                it = gp_file_split_iterator(f, buf, sizeof buf, ",", 0, 0);
+                gp_assert(gp_str_split_next(&it));
+                gp_expect(it.partial && gp_bytes_equal(it.token, it.token_length, "abcdef", 6));
+                gp_assert(gp_str_split_next(&it));
+                gp_expect( ! it.partial && gp_bytes_equal(it.token, it.token_length, "\u00e4", 2));
+                gp_assert(gp_str_split_next(&it));
+                gp_expect( ! it.partial && gp_bytes_equal(it.token, it.token_length, "x", 1));
+                gp_expect( ! gp_str_split_next(&it));
+                fclose(f);
+            }
+        }
+
         gp_test("Case insensitive but locale sensitive comparison");
         {
             GPStringBuffer(64) buf1;
@@ -220,6 +529,15 @@ int main(void)
                     gp_str_length(str2),
                     0,
                     "") > 0);
+
+                // Cherokee folds to uppercase
+                GPStringBuffer(64) buf3;
+                GPString cherokee = gp_str_buffered(NULL, &buf3, "\u13A0\u13F0");
+                gp_expect(gp_str_compare(
+                    cherokee, "\uAB70\u13F8",
+                    strlen("\uAB70\u13F8"),
+                    GP_CASE_FOLD,
+                    "") == 0);
             }
 
             const char* czech = "cs_CZ";
@@ -294,6 +612,37 @@ int main(void)
             gp_expect(gp_str_equal(strs[3], "asdf",    strlen("asdf")));
             gp_expect(gp_str_equal(strs[4], "Sbloink", strlen("Sbloink")));
 
+            // Many strings with long common prefixes
+            GPRandomState rs = gp_random_state_seed(42, 0);
+            GPArray(GPString) many = gp_arr_new(sizeof many[0], gp_global_heap, 2000);
+            const char* alphabet[] = { "a", "b", "ä", "水", "🍌" };
+            for (size_t i = 0; i < 2000; ++i) {
+                GPString str = gp_str_new(gp_global_heap, 16);
+                gp_str_copy(&str, "prefix", gp_random_bound(&rs, strlen("prefix") + 1));
+                for (size_t j = gp_random_bound(&rs, 8); j > 0; --j) {
+                    const char* c = alphabet[gp_random_bound(&rs, 5)];
+                    gp_str_append(&str, c, strlen(c));
+                }
+                gp_arr_push(sizeof many[0], &many, &str);
+            }
+            gp_str_sort(&many, 0, "");
+            for (size_t i = 1; i < gp_arr_length(many); ++i)
+                gp_assert(gp_str_compare(many[i-1], many[i], gp_str_length(many[i]), 0, NULL) <= 0,
+                    many[i-1], many[i]);
+            gp_str_sort(&many, GP_REVERSE, "");
+            for (size_t i = 1; i < gp_arr_length(many); ++i)
+                gp_assert(gp_str_compare(many[i-1], many[i], gp_str_length(many[i]), 0, NULL) >= 0,
+                    many[i-1], many[i]);
+            for (size_t i = 0; i < gp_arr_length(many); ++i)
+                gp_str_delete(many[i]);
+            gp_arr_delete(many);
+
+            // Invalid UTF-8 is converted to wide strings without overflowing
+            GPString invalid = gp_str_new(arena, 16);
+            gp_str_copy(&invalid, "\x80\xBF" "a\xF0\x9F", strlen("\x80\xBF" "a\xF0\x9F"));
+            gp_expect(gp_str_compare(invalid, invalid, gp_str_length(invalid), GP_COLLATE, "") == 0);
+            gp_expect(gp_str_compare(invalid, invalid, gp_str_length(invalid), GP_CASE_FOLD | GP_COLLATE, "") == 0);
+
             if (gp_locale(turkish) == (GPLocale)0)
                 goto skip_turkish_sort;
 
@@ -306,6 +655,263 @@ int main(void)
             gp_expect(gp_str_equal_case(strs[4], "sbloink", strlen("sbloink")));
             skip_turkish_sort: (void)0;
         }
+
+        gp_test("Sort keys");
+        {
+            const char* strs[] = { "sbloink", "Sbloink", "i", "I", "asdf", "İ", "ı", "äö", "Äa", "", "a" };
+            const size_t strs_length = sizeof strs / sizeof strs[0];
+            const int flags[] = { 0, GP_CASE_FOLD, GP_COLLATE, GP_CASE_FOLD | GP_COLLATE };
+            const char* locales[] = { NULL, "", turkish };
+            GPString key1 = gp_str_new(gp_global_heap, 8);
+            GPString key2 = gp_str_new(gp_global_heap, 8);
+
+            for (size_t l = 0; l < sizeof locales / sizeof locales[0]; ++l)
+            for (size_t f = 0; f < sizeof flags / sizeof flags[0]; ++f)
+            for (size_t i = 0; i < strs_length; ++i)
+            for (size_t j = 0; j < strs_length; ++j)
+            {
+                if (locales[l] != NULL && locales[l][0] != '\0' && gp_locale(locales[l]) == (GPLocale)0)
+                    continue;
+                gp_str_sort_key(&key1, strs[i], strlen(strs[i]), flags[f], locales[l]);
+                gp_str_sort_key(&key2, strs[j], strlen(strs[j]), flags[f], locales[l]);
+                int key_result = memcmp(key1, key2, gp_min(gp_str_length(key1), gp_str_length(key2)));
+                if (key_result == 0)
+                    key_result = (gp_str_length(key1) > gp_str_length(key2)) - (gp_str_length(key1) < gp_str_length(key2));
+
+                GPString str = gp_str_new(gp_global_heap, 8);
+                gp_str_copy(&str, strs[i], strlen(strs[i]));
+                const int result = gp_str_compare(str, strs[j], strlen(strs[j]), flags[f], locales[l]);
+                gp_str_delete(str);
+                gp_assert((key_result > 0) == (result > 0) && (key_result < 0) == (result < 0),
+                    strs[i], strs[j], flags[f], locales[l], key_result, result);
+            }
+            gp_str_delete(key1);
+            gp_str_delete(key2);
+        }
+
+        gp_test("Case folding");
+        {
+            const char* str = "Stra\u00DFe \uFB03";
+            GPFoldIterator it = gp_fold_iterator(str, strlen(str), NULL);
+            const uint32_t expected[] = { 's', 't', 'r', 'a', 's', 's', 'e', ' ', 'f', 'f', 'i' };
+            size_t i = 0;
+            for (; gp_fold_next(&it); ++i)
+                gp_assert(i < sizeof expected / sizeof expected[0] && it.codepoint == expected[i], i);
+            gp_expect(i == sizeof expected / sizeof expected[0]);
+
+            gp_expect(  gp_utf8_equal_fold("STRASSE", strlen("STRASSE"), "stra\u00DFe", strlen("stra\u00DFe"), NULL));
+            gp_expect(  gp_utf8_equal_fold("\u1F88", strlen("\u1F88"), "\u1F00\u03B9", strlen("\u1F00\u03B9"), NULL));
+            gp_expect( ! gp_utf8_equal_fold("STRASSE", strlen("STRASSE"), "strase", strlen("strase"), NULL));
+            gp_expect( ! gp_utf8_equal_fold("a", 1, "", 0, NULL));
+
+            gp_expect(  gp_utf8_starts_with_fold("Stra\u00DFe", strlen("Stra\u00DFe"), "STRAS", strlen("STRAS"), NULL));
+            gp_expect(  gp_utf8_starts_with_fold("abc", 3, "", 0, NULL));
+            gp_expect( ! gp_utf8_starts_with_fold("ab", 2, "ABC", 3, NULL));
+
+            const char* strs[] = { "", "a", "A", "b", "\u00C4", "\u00E4", "ss", "\u00DF", "SSa", "\u00DF\u00DF", "I", "\u0131", "\u0130", "z\U00010400" };
+            const size_t strs_length = sizeof strs / sizeof strs[0];
+            for (size_t i = 0; i < strs_length; ++i)
+            for (size_t j = 0; j < strs_length; ++j)
+            {
+                const int result = gp_utf8_compare_fold(strs[i], strlen(strs[i]), strs[j], strlen(strs[j]), NULL);
+                gp_assert((result == 0) == gp_utf8_equal_fold(strs[i], strlen(strs[i]), strs[j], strlen(strs[j]), NULL));
+                gp_assert((result < 0) == (gp_utf8_compare_fold(strs[j], strlen(strs[j]), strs[i], strlen(strs[i]), NULL) > 0));
+                if (result == 0)
+                    gp_assert(gp_utf8_hash_fold(strs[i], strlen(strs[i]), NULL) == gp_utf8_hash_fold(strs[j], strlen(strs[j]), NULL),
+                        strs[i], strs[j]);
+            }
+
+            gp_expect(gp_utf8_hash_fold("Stra\u00DFE", strlen("Stra\u00DFE"), NULL) == gp_bytes_hash("strasse", strlen("strasse")));
+
+            // Cherokee folds to uppercase
+            it = gp_fold_iterator("\uAB70\u13F8\u13A0", strlen("\uAB70\u13F8\u13A0"), NULL);
+            const uint32_t cherokee[] = { 0x13A0, 0x13F0, 0x13A0 };
+            for (i = 0; gp_fold_next(&it); ++i)
+                gp_assert(i < 3 && it.codepoint == cherokee[i], i, it.codepoint);
+            gp_expect(i == 3);
+            gp_expect(gp_utf8_equal_fold("\u13A0\u13F5", strlen("\u13A0\u13F5"), "\uAB70\u13FD", strlen("\uAB70\u13FD"), NULL));
+            gp_expect(gp_utf8_hash_fold("\u13A0", strlen("\u13A0"), NULL) == gp_utf8_hash_fold("\uAB70", strlen("\uAB70"), NULL));
+
+            GPLocaleHandle turkish_locale = gp_locale_handle(turkish);
+            if (turkish_locale != NULL) {
+                gp_expect(  gp_utf8_equal_fold("I", 1, "\u0131", strlen("\u0131"), turkish_locale));
+                gp_expect(  gp_utf8_equal_fold("\u0130", strlen("\u0130"), "i", 1, turkish_locale));
+                gp_expect( ! gp_utf8_equal_fold("I", 1, "i", 1, turkish_locale));
+            }
+            gp_expect(gp_utf8_equal_fold("I", 1, "i", 1, gp_locale_handle("")));
+        }
+    }
+
+    gp_suite("Text Segmentation");
+    {
+        char buf[256];
+        #define GRAPHEMES(STR) segments(buf, gp_grapheme_iterator(STR, strlen(STR)))
+        #define WORDS(STR)     segments(buf, gp_word_iterator(STR, strlen(STR)))
+        #define LINES(STR)     segments(buf, gp_line_break_iterator(STR, strlen(STR)))
+
+        gp_test("Graphemes");
+        {
+            gp_expect(strcmp(GRAPHEMES(""), "") == 0, buf);
+            gp_expect(strcmp(GRAPHEMES("abc"), "a|b|c") == 0, buf);
+            gp_expect(strcmp(GRAPHEMES("e\u0301x"), "e\u0301|x") == 0, buf);
+            gp_expect(strcmp(GRAPHEMES("a\r\nb"), "a|\r\n|b") == 0, buf);
+            gp_expect(strcmp(GRAPHEMES("🇫🇮🇸🇪🇳"), "🇫🇮|🇸🇪|🇳") == 0, buf);
+            gp_expect(strcmp(GRAPHEMES("👨‍👩‍👧!"), "👨‍👩‍👧|!") == 0, buf);
+            gp_expect(strcmp(GRAPHEMES("\u1100\u1161\u11A8\u1100"), "\u1100\u1161\u11A8|\u1100") == 0, buf);
+            gp_expect(strcmp(GRAPHEMES("👍🏽x"), "👍🏽|x") == 0, buf);
+        }
+
+        gp_test("Words");
+        {
+            gp_expect(strcmp(WORDS("Hello, world! It's 3.14."),
+                "Hello|,| |world|!| |It's| |3.14|.") == 0, buf);
+            gp_expect(strcmp(WORDS("snake_case  e\u0301t\u00E9"), "snake_case|  |e\u0301t\u00E9") == 0, buf);
+            gp_expect(strcmp(WORDS("水水ｶﾀｶﾅ"), "水|水|ｶﾀｶﾅ") == 0, buf);
+            gp_expect(strcmp(WORDS("a\r\n\r\nb"), "a|\r\n|\r\n|b") == 0, buf);
+            gp_expect(strcmp(WORDS("🇫🇮🇸🇪"), "🇫🇮|🇸🇪") == 0, buf);
+            gp_expect(strcmp(WORDS("ab12ćd e3.4f"), "ab12ćd| |e3.4f") == 0, buf);
+
+            // ASCII runs are not looked up from the table
+            for (char c = 0; c < 0x7F; ++c) if (gp_s_is_ascii_alnum(c)) {
+                const GPBreakProperty p1 = gp_s_break_property(&c, 1, 0);
+                const GPBreakProperty p2 = gp_s_ascii_alnum_break_property(c);
+                gp_assert(p1.codepoint == p2.codepoint && p1.length == p2.length, c);
+                gp_assert(p1.grapheme == p2.grapheme && p1.word == p2.word, c, p1.word, p2.word);
+                gp_assert(p1.line == p2.line && p1.flags == p2.flags, c, p1.line, p2.line, p1.flags);
+            }
+        }
+
+        gp_test("Line breaks");
+        {
+            gp_expect(strcmp(LINES("Hello world-wide (test)."), "Hello |world-|wide |(test).") == 0, buf);
+            gp_expect(strcmp(LINES("costs $12.50, (maybe)"), "costs |$12.50, |(maybe)") == 0, buf);
+            gp_expect(strcmp(LINES("水水。水"), "水|水。|水") == 0, buf);
+            gp_expect(strcmp(LINES("no\u00A0break"), "no\u00A0break") == 0, buf);
+
+            GPSegmentIterator it = gp_line_break_iterator("a\nb c", strlen("a\nb c"));
+            gp_assert(gp_segment_next(&it));
+            gp_expect(it.segment_length == 2 && it.mandatory);
+            gp_assert(gp_segment_next(&it));
+            gp_expect(it.segment_length == 2 && ! it.mandatory);
+            gp_assert(gp_segment_next(&it));
+            gp_expect(it.segment_length == 1 && it.mandatory, "End of text is a hard break.");
+            gp_expect( ! gp_segment_next(&it));
+        }
+
+        gp_test("Conformance");
+        {
+            break_test("tests/data/GraphemeBreakTest.txt", gp_grapheme_iterator);
+            break_test("tests/data/WordBreakTest.txt",     gp_word_iterator);
+            break_test("tests/data/LineBreakTest.txt",     gp_line_break_iterator);
+        }
+
+        gp_test("Invalid UTF-8");
+        { // Invalid bytes are segments of their own, but never split valid text
+            gp_expect(strcmp(GRAPHEMES("a\xFF\xFE" "b"), "a|\xFF|\xFE|b") == 0, buf);
+            gp_expect(strcmp(WORDS("ab\xFF cd"), "ab|\xFF| |cd") == 0, buf);
+        }
+
+        #undef GRAPHEMES
+        #undef WORDS
+        #undef LINES
+    }
+
+    gp_suite("Normalization");
+    {
+        #define EXPECT_NORMALIZED(FORM, STR, EXPECTED) do { \
+            gp_utf8_normalize(&str, STR, strlen(STR), FORM); \
+            gp_expect(gp_str_equal(str, EXPECTED, strlen(EXPECTED)), str); \
+        } while (0)
+        GPString str = gp_str_new(arena, 1);
+
+        gp_test("Quick check");
+        {
+            const char* ascii = "Lorem ipsum dolor sit amet, consectetur adipiscing elit.";
+            for (GPNormalForm form = GP_NFC; form <= GP_NFKD; ++form)
+                gp_expect(gp_utf8_normalization_quick_check(ascii, strlen(ascii), form) == GP_NORMALIZED_YES);
+
+            gp_expect(gp_utf8_normalization_quick_check("\u00E9", strlen("\u00E9"), GP_NFC) == GP_NORMALIZED_YES);
+            gp_expect(gp_utf8_normalization_quick_check("\u00E9", strlen("\u00E9"), GP_NFD) == GP_NORMALIZED_NO);
+            gp_expect(gp_utf8_normalization_quick_check("e\u0301", strlen("e\u0301"), GP_NFC) == GP_NORMALIZED_MAYBE);
+            gp_expect(gp_utf8_normalization_quick_check("e\u0301", strlen("e\u0301"), GP_NFD) == GP_NORMALIZED_YES);
+            gp_expect(gp_utf8_normalization_quick_check("\uFB01", strlen("\uFB01"), GP_NFC)  == GP_NORMALIZED_YES);
+            gp_expect(gp_utf8_normalization_quick_check("\uFB01", strlen("\uFB01"), GP_NFKC) == GP_NORMALIZED_NO);
+            gp_expect(gp_utf8_normalization_quick_check("\uAC01", strlen("\uAC01"), GP_NFC)  == GP_NORMALIZED_YES);
+            gp_expect(gp_utf8_normalization_quick_check("\uAC01", strlen("\uAC01"), GP_NFD)  == GP_NORMALIZED_NO);
+
+            // Wrong canonical order
+            for (GPNormalForm form = GP_NFC; form <= GP_NFKD; ++form)
+                gp_expect(gp_utf8_normalization_quick_check(
+                    "a\u0301\u0323", strlen("a\u0301\u0323"), form) == GP_NORMALIZED_NO);
+
+            gp_expect(  gp_utf8_is_normalized("\u0301", strlen("\u0301"), GP_NFC));
+            gp_expect( ! gp_utf8_is_normalized("e\u0301", strlen("e\u0301"), GP_NFC));
+            gp_expect(  gp_utf8_is_normalized("\u00E9\u0301", strlen("\u00E9\u0301"), GP_NFC));
+        }
+
+        gp_test("Normalize");
+        { // Examples from UAX #15
+            EXPECT_NORMALIZED(GP_NFC,  "\u1E9B\u0323", "\u1E9B\u0323");
+            EXPECT_NORMALIZED(GP_NFD,  "\u1E9B\u0323", "\u017F\u0323\u0307");
+            EXPECT_NORMALIZED(GP_NFKC, "\u1E9B\u0323", "\u1E69");
+            EXPECT_NORMALIZED(GP_NFKD, "\u1E9B\u0323", "s\u0323\u0307");
+
+            EXPECT_NORMALIZED(GP_NFC,  "\u212B",        "\u00C5");
+            EXPECT_NORMALIZED(GP_NFD,  "\u212B",        "A\u030A");
+            EXPECT_NORMALIZED(GP_NFC,  "A\u030A",       "\u00C5");
+            EXPECT_NORMALIZED(GP_NFC,  "\u1E0B\u0323", "\u1E0D\u0307");
+            EXPECT_NORMALIZED(GP_NFC,  "q\u0307\u0323", "q\u0323\u0307");
+            EXPECT_NORMALIZED(GP_NFKC, "\uFB01x\u2075", "fix5");
+            EXPECT_NORMALIZED(GP_NFC,  "Hyv\u00E4\u00E4 p\u00E4iv\u00E4\u00E4", "Hyv\u00E4\u00E4 p\u00E4iv\u00E4\u00E4");
+            EXPECT_NORMALIZED(GP_NFD,  "p\u00E4iv\u00E4", "pa\u0308iva\u0308");
+
+            // Hangul is decomposed and composed algorithmically
+            EXPECT_NORMALIZED(GP_NFC,  "\u1100\u1161\u11A8", "\uAC01");
+            EXPECT_NORMALIZED(GP_NFC,  "\uAC00\u11A8",        "\uAC01");
+            EXPECT_NORMALIZED(GP_NFD,  "\uAC01",               "\u1100\u1161\u11A8");
+
+            // Starters composing with starters
+            EXPECT_NORMALIZED(GP_NFC,  "\u0B47\u0B3E", "\u0B4B");
+
+            // Composition exclusions
+            EXPECT_NORMALIZED(GP_NFC,  "\u0958",        "\u0915\u093C");
+
+            // Long sequence of marks does not fit to stack buffer
+            GPString marks = gp_str_new(arena, 256);
+            GPString expected = gp_str_new(arena, 256);
+            gp_str_copy(&marks, "a", 1);
+            gp_str_copy(&expected, "\u00E0", strlen("\u00E0"));
+            for (size_t i = 0; i < 50; ++i) {
+                gp_str_append(&marks, "\u0300\u0316", strlen("\u0300\u0316"));
+                gp_str_append(&expected, "\u0316", strlen("\u0316"));
+            }
+            for (size_t i = 0; i < 49; ++i)
+                gp_str_append(&expected, "\u0300", strlen("\u0300"));
+            gp_str_normalize(&marks, GP_NFC);
+            gp_expect(gp_str_equal(marks, expected, gp_str_length(expected)));
+        }
+
+        gp_test("In place");
+        {
+            gp_str_copy(&str, "Caf\u00E9 ole\u0301", strlen("Caf\u00E9 ole\u0301"));
+            const GPString original = str;
+            gp_str_normalize(&str, GP_NFC);
+            gp_expect(gp_str_equal(str, "Caf\u00E9 ol\u00E9", strlen("Caf\u00E9 ol\u00E9")), str);
+
+            gp_str_normalize(&str, GP_NFC); // already normalized, nothing happens
+            gp_expect(str == original);
+            gp_expect(gp_str_equal(str, "Caf\u00E9 ol\u00E9", strlen("Caf\u00E9 ol\u00E9")), str);
+
+            gp_str_normalize(&str, GP_NFD);
+            gp_expect(gp_str_equal(str, "Cafe\u0301 ole\u0301", strlen("Cafe\u0301 ole\u0301")), str);
+        }
+
+        gp_test("Invalid UTF-8");
+        { // Invalid sequences are preserved and block composition
+            EXPECT_NORMALIZED(GP_NFC, "a\xFF\u0301\xC3", "a\xFF\u0301\xC3");
+            EXPECT_NORMALIZED(GP_NFD, "\xFF\u00E9\x80", "\xFF" "e\u0301\x80");
+        }
+        #undef EXPECT_NORMALIZED
     }
 
     gp_arena_delete(_arena);
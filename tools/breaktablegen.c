@@ -0,0 +1,412 @@
+// MIT License
+// Copyright (c) 2023 Lauri Lorenzo Fiestas
+// https://github.com/PrinssiFiestas/libGPC/blob/main/LICENSE.md
+
+// Generates src/break_table.h used by text segmentation iterators from the
+// Unicode Character Database. Usage:
+//
+//     gcc -o build/breaktablegen tools/breaktablegen.c
+//     ./build/breaktablegen path/to/ucd 16.0.0 > src/break_table.h
+//
+// The UCD directory can be found in https://www.unicode.org/Public/UCD/latest/
+// and it should contain GraphemeBreakProperty.txt (in auxiliary/ in the
+// official layout, copy it to the root), WordBreakProperty.txt (same),
+// LineBreak.txt, EastAsianWidth.txt, DerivedCoreProperties.txt,
+// extracted/DerivedGeneralCategory.txt, and emoji/emoji-data.txt.
+//
+// Each codepoint maps to a record {grapheme_break, word_break, line_break,
+// flags}. Line break classes are resolved according to rule LB1 of UAX #14, so
+// AI, SG, SA, XX, and CJ never appear in the table. Records are stored in a
+// three-level trie, which is like the two-level trie in tools/casetablegen.c,
+// but the first stage is also split to shared blocks.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <ctype.h>
+
+#define CODEPOINT_COUNT 0x110000
+#define MAX_RECORDS     4096
+
+static const char* grapheme_break_names[] = {
+    "Other", "CR", "LF", "Control", "Extend", "ZWJ", "Regional_Indicator",
+    "Prepend", "SpacingMark", "L", "V", "T", "LV", "LVT" };
+static const char* word_break_names[] = {
+    "Other", "CR", "LF", "Newline", "Extend", "ZWJ", "Regional_Indicator",
+    "Format", "Katakana", "Hebrew_Letter", "ALetter", "Single_Quote",
+    "Double_Quote", "MidNumLet", "MidLetter", "MidNum", "Numeric",
+    "ExtendNumLet", "WSegSpace" };
+// Resolved classes first, then classes that LB1 resolves to others.
+static const char* line_break_names[] = {
+    "AL", "BK", "CR", "LF", "CM", "NL", "WJ", "ZW", "GL", "SP", "ZWJ", "B2",
+    "BA", "BB", "HY", "CB", "CL", "CP", "EX", "IN", "NS", "OP", "QU", "IS",
+    "NU", "PO", "PR", "SY", "EB", "EM", "H2", "H3", "HL", "ID", "JL", "JV",
+    "JT", "RI", "AK", "AP", "AS", "VF", "VI",
+    "AI", "SG", "SA", "XX", "CJ" };
+#define LINE_BREAK_RESOLVED_LENGTH 43
+
+// Flags are only set where rules need them to keep the table small.
+#define FLAG_EXTENDED_PICTOGRAPHIC 0x01
+#define FLAG_EAST_ASIAN_WIDE       0x02 // East_Asian_Width F, W, or H
+#define FLAG_UNASSIGNED            0x04 // only for Extended_Pictographic
+#define FLAG_INCB_CONSONANT        0x08 // Indic_Conjunct_Break
+#define FLAG_INCB_EXTEND           0x10
+#define FLAG_INCB_LINKER           0x20
+#define FLAG_QUOTE_INITIAL         0x40 // QU and Pi
+#define FLAG_QUOTE_FINAL           0x80 // QU and Pf
+
+#define LENGTH(ARR) (sizeof(ARR) / sizeof(ARR)[0])
+
+typedef struct record { uint8_t grapheme_break, word_break, line_break, flags; } Record;
+
+static Record   records[MAX_RECORDS];
+static size_t   records_length;
+static uint16_t record_indices[CODEPOINT_COUNT];
+
+static uint8_t grapheme_breaks[CODEPOINT_COUNT];
+static uint8_t word_breaks[CODEPOINT_COUNT];
+static uint8_t line_breaks[CODEPOINT_COUNT];
+static bool    extended_pictographics[CODEPOINT_COUNT];
+static bool    east_asian_wides[CODEPOINT_COUNT];
+static uint8_t indic_conjunct_breaks[CODEPOINT_COUNT];
+static char    general_categories[CODEPOINT_COUNT][3];
+
+static size_t find_or_add_record(Record r)
+{
+    for (size_t i = 0; i < records_length; ++i)
+        if (memcmp(&records[i], &r, sizeof r) == 0)
+            return i;
+    if (records_length == MAX_RECORDS) {
+        fprintf(stderr, "Too many records.\n");
+        exit(EXIT_FAILURE);
+    }
+    records[records_length] = r;
+    return records_length++;
+}
+
+static char* trim(char* s)
+{
+    while (isspace((unsigned char)*s))
+        ++s;
+    size_t length = strlen(s);
+    while (length > 0 && isspace((unsigned char)s[length - 1]))
+        s[--length] = '\0';
+    return s;
+}
+
+static size_t name_index(const char* name, const char** names, size_t names_length)
+{
+    for (size_t i = 0; i < names_length; ++i)
+        if (strcmp(name, names[i]) == 0)
+            return i;
+    return (size_t)-1;
+}
+
+// Calls f for each range in a file of lines "XXXX..YYYY ; Value # comment".
+// Default values in "# @missing: XXXX..YYYY; Value" lines precede the ranges
+// they are overridden by, so they are applied in order too.
+static void parse_file(
+    const char* dir, const char* file, void(*f)(uint32_t, uint32_t, const char*))
+{
+    char path[4096];
+    snprintf(path, sizeof path, "%s/%s", dir, file);
+    FILE* stream = fopen(path, "r");
+    if (stream == NULL) {
+        perror(path);
+        exit(EXIT_FAILURE);
+    }
+    char line[1024];
+    while (fgets(line, sizeof line, stream) != NULL)
+    {
+        if (strncmp(line, "# @missing:", strlen("# @missing:")) == 0)
+            memmove(line, line + strlen("# @missing:"), strlen(line + strlen("# @missing:")) + 1);
+        char* comment = strchr(line, '#');
+        if (comment != NULL)
+            *comment = '\0';
+        char* separator = strchr(line, ';');
+        if (separator == NULL)
+            continue;
+        *separator = '\0';
+
+        char* end;
+        const uint32_t first = strtoul(line, &end, 16);
+        const uint32_t last  = end[0] == '.' && end[1] == '.' ? strtoul(end + 2, NULL, 16) : first;
+        f(first, last, trim(separator + 1));
+    }
+    fclose(stream);
+}
+
+static void set_general_category(uint32_t first, uint32_t last, const char* value)
+{
+    for (uint32_t c = first; c <= last; ++c)
+        strncpy(general_categories[c], value, 2);
+}
+
+static void set_grapheme_break(uint32_t first, uint32_t last, const char* value)
+{
+    const size_t i = name_index(value, grapheme_break_names, LENGTH(grapheme_break_names));
+    if (i == (size_t)-1) {
+        fprintf(stderr, "Unknown Grapheme_Cluster_Break %s.\n", value);
+        exit(EXIT_FAILURE);
+    }
+    memset(grapheme_breaks + first, i, last - first + 1);
+}
+
+static void set_word_break(uint32_t first, uint32_t last, const char* value)
+{
+    const size_t i = name_index(value, word_break_names, LENGTH(word_break_names));
+    if (i == (size_t)-1) {
+        fprintf(stderr, "Unknown Word_Break %s.\n", value);
+        exit(EXIT_FAILURE);
+    }
+    memset(word_breaks + first, i, last - first + 1);
+}
+
+static void set_line_break(uint32_t first, uint32_t last, const char* value)
+{
+    const size_t i = name_index(value, line_break_names, LENGTH(line_break_names));
+    if (i == (size_t)-1) {
+        fprintf(stderr, "Unknown Line_Break %s.\n", value);
+        exit(EXIT_FAILURE);
+    }
+    memset(line_breaks + first, i, last - first + 1);
+}
+
+static void set_east_asian_width(uint32_t first, uint32_t last, const char* value)
+{
+    if (strcmp(value, "F") == 0 || strcmp(value, "W") == 0 || strcmp(value, "H") == 0)
+        memset(east_asian_wides + first, true, last - first + 1);
+}
+
+static void set_extended_pictographic(uint32_t first, uint32_t last, const char* value)
+{
+    if (strcmp(value, "Extended_Pictographic") == 0)
+        memset(extended_pictographics + first, true, last - first + 1);
+}
+
+// Only Indic_Conjunct_Break is used from lines "XXXX..YYYY ; InCB; Value".
+static void set_indic_conjunct_break(uint32_t first, uint32_t last, const char* value)
+{
+    if (strncmp(value, "InCB", strlen("InCB")) != 0)
+        return;
+    value = trim(strchr(value, ';') + 1);
+    uint8_t flag = 0;
+    if (strcmp(value, "Consonant") == 0)
+        flag = FLAG_INCB_CONSONANT;
+    else if (strcmp(value, "Extend") == 0)
+        flag = FLAG_INCB_EXTEND;
+    else if (strcmp(value, "Linker") == 0)
+        flag = FLAG_INCB_LINKER;
+    memset(indic_conjunct_breaks + first, flag, last - first + 1);
+}
+
+// LB1
+static uint8_t resolve_line_break(uint32_t c)
+{
+    const char* name = line_breaks[c] < LINE_BREAK_RESOLVED_LENGTH ? NULL : line_break_names[line_breaks[c]];
+    if (name == NULL)
+        return line_breaks[c];
+    if (strcmp(name, "CJ") == 0)
+        return name_index("NS", line_break_names, LENGTH(line_break_names));
+    if (strcmp(name, "SA") == 0 &&
+        (strcmp(general_categories[c], "Mn") == 0 || strcmp(general_categories[c], "Mc") == 0))
+        return name_index("CM", line_break_names, LENGTH(line_break_names));
+    return name_index("AL", line_break_names, LENGTH(line_break_names));
+}
+
+// Splits values to blocks of 1 << shift values and stores unique blocks to
+// blocks and indices of blocks to index. Returns the number of unique blocks.
+static size_t build_stage(
+    const uint16_t* values,
+    size_t          values_length, // multiple of block size
+    unsigned        shift,
+    uint16_t*       index,
+    uint16_t*       blocks)
+{
+    const size_t block_size = (size_t)1 << shift;
+    size_t blocks_length = 0;
+    for (size_t block_start = 0; block_start < values_length; block_start += block_size)
+    {
+        size_t i = 0;
+        for (; i < blocks_length; ++i)
+            if (memcmp(
+                blocks + i*block_size,
+                values + block_start,
+                block_size * sizeof blocks[0]) == 0)
+                break;
+        if (i == blocks_length)
+            memcpy(
+                blocks + blocks_length++ * block_size,
+                values + block_start,
+                block_size * sizeof blocks[0]);
+        index[block_start >> shift] = i;
+    }
+    return blocks_length;
+}
+
+static size_t element_size(size_t max_value)
+{
+    return max_value < 256 ? 1 : 2;
+}
+
+static void print_array(
+    const char* name, const uint16_t* array, size_t length, size_t max_value)
+{
+    printf("static const %s %s[%zu] = {", max_value < 256 ? "uint8_t" : "uint16_t", name, length);
+    for (size_t i = 0; i < length; ++i)
+        printf("%s%u,", i % 16 == 0 ? "\n    " : " ", (unsigned)array[i]);
+    printf("\n};\n\n");
+}
+
+// "SpacingMark" -> "SPACING_MARK"
+static void print_enum(const char* prefix, const char** names, size_t names_length)
+{
+    printf("enum\n{\n");
+    for (size_t i = 0; i < names_length; ++i) {
+        printf("    %s", prefix);
+        for (const char* c = names[i]; *c != '\0'; ++c) {
+            if (c != names[i] && isupper((unsigned char)*c) && islower((unsigned char)c[-1]))
+                putchar('_');
+            putchar(toupper((unsigned char)*c));
+        }
+        printf(",\n");
+    }
+    printf("};\n\n");
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 3) {
+        fprintf(stderr, "Usage: %s path/to/ucd unicode_version\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    for (uint32_t c = 0; c < CODEPOINT_COUNT; ++c)
+        strcpy(general_categories[c], "Cn");
+    memset(line_breaks, name_index("XX", line_break_names, LENGTH(line_break_names)), sizeof line_breaks);
+
+    parse_file(argv[1], "extracted/DerivedGeneralCategory.txt", set_general_category);
+    parse_file(argv[1], "GraphemeBreakProperty.txt",            set_grapheme_break);
+    parse_file(argv[1], "WordBreakProperty.txt",                set_word_break);
+    parse_file(argv[1], "LineBreak.txt",                        set_line_break);
+    parse_file(argv[1], "EastAsianWidth.txt",                   set_east_asian_width);
+    parse_file(argv[1], "emoji/emoji-data.txt",                 set_extended_pictographic);
+    parse_file(argv[1], "DerivedCoreProperties.txt",            set_indic_conjunct_break);
+
+    // Record of unlisted codepoints first so it will be at index 0.
+    const Record default_record = {
+        0, 0, name_index("AL", line_break_names, LENGTH(line_break_names)), 0 };
+    find_or_add_record(default_record);
+
+    const uint8_t qu = name_index("QU", line_break_names, LENGTH(line_break_names));
+    uint32_t limit = 0; // one past last codepoint with non-default record
+    for (uint32_t c = 0; c < CODEPOINT_COUNT; ++c)
+    {
+        const uint8_t line_break = resolve_line_break(c);
+        uint8_t flags = 0;
+        if (extended_pictographics[c]) {
+            flags |= FLAG_EXTENDED_PICTOGRAPHIC;
+            if (strcmp(general_categories[c], "Cn") == 0)
+                flags |= FLAG_UNASSIGNED;
+        }
+        if (east_asian_wides[c])
+            flags |= FLAG_EAST_ASIAN_WIDE;
+        flags |= indic_conjunct_breaks[c];
+        if (line_break == qu && strcmp(general_categories[c], "Pi") == 0)
+            flags |= FLAG_QUOTE_INITIAL;
+        if (line_break == qu && strcmp(general_categories[c], "Pf") == 0)
+            flags |= FLAG_QUOTE_FINAL;
+        const Record r = { grapheme_breaks[c], word_breaks[c], line_break, flags };
+        record_indices[c] = find_or_add_record(r);
+        if (record_indices[c] != 0)
+            limit = c + 1;
+    }
+
+    // Three-level trie: stage1 is split to blocks like the records, so
+    // c -> stage2[stage1[stage0[c >> (s1 + s2)] << s1 | (c >> s2 & mask1)] << s2 | (c & mask2)]
+    uint16_t* stage0 = malloc(CODEPOINT_COUNT * sizeof stage0[0]);
+    uint16_t* stage1 = malloc(CODEPOINT_COUNT * sizeof stage1[0]);
+    uint16_t* stage2 = malloc(CODEPOINT_COUNT * sizeof stage2[0] * 2);
+    uint16_t* index  = malloc(CODEPOINT_COUNT * sizeof index[0]);
+    unsigned best_shift1 = 0;
+    unsigned best_shift2 = 0;
+    size_t best_size = SIZE_MAX;
+    for (unsigned shift2 = 3; shift2 <= 10; ++shift2)
+    for (unsigned shift1 = 2; shift1 <= 8;  ++shift1)
+    {
+        const uint32_t total_shift = shift1 + shift2;
+        const uint32_t aligned_limit = (limit + (1u << total_shift) - 1) >> total_shift << total_shift;
+        const size_t stage2_blocks = build_stage(
+            record_indices, aligned_limit, shift2, index, stage2);
+        const size_t stage1_blocks = build_stage(
+            index, aligned_limit >> shift2, shift1, stage0, stage1);
+        const size_t size =
+            (aligned_limit >> total_shift) * element_size(stage1_blocks - 1)
+            + (stage1_blocks << shift1)    * element_size(stage2_blocks - 1)
+            + (stage2_blocks << shift2)    * element_size(records_length - 1);
+        if (size < best_size) {
+            best_size   = size;
+            best_shift1 = shift1;
+            best_shift2 = shift2;
+        }
+    }
+    const unsigned total_shift = best_shift1 + best_shift2;
+    limit = (limit + (1u << total_shift) - 1) >> total_shift << total_shift;
+    const size_t stage2_blocks = build_stage(record_indices, limit, best_shift2, index, stage2);
+    const size_t stage1_blocks = build_stage(index, limit >> best_shift2, best_shift1, stage0, stage1);
+
+    printf(
+        "// MIT License\n"
+        "// Copyright (c) 2023 Lauri Lorenzo Fiestas\n"
+        "// https://github.com/PrinssiFiestas/libGPC/blob/main/LICENSE.md\n"
+        "\n"
+        "// Generated by tools/breaktablegen.c from UCD %s. Do not edit!\n"
+        "// Total size of stages: %zu bytes.\n"
+        "\n"
+        "#ifndef GP_BREAK_TABLE_H\n"
+        "#define GP_BREAK_TABLE_H\n"
+        "\n"
+        "#include <stdint.h>\n"
+        "\n"
+        "#define GP_BREAK_TABLE_LIMIT  0x%X\n"
+        "#define GP_BREAK_STAGE1_SHIFT %u\n"
+        "#define GP_BREAK_STAGE1_MASK  0x%X\n"
+        "#define GP_BREAK_STAGE2_SHIFT %u\n"
+        "#define GP_BREAK_STAGE2_MASK  0x%X\n"
+        "\n"
+        "#define GP_BREAK_EXTENDED_PICTOGRAPHIC 0x%02X\n"
+        "#define GP_BREAK_EAST_ASIAN_WIDE       0x%02X\n"
+        "#define GP_BREAK_UNASSIGNED            0x%02X\n"
+        "#define GP_BREAK_INCB_CONSONANT        0x%02X\n"
+        "#define GP_BREAK_INCB_EXTEND           0x%02X\n"
+        "#define GP_BREAK_INCB_LINKER           0x%02X\n"
+        "#define GP_BREAK_QUOTE_INITIAL         0x%02X\n"
+        "#define GP_BREAK_QUOTE_FINAL           0x%02X\n"
+        "\n",
+        argv[2], best_size, (unsigned)limit,
+        best_shift1, (1u << best_shift1) - 1, best_shift2, (1u << best_shift2) - 1,
+        FLAG_EXTENDED_PICTOGRAPHIC, FLAG_EAST_ASIAN_WIDE, FLAG_UNASSIGNED,
+        FLAG_INCB_CONSONANT, FLAG_INCB_EXTEND, FLAG_INCB_LINKER,
+        FLAG_QUOTE_INITIAL, FLAG_QUOTE_FINAL);
+
+    print_enum("GP_GB_", grapheme_break_names, LENGTH(grapheme_break_names));
+    print_enum("GP_WB_", word_break_names,     LENGTH(word_break_names));
+    print_enum("GP_LB_", line_break_names,     LINE_BREAK_RESOLVED_LENGTH);
+
+    print_array("gp_break_stage0", stage0, limit >> total_shift,         stage1_blocks - 1);
+    print_array("gp_break_stage1", stage1, stage1_blocks << best_shift1, stage2_blocks - 1);
+    print_array("gp_break_stage2", stage2, stage2_blocks << best_shift2, records_length - 1);
+
+    printf("// {grapheme_break, word_break, line_break, flags}\n");
+    printf("static const uint8_t gp_break_records[%zu][4] = {", records_length);
+    for (size_t i = 0; i < records_length; ++i)
+        printf("%s{%u,%u,%u,%u},", i % 6 == 0 ? "\n    " : " ",
+            records[i].grapheme_break, records[i].word_break, records[i].line_break, records[i].flags);
+    printf("\n};\n\n#endif // GP_BREAK_TABLE_H\n");
+
+    free(stage0);
+    free(stage1);
+    free(stage2);
+    free(index);
+}
@@ -0,0 +1,182 @@
+// MIT License
+// Copyright (c) 2023 Lauri Lorenzo Fiestas
+// https://github.com/PrinssiFiestas/libGPC/blob/main/LICENSE.md
+
+// Generates src/case_table.h used by gp_u32_to_upper(), gp_u32_to_lower(), and
+// gp_u32_to_title() from simple case mappings in UnicodeData.txt. Usage:
+//
+//     gcc -o build/casetablegen tools/casetablegen.c
+//     ./build/casetablegen path/to/UnicodeData.txt 16.0.0 > src/case_table.h
+//
+// UnicodeData.txt can be found in https://www.unicode.org/Public/UCD/latest/ucd/
+//
+// Each codepoint maps to a record of deltas {upper, lower, title} which are
+// added to the codepoint. There are only a few hundred distinct records, and
+// codepoints are split to blocks, so identical blocks can be shared. The result
+// is a two-level trie: block_index = stage1[c >> shift], and
+// record = records[stage2[(block_index << shift) | (c & mask)]]. Block size is
+// chosen to minimize the total size of the tables.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define CODEPOINT_COUNT 0x110000
+#define MAX_RECORDS     4096
+
+typedef struct record { int32_t upper, lower, title; } Record;
+
+static Record   records[MAX_RECORDS];
+static size_t   records_length = 1; // identity record at 0
+static uint16_t record_indices[CODEPOINT_COUNT];
+
+static size_t find_or_add_record(Record r)
+{
+    for (size_t i = 0; i < records_length; ++i)
+        if (memcmp(&records[i], &r, sizeof r) == 0)
+            return i;
+    if (records_length == MAX_RECORDS) {
+        fprintf(stderr, "Too many records.\n");
+        exit(EXIT_FAILURE);
+    }
+    records[records_length] = r;
+    return records_length++;
+}
+
+// Returns total size of tables in bytes and optionally fills them.
+static size_t build_tables(
+    unsigned  shift,
+    uint32_t  limit,
+    uint16_t* stage1,
+    size_t*   out_blocks_length,
+    uint16_t* stage2)
+{
+    const size_t block_size = (size_t)1 << shift;
+    size_t blocks_length = 0;
+    for (uint32_t block_start = 0; block_start < limit; block_start += block_size)
+    {
+        size_t i = 0;
+        for (; i < blocks_length; ++i)
+            if (memcmp(
+                stage2 + i*block_size,
+                record_indices + block_start,
+                block_size * sizeof stage2[0]) == 0)
+                break;
+        if (i == blocks_length)
+            memcpy(
+                stage2 + blocks_length++ * block_size,
+                record_indices + block_start,
+                block_size * sizeof stage2[0]);
+        stage1[block_start >> shift] = i;
+    }
+    *out_blocks_length = blocks_length;
+
+    const size_t stage1_element_size = blocks_length  <= 256 ? 1 : 2;
+    const size_t stage2_element_size = records_length <= 256 ? 1 : 2;
+    return (limit >> shift) * stage1_element_size
+        + blocks_length * block_size * stage2_element_size;
+}
+
+static void print_array(
+    const char* name, const uint16_t* array, size_t length, size_t max_value)
+{
+    printf("static const %s %s[%zu] = {", max_value < 256 ? "uint8_t" : "uint16_t", name, length);
+    for (size_t i = 0; i < length; ++i)
+        printf("%s%u,", i % 16 == 0 ? "\n    " : " ", (unsigned)array[i]);
+    printf("\n};\n\n");
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 3) {
+        fprintf(stderr, "Usage: %s UnicodeData.txt unicode_version\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    FILE* f = fopen(argv[1], "r");
+    if (f == NULL) {
+        perror(argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    uint32_t limit = 0; // one past last codepoint with mappings
+    char line[1024];
+    while (fgets(line, sizeof line, f) != NULL)
+    {
+        char* fields[15] = {0};
+        size_t fields_length = 0;
+        fields[fields_length++] = line;
+        for (char* c = line; *c != '\0' && fields_length < 15; ++c) {
+            if (*c == ';') {
+                *c = '\0';
+                fields[fields_length++] = c + 1;
+            }
+        }
+        if (fields_length < 15)
+            continue;
+
+        const uint32_t codepoint = strtoul(fields[0], NULL, 16);
+        const uint32_t upper = fields[12][0] != '\0' ? strtoul(fields[12], NULL, 16) : codepoint;
+        const uint32_t lower = fields[13][0] != '\0' ? strtoul(fields[13], NULL, 16) : codepoint;
+        const uint32_t title = fields[14][0] != '\0' && fields[14][0] != '\n' && fields[14][0] != '\r' ?
+            strtoul(fields[14], NULL, 16) : upper; // empty title means same as upper
+        if (upper == codepoint && lower == codepoint && title == codepoint)
+            continue;
+
+        const Record r = {
+            (int32_t)(upper - codepoint), (int32_t)(lower - codepoint), (int32_t)(title - codepoint) };
+        record_indices[codepoint] = find_or_add_record(r);
+        if (codepoint >= limit)
+            limit = codepoint + 1;
+    }
+    fclose(f);
+
+    uint16_t* stage1 = malloc(CODEPOINT_COUNT * sizeof stage1[0]);
+    uint16_t* stage2 = malloc(CODEPOINT_COUNT * sizeof stage2[0] * 2);
+    size_t blocks_length;
+    unsigned best_shift = 0;
+    size_t best_size = SIZE_MAX;
+    for (unsigned shift = 3; shift <= 10; ++shift) {
+        const uint32_t aligned_limit = (limit + (1u << shift) - 1) >> shift << shift;
+        const size_t size = build_tables(shift, aligned_limit, stage1, &blocks_length, stage2);
+        if (size < best_size) {
+            best_size  = size;
+            best_shift = shift;
+        }
+    }
+    limit = (limit + (1u << best_shift) - 1) >> best_shift << best_shift;
+    build_tables(best_shift, limit, stage1, &blocks_length, stage2);
+
+    printf(
+        "// MIT License\n"
+        "// Copyright (c) 2023 Lauri Lorenzo Fiestas\n"
+        "// https://github.com/PrinssiFiestas/libGPC/blob/main/LICENSE.md\n"
+        "\n"
+        "// Generated by tools/casetablegen.c from UnicodeData.txt %s. Do not edit!\n"
+        "// Total size of stages: %zu bytes.\n"
+        "\n"
+        "#ifndef GP_CASE_TABLE_H\n"
+        "#define GP_CASE_TABLE_H\n"
+        "\n"
+        "#include <stdint.h>\n"
+        "\n"
+        "#define GP_CASE_TABLE_LIMIT 0x%X\n"
+        "#define GP_CASE_BLOCK_SHIFT %u\n"
+        "#define GP_CASE_BLOCK_MASK  0x%X\n"
+        "\n",
+        argv[2], best_size, (unsigned)limit, best_shift, (1u << best_shift) - 1);
+
+    print_array("gp_case_stage1", stage1, limit >> best_shift, blocks_length - 1);
+    print_array("gp_case_stage2", stage2, blocks_length << best_shift, records_length - 1);
+
+    printf("// {upper, lower, title} deltas\n");
+    printf("static const int32_t gp_case_deltas[%zu][3] = {", records_length);
+    for (size_t i = 0; i < records_length; ++i)
+        printf("%s{%d,%d,%d},", i % 6 == 0 ? "\n    " : " ",
+            records[i].upper, records[i].lower, records[i].title);
+    printf("\n};\n\n#endif // GP_CASE_TABLE_H\n");
+
+    free(stage1);
+    free(stage2);
+}
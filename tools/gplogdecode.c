@@ -0,0 +1,42 @@
+// MIT License
+// Copyright (c) 2023 Lauri Lorenzo Fiestas
+// https://github.com/PrinssiFiestas/libGPC/blob/main/LICENSE.md
+
+// Formats binary logs written by gp_log() as text.
+
+#include <gpc/log.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+int main(int argc, char* argv[])
+{
+    if (argc > 3 || (argc > 1 && (strcmp(argv[1], "-h") == 0 || strcmp(argv[1], "--help") == 0))) {
+        fprintf(stderr,
+            "Usage: %s [binary log file] [output file]\n"
+            "Reads from stdin and writes to stdout if files are not given.\n",
+            argv[0]);
+        return argc > 3 ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+
+    FILE* in  = stdin;
+    FILE* out = stdout;
+    if (argc > 1 && (in = fopen(argv[1], "rb")) == NULL) {
+        perror(argv[1]);
+        return EXIT_FAILURE;
+    }
+    if (argc > 2 && (out = fopen(argv[2], "w")) == NULL) {
+        perror(argv[2]);
+        return EXIT_FAILURE;
+    }
+
+    const bool success = gp_log_decode(out, in);
+    if ( ! success)
+        fprintf(stderr, "%s: not a log file or the log is truncated.\n", argc > 1 ? argv[1] : "stdin");
+
+    if (in != stdin)
+        fclose(in);
+    if (out != stdout)
+        fclose(out);
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,492 @@
+// MIT License
+// Copyright (c) 2023 Lauri Lorenzo Fiestas
+// https://github.com/PrinssiFiestas/libGPC/blob/main/LICENSE.md
+
+// Generates src/norm_table.h used by Unicode normalization from the Unicode
+// Character Database. Usage:
+//
+//     gcc -o build/normtablegen tools/normtablegen.c
+//     ./build/normtablegen path/to/ucd 15.1.0 > src/norm_table.h
+//
+// The UCD directory can be found in https://www.unicode.org/Public/UCD/latest/
+// and it should contain UnicodeData.txt and DerivedNormalizationProps.txt.
+//
+// Each codepoint maps to a record {canonical_combining_class, flags,
+// decomposition}, where flags contain quick check properties and decomposition
+// is an offset to gp_norm_decompositions. Decompositions are stored as full
+// decompositions already in canonical order encoded in UTF-8, so decomposing
+// is a matter of copying bytes. Records are stored in a three-level trie like
+// in tools/breaktablegen.c. Primary composites are stored separately as
+// triplets {first, second, composite} sorted for binary search.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <ctype.h>
+
+#define CODEPOINT_COUNT      0x110000
+#define MAX_RECORDS          0x10000
+#define MAX_DECOMPOSITION    32
+#define DECOMPOSITIONS_SIZE  0x10000
+#define MAX_COMPOSITIONS     4096
+
+#define FLAG_NFD_NO     0x01
+#define FLAG_NFC_NO     0x02
+#define FLAG_NFC_MAYBE  0x04
+#define FLAG_NFKD_NO    0x08
+#define FLAG_NFKC_NO    0x10
+#define FLAG_NFKC_MAYBE 0x20
+
+#define HANGUL_S_BASE  0xAC00
+#define HANGUL_L_BASE  0x1100
+#define HANGUL_V_BASE  0x1161
+#define HANGUL_T_BASE  0x11A7
+#define HANGUL_T_COUNT 28
+#define HANGUL_N_COUNT (21 * HANGUL_T_COUNT)
+#define HANGUL_S_COUNT (19 * HANGUL_N_COUNT)
+
+#define LENGTH(ARR) (sizeof(ARR) / sizeof(ARR)[0])
+
+typedef struct record { uint8_t ccc, flags; uint16_t decomposition; } Record;
+
+static Record   records[MAX_RECORDS];
+static size_t   records_length;
+static uint16_t record_indices[CODEPOINT_COUNT];
+
+static uint8_t  cccs[CODEPOINT_COUNT];
+static uint8_t  flags[CODEPOINT_COUNT];
+static bool     exclusions[CODEPOINT_COUNT];
+static uint32_t mappings[CODEPOINT_COUNT][MAX_DECOMPOSITION]; // single level
+static uint8_t  mapping_lengths[CODEPOINT_COUNT];
+static bool     mapping_is_compat[CODEPOINT_COUNT];
+
+static uint8_t  decompositions[DECOMPOSITIONS_SIZE];
+static size_t   decompositions_length;
+
+static uint32_t compositions[MAX_COMPOSITIONS][3];
+static size_t   compositions_length;
+
+static size_t find_or_add_record(Record r)
+{
+    for (size_t i = 0; i < records_length; ++i)
+        if (memcmp(&records[i], &r, sizeof r) == 0)
+            return i;
+    if (records_length == MAX_RECORDS) {
+        fprintf(stderr, "Too many records.\n");
+        exit(EXIT_FAILURE);
+    }
+    records[records_length] = r;
+    return records_length++;
+}
+
+static char* trim(char* s)
+{
+    while (isspace((unsigned char)*s))
+        ++s;
+    size_t length = strlen(s);
+    while (length > 0 && isspace((unsigned char)s[length - 1]))
+        s[--length] = '\0';
+    return s;
+}
+
+static FILE* open_file(const char* dir, const char* file)
+{
+    char path[4096];
+    snprintf(path, sizeof path, "%s/%s", dir, file);
+    FILE* stream = fopen(path, "r");
+    if (stream == NULL) {
+        perror(path);
+        exit(EXIT_FAILURE);
+    }
+    return stream;
+}
+
+// Fields: code;name;category;ccc;bidi;decomposition;...
+static void parse_unicode_data(const char* dir)
+{
+    FILE* stream = open_file(dir, "UnicodeData.txt");
+    char line[1024];
+    while (fgets(line, sizeof line, stream) != NULL)
+    {
+        char* fields[6];
+        char* field = line;
+        size_t fields_length = 0;
+        for (; fields_length < LENGTH(fields); ++fields_length) {
+            fields[fields_length] = field;
+            if ((field = strchr(field, ';')) == NULL)
+                break;
+            *field++ = '\0';
+        }
+        if (fields_length < LENGTH(fields))
+            continue;
+
+        const uint32_t c = strtoul(fields[0], NULL, 16);
+        cccs[c] = strtoul(fields[3], NULL, 10);
+
+        char* decomposition = trim(fields[5]);
+        if (decomposition[0] == '<') {
+            mapping_is_compat[c] = true;
+            decomposition = strchr(decomposition, '>') + 1;
+        }
+        for (char* end; *(decomposition = trim(decomposition)) != '\0'; decomposition = end)
+            mappings[c][mapping_lengths[c]++] = strtoul(decomposition, &end, 16);
+    }
+    fclose(stream);
+}
+
+// Lines "XXXX..YYYY ; Property ; Value # comment".
+static void parse_normalization_props(const char* dir)
+{
+    FILE* stream = open_file(dir, "DerivedNormalizationProps.txt");
+    char line[1024];
+    while (fgets(line, sizeof line, stream) != NULL)
+    {
+        char* comment = strchr(line, '#');
+        if (comment != NULL)
+            *comment = '\0';
+        char* property = strchr(line, ';');
+        if (property == NULL)
+            continue;
+        *property++ = '\0';
+        char* value = strchr(property, ';');
+        if (value != NULL)
+            *value++ = '\0';
+        property = trim(property);
+        value = value != NULL ? trim(value) : "";
+
+        char* end;
+        const uint32_t first = strtoul(line, &end, 16);
+        const uint32_t last  = end[0] == '.' && end[1] == '.' ? strtoul(end + 2, NULL, 16) : first;
+        for (uint32_t c = first; c <= last; ++c)
+        {
+            if (strcmp(property, "Full_Composition_Exclusion") == 0)
+                exclusions[c] = true;
+            else if (strcmp(property, "NFC_QC") == 0)
+                flags[c] |= value[0] == 'N' ? FLAG_NFC_NO : FLAG_NFC_MAYBE;
+            else if (strcmp(property, "NFKC_QC") == 0)
+                flags[c] |= value[0] == 'N' ? FLAG_NFKC_NO : FLAG_NFKC_MAYBE;
+        }
+    }
+    fclose(stream);
+}
+
+// Recursive decomposition without reordering.
+static size_t decompose(uint32_t* out, uint32_t c, bool compat)
+{
+    if (HANGUL_S_BASE <= c && c < HANGUL_S_BASE + HANGUL_S_COUNT)
+    {
+        const uint32_t s = c - HANGUL_S_BASE;
+        size_t length = 0;
+        out[length++] = HANGUL_L_BASE + s / HANGUL_N_COUNT;
+        out[length++] = HANGUL_V_BASE + s % HANGUL_N_COUNT / HANGUL_T_COUNT;
+        if (s % HANGUL_T_COUNT != 0)
+            out[length++] = HANGUL_T_BASE + s % HANGUL_T_COUNT;
+        return length;
+    }
+    if (mapping_lengths[c] == 0 || (mapping_is_compat[c] && ! compat)) {
+        out[0] = c;
+        return 1;
+    }
+    size_t length = 0;
+    for (size_t i = 0; i < mapping_lengths[c]; ++i)
+        length += decompose(out + length, mappings[c][i], compat);
+    if (length > MAX_DECOMPOSITION) {
+        fprintf(stderr, "Decomposition of U+%04X too long.\n", (unsigned)c);
+        exit(EXIT_FAILURE);
+    }
+    return length;
+}
+
+// Stable sort of non-starters.
+static void canonical_order(uint32_t* cs, size_t length)
+{
+    for (size_t i = 1; i < length; ++i)
+        for (size_t j = i; j > 0 && cccs[cs[j]] != 0 && cccs[cs[j - 1]] > cccs[cs[j]]; --j) {
+            const uint32_t tmp = cs[j];
+            cs[j] = cs[j - 1];
+            cs[j - 1] = tmp;
+        }
+}
+
+static size_t utf8_encode(uint8_t* out, uint32_t c)
+{
+    if (c < 0x80) {
+        out[0] = c;
+        return 1;
+    } else if (c < 0x800) {
+        out[0] = 0xC0 | c >> 6;
+        out[1] = 0x80 | (c & 0x3F);
+        return 2;
+    } else if (c < 0x10000) {
+        out[0] = 0xE0 | c >> 12;
+        out[1] = 0x80 | (c >> 6 & 0x3F);
+        out[2] = 0x80 | (c & 0x3F);
+        return 3;
+    }
+    out[0] = 0xF0 | c >> 18;
+    out[1] = 0x80 | (c >> 12 & 0x3F);
+    out[2] = 0x80 | (c >> 6 & 0x3F);
+    out[3] = 0x80 | (c & 0x3F);
+    return 4;
+}
+
+static size_t utf8_encode_all(uint8_t* out, const uint32_t* cs, size_t length)
+{
+    size_t out_length = 0;
+    for (size_t i = 0; i < length; ++i)
+        out_length += utf8_encode(out + out_length, cs[i]);
+    return out_length;
+}
+
+// Stores {canonical_length, compat_length, canonical..., compat...} where
+// compat_length is 0 if compatibility decomposition is the canonical one.
+static uint16_t add_decomposition(uint32_t c)
+{
+    uint32_t canonical[MAX_DECOMPOSITION];
+    uint32_t compat[MAX_DECOMPOSITION];
+    size_t canonical_length = decompose(canonical, c, false);
+    size_t compat_length    = decompose(compat,    c, true);
+    canonical_order(canonical, canonical_length);
+    canonical_order(compat,    compat_length);
+    if (compat_length == canonical_length &&
+        memcmp(compat, canonical, compat_length * sizeof compat[0]) == 0)
+        compat_length = 0;
+    if (canonical_length == 1 && canonical[0] == c)
+        canonical_length = 0;
+    if (canonical_length == 0 && compat_length == 0)
+        return 0;
+
+    uint8_t entry[2 + 2 * 4 * MAX_DECOMPOSITION];
+    entry[0] = utf8_encode_all(entry + 2, canonical, canonical_length);
+    entry[1] = utf8_encode_all(entry + 2 + entry[0], compat, compat_length);
+    const size_t entry_length = 2 + entry[0] + entry[1];
+
+    for (size_t i = 0; i + entry_length <= decompositions_length; ++i)
+        if (memcmp(decompositions + i, entry, entry_length) == 0)
+            return i;
+    if (decompositions_length + entry_length > DECOMPOSITIONS_SIZE) {
+        fprintf(stderr, "Too many decompositions.\n");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(decompositions + decompositions_length, entry, entry_length);
+    decompositions_length += entry_length;
+    return decompositions_length - entry_length;
+}
+
+static int composition_compare(const void* _a, const void* _b)
+{
+    const uint32_t* a = _a;
+    const uint32_t* b = _b;
+    if (a[0] != b[0])
+        return a[0] < b[0] ? -1 : 1;
+    return (a[1] > b[1]) - (a[1] < b[1]);
+}
+
+// Splits values to blocks of 1 << shift values and stores unique blocks to
+// blocks and indices of blocks to index. Returns the number of unique blocks.
+static size_t build_stage(
+    const uint16_t* values,
+    size_t          values_length, // multiple of block size
+    unsigned        shift,
+    uint16_t*       index,
+    uint16_t*       blocks)
+{
+    const size_t block_size = (size_t)1 << shift;
+    size_t blocks_length = 0;
+    for (size_t block_start = 0; block_start < values_length; block_start += block_size)
+    {
+        size_t i = 0;
+        for (; i < blocks_length; ++i)
+            if (memcmp(
+                blocks + i*block_size,
+                values + block_start,
+                block_size * sizeof blocks[0]) == 0)
+                break;
+        if (i == blocks_length)
+            memcpy(
+                blocks + blocks_length++ * block_size,
+                values + block_start,
+                block_size * sizeof blocks[0]);
+        index[block_start >> shift] = i;
+    }
+    return blocks_length;
+}
+
+static size_t element_size(size_t max_value)
+{
+    return max_value < 256 ? 1 : 2;
+}
+
+static void print_array(
+    const char* name, const uint16_t* array, size_t length, size_t max_value)
+{
+    printf("static const %s %s[%zu] = {", max_value < 256 ? "uint8_t" : "uint16_t", name, length);
+    for (size_t i = 0; i < length; ++i)
+        printf("%s%u,", i % 16 == 0 ? "\n    " : " ", (unsigned)array[i]);
+    printf("\n};\n\n");
+}
+
+// Lead byte of the first codepoint that may not be normalized in a form.
+static unsigned min_lead_byte(uint8_t form_flags, bool check_ccc)
+{
+    for (uint32_t c = 0; c < CODEPOINT_COUNT; ++c)
+        if ((flags[c] & form_flags) || (check_ccc && cccs[c] != 0)) {
+            uint8_t encoding[4];
+            utf8_encode(encoding, c);
+            return encoding[0];
+        }
+    return 0xFF;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 3) {
+        fprintf(stderr, "Usage: %s path/to/ucd unicode_version\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    parse_unicode_data(argv[1]);
+    parse_normalization_props(argv[1]);
+
+    for (uint32_t c = 0; c < CODEPOINT_COUNT; ++c)
+    {
+        const bool hangul = HANGUL_S_BASE <= c && c < HANGUL_S_BASE + HANGUL_S_COUNT;
+        if (hangul || (mapping_lengths[c] != 0 && ! mapping_is_compat[c]))
+            flags[c] |= FLAG_NFD_NO;
+        if (hangul || mapping_lengths[c] != 0)
+            flags[c] |= FLAG_NFKD_NO;
+
+        if (mapping_lengths[c] == 2 && ! mapping_is_compat[c] && ! exclusions[c]) {
+            if (compositions_length == MAX_COMPOSITIONS) {
+                fprintf(stderr, "Too many compositions.\n");
+                return EXIT_FAILURE;
+            }
+            compositions[compositions_length][0] = mappings[c][0];
+            compositions[compositions_length][1] = mappings[c][1];
+            compositions[compositions_length][2] = c;
+            ++compositions_length;
+        }
+    }
+    qsort(compositions, compositions_length, sizeof compositions[0], composition_compare);
+
+    // Empty decomposition and record of unlisted codepoints first so they will
+    // be at index 0.
+    decompositions_length = 2;
+    find_or_add_record((Record){0});
+
+    uint32_t limit = 0; // one past last codepoint with non-default record
+    for (uint32_t c = 0; c < CODEPOINT_COUNT; ++c)
+    {
+        // Hangul syllables are decomposed algorithmically.
+        const bool hangul = HANGUL_S_BASE <= c && c < HANGUL_S_BASE + HANGUL_S_COUNT;
+        const Record r = { cccs[c], flags[c], hangul ? 0 : add_decomposition(c) };
+        record_indices[c] = find_or_add_record(r);
+        if (record_indices[c] != 0)
+            limit = c + 1;
+    }
+
+    // c -> stage2[stage1[stage0[c >> (s1 + s2)] << s1 | (c >> s2 & mask1)] << s2 | (c & mask2)]
+    uint16_t* stage0 = malloc(CODEPOINT_COUNT * sizeof stage0[0]);
+    uint16_t* stage1 = malloc(CODEPOINT_COUNT * sizeof stage1[0]);
+    uint16_t* stage2 = malloc(CODEPOINT_COUNT * sizeof stage2[0] * 2);
+    uint16_t* index  = malloc(CODEPOINT_COUNT * sizeof index[0]);
+    unsigned best_shift1 = 0;
+    unsigned best_shift2 = 0;
+    size_t best_size = SIZE_MAX;
+    for (unsigned shift2 = 3; shift2 <= 10; ++shift2)
+    for (unsigned shift1 = 2; shift1 <= 8;  ++shift1)
+    {
+        const uint32_t total_shift = shift1 + shift2;
+        const uint32_t aligned_limit = (limit + (1u << total_shift) - 1) >> total_shift << total_shift;
+        const size_t stage2_blocks = build_stage(
+            record_indices, aligned_limit, shift2, index, stage2);
+        const size_t stage1_blocks = build_stage(
+            index, aligned_limit >> shift2, shift1, stage0, stage1);
+        const size_t size =
+            (aligned_limit >> total_shift) * element_size(stage1_blocks - 1)
+            + (stage1_blocks << shift1)    * element_size(stage2_blocks - 1)
+            + (stage2_blocks << shift2)    * element_size(records_length - 1);
+        if (size < best_size) {
+            best_size   = size;
+            best_shift1 = shift1;
+            best_shift2 = shift2;
+        }
+    }
+    const unsigned total_shift = best_shift1 + best_shift2;
+    limit = (limit + (1u << total_shift) - 1) >> total_shift << total_shift;
+    const size_t stage2_blocks = build_stage(record_indices, limit, best_shift2, index, stage2);
+    const size_t stage1_blocks = build_stage(index, limit >> best_shift2, best_shift1, stage0, stage1);
+
+    printf(
+        "// MIT License\n"
+        "// Copyright (c) 2023 Lauri Lorenzo Fiestas\n"
+        "// https://github.com/PrinssiFiestas/libGPC/blob/main/LICENSE.md\n"
+        "\n"
+        "// Generated by tools/normtablegen.c from UCD %s. Do not edit!\n"
+        "// Total size of stages: %zu bytes, records: %zu bytes, decompositions: %zu\n"
+        "// bytes, compositions: %zu bytes.\n"
+        "\n"
+        "#ifndef GP_NORM_TABLE_H\n"
+        "#define GP_NORM_TABLE_H\n"
+        "\n"
+        "#include <stdint.h>\n"
+        "\n"
+        "#define GP_NORM_TABLE_LIMIT  0x%X\n"
+        "#define GP_NORM_STAGE1_SHIFT %u\n"
+        "#define GP_NORM_STAGE1_MASK  0x%X\n"
+        "#define GP_NORM_STAGE2_SHIFT %u\n"
+        "#define GP_NORM_STAGE2_MASK  0x%X\n"
+        "\n"
+        "#define GP_NORM_NFD_NO     0x%X\n"
+        "#define GP_NORM_NFC_NO     0x%X\n"
+        "#define GP_NORM_NFC_MAYBE  0x%X\n"
+        "#define GP_NORM_NFKD_NO    0x%X\n"
+        "#define GP_NORM_NFKC_NO    0x%X\n"
+        "#define GP_NORM_NFKC_MAYBE 0x%X\n"
+        "\n"
+        "// Bytes smaller than these only start codepoints that are normalized.\n"
+        "#define GP_NORM_NFD_MIN_LEAD_BYTE  0x%X\n"
+        "#define GP_NORM_NFC_MIN_LEAD_BYTE  0x%X\n"
+        "#define GP_NORM_NFKD_MIN_LEAD_BYTE 0x%X\n"
+        "#define GP_NORM_NFKC_MIN_LEAD_BYTE 0x%X\n"
+        "\n",
+        argv[2], best_size, records_length * sizeof records[0], decompositions_length,
+        compositions_length * sizeof compositions[0], (unsigned)limit,
+        best_shift1, (1u << best_shift1) - 1, best_shift2, (1u << best_shift2) - 1,
+        FLAG_NFD_NO, FLAG_NFC_NO, FLAG_NFC_MAYBE, FLAG_NFKD_NO, FLAG_NFKC_NO, FLAG_NFKC_MAYBE,
+        min_lead_byte(FLAG_NFD_NO, true),
+        min_lead_byte(FLAG_NFC_NO | FLAG_NFC_MAYBE, true),
+        min_lead_byte(FLAG_NFKD_NO, true),
+        min_lead_byte(FLAG_NFKC_NO | FLAG_NFKC_MAYBE, true));
+
+    print_array("gp_norm_stage0", stage0, limit >> total_shift,         stage1_blocks - 1);
+    print_array("gp_norm_stage1", stage1, stage1_blocks << best_shift1, stage2_blocks - 1);
+    print_array("gp_norm_stage2", stage2, stage2_blocks << best_shift2, records_length - 1);
+
+    printf("// {canonical_combining_class, flags, decomposition}\n");
+    printf("static const struct gp_norm_record { uint8_t ccc, flags; uint16_t decomposition; }\n");
+    printf("gp_norm_records[%zu] = {", records_length);
+    for (size_t i = 0; i < records_length; ++i)
+        printf("%s{%u,%u,%u},", i % 6 == 0 ? "\n    " : " ",
+            records[i].ccc, records[i].flags, records[i].decomposition);
+    printf("\n};\n\n");
+
+    printf("// {canonical_length, compat_length, canonical..., compat...} in UTF-8\n");
+    printf("static const uint8_t gp_norm_decompositions[%zu] = {", decompositions_length);
+    for (size_t i = 0; i < decompositions_length; ++i)
+        printf("%s%u,", i % 16 == 0 ? "\n    " : " ", decompositions[i]);
+    printf("\n};\n\n");
+
+    printf("// {first, second, composite} sorted by first and second\n");
+    printf("static const uint32_t gp_norm_compositions[%zu][3] = {", compositions_length);
+    for (size_t i = 0; i < compositions_length; ++i)
+        printf("%s{0x%X,0x%X,0x%X},", i % 3 == 0 ? "\n    " : " ",
+            compositions[i][0], compositions[i][1], compositions[i][2]);
+    printf("\n};\n\n#endif // GP_NORM_TABLE_H\n");
+
+    free(stage0);
+    free(stage1);
+    free(stage2);
+    free(index);
+}